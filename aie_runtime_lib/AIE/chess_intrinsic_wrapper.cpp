@@ -25,3 +25,6 @@ extern "C" void llvm___aie___lock___acquire___reg(unsigned id, unsigned val) {
 extern "C" void llvm___aie___lock___release___reg(unsigned id, unsigned val) {
   release(id, val);
 }
+extern "C" unsigned long long llvm___aie___get___cycles() {
+  return get_cycles();
+}
@@ -1 +1,2 @@
-// Unsupported exp_lut.h for AIE1
+// AIE1 has no parallel look up tables, exp and tanh are computed in
+// vec_math.h
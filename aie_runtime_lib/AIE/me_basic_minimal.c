@@ -0,0 +1,50 @@
+//===- me_basic_minimal.c ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// The startup of the cores without static constructors, which aiecc.py links
+// instead of me_basic.o: _main_init sets up the stack and the mode of the
+// core as me_basic.o does, then calls the core function straight away, and
+// stops the core when it returns without going through exit().
+//
+//===----------------------------------------------------------------------===//
+
+extern "C" {
+
+int main(int argc, char *argv[]);
+
+void _main_init(int argc, char **argv) property(envelope);
+
+// clang-format off
+inline assembly void chess_envelope_open() {
+  asm_begin
+  .label __AIE_ARCH_MODEL_VERSION__10012200 global
+    NOP; MOV.u20 sp, #_sp_start_value_DM_stack // init SP
+    NOP; MOV.s12 r12, #0
+    MOV mc0, r12 // Clear all status bits
+    MOV mc1, r12 // Clear all status bits
+  asm_end
+}
+// clang-format on
+
+void _main_init(int argc, char **argv) property(envelope) {
+  me_primitive::control_md0_w = 0; // default: disable saturation and rounding
+  set_MD(0, 1);                    //          and all floating point exceptions
+
+  main(argc, argv);
+  done();
+}
+
+void __cxa_finalize(void *) {}
+
+// From me_defs.c
+const int chess_storage(% 32) ZERO[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+const int chess_storage(% 32) ONES[8] = {1, 0, 0, 0, 0, 0, 0, 0};
+
+} // extern "C"
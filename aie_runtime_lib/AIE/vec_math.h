@@ -1 +1,312 @@
-// Unsupported sqrt.h for AIE1
+//===-  vec_math.h -====//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// The math functions of AIE2/vec_math.h for the float vectors of AIE1, which
+// has no bfloat16. They run on the floating-point vector unit, whose
+// multiplications and MACs keep their products in float.
+//===----------------------------------------------------------------------===//
+
+#ifndef VEC_MATH_H
+#define VEC_MATH_H
+
+#include "aie_api/aie.hpp"
+
+// Approximate 1 / sqrt(x) by the fast inverse square root of Quake III Arena,
+// see AIE2/vec_math.h, with two Newton-Raphson iterations for a relative
+// error below 5e-6.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+rsqrtFloat(aie::vector<float, N> x) {
+  const aie::vector<int32, N> magic = aie::broadcast<int32, N>(0x5f3759df);
+  const aie::vector<float, N> threeHalfs = aie::broadcast<float, N>(1.5f);
+  aie::vector<float, N> x2 = aie::mul(x, 0.5f).template to_vector<float>();
+  aie::vector<float, N> y =
+      aie::sub(magic, aie::downshift(x.template cast_to<int32>(), 1))
+          .template cast_to<float>();
+  for (int i = 0; i < 2; i++) {
+    aie::vector<float, N> x2y = aie::mul(x2, y).template to_vector<float>();
+    aie::vector<float, N> x2yy = aie::mul(x2y, y).template to_vector<float>();
+    // y = y * (threehalfs - (x2 * y * y))
+    y = aie::mul(y, aie::sub(threeHalfs, x2yy)).template to_vector<float>();
+  }
+  return y;
+}
+
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+sqrtFloat(aie::vector<float, N> x) {
+  return aie::mul(x, rsqrtFloat<N>(x)).template to_vector<float>();
+}
+
+// Approximate 1 / x by subtracting the bits of x from the magic number
+// 0x7ef311c3, refined by three Newton-Raphson iterations y = y * (2 - x * y).
+// x must be finite and non-zero.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+invFloat(aie::vector<float, N> x) {
+  const aie::vector<int32, N> magic = aie::broadcast<int32, N>(0x7ef311c3);
+  const aie::vector<float, N> two = aie::broadcast<float, N>(2.0f);
+  aie::vector<float, N> y =
+      aie::sub(magic, x.template cast_to<int32>()).template cast_to<float>();
+  for (int i = 0; i < 3; i++) {
+    aie::vector<float, N> xy = aie::mul(x, y).template to_vector<float>();
+    y = aie::mul(y, aie::sub(two, xy)).template to_vector<float>();
+  }
+  return y;
+}
+
+// Approximate exp(x) as 2^k * exp(r), for the nearest integer k to
+// x / ln(2) and r = x - k * ln(2) in [-ln(2) / 2, ln(2) / 2], exp(r) by its
+// Taylor polynomial of degree 6 and 2^k by adding k to the exponent of
+// exp(r). ln(2) is split into C1 + C2, with C1 exact in few bits, so that the
+// product by k does not lose the bits of r. x is clamped to [-87, 88], where
+// exp(x) is a normal float.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+expFloat(aie::vector<float, N> x) {
+  constexpr float log2e = 1.4426950408889634;
+  constexpr float minus_c1 = -0.693359375;
+  constexpr float minus_c2 = 2.12194440054690583e-4;
+  constexpr float one = 1.0;
+  constexpr float E2 = 0.5;
+  constexpr float E3 = 0.16666666666666666;
+  constexpr float E4 = 0.041666666666666664;
+  constexpr float E5 = 0.008333333333333333;
+  constexpr float E6 = 0.001388888888888889;
+  // adding 1.5 * 2^23 rounds |y| < 2^22 to an integer in the low bits
+  const aie::vector<float, N> magic = aie::broadcast<float, N>(12582912.0f);
+  const aie::vector<int32, N> magic_bits =
+      aie::broadcast<int32, N>(0x4b400000);
+  x = aie::max(aie::min(x, aie::broadcast<float, N>(88.0f)),
+               aie::broadcast<float, N>(-87.0f));
+  aie::vector<float, N> y = aie::mul(x, log2e).template to_vector<float>();
+  aie::vector<float, N> k_magic = aie::add(y, magic);
+  aie::vector<float, N> k = aie::sub(k_magic, magic);
+
+  aie::accum<accfloat, N> acc = aie::mul(x, one);
+  acc = aie::mac(acc, k, minus_c1);
+  acc = aie::mac(acc, k, minus_c2);
+  aie::vector<float, N> r = acc.template to_vector<float>();
+
+  // exp(r) = 1 + r + E2 * r^2 + ... + E6 * r^6, by Horner's rule
+  aie::vector<float, N> p = aie::broadcast<float, N>(E6);
+  for (float c : {E5, E4, E3, E2, one, one}) {
+    acc = aie::mul(p, r);
+    p = aie::add(acc.template to_vector<float>(), aie::broadcast<float, N>(c));
+  }
+
+  aie::vector<int32, N> k_int =
+      aie::sub(k_magic.template cast_to<int32>(), magic_bits);
+  aie::vector<int32, N> bits =
+      aie::add(p.template cast_to<int32>(), aie::upshift(k_int, 23));
+  return bits.template cast_to<float>();
+}
+
+// Approximate tanh(x) = 1 - 2 / (exp(2 * x) + 1), for x clamped to [-9, 9],
+// where tanh(x) is 1 or -1 in float.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+tanhFloat(aie::vector<float, N> x) {
+  const aie::vector<float, N> one = aie::broadcast<float, N>(1.0f);
+  x = aie::max(aie::min(x, aie::broadcast<float, N>(9.0f)),
+               aie::broadcast<float, N>(-9.0f));
+  aie::vector<float, N> e2x =
+      expFloat<N>(aie::mul(x, 2.0f).template to_vector<float>());
+  aie::vector<float, N> inv = invFloat<N>(aie::add(e2x, one));
+  return aie::sub(one, aie::mul(inv, 2.0f).template to_vector<float>());
+}
+
+// Approximate erf(x) = 1 - (A1 * t + ... + A5 * t^5) * exp(-x^2), for
+// t = 1 / (1 + P * |x|), by the formula 7.1.26 of Abramowitz and Stegun, with
+// an error below 1e-6 in float. erf is odd, the sign of x is restored at the
+// end.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+erfFloat(aie::vector<float, N> x) {
+  constexpr float P = 0.3275911;
+  constexpr float A1 = 0.254829592;
+  constexpr float A2 = -0.284496736;
+  constexpr float A3 = 1.421413741;
+  constexpr float A4 = -1.453152027;
+  constexpr float A5 = 1.061405429;
+  const aie::vector<float, N> one = aie::broadcast<float, N>(1.0f);
+  const aie::vector<float, N> zero = aie::zeros<float, N>();
+  aie::vector<float, N> abs_x = aie::max(x, aie::neg(x));
+  aie::vector<float, N> t = invFloat<N>(
+      aie::add(aie::mul(abs_x, P).template to_vector<float>(), one));
+
+  // A1 * t + ... + A5 * t^5, by Horner's rule
+  aie::vector<float, N> p = aie::broadcast<float, N>(A5);
+  for (float c : {A4, A3, A2, A1}) {
+    aie::vector<float, N> pt = aie::mul(p, t).template to_vector<float>();
+    p = aie::add(pt, aie::broadcast<float, N>(c));
+  }
+  p = aie::mul(p, t).template to_vector<float>();
+
+  aie::vector<float, N> minus_x2 =
+      aie::neg(aie::mul_square(abs_x).template to_vector<float>());
+  aie::vector<float, N> e = expFloat<N>(minus_x2);
+  aie::vector<float, N> res =
+      aie::sub(one, aie::mul(p, e).template to_vector<float>());
+  return aie::select(res, aie::neg(res), aie::lt(x, zero));
+}
+
+// Reduces x to r in [-pi, pi] such that x = r + 2 * pi * k for the nearest
+// integer k, for |x| < 2^17. 2 * pi is split into C1 + C2, with C1 exact in
+// few bits, so that the product by k does not lose the bits of r.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+reduceToPiFloat(aie::vector<float, N> x) {
+  constexpr float inv_two_pi = 0.15915494309189535;
+  constexpr float minus_c1 = -6.28125;
+  constexpr float minus_c2 = -0.0019353071795864769;
+  constexpr float one = 1.0;
+  // adding and subtracting 1.5 * 2^23 rounds |y| < 2^22 to an integer
+  const aie::vector<float, N> magic = aie::broadcast<float, N>(12582912.0f);
+  aie::vector<float, N> y = aie::mul(x, inv_two_pi).template to_vector<float>();
+  aie::vector<float, N> k = aie::sub(aie::add(y, magic), magic);
+
+  aie::accum<accfloat, N> acc = aie::mul(x, one);
+  acc = aie::mac(acc, k, minus_c1);
+  acc = aie::mac(acc, k, minus_c2);
+  return acc.template to_vector<float>();
+}
+
+// Approximate sin(x) by a least squares polynomial of degree 9 of the
+// reduction of x to [-pi, pi]
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+sinFloat(aie::vector<float, N> x) {
+  constexpr float S1 = 0.9999845571927732;
+  constexpr float S3 = -0.16663253010829876;
+  constexpr float S5 = 0.008312359261359497;
+  constexpr float S7 = -0.00019315793966923615;
+  constexpr float S9 = 2.1730025138638405e-06;
+  aie::vector<float, N> r = reduceToPiFloat<N>(x);
+  aie::vector<float, N> r2 = aie::mul_square(r).template to_vector<float>();
+  aie::vector<float, N> r3 = aie::mul(r2, r).template to_vector<float>();
+  aie::vector<float, N> r5 = aie::mul(r3, r2).template to_vector<float>();
+  aie::vector<float, N> r7 = aie::mul(r5, r2).template to_vector<float>();
+  aie::vector<float, N> r9 = aie::mul(r7, r2).template to_vector<float>();
+
+  // accumulate Si * r^i
+  aie::accum<accfloat, N> acc = aie::mul(r, S1);
+  acc = aie::mac(acc, r3, S3);
+  acc = aie::mac(acc, r5, S5);
+  acc = aie::mac(acc, r7, S7);
+  acc = aie::mac(acc, r9, S9);
+  return acc.template to_vector<float>();
+}
+
+// Approximate cos(x) by a least squares polynomial of degree 8 of the
+// reduction of x to [-pi, pi]
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<float, N>
+cosFloat(aie::vector<float, N> x) {
+  constexpr float C2 = -0.4998372938876355;
+  constexpr float C4 = 0.04152210555857572;
+  constexpr float C6 = -0.001344066550237685;
+  constexpr float C8 = 1.906273630821969e-05;
+  const aie::vector<float, N> C0 =
+      aie::broadcast<float, N>(0.9999710254217805f);
+  aie::vector<float, N> r = reduceToPiFloat<N>(x);
+  aie::vector<float, N> r2 = aie::mul_square(r).template to_vector<float>();
+  aie::vector<float, N> r4 = aie::mul_square(r2).template to_vector<float>();
+  aie::vector<float, N> r6 = aie::mul(r4, r2).template to_vector<float>();
+  aie::vector<float, N> r8 = aie::mul_square(r4).template to_vector<float>();
+
+  // accumulate Ci * r^i
+  aie::accum<accfloat, N> acc = aie::mul(r2, C2);
+  acc = aie::mac(acc, r4, C4);
+  acc = aie::mac(acc, r6, C6);
+  acc = aie::mac(acc, r8, C8);
+  return aie::add(acc.template to_vector<float>(), C0);
+}
+
+inline __attribute__((always_inline)) v16float getRsqrtFloat(v16float in) {
+  aie::vector<float, 16> out = rsqrtFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getRsqrtFloat(v8float in) {
+  aie::vector<float, 8> out = rsqrtFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getSqrtFloat(v16float in) {
+  aie::vector<float, 16> out = sqrtFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getSqrtFloat(v8float in) {
+  aie::vector<float, 8> out = sqrtFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getInvFloat(v16float in) {
+  aie::vector<float, 16> out = invFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getInvFloat(v8float in) {
+  aie::vector<float, 8> out = invFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getExpFloat(v16float in) {
+  aie::vector<float, 16> out = expFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getExpFloat(v8float in) {
+  aie::vector<float, 8> out = expFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getTanhFloat(v16float in) {
+  aie::vector<float, 16> out = tanhFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getTanhFloat(v8float in) {
+  aie::vector<float, 8> out = tanhFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getErfFloat(v16float in) {
+  aie::vector<float, 16> out = erfFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getErfFloat(v8float in) {
+  aie::vector<float, 8> out = erfFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getSinFloat(v16float in) {
+  aie::vector<float, 16> out = sinFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getSinFloat(v8float in) {
+  aie::vector<float, 8> out = sinFloat<8>(in);
+  return (v8float)out;
+}
+
+inline __attribute__((always_inline)) v16float getCosFloat(v16float in) {
+  aie::vector<float, 16> out = cosFloat<16>(in);
+  return (v16float)out;
+}
+
+inline __attribute__((always_inline)) v8float getCosFloat(v8float in) {
+  aie::vector<float, 8> out = cosFloat<8>(in);
+  return (v8float)out;
+}
+
+#endif // VEC_MATH_H
@@ -1,6 +1,17 @@
 #include <adf/wrapper/wrapper.h>
 #include <xtlm.h>
 #define BUSWIDTH 128
+// An AXI burst is at most 256 beats of 16 bytes and must not cross a 4KB
+// boundary
+#define AXI_MAX_BURST_BYTES 4096
+// The bursts of a transfer of the global memory in flight at once
+#define MAX_OUTSTANDING_BURSTS 16
+// The largest debug transaction of a backdoor transfer
+#define BACKDOOR_CHUNK_BYTES (1 << 20)
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 extern int main(int argc, char *argv[]);
 
@@ -40,12 +51,22 @@ public:
                          unsigned char *pData,
                          unsigned int trans_size_in_bytes);
   sc_event_queue toggle_AIE_array_clk;
+  // Set by MLIR_AIE_SIM_BACKDOOR_GM, the global memory is read and written
+  // straight through the memory model of the DDR, in no simulated time
+  bool backdoorGM;
 
 private:
   PSIP_ps_i3(sc_module_name nm);
   static PSIP_ps_i3 *psObj;
   // Sets attributes for PS-ME, common to both R/W transaction
   void set_payload_attr(xtlm::aximm_payload *trans, size_t transBytes);
+  void transferGM(xtlm::xtlm_command command, uint64_t addr,
+                  unsigned char *data, uint64_t size);
+  uint64_t backdoor_transfer(xtlm::xtlm_command command, uint64_t addr,
+                             unsigned char *data, uint64_t size);
+  void send_burst(xtlm::xtlm_command command, unsigned long long address,
+                  unsigned char *pData, unsigned int trans_size_in_bytes);
+  void wait_burst(xtlm::xtlm_command command);
   void main_action();
   void response_process();
   sc_event transRspAvail;
@@ -126,51 +147,80 @@ void PSIP_ps_i3::read128(uint64_t Addr, uint32_t *Data) {
 }
 void PSIP_ps_i3::writeGM(uint64_t addr, const void *data, uint64_t size) {
   toggle_AIE_array_clk.notify(1, SC_NS);
-  uint64_t remaining = size;
-  uint64_t currentAddr = addr;
-  unsigned char *currentDataPtr = (unsigned char *)data;
-  while (remaining >= 4096) // Axi maximum transaction size is 4096 byte
-  {
-    aximm_transaction(*PS_AxiMM_Rd_Util, *PS_AxiMM_Wr_Util,
-                      xtlm::XTLM_WRITE_COMMAND, currentAddr, currentDataPtr,
-                      4096);
-    currentAddr += 4096;
-    currentDataPtr += 4096;
-    remaining -= 4096;
-  }
-  if (remaining > 0)
-    aximm_transaction(*PS_AxiMM_Rd_Util, *PS_AxiMM_Wr_Util,
-                      xtlm::XTLM_WRITE_COMMAND, currentAddr, currentDataPtr,
-                      remaining);
+  transferGM(xtlm::XTLM_WRITE_COMMAND, addr, (unsigned char *)data, size);
   toggle_AIE_array_clk.notify(SC_ZERO_TIME);
 }
 
 void PSIP_ps_i3::readGM(uint64_t addr, void *data, uint64_t size) {
   toggle_AIE_array_clk.notify(1, SC_NS);
-  uint64_t remaining = size;
-  uint64_t currentAddr = addr;
-  unsigned char *currentDataPtr = (unsigned char *)data;
-  while (remaining >= 4096) // Axi maximum transaction size is 4096 byte
-  {
-    aximm_transaction(*PS_AxiMM_Rd_Util, *PS_AxiMM_Wr_Util,
-                      xtlm::XTLM_READ_COMMAND, currentAddr, currentDataPtr,
-                      4096);
-    currentAddr += 4096;
-    currentDataPtr += 4096;
-    remaining -= 4096;
-  }
-  if (remaining > 0)
-    aximm_transaction(*PS_AxiMM_Rd_Util, *PS_AxiMM_Wr_Util,
-                      xtlm::XTLM_READ_COMMAND, currentAddr, currentDataPtr,
-                      remaining);
+  transferGM(xtlm::XTLM_READ_COMMAND, addr, (unsigned char *)data, size);
   toggle_AIE_array_clk.notify(SC_ZERO_TIME);
 }
 
-void PSIP_ps_i3::aximm_transaction(
-    xtlm::xtlm_aximm_initiator_rd_socket_util &rd_util,
-    xtlm::xtlm_aximm_initiator_wr_socket_util &wr_util,
-    xtlm::xtlm_command command, unsigned long long address,
-    unsigned char *pData, unsigned int trans_size_in_bytes) {
+// The bursts of a transfer are sent back to back, up to
+// MAX_OUTSTANDING_BURSTS of them before waiting for the oldest response, so
+// that a large transfer does not wait for the latency of every burst.
+void PSIP_ps_i3::transferGM(xtlm::xtlm_command command, uint64_t addr,
+                            unsigned char *data, uint64_t size) {
+  if (backdoorGM) {
+    uint64_t done = backdoor_transfer(command, addr, data, size);
+    addr += done;
+    data += done;
+    size -= done;
+  }
+  unsigned outstanding = 0;
+  while (size > 0) {
+    uint64_t burstBytes = std::min<uint64_t>(
+        size, AXI_MAX_BURST_BYTES - addr % AXI_MAX_BURST_BYTES);
+    send_burst(command, addr, data, burstBytes);
+    if (++outstanding == MAX_OUTSTANDING_BURSTS) {
+      wait_burst(command);
+      outstanding--;
+    }
+    addr += burstBytes;
+    data += burstBytes;
+    size -= burstBytes;
+  }
+  for (; outstanding > 0; outstanding--)
+    wait_burst(command);
+}
+
+// Copies the data by debug transactions, which the memory model serves
+// without simulating the NoC. Returns the number of bytes copied: if the
+// memory model does not serve them, the backdoor is turned off and the rest
+// is left to the bursts.
+uint64_t PSIP_ps_i3::backdoor_transfer(xtlm::xtlm_command command,
+                                       uint64_t addr, unsigned char *data,
+                                       uint64_t size) {
+  uint64_t done = 0;
+  while (done < size) {
+    unsigned int chunkBytes =
+        std::min<uint64_t>(size - done, BACKDOOR_CHUNK_BYTES);
+    xtlm::aximm_payload *payload = mem_manager->get_payload();
+    payload->acquire();
+    payload->set_command(command);
+    payload->set_address(addr + done);
+    payload->set_data_ptr(data + done, chunkBytes);
+    unsigned int copied = command == xtlm::XTLM_READ_COMMAND
+                              ? PS_AxiMM_Rd.transport_dbg(*payload)
+                              : PS_AxiMM_Wr.transport_dbg(*payload);
+    payload->release();
+    if (copied != chunkBytes) {
+      std::cout << "IP-INFO: [" << basename()
+                << "] backdoor to the global memory not supported, "
+                   "using AXI bursts."
+                << std::endl;
+      backdoorGM = false;
+      break;
+    }
+    done += chunkBytes;
+  }
+  return done;
+}
+
+void PSIP_ps_i3::send_burst(xtlm::xtlm_command command,
+                            unsigned long long address, unsigned char *pData,
+                            unsigned int trans_size_in_bytes) {
   unsigned int trans_size_in_multiple_of_16bytes =
       (trans_size_in_bytes + 15) / 16;
   xtlm::aximm_payload *payload = mem_manager->get_payload();
@@ -181,32 +231,58 @@ void PSIP_ps_i3::aximm_transaction(
   payload->set_data_ptr(pData,
                         trans_size_in_bytes); // caller manages data memory
   payload->set_address(address);              // DDR address
+  payload->set_axi_id(0); // same ID, the responses come back in order
   payload->set_burst_type(
       1); // 1:INCR to allow burst length to reach maximum 256
   payload->set_burst_length(
       trans_size_in_multiple_of_16bytes); // burst length, maximum 256
   payload->set_burst_size(16); // 128-bit (16-byte) burst size (buswidth)
   if (command == xtlm::XTLM_READ_COMMAND) {
-    if (!rd_util.is_slave_ready())
-      wait(rd_util.transaction_sampled);
-    rd_util.send_transaction(*payload, time_delay);
-
-    wait(rd_util.data_available);
-    payload = rd_util.get_data();
+    if (!PS_AxiMM_Rd_Util->is_slave_ready())
+      wait(PS_AxiMM_Rd_Util->transaction_sampled);
+    PS_AxiMM_Rd_Util->send_transaction(*payload, time_delay);
   } else if (command == xtlm::XTLM_WRITE_COMMAND) {
-    if (!wr_util.is_slave_ready())
-      wait(wr_util.transaction_sampled);
-    wr_util.send_transaction(*payload, time_delay);
+    if (!PS_AxiMM_Wr_Util->is_slave_ready())
+      wait(PS_AxiMM_Wr_Util->transaction_sampled);
+    PS_AxiMM_Wr_Util->send_transaction(*payload, time_delay);
+  }
+}
 
-    wait(wr_util.resp_available);
-    payload = wr_util.get_resp();
+// Waits for the data of the oldest read burst or the response of the oldest
+// write burst and releases its payload
+void PSIP_ps_i3::wait_burst(xtlm::xtlm_command command) {
+  xtlm::aximm_payload *payload = nullptr;
+  if (command == xtlm::XTLM_READ_COMMAND) {
+    if (!PS_AxiMM_Rd_Util->is_data_available())
+      wait(PS_AxiMM_Rd_Util->data_available);
+    payload = PS_AxiMM_Rd_Util->get_data();
+  } else if (command == xtlm::XTLM_WRITE_COMMAND) {
+    if (!PS_AxiMM_Wr_Util->is_resp_available())
+      wait(PS_AxiMM_Wr_Util->resp_available);
+    payload = PS_AxiMM_Wr_Util->get_resp();
   }
+  if (payload)
+    payload->release();
+}
+
+void PSIP_ps_i3::aximm_transaction(
+    xtlm::xtlm_aximm_initiator_rd_socket_util &rd_util,
+    xtlm::xtlm_aximm_initiator_wr_socket_util &wr_util,
+    xtlm::xtlm_command command, unsigned long long address,
+    unsigned char *pData, unsigned int trans_size_in_bytes) {
+  send_burst(command, address, pData, trans_size_in_bytes);
+  wait_burst(command);
 }
 
 PSIP_ps_i3::PSIP_ps_i3(sc_module_name nm)
     : IPBlock(nm), toggle_AIE_array_clk("toggle_AIE_clk"),
       PS_AxiMM_Rd("ps_axi_rd", BUSWIDTH), PS_AxiMM_Wr("ps_axi_wr", BUSWIDTH) {
   std::cout << "IP-INFO: [" << basename() << "] IP loaded." << std::endl;
+  const char *backdoorEnv = getenv("MLIR_AIE_SIM_BACKDOOR_GM");
+  backdoorGM = backdoorEnv && strcmp(backdoorEnv, "0") != 0;
+  if (backdoorGM)
+    std::cout << "IP-INFO: [" << basename()
+              << "] backdoor to the global memory enabled." << std::endl;
   PS_AxiMM_Rd_Util = new xtlm::xtlm_aximm_initiator_rd_socket_util(
       "PS_AxiMM_Util_rd_socket", xtlm::aximm::TRANSACTION, BUSWIDTH);
   PS_AxiMM_Wr_Util = new xtlm::xtlm_aximm_initiator_wr_socket_util(
@@ -27,3 +27,6 @@ extern "C" void llvm___aie2___release(unsigned id, unsigned val) {
 }
 extern "C" void llvm___aie___event0() { event0(); }
 extern "C" void llvm___aie___event1() { event1(); }
+extern "C" unsigned long long llvm___aie___get___cycles() {
+  return get_cycles();
+}
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+gen_lut_based_ops - generate the look up tables of lut_based_ops.h
+
+The tables are computed from their functions and rounded to bfloat16, in
+the layout the parallel lookups of AIE-ML read them: each table is stored
+twice, as _ab and _cd, and each 128-bit block of a table is stored twice in
+a row, so that the four values of a gather come from four different banks.
+
+Only the groups of tables given to --tables are generated, so that a kernel
+built with them only takes the data memory of the functions it calls:
+  exp   exp_ilut_*, exp_flut_*  getExpBf16, softmaxBf16
+  inv   m_inv_lut               getInvBf16 of a float, softmaxBf16
+  tanh  tanh_lut_*              getTanhBf16, getSigmoidBf16, getSiluBf16,
+                                getGeluBf16
+  log   log_elut_*              getLogBf16
+The precision of tanh is selectable with --tanh-segments: the number of
+linear segments over [-4, 4), 32 by default. The header given to --config
+passes it on to lut_based_ops.h, which includes it.
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+GROUPS = ["exp", "inv", "tanh", "log"]
+
+# The slopes and offsets of the default tanh segments over [-4, 0), tuned by
+# hand; the segments over [0, 4) are their mirror images.
+TANH_32_SEGMENTS = [
+    (0.0, -1.0),
+    (0.002838134765625, -0.98828125),
+    (0.005096435546875, -0.98046875),
+    (0.00750732421875, -0.97265625),
+    (0.0126953125, -0.95703125),
+    (0.021240234375, -0.93359375),
+    (0.035400390625, -0.8984375),
+    (0.056396484375, -0.8515625),
+    (0.091796875, -0.78125),
+    (0.1455078125, -0.6875),
+    (0.2294921875, -0.5625),
+    (0.34765625, -0.416015625),
+    (0.50390625, -0.259765625),
+    (0.69140625, -0.11962890625),
+    (0.8671875, -0.03076171875),
+    (1.0, 0.0),
+]
+
+HEADER = """\
+//===- lut_based_ops.cpp - lookup table based operations --------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file was generated by gen_lut_based_ops.py with
+//   {args}
+//===----------------------------------------------------------------------===//
+
+#include "aie_api/aie.hpp"
+"""
+
+
+def bf16_bits(x):
+    """The bits of x rounded to the nearest even bfloat16, as an int16."""
+    if math.isinf(x):
+        bits = 0x7F80 if x > 0 else 0xFF80
+    else:
+        (f32,) = struct.unpack("<I", struct.pack("<f", x))
+        bits = ((f32 + 0x7FFF + ((f32 >> 16) & 1)) >> 16) & 0xFFFF
+    return bits - 0x10000 if bits & 0x8000 else bits
+
+
+def bf16(x):
+    """x rounded to the nearest even bfloat16."""
+    bits = bf16_bits(x) & 0xFFFF
+    return struct.unpack("<f", struct.pack("<I", bits << 16))[0]
+
+
+def banked(values, block):
+    """Store each block of values twice in a row."""
+    out = []
+    for i in range(0, len(values), block):
+        out += values[i : i + block] * 2
+    return out
+
+
+def array(decl, values, per_line, fmt=str):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i : i + per_line]))
+    return decl + "[%d] = {\n" % len(values) + ",\n".join(lines) + "};\n"
+
+
+def int16_table(name, values):
+    decl = "alignas(aie::vector_decl_align) int16 " + name
+    return array(decl, banked(values, 8), 8)
+
+
+def signed8(i):
+    return i - 256 if i >= 128 else i
+
+
+def exp_tables():
+    # exp(x) = exp(i) * exp(f) for the integer part i and the fraction f of x
+    # in fixed point with 8 fractional bits, the signed byte i indexing ilut
+    # and the byte f flut. exp(i) saturates past exp(88), near the largest
+    # bfloat16.
+    ilut = [bf16_bits(math.exp(min(signed8(i), 88))) for i in range(256)]
+    flut = [bf16_bits(math.exp(f / 256)) for f in range(256)]
+    out = "\n// The tables of exp(i) and exp(f) for the integer part i and the\n"
+    out += "// fraction f of x, exp(x) = exp(i) * exp(f).\n"
+    for name, table in [("exp_ilut", ilut), ("exp_flut", flut)]:
+        for copy in ["ab", "cd"]:
+            out += int16_table(name + "_" + copy, table) + "\n"
+    return out
+
+
+def inv_tables():
+    # The mantissa of 1 / (1 + m / 128), in [0.5, 1), as the 7 bits of the
+    # mantissa of twice it.
+    inv = [0] + [round((2 / (1 + m / 128) - 1) * 128) for m in range(1, 128)]
+    out = "\n// The mantissas of the inverses of the 128 mantissas of a bfloat16.\n"
+    decl = "alignas(aie::vector_decl_align) unsigned char m_inv_lut"
+    return out + array(decl, inv, 12) + "\n"
+
+
+def tanh_fit(lo, hi, samples=1024):
+    """The least squares line of tanh over [lo, hi]."""
+    xs = [lo + (hi - lo) * (i + 0.5) / samples for i in range(samples)]
+    ys = [math.tanh(x) for x in xs]
+    mx, my = sum(xs) / samples, sum(ys) / samples
+    slope = sum((x - mx) * (y - my) for x, y in zip(xs, ys)) / sum(
+        (x - mx) ** 2 for x in xs
+    )
+    return slope, my - slope * mx
+
+
+def tanh_segments(segments):
+    if segments == 32:
+        negative = TANH_32_SEGMENTS
+    else:
+        # The outer segment saturates and the inner one is the identity,
+        # like the tuned segments.
+        width = 8 / segments
+        negative = [(0.0, -1.0)]
+        for k in range(1, segments // 2 - 1):
+            slope, offset = tanh_fit(-4 + k * width, -4 + (k + 1) * width)
+            negative.append((bf16(slope), bf16(offset)))
+        negative.append((1.0, 0.0))
+    return negative + [(s, -b) for s, b in reversed(negative)]
+
+
+def tanh_tables(segments):
+    values = []
+    for slope, offset in tanh_segments(segments):
+        values += [slope, offset]
+    values = banked(values, 4)
+    out = "\n// The slopes and offsets of tanh over %d segments of [-4, 4).\n" % (
+        segments
+    )
+    for copy in ["ab", "cd"]:
+        decl = "float chess_storage(% chess_alignof(v32int8)) tanh_lut_" + copy
+        out += array(decl, values, 2, repr) + "\n"
+    return out
+
+
+def log_tables():
+    # (e - 127) * ln(2) for each biased exponent e, -inf and +inf for the
+    # exponents of zero and infinity.
+    def log_exponent(e):
+        if e == 0:
+            return -math.inf
+        if e == 255:
+            return math.inf
+        return (e - 127) * math.log(2)
+
+    table = [bf16_bits(log_exponent(e)) for e in range(256)]
+    out = "\n// The tables of (e - 127) * ln(2) for each biased exponent e.\n"
+    for copy in ["ab", "cd"]:
+        out += int16_table("log_elut_" + copy, table) + "\n"
+    return out
+
+
+def generate(groups, segments, args):
+    out = HEADER.format(args=" ".join(args)).rstrip() + "\n"
+    if "exp" in groups:
+        out += exp_tables()
+    if "inv" in groups:
+        out += inv_tables()
+    if "tanh" in groups:
+        out += tanh_tables(segments)
+    if "log" in groups:
+        out += log_tables()
+    return out.rstrip() + "\n"
+
+
+def generate_config(segments):
+    return (
+        "// This file was generated by gen_lut_based_ops.py.\n"
+        "#ifndef __LUT_BASED_OPS_CONFIG_H__\n"
+        "#define __LUT_BASED_OPS_CONFIG_H__\n"
+        "#define AIE_TANH_LUT_SEGMENTS %d\n"
+        "#endif // __LUT_BASED_OPS_CONFIG_H__\n" % segments
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the look up tables of lut_based_ops.h",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog=__doc__,
+    )
+    parser.add_argument(
+        "--tables",
+        default=",".join(GROUPS),
+        help="comma separated groups of tables to generate (default: all)",
+    )
+    parser.add_argument(
+        "--tanh-segments",
+        type=int,
+        default=32,
+        help="number of segments of tanh over [-4, 4) (default: 32)",
+    )
+    parser.add_argument("-o", "--output", help="output file (default: stdout)")
+    parser.add_argument("--config", help="also write the header of the sizes")
+    args = parser.parse_args()
+
+    groups = [g for g in args.tables.split(",") if g]
+    for group in groups:
+        if group not in GROUPS:
+            parser.error("unknown group of tables '%s'" % group)
+    segments = args.tanh_segments
+    if segments < 8 or segments > 256 or segments & (segments - 1):
+        parser.error("--tanh-segments must be a power of two from 8 to 256")
+
+    options = ["--tables=" + ",".join(groups), "--tanh-segments=%d" % segments]
+    text = generate(groups, segments, options)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    if args.config:
+        with open(args.config, "w") as f:
+            f.write(generate_config(segments))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
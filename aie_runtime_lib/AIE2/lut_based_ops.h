@@ -16,11 +16,21 @@
 
 #include "aie_api/aie.hpp"
 
+// The sizes of the tables generated by gen_lut_based_ops.py with them.
+#if __has_include("lut_based_ops_config.h")
+#include "lut_based_ops_config.h"
+#endif
+#ifndef AIE_TANH_LUT_SEGMENTS
+#define AIE_TANH_LUT_SEGMENTS 32
+#endif
+
 alignas(aie::vector_decl_align) extern int16 exp_ilut_ab[512];
 alignas(aie::vector_decl_align) extern int16 exp_ilut_cd[512];
 alignas(aie::vector_decl_align) extern int16 exp_flut_ab[512];
 alignas(aie::vector_decl_align) extern int16 exp_flut_cd[512];
 alignas(aie::vector_decl_align) extern unsigned char m_inv_lut[128];
+alignas(aie::vector_decl_align) extern int16 log_elut_ab[512];
+alignas(aie::vector_decl_align) extern int16 log_elut_cd[512];
 
 __attribute__((always_inline)) v16accfloat getExpBf16(v16bfloat16 x) {
   bfloat16 __aie_dm_resource_a *ilut_ab =
@@ -87,10 +97,13 @@ inline __attribute__((always_inline)) v16bfloat16
 getTanhBf16(v16bfloat16 vInput) {
   aie::vector<bfloat16, 16> input = vInput;
 
-  int step_bits = -2;
-  int bias = 16;
+  // The segments split [-4, 4), 2^-step_bits of them per unit of x
+  int LUT_elems = AIE_TANH_LUT_SEGMENTS;
+  int step_bits = 0;
+  for (int n = LUT_elems; n > 8; n /= 2)
+    step_bits--;
+  int bias = LUT_elems / 2;
   int data_size = 16;
-  int LUT_elems = 32;
   int shift_offset = 0; // unused
 
   using lut_type = aie::lut<4, float, bfloat16>;
@@ -106,4 +119,124 @@ getTanhBf16(v16bfloat16 vInput) {
 
   return (v16bfloat16)output;
 }
+
+// log(x) = (e - 127) * ln(2) + log(m), where e is the biased exponent of x and
+// m in [1, 2) its mantissa. The first term is looked up in a table indexed by
+// e, the second one is approximated by a least squares polynomial of degree 4
+// of m - 1. x must be positive.
+__attribute__((always_inline)) v16bfloat16 getLogBf16(v16bfloat16 x) {
+  bfloat16 __aie_dm_resource_a *elut_ab =
+      (bfloat16 __aie_dm_resource_a *)log_elut_ab;
+  bfloat16 __aie_dm_resource_b *elut_cd =
+      (bfloat16 __aie_dm_resource_b *)log_elut_cd;
+
+  using lut_type = aie::lut<4, bfloat16, bfloat16>;
+  const int LUT_elems = 256;
+  const int step_e = 0;
+
+  lut_type lut_e(LUT_elems, elut_ab, elut_cd);
+  aie::parallel_lookup<uint16, lut_type, aie::lut_oor_policy::truncate>
+      lookup_e(lut_e, step_e);
+
+  constexpr bfloat16 L1 = 0.9971246526339587;
+  constexpr bfloat16 L2 = -0.47001027005668267;
+  constexpr bfloat16 L3 = 0.22432347726974444;
+  constexpr bfloat16 L4 = -0.058421974318655104;
+  constexpr bfloat16 one = 1.0;
+
+  aie::vector<bfloat16, 16> input = x;
+  aie::vector<int16, 16> bits = input.cast_to<int16>();
+  aie::vector<bfloat16, 16> e_val =
+      lookup_e.fetch(aie::downshift(bits, 7).cast_to<uint16>());
+
+  // the mantissa of x with the exponent of 1.0
+  aie::vector<int16, 16> m_bits =
+      aie::bit_or(aie::bit_and(bits, (int16)0x007f), (int16)0x3f80);
+  const aie::vector<bfloat16, 16> ones = aie::broadcast<bfloat16, 16>(1.0f);
+  aie::vector<bfloat16, 16> t = aie::sub(m_bits.cast_to<bfloat16>(), ones);
+  aie::vector<bfloat16, 16> t2 = aie::mul_square(t).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> t3 = aie::mul(t2, t).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> t4 = aie::mul_square(t2).to_vector<bfloat16>();
+
+  // accumulate Li * t^i and the log of the exponent
+  aie::accum<accfloat, 16> acc = aie::mul(t, L1);
+  acc = aie::mac(acc, t2, L2);
+  acc = aie::mac(acc, t3, L3);
+  acc = aie::mac(acc, t4, L4);
+  acc = aie::mac(acc, e_val, one);
+  aie::vector<bfloat16, 16> output = acc.to_vector<bfloat16>();
+  return (v16bfloat16)output;
+}
+
+// sigmoid(x) = 1 / (1 + exp(-x)) = 0.5 + 0.5 * tanh(0.5 * x), computed by the
+// tanh look up tables as AIE-ML has no vector division.
+inline __attribute__((always_inline)) v16bfloat16
+getSigmoidBf16(v16bfloat16 vInput) {
+  aie::vector<bfloat16, 16> x = vInput;
+  const aie::vector<bfloat16, 16> half = aie::broadcast<bfloat16, 16>(0.5f);
+  aie::vector<bfloat16, 16> halfX = aie::mul(x, half).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> t = getTanhBf16((v16bfloat16)halfX);
+  aie::vector<bfloat16, 16> halfT = aie::mul(t, half).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> output = aie::add(halfT, half);
+  return (v16bfloat16)output;
+}
+
+// silu(x) = x * sigmoid(x)
+inline __attribute__((always_inline)) v16bfloat16
+getSiluBf16(v16bfloat16 vInput) {
+  aie::vector<bfloat16, 16> x = vInput;
+  aie::vector<bfloat16, 16> s = getSigmoidBf16(vInput);
+  aie::vector<bfloat16, 16> output = aie::mul(x, s).to_vector<bfloat16>();
+  return (v16bfloat16)output;
+}
+
+// gelu(x) = 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))), the
+// tanh approximation of x * P(X <= x) for a normal X, computed as
+// x * (0.5 + 0.5 * tanh(u)) with u = x * (G0 + G2 * x^2).
+inline __attribute__((always_inline)) v16bfloat16
+getGeluBf16(v16bfloat16 vInput) {
+  constexpr bfloat16 G2 = 0.035677408136300125;
+  const aie::vector<bfloat16, 16> G0 =
+      aie::broadcast<bfloat16, 16>(0.7978845608028654f);
+  const aie::vector<bfloat16, 16> half = aie::broadcast<bfloat16, 16>(0.5f);
+  aie::vector<bfloat16, 16> x = vInput;
+  aie::vector<bfloat16, 16> x2 = aie::mul_square(x).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> p =
+      aie::add(aie::mul(x2, G2).to_vector<bfloat16>(), G0);
+  aie::vector<bfloat16, 16> u = aie::mul(x, p).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> t = getTanhBf16((v16bfloat16)u);
+  aie::vector<bfloat16, 16> halfT = aie::mul(t, half).to_vector<bfloat16>();
+  aie::vector<bfloat16, 16> output =
+      aie::mul(x, aie::add(halfT, half)).to_vector<bfloat16>();
+  return (v16bfloat16)output;
+}
+
+// softmax(x)_i = exp(x_i - max(x)) / sum_j(exp(x_j - max(x))) over the n
+// elements of in, a multiple of 16, stored to out. Subtracting the maximum
+// keeps the exponentials in the range of the look up tables and below 1, and
+// the division takes a single scalar inverse of the sum.
+inline void softmaxBf16(bfloat16 *in, bfloat16 *out, unsigned n) {
+  constexpr unsigned lanes = 16;
+  aie::vector<bfloat16, lanes> maxVec = aie::load_v<lanes>(in);
+  for (unsigned i = lanes; i < n; i += lanes)
+    maxVec = aie::max(maxVec, aie::load_v<lanes>(in + i));
+  bfloat16 maxVal = aie::reduce_max(maxVec);
+
+  // the exponentials are kept in out between the two passes
+  aie::accum<accfloat, lanes> sum = aie::zeros<accfloat, lanes>();
+  for (unsigned i = 0; i < n; i += lanes) {
+    aie::vector<bfloat16, lanes> x =
+        aie::sub(aie::load_v<lanes>(in + i), maxVal);
+    aie::accum<accfloat, lanes> e = getExpBf16((v16bfloat16)x);
+    aie::vector<bfloat16, lanes> eVec = e.to_vector<bfloat16>();
+    aie::store_v(out + i, eVec);
+    sum = aie::add(sum, eVec);
+  }
+  bfloat16 inv = getInvBf16(aie::reduce_add(sum.to_vector<float>()));
+
+  for (unsigned i = 0; i < n; i += lanes) {
+    aie::vector<bfloat16, lanes> eVec = aie::load_v<lanes>(out + i);
+    aie::store_v(out + i, aie::mul(eVec, inv).to_vector<bfloat16>());
+  }
+}
 #endif //__LUT_BASED_OPS_H__
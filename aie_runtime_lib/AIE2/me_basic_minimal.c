@@ -0,0 +1,41 @@
+//===- me_basic_minimal.c ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// The startup of the cores without static constructors, which aiecc.py links
+// instead of me_basic.o: _main_init sets up the stack as me_basic.o does, but
+// skips the walk of the constructor table and calls the core function
+// straight away, and stops the core when it returns without going through
+// exit().
+//
+//===----------------------------------------------------------------------===//
+
+extern "C" {
+
+int main(int argc, char *argv[]);
+
+int _main_init(int argc, char **argv) property(envelope);
+
+// clang-format off
+inline assembly void chess_envelope_open() {
+  asm_begin
+  .label __AIE_ARCH_MODEL_VERSION__20010000 global
+    MOVXM sp, #_sp_start_value_DM_stack // init SP
+  asm_end
+}
+// clang-format on
+
+int _main_init(int argc, char **argv) property(envelope) {
+  main(argc, argv);
+  done();
+  return 0;
+}
+
+void __cxa_finalize(void *) {}
+}
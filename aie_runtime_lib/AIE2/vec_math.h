@@ -145,4 +145,136 @@ inline __attribute__((always_inline)) v16bfloat16 getErfBf16(v16bfloat16 in) {
   return (v16bfloat16)vec_out;
 }
 
+// Reduces x to r in [-pi, pi] such that x = r + 2 * pi * k for an integer k,
+// for |x| < 400. 2 * pi is split into C1 + C2, with C1 exact in bfloat16, so
+// that the product by k does not lose the bits of r.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<bfloat16, N>
+reduceToPiBf16(aie::vector<bfloat16, N> x) {
+  constexpr bfloat16 inv_two_pi = 0.15915494309189535;
+  constexpr bfloat16 minus_c1 = -6.28125;
+  constexpr bfloat16 minus_c2 = -0.0019353071795864769;
+  constexpr bfloat16 one = 1.0;
+  // adding and subtracting 1.5 * 2^7 drops the fractional bits of |y| < 64
+  const aie::vector<bfloat16, N> magic = aie::broadcast<bfloat16, N>(192.0f);
+  aie::vector<bfloat16, N> y =
+      aie::mul(x, inv_two_pi).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> k = aie::sub(aie::add(y, magic), magic);
+
+  aie::accum<accfloat, N> acc = aie::mul(x, one);
+  acc = aie::mac(acc, k, minus_c1);
+  acc = aie::mac(acc, k, minus_c2);
+  aie::vector<bfloat16, N> r = acc.template to_vector<bfloat16>();
+
+  // depending on the rounding mode, k is the nearest integer or the one below
+  const aie::vector<bfloat16, N> pi = aie::broadcast<bfloat16, N>(3.14159265f);
+  const aie::vector<bfloat16, N> two_pi =
+      aie::broadcast<bfloat16, N>(6.28318531f);
+  aie::vector<bfloat16, N> r_minus_two_pi = aie::sub(r, two_pi);
+  return aie::select(r, r_minus_two_pi, aie::gt(r, pi));
+}
+
+// Approximate sin(x) by a least squares polynomial of degree 9 of the
+// reduction of x to [-pi, pi]
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<bfloat16, N>
+sinBf16(aie::vector<bfloat16, N> x) {
+  constexpr bfloat16 S1 = 0.9999845571927732;
+  constexpr bfloat16 S3 = -0.16663253010829876;
+  constexpr bfloat16 S5 = 0.008312359261359497;
+  constexpr bfloat16 S7 = -0.00019315793966923615;
+  constexpr bfloat16 S9 = 2.1730025138638405e-06;
+  aie::vector<bfloat16, N> r = reduceToPiBf16(x);
+  aie::vector<bfloat16, N> r2 =
+      aie::mul_square(r).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r3 = aie::mul(r2, r).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r5 = aie::mul(r3, r2).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r7 = aie::mul(r5, r2).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r9 = aie::mul(r7, r2).template to_vector<bfloat16>();
+
+  // accumulate Si * r^i
+  aie::accum<accfloat, N> acc = aie::mul(r, S1);
+  acc = aie::mac(acc, r3, S3);
+  acc = aie::mac(acc, r5, S5);
+  acc = aie::mac(acc, r7, S7);
+  acc = aie::mac(acc, r9, S9);
+  return acc.template to_vector<bfloat16>();
+}
+
+// Approximate cos(x) by a least squares polynomial of degree 8 of the
+// reduction of x to [-pi, pi]
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<bfloat16, N>
+cosBf16(aie::vector<bfloat16, N> x) {
+  constexpr bfloat16 C2 = -0.4998372938876355;
+  constexpr bfloat16 C4 = 0.04152210555857572;
+  constexpr bfloat16 C6 = -0.001344066550237685;
+  constexpr bfloat16 C8 = 1.906273630821969e-05;
+  const aie::vector<bfloat16, N> C0 =
+      aie::broadcast<bfloat16, N>(0.9999710254217805f);
+  aie::vector<bfloat16, N> r = reduceToPiBf16(x);
+  aie::vector<bfloat16, N> r2 =
+      aie::mul_square(r).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r4 =
+      aie::mul_square(r2).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r6 = aie::mul(r4, r2).template to_vector<bfloat16>();
+  aie::vector<bfloat16, N> r8 =
+      aie::mul_square(r4).template to_vector<bfloat16>();
+
+  // accumulate Ci * r^i
+  aie::accum<accfloat, N> acc = aie::mul(r2, C2);
+  acc = aie::mac(acc, r4, C4);
+  acc = aie::mac(acc, r6, C6);
+  acc = aie::mac(acc, r8, C8);
+  return aie::add(acc.template to_vector<bfloat16>(), C0);
+}
+
+inline __attribute__((always_inline)) v32bfloat16 getSinBf16(v32bfloat16 in) {
+  aie::vector<bfloat16, 32> out = sinBf16<32>(in);
+  return (v32bfloat16)out;
+}
+
+inline __attribute__((always_inline)) v16bfloat16 getSinBf16(v16bfloat16 in) {
+  aie::vector<bfloat16, 16> out = sinBf16<16>(in);
+  return (v16bfloat16)out;
+}
+
+inline __attribute__((always_inline)) v32bfloat16 getCosBf16(v32bfloat16 in) {
+  aie::vector<bfloat16, 32> out = cosBf16<32>(in);
+  return (v32bfloat16)out;
+}
+
+inline __attribute__((always_inline)) v16bfloat16 getCosBf16(v16bfloat16 in) {
+  aie::vector<bfloat16, 16> out = cosBf16<16>(in);
+  return (v16bfloat16)out;
+}
+
+// Approximate 1 / x like the inverse square root above: subtracting the bits
+// of x from the magic number 0x7ef3 gives a first estimate of 1 / x, refined
+// by two Newton-Raphson iterations y = y * (2 - x * y). The subtraction
+// modulo 2^16 keeps the sign of x. x must be finite and non-zero.
+template <unsigned N>
+inline __attribute__((always_inline)) aie::vector<bfloat16, N>
+invBf16(aie::vector<bfloat16, N> x) {
+  const aie::vector<int16, N> magic = aie::broadcast<int16, N>(0x7ef3);
+  const aie::vector<bfloat16, N> two = aie::broadcast<bfloat16, N>(2.0f);
+  aie::vector<bfloat16, N> y =
+      aie::sub(magic, x.template cast_to<int16>()).template cast_to<bfloat16>();
+  for (int i = 0; i < 2; i++) {
+    aie::vector<bfloat16, N> xy = aie::mul(x, y).template to_vector<bfloat16>();
+    y = aie::mul(y, aie::sub(two, xy)).template to_vector<bfloat16>();
+  }
+  return y;
+}
+
+inline __attribute__((always_inline)) v32bfloat16 getInvBf16(v32bfloat16 in) {
+  aie::vector<bfloat16, 32> out = invBf16<32>(in);
+  return (v32bfloat16)out;
+}
+
+inline __attribute__((always_inline)) v16bfloat16 getInvBf16(v16bfloat16 in) {
+  aie::vector<bfloat16, 16> out = invBf16<16>(in);
+  return (v16bfloat16)out;
+}
+
 #endif // VEC_MATH_H
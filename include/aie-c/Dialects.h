@@ -25,6 +25,13 @@ MLIR_DECLARE_CAPI_DIALECT_REGISTRATION(AIEX, aiex);
 MLIR_CAPI_EXPORTED bool aieTypeIsObjectFifoType(MlirType type);
 MLIR_CAPI_EXPORTED MlirType aieObjectFifoTypeGet(MlirType type);
 
+//===---------------------------------------------------------------------===//
+// ObjectFifoSubviewType
+//===---------------------------------------------------------------------===//
+
+MLIR_CAPI_EXPORTED bool aieTypeIsObjectFifoSubviewType(MlirType type);
+MLIR_CAPI_EXPORTED MlirType aieObjectFifoSubviewTypeGet(MlirType type);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,42 @@
+//===- Translation.h --------------------------------------------*- C++ -*-===//
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef AIE_C_TRANSLATION_H
+#define AIE_C_TRANSLATION_H
+
+#include "mlir-c/IR.h"
+#include "mlir-c/Support.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Translates a module lowered to the LLVM dialect to LLVM IR with typed
+ * pointers, like aie-translate --opaque-pointers=0 --mlir-to-llvmir, and
+ * passes the textual LLVM IR to the callback.
+ */
+MLIR_CAPI_EXPORTED MlirLogicalResult aieTranslateModuleToLLVMIR(
+    MlirOperation module, MlirStringCallback callback, void *userData);
+
+/** Generates the libxaie configuration code of a physical design, like
+ * aie-translate --aie-generate-xaie, and passes it to the callback.
+ */
+MLIR_CAPI_EXPORTED MlirLogicalResult aieTranslateToXAIEV2(
+    MlirOperation module, MlirStringCallback callback, void *userData);
+
+/** Estimates the steady state of the dataflow of the objectFifos of each
+ * device, like aie-translate --aie-estimate-performance, and passes the JSON
+ * report to the callback.
+ */
+MLIR_CAPI_EXPORTED MlirLogicalResult aieEstimatePerformance(
+    MlirOperation module, MlirStringCallback callback, void *userData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AIE_C_TRANSLATION_H
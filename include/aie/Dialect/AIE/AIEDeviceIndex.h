@@ -0,0 +1,88 @@
+//===- AIEDeviceIndex.h -----------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef MLIR_AIE_DEVICEINDEX_H
+#define MLIR_AIE_DEVICEINDEX_H
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/AnalysisManager.h"
+#include "llvm/ADT/DenseMap.h"
+
+#include <vector>
+
+namespace xilinx {
+namespace AIE {
+
+// The ops of a device by the tile they belong to, collected in one scan of
+// the device, so that passes look them up by coordinates instead of scanning
+// the device for each tile. It is an analysis of DeviceOp, cached by the
+// pass manager:
+//   const AIEDeviceIndex &index = getAnalysis<AIEDeviceIndex>();
+// Like any analysis, it is invalidated after a pass unless the pass calls
+// markAnalysesPreserved<AIEDeviceIndex>(), which a pass may only do if it has
+// not created, erased or moved the ops indexed, nor changed their tiles. A
+// pass creating such ops can add() them to keep using the index.
+class AIEDeviceIndex {
+public:
+  // The ops of one tile
+  struct TileOps {
+    TileOp tile;
+    CoreOp core;
+    MemOp mem;
+    MemTileDMAOp memTileDMA;
+    ShimDMAOp shimDMA;
+    SwitchboxOp switchbox;
+    ShimMuxOp shimMux;
+    // in the order of the device
+    SmallVector<BufferOp, 4> buffers;
+    SmallVector<LockOp, 4> locks;
+  };
+
+  explicit AIEDeviceIndex(Operation *op);
+
+  // The ops of the tile at coords, or nullptr if the device has no such tile
+  const TileOps *lookup(TileID coords) const;
+
+  TileOp getTile(TileID coords) const;
+  TileOp getTile(int col, int row) const { return getTile({col, row}); }
+  CoreOp getCore(TileID coords) const;
+  MemOp getMem(TileID coords) const;
+  SwitchboxOp getSwitchbox(TileID coords) const;
+  ShimMuxOp getShimMux(TileID coords) const;
+  ArrayRef<BufferOp> getBuffers(TileID coords) const;
+  ArrayRef<LockOp> getLocks(TileID coords) const;
+
+  // The coordinates of the tiles, in the order of their TileOps
+  ArrayRef<TileID> getTileIDs() const { return order; }
+
+  // Index op, a TileOp or an op of a tile, created after the index.
+  void add(Operation *op);
+
+private:
+  static constexpr unsigned NoSlot = ~0u;
+
+  // The slot in the grid of the tile at coords, or NoSlot outside the device
+  unsigned gridSlot(TileID coords) const;
+  TileOps &getOrCreate(TileID coords);
+
+  // The slots in tiles of the tiles of the device, column by column, and of
+  // the tiles outside it, which only invalid designs have.
+  int numCols = 0;
+  int numRows = 0;
+  SmallVector<unsigned, 0> grid;
+  llvm::DenseMap<TileID, unsigned> slots;
+  std::vector<TileOps> tiles;
+  SmallVector<TileID, 16> order;
+};
+
+} // namespace AIE
+} // namespace xilinx
+
+#endif
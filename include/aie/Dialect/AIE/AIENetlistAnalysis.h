@@ -11,6 +11,7 @@
 #ifndef MLIR_AIE_LOCKANALYSIS_H
 #define MLIR_AIE_LOCKANALYSIS_H
 
+#include "aie/Dialect/AIE/AIEDeviceIndex.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/Builders.h"
@@ -31,14 +32,15 @@ using namespace mlir;
 namespace xilinx {
 namespace AIE {
 
+// The netlist of a device. Its ops are indexed by tile when it is built; the
+// users of its buffers, its DMA channels and the buffers they move, and the
+// pairs of its locks are collected by runAnalysis() in one walk of the
+// device. It is an analysis of DeviceOp, cached by the pass manager:
+//   NetlistAnalysis &NL = getAnalysis<NetlistAnalysis>();
+// Translations writing several outputs build it once and share it.
 class NetlistAnalysis {
-  DeviceOp &device;
-  DenseMap<std::pair<int, int>, Operation *> &tiles;
-  DenseMap<Operation *, CoreOp> &cores;
-  DenseMap<Operation *, MemOp> &mems;
-  DenseMap<std::pair<Operation *, int>, LockOp> &locks;
-  DenseMap<Operation *, SmallVector<BufferOp, 4>> &buffers;
-  DenseMap<Operation *, SwitchboxOp> &switchboxes;
+  DeviceOp device;
+  AIEDeviceIndex index;
   DenseMap<Operation *, SmallVector<Operation *, 4>> bufferUsers;
   DenseMap<Operation *, SmallVector<Operation *, 4>> dma2BufMap;
   DenseMap<std::pair<Operation *, xilinx::AIE::DMAChannel>, Operation *> dmas;
@@ -48,47 +50,41 @@ class NetlistAnalysis {
   SmallVector<std::pair<Operation *, Operation *>, 4> lockChains;
   DenseMap<Operation *, SmallVector<Operation *, 4>> bufAcqLocks;
 
+  void collectDMAChannel(MemOp mem, DMAStartOp dmaStart);
+  void dmaAnalysis();
+  void lockAnalysis();
+
 public:
-  NetlistAnalysis(DeviceOp &d,
-                  DenseMap<std::pair<int, int>, Operation *> &tiles,
-                  DenseMap<Operation *, CoreOp> &cores,
-                  DenseMap<Operation *, MemOp> &mems,
-                  DenseMap<std::pair<Operation *, int>, LockOp> &locks,
-                  DenseMap<Operation *, SmallVector<BufferOp, 4>> &buffers,
-                  DenseMap<Operation *, SwitchboxOp> &switchboxes)
-      : device(d), tiles(tiles), cores(cores), mems(mems), locks(locks),
-        buffers(buffers), switchboxes(switchboxes) {}
+  explicit NetlistAnalysis(Operation *op)
+      : device(cast<DeviceOp>(op)), index(op) {}
 
   void runAnalysis();
 
-  void collectTiles(DenseMap<std::pair<int, int>, Operation *> &tiles);
-  void collectCores(DenseMap<Operation *, CoreOp> &cores);
-  void collectMems(DenseMap<Operation *, MemOp> &mems);
-  void collectLocks(DenseMap<std::pair<Operation *, int>, LockOp> &locks);
-  void collectBuffers(DenseMap<Operation *, SmallVector<BufferOp, 4>> &buffers);
-  void collectSwitchboxes(DenseMap<Operation *, SwitchboxOp> &switchboxes);
+  const AIEDeviceIndex &getIndex() const { return index; }
+  TileOp getTile(TileID coords) const { return index.getTile(coords); }
+  ArrayRef<BufferOp> getBuffers(TileID coords) const {
+    return index.getBuffers(coords);
+  }
 
-  auto getBufferUsers() const { return bufferUsers; }
+  const auto &getBufferUsers() const { return bufferUsers; }
 
-  auto getDMA2BufMap() const { return dma2BufMap; }
+  const auto &getDMA2BufMap() const { return dma2BufMap; }
 
-  auto getDMAs() const { return dmas; }
+  const auto &getDMAs() const { return dmas; }
 
-  auto getDMAConnections() const { return dmaConnections; }
+  const auto &getDMAConnections() const { return dmaConnections; }
 
-  auto getLockPairs() const { return lockPairs; }
+  const auto &getLockPairs() const { return lockPairs; }
 
-  auto getLockChains() const { return lockChains; }
+  const auto &getLockChains() const { return lockChains; }
 
-  auto getBufAcqLocks() const { return bufAcqLocks; }
+  const auto &getBufAcqLocks() const { return bufAcqLocks; }
 
-  auto getDma2ConnectsMap() const { return dma2ConnectsMap; }
+  const auto &getDma2ConnectsMap() const { return dma2ConnectsMap; }
 
   std::pair<int, int> getCoord(Operation *Op) const;
   bool isLegalAffinity(Operation *src, Operation *user) const;
   bool validateCoreOrMemRegion(Operation *CoreOrMemOp);
-  void collectBufferUsage();
-  void collectDMAUsage();
   uint64_t getMemUsageInBytes(Operation *tileOp) const;
   uint64_t getBufferBaseAddress(Operation *bufOp) const;
 
@@ -97,8 +93,6 @@ public:
                                                  WireBundle destBundle) const;
   SmallVector<Operation *, 4> findRoutes(Operation *sourceConnectOp,
                                          Operation *destConnectOp) const;
-  void dmaAnalysis();
-  void lockAnalysis();
 
   void print(raw_ostream &os);
 };
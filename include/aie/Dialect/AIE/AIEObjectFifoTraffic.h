@@ -0,0 +1,55 @@
+//===- AIEObjectFifoTraffic.h -----------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef MLIR_AIE_OBJECTFIFOTRAFFIC_H
+#define MLIR_AIE_OBJECTFIFOTRAFFIC_H
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "llvm/ADT/DenseMap.h"
+
+#include <algorithm>
+
+namespace xilinx {
+namespace AIE {
+
+// The traffic of the objectFifos of a device over a run of the design, as
+// predicted before aie-objectFifo-stateful-transform.  An objectFifo moves
+// the elements the core of one of its endpoints releases, times the trip
+// counts of the loops around the releases, or one iteration of the loops of
+// unknown trip counts.  An objectFifo no core accesses, such as one between
+// a shim tile and a memtile, moves the elements of the objectFifos it is
+// linked to.  It is an analysis of DeviceOp:
+//   const AIEObjectFifoTraffic &traffic = getAnalysis<AIEObjectFifoTraffic>();
+class AIEObjectFifoTraffic {
+public:
+  explicit AIEObjectFifoTraffic(Operation *op);
+
+  // The elements fifo moves over a run, or 0 if it is not known.
+  int64_t getElements(ObjectFifoCreateOp fifo) const {
+    return elements.lookup(fifo);
+  }
+
+  // The bytes of an element of fifo.
+  static int64_t getElementBytes(ObjectFifoCreateOp fifo);
+
+  // The bytes fifo moves over a run, assuming a single element if it is not
+  // known.
+  int64_t getBytes(ObjectFifoCreateOp fifo) const {
+    return getElementBytes(fifo) * std::max<int64_t>(getElements(fifo), 1);
+  }
+
+private:
+  llvm::DenseMap<Operation *, int64_t> elements;
+};
+
+} // namespace AIE
+} // namespace xilinx
+
+#endif
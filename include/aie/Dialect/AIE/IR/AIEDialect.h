@@ -168,6 +168,10 @@ struct AIEDevDesc {
 
 const xilinx::AIE::AIETargetModel &getTargetModel(Operation *op);
 
+// The attribute of the memref arguments of a function giving the data memory
+// bank of the buffers passed to them.
+constexpr llvm::StringLiteral bankAttrName = "AIE.bank";
+
 } // namespace AIE
 } // namespace xilinx
 
@@ -183,19 +187,37 @@ namespace AIE {
 
 std::unique_ptr<OperationPass<DeviceOp>> createAIEAssignBufferAddressesPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIEAssignLockIDsPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEAssignShimTilesPass();
 std::unique_ptr<OperationPass<ModuleOp>> createAIECanonicalizeDevicePass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIECheckDDRBandwidthPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIECoalesceLocksPass();
 std::unique_ptr<OperationPass<ModuleOp>> createAIECoreToStandardPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEEliminateDeadResourcesPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIEFindFlowsPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEInsertOverlayLoadsPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIELocalizeLocksPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIELowerStreamFifosPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIELowerRtpsPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIENormalizeAddressSpacesPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEPackDMABuffersPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEPlaceTilesPass();
 std::unique_ptr<OperationPass<ModuleOp>> createAIERouteFlowsPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIERoutePacketFlowsPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIERouteControlPacketsPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIERouteTracePass();
 std::unique_ptr<OperationPass<func::FuncOp>> createAIEVectorOptPass();
 std::unique_ptr<OperationPass<DeviceOp>> createAIEPathfinderPass();
 std::unique_ptr<OperationPass<DeviceOp>>
 createAIEObjectFifoStatefulTransformPass();
 std::unique_ptr<OperationPass<DeviceOp>>
 createAIEObjectFifoRegisterProcessPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEObjectFifoAnalysisPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEObjectFifoAutoDepthPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIEObjectFifoCopyElisionPass();
+std::unique_ptr<OperationPass<DeviceOp>>
+createAIEObjectFifoHoistAcquiresPass();
+std::unique_ptr<OperationPass<DeviceOp>> createAIETileKernelsPass();
+std::unique_ptr<OperationPass<ModuleOp>> createAIEProfileLoopsPass();
 
 /// Generate the code for registering passes.
 #define GEN_PASS_REGISTRATION
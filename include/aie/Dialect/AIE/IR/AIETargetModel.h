@@ -14,6 +14,9 @@
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <vector>
 
 #include "aie/Dialect/AIE/IR/AIEEnums.h"
 
@@ -22,60 +25,114 @@ namespace AIE {
 
 typedef std::pair<int, int> TileID;
 
+/// The geometry of a device: a row of shim tiles, then rows of memory tiles,
+/// then rows of core tiles.  The shim tiles in the given columns connect to
+/// the NOC, the others to the PL.  The NOC moves nocBytesPerCycle bytes per
+/// cycle between the DDR and all these shim tiles.
+struct AIEDeviceDescription {
+  int columns;
+  int rows;
+  uint32_t memTileRows;
+  llvm::SmallVector<unsigned, 16> nocColumns;
+  uint32_t nocBytesPerCycle;
+};
+
+/// A model of the resources of a device.  The queries of tiles are answered
+/// from flat tables, computed once per tile when the model is built from the
+/// description of the device and the rules of its architecture.  Queries of
+/// tiles outside the device fall back to those rules.
+///
+/// A model may also describe a partition of the device: numCols columns from
+/// startCol, numbered from 0.  The edges of the partition are the edges of the
+/// model, so nothing is routed or placed outside of it.
 class AIETargetModel {
 public:
-  AIETargetModel() {}
+  AIETargetModel(const AIEDeviceDescription &desc, int startCol = 0,
+                 int numCols = -1);
   virtual ~AIETargetModel();
 
   /// Return the target architecture.
   virtual AIEArch getTargetArch() const = 0;
 
-  /// Return the number of columns in the device.
-  virtual int columns() const = 0;
+  /// Return the number of columns in the device, or in the partition.
+  int columns() const { return numColumns; }
+
+  /// Return the column of the device the columns of the model start at.
+  int getPartitionStartCol() const { return partitionStartCol; }
+
+  /// Return the number of columns of the whole device.
+  int getDeviceColumns() const { return deviceColumns; }
 
   /// Return the number of rows in the device.
-  virtual int rows() const = 0;
+  int rows() const { return numRows; }
 
   /// Return true if the given tile is a 'Core' tile.  These tiles
   /// include a Core, TileDMA, tile memory, and stream connections.
-  virtual bool isCoreTile(int col, int row) const = 0;
+  bool isCoreTile(int col, int row) const {
+    return getTileKind(col, row) == TileKind::Core;
+  }
 
   /// Return true if the given tile is an AIE2 'Memory' tile.  These tiles
   /// include a TileDMA, tile memory, and stream connections, but no core.
-  virtual bool isMemTile(int col, int row) const = 0;
+  bool isMemTile(int col, int row) const {
+    return getTileKind(col, row) == TileKind::Mem;
+  }
 
   /// Return true if the given tile is a Shim NOC tile.  These tiles include a
   /// ShimDMA and a connection to the memory-mapped NOC.  They do not contain
   /// any memory.
-  virtual bool isShimNOCTile(int col, int row) const = 0;
+  bool isShimNOCTile(int col, int row) const {
+    return getTileKind(col, row) == TileKind::ShimNOC;
+  }
 
   /// Return true if the given tile is a Shim PL interface tile.  These tiles do
   /// not include a ShimDMA and instead include connections to the PL.  They do
   /// not contain any memory.
-  virtual bool isShimPLTile(int col, int row) const = 0;
+  bool isShimPLTile(int col, int row) const {
+    return getTileKind(col, row) == TileKind::ShimPL;
+  }
 
   /// Return true if the given tile is either a Shim NOC or a Shim PL interface
   /// tile.
-  virtual bool isShimNOCorPLTile(int col, int row) const = 0;
+  bool isShimNOCorPLTile(int col, int row) const {
+    TileKind kind = getTileKind(col, row);
+    return kind == TileKind::ShimNOC || kind == TileKind::ShimPL;
+  }
 
   /// Return true if the given tile ID is valid.
-  virtual bool isValidTile(TileID src) const {
+  bool isValidTile(TileID src) const {
     return (src.first >= 0) && (src.first < columns()) && (src.second >= 0) &&
            (src.second < rows());
   }
 
   /// Return the tile ID of the memory to the west of the given tile, if it
   /// exists.
-  virtual llvm::Optional<TileID> getMemWest(TileID src) const = 0;
+  llvm::Optional<TileID> getMemWest(TileID src) const {
+    if (const TileInfo *info = lookup(src.first, src.second))
+      return info->mems[West];
+    return computeMemWest(src);
+  }
   /// Return the tile ID of the memory to the east of the given tile, if it
   /// exists.
-  virtual llvm::Optional<TileID> getMemEast(TileID src) const = 0;
+  llvm::Optional<TileID> getMemEast(TileID src) const {
+    if (const TileInfo *info = lookup(src.first, src.second))
+      return info->mems[East];
+    return computeMemEast(src);
+  }
   /// Return the tile ID of the memory to the north of the given tile, if it
   /// exists.
-  virtual llvm::Optional<TileID> getMemNorth(TileID src) const = 0;
+  llvm::Optional<TileID> getMemNorth(TileID src) const {
+    if (const TileInfo *info = lookup(src.first, src.second))
+      return info->mems[North];
+    return computeMemNorth(src);
+  }
   /// Return the tile ID of the memory to the south of the given tile, if it
   /// exists.
-  virtual llvm::Optional<TileID> getMemSouth(TileID src) const = 0;
+  llvm::Optional<TileID> getMemSouth(TileID src) const {
+    if (const TileInfo *info = lookup(src.first, src.second))
+      return info->mems[South];
+    return computeMemSouth(src);
+  }
 
   /// Return true if src is the internal memory of dst
   bool isInternal(int srcCol, int srcRow, int dstCol, int dstRow) const {
@@ -112,8 +169,20 @@ public:
                           int dstRow) const = 0;
 
   /// Return true if core can access the memory in mem
-  virtual bool isLegalMemAffinity(int coreCol, int coreRow, int memCol,
-                                  int memRow) const = 0;
+  bool isLegalMemAffinity(int coreCol, int coreRow, int memCol,
+                          int memRow) const {
+    const TileInfo *info = lookup(coreCol, coreRow);
+    if (!info)
+      return computeLegalMemAffinity(coreCol, coreRow, memCol, memRow);
+    int dCol = memCol - coreCol, dRow = memRow - coreRow;
+    if (dCol < -1 || dCol > 1 || dRow < -1 || dRow > 1)
+      return false;
+    return info->memAffinity & (1 << ((dCol + 1) * 3 + dRow + 1));
+  }
+
+  /// Return true if the core of src can send its accumulator to the core of
+  /// dst over the cascade stream.
+  virtual bool isLegalCascade(TileID src, TileID dst) const = 0;
 
   /// Return the base address in the local address map of differnet memories.
   virtual uint32_t getMemInternalBaseAddress(TileID src) const = 0;
@@ -125,6 +194,9 @@ public:
   /// Return the size (in bytes) of the local data memory of a core.
   virtual uint32_t getLocalMemorySize() const = 0;
 
+  /// Return the size (in bytes) of the program memory of a core.
+  virtual uint32_t getProgramMemorySize() const = 0;
+
   /// Return the number of lock objects
   virtual uint32_t getNumLocks(int col, int row) const = 0;
 
@@ -132,54 +204,158 @@ public:
   /// tile.
   virtual uint32_t getNumBDs(int col, int row) const = 0;
 
-  virtual uint32_t getNumMemTileRows() const = 0;
+  /// Return the largest transfer length (in 32-bit words) of a single buffer
+  /// descriptor of the DMA in the given tile.
+  virtual uint32_t getMaxBDLength(int col, int row) const = 0;
+
+  uint32_t getNumMemTileRows() const { return numMemTileRows; }
   /// Return the size (in bytes) of a MemTile.
   virtual uint32_t getMemTileSize() const = 0;
+  /// Return the number of equally sized banks the data memory of the given
+  /// tile is made of.  Accesses to different banks can happen in the same
+  /// cycle.
+  virtual uint32_t getNumBanks(int col, int row) const = 0;
+
+  /// The bandwidths and latencies of the device, in cycles of the AIE clock,
+  /// for the passes and estimates that weigh the performance of a design.
+  /// They are calibrated with the benchmarks of test/benchmarks.
+
+  /// Return the bytes a stream of the stream switches moves per cycle.
+  virtual uint32_t getStreamBytesPerCycle() const = 0;
+  /// Return the bytes per cycle a DMA channel of the given tile moves between
+  /// its memory and a stream.
+  virtual uint32_t getDmaBytesPerCycle(int col, int row) const = 0;
+  /// Return the cycles a DMA channel of the given tile takes between two
+  /// buffer descriptors, to acquire the lock of the next one and load it.
+  virtual uint32_t getDmaSetupCycles(int col, int row) const = 0;
+  /// Return the bytes per cycle the shim DMAs of a column move from DDR, or
+  /// to DDR, shared by their channels.
+  virtual uint32_t getShimBytesPerCycle() const = 0;
+  /// Return the bytes per cycle the NOC moves between the DDR and all the
+  /// shim tiles of the device, shared with the other partitions.
+  uint32_t getNocBytesPerCycle() const { return nocBytesPerCycle; }
+  /// Return the cycles a core takes to acquire or to release a lock.
+  virtual uint32_t getLockCycles() const = 0;
+  /// Return the cycles a stream takes to cross a switchbox.
+  virtual uint32_t getSwitchHopCycles() const = 0;
+
   /// Return the number of destinations of connections inside a switchbox. These
   /// are the targets of connect operations in the switchbox.
-  virtual uint32_t getNumDestSwitchboxConnections(int col, int row,
-                                                  WireBundle bundle) const = 0;
+  uint32_t getNumDestSwitchboxConnections(int col, int row,
+                                          WireBundle bundle) const {
+    if (const TileInfo *info = lookup(col, row))
+      return info->destSwitchbox[static_cast<unsigned>(bundle)];
+    return computeNumDestSwitchboxConnections(col, row, bundle);
+  }
   /// Return the number of sources of connections inside a switchbox.  These are
   /// the origins of connect operations in the switchbox.
-  virtual uint32_t
-  getNumSourceSwitchboxConnections(int col, int row,
-                                   WireBundle bundle) const = 0;
+  uint32_t getNumSourceSwitchboxConnections(int col, int row,
+                                            WireBundle bundle) const {
+    if (const TileInfo *info = lookup(col, row))
+      return info->sourceSwitchbox[static_cast<unsigned>(bundle)];
+    return computeNumSourceSwitchboxConnections(col, row, bundle);
+  }
   /// Return the number of destinations of connections inside a shimmux.  These
   /// are the targets of connect operations in the switchbox.
-  virtual uint32_t getNumDestShimMuxConnections(int col, int row,
-                                                WireBundle bundle) const = 0;
+  uint32_t getNumDestShimMuxConnections(int col, int row,
+                                        WireBundle bundle) const {
+    if (const TileInfo *info = lookup(col, row))
+      return info->destShimMux[static_cast<unsigned>(bundle)];
+    return computeNumDestShimMuxConnections(col, row, bundle);
+  }
   /// Return the number of sources of connections inside a shimmux.  These are
   /// the origins of connect operations in the switchbox.
-  virtual uint32_t getNumSourceShimMuxConnections(int col, int row,
-                                                  WireBundle bundle) const = 0;
+  uint32_t getNumSourceShimMuxConnections(int col, int row,
+                                          WireBundle bundle) const {
+    if (const TileInfo *info = lookup(col, row))
+      return info->sourceShimMux[static_cast<unsigned>(bundle)];
+    return computeNumSourceShimMuxConnections(col, row, bundle);
+  }
 
   // Run consistency checks on the target model.
   void validate() const;
+
+protected:
+  /// The rules of the architecture, evaluated once per tile by buildTables().
+  virtual llvm::Optional<TileID> computeMemWest(TileID src) const = 0;
+  virtual llvm::Optional<TileID> computeMemEast(TileID src) const = 0;
+  virtual llvm::Optional<TileID> computeMemNorth(TileID src) const = 0;
+  virtual llvm::Optional<TileID> computeMemSouth(TileID src) const = 0;
+  virtual bool computeLegalMemAffinity(int coreCol, int coreRow, int memCol,
+                                       int memRow) const = 0;
+  virtual uint32_t
+  computeNumDestSwitchboxConnections(int col, int row,
+                                     WireBundle bundle) const = 0;
+  virtual uint32_t
+  computeNumSourceSwitchboxConnections(int col, int row,
+                                       WireBundle bundle) const = 0;
+  virtual uint32_t
+  computeNumDestShimMuxConnections(int col, int row,
+                                   WireBundle bundle) const = 0;
+  virtual uint32_t
+  computeNumSourceShimMuxConnections(int col, int row,
+                                     WireBundle bundle) const = 0;
+
+  /// Fill the tables of the tiles of the device.  The virtual functions above
+  /// are only dispatched to the architecture once constructed, so this is
+  /// called from the constructor of the class that implements them.
+  void buildTables();
+
+private:
+  enum class TileKind : uint8_t { None, ShimNOC, ShimPL, Mem, Core };
+  enum Direction { West, East, North, South };
+  static constexpr unsigned NumBundles = getMaxEnumValForWireBundle() + 1;
+
+  struct TileInfo {
+    TileKind kind;
+    uint8_t destSwitchbox[NumBundles];
+    uint8_t sourceSwitchbox[NumBundles];
+    uint8_t destShimMux[NumBundles];
+    uint8_t sourceShimMux[NumBundles];
+    llvm::Optional<TileID> mems[4];
+    // Bit (dCol + 1) * 3 + dRow + 1 is set if the tile can access the memory
+    // of the tile at offset (dCol, dRow).
+    uint16_t memAffinity;
+  };
+
+  const TileInfo *lookup(int col, int row) const {
+    if (!isValidTile({col, row}))
+      return nullptr;
+    return &tiles[col * numRows + row];
+  }
+  TileKind getTileKind(int col, int row) const {
+    if (const TileInfo *info = lookup(col, row))
+      return info->kind;
+    return computeTileKind(col, row);
+  }
+  TileKind computeTileKind(int col, int row) const;
+
+  int numColumns;
+  int numRows;
+  int partitionStartCol;
+  int deviceColumns;
+  uint32_t numMemTileRows;
+  llvm::SmallDenseSet<unsigned, 16> nocColumns;
+  uint32_t nocBytesPerCycle;
+  std::vector<TileInfo> tiles;
 };
 
 class AIE1TargetModel : public AIETargetModel {
 public:
-  AIE1TargetModel() {}
-
-  bool isCoreTile(int col, int row) const override { return row > 0; }
-  bool isMemTile(int col, int row) const override { return false; }
+  AIE1TargetModel(const AIEDeviceDescription &desc, int startCol, int numCols)
+      : AIETargetModel(desc, startCol, numCols) {
+    buildTables();
+  }
 
   AIEArch getTargetArch() const override;
 
-  llvm::Optional<TileID> getMemWest(TileID src) const override;
-  llvm::Optional<TileID> getMemEast(TileID src) const override;
-  llvm::Optional<TileID> getMemNorth(TileID src) const override;
-  llvm::Optional<TileID> getMemSouth(TileID src) const override;
-
   bool isMemWest(int srcCol, int srcRow, int dstCol, int dstRow) const override;
   bool isMemEast(int srcCol, int srcRow, int dstCol, int dstRow) const override;
   bool isMemNorth(int srcCol, int srcRow, int dstCol,
                   int dstRow) const override;
   bool isMemSouth(int srcCol, int srcRow, int dstCol,
                   int dstRow) const override;
-
-  bool isLegalMemAffinity(int coreCol, int coreRow, int memCol,
-                          int memRow) const override;
+  bool isLegalCascade(TileID src, TileID dst) const override;
 
   uint32_t getMemInternalBaseAddress(TileID src) const override {
     bool IsEvenRow = ((src.second % 2) == 0);
@@ -195,41 +371,58 @@ public:
   uint32_t getMemNorthBaseAddress() const override { return 0x00030000; }
   uint32_t getMemEastBaseAddress() const override { return 0x00038000; }
   uint32_t getLocalMemorySize() const override { return 0x00008000; }
+  uint32_t getProgramMemorySize() const override { return 0x00004000; }
   uint32_t getNumLocks(int col, int row) const override { return 16; }
   uint32_t getNumBDs(int col, int row) const override { return 16; }
-  uint32_t getNumMemTileRows() const override { return 0; }
+  uint32_t getMaxBDLength(int col, int row) const override {
+    return isShimNOCorPLTile(col, row) ? 0xFFFFFFFF : (1 << 13) - 1;
+  }
   uint32_t getMemTileSize() const override { return 0; }
-
-  uint32_t getNumDestSwitchboxConnections(int col, int row,
-                                          WireBundle bundle) const override;
-  uint32_t getNumSourceSwitchboxConnections(int col, int row,
+  uint32_t getNumBanks(int col, int row) const override { return 8; }
+  // 2 KB between the memories of two tiles take 530 cycles, 16 KB from the
+  // DDR 4437: 4 bytes per cycle once the DMA has loaded its descriptor.
+  uint32_t getStreamBytesPerCycle() const override { return 4; }
+  uint32_t getDmaBytesPerCycle(int col, int row) const override { return 4; }
+  uint32_t getDmaSetupCycles(int col, int row) const override { return 18; }
+  uint32_t getShimBytesPerCycle() const override { return 8; }
+  // A core runs a lock acquire, or a release, 5 cycles after it starts.
+  uint32_t getLockCycles() const override { return 5; }
+  uint32_t getSwitchHopCycles() const override { return 2; }
+
+protected:
+  llvm::Optional<TileID> computeMemWest(TileID src) const override;
+  llvm::Optional<TileID> computeMemEast(TileID src) const override;
+  llvm::Optional<TileID> computeMemNorth(TileID src) const override;
+  llvm::Optional<TileID> computeMemSouth(TileID src) const override;
+  bool computeLegalMemAffinity(int coreCol, int coreRow, int memCol,
+                               int memRow) const override;
+  uint32_t computeNumDestSwitchboxConnections(int col, int row,
+                                              WireBundle bundle) const override;
+  uint32_t
+  computeNumSourceSwitchboxConnections(int col, int row,
+                                       WireBundle bundle) const override;
+  uint32_t computeNumDestShimMuxConnections(int col, int row,
                                             WireBundle bundle) const override;
-  uint32_t getNumDestShimMuxConnections(int col, int row,
-                                        WireBundle bundle) const override;
-  uint32_t getNumSourceShimMuxConnections(int col, int row,
-                                          WireBundle bundle) const override;
+  uint32_t computeNumSourceShimMuxConnections(int col, int row,
+                                              WireBundle bundle) const override;
 };
 
 class AIE2TargetModel : public AIETargetModel {
 public:
-  AIE2TargetModel() {}
+  AIE2TargetModel(const AIEDeviceDescription &desc, int startCol, int numCols)
+      : AIETargetModel(desc, startCol, numCols) {
+    buildTables();
+  }
 
   AIEArch getTargetArch() const override;
 
-  llvm::Optional<TileID> getMemWest(TileID src) const override;
-  llvm::Optional<TileID> getMemEast(TileID src) const override;
-  llvm::Optional<TileID> getMemNorth(TileID src) const override;
-  llvm::Optional<TileID> getMemSouth(TileID src) const override;
-
   bool isMemWest(int srcCol, int srcRow, int dstCol, int dstRow) const override;
   bool isMemEast(int srcCol, int srcRow, int dstCol, int dstRow) const override;
   bool isMemNorth(int srcCol, int srcRow, int dstCol,
                   int dstRow) const override;
   bool isMemSouth(int srcCol, int srcRow, int dstCol,
                   int dstRow) const override;
-
-  bool isLegalMemAffinity(int coreCol, int coreRow, int memCol,
-                          int memRow) const override;
+  bool isLegalCascade(TileID src, TileID dst) const override;
 
   uint32_t getMemInternalBaseAddress(TileID src) const override {
     return getMemEastBaseAddress();
@@ -239,96 +432,79 @@ public:
   uint32_t getMemNorthBaseAddress() const override { return 0x00060000; }
   uint32_t getMemEastBaseAddress() const override { return 0x00070000; }
   uint32_t getLocalMemorySize() const override { return 0x00010000; }
+  uint32_t getProgramMemorySize() const override { return 0x00004000; }
   uint32_t getNumLocks(int col, int row) const override {
     return isMemTile(col, row) ? 64 : 16;
   }
   uint32_t getNumBDs(int col, int row) const override {
     return isMemTile(col, row) ? 48 : 16;
   }
+  uint32_t getMaxBDLength(int col, int row) const override {
+    if (isShimNOCorPLTile(col, row))
+      return 0xFFFFFFFF;
+    return isMemTile(col, row) ? (1 << 17) - 1 : (1 << 14) - 1;
+  }
   uint32_t getMemTileSize() const override { return 0x00080000; }
-
-  uint32_t getNumDestSwitchboxConnections(int col, int row,
-                                          WireBundle bundle) const override;
-  uint32_t getNumSourceSwitchboxConnections(int col, int row,
+  uint32_t getNumBanks(int col, int row) const override {
+    return isMemTile(col, row) ? 16 : 8;
+  }
+  // The AIE-ML DMAs and streams move 32-bit words per cycle, like the AIE1
+  // ones the latencies are measured on.
+  uint32_t getStreamBytesPerCycle() const override { return 4; }
+  uint32_t getDmaBytesPerCycle(int col, int row) const override { return 4; }
+  uint32_t getDmaSetupCycles(int col, int row) const override { return 18; }
+  uint32_t getShimBytesPerCycle() const override { return 8; }
+  uint32_t getLockCycles() const override { return 5; }
+  uint32_t getSwitchHopCycles() const override { return 2; }
+
+protected:
+  llvm::Optional<TileID> computeMemWest(TileID src) const override;
+  llvm::Optional<TileID> computeMemEast(TileID src) const override;
+  llvm::Optional<TileID> computeMemNorth(TileID src) const override;
+  llvm::Optional<TileID> computeMemSouth(TileID src) const override;
+  bool computeLegalMemAffinity(int coreCol, int coreRow, int memCol,
+                               int memRow) const override;
+  uint32_t computeNumDestSwitchboxConnections(int col, int row,
+                                              WireBundle bundle) const override;
+  uint32_t
+  computeNumSourceSwitchboxConnections(int col, int row,
+                                       WireBundle bundle) const override;
+  uint32_t computeNumDestShimMuxConnections(int col, int row,
                                             WireBundle bundle) const override;
-  uint32_t getNumDestShimMuxConnections(int col, int row,
-                                        WireBundle bundle) const override;
-  uint32_t getNumSourceShimMuxConnections(int col, int row,
-                                          WireBundle bundle) const override;
+  uint32_t computeNumSourceShimMuxConnections(int col, int row,
+                                              WireBundle bundle) const override;
 };
 
 class VC1902TargetModel : public AIE1TargetModel {
-  llvm::SmallDenseSet<unsigned, 16> noc_columns = {
-      2, 3, 6, 7, 10, 11, 18, 19, 26, 27, 34, 35, 42, 43, 46, 47};
-
 public:
-  VC1902TargetModel() {}
-
-  int columns() const override { return 50; }
-  int rows() const override { return 9; /* One Shim row and 8 Core rows. */ }
-
-  bool isShimNOCTile(int col, int row) const override {
-    return row == 0 && noc_columns.contains(col);
-  }
-  bool isShimPLTile(int col, int row) const override {
-    return row == 0 && !noc_columns.contains(col);
-  }
-  bool isShimNOCorPLTile(int col, int row) const override {
-    return isShimNOCTile(col, row) || isShimPLTile(col, row);
-  }
+  VC1902TargetModel(int startCol = 0, int numCols = -1)
+      : AIE1TargetModel({/*columns=*/50, /*rows=*/9, /*memTileRows=*/0,
+                         {2, 3, 6, 7, 10, 11, 18, 19, 26, 27, 34, 35, 42, 43,
+                          46, 47},
+                         // 16 columns flooded from the DDR move 28 KB each
+                         // in 29389 cycles.
+                         /*nocBytesPerCycle=*/16},
+                        startCol, numCols) {}
 };
 
 class VE2302TargetModel : public AIE2TargetModel {
-  llvm::SmallDenseSet<unsigned, 8> noc_columns = {2, 3, 6, 7, 10, 11};
-
 public:
-  VE2302TargetModel() {}
-
-  int columns() const override { return 17; }
-  int rows() const override {
-    return 4; /* One Shim row, 1 memtile rows, and 2 Core rows. */
-  }
-
-  bool isCoreTile(int col, int row) const override { return row > 1; }
-  bool isMemTile(int col, int row) const override { return row == 1; }
-  bool isShimNOCTile(int col, int row) const override {
-    return row == 0 && noc_columns.contains(col);
-  }
-  bool isShimPLTile(int col, int row) const override {
-    return row == 0 && !noc_columns.contains(col);
-  }
-  bool isShimNOCorPLTile(int col, int row) const override {
-    return isShimNOCTile(col, row) || isShimPLTile(col, row);
-  }
-  uint32_t getNumMemTileRows() const override { return 1; }
+  VE2302TargetModel(int startCol = 0, int numCols = -1)
+      : AIE2TargetModel({/*columns=*/17, /*rows=*/4, /*memTileRows=*/1,
+                         {2, 3, 6, 7, 10, 11},
+                         // A byte per cycle per NOC column, as measured on
+                         // the VC1902.
+                         /*nocBytesPerCycle=*/6},
+                        startCol, numCols) {}
 };
 
 class VE2802TargetModel : public AIE2TargetModel {
-  llvm::SmallDenseSet<unsigned, 16> noc_columns = {2,  3,  6,  7,  14, 15,
-                                                   22, 23, 30, 31, 34, 35};
-
 public:
-  VE2802TargetModel() {}
-
-  int columns() const override { return 38; }
-  int rows() const override {
-    return 11; /* One Shim row, 2 memtile rows, and 8 Core rows. */
-  }
-
-  bool isCoreTile(int col, int row) const override { return row > 2; }
-  bool isMemTile(int col, int row) const override {
-    return (row == 1) || (row == 2);
-  }
-  bool isShimNOCTile(int col, int row) const override {
-    return row == 0 && noc_columns.contains(col);
-  }
-  bool isShimPLTile(int col, int row) const override {
-    return row == 0 && !noc_columns.contains(col);
-  }
-  bool isShimNOCorPLTile(int col, int row) const override {
-    return isShimNOCTile(col, row) || isShimPLTile(col, row);
-  }
-  uint32_t getNumMemTileRows() const override { return 2; }
+  VE2802TargetModel(int startCol = 0, int numCols = -1)
+      : AIE2TargetModel({/*columns=*/38, /*rows=*/11, /*memTileRows=*/2,
+                         {2, 3, 6, 7, 14, 15, 22, 23, 30, 31, 34, 35},
+                         /*nocBytesPerCycle=*/12},
+                        startCol, numCols) {}
 };
 
 } // namespace AIE
@@ -13,91 +13,169 @@
 
 #include <algorithm>
 #include <limits>
+#include <queue>
 #include <utility> //for std::pair
 #include <vector>
 
-// builds against at least boost graph 1.7.1
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-local-typedef"
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-#pragma GCC diagnostic ignored "-Wdeprecated-copy"
-#pragma GCC diagnostic ignored "-Wsuggest-override"
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
-#include <boost/graph/graph_traits.hpp>
-#pragma GCC diagnostic pop
-
 #include "aie/Dialect/AIE/IR/AIEDialect.h" // for WireBundle and Port
+#include "aie/Dialect/AIE/Transforms/AIERoutingGraph.h"
 
 namespace xilinx {
 namespace AIE {
 
-using namespace boost;
+typedef RoutingGraph::VertexID vertex_descriptor;
+typedef RoutingGraph::EdgeID edge_descriptor;
 
-struct Switchbox { // acts as a vertex
-  unsigned short col, row;
-  // int dist;
-  unsigned int pred; // predecessor for dijkstra's
-  bool processed;    // denotes this switchbox has already been processed
-};
+typedef std::pair<int, int> Coord;
 
-struct Channel { // acts as an edge
-  float demand;  // indicates how many flows want to use this Channel
-  unsigned short
-      used_capacity;           // how many flows are actually using this Channel
-  unsigned short max_capacity; // maximum number of routing resources
-  std::set<short> fixed_capacity;     // channels not available to the algorithm
-  unsigned short over_capacity_count; // history of Channel being over capacity
-  WireBundle bundle;
+// Orders Switchboxes by their coordinates rather than their addresses, in the
+// row-major order of the routing graph, so that iterating over a routing
+// solution gives the same order in every run and for every copy of the graph.
+struct SwitchboxLess {
+  bool operator()(const Switchbox *a, const Switchbox *b) const {
+    return std::make_pair(a->row, a->col) < std::make_pair(b->row, b->col);
+  }
 };
 
-// create a graph type that uses Switchboxes as vertices and Channels as edges
-typedef adjacency_list<vecS, vecS, bidirectionalS, Switchbox, Channel>
-    SwitchboxGraph;
-
-typedef graph_traits<SwitchboxGraph>::vertex_descriptor vertex_descriptor;
-typedef graph_traits<SwitchboxGraph>::edge_descriptor edge_descriptor;
-typedef graph_traits<SwitchboxGraph>::vertex_iterator vertex_iterator;
-typedef graph_traits<SwitchboxGraph>::edge_iterator edge_iterator;
-typedef graph_traits<SwitchboxGraph>::in_edge_iterator in_edge_iterator;
-
-typedef std::pair<int, int> Coord;
 // A SwitchSetting defines the required settings for a Switchbox for a flow
 // SwitchSetting.first is the incoming signal
 // SwitchSetting.second is the fanout
 typedef std::pair<Port, std::set<Port>> SwitchSetting;
-typedef std::map<Switchbox *, SwitchSetting> SwitchSettings;
+typedef std::map<Switchbox *, SwitchSetting, SwitchboxLess> SwitchSettings;
 
 // A Flow defines source and destination vertices
 // Only one source, but any number of destinations (fanout)
 typedef std::pair<Switchbox *, Port> PathEndPoint;
 typedef std::pair<PathEndPoint, std::vector<PathEndPoint>> Flow;
 
+struct PathEndPointLess {
+  bool operator()(const PathEndPoint &a, const PathEndPoint &b) const {
+    if (a.first != b.first)
+      return SwitchboxLess()(a.first, b.first);
+    return a.second < b.second;
+  }
+};
+
+// The SwitchSettings of every flow, keyed by the source of the flow
+typedef std::map<PathEndPoint, SwitchSettings, PathEndPointLess>
+    RoutingSolution;
+
+// Added to the cost of every Channel while routing a flow with a hop budget.
+// It is larger than any demand a Channel that is not fixed can reach, so the
+// route found has as few hops as possible and demand only breaks ties.
+const float CRITICAL_HOP_COST = 1000;
+
+// A ChannelUse records the channel index a routed flow occupies on an edge
+typedef std::pair<edge_descriptor, short> ChannelUse;
+
+// An inclusive rectangle of tiles in the switchbox grid
+struct BoundingBox {
+  int minCol, minRow, maxCol, maxRow;
+
+  bool contains(int col, int row) const {
+    return col >= minCol && col <= maxCol && row >= minRow && row <= maxRow;
+  }
+  bool overlaps(const BoundingBox &other) const {
+    return minCol <= other.maxCol && other.minCol <= maxCol &&
+           minRow <= other.maxRow && other.minRow <= maxRow;
+  }
+  void extend(const BoundingBox &other) {
+    minCol = std::min(minCol, other.minCol);
+    minRow = std::min(minRow, other.minRow);
+    maxCol = std::max(maxCol, other.maxCol);
+    maxRow = std::max(maxRow, other.maxRow);
+  }
+  // grow the box by margin tiles on every side, without leaving limits
+  BoundingBox grow(int margin, const BoundingBox &limits) const {
+    return {std::max(limits.minCol, minCol - margin),
+            std::max(limits.minRow, minRow - margin),
+            std::min(limits.maxCol, maxCol + margin),
+            std::min(limits.maxRow, maxRow + margin)};
+  }
+};
+
+// Options controlling how Pathfinder searches the routing graph for a flow.
+struct PathfinderOptions {
+  // Use a goal-directed A* search with a Manhattan-distance heuristic towards
+  // each destination instead of a full single-source Dijkstra per flow.
+  bool useAStar = false;
+  // If non-negative, limit the A* search to the bounding box enclosing the
+  // source and destination, grown by this many tiles on every side.  A flow
+  // which cannot be routed inside its box is retried on the whole graph.
+  int boundingBoxMargin = -1;
+  // After the first iteration, only rip up and reroute flows which cross a
+  // Channel that is over capacity, keeping all legal routes in place.
+  bool incremental = false;
+  // If greater than 1, flows are partitioned into clusters whose bounding
+  // boxes (grown by boundingBoxMargin, or by one tile if no margin is given)
+  // do not overlap, and the clusters are routed concurrently on the MLIR
+  // thread pool.  The result is the same for any number of threads above 1.
+  unsigned threads = 1;
+  // Route each fanout flow as an approximate Steiner tree, connecting one
+  // destination at a time to the closest point of the partial tree, instead
+  // of as a tree of shortest paths from the source.  This uses multi-source
+  // Dijkstra searches, so it takes precedence over useAStar.
+  bool steinerTrees = false;
+};
+
 class Pathfinder {
 private:
-  SwitchboxGraph graph;
+  RoutingGraph graph;
+  // predecessor of each vertex for the current search
+  std::vector<vertex_descriptor> pred;
+  // denotes the vertex has already been processed for the current flow
+  std::vector<bool> processed;
   std::vector<Flow> flows;
+  // largest number of hops allowed for each flow, or -1 if unconstrained
+  std::vector<int> hopBudgets;
+  // expected bandwidth of each flow in percent of a channel, or 0 if unknown
+  std::vector<int> bandwidths;
+  // whether each flow is routed as a Steiner tree even without steinerTrees
+  std::vector<bool> steinerFlows;
   bool maxIterReached;
+  // number of iterations taken by the last call to findPaths
+  int iterations = 0;
+  // every search is confined to this region, the whole grid by default
+  BoundingBox region = {0, 0, -1, -1};
+  PathfinderOptions options;
+  mlir::MLIRContext *context = nullptr;
+
+  BoundingBox getBoundingBox(vertex_descriptor src, vertex_descriptor dst);
+  float getCost(edge_descriptor e, bool critical) const {
+    return graph.demand[e] + (critical ? CRITICAL_HOP_COST : 0);
+  }
+  void findShortestPaths(ArrayRef<vertex_descriptor> sources, bool critical,
+                         std::vector<float> &cost);
+  bool findAStarPath(vertex_descriptor src, vertex_descriptor dst,
+                     int boundingBoxMargin, bool critical);
+  SwitchSettings routeFlow(const Flow &flow, bool critical, bool steiner,
+                           std::vector<ChannelUse> &usedChannels);
+  void ripUpFlow(std::vector<ChannelUse> &usedChannels);
+  bool findPathsInParallel(const int MAX_ITERATIONS, RoutingSolution &solution);
 
 public:
   Pathfinder();
-  Pathfinder(int maxcol, int maxrow, DeviceOp &d);
+  Pathfinder(int maxcol, int maxrow, DeviceOp &d,
+             PathfinderOptions options = PathfinderOptions());
   void initializeGraph(int maxcol, int maxrow, DeviceOp &d);
-  void addFlow(Coord srcCoords, Port srcPort, Coord dstCoords, Port dstPort);
+  void addFlow(Coord srcCoords, Port srcPort, Coord dstCoords, Port dstPort,
+               int hopBudget = -1, int bandwidth = 0, bool steiner = false);
   void addFixedConnection(Coord coord, Port port);
   bool isLegal();
-  std::map<PathEndPoint, SwitchSettings>
-  findPaths(const int MAX_ITERATIONS = 1000);
+  RoutingSolution findPaths(const int MAX_ITERATIONS = 1000);
+
+  int getIterationCount() const { return iterations; }
+  const RoutingGraph &getGraph() const { return graph; }
+
+  bool isInGraph(int col, int row) const { return graph.isInGraph(col, row); }
+  vertex_descriptor getVertex(int col, int row) const {
+    return graph.getVertex(col, row);
+  }
 
   Switchbox *getSwitchbox(TileID coords) {
-    auto vpair = vertices(graph);
-    Switchbox *sb;
-    for (vertex_iterator v = vpair.first; v != vpair.second; v++) {
-      sb = &graph[*v];
-      if (sb->col == coords.first && sb->row == coords.second)
-        return sb;
-    }
-    return nullptr;
+    if (!isInGraph(coords.first, coords.second))
+      return nullptr;
+    return &graph.getSwitchbox(getVertex(coords.first, coords.second));
   }
 };
 
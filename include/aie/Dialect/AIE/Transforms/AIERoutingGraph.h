@@ -0,0 +1,118 @@
+//===- AIERoutingGraph.h ----------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef AIE_ROUTINGGRAPH_H
+#define AIE_ROUTINGGRAPH_H
+
+#include <cstdint>
+#include <vector>
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h" // for WireBundle and Port
+
+namespace xilinx {
+namespace AIE {
+
+struct Switchbox { // acts as a vertex
+  unsigned short col, row;
+};
+
+// A compact graph of the stream switches of a device, stored in compressed
+// sparse row form.  Vertices are numbered in row-major order of the tile grid.
+// The edges leaving a vertex have consecutive ids, and the ids of the edges
+// entering a vertex are stored consecutively in a separate index array.  The
+// attributes of the Channels represented by the edges are stored as parallel
+// arrays indexed by edge id, with channel indices kept as bitmasks.
+class RoutingGraph {
+public:
+  typedef unsigned int VertexID;
+  typedef unsigned int EdgeID;
+  typedef uint64_t ChannelMask;
+  // Channel indices beyond the mask width are only ever used by routes which
+  // are over capacity, so they are counted rather than tracked individually.
+  static const short OVERFLOW_CHANNEL = 64;
+
+  void initialize(int maxcol, int maxrow, const AIETargetModel &targetModel);
+
+  int getMaxCol() const { return maxcol; }
+  int getMaxRow() const { return maxrow; }
+  unsigned int numVertices() const { return switchboxes.size(); }
+  unsigned int numEdges() const { return bundle.size(); }
+
+  bool isInGraph(int col, int row) const {
+    return col >= 0 && col <= maxcol && row >= 0 && row <= maxrow;
+  }
+  VertexID getVertex(int col, int row) const {
+    assert(isInGraph(col, row));
+    return row * (maxcol + 1) + col;
+  }
+  Switchbox &getSwitchbox(VertexID v) { return switchboxes[v]; }
+  const Switchbox &getSwitchbox(VertexID v) const { return switchboxes[v]; }
+
+  // [outEdgesBegin(v), outEdgesEnd(v)) are the ids of the edges leaving v
+  EdgeID outEdgesBegin(VertexID v) const { return outOffsets[v]; }
+  EdgeID outEdgesEnd(VertexID v) const { return outOffsets[v + 1]; }
+  // inEdges[i] for i in [inEdgesBegin(v), inEdgesEnd(v)) are the ids of the
+  // edges entering v
+  unsigned int inEdgesBegin(VertexID v) const { return inOffsets[v]; }
+  unsigned int inEdgesEnd(VertexID v) const { return inOffsets[v + 1]; }
+  EdgeID inEdge(unsigned int i) const { return inEdges[i]; }
+
+  // find the edge leaving v in the given direction
+  bool findOutEdge(VertexID v, WireBundle dir, EdgeID &edge) const {
+    for (EdgeID e = outEdgesBegin(v); e != outEdgesEnd(v); e++)
+      if (bundle[e] == dir) {
+        edge = e;
+        return true;
+      }
+    return false;
+  }
+
+  // Reset every Channel to unused, with no fixed connections.
+  void clearChannels();
+  // Mark channel index as unavailable on edge.
+  void addFixedChannel(EdgeID edge, short index);
+  // Allocate the lowest channel index on edge which is neither fixed nor
+  // already allocated, and update the used capacity of the edge.
+  short allocateChannel(EdgeID edge);
+  // Release a channel index returned by allocateChannel.
+  void releaseChannel(EdgeID edge, short index);
+  unsigned int numFixedChannels(EdgeID edge) const;
+
+  // Channel attributes, indexed by edge id.
+  std::vector<VertexID> edgeSource, edgeTarget;
+  std::vector<WireBundle> bundle;
+  // indicates how many flows want to use this Channel
+  std::vector<float> demand;
+  // how many flows are actually using this Channel
+  std::vector<unsigned short> usedCapacity;
+  // maximum number of routing resources
+  std::vector<unsigned short> maxCapacity;
+  // history of Channel being over capacity
+  std::vector<unsigned short> overCapacityCount;
+  // channels not available to the algorithm
+  std::vector<ChannelMask> fixedCapacity;
+  // channels assigned to routed flows
+  std::vector<ChannelMask> allocatedCapacity;
+  // number of allocations at OVERFLOW_CHANNEL
+  std::vector<unsigned short> overflowCount;
+
+private:
+  int maxcol = -1, maxrow = -1;
+  std::vector<Switchbox> switchboxes;
+  std::vector<EdgeID> outOffsets;
+  std::vector<unsigned int> inOffsets;
+  std::vector<EdgeID> inEdges;
+
+  void updateUsedCapacity(EdgeID edge);
+};
+
+} // namespace AIE
+} // namespace xilinx
+#endif
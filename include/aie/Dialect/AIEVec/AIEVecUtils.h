@@ -18,11 +18,36 @@
 #include "aie/Dialect/AIEVec/IR/AIEVecTypes.h"
 #include "mlir/Dialect/Affine/IR/AffineOps.h"
 #include "mlir/Dialect/Vector/IR/VectorOps.h"
+#include <array>
 #include <assert.h>
+#include <optional>
 
 namespace xilinx {
 namespace aievec {
 
+// Names of the scheduling attributes of the scf.for loops, which are set by
+// an analysis or an autotuner and translated to chess pragmas by
+// aievec-to-cpp:
+// - aievec.unroll: unroll factor of the loop, as a positive integer;
+// - aievec.pipeline: false for the loops which must not be pipelined;
+// - aievec.flatten: unit attribute for the loops to flatten into their parent;
+// - aievec.min_trip_count, aievec.max_trip_count: bounds of the trip count,
+//   overriding the ones derived from constant loop bounds.
+constexpr llvm::StringLiteral loopUnrollAttrName = "aievec.unroll";
+constexpr llvm::StringLiteral loopPipelineAttrName = "aievec.pipeline";
+constexpr llvm::StringLiteral loopFlattenAttrName = "aievec.flatten";
+constexpr llvm::StringLiteral loopMinTripCountAttrName =
+    "aievec.min_trip_count";
+constexpr llvm::StringLiteral loopMaxTripCountAttrName =
+    "aievec.max_trip_count";
+
+// Name of the attribute of the functions with dynamically shaped memref
+// arguments listing the shapes they are called with, each as an array of the
+// sizes of the dynamic dimensions of the arguments, in argument order.
+// aievec-to-cpp --aievec-specialize-shapes emits a variant of the function
+// for each of them, with the sizes as compile-time constants.
+constexpr llvm::StringLiteral funcShapesAttrName = "aievec.shapes";
+
 // For input val, return its value in hex. Since we currently support each
 // offset value to be only 4 bits, the val must be < 16
 inline char getHexValue(int val) {
@@ -63,6 +88,22 @@ inline int32_t getVectorSizeInBits(VectorType type) {
   return veclen;
 }
 
+// Return the shape {M, K, N} of the AIE-ML MMUL instruction multiplying an
+// (M x K)matrix of lhsType elements by a (K x N)matrix of rhsType elements
+// into an (M x N)accumulator of accType elements, if there is one.
+inline std::optional<std::array<int64_t, 3>>
+getAIEMLMatMulShape(Type lhsType, Type rhsType, Type accType) {
+  if (lhsType != rhsType)
+    return std::nullopt;
+  if (lhsType.isInteger(8) && accType.isInteger(32))
+    return std::array<int64_t, 3>{4, 8, 8};
+  if (lhsType.isInteger(16) && accType.isInteger(64))
+    return std::array<int64_t, 3>{4, 4, 4};
+  if (lhsType.isBF16() && accType.isF32())
+    return std::array<int64_t, 3>{4, 8, 4};
+  return std::nullopt;
+}
+
 // Return true if this is an operation defined in AIE dialect
 inline bool isAIEOp(Operation *op) {
   return llvm::isa<AIEVecDialect>(op->getDialect());
@@ -47,6 +47,11 @@ struct LowerVectorToAIEVecOptions
       llvm::cl::desc("Select AIE version: \"aie\" or \"aieml\". This will "
                      "determine the vector size and available operations."),
       llvm::cl::init("aie")};
+  PassOptions::Option<std::string> costModel{
+      *this, "cost-model",
+      llvm::cl::desc("JSON file overriding the latency and issue cycles of "
+                     "the AIEVec ops used to choose between lowerings"),
+      llvm::cl::init("")};
 };
 
 /// Options for the "optimize-aievec" pipeline.
@@ -87,11 +92,17 @@ struct ConvertVectorToAIEVecOptions
       llvm::cl::desc("Select AIE version: \"aie\" or \"aieml\". This will "
                      "determine the vector size and available operations."),
       llvm::cl::init("aie")};
+  PassOptions::Option<std::string> costModel{
+      *this, "cost-model",
+      llvm::cl::desc("JSON file overriding the latency and issue cycles of "
+                     "the AIEVec ops used to choose between lowerings"),
+      llvm::cl::init("")};
 
   LogicalResult parseFromString(StringRef options) {
     auto res = PassPipelineOptions::parseFromString(options);
     if (!failed(res)) {
       lowerOptions.aieTarget = aieTarget;
+      lowerOptions.costModel = costModel;
       canonicalizeOptions.aieTarget = aieTarget;
       optimizeOptions.aieTarget = aieTarget;
       optimizeOptions.shiftParam = shiftParam;
@@ -118,6 +129,16 @@ private:
   OptimizeAIEVecOptions optimizeOptions;
 };
 
+/// Options for the "tosa-to-aievec" pipeline.
+struct TosaToAIEVecOptions : public ConvertVectorToAIEVecOptions {
+  PassOptions::Option<unsigned> vectorSize{
+      *this, "vector-size",
+      llvm::cl::desc("Virtual vector size of the affine super-vectorizer, "
+                     "which should fill the vectors of the target for the "
+                     "element type of the graph"),
+      llvm::cl::init(16)};
+};
+
 //===----------------------------------------------------------------------===//
 // Building and Registering.
 //===----------------------------------------------------------------------===//
@@ -138,6 +159,12 @@ void buildLowerVectorToAIEVec(OpPassManager &pm,
 void buildOptimizeAIEVec(OpPassManager &pm,
                          const OptimizeAIEVecOptions &options);
 
+/// Adds the "tosa-to-aievec" pipeline to the `OpPassManager`. This pipeline
+/// takes a graph of `TOSA` ops, lowers it to `Linalg` where its elementwise
+/// ops and broadcasts are fused, bufferizes it, vectorizes the resulting
+/// loops and lowers them to `AIEVec` dialect.
+void buildTosaToAIEVec(OpPassManager &pm, const TosaToAIEVecOptions &options);
+
 /// Register all pipelines for the AIE Vector dialect.
 void registerAIEVecPipelines();
 
@@ -61,6 +61,10 @@ namespace aievec {
 #include "aie/Dialect/AIEVec/Transforms/Passes.h.inc"
 
 std::unique_ptr<Pass> createAIEVectorizePass();
+std::unique_ptr<Pass> createAIEVecPipelineLoadsPass();
+std::unique_ptr<Pass> createAIEVecFuseLoopsPass();
+std::unique_ptr<Pass> createAIEVecInterchangeLoopsPass();
+std::unique_ptr<Pass> createAIEVecRaiseToAffinePass();
 
 /// Generate the code for registering passes.
 #define GEN_PASS_REGISTRATION
@@ -0,0 +1,72 @@
+//===- CostModel.h - Cost model of the AIEVec operations --------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// Per-target latency and throughput of the AIEVec operations, used by the
+// lowering to pick the cheapest of the AIEVec forms of a computation.
+//===----------------------------------------------------------------------===//
+
+#ifndef AIE_DIALECT_AIEVEC_UTILS_COSTMODEL_H
+#define AIE_DIALECT_AIEVEC_UTILS_COSTMODEL_H
+
+#include "mlir/Support/LogicalResult.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include <string>
+
+namespace xilinx::aievec {
+
+/// The cycles an operation costs on its target.
+struct AIEVecOpCost {
+  // Cycles until its result can be used.
+  unsigned latency;
+  // Cycles its issue slot is busy, i.e. the inverse of its throughput.
+  unsigned issue;
+};
+
+/// The cost model of the AIEVec operations of an AIE target. Operations are
+/// identified by their name, e.g. "aievec.mac_elem". The default costs of a
+/// target can be overridden by a JSON file, e.g. calibrated with
+/// microbenchmarks, mapping operation names to their costs:
+///
+///   { "aievec.mac_elem": { "latency": 4, "issue": 1 }, ... }
+class AIEVecCostModel {
+public:
+  /// Build the default cost model of aieTarget, "aie" or "aieml".
+  explicit AIEVecCostModel(llvm::StringRef aieTarget = "aie");
+
+  /// Override the costs of the operations listed in the JSON file at path.
+  mlir::LogicalResult loadFromFile(llvm::StringRef path,
+                                   std::string &errorMessage);
+
+  /// Return the cost of the operation named opName. Unknown operations cost
+  /// one cycle.
+  AIEVecOpCost getOpCost(llvm::StringRef opName) const;
+
+  /// Return the issue cycles of the operations named opNames, which bound
+  /// the throughput of the software-pipelined loops running them.
+  unsigned getIssueCycles(llvm::ArrayRef<llvm::StringRef> opNames) const;
+
+  /// Return the latency of the operations named opNames when each one uses
+  /// the result of the previous one.
+  unsigned getLatency(llvm::ArrayRef<llvm::StringRef> opNames) const;
+
+  /// Return true if the operations named lhs are cheaper than, or as cheap
+  /// as, the ones named rhs: they take fewer issue cycles, or as many with
+  /// no more latency.
+  bool isNotMoreExpensive(llvm::ArrayRef<llvm::StringRef> lhs,
+                          llvm::ArrayRef<llvm::StringRef> rhs) const;
+
+private:
+  llvm::StringMap<AIEVecOpCost> opCosts;
+};
+
+} // namespace xilinx::aievec
+
+#endif // AIE_DIALECT_AIEVEC_UTILS_COSTMODEL_H
@@ -0,0 +1,49 @@
+//===- RegisterPressure.h - Register pressure of AIEVec IR ------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// Estimate of the vector and accumulator registers the AIEVec operations of a
+// kernel keep live, to tell whether the backend will likely spill them.
+//===----------------------------------------------------------------------===//
+
+#ifndef AIE_DIALECT_AIEVEC_UTILS_REGISTERPRESSURE_H
+#define AIE_DIALECT_AIEVEC_UTILS_REGISTERPRESSURE_H
+
+#include "mlir/IR/Operation.h"
+
+namespace xilinx::aievec {
+
+/// Bits held in the vector and in the accumulator registers.
+struct RegisterPressure {
+  unsigned vectorBits = 0;
+  unsigned accBits = 0;
+
+  /// Return true if this does not fit in the registers of capacity.
+  bool exceeds(const RegisterPressure &capacity) const {
+    return vectorBits > capacity.vectorBits || accBits > capacity.accBits;
+  }
+};
+
+/// Return the size of the vector and accumulator register files of AIE1, or
+/// of AIE-ML if aieml is set.
+RegisterPressure getRegisterFileSize(bool aieml);
+
+/// Return true if value is held in an accumulator register: it is produced by
+/// an AIEVec multiplier operation or an ups, or carried by a loop starting
+/// from such a value.
+bool isAccumulatorValue(mlir::Value value, bool aieml);
+
+/// Return the largest number of vector and accumulator bits live at once in
+/// the blocks nested in op. Values live across an operation with regions
+/// count in its blocks too. The vector and accumulator maxima may be reached
+/// at different points.
+RegisterPressure estimateRegisterPressure(mlir::Operation *op, bool aieml);
+
+} // namespace xilinx::aievec
+
+#endif // AIE_DIALECT_AIEVEC_UTILS_REGISTERPRESSURE_H
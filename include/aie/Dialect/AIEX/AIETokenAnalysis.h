@@ -38,23 +38,40 @@ class TokenAnalysis {
   SmallVector<std::pair<Operation *, Operation *>, 4> tokenChains;
   SmallVector<std::pair<Operation *, Operation *>, 4> tokenPairs;
   DenseMap<std::pair<int, int>, Operation *> tiles;
+  // the tokenPairs indexed by their release and by their acquire
+  DenseMap<Operation *, Operation *> pairedAcquire;
+  DenseMap<Operation *, Operation *> pairedRelease;
 
 public:
   TokenAnalysis(AIE::DeviceOp &d) : device(d) {}
 
   void runAnalysis();
 
-  auto getTokenSymbols() const { return tokenSymbols; }
+  const auto &getTokenSymbols() const { return tokenSymbols; }
 
-  auto getTokenAcqMap() const { return tokenAcqMap; }
+  const auto &getTokenAcqMap() const { return tokenAcqMap; }
 
-  auto getTokenRelMap() const { return tokenRelMap; }
+  const auto &getTokenRelMap() const { return tokenRelMap; }
 
-  auto getTokenChains() const { return tokenChains; }
+  const auto &getTokenChains() const { return tokenChains; }
 
-  auto getTokenPairs() const { return tokenPairs; }
+  const auto &getTokenPairs() const { return tokenPairs; }
 
-  auto getTiles() const { return tiles; }
+  const auto &getTiles() const { return tiles; }
+
+  // The acquire which forms a token pair with the given release, or nullptr.
+  Operation *getPairedAcquire(Operation *release) const {
+    return pairedAcquire.lookup(release);
+  }
+  // The release which forms a token pair with the given acquire, or nullptr.
+  Operation *getPairedRelease(Operation *acquire) const {
+    return pairedRelease.lookup(acquire);
+  }
+
+  // A chain is redundant if its release and acquire, and the operations they
+  // are paired with, are done in this order by the same process, which needs
+  // no lock to see its own release.
+  bool isRedundantChain(Operation *release, Operation *acquire);
 
   // CoreOp or MemOp
   Operation *getTokenUserOp(Operation *Op);
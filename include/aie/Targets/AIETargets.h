@@ -6,6 +6,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#ifndef AIE_TARGETS_AIETARGETS_H
+#define AIE_TARGETS_AIETARGETS_H
+
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/Support/LogicalResult.h"
 #include "llvm/Support/raw_ostream.h"
@@ -15,11 +18,32 @@ namespace AIE {
 mlir::LogicalResult AIETranslateToXAIEV1(mlir::ModuleOp module,
                                          llvm::raw_ostream &output);
 mlir::LogicalResult AIETranslateToXAIEV2(mlir::ModuleOp module,
-                                         llvm::raw_ostream &output);
+                                         llvm::raw_ostream &output,
+                                         bool minimal = false);
 mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
-                                         llvm::raw_ostream &output);
+                                         llvm::raw_ostream &output,
+                                         bool compress = false);
+mlir::LogicalResult AIETranslateToTxn(mlir::ModuleOp module,
+                                      llvm::raw_ostream &output,
+                                      bool minimal = false);
+mlir::LogicalResult AIETranslateToTxnDelta(mlir::ModuleOp base,
+                                           mlir::ModuleOp module,
+                                           llvm::raw_ostream &output);
+mlir::LogicalResult AIETranslateToCtrlPkt(mlir::ModuleOp module,
+                                          mlir::ModuleOp base,
+                                          llvm::raw_ostream &output);
+mlir::LogicalResult
+AIETranslateToChessLLVMIR(mlir::ModuleOp module,
+                          llvm::StringRef intrinsicWrapper,
+                          llvm::raw_ostream &output);
 mlir::LogicalResult AIEFlowsToJSON(mlir::ModuleOp module,
                                    llvm::raw_ostream &output);
+mlir::LogicalResult AIEBufferReport(mlir::ModuleOp module,
+                                    llvm::raw_ostream &output);
+mlir::LogicalResult AIEEstimatePerformance(mlir::ModuleOp module,
+                                           llvm::raw_ostream &output);
+mlir::LogicalResult AIESymbolTable(mlir::ModuleOp module,
+                                   llvm::raw_ostream &output);
 mlir::LogicalResult ADFGenerateCPPGraph(mlir::ModuleOp module,
                                         llvm::raw_ostream &output);
 mlir::LogicalResult AIETranslateSCSimConfig(mlir::ModuleOp module,
@@ -30,3 +54,5 @@ mlir::LogicalResult AIETranslateGraphXPE(mlir::ModuleOp module,
                                          llvm::raw_ostream &);
 } // namespace AIE
 } // namespace xilinx
+
+#endif // AIE_TARGETS_AIETARGETS_H
@@ -29,3 +29,15 @@ bool aieTypeIsObjectFifoType(MlirType type) {
 MlirType aieObjectFifoTypeGet(MlirType type) {
   return wrap(xilinx::AIE::AIEObjectFifoType::get(unwrap(type)));
 }
+
+//===---------------------------------------------------------------------===//
+// ObjectFifoSubviewType
+//===---------------------------------------------------------------------===//
+
+bool aieTypeIsObjectFifoSubviewType(MlirType type) {
+  return unwrap(type).isa<xilinx::AIE::AIEObjectFifoSubviewType>();
+}
+
+MlirType aieObjectFifoSubviewTypeGet(MlirType type) {
+  return wrap(xilinx::AIE::AIEObjectFifoSubviewType::get(unwrap(type)));
+}
@@ -0,0 +1,61 @@
+//===- Translation.cpp ------------------------------------------*- C++ -*-===//
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie-c/Translation.h"
+
+#include "aie/Targets/AIETargets.h"
+
+#include "mlir/CAPI/IR.h"
+#include "mlir/CAPI/Support.h"
+#include "mlir/CAPI/Utils.h"
+#include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
+#include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
+#include "mlir/Target/LLVMIR/Export.h"
+
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+
+using namespace mlir;
+
+MlirLogicalResult aieTranslateModuleToLLVMIR(MlirOperation module,
+                                             MlirStringCallback callback,
+                                             void *userData) {
+  auto moduleOp = llvm::dyn_cast<ModuleOp>(unwrap(module));
+  if (!moduleOp)
+    return wrap(failure());
+  registerBuiltinDialectTranslation(*moduleOp->getContext());
+  registerLLVMDialectTranslation(*moduleOp->getContext());
+  llvm::LLVMContext llvmContext;
+  // The AIE backends of opt and llc still expect typed pointers.
+  llvmContext.setOpaquePointers(false);
+  auto llvmModule = translateModuleToLLVMIR(moduleOp, llvmContext);
+  if (!llvmModule)
+    return wrap(failure());
+  detail::CallbackOstream stream(callback, userData);
+  llvmModule->print(stream, nullptr);
+  return wrap(success());
+}
+
+MlirLogicalResult aieTranslateToXAIEV2(MlirOperation module,
+                                       MlirStringCallback callback,
+                                       void *userData) {
+  auto moduleOp = llvm::dyn_cast<ModuleOp>(unwrap(module));
+  if (!moduleOp)
+    return wrap(failure());
+  detail::CallbackOstream stream(callback, userData);
+  return wrap(xilinx::AIE::AIETranslateToXAIEV2(moduleOp, stream));
+}
+
+MlirLogicalResult aieEstimatePerformance(MlirOperation module,
+                                         MlirStringCallback callback,
+                                         void *userData) {
+  auto moduleOp = llvm::dyn_cast<ModuleOp>(unwrap(module));
+  if (!moduleOp)
+    return wrap(failure());
+  detail::CallbackOstream stream(callback, userData);
+  return wrap(xilinx::AIE::AIEEstimatePerformance(moduleOp, stream));
+}
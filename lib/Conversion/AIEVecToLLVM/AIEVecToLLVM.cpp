@@ -276,11 +276,41 @@ class UPSOpConversion : public mlir::ConvertOpToLLVMPattern<aievec::UPSOp> {
 public:
   using ConvertOpToLLVMPattern<aievec::UPSOp>::ConvertOpToLLVMPattern;
 
+  static std::string getIntrinsicName(aievec::UPSOp op) {
+    auto sourceType = cast<VectorType>(op.getSource().getType());
+    auto resultType = cast<VectorType>(op.getResult().getType());
+    std::stringstream ss;
+    ss << "llvm.aie.ups." << getVectorTypeString(resultType, false, true)
+       << "." << getVectorTypeString(sourceType, true);
+    return ss.str();
+  }
+
   LogicalResult
   matchAndRewrite(aievec::UPSOp op, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
-    op.emitWarning() << "aie.ups conversion is not implemented\n";
-    return failure();
+    // If the intrinsic declaration doesn't exist, create it
+    std::string intrinsicName = getIntrinsicName(op);
+    auto module = op->getParentOfType<ModuleOp>();
+    MLIRContext *context = rewriter.getContext();
+    auto func = module.lookupSymbol<LLVM::LLVMFuncOp>(
+        StringAttr::get(context, intrinsicName));
+    auto shiftType = IntegerType::get(context, 32);
+
+    if (!func) {
+      OpBuilder::InsertionGuard guard(rewriter);
+      rewriter.setInsertionPointToStart(module.getBody());
+      func = rewriter.create<LLVM::LLVMFuncOp>(
+          rewriter.getUnknownLoc(), intrinsicName,
+          LLVM::LLVMFunctionType::get(op.getResult().getType(),
+                                      {op.getSource().getType(), shiftType}));
+    }
+
+    // Create a constant for the shift value
+    auto shiftVal = rewriter.create<LLVM::ConstantOp>(
+        op->getLoc(), shiftType, rewriter.getI32IntegerAttr(op.getShift()));
+    rewriter.replaceOpWithNewOp<LLVM::CallOp>(
+        op, func, ValueRange{op.getSource(), shiftVal});
+    return success();
   }
 };
 
@@ -333,9 +363,22 @@ public:
                                       {op.getSource().getType(), shiftType}));
     }
 
-    // Create a constant for the shift value
-    auto shiftVal = rewriter.create<LLVM::ConstantOp>(
-        op->getLoc(), shiftType, rewriter.getI32IntegerAttr(op.getShift()));
+    // Create a constant for the shift value, unless it is only known at
+    // runtime
+    Value shiftVal;
+    if (Value dynamicShift = adaptor.getDynamicShift()) {
+      unsigned width = dynamicShift.getType().getIntOrFloatBitWidth();
+      shiftVal = dynamicShift;
+      if (width < 32)
+        shiftVal =
+            rewriter.create<LLVM::SExtOp>(op->getLoc(), shiftType, shiftVal);
+      else if (width > 32)
+        shiftVal =
+            rewriter.create<LLVM::TruncOp>(op->getLoc(), shiftType, shiftVal);
+    } else {
+      shiftVal = rewriter.create<LLVM::ConstantOp>(
+          op->getLoc(), shiftType, rewriter.getI32IntegerAttr(op.getShift()));
+    }
     rewriter.replaceOpWithNewOp<LLVM::CallOp>(
         op, func, ValueRange{op.getSource(), shiftVal});
     return success();
@@ -681,37 +724,298 @@ class UnpackOpConversion
 public:
   using ConvertOpToLLVMPattern<aievec::UnpackOp>::ConvertOpToLLVMPattern;
 
+  static std::string getIntrinsicName(aievec::UnpackOp op) {
+    auto sourceType = cast<VectorType>(op.getSource().getType());
+    std::stringstream ss;
+    ss << "llvm.aie.unpack." << getVectorTypeString(sourceType);
+    return ss.str();
+  }
+
   LogicalResult
   matchAndRewrite(aievec::UnpackOp op, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
-    op.emitWarning() << "aie.unpack conversion is not implemented\n";
-    return failure();
+    auto module = op->getParentOfType<ModuleOp>();
+    MLIRContext *context = rewriter.getContext();
+
+    // If the intrinsic declaration doesn't exist, create it
+    std::string intrinsicName = getIntrinsicName(op);
+    auto func = module.lookupSymbol<LLVM::LLVMFuncOp>(
+        StringAttr::get(context, intrinsicName));
+
+    if (!func) {
+      OpBuilder::InsertionGuard guard(rewriter);
+      rewriter.setInsertionPointToStart(module.getBody());
+      func = rewriter.create<LLVM::LLVMFuncOp>(
+          rewriter.getUnknownLoc(), intrinsicName,
+          LLVM::LLVMFunctionType::get(op.getResult().getType(),
+                                      {op.getSource().getType()}));
+    }
+
+    rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, func,
+                                              ValueRange{op.getSource()});
+    return success();
   }
 };
 
-class BroadcastOpConversion
-    : public mlir::ConvertOpToLLVMPattern<aievec::BroadcastOp> {
+// Return the declaration of the intrinsic `name`, inserting it at the start of
+// the module if it does not exist yet.
+static LLVM::LLVMFuncOp getOrInsertIntrinsic(OpBuilder &builder,
+                                             ModuleOp module, StringRef name,
+                                             Type resultType,
+                                             TypeRange argTypes) {
+  if (auto func = module.lookupSymbol<LLVM::LLVMFuncOp>(name))
+    return func;
+  OpBuilder::InsertionGuard guard(builder);
+  builder.setInsertionPointToStart(module.getBody());
+  return builder.create<LLVM::LLVMFuncOp>(
+      builder.getUnknownLoc(), name,
+      LLVM::LLVMFunctionType::get(resultType, argTypes));
+}
+
+// Base class of the conversions of AIE-ML ops to a call to the intrinsic
+// which `Derived::getIntrinsicName` returns. The arguments of the call are
+// the operands of the op, followed by the i32 constants that
+// `Derived::getImmediates` returns for its attributes.
+template <typename OpTy, typename Derived>
+class AIE2IntrinsicOpConversion : public mlir::ConvertOpToLLVMPattern<OpTy> {
 public:
-  using ConvertOpToLLVMPattern<aievec::BroadcastOp>::ConvertOpToLLVMPattern;
+  using mlir::ConvertOpToLLVMPattern<OpTy>::ConvertOpToLLVMPattern;
+  using OpAdaptor = typename OpTy::Adaptor;
+
+  static SmallVector<int32_t> getImmediates(OpTy op) { return {}; }
 
   LogicalResult
-  matchAndRewrite(aievec::BroadcastOp op, OpAdaptor adaptor,
+  matchAndRewrite(OpTy op, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
-    op.emitWarning() << "aie.broadcast conversion is not implemented\n";
-    return failure();
+    Type resultType =
+        this->getTypeConverter()->convertType(op->getResult(0).getType());
+    if (!resultType)
+      return failure();
+
+    SmallVector<Value, 4> operands(adaptor.getOperands());
+    auto i32Type = rewriter.getI32Type();
+    for (int32_t imm : Derived::getImmediates(op))
+      operands.push_back(rewriter.create<LLVM::ConstantOp>(
+          op->getLoc(), i32Type, rewriter.getI32IntegerAttr(imm)));
+
+    auto func = getOrInsertIntrinsic(
+        rewriter, op->template getParentOfType<ModuleOp>(),
+        Derived::getIntrinsicName(op), resultType,
+        ValueRange(operands).getTypes());
+    rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, func, operands);
+    return success();
+  }
+};
+
+static std::string getAIE2IntrinsicName(StringRef baseName, Value value) {
+  return ("llvm.aie2." + baseName + "." +
+          getVectorTypeString(cast<VectorType>(value.getType()), true))
+      .str();
+}
+
+class AddElemOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::AddElemOp,
+                                       AddElemOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::AddElemOp op) {
+    return getAIE2IntrinsicName("add.elem", op.getResult());
+  }
+};
+
+class SubElemOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::SubElemOp,
+                                       SubElemOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::SubElemOp op) {
+    return getAIE2IntrinsicName("sub.elem", op.getResult());
+  }
+};
+
+class MulElemOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::MulElemOp,
+                                       MulElemOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::MulElemOp op) {
+    return getAIE2IntrinsicName("mul.elem", op.getLhs()) + "." +
+           getVectorTypeString(cast<VectorType>(op.getResult().getType()),
+                               false, true);
   }
 };
 
 class FMAElemOpConversion
-    : public mlir::ConvertOpToLLVMPattern<aievec::FMAElemOp> {
+    : public AIE2IntrinsicOpConversion<aievec::FMAElemOp,
+                                       FMAElemOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::FMAElemOp op) {
+    return getAIE2IntrinsicName(op.getFmsub() ? "msc.elem" : "mac.elem",
+                                op.getLhs()) +
+           "." +
+           getVectorTypeString(cast<VectorType>(op.getResult().getType()),
+                               false, true);
+  }
+};
+
+class MulConvOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::MulConvOp,
+                                       MulConvOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::MulConvOp op) {
+    std::stringstream ss;
+    ss << "mul.conv." << op.getM() << "x" << op.getN();
+    return getAIE2IntrinsicName(ss.str(), op.getLhs());
+  }
+};
+
+class FMAConvOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::FMAConvOp,
+                                       FMAConvOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::FMAConvOp op) {
+    std::stringstream ss;
+    ss << (op.getFmsub() ? "msc" : "mac") << ".conv." << op.getM() << "x"
+       << op.getN();
+    return getAIE2IntrinsicName(ss.str(), op.getLhs());
+  }
+};
+
+class MatMulOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::MatMulOp, MatMulOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::MatMulOp op) {
+    std::stringstream ss;
+    ss << "mac." << op.getM() << "x" << op.getK() << "x" << op.getN();
+    return getAIE2IntrinsicName(ss.str(), op.getLhs());
+  }
+};
+
+class MinOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::MinOp, MinOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::MinOp op) {
+    return getAIE2IntrinsicName("vmin", op.getResult());
+  }
+};
+
+class MaxOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::MaxOp, MaxOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::MaxOp op) {
+    return getAIE2IntrinsicName("vmax", op.getResult());
+  }
+};
+
+class CmpOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::CmpOp, CmpOpConversion> {
 public:
-  using ConvertOpToLLVMPattern<aievec::FMAElemOp>::ConvertOpToLLVMPattern;
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  // The predicate selects the intrinsic, e.g. llvm.aie2.vslt.v16i32
+  static std::string getIntrinsicName(aievec::CmpOp op) {
+    return getAIE2IntrinsicName(("v" + op.getPred()).str(), op.getLhs());
+  }
+};
+
+class SelOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::SelOp, SelOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::SelOp op) {
+    return getAIE2IntrinsicName("vsel", op.getResult());
+  }
+};
+
+class ShiftOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::ShiftOp, ShiftOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::ShiftOp op) {
+    return getAIE2IntrinsicName("vshift", op.getResult());
+  }
+};
+
+class ShuffleOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::ShuffleOp,
+                                       ShuffleOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::ShuffleOp op) {
+    return getAIE2IntrinsicName("vshuffle", op.getResult());
+  }
+
+  static SmallVector<int32_t> getImmediates(aievec::ShuffleOp op) {
+    return {(int32_t)op.getMode()};
+  }
+};
+
+class ExtElemOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::ExtElemOp,
+                                       ExtElemOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::ExtElemOp op) {
+    return getAIE2IntrinsicName("vextract.elem", op.getSource());
+  }
+};
+
+class BroadcastOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::BroadcastOp,
+                                       BroadcastOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::BroadcastOp op) {
+    return getAIE2IntrinsicName("vbroadcast", op.getResult());
+  }
+
+  static SmallVector<int32_t> getImmediates(aievec::BroadcastOp op) {
+    return {(int32_t)op.getIdx()};
+  }
+};
+
+class BroadcastScalarOpConversion
+    : public AIE2IntrinsicOpConversion<aievec::BroadcastScalarOp,
+                                       BroadcastScalarOpConversion> {
+public:
+  using AIE2IntrinsicOpConversion::AIE2IntrinsicOpConversion;
+
+  static std::string getIntrinsicName(aievec::BroadcastScalarOp op) {
+    return getAIE2IntrinsicName("vbroadcast.scalar", op.getResult());
+  }
+};
+
+// The vector and accumulator registers hold the same LLVM types, so a cast
+// only forwards its source.
+class CastOpConversion : public mlir::ConvertOpToLLVMPattern<aievec::CastOp> {
+public:
+  using ConvertOpToLLVMPattern<aievec::CastOp>::ConvertOpToLLVMPattern;
 
   LogicalResult
-  matchAndRewrite(aievec::FMAElemOp op, OpAdaptor adaptor,
+  matchAndRewrite(aievec::CastOp op, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
-    op.emitWarning() << "aie.mac_elem conversion is not implemented\n";
-    return failure();
+    rewriter.replaceOp(op, adaptor.getSource());
+    return success();
   }
 };
 
@@ -731,7 +1035,22 @@ void populateAIEVecToLLVMConversionPatterns(mlir::LLVMTypeConverter &converter,
                PackOpConversion,
                UnpackOpConversion,
                BroadcastOpConversion,
-               FMAElemOpConversion>(converter);
+               BroadcastScalarOpConversion,
+               AddElemOpConversion,
+               SubElemOpConversion,
+               MulElemOpConversion,
+               FMAElemOpConversion,
+               MulConvOpConversion,
+               FMAConvOpConversion,
+               MatMulOpConversion,
+               MinOpConversion,
+               MaxOpConversion,
+               CmpOpConversion,
+               SelOpConversion,
+               ShiftOpConversion,
+               ShuffleOpConversion,
+               ExtElemOpConversion,
+               CastOpConversion>(converter);
   // clang-format on
 }
 
@@ -23,4 +23,37 @@ using namespace ADF;
 
 // Provide the autogenerated implementation guts for the Op classes.
 #define GET_OP_CLASSES
-#include "aie/Dialect/ADF/ADF.cpp.inc"
\ No newline at end of file
+#include "aie/Dialect/ADF/ADF.cpp.inc"
+LogicalResult KernelOp::verify() {
+  if (auto tile = getTile())
+    if (tile->size() != 2)
+      return emitOpError("tile must be a (col, row) pair");
+  if (auto ratio = getRuntimeRatio())
+    if (ratio->convertToDouble() <= 0 || ratio->convertToDouble() > 1)
+      return emitOpError("runtime_ratio must be in (0, 1]");
+  auto verifyBuffers = [&](std::optional<ArrayAttr> buffers, unsigned ports,
+                           StringRef name) -> LogicalResult {
+    if (!buffers)
+      return success();
+    if (buffers->size() != ports)
+      return emitOpError() << name << " must have one entry per port";
+    for (auto banks : buffers->getAsRange<DenseI32ArrayAttr>())
+      if (banks.size() != 0 && banks.size() != 3 && banks.size() != 6)
+        return emitOpError()
+               << name << " entries must hold zero, one or two (col, row, "
+               << "bank) triples";
+    return success();
+  };
+  if (failed(verifyBuffers(getInBufferLocations(), getKernelInputs().size(),
+                           "in_buffer_locations")) ||
+      failed(verifyBuffers(getOutBufferLocations(), getNumResults(),
+                           "out_buffer_locations")))
+    return failure();
+  if (auto depths = getFifoDepths()) {
+    if (depths->size() != getKernelInputs().size())
+      return emitOpError("fifo_depths must have one entry per input");
+    if (llvm::any_of(*depths, [](int32_t depth) { return depth < 0; }))
+      return emitOpError("fifo_depths must not be negative");
+  }
+  return success();
+}
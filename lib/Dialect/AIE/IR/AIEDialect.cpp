@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Bytecode/BytecodeImplementation.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/DialectImplementation.h"
 #include "mlir/IR/OpDefinition.h"
@@ -18,6 +19,11 @@
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/TypeSwitch.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 using namespace mlir;
 
 // Add TableGen'erated dialect definitions (including constructor)
@@ -65,6 +71,139 @@ struct AIEDialectFoldInterface : public DialectFoldInterface {
   }
 };
 
+// The codes of the attributes and the types of the AIE dialect in bytecode.
+// They are part of the bytecode format: new codes are only ever added.
+enum class AIEAttrCode : uint64_t {
+  DimTuple = 0,
+  DimTupleArray = 1,
+  PadTuple = 2,
+  PadTupleArray = 3,
+};
+enum class AIETypeCode : uint64_t {
+  ObjectFifo = 0,
+  ObjectFifoSubview = 1,
+};
+
+/// The bytecode encoding of the attributes and the types of the AIE dialect,
+/// which are written as varints and nested types instead of the text they
+/// print as and are parsed from.  The tile coordinates and the ports of the
+/// ops are builtin integer attributes, which bytecode already writes as
+/// varints.
+struct AIEBytecodeInterface : public BytecodeDialectInterface {
+  using BytecodeDialectInterface::BytecodeDialectInterface;
+
+  template <typename TupleAttr>
+  static TupleAttr readTuple(DialectBytecodeReader &reader) {
+    uint64_t first, second;
+    if (failed(reader.readVarInt(first)) || failed(reader.readVarInt(second)))
+      return nullptr;
+    return TupleAttr::get(reader.getContext(), first, second);
+  }
+
+  template <typename ArrayAttr, typename TupleAttr>
+  static Attribute readTupleArray(DialectBytecodeReader &reader) {
+    SmallVector<TupleAttr, 4> tuples;
+    if (failed(reader.readList(tuples, [&](TupleAttr &tuple) {
+          tuple = readTuple<TupleAttr>(reader);
+          return success(tuple != nullptr);
+        })))
+      return nullptr;
+    return ArrayAttr::get(reader.getContext(), tuples);
+  }
+
+  Attribute readAttribute(DialectBytecodeReader &reader) const override {
+    using namespace xilinx::AIE;
+    uint64_t code;
+    if (failed(reader.readVarInt(code)))
+      return nullptr;
+    switch (static_cast<AIEAttrCode>(code)) {
+    case AIEAttrCode::DimTuple:
+      return readTuple<DimTupleAttr>(reader);
+    case AIEAttrCode::DimTupleArray:
+      return readTupleArray<DimTupleArrayAttr, DimTupleAttr>(reader);
+    case AIEAttrCode::PadTuple:
+      return readTuple<PadTupleAttr>(reader);
+    case AIEAttrCode::PadTupleArray:
+      return readTupleArray<PadTupleArrayAttr, PadTupleAttr>(reader);
+    }
+    reader.emitError() << "unknown AIE attribute code: " << code;
+    return nullptr;
+  }
+
+  LogicalResult writeAttribute(Attribute attr,
+                               DialectBytecodeWriter &writer) const override {
+    using namespace xilinx::AIE;
+    auto writeCode = [&](AIEAttrCode code) {
+      writer.writeVarInt(static_cast<uint64_t>(code));
+    };
+    return TypeSwitch<Attribute, LogicalResult>(attr)
+        .Case([&](DimTupleAttr tuple) {
+          writeCode(AIEAttrCode::DimTuple);
+          writer.writeVarInt(tuple.getStepsize());
+          writer.writeVarInt(tuple.getWrap());
+          return success();
+        })
+        .Case([&](DimTupleArrayAttr array) {
+          writeCode(AIEAttrCode::DimTupleArray);
+          writer.writeList(array.getValue(), [&](DimTupleAttr tuple) {
+            writer.writeVarInt(tuple.getStepsize());
+            writer.writeVarInt(tuple.getWrap());
+          });
+          return success();
+        })
+        .Case([&](PadTupleAttr tuple) {
+          writeCode(AIEAttrCode::PadTuple);
+          writer.writeVarInt(tuple.getBefore());
+          writer.writeVarInt(tuple.getAfter());
+          return success();
+        })
+        .Case([&](PadTupleArrayAttr array) {
+          writeCode(AIEAttrCode::PadTupleArray);
+          writer.writeList(array.getValue(), [&](PadTupleAttr tuple) {
+            writer.writeVarInt(tuple.getBefore());
+            writer.writeVarInt(tuple.getAfter());
+          });
+          return success();
+        })
+        .Default([](Attribute) { return failure(); });
+  }
+
+  Type readType(DialectBytecodeReader &reader) const override {
+    using namespace xilinx::AIE;
+    uint64_t code;
+    Type elementType;
+    if (failed(reader.readVarInt(code)) ||
+        failed(reader.readType(elementType)))
+      return nullptr;
+    switch (static_cast<AIETypeCode>(code)) {
+    case AIETypeCode::ObjectFifo:
+      return AIEObjectFifoType::get(elementType);
+    case AIETypeCode::ObjectFifoSubview:
+      return AIEObjectFifoSubviewType::get(elementType);
+    }
+    reader.emitError() << "unknown AIE type code: " << code;
+    return nullptr;
+  }
+
+  LogicalResult writeType(Type type,
+                          DialectBytecodeWriter &writer) const override {
+    using namespace xilinx::AIE;
+    return TypeSwitch<Type, LogicalResult>(type)
+        .Case([&](AIEObjectFifoType fifoType) {
+          writer.writeVarInt(static_cast<uint64_t>(AIETypeCode::ObjectFifo));
+          writer.writeType(fifoType.getElementType());
+          return success();
+        })
+        .Case([&](AIEObjectFifoSubviewType subviewType) {
+          writer.writeVarInt(
+              static_cast<uint64_t>(AIETypeCode::ObjectFifoSubview));
+          writer.writeType(subviewType.getElementType());
+          return success();
+        })
+        .Default([](Type) { return failure(); });
+  }
+};
+
 } // end anonymous namespace
 
 namespace xilinx {
@@ -75,6 +214,11 @@ static xilinx::AIE::VE2302TargetModel VE2302model;
 static xilinx::AIE::VE2802TargetModel VE2802model;
 
 const xilinx::AIE::AIETargetModel &getTargetModel(Operation *op) {
+  // Most ops live directly in the device, check it before walking up through
+  // the interface.
+  if (auto device =
+          dyn_cast_or_null<xilinx::AIE::DeviceOp>(op->getParentOp()))
+    return device.getTargetModel();
   if (auto t = dyn_cast<xilinx::AIE::AIETarget>(op))
     return t.getTargetModel();
   if (auto t = op->getParentOfType<xilinx::AIE::AIETarget>())
@@ -349,7 +493,8 @@ void AIEDialect::initialize() {
 #define GET_OP_LIST
 #include "aie/Dialect/AIE/IR/AIE.cpp.inc"
       >();
-  addInterfaces<AIEInlinerInterface, AIEDialectFoldInterface>();
+  addInterfaces<AIEInlinerInterface, AIEDialectFoldInterface,
+                AIEBytecodeInterface>();
 }
 
 } // namespace AIE
@@ -430,6 +575,31 @@ LogicalResult xilinx::AIE::ObjectFifoCreateOp::verify() {
                          "and for each consumer.");
   }
 
+  if ((getDimensionsToStream() || getDimensionsFromStream()) &&
+      xilinx::AIE::getTargetModel(*this).getTargetArch() ==
+          xilinx::AIE::AIEArch::AIE1)
+    return emitOpError("data layout transformations are only supported on "
+                       "AIE2 devices.");
+
+  if (getPaddingToStream()) {
+    if (!getDimensionsToStream())
+      return emitOpError("padding needs the dimensions of toStream.");
+    if (!getProducerTileOp().isMemTile())
+      return emitOpError("padding is only supported for memtile producers.");
+  }
+  if (getCompression()) {
+    if (xilinx::AIE::getTargetModel(*this).getTargetArch() ==
+        xilinx::AIE::AIEArch::AIE1)
+      return emitOpError("compression is only supported on AIE2 devices.");
+    if (getProducerTileOp().isShimTile() ||
+        llvm::any_of(getConsumerTiles(), [](Value tile) {
+          return cast<xilinx::AIE::TileOp>(tile.getDefiningOp()).isShimTile();
+        }))
+      return emitOpError("compression is not supported by shim DMAs.");
+  }
+  if (getRepeatCount() && !getProducerTileOp().isMemTile())
+    return emitOpError("repeatCount is only supported for memtile producers.");
+
   return success();
 }
 xilinx::AIE::TileOp xilinx::AIE::ObjectFifoCreateOp::getProducerTileOp() {
@@ -710,19 +880,204 @@ xilinx::AIE::ObjectFifoRegisterProcessOp::getObjectFifo() {
   return ObjectFifoCreateOp();
 }
 
-const xilinx::AIE::AIETargetModel &xilinx::AIE::DeviceOp::getTargetModel() {
-  switch (getDevice()) {
-  case AIEDevice::xcvc1902:
-    return VC1902model;
-  case AIEDevice::xcve2302:
-    return VE2302model;
-  case AIEDevice::xcve2802:
-    return VE2802model;
+// StreamFifoCreateOp
+LogicalResult xilinx::AIE::StreamFifoCreateOp::verify() {
+  if (getConsumerTiles().empty())
+    return emitOpError("must have at least one consumer tile");
+  const auto &targetModel = xilinx::AIE::getTargetModel(*this);
+  auto isCoreTile = [&](Value tile) {
+    auto tileOp = dyn_cast_or_null<xilinx::AIE::TileOp>(tile.getDefiningOp());
+    return tileOp &&
+           targetModel.isCoreTile(tileOp.colIndex(), tileOp.rowIndex());
+  };
+  if (!isCoreTile(getProducerTile()))
+    return emitOpError("producer must be a core tile");
+  for (auto consumerTile : getConsumerTiles()) {
+    if (!isCoreTile(consumerTile))
+      return emitOpError("consumers must be core tiles");
+    if (consumerTile == getProducerTile())
+      return emitOpError("producer cannot also be a consumer");
   }
-  return VC1902model;
+  return success();
+}
+xilinx::AIE::TileOp xilinx::AIE::StreamFifoCreateOp::getProducerTileOp() {
+  return cast<xilinx::AIE::TileOp>(getProducerTile().getDefiningOp());
+}
+
+static xilinx::AIE::StreamFifoCreateOp lookupStreamFifo(Operation *op,
+                                                        StringRef name) {
+  if (auto device = op->getParentOfType<xilinx::AIE::DeviceOp>())
+    return dyn_cast_or_null<xilinx::AIE::StreamFifoCreateOp>(
+        mlir::SymbolTable::lookupSymbolIn(device, name));
+  return xilinx::AIE::StreamFifoCreateOp();
+}
+
+// StreamFifoPutOp
+LogicalResult xilinx::AIE::StreamFifoPutOp::verify() {
+  auto parent = getOperation()->getParentOfType<CoreOp>();
+  if (parent == nullptr)
+    return emitOpError("must be called from inside a CoreOp");
+  auto streamFifo = getStreamFifo();
+  if (!streamFifo)
+    return emitOpError("does not refer to a streamFifo");
+  if (parent.getTile() != streamFifo.getProducerTile())
+    return emitOpError("must be called from the core of the producer tile");
+  if (getValue().getType() != streamFifo.getElemType())
+    return emitOpError("value type must be the element type of the "
+                       "streamFifo");
+  return success();
+}
+xilinx::AIE::StreamFifoCreateOp xilinx::AIE::StreamFifoPutOp::getStreamFifo() {
+  return lookupStreamFifo(*this, getStreamFifoName());
+}
+
+// StreamFifoGetOp
+LogicalResult xilinx::AIE::StreamFifoGetOp::verify() {
+  auto parent = getOperation()->getParentOfType<CoreOp>();
+  if (parent == nullptr)
+    return emitOpError("must be called from inside a CoreOp");
+  auto streamFifo = getStreamFifo();
+  if (!streamFifo)
+    return emitOpError("does not refer to a streamFifo");
+  if (!llvm::is_contained(streamFifo.getConsumerTiles(), parent.getTile()))
+    return emitOpError("must be called from the core of a consumer tile");
+  if (getValue().getType() != streamFifo.getElemType())
+    return emitOpError("value type must be the element type of the "
+                       "streamFifo");
+  return success();
+}
+xilinx::AIE::StreamFifoCreateOp xilinx::AIE::StreamFifoGetOp::getStreamFifo() {
+  return lookupStreamFifo(*this, getStreamFifoName());
+}
+
+// RtpOp
+LogicalResult xilinx::AIE::RtpOp::verify() {
+  auto tile = getTileOp();
+  if (tile.isShimTile() || tile.isMemTile())
+    return emitOpError("must be on a core tile");
+  auto type = getElemType().cast<MemRefType>();
+  int64_t bits = type.getNumElements() * type.getElementTypeBitWidth();
+  // The host writes the copies and the cores read them by words.
+  if (bits == 0 || bits % 32)
+    return emitOpError("block must be a whole number of 32-bit words");
+  return success();
+}
+xilinx::AIE::TileOp xilinx::AIE::RtpOp::getTileOp() {
+  return cast<xilinx::AIE::TileOp>(getTile().getDefiningOp());
+}
+
+// RtpGetOp
+LogicalResult xilinx::AIE::RtpGetOp::verify() {
+  auto parent = getOperation()->getParentOfType<CoreOp>();
+  if (parent == nullptr)
+    return emitOpError("must be called from inside a CoreOp");
+  auto rtp = getRtp();
+  if (!rtp)
+    return emitOpError("does not refer to an rtp");
+  if (getBlock().getType() != rtp.getElemType())
+    return emitOpError("result type must be the type of the rtp block");
+  auto core = parent.getTileOp();
+  auto tile = rtp.getTileOp();
+  if (!getTargetModel(*this).isLegalMemAffinity(
+          core.colIndex(), core.rowIndex(), tile.colIndex(), tile.rowIndex()))
+    return emitOpError("core cannot access the memory of the rtp block");
+  return success();
+}
+xilinx::AIE::RtpOp xilinx::AIE::RtpGetOp::getRtp() {
+  if (auto device = (*this)->getParentOfType<xilinx::AIE::DeviceOp>())
+    return dyn_cast_or_null<xilinx::AIE::RtpOp>(
+        mlir::SymbolTable::lookupSymbolIn(device, getRtpName()));
+  return xilinx::AIE::RtpOp();
+}
+
+// GetStreamOp
+LogicalResult xilinx::AIE::GetStreamOp::verify() {
+  if (!getOperation()->getParentOfType<CoreOp>())
+    return emitOpError("must be called from inside a CoreOp");
+  return success();
+}
+
+// PutStreamOp
+LogicalResult xilinx::AIE::PutStreamOp::verify() {
+  if (!getOperation()->getParentOfType<CoreOp>())
+    return emitOpError("must be called from inside a CoreOp");
+  return success();
+}
+
+// TimestampOp
+LogicalResult xilinx::AIE::TimestampOp::verify() {
+  if (!getOperation()->getParentOfType<CoreOp>())
+    return emitOpError("must be called from inside a CoreOp");
+  auto type = getBuffer().getType().cast<MemRefType>();
+  if (type.getRank() != 1 || !type.getElementType().isInteger(32))
+    return emitOpError("expects a buffer of rank 1 of i32, got ") << type;
+  return success();
 }
 
-LogicalResult xilinx::AIE::DeviceOp::verify() { return success(); }
+static const xilinx::AIE::AIETargetModel &
+getDeviceModel(xilinx::AIE::AIEDevice device) {
+  switch (device) {
+  case xilinx::AIE::AIEDevice::xcvc1902:
+    return xilinx::AIE::VC1902model;
+  case xilinx::AIE::AIEDevice::xcve2302:
+    return xilinx::AIE::VE2302model;
+  case xilinx::AIE::AIEDevice::xcve2802:
+    return xilinx::AIE::VE2802model;
+  }
+  return xilinx::AIE::VC1902model;
+}
+
+// Return the model of a partition of the given device.  The models are built
+// on first use and kept for the lifetime of the process, so that they are
+// shared by all the devices of a module, and by the threads verifying them.
+static const xilinx::AIE::AIETargetModel &
+getPartitionModel(xilinx::AIE::AIEDevice device, int startCol, int numCols) {
+  static std::mutex mutex;
+  static std::map<std::tuple<xilinx::AIE::AIEDevice, int, int>,
+                  std::unique_ptr<xilinx::AIE::AIETargetModel>>
+      models;
+  std::lock_guard<std::mutex> guard(mutex);
+  auto &model = models[{device, startCol, numCols}];
+  if (!model) {
+    switch (device) {
+    case xilinx::AIE::AIEDevice::xcvc1902:
+      model = std::make_unique<xilinx::AIE::VC1902TargetModel>(startCol,
+                                                              numCols);
+      break;
+    case xilinx::AIE::AIEDevice::xcve2302:
+      model = std::make_unique<xilinx::AIE::VE2302TargetModel>(startCol,
+                                                              numCols);
+      break;
+    case xilinx::AIE::AIEDevice::xcve2802:
+      model = std::make_unique<xilinx::AIE::VE2802TargetModel>(startCol,
+                                                              numCols);
+      break;
+    }
+  }
+  return *model;
+}
+
+const xilinx::AIE::AIETargetModel &xilinx::AIE::DeviceOp::getTargetModel() {
+  if (getStartCol() && getNumCols())
+    return getPartitionModel(getDevice(), *getStartCol(), *getNumCols());
+  return getDeviceModel(getDevice());
+}
+
+LogicalResult xilinx::AIE::DeviceOp::verify() {
+  if (!getStartCol() && !getNumCols())
+    return success();
+  if (!getStartCol() || !getNumCols())
+    return emitOpError("partition needs both a start column and a number of "
+                       "columns");
+  int columns = getDeviceModel(getDevice()).columns();
+  int startCol = *getStartCol(), numCols = *getNumCols();
+  if (startCol < 0 || numCols <= 0 || startCol + numCols > columns)
+    return emitOpError("partition (")
+           << startCol << ", " << numCols
+           << ") must be within the columns of the device (" << columns
+           << ")";
+  return success();
+}
 
 LogicalResult xilinx::AIE::TileOp::verify() {
   const auto &target_model = getTargetModel(*this);
@@ -944,6 +1299,9 @@ LogicalResult xilinx::AIE::ShimDMAOp::verify() {
     return result;
   }
 
+  if (failed(verifyDMABlockLocks(*this)))
+    return failure();
+
   return success();
 }
 xilinx::AIE::TileOp xilinx::AIE::ShimDMAOp::getTileOp() {
@@ -977,6 +1335,50 @@ LogicalResult xilinx::AIE::PacketFlowOp::verify() {
   return success();
 }
 
+// CascadeFlowOp
+xilinx::AIE::TileOp xilinx::AIE::CascadeFlowOp::getSourceTileOp() {
+  return dyn_cast_or_null<xilinx::AIE::TileOp>(getSource().getDefiningOp());
+}
+
+xilinx::AIE::TileOp xilinx::AIE::CascadeFlowOp::getDestTileOp() {
+  return dyn_cast_or_null<xilinx::AIE::TileOp>(getDest().getDefiningOp());
+}
+
+LogicalResult xilinx::AIE::CascadeFlowOp::verify() {
+  xilinx::AIE::TileOp source = getSourceTileOp();
+  xilinx::AIE::TileOp dest = getDestTileOp();
+  if (!source || !dest)
+    return emitOpError("source and dest must be tiles");
+  if (source == dest)
+    return emitOpError("cannot cascade a core to itself");
+  // Only the flows before this one are compared, so that a conflict is
+  // reported once.
+  for (Operation *prev = (*this)->getPrevNode(); prev;
+       prev = prev->getPrevNode()) {
+    auto other = dyn_cast<xilinx::AIE::CascadeFlowOp>(prev);
+    if (!other)
+      continue;
+    if (other.getSource() == getSource())
+      return emitOpError("source tile already has a cascade output");
+    if (other.getDest() == getDest())
+      return emitOpError("dest tile already has a cascade input");
+  }
+
+  // The tiles left for aie-place-tiles have no position yet.
+  if (source->hasAttr("unplaced") || dest->hasAttr("unplaced"))
+    return success();
+  const auto &targetModel = xilinx::AIE::getTargetModel(*this);
+  if (!targetModel.isCoreTile(source.colIndex(), source.rowIndex()) ||
+      !targetModel.isCoreTile(dest.colIndex(), dest.rowIndex()))
+    return emitOpError("source and dest must be core tiles");
+  if (!targetModel.isLegalCascade(source.getTileID(), dest.getTileID()))
+    return emitOpError("tile (")
+           << source.colIndex() << ", " << source.rowIndex()
+           << ") cannot cascade to tile (" << dest.colIndex() << ", "
+           << dest.rowIndex() << ")";
+  return success();
+}
+
 // CoreOp
 LogicalResult xilinx::AIE::CoreOp::verify() {
   if (getBody().empty())
@@ -985,9 +1387,41 @@ LogicalResult xilinx::AIE::CoreOp::verify() {
     return emitOpError("CoreOp cannot be created on shim tile, i.e. row == 0");
   if (getTileOp().isMemTile())
     return emitOpError("CoreOp cannot be created on mem tile");
+  if (auto size = (*this)->getAttrOfType<IntegerAttr>("overlay_size")) {
+    int64_t programSize = getTargetModel(*this).getProgramMemorySize();
+    // The program memory is made of 128-bit words.
+    if (size.getInt() <= 0 || size.getInt() % 16 ||
+        size.getInt() >= programSize)
+      return emitOpError("overlay_size must be a positive multiple of 16 "
+                         "smaller than the ")
+             << programSize << " bytes of program memory";
+  }
   return success();
 }
 
+std::map<int64_t, SmallVector<func::FuncOp, 4>>
+xilinx::AIE::CoreOp::getOverlays() {
+  std::map<int64_t, SmallVector<func::FuncOp, 4>> overlays;
+  getBody().walk([&](func::CallOp call) {
+    auto callee = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+        call, call.getCalleeAttr());
+    if (!callee)
+      return;
+    if (auto overlay = callee->getAttrOfType<IntegerAttr>("aie.overlay")) {
+      auto &funcs = overlays[overlay.getInt()];
+      if (!llvm::is_contained(funcs, callee))
+        funcs.push_back(callee);
+    }
+  });
+  return overlays;
+}
+
+uint32_t xilinx::AIE::CoreOp::getOverlaySize() {
+  if (auto size = (*this)->getAttrOfType<IntegerAttr>("overlay_size"))
+    return size.getInt();
+  return 0x1000;
+}
+
 int xilinx::AIE::CoreOp::colIndex() { return getTileOp().colIndex(); }
 
 int xilinx::AIE::CoreOp::rowIndex() { return getTileOp().rowIndex(); }
@@ -1000,6 +1434,22 @@ int64_t xilinx::AIE::BufferOp::getAllocationSize() {
   MemRefType type = getType().cast<MemRefType>();
   return type.getNumElements() * type.getElementTypeBitWidth() / 8;
 }
+std::optional<int64_t> xilinx::AIE::BufferOp::getBank() {
+  auto address = getOperation()->getAttrOfType<IntegerAttr>("address");
+  if (!address)
+    return std::nullopt;
+  TileOp tile = getTileOp();
+  const auto &target_model = getTargetModel(tile);
+  int64_t size = tile.isMemTile() ? target_model.getMemTileSize()
+                                  : target_model.getLocalMemorySize();
+  int64_t bankSize =
+      size / target_model.getNumBanks(tile.getCol(), tile.getRow());
+  int64_t start = address.getInt();
+  int64_t end = start + std::max<int64_t>(getAllocationSize(), 1) - 1;
+  if (start / bankSize != end / bankSize)
+    return std::nullopt;
+  return start / bankSize;
+}
 xilinx::AIE::TileOp xilinx::AIE::BufferOp::getTileOp() {
   return cast<xilinx::AIE::TileOp>(getTile().getDefiningOp());
 }
@@ -1010,6 +1460,43 @@ LogicalResult xilinx::AIE::BufferOp::verify() {
   return success();
 }
 
+// Check the locks used by each block of a DMA-like op (e.g. MemOp,
+// ShimDMAOp): a block acquires and releases its locks from and to a single
+// state and, on AIE1, uses a single lock. The checks look at the whole block,
+// so they are run once per block here rather than from each UseLockOp.
+static LogicalResult verifyDMABlockLocks(Operation *op) {
+  const auto &target_model = xilinx::AIE::getTargetModel(op);
+  bool oneLock = target_model.getTargetArch() == xilinx::AIE::AIEArch::AIE1;
+  for (auto &block : op->getRegion(0)) {
+    auto useLocks = block.getOps<xilinx::AIE::UseLockOp>();
+    if (useLocks.empty())
+      continue;
+    xilinx::AIE::UseLockOp first = *useLocks.begin();
+    int lockID = -1, acqValue = -1, relValue = -1;
+    for (auto useLock : useLocks) {
+      auto lock = useLock.getLockOp();
+      if (oneLock && lock && lock.getLockID().has_value()) {
+        if (lockID != -1 && lockID != lock.getLockIDValue())
+          return first.emitOpError(
+              "used in a DMA block that have multiple locks.");
+        lockID = lock.getLockIDValue();
+      }
+      int *value = nullptr;
+      if (useLock.acquire() || useLock.acquire_ge())
+        value = &acqValue;
+      else if (useLock.release())
+        value = &relValue;
+      if (value) {
+        if (*value != -1 && *value != useLock.getLockValue())
+          return first.emitOpError("acquires/releases the lock in a DMA "
+                                   "block from/to multiple states.");
+        *value = useLock.getLockValue();
+      }
+    }
+  }
+  return success();
+}
+
 // MemOp
 LogicalResult xilinx::AIE::MemOp::verify() {
   Region &body = getBody();
@@ -1024,6 +1511,9 @@ LogicalResult xilinx::AIE::MemOp::verify() {
     return result;
   }
 
+  if (failed(verifyDMABlockLocks(*this)))
+    return failure();
+
   for (auto &bodyOp : body.getOps()) {
     // check for duplicate DMA channels within the same MemOp
     if (auto DMA_start = dyn_cast<xilinx::AIE::DMAStartOp>(bodyOp)) {
@@ -1073,6 +1563,9 @@ LogicalResult xilinx::AIE::MemTileDMAOp::verify() {
     return result;
   }
 
+  if (failed(verifyDMABlockLocks(*this)))
+    return failure();
+
   for (auto &bodyOp : getBody().getOps()) {
     if (auto allocOp = dyn_cast<memref::AllocOp>(bodyOp)) {
       if (!allocOp->getAttr("id"))
@@ -1205,6 +1698,55 @@ LogicalResult xilinx::AIE::DMABDOp::verify() {
                            << std::to_string(memref_size) << ".";
     }
   }
+
+  if (!getPadding() && !getCompression())
+    return success();
+  Operation *parentOp = (*this)->getParentOp();
+  if (xilinx::AIE::getTargetModel(*this).getTargetArch() ==
+          xilinx::AIE::AIEArch::AIE1 ||
+      isa_and_nonnull<xilinx::AIE::ShimDMAOp>(parentOp))
+    return emitOpError("padding and compression are only supported by the "
+                       "core tile and memtile DMAs of AIE-ML devices.");
+
+  if (auto padding = getPadding()) {
+    if (!isa_and_nonnull<xilinx::AIE::MemTileDMAOp>(parentOp))
+      return emitOpError("padding is only supported by memtile DMAs.");
+    if (!getDimensions() || getDimensions()->size() != padding->size())
+      return emitOpError("padding needs one <before, after> tuple for each "
+                         "of the dimensions of the BD.");
+    if (padding->size() > 3)
+      return emitOpError("at most 3 dimensions can be padded.");
+    // The pads of the lowest dimension, the last one, have 6 bits, and
+    // those of each higher dimension one bit less.
+    for (size_t i = 0, e = padding->size(); i < e; i++) {
+      auto pad = (*padding)[e - 1 - i];
+      unsigned maxPad = (1u << (6 - i)) - 1;
+      if (pad.getBefore() > maxPad || pad.getAfter() > maxPad)
+        return emitOpError("cannot pad dimension ")
+               << e - 1 - i << " with more than " << maxPad
+               << " zeros on each side.";
+    }
+    // Only the MM2S channels insert the zeros into the stream.
+    for (auto &block : parentOp->getRegion(0))
+      for (auto start : block.getOps<xilinx::AIE::DMAStartOp>()) {
+        if (start.getChannelDir() != xilinx::AIE::DMAChannelDir::S2MM)
+          continue;
+        llvm::SmallPtrSet<Block *, 16> visited;
+        for (Block *bd = start.getDest(); bd && visited.insert(bd).second;
+             bd = bd->getNumSuccessors() ? bd->getSuccessor(0) : nullptr)
+          if (bd == (*this)->getBlock())
+            return emitOpError("padding is only supported on MM2S channels.");
+      }
+    // The zeros are part of the stream, so the length of the BD counts them.
+    int64_t padded = 1;
+    for (size_t i = 0, e = padding->size(); i < e; i++)
+      padded *= (*getDimensions())[i].getWrap() + (*padding)[i].getBefore() +
+                (*padding)[i].getAfter();
+    if (padded > getLen())
+      return emitOpError("pads the tensor to ")
+             << padded << " elements, more than the " << getLen()
+             << " of the BD.";
+  }
   return success();
 }
 
@@ -1282,43 +1824,6 @@ struct UsesReachableLock {
   }
 };
 
-struct UsesOneLockInDMABlock {
-  static LogicalResult verifyTrait(Operation *op) {
-    auto block = op->getBlock();
-    int lockID = -1;
-    for (auto op : block->getOps<xilinx::AIE::UseLockOp>()) {
-      auto lock = dyn_cast<xilinx::AIE::LockOp>(op.getLock().getDefiningOp());
-      if (lock.getLockID().has_value()) {
-        if (lockID != -1 && lockID != lock.getLockIDValue())
-          return failure();
-        lockID = lock.getLockIDValue();
-      }
-    }
-    return success();
-  }
-};
-
-struct AcquireReleaseOneStateInDMABlock {
-  static LogicalResult verifyTrait(Operation *op) {
-    auto block = op->getBlock();
-    int acqValue = -1, relValue = -1;
-    for (auto op : block->getOps<xilinx::AIE::UseLockOp>()) {
-      if (op.acquire() || op.acquire_ge()) {
-        if (acqValue != -1 && acqValue != op.getLockValue()) {
-          return failure();
-        }
-        acqValue = op.getLockValue();
-      } else if (op.release()) {
-        if (relValue != -1 && relValue != op.getLockValue()) {
-          return failure();
-        }
-        relValue = op.getLockValue();
-      }
-    }
-    return success();
-  }
-};
-
 struct AccessesLocalLocks {
   static LogicalResult verifyTrait(Operation *op) {
     if (auto memOp = op->getParentOfType<xilinx::AIE::MemOp>()) {
@@ -1351,15 +1856,8 @@ LogicalResult xilinx::AIE::UseLockOp::verify() {
     if (!(*this)->getBlock())
       return (*this)->emitOpError("is not in a block.");
 
-    if (target_model.getTargetArch() == xilinx::AIE::AIEArch::AIE1 &&
-        UsesOneLockInDMABlock::verifyTrait(*this).failed())
-      return (*this)->emitOpError(
-          "used in a DMA block that have multiple locks.");
-
-    if (AcquireReleaseOneStateInDMABlock::verifyTrait(*this).failed())
-      return (*this)->emitOpError(
-          "acquires/releases the lock in a DMA block from/to multiple states.");
-
+    // The locks of the whole DMA block are checked once by the verifier of
+    // the DMA op, see verifyDMABlockLocks.
     if (HasSomeParent<xilinx::AIE::MemOp>::verifyTrait(*this).succeeded()) {
       if (AccessesLocalLocks::verifyTrait(*this).failed())
         return (*this)->emitOpError("can only access a lock in the same tile");
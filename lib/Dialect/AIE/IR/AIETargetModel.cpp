@@ -13,12 +13,78 @@
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/SmallSet.h"
 
+#include <algorithm>
+
 using namespace llvm;
 
 namespace xilinx {
 namespace AIE {
+AIETargetModel::AIETargetModel(const AIEDeviceDescription &desc,
+                               int startCol, int numCols)
+    : numRows(desc.rows), deviceColumns(desc.columns),
+      numMemTileRows(desc.memTileRows),
+      nocBytesPerCycle(desc.nocBytesPerCycle) {
+  // Keep the partition inside the device; the verifier of the device op
+  // reports the partitions that are not.
+  partitionStartCol = std::clamp(startCol, 0, deviceColumns - 1);
+  int maxColumns = deviceColumns - partitionStartCol;
+  numColumns = numCols < 0 ? maxColumns : std::clamp(numCols, 1, maxColumns);
+  for (unsigned col : desc.nocColumns)
+    if ((int)col >= partitionStartCol &&
+        (int)col < partitionStartCol + numColumns)
+      nocColumns.insert(col - partitionStartCol);
+}
+
 AIETargetModel::~AIETargetModel() {}
 
+AIETargetModel::TileKind AIETargetModel::computeTileKind(int col,
+                                                         int row) const {
+  if (row < 0)
+    return TileKind::None;
+  if (row == 0)
+    return col >= 0 && nocColumns.contains(col) ? TileKind::ShimNOC
+                                                : TileKind::ShimPL;
+  if (row <= (int)numMemTileRows)
+    return TileKind::Mem;
+  return TileKind::Core;
+}
+
+void AIETargetModel::buildTables() {
+  // The kinds of all tiles go first: the rules of the architecture ask for
+  // the kinds of the tiles they describe.
+  tiles.assign(numColumns * numRows, TileInfo());
+  for (int col = 0; col < numColumns; col++)
+    for (int row = 0; row < numRows; row++)
+      tiles[col * numRows + row].kind = computeTileKind(col, row);
+
+  for (int col = 0; col < numColumns; col++) {
+    for (int row = 0; row < numRows; row++) {
+      TileInfo &info = tiles[col * numRows + row];
+      for (unsigned i = 0; i < NumBundles; i++) {
+        auto bundle = static_cast<WireBundle>(i);
+        info.destSwitchbox[i] =
+            computeNumDestSwitchboxConnections(col, row, bundle);
+        info.sourceSwitchbox[i] =
+            computeNumSourceSwitchboxConnections(col, row, bundle);
+        info.destShimMux[i] =
+            computeNumDestShimMuxConnections(col, row, bundle);
+        info.sourceShimMux[i] =
+            computeNumSourceShimMuxConnections(col, row, bundle);
+      }
+      TileID src = {col, row};
+      info.mems[West] = computeMemWest(src);
+      info.mems[East] = computeMemEast(src);
+      info.mems[North] = computeMemNorth(src);
+      info.mems[South] = computeMemSouth(src);
+      info.memAffinity = 0;
+      for (int dCol = -1; dCol <= 1; dCol++)
+        for (int dRow = -1; dRow <= 1; dRow++)
+          if (computeLegalMemAffinity(col, row, col + dCol, row + dRow))
+            info.memAffinity |= 1 << ((dCol + 1) * 3 + dRow + 1);
+    }
+  }
+}
+
 ///
 /// AIE1 TargetModel
 ///
@@ -26,7 +92,7 @@ AIETargetModel::~AIETargetModel() {}
 AIEArch AIE1TargetModel::getTargetArch() const { return AIEArch::AIE1; }
 
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE1TargetModel::getMemWest(TileID src) const {
+Optional<TileID> AIE1TargetModel::computeMemWest(TileID src) const {
   bool isEvenRow = ((src.second % 2) == 0);
   Optional<TileID> ret;
   if (isEvenRow)
@@ -38,7 +104,7 @@ Optional<TileID> AIE1TargetModel::getMemWest(TileID src) const {
   return ret;
 }
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE1TargetModel::getMemEast(TileID src) const {
+Optional<TileID> AIE1TargetModel::computeMemEast(TileID src) const {
   bool isEvenRow = ((src.second % 2) == 0);
   Optional<TileID> ret;
   if (isEvenRow)
@@ -50,13 +116,13 @@ Optional<TileID> AIE1TargetModel::getMemEast(TileID src) const {
   return ret;
 }
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE1TargetModel::getMemNorth(TileID src) const {
+Optional<TileID> AIE1TargetModel::computeMemNorth(TileID src) const {
   Optional<TileID> ret = std::make_pair(src.first, src.second + 1);
   if (!isValidTile(*ret))
     ret.reset();
   return ret;
 }
-Optional<TileID> AIE1TargetModel::getMemSouth(TileID src) const {
+Optional<TileID> AIE1TargetModel::computeMemSouth(TileID src) const {
   Optional<TileID> ret = std::make_pair(src.first, src.second - 1);
   // The first row doesn't have a tile memory south
   if (!isValidTile(*ret) || ret->second == 0)
@@ -88,8 +154,21 @@ bool AIE1TargetModel::isMemSouth(int srcCol, int srcRow, int dstCol,
   return isSouth(srcCol, srcRow, dstCol, dstRow);
 }
 
-bool AIE1TargetModel::isLegalMemAffinity(int coreCol, int coreRow, int memCol,
-                                         int memRow) const {
+// The cascade snakes through the array: east along the odd rows, west along
+// the even rows, and north from the last core of each row.
+bool AIE1TargetModel::isLegalCascade(TileID src, TileID dst) const {
+  auto [col, row] = src;
+  if (!isCoreTile(col, row) || !isCoreTile(dst.first, dst.second))
+    return false;
+  int next = row % 2 ? col + 1 : col - 1;
+  int deviceCol = getPartitionStartCol() + next;
+  if (deviceCol >= 0 && deviceCol < getDeviceColumns())
+    return dst == TileID(next, row);
+  return dst == TileID(col, row + 1);
+}
+
+bool AIE1TargetModel::computeLegalMemAffinity(int coreCol, int coreRow,
+                                              int memCol, int memRow) const {
   bool IsEvenRow = ((coreRow % 2) == 0);
 
   bool IsMemWest = (isWest(coreCol, coreRow, memCol, memRow) && !IsEvenRow) ||
@@ -104,8 +183,8 @@ bool AIE1TargetModel::isLegalMemAffinity(int coreCol, int coreRow, int memCol,
   return IsMemSouth || IsMemNorth || IsMemWest || IsMemEast;
 }
 uint32_t
-AIE1TargetModel::getNumDestSwitchboxConnections(int col, int row,
-                                                WireBundle bundle) const {
+AIE1TargetModel::computeNumDestSwitchboxConnections(int col, int row,
+                                                    WireBundle bundle) const {
   if (isShimNOCTile(col, row) || isShimPLTile(col, row))
     switch (bundle) {
     case WireBundle::FIFO:
@@ -124,6 +203,8 @@ AIE1TargetModel::getNumDestSwitchboxConnections(int col, int row,
         return 0;
       else
         return 4;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -152,13 +233,15 @@ AIE1TargetModel::getNumDestSwitchboxConnections(int col, int row,
         return 0;
       else
         return 4;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
 }
 uint32_t
-AIE1TargetModel::getNumSourceSwitchboxConnections(int col, int row,
-                                                  WireBundle bundle) const {
+AIE1TargetModel::computeNumSourceSwitchboxConnections(int col, int row,
+                                                      WireBundle bundle) const {
   if (isShimNOCTile(col, row) || isShimPLTile(col, row))
     switch (bundle) {
     case WireBundle::FIFO:
@@ -179,6 +262,8 @@ AIE1TargetModel::getNumSourceSwitchboxConnections(int col, int row,
         return 4;
     case WireBundle::Trace:
       return 1;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -209,13 +294,15 @@ AIE1TargetModel::getNumSourceSwitchboxConnections(int col, int row,
         return 4;
     case WireBundle::Trace:
       return 2;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
 }
 uint32_t
-AIE1TargetModel::getNumDestShimMuxConnections(int col, int row,
-                                              WireBundle bundle) const {
+AIE1TargetModel::computeNumDestShimMuxConnections(int col, int row,
+                                                  WireBundle bundle) const {
   if (isShimNOCorPLTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
@@ -233,8 +320,8 @@ AIE1TargetModel::getNumDestShimMuxConnections(int col, int row,
     return 0;
 }
 uint32_t
-AIE1TargetModel::getNumSourceShimMuxConnections(int col, int row,
-                                                WireBundle bundle) const {
+AIE1TargetModel::computeNumSourceShimMuxConnections(int col, int row,
+                                                    WireBundle bundle) const {
   if (isShimNOCTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
@@ -259,27 +346,27 @@ AIE1TargetModel::getNumSourceShimMuxConnections(int col, int row,
 AIEArch AIE2TargetModel::getTargetArch() const { return AIEArch::AIE2; }
 
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE2TargetModel::getMemWest(TileID src) const {
+Optional<TileID> AIE2TargetModel::computeMemWest(TileID src) const {
   Optional<TileID> ret = std::make_pair(src.first - 1, src.second);
   if (!isValidTile(*ret))
     ret.reset();
   return ret;
 }
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE2TargetModel::getMemEast(TileID src) const {
+Optional<TileID> AIE2TargetModel::computeMemEast(TileID src) const {
   Optional<TileID> ret = src;
   if (!isValidTile(*ret))
     ret.reset();
   return ret;
 }
 // Return the tile ID of the memory to the west of the given tile, if it exists.
-Optional<TileID> AIE2TargetModel::getMemNorth(TileID src) const {
+Optional<TileID> AIE2TargetModel::computeMemNorth(TileID src) const {
   Optional<TileID> ret = std::make_pair(src.first, src.second + 1);
   if (!isValidTile(*ret))
     ret.reset();
   return ret;
 }
-Optional<TileID> AIE2TargetModel::getMemSouth(TileID src) const {
+Optional<TileID> AIE2TargetModel::computeMemSouth(TileID src) const {
   Optional<TileID> ret = std::make_pair(src.first, src.second - 1);
   // The first row doesn't have a tile memory south
   // Memtiles don't have memory adjacency to neighboring core tiles.
@@ -309,8 +396,16 @@ bool AIE2TargetModel::isMemSouth(int srcCol, int srcRow, int dstCol,
   return isSouth(srcCol, srcRow, dstCol, dstRow);
 }
 
-bool AIE2TargetModel::isLegalMemAffinity(int coreCol, int coreRow, int memCol,
-                                         int memRow) const {
+// The cascade goes from each core to its east or south neighbour.
+bool AIE2TargetModel::isLegalCascade(TileID src, TileID dst) const {
+  auto [col, row] = src;
+  if (!isCoreTile(col, row) || !isCoreTile(dst.first, dst.second))
+    return false;
+  return dst == TileID(col + 1, row) || dst == TileID(col, row - 1);
+}
+
+bool AIE2TargetModel::computeLegalMemAffinity(int coreCol, int coreRow,
+                                              int memCol, int memRow) const {
 
   bool IsMemWest = isMemWest(coreCol, coreRow, memCol, memRow);
   bool IsMemEast = isMemEast(coreCol, coreRow, memCol, memRow);
@@ -326,8 +421,8 @@ bool AIE2TargetModel::isLegalMemAffinity(int coreCol, int coreRow, int memCol,
            IsMemWest || IsMemEast;
 }
 uint32_t
-AIE2TargetModel::getNumDestSwitchboxConnections(int col, int row,
-                                                WireBundle bundle) const {
+AIE2TargetModel::computeNumDestSwitchboxConnections(int col, int row,
+                                                    WireBundle bundle) const {
   if (isMemTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
@@ -336,6 +431,8 @@ AIE2TargetModel::getNumDestSwitchboxConnections(int col, int row,
       return 6;
     case WireBundle::South:
       return 4;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -357,6 +454,8 @@ AIE2TargetModel::getNumDestSwitchboxConnections(int col, int row,
         return 0;
       else
         return 4;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -385,13 +484,15 @@ AIE2TargetModel::getNumDestSwitchboxConnections(int col, int row,
         return 0;
       else
         return 4;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
 }
 uint32_t
-AIE2TargetModel::getNumSourceSwitchboxConnections(int col, int row,
-                                                  WireBundle bundle) const {
+AIE2TargetModel::computeNumSourceSwitchboxConnections(int col, int row,
+                                                      WireBundle bundle) const {
   if (isMemTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
@@ -402,6 +503,8 @@ AIE2TargetModel::getNumSourceSwitchboxConnections(int col, int row,
       return 6;
     case WireBundle::Trace:
       return 1;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -425,6 +528,8 @@ AIE2TargetModel::getNumSourceSwitchboxConnections(int col, int row,
         return 4;
     case WireBundle::Trace:
       return 1;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
@@ -455,13 +560,15 @@ AIE2TargetModel::getNumSourceSwitchboxConnections(int col, int row,
         return 4;
     case WireBundle::Trace:
       return 1;
+    case WireBundle::Ctrl:
+      return 1;
     default:
       return 0;
     }
 }
 uint32_t
-AIE2TargetModel::getNumDestShimMuxConnections(int col, int row,
-                                              WireBundle bundle) const {
+AIE2TargetModel::computeNumDestShimMuxConnections(int col, int row,
+                                                  WireBundle bundle) const {
   if (isShimNOCorPLTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
@@ -479,8 +586,8 @@ AIE2TargetModel::getNumDestShimMuxConnections(int col, int row,
     return 0;
 }
 uint32_t
-AIE2TargetModel::getNumSourceShimMuxConnections(int col, int row,
-                                                WireBundle bundle) const {
+AIE2TargetModel::computeNumSourceShimMuxConnections(int col, int row,
+                                                    WireBundle bundle) const {
   if (isShimNOCTile(col, row))
     switch (bundle) {
     case WireBundle::DMA:
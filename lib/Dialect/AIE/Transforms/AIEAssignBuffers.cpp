@@ -8,13 +8,19 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "aie/Dialect/AIE/AIEDeviceIndex.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/MathExtras.h"
+
+#include <optional>
 
 #define DEBUG_TYPE "aie-assign-buffers"
 
@@ -22,30 +28,381 @@ using namespace mlir;
 using namespace xilinx;
 using namespace xilinx::AIE;
 
-static int64_t assignAddress(AIE::BufferOp op, int64_t lastAddress,
-                             OpBuilder &rewriter) {
-  Operation *Op = op.getOperation();
-  rewriter.setInsertionPointToEnd(Op->getBlock());
+// Vector loads and stores move up to 256 bits at once, and need their
+// address to be aligned to the access size.
+static const int64_t MAX_BUFFER_ALIGNMENT = 32;
+
+static int64_t getAlignment(BufferOp buffer) {
+  return std::min<int64_t>(llvm::PowerOf2Ceil(buffer.getAllocationSize()),
+                           MAX_BUFFER_ALIGNMENT);
+}
+
+namespace {
+
+// The data memory of a tile, as the address ranges which are still free and
+// the buffers placed so far.
+class TileMemory {
+  // free [start, end) ranges, in address order
+  SmallVector<std::pair<int64_t, int64_t>, 8> freeRanges;
+  int64_t size, bankSize, stackSize;
+  // the end of the highest range reserved so far
+  int64_t highWater = 0;
+  DenseMap<Operation *, std::pair<int64_t, int64_t>> placed;
+  // the buffers placed so far, in placement order
+  SmallVector<BufferOp, 8> buffers;
+
+  std::pair<int64_t, int64_t> getBanks(int64_t start, int64_t end) const {
+    return {start / bankSize, (end - 1) / bankSize};
+  }
+
+  // The number of buffers in concurrent which are already placed in one of
+  // the banks of [start, end).
+  int countConflicts(int64_t start, int64_t end,
+                     const SmallPtrSetImpl<Operation *> &concurrent) const {
+    auto banks = getBanks(start, end);
+    int conflicts = 0;
+    for (Operation *other : concurrent) {
+      auto found = placed.find(other);
+      if (found == placed.end())
+        continue;
+      auto otherBanks = getBanks(found->second.first, found->second.second);
+      if (banks.first <= otherBanks.second && otherBanks.first <= banks.second)
+        conflicts++;
+    }
+    return conflicts;
+  }
+
+public:
+  TileMemory(int64_t size, int64_t bankSize, int64_t stackSize)
+      : size(size), bankSize(bankSize), stackSize(stackSize) {
+    freeRanges.push_back({0, size});
+    if (stackSize > 0)
+      reserve(0, stackSize);
+  }
+
+  int64_t getSize() const { return size; }
+  int64_t getStackSize() const { return stackSize; }
+  int64_t getHighWater() const { return highWater; }
+  ArrayRef<BufferOp> getBuffers() const { return buffers; }
+
+  bool isFree(int64_t start, int64_t end) const {
+    for (auto range : freeRanges)
+      if (range.first <= start && end <= range.second)
+        return true;
+    return false;
+  }
+
+  // Remove [start, end) from the free ranges.
+  void reserve(int64_t start, int64_t end) {
+    SmallVector<std::pair<int64_t, int64_t>, 8> remaining;
+    for (auto range : freeRanges) {
+      if (range.first < start)
+        remaining.push_back({range.first, std::min(range.second, start)});
+      if (end < range.second)
+        remaining.push_back({std::max(range.first, end), range.second});
+    }
+    freeRanges = std::move(remaining);
+    highWater = std::max(highWater, end);
+  }
+
+  void place(BufferOp buffer, int64_t start) {
+    int64_t end = start + buffer.getAllocationSize();
+    reserve(start, end);
+    placed[buffer] = {start, end};
+    buffers.push_back(buffer);
+  }
 
-  int64_t startAddr = lastAddress;
-  int64_t endAddr = startAddr + op.getAllocationSize();
-  if (Op->getAttrOfType<IntegerAttr>("address")) {
-    Op->emitWarning("Overriding existing address");
+  // Give buffer the address of leader, which is at least as large.
+  void alias(BufferOp buffer, BufferOp leader) {
+    int64_t start = placed.lookup(leader).first;
+    placed[buffer] = {start, start + buffer.getAllocationSize()};
+    buffers.push_back(buffer);
   }
-  Op->setAttr("address", rewriter.getI32IntegerAttr(startAddr));
-  // Fixme: alignment
-  return endAddr;
+
+  // Return the address at which to place buffer: the free address sharing the
+  // fewest banks with the buffers accessed concurrently with it, then the one
+  // leaving the smallest free range, then the lowest one.  A buffer which does
+  // not fit anywhere goes above all others if force is set, otherwise it is
+  // not placed.
+  std::optional<int64_t>
+  allocate(BufferOp buffer, const SmallPtrSetImpl<Operation *> &concurrent,
+           bool force) {
+    int64_t size = buffer.getAllocationSize();
+    int64_t alignment = getAlignment(buffer);
+    bool found = false;
+    std::tuple<int, int64_t, int64_t> best;
+    for (auto range : freeRanges) {
+      auto tryStart = [&](int64_t start) {
+        start = llvm::alignTo(start, alignment);
+        if (start + size > range.second)
+          return;
+        auto cost =
+            std::make_tuple(countConflicts(start, start + size, concurrent),
+                            range.second - range.first, start);
+        if (!found || cost < best)
+          best = cost;
+        found = true;
+      };
+      tryStart(range.first);
+      // starting at a bank boundary may move the buffer away from a conflict
+      for (int64_t bank = range.first / bankSize + 1;
+           bank * bankSize < range.second; bank++)
+        tryStart(bank * bankSize);
+    }
+    if (!found && !force)
+      return std::nullopt;
+    int64_t start =
+        found ? std::get<2>(best) : llvm::alignTo(highWater, alignment);
+    place(buffer, start);
+    return start;
+  }
+};
+
+// Buffers given the same address, because no two of them are live at the same
+// time.
+struct BufferSlot {
+  // the largest buffer first
+  SmallVector<BufferOp, 4> buffers;
+  // the live ranges of the buffers, as positions in the body of their core
+  SmallVector<std::pair<unsigned, unsigned>, 4> liveRanges;
+  CoreOp core;
+};
+
+} // namespace
+
+/// Function that sets the bank attribute of the memref arguments of the
+/// functions called in device which are passed buffers of the same bank at
+/// all their call sites.
+static void annotateKernelBanks(DeviceOp device) {
+  DenseMap<std::pair<Operation *, unsigned>, std::optional<int64_t>> banks;
+  SmallVector<std::pair<func::FuncOp, unsigned>, 8> args;
+  device.walk([&](func::CallOp call) {
+    auto callee = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+        call, call.getCalleeAttr());
+    if (!callee)
+      return;
+    for (auto [i, operand] : llvm::enumerate(call.getOperands())) {
+      if (!operand.getType().isa<MemRefType>())
+        continue;
+      std::optional<int64_t> bank;
+      if (auto buffer = operand.getDefiningOp<BufferOp>())
+        bank = buffer.getBank();
+      auto [it, inserted] = banks.try_emplace({callee, i}, bank);
+      if (inserted)
+        args.push_back({callee, i});
+      else if (it->second != bank)
+        it->second = std::nullopt;
+    }
+  });
+  Builder builder(device.getContext());
+  for (auto [callee, i] : args)
+    if (auto bank = banks[{callee, i}])
+      callee.setArgAttr(i, bankAttrName, builder.getI32IntegerAttr(*bank));
 }
 
 struct AIEAssignBufferAddressesPass
     : public AIEAssignBufferAddressesBase<AIEAssignBufferAddressesPass> {
+  // maps each buffer to the buffers used in the same block of a core, or by
+  // another channel of the same DMA, which may be accessed in the same cycle
+  DenseMap<Operation *, SmallPtrSet<Operation *, 4>> concurrentBuffers;
+
   void getDependentDialects(::mlir::DialectRegistry &registry) const override {
     registry.insert<func::FuncDialect>();
     registry.insert<xilinx::AIE::AIEDialect>();
   }
+
+  void collectConcurrentBuffers(DeviceOp device) {
+    for (auto core : device.getOps<CoreOp>()) {
+      DenseMap<Block *, SmallPtrSet<Operation *, 4>> accessed;
+      core.walk([&](Operation *op) {
+        for (Value operand : op->getOperands())
+          if (auto buffer = operand.getDefiningOp<BufferOp>())
+            accessed[op->getBlock()].insert(buffer);
+      });
+      for (auto &blockBuffers : accessed)
+        for (Operation *a : blockBuffers.second)
+          for (Operation *b : blockBuffers.second)
+            if (a != b)
+              concurrentBuffers[a].insert(b);
+    }
+
+    // the channels of a DMA run at the same time, so the buffers of the BDs
+    // of different channels are accessed concurrently
+    auto collectChannels = [&](Region &body) {
+      SmallVector<SmallPtrSet<Operation *, 4>, 4> channels;
+      for (auto &block : body)
+        for (auto start : block.getOps<DMAStartOp>()) {
+          auto &buffers = channels.emplace_back();
+          DenseSet<Block *> visited;
+          Block *bd = start.getDest();
+          while (bd && visited.insert(bd).second) {
+            for (auto bdOp : bd->getOps<DMABDOp>())
+              buffers.insert(bdOp.getBufferOp());
+            bd = bd->getNumSuccessors() > 0 ? bd->getSuccessor(0) : nullptr;
+          }
+        }
+      for (unsigned i = 0; i < channels.size(); i++)
+        for (unsigned j = 0; j < channels.size(); j++)
+          if (i != j)
+            for (Operation *a : channels[i])
+              for (Operation *b : channels[j])
+                if (a != b)
+                  concurrentBuffers[a].insert(b);
+    };
+    for (auto mem : device.getOps<MemOp>())
+      collectChannels(mem.getBody());
+    for (auto memTileDMA : device.getOps<MemTileDMAOp>())
+      collectChannels(memTileDMA.getBody());
+  }
+
+  /// Function that returns the first and last operations of the body of core
+  /// using buffer, if buffer is used and only by operations of a core
+  /// with a single block.
+  static std::optional<std::pair<unsigned, unsigned>>
+  getLiveRange(BufferOp buffer, CoreOp &core) {
+    core = nullptr;
+    std::optional<std::pair<unsigned, unsigned>> range;
+    for (Operation *user : buffer->getUsers()) {
+      auto userCore = user->getParentOfType<CoreOp>();
+      if (!userCore || (core && userCore != core) ||
+          !userCore.getBody().hasOneBlock())
+        return std::nullopt;
+      core = userCore;
+      Block &body = core.getBody().front();
+      Operation *ancestor = body.findAncestorOpInBlock(*user);
+      unsigned position = std::distance(body.begin(), ancestor->getIterator());
+      if (!range)
+        range = std::make_pair(position, position);
+      range->first = std::min(range->first, position);
+      range->second = std::max(range->second, position);
+    }
+    return range;
+  }
+
+  /// Function that groups buffers, from the largest, into slots of buffers
+  /// with disjoint live ranges.  Buffers which cannot share their memory get
+  /// a slot of their own.
+  static SmallVector<BufferSlot, 4> getSlots(ArrayRef<BufferOp> buffers,
+                                            bool share) {
+    SmallVector<BufferSlot, 4> slots;
+    for (auto buffer : buffers) {
+      CoreOp core;
+      std::optional<std::pair<unsigned, unsigned>> range;
+      if (share)
+        range = getLiveRange(buffer, core);
+      BufferSlot *slot = nullptr;
+      if (range)
+        for (auto &candidate : slots) {
+          if (candidate.core != core)
+            continue;
+          if (llvm::all_of(candidate.liveRanges, [&](auto other) {
+                return other.second < range->first ||
+                       range->second < other.first;
+              })) {
+            slot = &candidate;
+            break;
+          }
+        }
+      if (!slot) {
+        slots.push_back({});
+        slot = &slots.back();
+        // buffers without a live range never share their slot
+        if (range)
+          slot->core = core;
+      }
+      slot->buffers.push_back(buffer);
+      if (range)
+        slot->liveRanges.push_back(*range);
+    }
+    return slots;
+  }
+
+  /// Function that places the buffers of slot in memory, at the address of
+  /// the largest one.  If force is not set, nothing is placed and false is
+  /// returned when the largest buffer does not fit.
+  bool allocateSlot(TileMemory &memory, BufferSlot &slot, bool force) {
+    SmallPtrSet<Operation *, 4> concurrent;
+    for (auto buffer : slot.buffers) {
+      auto &others = concurrentBuffers[buffer.getOperation()];
+      concurrent.insert(others.begin(), others.end());
+    }
+    BufferOp leader = slot.buffers.front();
+    auto address = memory.allocate(leader, concurrent, force);
+    if (!address)
+      return false;
+    Builder builder(leader->getContext());
+    for (auto buffer : slot.buffers) {
+      if (buffer != leader) {
+        LLVM_DEBUG(llvm::dbgs() << "Buffer " << buffer.name()
+                                << " shares the memory of " << leader.name()
+                                << "\n");
+        memory.alias(buffer, leader);
+      }
+      buffer->setAttr("address", builder.getI32IntegerAttr(*address));
+    }
+    return true;
+  }
+
+  /// Function that moves the buffers of slot from tile to the memory of
+  /// another tile of the same kind, if it has room for them and the core of
+  /// tile and all the cores and memtile DMAs using the buffers can access it.
+  /// Buffers used by anything else, such as the DMA of a core tile, stay in
+  /// their tile.
+  // whether spillSlot moved buffers to other tiles in this run
+  bool spilled = false;
+
+  bool spillSlot(BufferSlot &slot, TileOp tile, ArrayRef<TileOp> tiles,
+                 MutableArrayRef<TileMemory> memories) {
+    if (tile.isShimTile())
+      return false;
+    // the tiles from which the buffers are accessed
+    SmallVector<TileOp, 4> accessors;
+    if (auto core = tile.getCoreOp())
+      accessors.push_back(core.getTileOp());
+    for (auto buffer : slot.buffers)
+      for (Operation *user : buffer->getUsers()) {
+        if (auto core = user->getParentOfType<CoreOp>())
+          accessors.push_back(core.getTileOp());
+        else if (auto memTileDMA = user->getParentOfType<MemTileDMAOp>())
+          accessors.push_back(memTileDMA.getTileOp());
+        else
+          return false;
+      }
+    if (accessors.empty())
+      return false;
+
+    const auto &targetModel = getTargetModel(tile);
+    for (unsigned t = 0; t < tiles.size(); t++) {
+      TileOp other = tiles[t];
+      if (other == tile || other.isMemTile() != tile.isMemTile() ||
+          other.isShimTile())
+        continue;
+      if (!llvm::all_of(accessors, [&](TileOp accessor) {
+            return targetModel.isLegalMemAffinity(
+                accessor.colIndex(), accessor.rowIndex(), other.colIndex(),
+                other.rowIndex());
+          }))
+        continue;
+      if (!allocateSlot(memories[t], slot, false))
+        continue;
+      for (auto buffer : slot.buffers) {
+        LLVM_DEBUG(llvm::dbgs() << "Buffer " << buffer.name()
+                                << " spilled to tile (" << other.colIndex()
+                                << ", " << other.rowIndex() << ")\n");
+        if (!other->isBeforeInBlock(buffer))
+          other->moveBefore(buffer);
+        buffer.getTileMutable().assign(other);
+      }
+      spilled = true;
+      return true;
+    }
+    return false;
+  }
+
   void runOnOperation() override {
     DeviceOp device = getOperation();
     OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+    spilled = false;
     // Make sure all the buffers have a name
     int counter = 0;
     for (auto buffer : device.getOps<BufferOp>()) {
@@ -56,7 +413,14 @@ struct AIEAssignBufferAddressesPass
                         builder.getStringAttr(name));
       }
     }
+    collectConcurrentBuffers(device);
+    const AIEDeviceIndex &index = getAnalysis<AIEDeviceIndex>();
 
+    // Allocate the buffers of each tile in its own memory.  The buffers from
+    // the first one which does not fit are left for later.
+    SmallVector<TileOp, 16> tiles;
+    std::vector<TileMemory> memories;
+    std::vector<SmallVector<BufferSlot, 4>> overflow;
     for (auto tile : device.getOps<TileOp>()) {
       const auto &target_model = getTargetModel(tile);
       int max_data_memory_size = 0;
@@ -65,29 +429,65 @@ struct AIEAssignBufferAddressesPass
       else
         max_data_memory_size = target_model.getLocalMemorySize();
       SmallVector<BufferOp, 4> buffers;
-      // Collect all the buffers for this tile.
-      for (auto buffer : device.getOps<BufferOp>())
-        if (buffer.getTileOp() == tile)
+      SmallVector<BufferOp, 4> pinned;
+      // Collect all the buffers for this tile.  Buffers with an address keep
+      // it.
+      for (auto buffer : index.getBuffers(tile.getTileID())) {
+        if (buffer->getAttrOfType<IntegerAttr>("address"))
+          pinned.push_back(buffer);
+        else
           buffers.push_back(buffer);
+      }
       // Sort by allocation size.
-      std::sort(buffers.begin(), buffers.end(), [](BufferOp a, BufferOp b) {
-        return a.getAllocationSize() > b.getAllocationSize();
-      });
+      std::stable_sort(buffers.begin(), buffers.end(),
+                       [](BufferOp a, BufferOp b) {
+                         return a.getAllocationSize() > b.getAllocationSize();
+                       });
 
       // Address range owned by the MemTile is 0x80000.
       // Address range owned by the tile is 0x8000,
       // but we need room at the bottom for stack.
       int stacksize = 0;
-      int address = 0;
-      if (auto core = tile.getCoreOp()) {
+      if (auto core = tile.getCoreOp())
         stacksize = core.getStackSize();
-        address += stacksize;
+      tiles.push_back(tile);
+      memories.emplace_back(
+          max_data_memory_size,
+          max_data_memory_size /
+              target_model.getNumBanks(tile.getCol(), tile.getRow()),
+          stacksize);
+      TileMemory &memory = memories.back();
+      for (auto buffer : pinned) {
+        int64_t start = buffer.address();
+        int64_t end = start + buffer.getAllocationSize();
+        if (end <= max_data_memory_size && !memory.isFree(start, end)) {
+          buffer.emitOpError("address 0x")
+              << llvm::utohexstr(start)
+              << " overlaps the stack or another buffer";
+          return signalPassFailure();
+        }
+        memory.place(buffer, start);
       }
-      for (auto buffer : buffers)
-        address = assignAddress(buffer, address, builder);
-      if (address > max_data_memory_size) {
-        InFlightDiagnostic error =
-            tile.emitOpError("allocated buffers exceeded available memory\n");
+      auto &deferred = overflow.emplace_back();
+      for (auto &slot : getSlots(buffers, shareBuffers))
+        if (!deferred.empty() || !allocateSlot(memory, slot, false))
+          deferred.push_back(slot);
+    }
+
+    // The buffers left over go where there is still room in their tile, then
+    // to the memory of a neighbour which the cores using them can access.
+    // The others go above all buffers of their tile.
+    for (unsigned t = 0; t < tiles.size(); t++)
+      for (auto &slot : overflow[t])
+        if (!allocateSlot(memories[t], slot, false) &&
+            !spillSlot(slot, tiles[t], tiles, memories))
+          allocateSlot(memories[t], slot, true);
+
+    for (unsigned t = 0; t < tiles.size(); t++) {
+      TileMemory &memory = memories[t];
+      if (memory.getHighWater() > memory.getSize()) {
+        InFlightDiagnostic error = tiles[t].emitOpError(
+            "allocated buffers exceeded available memory\n");
         auto &note = error.attachNote() << "MemoryMap:\n";
         auto printbuffer = [&](StringRef name, int address, int size) {
           note << "\t" << name << " \t"
@@ -95,17 +495,28 @@ struct AIEAssignBufferAddressesPass
                << llvm::utohexstr(address + size - 1) << " \t(" << size
                << " bytes)\n";
         };
-        if (stacksize > 0)
-          printbuffer("(stack)", 0, stacksize);
+        if (memory.getStackSize() > 0)
+          printbuffer("(stack)", 0, memory.getStackSize());
         else
           error << "(no stack allocated)\n";
 
+        SmallVector<BufferOp, 8> buffers(memory.getBuffers().begin(),
+                                         memory.getBuffers().end());
+        std::stable_sort(buffers.begin(), buffers.end(),
+                         [](BufferOp a, BufferOp b) {
+                           return a.address() < b.address();
+                         });
         for (auto buffer : buffers)
           printbuffer(buffer.name(), buffer.address(),
                       buffer.getAllocationSize());
         return signalPassFailure();
       }
     }
+
+    annotateKernelBanks(device);
+    // only the addresses changed, unless buffers moved to other tiles
+    if (!spilled)
+      markAnalysesPreserved<AIEDeviceIndex>();
   }
 };
 
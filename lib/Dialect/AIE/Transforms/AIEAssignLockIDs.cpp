@@ -8,19 +8,34 @@
 //
 //===----------------------------------------------------------------------===//
 
-// This pass aims to assign lockIDs to AIE.lock operations. The lockID is
-// numbered from the most recent AIE.lock within the same tile. If the lockID
-// exceeds 15 then the pass generates an error and terminates. AIE.lock
-// operations for different tiles are numbered independently. If there are
-// existing lock IDs, this pass is idempotent and only assign lock ids to locks
-// without an ID.
+// This pass aims to assign lockIDs to AIE.lock operations. Each lock gets the
+// lowest lockID of its tile which is not taken by a lock it interferes with.
+// AIE.lock operations for different tiles are numbered independently. If
+// there are existing lock IDs, this pass is idempotent and only assign lock
+// ids to locks without an ID.
+//
+// Two locks only interfere if they can be in use at the same time.  On AIE2
+// devices, a lock which is only used by one core, with the same value when the
+// core is done as initially, is known to be free outside of its live range in
+// the core body.  Such locks with disjoint live ranges and the same initial
+// value share a lockID.
+//
+// A lock which does not get a lockID in its tile is moved to another tile
+// whose locks can be used by all its users, if there is one with a free
+// lockID. Locks used by DMAs are not moved.
 
+#include "aie/Dialect/AIE/AIEDeviceIndex.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/Support/Debug.h"
+
+#include <map>
+#include <optional>
+#include <set>
 
 #define DEBUG_TYPE "aie-assign-lock-ids"
 
@@ -28,67 +43,214 @@ using namespace mlir;
 using namespace xilinx;
 using namespace xilinx::AIE;
 
+namespace {
+
+// How a lock without a lockID is used.
+struct LockUsage {
+  // the only core using the lock, if the lock is free outside of the live
+  // range below
+  CoreOp core;
+  // the first and last operations of the core body using the lock
+  std::pair<unsigned, unsigned> liveRange;
+  int init = 0;
+
+  bool interferes(const LockUsage &other) const {
+    if (!core || core != other.core || init != other.init)
+      return true;
+    return !(liveRange.second < other.liveRange.first ||
+             other.liveRange.second < liveRange.first);
+  }
+};
+
+} // namespace
+
 struct AIEAssignLockIDsPass
     : public AIEAssignLockIDsBase<AIEAssignLockIDsPass> {
   void getDependentDialects(::mlir::DialectRegistry &registry) const override {
     registry.insert<func::FuncDialect>();
     registry.insert<xilinx::AIE::AIEDialect>();
   }
+
+  /// Function that returns the change of the value of lock by the operations
+  /// of block, if it does not depend on how many times the nested regions
+  /// run.
+  static std::optional<int> getNetChange(Block &block, Value lock) {
+    int change = 0;
+    for (Operation &op : block) {
+      if (auto useLock = dyn_cast<UseLockOp>(op)) {
+        if (useLock.getLock() != lock)
+          continue;
+        if (useLock.acquire_ge())
+          change -= useLock.getLockValue();
+        else if (useLock.release())
+          change += useLock.getLockValue();
+        else
+          return std::nullopt;
+        continue;
+      }
+      for (Region &region : op.getRegions())
+        for (Block &nested : region) {
+          auto nestedChange = getNetChange(nested, lock);
+          if (!nestedChange || *nestedChange != 0)
+            return std::nullopt;
+        }
+    }
+    return change;
+  }
+
+  /// Function that returns how lock is used.  The core is only set if the
+  /// lock can share its lockID.
+  static LockUsage getUsage(LockOp lock) {
+    LockUsage usage;
+    if (auto init = lock.getInit())
+      usage.init = *init;
+    if (getTargetModel(lock).getTargetArch() == AIEArch::AIE1)
+      return usage;
+
+    CoreOp core;
+    std::optional<std::pair<unsigned, unsigned>> range;
+    for (Operation *user : lock->getUsers()) {
+      auto userCore = user->getParentOfType<CoreOp>();
+      if (!isa<UseLockOp>(user) || !userCore || (core && userCore != core) ||
+          !userCore.getBody().hasOneBlock())
+        return usage;
+      core = userCore;
+      Block &body = core.getBody().front();
+      Operation *ancestor = body.findAncestorOpInBlock(*user);
+      unsigned position = std::distance(body.begin(), ancestor->getIterator());
+      if (!range)
+        range = std::make_pair(position, position);
+      range->first = std::min(range->first, position);
+      range->second = std::max(range->second, position);
+    }
+    if (!range)
+      return usage;
+    auto change = getNetChange(core.getBody().front(), lock);
+    if (!change || *change != 0)
+      return usage;
+    usage.core = core;
+    usage.liveRange = *range;
+    return usage;
+  }
+
+  /// Function that returns the lowest lockID of tile which is neither taken
+  /// by a lock with an ID given by the user nor by a lock interfering with
+  /// usage, or -1 if there is none.
+  int findLockID(TileOp tile, const LockUsage &usage,
+                 const std::set<int> &pinnedIDs,
+                 const std::map<int, SmallVector<LockUsage, 2>> &assigned) {
+    const auto &targetModel = getTargetModel(tile);
+    int numLocks = targetModel.getNumLocks(tile.getCol(), tile.getRow());
+    for (int id = 0; id < numLocks; id++) {
+      if (pinnedIDs.count(id))
+        continue;
+      auto found = assigned.find(id);
+      if (found != assigned.end() &&
+          llvm::any_of(found->second, [&](const LockUsage &other) {
+            return usage.interferes(other);
+          }))
+        continue;
+      return id;
+    }
+    return -1;
+  }
+
+  /// Function that returns true if all the users of lock can use the locks
+  /// of tile.
+  static bool canMoveTo(LockOp lock, TileOp tile) {
+    if (tile.isShimTile() || tile.isMemTile() || lock->use_empty())
+      return false;
+    const auto &targetModel = getTargetModel(tile);
+    for (Operation *user : lock->getUsers()) {
+      auto core = user->getParentOfType<CoreOp>();
+      if (!isa<UseLockOp>(user) || !core ||
+          !targetModel.isLegalMemAffinity(core.colIndex(), core.rowIndex(),
+                                          tile.colIndex(), tile.rowIndex()))
+        return false;
+    }
+    return true;
+  }
+
   void runOnOperation() override {
 
     DeviceOp device = getOperation();
     OpBuilder rewriter = OpBuilder::atBlockEnd(device.getBody());
 
-    std::map<Operation *, std::pair<int, std::set<int>>> tileToLastID;
+    // The first pass scans for and stores the existing lockIDs of each tile.
+    DenseMap<Operation *, std::set<int>> pinnedIDs;
+    for (auto lock : device.getOps<LockOp>())
+      if (lock.getLockID().has_value())
+        pinnedIDs[lock.getTile().getDefiningOp()].insert(
+            lock.getLockIDValue());
 
-    // The first pass scans for and stores the existing lockIDs. This data is
-    // stored in a map with the lock’s tile operation as the key, while the
-    // value to the key is a pair with the current potential lockID and a set
-    // that stores the currently assigned lockIDs.
+    // The second pass assigns lockIDs to the locks without one, in the order
+    // of the locks, from the lowest free lockID of their tile.
+    DenseMap<Operation *, std::map<int, SmallVector<LockUsage, 2>>> assigned;
+    SmallVector<std::pair<LockOp, LockUsage>, 4> unassigned;
     for (auto lock : device.getOps<LockOp>()) {
-      if (lock.getLockID().has_value()) {
-        Operation *lock_tile = lock.getTile().getDefiningOp();
-        tileToLastID[lock_tile].first = 0;
-        tileToLastID[lock_tile].second.insert(lock.getLockIDValue());
+      if (lock.getLockID().has_value())
+        continue;
+      TileOp tile = lock.getTileOp();
+      LockUsage usage = getUsage(lock);
+      int id = findLockID(tile, usage, pinnedIDs[tile], assigned[tile]);
+      if (id < 0) {
+        unassigned.push_back({lock, usage});
+        continue;
       }
+      lock->setAttr("lockID", rewriter.getI32IntegerAttr(id));
+      assigned[tile][id].push_back(usage);
     }
 
-    // The second pass scans for locks with no lockIDs and assigns locks.
-    for (auto lock : device.getOps<LockOp>()) {
-      Operation *lock_tile = lock.getTile().getDefiningOp();
-      if (!lock.getLockID().has_value()) {
-        if (tileToLastID.find(lock_tile) == tileToLastID.end()) {
-          // If the tile operation corresponding to the lock does not exist in
-          // the data structure, initialize the lockID with 0 with an empty set.
-          tileToLastID[lock_tile].first = 0;
-        } else if (tileToLastID[lock_tile].first < 15) {
-          // If the tile operation of the lock exists, the potential lockID is
-          // checked with the set containing occupied lockIDs until a lockID
-          // that is free is found.
-          int potential_ID = tileToLastID[lock_tile].first;
-          while (true) {
-            if (tileToLastID[lock_tile].second.find(potential_ID) !=
-                tileToLastID[lock_tile].second.end())
-              potential_ID++;
-            else
-              break;
-          }
-          tileToLastID[lock_tile].first = potential_ID;
-        } else {
-          lock->emitError() << "Exceeded the number of unique LockIDs";
-          return;
-        }
-
-        // The lockID is assigned and is stored in the set.
-        lock->setAttr("lockID", rewriter.getI32IntegerAttr(
-                                    tileToLastID[lock_tile].first));
-        tileToLastID[lock_tile].second.insert(tileToLastID[lock_tile].first);
+    // The locks left over go to another tile which the cores using them can
+    // access.  These tiles are neighbours of the cores, the candidates are
+    // the neighbours of the first one, tried in the order of the tiles.
+    const AIEDeviceIndex &index = getAnalysis<AIEDeviceIndex>();
+    bool movedAny = false;
+    for (auto [lock, usage] : unassigned) {
+      bool moved = false;
+      SmallVector<TileOp, 9> candidates;
+      CoreOp core;
+      if (!lock->use_empty())
+        core = (*lock->user_begin())->getParentOfType<CoreOp>();
+      if (core)
+        for (int col = core.colIndex() - 1; col <= core.colIndex() + 1; col++)
+          for (int row = core.rowIndex() - 1; row <= core.rowIndex() + 1;
+               row++)
+            if (auto tile = index.getTile(col, row))
+              candidates.push_back(tile);
+      llvm::sort(candidates, [](TileOp a, TileOp b) {
+        return a->isBeforeInBlock(b);
+      });
+      for (auto tile : candidates) {
+        if (tile == lock.getTileOp() || !canMoveTo(lock, tile))
+          continue;
+        int id = findLockID(tile, usage, pinnedIDs[tile], assigned[tile]);
+        if (id < 0)
+          continue;
+        LLVM_DEBUG(llvm::dbgs() << "Moving " << lock << " to tile ("
+                                << tile.colIndex() << ", " << tile.rowIndex()
+                                << ")\n");
+        if (!tile->isBeforeInBlock(lock))
+          tile->moveBefore(lock);
+        lock.getTileMutable().assign(tile);
+        lock->setAttr("lockID", rewriter.getI32IntegerAttr(id));
+        assigned[tile][id].push_back(usage);
+        moved = true;
+        break;
+      }
+      if (!moved) {
+        lock->emitError() << "Exceeded the number of unique LockIDs";
+        return signalPassFailure();
       }
+      movedAny = true;
     }
+    // only the lockIDs changed, unless locks moved to other tiles
+    if (!movedAny)
+      markAnalysesPreserved<AIEDeviceIndex>();
   }
 };
 
 std::unique_ptr<OperationPass<DeviceOp>>
 xilinx::AIE::createAIEAssignLockIDsPass() {
   return std::make_unique<AIEAssignLockIDsPass>();
-}
\ No newline at end of file
+}
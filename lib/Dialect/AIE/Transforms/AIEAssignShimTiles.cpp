@@ -0,0 +1,188 @@
+//===- AIEAssignShimTiles.cpp -----------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the assignment of the objectFifos to and from the DDR
+// to the shim NOC tiles of the device, so that the DDR traffic of a design is
+// spread over the DMA channels of all the shim columns, close to the tiles
+// it comes from or goes to.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/AIEObjectFifoTraffic.h"
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Debug.h"
+
+#include <limits>
+#include <map>
+
+#define DEBUG_TYPE "aie-assign-shim-tiles"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// Shim tiles carrying this attribute are placeholders for the shim NOC tiles
+// the pass assigns to each objectFifo using them.  Their column is ignored.
+static const char *UNPLACED_ATTR_NAME = "unplaced";
+
+namespace {
+
+// An endpoint of an objectFifo on a placeholder shim tile.
+struct ShimEndpoint {
+  ObjectFifoCreateOp fifo;
+  // The index of the endpoint among the tiles of the objectFifo: 0 for the
+  // producer, i + 1 for consumer i.
+  unsigned operand;
+  // MM2S if the endpoint sends the DDR to the array, S2MM otherwise.
+  DMAChannelDir dir;
+  // The bytes the endpoint moves over a run of the design.
+  int64_t bytes;
+};
+
+// The DMA channels of a shim NOC tile used so far, and the bytes they move
+// over a run of the design, for each direction.
+struct ShimColumn {
+  int channels[2] = {0, 0};
+  int64_t bytes[2] = {0, 0};
+};
+
+} // namespace
+
+static bool isPlaceholder(Value tile) {
+  auto tileOp = tile.getDefiningOp<TileOp>();
+  return tileOp && tileOp.isShimTile() && tileOp->hasAttr(UNPLACED_ATTR_NAME);
+}
+
+struct AIEAssignShimTilesPass
+    : public AIEAssignShimTilesBase<AIEAssignShimTilesPass> {
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    const auto &targetModel = device.getTargetModel();
+    const auto &traffic = getAnalysis<AIEObjectFifoTraffic>();
+
+    SmallVector<ShimEndpoint, 8> endpoints;
+    std::map<int, ShimColumn> columns;
+    for (int col = 0; col < targetModel.columns(); col++)
+      if (targetModel.isShimNOCTile(col, 0))
+        columns[col];
+
+    // The channels the fixed shim tiles already use.
+    auto useChannel = [&](TileOp tile, DMAChannelDir dir, int64_t bytes) {
+      auto column = columns.find(tile.getCol());
+      if (column == columns.end())
+        return;
+      column->second.channels[static_cast<int>(dir)]++;
+      column->second.bytes[static_cast<int>(dir)] += bytes;
+    };
+    for (auto fifo : device.getOps<ObjectFifoCreateOp>()) {
+      for (auto [i, tile] : llvm::enumerate(fifo->getOperands())) {
+        auto tileOp = tile.getDefiningOp<TileOp>();
+        if (!tileOp || !tileOp.isShimTile())
+          continue;
+        auto dir = i == 0 ? DMAChannelDir::MM2S : DMAChannelDir::S2MM;
+        if (isPlaceholder(tile))
+          endpoints.push_back({fifo, static_cast<unsigned>(i), dir,
+                               traffic.getBytes(fifo)});
+        else
+          useChannel(tileOp, dir, traffic.getBytes(fifo));
+      }
+    }
+    if (endpoints.empty())
+      return;
+    for (auto shimDMA : device.getOps<ShimDMAOp>())
+      shimDMA.walk([&](DMAStartOp start) {
+        useChannel(shimDMA.getTileOp(),
+                   start.isSend() ? DMAChannelDir::MM2S : DMAChannelDir::S2MM,
+                   0);
+      });
+
+    // The endpoints moving the most bytes first, each on the shim column
+    // which then moves its direction of the DDR traffic in the fewest
+    // cycles, plus the cycles of its route to the other endpoints.
+    std::stable_sort(endpoints.begin(), endpoints.end(),
+                     [](const ShimEndpoint &a, const ShimEndpoint &b) {
+                       return a.bytes > b.bytes;
+                     });
+    OpBuilder builder(device.getContext());
+    for (ShimEndpoint &endpoint : endpoints) {
+      int dir = static_cast<int>(endpoint.dir);
+      int best = -1;
+      double bestCycles = std::numeric_limits<double>::infinity();
+      for (auto &[col, column] : columns) {
+        int numChannels = targetModel.getNumDestShimMuxConnections(
+            col, 0, WireBundle::DMA);
+        if (column.channels[dir] >= numChannels)
+          continue;
+        double cycles = static_cast<double>(column.bytes[dir] +
+                                            endpoint.bytes) /
+                        targetModel.getShimBytesPerCycle();
+        for (auto [i, tile] :
+             llvm::enumerate(endpoint.fifo->getOperands())) {
+          auto tileOp = tile.getDefiningOp<TileOp>();
+          if (i == endpoint.operand || !tileOp || isPlaceholder(tile))
+            continue;
+          int hops = std::abs(tileOp.getCol() - col) + tileOp.getRow();
+          cycles += hops * targetModel.getSwitchHopCycles();
+        }
+        if (cycles < bestCycles) {
+          bestCycles = cycles;
+          best = col;
+        }
+      }
+      if (best < 0) {
+        endpoint.fifo.emitOpError("needs a shim NOC tile with a free ")
+            << stringifyDMAChannelDir(endpoint.dir)
+            << " channel, all of them are in use";
+        return signalPassFailure();
+      }
+      ShimColumn &column = columns[best];
+      column.channels[dir]++;
+      column.bytes[dir] += endpoint.bytes;
+      LLVM_DEBUG(llvm::dbgs()
+                 << "Assigning shim column " << best << " to "
+                 << endpoint.fifo.getSymName() << " moving " << endpoint.bytes
+                 << " bytes\n");
+
+      Value placeholder = endpoint.fifo->getOperand(endpoint.operand);
+      TileOp shimTile;
+      for (auto tile : device.getOps<TileOp>())
+        if (tile.colIndex() == best && tile.rowIndex() == 0 &&
+            !tile->hasAttr(UNPLACED_ATTR_NAME))
+          shimTile = tile;
+      if (!shimTile) {
+        builder.setInsertionPoint(placeholder.getDefiningOp());
+        shimTile = builder.create<TileOp>(placeholder.getLoc(), best, 0);
+      }
+      endpoint.fifo->setOperand(endpoint.operand, shimTile);
+      for (auto registerOp :
+           device.getOps<ObjectFifoRegisterExternalBuffersOp>())
+        if (registerOp.getObjectFifo() == endpoint.fifo &&
+            registerOp.getTile() == placeholder)
+          registerOp.getTileMutable().assign(shimTile);
+    }
+
+    for (auto tile : llvm::make_early_inc_range(device.getOps<TileOp>())) {
+      if (!isPlaceholder(tile))
+        continue;
+      if (!tile->use_empty()) {
+        tile.emitOpError("is an unplaced shim tile used by ")
+            << (*tile->user_begin())->getName()
+            << ", only objectFifos can use one";
+        return signalPassFailure();
+      }
+      tile.erase();
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEAssignShimTilesPass() {
+  return std::make_unique<AIEAssignShimTilesPass>();
+}
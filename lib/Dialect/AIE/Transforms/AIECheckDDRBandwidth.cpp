@@ -0,0 +1,188 @@
+//===- AIECheckDDRBandwidth.cpp ---------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the check of the DDR traffic a design expects from
+// its shim DMAs against the bandwidths of the shim DMA channels, of the shim
+// columns and of the NOC of the target model, to report the designs that are
+// I/O-bound before they run.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/AIEObjectFifoTraffic.h"
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/FormatVariadic.h"
+
+#include <map>
+#include <optional>
+#include <tuple>
+
+#define DEBUG_TYPE "aie-check-ddr-bandwidth"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// The bytes per cycle an objectFifo is expected to move.
+static const char *BANDWIDTH_ATTR_NAME = "aie.bandwidth";
+// The shim tiles of aie-assign-shim-tiles.
+static const char *UNPLACED_ATTR_NAME = "unplaced";
+
+namespace {
+
+// The DDR traffic of a shim DMA channel, in bytes per cycle.
+struct ChannelTraffic {
+  // The first op using the channel, to report it.
+  Operation *op;
+  int col;
+  DMAChannelDir dir;
+  double bytesPerCycle = 0;
+};
+
+} // namespace
+
+static std::string formatBytesPerCycle(double bytesPerCycle) {
+  return llvm::formatv("{0:F2}", bytesPerCycle).str();
+}
+
+static const char *getDDRDirection(DMAChannelDir dir) {
+  return dir == DMAChannelDir::MM2S ? "from" : "to";
+}
+
+struct AIECheckDDRBandwidthPass
+    : public AIECheckDDRBandwidthBase<AIECheckDDRBandwidthPass> {
+  /// Function that returns the bytes per cycle fifo is expected to move, or
+  /// a negative value if it is not known.
+  double getExpectedBandwidth(ObjectFifoCreateOp fifo,
+                              const AIEObjectFifoTraffic &traffic) {
+    Attribute attr = fifo->getAttr(BANDWIDTH_ATTR_NAME);
+    if (auto floatAttr = dyn_cast_or_null<FloatAttr>(attr))
+      return floatAttr.getValueAsDouble();
+    if (auto intAttr = dyn_cast_or_null<IntegerAttr>(attr))
+      return intAttr.getInt();
+    if (runCycles > 0 && traffic.getElements(fifo) > 0)
+      return static_cast<double>(traffic.getBytes(fifo)) / runCycles;
+    return -1;
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    const auto &targetModel = device.getTargetModel();
+    const auto &traffic = getAnalysis<AIEObjectFifoTraffic>();
+
+    // The channels of the flows, by column, direction and channel index, and
+    // one channel for each endpoint of an objectFifo on a shim tile, as
+    // aie-objectFifo-stateful-transform gives them.
+    std::map<std::tuple<int, int, int>, ChannelTraffic> flowChannels;
+    std::vector<ChannelTraffic> channels;
+    // The shim tile endpoints without a column yet, of aie-assign-shim-tiles,
+    // only count against the NOC.
+    double unplacedBytesPerCycle = 0;
+
+    for (auto fifo : device.getOps<ObjectFifoCreateOp>()) {
+      double expected = getExpectedBandwidth(fifo, traffic);
+      if (expected < 0)
+        continue;
+      for (auto [i, tile] : llvm::enumerate(fifo->getOperands())) {
+        auto tileOp = tile.getDefiningOp<TileOp>();
+        if (!tileOp || !tileOp.isShimTile())
+          continue;
+        if (tileOp->hasAttr(UNPLACED_ATTR_NAME)) {
+          unplacedBytesPerCycle += expected;
+          continue;
+        }
+        auto dir = i == 0 ? DMAChannelDir::MM2S : DMAChannelDir::S2MM;
+        channels.push_back({fifo, tileOp.getCol(), dir, expected});
+      }
+    }
+
+    // The bandwidth of the flows is a percentage of a stream.
+    auto addFlow = [&](Operation *op, Value tile, Port port, bool isSource,
+                       std::optional<int> bandwidth) {
+      auto tileOp = tile.getDefiningOp<TileOp>();
+      if (!bandwidth || !tileOp || !tileOp.isShimTile() ||
+          port.first != WireBundle::DMA)
+        return;
+      auto dir = isSource ? DMAChannelDir::MM2S : DMAChannelDir::S2MM;
+      auto [it, inserted] = flowChannels.try_emplace(
+          {tileOp.getCol(), static_cast<int>(dir), port.second},
+          ChannelTraffic{op, tileOp.getCol(), dir});
+      it->second.bytesPerCycle +=
+          *bandwidth / 100.0 * targetModel.getStreamBytesPerCycle();
+    };
+    for (auto flow : device.getOps<FlowOp>()) {
+      addFlow(flow, flow.getSource(),
+              {flow.getSourceBundle(), flow.sourceIndex()}, true,
+              flow.getBandwidth());
+      addFlow(flow, flow.getDest(), {flow.getDestBundle(), flow.destIndex()},
+              false, flow.getBandwidth());
+    }
+    for (auto packetFlow : device.getOps<PacketFlowOp>())
+      for (Operation &op : packetFlow.getPorts().front()) {
+        if (auto source = dyn_cast<PacketSourceOp>(op))
+          addFlow(packetFlow, source.getTile(), source.port(), true,
+                  packetFlow.getBandwidth());
+        else if (auto dest = dyn_cast<PacketDestOp>(op))
+          addFlow(packetFlow, dest.getTile(), dest.port(), false,
+                  packetFlow.getBandwidth());
+      }
+    for (auto &[key, channel] : flowChannels)
+      channels.push_back(channel);
+
+    // Each channel, then each direction of each column, then the NOC.
+    std::map<std::pair<int, int>, double> columns;
+    double nocBytesPerCycle = unplacedBytesPerCycle;
+    for (const ChannelTraffic &channel : channels) {
+      LLVM_DEBUG(llvm::dbgs() << "Shim column " << channel.col << " "
+                              << stringifyDMAChannelDir(channel.dir) << ": "
+                              << channel.bytesPerCycle << " bytes per cycle\n");
+      uint32_t limit = targetModel.getDmaBytesPerCycle(channel.col, 0);
+      if (channel.bytesPerCycle > limit)
+        channel.op->emitWarning("needs ")
+            << formatBytesPerCycle(channel.bytesPerCycle)
+            << " bytes per cycle " << getDDRDirection(channel.dir)
+            << " the DDR, more than the " << limit
+            << " bytes per cycle of a shim DMA channel";
+      columns[{channel.col, static_cast<int>(channel.dir)}] +=
+          channel.bytesPerCycle;
+      nocBytesPerCycle += channel.bytesPerCycle;
+    }
+
+    for (auto &[column, bytesPerCycle] : columns) {
+      uint32_t limit = targetModel.getShimBytesPerCycle();
+      if (bytesPerCycle <= limit)
+        continue;
+      TileOp shimTile;
+      for (auto tile : device.getOps<TileOp>())
+        if (!shimTile && tile.colIndex() == column.first &&
+            tile.rowIndex() == 0)
+          shimTile = tile;
+      auto dir = static_cast<DMAChannelDir>(column.second);
+      shimTile.emitWarning("shim column ")
+          << column.first << " needs " << formatBytesPerCycle(bytesPerCycle)
+          << " bytes per cycle " << getDDRDirection(dir)
+          << " the DDR, more than the " << limit
+          << " bytes per cycle it can move, the design is I/O-bound";
+    }
+
+    uint32_t nocLimit = targetModel.getNocBytesPerCycle();
+    if (nocBytesPerCycle > nocLimit)
+      device.emitWarning("the shim tiles need ")
+          << formatBytesPerCycle(nocBytesPerCycle)
+          << " bytes per cycle of DDR traffic, more than the " << nocLimit
+          << " bytes per cycle of the NOC, the design is I/O-bound";
+
+    markAllAnalysesPreserved();
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIECheckDDRBandwidthPass() {
+  return std::make_unique<AIECheckDDRBandwidthPass>();
+}
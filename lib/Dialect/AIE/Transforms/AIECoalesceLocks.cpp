@@ -0,0 +1,136 @@
+//===- AIECoalesceLocks.cpp -------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-coalesce-locks"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+struct AIECoalesceLocksPass
+    : public AIECoalesceLocksBase<AIECoalesceLocksPass> {
+  DenseSet<Value> privateLocks; // locks only acquired by a single core
+
+  /// Function that records the locks whose acquires are all in the same core:
+  /// releasing such a lock and acquiring it back cannot hand elements over to
+  /// another process.
+  void findPrivateLocks(DeviceOp device) {
+    for (auto lock : device.getOps<LockOp>()) {
+      CoreOp owner;
+      bool isPrivate = true;
+      for (Operation *user : lock->getUsers()) {
+        auto useLock = dyn_cast<UseLockOp>(user);
+        if (!useLock) {
+          isPrivate = false;
+          break;
+        }
+        if (useLock.release())
+          continue;
+        auto core = useLock->getParentOfType<CoreOp>();
+        if (!core || (owner && core != owner)) {
+          isPrivate = false;
+          break;
+        }
+        owner = core;
+      }
+      if (isPrivate)
+        privateLocks.insert(lock.getResult());
+    }
+  }
+
+  /// Function that merges the lock operations of a block which are separated
+  /// only by other lock operations or operations without side effects:
+  ///   * consecutive releases of a lock become one release of the sum of
+  ///     their values, as releasing earlier over other releases is safe,
+  ///   * consecutive acquires of a lock become one acquire of the sum of
+  ///     their values, as the process needs all of them before going on,
+  ///   * a release followed by an acquire of a private lock cancel out.
+  void coalesceBlock(Block &block) {
+    SmallVector<UseLockOp, 8> run; // lock operations since the last
+                                   // operation with side effects
+    for (Operation &op : llvm::make_early_inc_range(block)) {
+      auto useLock = dyn_cast<UseLockOp>(op);
+      if (!useLock) {
+        if (op.getNumRegions() > 0 || !isMemoryEffectFree(&op))
+          run.clear();
+        continue;
+      }
+      if (useLock.getBlocking() || useLock.acquire()) {
+        run.clear();
+        continue;
+      }
+
+      // find the last lock operation on the same lock and check what is in
+      // between
+      bool onlyReleases = true;
+      bool onlyAcquires = true;
+      UseLockOp prev;
+      for (auto it = run.rbegin(); it != run.rend(); ++it) {
+        if (it->getLock() == useLock.getLock()) {
+          prev = *it;
+          break;
+        }
+        onlyReleases &= it->release();
+        onlyAcquires &= it->acquire_ge();
+      }
+      if (!prev || prev.getBlocking()) {
+        run.push_back(useLock);
+        continue;
+      }
+
+      if (prev.release() && useLock.release() && onlyReleases) {
+        prev.setValue(prev.getLockValue() + useLock.getLockValue());
+        useLock.erase();
+      } else if (prev.acquire_ge() && useLock.acquire_ge() && onlyAcquires) {
+        prev.setValue(prev.getLockValue() + useLock.getLockValue());
+        useLock.erase();
+      } else if (prev.release() && useLock.acquire_ge() &&
+                 privateLocks.count(useLock.getLock()) &&
+                 prev.getLockValue() >= useLock.getLockValue()) {
+        int remaining = prev.getLockValue() - useLock.getLockValue();
+        useLock.erase();
+        if (remaining == 0) {
+          run.erase(llvm::find(run, prev));
+          prev.erase();
+        } else {
+          prev.setValue(remaining);
+        }
+      } else {
+        run.push_back(useLock);
+      }
+    }
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    // AIE1 locks are binary and cannot hold the sum of two values
+    if (device.getTargetModel().getTargetArch() == AIEArch::AIE1)
+      return;
+
+    findPrivateLocks(device);
+    SmallVector<Block *, 16> blocks;
+    for (auto core : device.getOps<CoreOp>())
+      core.walk([&](Block *block) { blocks.push_back(block); });
+    for (Block *block : blocks)
+      coalesceBlock(*block);
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIECoalesceLocksPass() {
+  return std::make_unique<AIECoalesceLocksPass>();
+}
@@ -8,12 +8,15 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Bytecode/BytecodeWriter.h"
 #include "mlir/Conversion/FuncToLLVM/ConvertFuncToLLVM.h"
 #include "mlir/Conversion/FuncToLLVM/ConvertFuncToLLVMPass.h"
+#include "mlir/Conversion/LLVMCommon/MemRefBuilder.h"
+#include "mlir/Conversion/LLVMCommon/TypeConverter.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/ControlFlow/IR/ControlFlow.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/Dialect/Vector/IR/VectorOps.h"
@@ -21,9 +24,15 @@
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/Location.h"
 #include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/Threading.h"
 #include "mlir/Pass/Pass.h"
+#include "mlir/Pass/PassManager.h"
+#include "mlir/Pass/PassRegistry.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Path.h"
 
 using namespace mlir;
 using namespace mlir::vector;
@@ -242,32 +251,94 @@ struct AIEUseLockToStdLowering : public OpConversionPattern<UseLockOp> {
   }
 };
 
+// The alignment assumed of the buffers without an address, so that they can
+// be vectorized.
+static const int64_t DEFAULT_BUFFER_ALIGNMENT = 32;
+// The largest alignment derived from the address of a buffer.
+static const int64_t MAX_BUFFER_ALIGNMENT = 4096;
+
+/// Function that returns the address of buffer in the address space of the
+/// core of tile coreTile, or std::nullopt if the core cannot access it.
+static std::optional<int64_t> getCoreAddress(BufferOp buffer,
+                                             TileID coreTile) {
+  const auto &targetModel = getTargetModel(buffer);
+  TileID tile = buffer.getTileOp().getTileID();
+  if (targetModel.getMemSouth(coreTile) == tile)
+    return targetModel.getMemSouthBaseAddress() + buffer.address();
+  if (targetModel.getMemWest(coreTile) == tile)
+    return targetModel.getMemWestBaseAddress() + buffer.address();
+  if (targetModel.getMemNorth(coreTile) == tile)
+    return targetModel.getMemNorthBaseAddress() + buffer.address();
+  if (targetModel.getMemEast(coreTile) == tile)
+    return targetModel.getMemEastBaseAddress() + buffer.address();
+  return std::nullopt;
+}
+
+/// Function that returns the memref of type at the constant address, as the
+/// descriptor the LLVM lowering of memref makes of a pointer, which folds
+/// with the cast back to the descriptor once memref is lowered.
+static Value createConstantMemRef(OpBuilder &builder, Location loc,
+                                  MemRefType type, int64_t address) {
+  LLVMTypeConverter converter(builder.getContext());
+  auto ptrType =
+      converter.getPointerType(converter.convertType(type.getElementType()),
+                               type.getMemorySpaceAsInt());
+  Value addr = builder.create<LLVM::ConstantOp>(
+      loc, builder.getI32Type(), builder.getI32IntegerAttr(address));
+  Value ptr = builder.create<LLVM::IntToPtrOp>(loc, ptrType, addr);
+  Value descriptor =
+      MemRefDescriptor::fromStaticShape(builder, loc, converter, type, ptr);
+  return builder.create<UnrealizedConversionCastOp>(loc, type, descriptor)
+      .getResult(0);
+}
+
 struct AIEBufferToStandard : public OpConversionPattern<BufferOp> {
   using OpConversionPattern<BufferOp>::OpConversionPattern;
   ModuleOp &module;
+  bool constantAddresses;
   AIEBufferToStandard(MLIRContext *context, ModuleOp &m, IRMapping &mapper,
-                      PatternBenefit benefit = 1)
-      : OpConversionPattern<BufferOp>(context, benefit), module(m) {}
+                      bool constantAddresses, PatternBenefit benefit = 1)
+      : OpConversionPattern<BufferOp>(context, benefit), module(m),
+        constantAddresses(constantAddresses) {}
   LogicalResult
   matchAndRewrite(BufferOp buffer, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
     rewriter.setInsertionPointToStart(module.getBody());
     MemRefType t = buffer.getType().cast<MemRefType>();
     auto symName = buffer.name().getValue();
+    // The buffers with an address are aligned to the largest power of two
+    // dividing it, which the bases of the memories of the neighbours of a
+    // core are multiples of.
+    bool hasAddress = buffer->hasAttr("address");
+    int64_t alignment =
+        hasAddress ? llvm::MinAlign(buffer.address(), MAX_BUFFER_ALIGNMENT)
+                   : DEFAULT_BUFFER_ALIGNMENT;
     rewriter.create<memref::GlobalOp>(
         rewriter.getUnknownLoc(), symName, rewriter.getStringAttr("public"),
-        buffer.getType(), nullptr, false, nullptr);
+        buffer.getType(), nullptr, false,
+        hasAddress ? rewriter.getI64IntegerAttr(alignment) : nullptr);
 
     for (auto &use : llvm::make_early_inc_range(buffer.getResult().getUses())) {
       Operation *user = use.getOwner();
       rewriter.setInsertionPoint(user);
-      auto allocated = rewriter.create<memref::GetGlobalOp>(
-          rewriter.getUnknownLoc(), t, symName);
-      // Assume that buffers are aligned so they can be vectorized.
+      // In the cores, the address of the buffers is known before they are
+      // linked: LLVM folds it in the address arithmetic, and knows that the
+      // buffers do not alias.
+      auto core = user->getParentOfType<CoreOp>();
+      std::optional<int64_t> address;
+      if (constantAddresses && hasAddress && core)
+        address = getCoreAddress(buffer, core.getTileOp().getTileID());
+      Value allocated;
+      if (address)
+        allocated = createConstantMemRef(rewriter, rewriter.getUnknownLoc(),
+                                         t, *address);
+      else
+        allocated = rewriter.create<memref::GetGlobalOp>(
+            rewriter.getUnknownLoc(), t, symName);
       rewriter.create<memref::AssumeAlignmentOp>(rewriter.getUnknownLoc(),
-                                                 allocated, 32);
+                                                 allocated, alignment);
 
-      use.set(allocated.getResult());
+      use.set(allocated);
     }
 
     rewriter.eraseOp(buffer);
@@ -279,17 +350,14 @@ struct AIECoreToStandardFunc : public OpConversionPattern<CoreOp> {
   using OpConversionPattern<CoreOp>::OpConversionPattern;
   ModuleOp &module;
   IRMapping &mapper;
-  DenseMap<Operation *, SmallVector<BufferOp, 4>> &tileToBuffers;
   int tileCol = 0;
   int tileRow = 0;
 
-  AIECoreToStandardFunc(
-      MLIRContext *context, ModuleOp &m, IRMapping &mapper,
-      DenseMap<Operation *, SmallVector<BufferOp, 4>> &tileToBuffers,
-      PatternBenefit benefit = 1, int tileCol = 1, int tileRow = 1)
+  AIECoreToStandardFunc(MLIRContext *context, ModuleOp &m, IRMapping &mapper,
+                        PatternBenefit benefit = 1, int tileCol = 1,
+                        int tileRow = 1)
       : OpConversionPattern<CoreOp>(context, benefit), module(m),
-        mapper(mapper), tileToBuffers(tileToBuffers), tileCol(tileCol),
-        tileRow(tileRow) {}
+        mapper(mapper), tileCol(tileCol), tileRow(tileRow) {}
 
   LogicalResult
   matchAndRewrite(CoreOp op, OpAdaptor adaptor,
@@ -367,219 +435,422 @@ struct AIEEventOpToStdLowering : public OpConversionPattern<EventOp> {
   }
 };
 
+// Lower AIE.timestamp to a store of the llvm.aie.get.cycles intrinsic
+struct AIETimestampOpToStdLowering : public OpConversionPattern<TimestampOp> {
+  using OpConversionPattern<TimestampOp>::OpConversionPattern;
+  ModuleOp &module;
+
+  AIETimestampOpToStdLowering(MLIRContext *context, ModuleOp &m,
+                              PatternBenefit benefit = 1)
+      : OpConversionPattern<TimestampOp>(context, benefit), module(m) {}
+
+  LogicalResult
+  matchAndRewrite(TimestampOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto cyclesFunc = module.lookupSymbol<func::FuncOp>("llvm.aie.get.cycles");
+    if (!cyclesFunc)
+      return module.emitOpError("Could not find the intrinsic function!");
+    auto cycles = rewriter.create<func::CallOp>(rewriter.getUnknownLoc(),
+                                                cyclesFunc, ValueRange({}));
+    Value timestamp = rewriter.create<arith::TruncIOp>(
+        rewriter.getUnknownLoc(), rewriter.getI32Type(), cycles.getResult(0));
+    rewriter.replaceOpWithNewOp<memref::StoreOp>(
+        op, timestamp, adaptor.getBuffer(), adaptor.getIndex());
+    return success();
+  }
+};
+
+// A core function, and a copy of it taking the globals it gets as arguments.
+struct SharedCore {
+  func::FuncOp core;
+  func::FuncOp shared;
+  SmallVector<StringRef, 4> globals;
+  SmallVector<Type, 4> types;
+};
+
+// Make the copy of the function of core before it, with the globals it gets
+// as arguments in the order of their first get.
+static void outlineCoreBody(OpBuilder &builder, SharedCore &core) {
+  DenseMap<StringRef, unsigned> args;
+  core.core.walk([&](memref::GetGlobalOp global) {
+    if (args.try_emplace(global.getName(), core.globals.size()).second) {
+      core.globals.push_back(global.getName());
+      core.types.push_back(global.getType());
+    }
+  });
+
+  builder.setInsertionPoint(core.core);
+  core.shared = cast<func::FuncOp>(builder.clone(*core.core));
+  core.shared.setName(core.core.getName().str() + "_shared");
+  core.shared.setType(builder.getFunctionType(core.types, {}));
+  Block &entry = core.shared.getBody().front();
+  for (Type type : core.types)
+    entry.addArgument(type, core.shared.getLoc());
+  core.shared.walk([&](memref::GetGlobalOp global) {
+    global.replaceAllUsesWith(entry.getArgument(args[global.getName()]));
+    global.erase();
+  });
+}
+
+// Replace the code of the core functions which is the same but for the
+// globals it gets with a call to one core_shared_<n> function, taking the
+// globals as arguments.
+static void shareCoreFuncs(ModuleOp m, ArrayRef<func::FuncOp> coreFuncs) {
+  OpBuilder builder(m.getContext());
+  SmallVector<SharedCore, 16> cores;
+  SmallVector<SmallVector<unsigned, 4>, 16> groups;
+  for (func::FuncOp coreFunc : coreFuncs) {
+    SharedCore core;
+    core.core = coreFunc;
+    outlineCoreBody(builder, core);
+    auto group = llvm::find_if(groups, [&](ArrayRef<unsigned> group) {
+      func::FuncOp other = cores[group.front()].shared;
+      return other.getFunctionType() == core.shared.getFunctionType() &&
+             OperationEquivalence::isRegionEquivalentTo(
+                 &other.getBody(), &core.shared.getBody(),
+                 OperationEquivalence::IgnoreLocations);
+    });
+    if (group == groups.end())
+      groups.push_back({(unsigned)cores.size()});
+    else
+      group->push_back(cores.size());
+    cores.push_back(std::move(core));
+  }
+
+  unsigned numShared = 0;
+  for (ArrayRef<unsigned> group : groups) {
+    func::FuncOp shared = cores[group.front()].shared;
+    if (group.size() == 1) {
+      shared.erase();
+      continue;
+    }
+    shared.setName("core_shared_" + std::to_string(numShared++));
+    for (unsigned i : group) {
+      SharedCore &core = cores[i];
+      if (core.shared != shared)
+        core.shared.erase();
+      Region &body = core.core.getBody();
+      body.dropAllReferences();
+      body.getBlocks().clear();
+      builder.setInsertionPointToStart(core.core.addEntryBlock());
+      SmallVector<Value, 4> args;
+      for (auto [global, type] : llvm::zip(core.globals, core.types))
+        args.push_back(builder.create<memref::GetGlobalOp>(
+            builder.getUnknownLoc(), type, global));
+      builder.create<func::CallOp>(builder.getUnknownLoc(), shared, args);
+      builder.create<func::ReturnOp>(builder.getUnknownLoc());
+    }
+  }
+}
+
+// Lower the core of tile (col, row) in module m, or all the cores if col and
+// row are -1. With shareCores, the cores with the same code share it. With
+// constantAddresses, the cores use the buffers with an address at their
+// address rather than through their symbol.
+static LogicalResult lowerToStandard(ModuleOp m, int col, int row,
+                                     bool shareCores = false,
+                                     bool constantAddresses = false) {
+  OpBuilder builder = OpBuilder::atBlockEnd(m.getBody());
+
+  if (m.getOps<DeviceOp>().empty())
+    return m.emitOpError("expected AIE.device operation at toplevel");
+  DeviceOp device = *(m.getOps<DeviceOp>().begin());
+  const auto &target_model = device.getTargetModel();
+  const char *triple;
+  switch (target_model.getTargetArch()) {
+  case AIEArch::AIE1:
+    triple = "aie";
+    break;
+  case AIEArch::AIE2:
+    triple = "aie2";
+    break;
+  }
+
+  // Ensure that we don't have an incorrect target triple.  This may override
+  // some bogus target triple in the original mlir.  In reality this should
+  // pick the 'aie' target triple.
+  m->setAttr(LLVM::LLVMDialect::getTargetTripleAttrName(),
+             builder.getStringAttr(triple));
+
+  // Extract all CoreOps
+  // Create an LLVM func for each CoreOp
+  // Clone the region body of each CoreOp to the newly created LLVM func
+
+  // Populate intrinsic functions
+  // Intrinsic information:
+  // peano/llvm-project/llvm/lib/Target/AIE/AIEInstrInfo.td Also take a look
+  // at the tests: peano/llvm-project/llvm/test/CodeGen/AIE
+  builder.setInsertionPointToStart(m.getBody());
+
+  SmallVector<Type, 2> callArgTypes;
+
+  Type int32Type = IntegerType::get(builder.getContext(), 32);
+  Type int128Type = IntegerType::get(builder.getContext(), 128);
+  Type int384Type = IntegerType::get(builder.getContext(), 384);
+  Type floatType = FloatType::getF32(builder.getContext());
+
+  // Note that not all of these are valid for a particular design, or needed.
+  // For right now, we will just accept the noise.
+
+  // llvm.func @debug_i32(%val: !llvm.i32) -> ()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "debug_i32",
+          FunctionType::get(builder.getContext(), {int32Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.event0() -> ()
+  builder
+      .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.event0",
+                            FunctionType::get(builder.getContext(), {}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.event1() -> ()
+  builder
+      .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.event1",
+                            FunctionType::get(builder.getContext(), {}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.get.cycles() -> !llvm.i64
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.get.cycles",
+          FunctionType::get(builder.getContext(), {},
+                            {IntegerType::get(builder.getContext(), 64)}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.put.ms(%channel: !llvm.i1, %stream_val: !llvm.i32) ->
+  // ()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.put.ms",
+          FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.put.mws(%channel: !llvm.i1, %stream_val: !llvm.i128)
+  // -> ()
+  builder
+      .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.put.wms",
+                            FunctionType::get(builder.getContext(),
+                                              {int32Type, int128Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.put.mfs(%channel: !llvm.i1, %stream_val: !llvm.float)
+  // -> ()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.put.fms",
+          FunctionType::get(builder.getContext(), {int32Type, floatType}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.get.ss(%channel: !llvm.i1) -> !llvm.i32
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.get.ss",
+          FunctionType::get(builder.getContext(), {int32Type}, {int32Type}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.get.wss(%channel: !llvm.i1) -> !llvm.i128
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.get.wss",
+          FunctionType::get(builder.getContext(), {int32Type}, {int128Type}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.get.fss(%channel: !llvm.i1) -> !llvm.float
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.get.fss",
+          FunctionType::get(builder.getContext(), {int32Type}, {floatType}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.put.scd(%scd_val: !llvm.i384) -> ()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.put.mcd",
+          FunctionType::get(builder.getContext(), {int384Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.get.scd() -> !llvm.i384
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.get.scd",
+          FunctionType::get(builder.getContext(), {}, {int384Type}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.lock.acquire.reg(%lock_id: !llvm.i32, %lock_val:
+  // !llvm.i32) ->()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.lock.acquire.reg",
+          FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie.lock.release.reg(%lock_id: !llvm.i32, %lock_val:
+  // !llvm.i32) ->()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie.lock.release.reg",
+          FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie2.acquire(%lock_id: !llvm.i32, %lock_val:
+  // !llvm.i32) ->()v
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie2.acquire",
+          FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
+      .setPrivate();
+
+  // llvm.func @llvm.aie2.release(%lock_id: !llvm.i32, %lock_val:
+  // !llvm.i32) ->()
+  builder
+      .create<func::FuncOp>(
+          builder.getUnknownLoc(), "llvm.aie2.release",
+          FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
+      .setPrivate();
+
+  // The functions of the cores lowered, in the order of the cores.
+  SmallVector<std::string, 16> coreNames;
+  for (auto core : device.getOps<CoreOp>())
+    if ((col == -1 || core.colIndex() == col) &&
+        (row == -1 || core.rowIndex() == row))
+      coreNames.push_back("core_" + std::to_string(core.colIndex()) + "_" +
+                          std::to_string(core.rowIndex()));
+
+  IRMapping mapper;
+  ConversionTarget target(*m.getContext());
+  target.addLegalDialect<func::FuncDialect>();
+  target.addLegalDialect<cf::ControlFlowDialect>();
+  target.addLegalDialect<memref::MemRefDialect>();
+  target.addLegalDialect<VectorDialect>();
+  target.addLegalDialect<arith::ArithDialect>();
+  target.addLegalDialect<math::MathDialect>();
+  target.addLegalDialect<LLVM::LLVMDialect>();
+  target.addLegalOp<func::FuncOp, ModuleOp, UnrealizedConversionCastOp>();
+
+  RewritePatternSet patterns(m.getContext());
+  patterns.add<AIEPutStreamToStdLowering, AIEGetStreamToStdLowering,
+               AIEPutCascadeToStdLowering, AIEGetCascadeToStdLowering,
+               AIEDebugOpToStdLowering, AIEUseLockToStdLowering,
+               AIEEventOpToStdLowering, AIETimestampOpToStdLowering>(
+      m.getContext(), m);
+
+  patterns.add<AIEBufferToStandard>(m.getContext(), m, mapper,
+                                    constantAddresses);
+  if (failed(applyPartialConversion(m, target, std::move(patterns))))
+    return failure();
+
+  RewritePatternSet outlinePatterns(m.getContext());
+  outlinePatterns.add<AIECoreToStandardFunc>(m.getContext(), m, mapper, 1, col,
+                                             row);
+  if (failed(applyPartialConversion(m, target, std::move(outlinePatterns))))
+    return failure();
+
+  // Move all the func.func ops and memref.globals from the device to the
+  // module
+  outlineOps<memref::GlobalOp>(device);
+  outlineOps<func::FuncOp>(device);
+
+  RewritePatternSet removepatterns(m.getContext());
+  removepatterns
+      .add<AIEOpRemoval<AIE::DeviceOp>, AIEOpRemoval<AIE::TileOp>,
+           AIEOpRemoval<AIE::FlowOp>, AIEOpRemoval<AIE::MemOp>,
+           AIEOpRemoval<AIE::ShimDMAOp>, AIEOpRemoval<AIE::ShimMuxOp>,
+           AIEOpRemoval<AIE::SwitchboxOp>, AIEOpRemoval<AIE::LockOp>,
+           AIEOpRemoval<AIE::BufferOp>, AIEOpRemoval<AIE::ExternalBufferOp>,
+           AIEOpRemoval<AIE::ShimDMAAllocationOp>,
+           AIEOpRemoval<AIE::CascadeFlowOp>, AIEOpRemoval<AIE::RtpOp>>(
+          m.getContext(), m);
+
+  if (failed(applyPartialConversion(m, target, std::move(removepatterns))))
+    return failure();
+
+  if (shareCores) {
+    SmallVector<func::FuncOp, 16> coreFuncs;
+    for (const std::string &name : coreNames)
+      if (auto coreFunc = m.lookupSymbol<func::FuncOp>(name))
+        coreFuncs.push_back(coreFunc);
+    shareCoreFuncs(m, coreFuncs);
+  }
+  return success();
+}
+
 struct AIECoreToStandardPass
     : public AIECoreToStandardBase<AIECoreToStandardPass> {
-  void runOnOperation() override {
+  void getDependentDialects(DialectRegistry &registry) const override {
+    AIECoreToStandardBase<AIECoreToStandardPass>::getDependentDialects(
+        registry);
+    // The dialects of the core pipeline cannot be loaded once the cores are
+    // lowered in parallel.
+    OpPassManager pm(ModuleOp::getOperationName(),
+                     OpPassManager::Nesting::Implicit);
+    if (succeeded(parsePassPipeline(corePipeline, pm, llvm::nulls())))
+      pm.getDependentDialects(registry);
+  }
+
+  // Lower the core of tile (col, row) in a copy of module m, run the core
+  // pipeline on it, and write it to core_<col>_<row>.mlir in the output
+  // directory.
+  LogicalResult lowerCore(ModuleOp m, int col, int row) {
+    OwningOpRef<ModuleOp> core = m.clone();
+    if (failed(lowerToStandard(*core, col, row, false, constantAddresses)))
+      return failure();
+    if (!corePipeline.empty()) {
+      PassManager pm(m.getContext(), ModuleOp::getOperationName(),
+                     OpPassManager::Nesting::Implicit);
+      if (failed(parsePassPipeline(corePipeline, pm)) ||
+          failed(pm.run(*core)))
+        return failure();
+    }
+    SmallString<128> path(outputDir);
+    llvm::sys::path::append(path, "core_" + std::to_string(col) + "_" +
+                                      std::to_string(row) + ".mlir");
+    std::error_code EC;
+    llvm::raw_fd_ostream os(path, EC,
+                            emitBytecode ? llvm::sys::fs::OF_None
+                                         : llvm::sys::fs::OF_Text);
+    if (EC)
+      return m.emitError("Unable to open ") << path << ": " << EC.message();
+    if (emitBytecode)
+      return writeBytecodeToFile(*core, os);
+    core->print(os);
+    return success();
+  }
 
+  void runOnOperation() override {
     ModuleOp m = getOperation();
-    OpBuilder builder = OpBuilder::atBlockEnd(m.getBody());
+    if (outputDir.empty()) {
+      // The cores sharing code get their buffers as arguments.
+      if (failed(lowerToStandard(m, tileCol, tileRow, shareCores,
+                                 constantAddresses && !shareCores)))
+        signalPassFailure();
+      return;
+    }
 
     if (m.getOps<DeviceOp>().empty()) {
       m.emitOpError("expected AIE.device operation at toplevel");
-      signalPassFailure();
+      return signalPassFailure();
+    }
+    if (std::error_code EC = llvm::sys::fs::create_directories(outputDir)) {
+      m.emitError("Unable to create directory ")
+          << outputDir << ": " << EC.message();
+      return signalPassFailure();
     }
     DeviceOp device = *(m.getOps<DeviceOp>().begin());
-    const auto &target_model = device.getTargetModel();
-    const char *triple;
-    switch (target_model.getTargetArch()) {
-    case AIEArch::AIE1:
-      triple = "aie";
-      break;
-    case AIEArch::AIE2:
-      triple = "aie2";
-      break;
+    SmallVector<std::pair<int, int>, 16> tiles;
+    for (auto core : device.getOps<CoreOp>()) {
+      int col = core.colIndex();
+      int row = core.rowIndex();
+      if (((int)tileCol == -1 || col == (int)tileCol) &&
+          ((int)tileRow == -1 || row == (int)tileRow))
+        tiles.push_back({col, row});
     }
-
-    // Ensure that we don't have an incorrect target triple.  This may override
-    // some bogus target triple in the original mlir.  In reality this should
-    // pick the 'aie' target triple.
-    m->setAttr(LLVM::LLVMDialect::getTargetTripleAttrName(),
-               builder.getStringAttr(triple));
-
-    // Extract all CoreOps
-    // Create an LLVM func for each CoreOp
-    // Clone the region body of each CoreOp to the newly created LLVM func
-
-    DenseMap<std::pair<int, int>, Operation *> tiles;
-    DenseMap<Operation *, CoreOp> cores;
-    DenseMap<Operation *, MemOp> mems;
-    DenseMap<std::pair<Operation *, int>, LockOp> locks;
-    DenseMap<Operation *, SmallVector<BufferOp, 4>> tileToBuffers;
-    DenseMap<Operation *, SwitchboxOp> switchboxes;
-
-    NetlistAnalysis NL(device, tiles, cores, mems, locks, tileToBuffers,
-                       switchboxes);
-    NL.collectTiles(tiles);
-    NL.collectCores(cores);
-    NL.collectBuffers(tileToBuffers);
-
-    // Populate intrinsic functions
-    // Intrinsic information:
-    // peano/llvm-project/llvm/lib/Target/AIE/AIEInstrInfo.td Also take a look
-    // at the tests: peano/llvm-project/llvm/test/CodeGen/AIE
-    builder.setInsertionPointToStart(m.getBody());
-
-    SmallVector<Type, 2> callArgTypes;
-
-    Type int32Type = IntegerType::get(builder.getContext(), 32);
-    Type int128Type = IntegerType::get(builder.getContext(), 128);
-    Type int384Type = IntegerType::get(builder.getContext(), 384);
-    Type floatType = FloatType::getF32(builder.getContext());
-
-    // Note that not all of these are valid for a particular design, or needed.
-    // For right now, we will just accept the noise.
-
-    // llvm.func @debug_i32(%val: !llvm.i32) -> ()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "debug_i32",
-            FunctionType::get(builder.getContext(), {int32Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.event0() -> ()
-    builder
-        .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.event0",
-                              FunctionType::get(builder.getContext(), {}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.event1() -> ()
-    builder
-        .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.event1",
-                              FunctionType::get(builder.getContext(), {}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.put.ms(%channel: !llvm.i1, %stream_val: !llvm.i32) ->
-    // ()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.put.ms",
-            FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.put.mws(%channel: !llvm.i1, %stream_val: !llvm.i128)
-    // -> ()
-    builder
-        .create<func::FuncOp>(builder.getUnknownLoc(), "llvm.aie.put.wms",
-                              FunctionType::get(builder.getContext(),
-                                                {int32Type, int128Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.put.mfs(%channel: !llvm.i1, %stream_val: !llvm.float)
-    // -> ()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.put.fms",
-            FunctionType::get(builder.getContext(), {int32Type, floatType}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.get.ss(%channel: !llvm.i1) -> !llvm.i32
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.get.ss",
-            FunctionType::get(builder.getContext(), {int32Type}, {int32Type}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.get.wss(%channel: !llvm.i1) -> !llvm.i128
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.get.wss",
-            FunctionType::get(builder.getContext(), {int32Type}, {int128Type}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.get.fss(%channel: !llvm.i1) -> !llvm.float
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.get.fss",
-            FunctionType::get(builder.getContext(), {int32Type}, {floatType}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.put.scd(%scd_val: !llvm.i384) -> ()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.put.mcd",
-            FunctionType::get(builder.getContext(), {int384Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.get.scd() -> !llvm.i384
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.get.scd",
-            FunctionType::get(builder.getContext(), {}, {int384Type}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.lock.acquire.reg(%lock_id: !llvm.i32, %lock_val:
-    // !llvm.i32) ->()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.lock.acquire.reg",
-            FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie.lock.release.reg(%lock_id: !llvm.i32, %lock_val:
-    // !llvm.i32) ->()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie.lock.release.reg",
-            FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie2.acquire(%lock_id: !llvm.i32, %lock_val:
-    // !llvm.i32) ->()v
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie2.acquire",
-            FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
-        .setPrivate();
-
-    // llvm.func @llvm.aie2.release(%lock_id: !llvm.i32, %lock_val:
-    // !llvm.i32) ->()
-    builder
-        .create<func::FuncOp>(
-            builder.getUnknownLoc(), "llvm.aie2.release",
-            FunctionType::get(builder.getContext(), {int32Type, int32Type}, {}))
-        .setPrivate();
-
-    IRMapping mapper;
-    ConversionTarget target(getContext());
-    target.addLegalDialect<func::FuncDialect>();
-    target.addLegalDialect<cf::ControlFlowDialect>();
-    target.addLegalDialect<memref::MemRefDialect>();
-    target.addLegalDialect<VectorDialect>();
-    target.addLegalDialect<arith::ArithDialect>();
-    target.addLegalDialect<math::MathDialect>();
-    target.addLegalOp<func::FuncOp, ModuleOp>();
-
-    RewritePatternSet patterns(&getContext());
-    patterns.add<AIEPutStreamToStdLowering, AIEGetStreamToStdLowering,
-                 AIEPutCascadeToStdLowering, AIEGetCascadeToStdLowering,
-                 AIEDebugOpToStdLowering, AIEUseLockToStdLowering,
-                 AIEEventOpToStdLowering>(m.getContext(), m);
-
-    patterns.add<AIEBufferToStandard>(m.getContext(), m, mapper);
-    if (failed(applyPartialConversion(m, target, std::move(patterns))))
-      signalPassFailure();
-
-    RewritePatternSet outlinePatterns(&getContext());
-    outlinePatterns.add<AIECoreToStandardFunc>(
-        m.getContext(), m, mapper, tileToBuffers, 1, tileCol, tileRow);
-    if (failed(applyPartialConversion(m, target, std::move(outlinePatterns))))
-      signalPassFailure();
-
-    // Move all the func.func ops and memref.globals from the device to the
-    // module
-    outlineOps<memref::GlobalOp>(device);
-    outlineOps<func::FuncOp>(device);
-
-    RewritePatternSet removepatterns(&getContext());
-    removepatterns
-        .add<AIEOpRemoval<AIE::DeviceOp>, AIEOpRemoval<AIE::TileOp>,
-             AIEOpRemoval<AIE::FlowOp>, AIEOpRemoval<AIE::MemOp>,
-             AIEOpRemoval<AIE::ShimDMAOp>, AIEOpRemoval<AIE::ShimMuxOp>,
-             AIEOpRemoval<AIE::SwitchboxOp>, AIEOpRemoval<AIE::LockOp>,
-             AIEOpRemoval<AIE::BufferOp>, AIEOpRemoval<AIE::ExternalBufferOp>,
-             AIEOpRemoval<AIE::ShimDMAAllocationOp>>(m.getContext(), m);
-
-    if (failed(applyPartialConversion(m, target, std::move(removepatterns))))
+    // The module is only read while the copies of the cores are lowered.
+    if (failed(failableParallelForEach(
+            m.getContext(), tiles, [&](std::pair<int, int> tile) {
+              return lowerCore(m, tile.first, tile.second);
+            })))
       signalPassFailure();
   }
 };
@@ -10,13 +10,22 @@
 
 #include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "aie/Dialect/AIE/Transforms/AIERoutingGraph.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/Location.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Support/MathExtras.h"
+
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+#include <tuple>
 
 #define DEBUG_TYPE "aie-create-packet-flows"
 
@@ -45,11 +54,23 @@ struct AIEOpRemoval : public OpConversionPattern<MyOp> {
 // A port on a switch is identified by the tile and port name.
 typedef std::pair<Operation *, Port> PhysPort;
 
-int getAvailableDestChannel(SmallVector<std::pair<Connect, int>, 8> &connects,
-                            Port sourcePort, int flowID,
-                            WireBundle destBundle) {
+// Master ports of each switchbox driven by circuit-switched connections.
+typedef DenseMap<std::pair<int, int>, SmallVector<Port, 8>> CircuitPortMap;
+
+// Expected bandwidth of each packet flow ID, in percent of a stream channel.
+// IDs without a bandwidth attribute are not in the map.
+typedef DenseMap<int, int> FlowBandwidthMap;
+
+// Packet-switched routes cannot use the master ports in circuitPorts, which
+// are already driven by circuit-switched connections.  A channel carrying
+// other packet IDs is only shared while the total bandwidth of the IDs on it
+// stays within the bandwidth of the channel.
+int getAvailableDestChannel(
+    SmallVector<std::pair<Connect, int>, 8> &connects, Port sourcePort,
+    int flowID, WireBundle destBundle, ArrayRef<Port> circuitPorts = {},
+    const FlowBandwidthMap &bandwidths = FlowBandwidthMap()) {
 
-  if (connects.size() == 0)
+  if (connects.size() == 0 && circuitPorts.empty())
     return 0;
 
   int numChannels;
@@ -66,19 +87,27 @@ int getAvailableDestChannel(SmallVector<std::pair<Connect, int>, 8> &connects,
   for (int i = 0; i < numChannels; i++) {
     Port port = std::make_pair(destBundle, i);
     int countFlows = 0;
+    int load = bandwidths.lookup(flowID);
+    bool sameFlow = false;
+    SmallSet<int, 8> flowIDs;
     for (auto conn : connects) {
       Port connDest = conn.first.second;
       // Since we are doing packet-switched routing, dest ports can be shared
       // among multiple sources. Therefore, we don't need to worry about
       // checking the same source
-      if (connDest == port)
+      if (connDest == port) {
         countFlows++;
+        if (conn.second == flowID)
+          sameFlow = true;
+        else if (flowIDs.insert(conn.second).second)
+          load += bandwidths.lookup(conn.second);
+      }
     }
 
     // Since a mask has 5 bits, there can only be 32 logical streams flow
     // through a port
     // TODO: what about packet-switched flow that uses nested header?
-    if (countFlows > 0 && countFlows < 32)
+    if (countFlows > 0 && countFlows < 32 && (sameFlow || load <= 100))
       return i;
   }
 
@@ -88,6 +117,7 @@ int getAvailableDestChannel(SmallVector<std::pair<Connect, int>, 8> &connects,
     SmallVector<Port, 8> ports;
     for (auto connect : connects)
       ports.push_back(connect.first.second);
+    ports.append(circuitPorts.begin(), circuitPorts.end());
 
     if (std::find(ports.begin(), ports.end(), port) == ports.end())
       return i;
@@ -118,7 +148,8 @@ void buildPSRoute(
     int xSrc, int ySrc, Port sourcePort, int xDest, int yDest, Port destPort,
     int flowID,
     DenseMap<std::pair<int, int>, SmallVector<std::pair<Connect, int>, 8>>
-        &switchboxes) {
+        &switchboxes,
+    CircuitPortMap &circuitPorts, const FlowBandwidthMap &bandwidths) {
   int xCur = xSrc;
   int yCur = ySrc;
   WireBundle curBundle;
@@ -161,8 +192,9 @@ void buildPSRoute(
 
     for (unsigned i = 0; i < moves.size(); i++) {
       WireBundle move = moves[i];
-      curChannel = getAvailableDestChannel(switchboxes[curCoord], lastPort,
-                                           flowID, move);
+      curChannel =
+          getAvailableDestChannel(switchboxes[curCoord], lastPort, flowID, move,
+                                  circuitPorts[curCoord], bandwidths);
       if (curChannel == -1)
         continue;
 
@@ -218,6 +250,176 @@ void buildPSRoute(
       std::make_pair(std::make_pair(lastPort, destPort), flowID));
 }
 
+static WireBundle getOppositeBundle(WireBundle move) {
+  return (move == WireBundle::East)    ? WireBundle::West
+         : (move == WireBundle::West)  ? WireBundle::East
+         : (move == WireBundle::North) ? WireBundle::South
+         : (move == WireBundle::South) ? WireBundle::North
+                                       : move;
+}
+
+// PacketRouter routes packet-switched flows over the RoutingGraph of the device
+// with a congestion-aware cost, rather than always going horizontally and then
+// vertically.  Like Pathfinder, every hop costs 1 plus a congestion term,
+// which grows with the number of packet IDs already sharing the Channel, with
+// the number of channels taken by circuit-switched connections, and with the
+// number of packet IDs that need an arbiter/msel and a packet rule in the
+// switchbox being entered.  Hops already used by the same packet ID are
+// nearly free, so that the destinations of a flow share a common tree.
+class PacketRouter {
+  typedef RoutingGraph::VertexID VertexID;
+  typedef RoutingGraph::EdgeID EdgeID;
+
+  RoutingGraph graph;
+  // number of packet IDs routed through each switchbox
+  std::vector<unsigned int> switchboxLoad;
+  std::set<std::pair<EdgeID, int>> edgeFlows;
+  std::set<std::pair<VertexID, int>> switchboxFlows;
+
+  const float packetLoadCoeff = 0.1;  // per packet ID sharing a Channel
+  const float packetRuleCoeff = 0.05; // per packet ID using a switchbox
+  const float sharedHopCost = 0.01;   // hop already used by the same ID
+  const float circuitCoeff = 0.25;    // per channel used by a circuit flow
+
+  CircuitPortMap &circuitPorts;
+  const FlowBandwidthMap &bandwidths;
+
+public:
+  PacketRouter(DeviceOp &device, CircuitPortMap &circuitPorts,
+               const FlowBandwidthMap &bandwidths)
+      : circuitPorts(circuitPorts), bandwidths(bandwidths) {
+    int maxcol = 0, maxrow = 0;
+    for (TileOp tileOp : device.getOps<TileOp>()) {
+      maxcol = std::max(maxcol, tileOp.colIndex());
+      maxrow = std::max(maxrow, tileOp.rowIndex());
+    }
+    graph.initialize(maxcol, maxrow, device.getTargetModel());
+    switchboxLoad.assign(graph.numVertices(), 0);
+    for (auto &ports : circuitPorts) {
+      if (!graph.isInGraph(ports.first.first, ports.first.second))
+        continue;
+      VertexID v = graph.getVertex(ports.first.first, ports.first.second);
+      for (Port port : ports.second) {
+        EdgeID e;
+        if (graph.findOutEdge(v, port.first, e))
+          graph.addFixedChannel(e, port.second);
+      }
+    }
+  }
+
+  // Build the route for one destination of a packet flow and record it in the
+  // given map of switchboxes.  Returns false without changing the map if no
+  // route could be found.
+  bool buildRoute(
+      int xSrc, int ySrc, Port sourcePort, int xDest, int yDest, Port destPort,
+      int flowID,
+      DenseMap<std::pair<int, int>, SmallVector<std::pair<Connect, int>, 8>>
+          &switchboxes) {
+    if (!graph.isInGraph(xSrc, ySrc) || !graph.isInGraph(xDest, yDest))
+      return false;
+    VertexID src = graph.getVertex(xSrc, ySrc);
+    VertexID dst = graph.getVertex(xDest, yDest);
+
+    // Dijkstra from src, stopping as soon as dst is reached
+    std::vector<float> cost(graph.numVertices(),
+                            std::numeric_limits<float>::infinity());
+    std::vector<EdgeID> predEdge(graph.numVertices());
+    std::vector<bool> closed(graph.numVertices(), false);
+    typedef std::pair<float, VertexID> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                        std::greater<QueueEntry>>
+        open;
+    cost[src] = 0;
+    open.push(std::make_pair(0.0f, src));
+    while (!open.empty()) {
+      VertexID curr = open.top().second;
+      open.pop();
+      if (closed[curr])
+        continue;
+      closed[curr] = true;
+      if (curr == dst)
+        break;
+      const Switchbox &sb = graph.getSwitchbox(curr);
+      auto coord = std::make_pair((int)sb.col, (int)sb.row);
+      auto &connects = switchboxes[coord];
+      for (EdgeID e = graph.outEdgesBegin(curr); e != graph.outEdgesEnd(curr);
+           e++) {
+        VertexID next = graph.edgeTarget[e];
+        if (closed[next])
+          continue;
+        float hopCost;
+        if (edgeFlows.count(std::make_pair(e, flowID))) {
+          hopCost = sharedHopCost;
+        } else {
+          // all channels in this direction already carry 32 packet IDs, or
+          // have no bandwidth left for this one
+          if (getAvailableDestChannel(connects, sourcePort, flowID,
+                                      graph.bundle[e], circuitPorts[coord],
+                                      bandwidths) == -1)
+            continue;
+          hopCost = 1 + packetLoadCoeff * graph.usedCapacity[e] +
+                    circuitCoeff * graph.numFixedChannels(e);
+          if (!switchboxFlows.count(std::make_pair(next, flowID)))
+            hopCost *= 1 + packetRuleCoeff * switchboxLoad[next];
+        }
+        if (cost[curr] + hopCost < cost[next]) {
+          cost[next] = cost[curr] + hopCost;
+          predEdge[next] = e;
+          open.push(std::make_pair(cost[next], next));
+        }
+      }
+    }
+    if (!closed[dst])
+      return false;
+
+    SmallVector<EdgeID, 16> path;
+    for (VertexID v = dst; v != src; v = graph.edgeSource[predEdge[v]])
+      path.push_back(predEdge[v]);
+    std::reverse(path.begin(), path.end());
+
+    LLVM_DEBUG(llvm::dbgs() << "Build congestion-aware route ID " << flowID
+                            << ": " << xSrc << " " << ySrc << " --> " << xDest
+                            << " " << yDest << '\n');
+    Port lastPort = sourcePort;
+    for (EdgeID e : path) {
+      const Switchbox &sb = graph.getSwitchbox(graph.edgeSource[e]);
+      auto curCoord = std::make_pair((int)sb.col, (int)sb.row);
+      WireBundle move = graph.bundle[e];
+      int curChannel =
+          getAvailableDestChannel(switchboxes[curCoord], lastPort, flowID, move,
+                                  circuitPorts[curCoord], bandwidths);
+      assert(curChannel >= 0 && "Could not find available destination port!");
+      LLVM_DEBUG(llvm::dbgs()
+                 << "Tile " << sb.col << " " << sb.row << " "
+                 << stringifyWireBundle(lastPort.first) << " "
+                 << lastPort.second << " -> " << stringifyWireBundle(move)
+                 << " " << curChannel << "\n");
+      Connect connect =
+          std::make_pair(lastPort, std::make_pair(move, curChannel));
+      // If there is no connection with this ID going where we want to go..
+      if (std::find(switchboxes[curCoord].begin(), switchboxes[curCoord].end(),
+                    std::make_pair(connect, flowID)) ==
+          switchboxes[curCoord].end())
+        // then add one.
+        switchboxes[curCoord].push_back(std::make_pair(connect, flowID));
+      lastPort = std::make_pair(getOppositeBundle(move), curChannel);
+
+      if (edgeFlows.insert(std::make_pair(e, flowID)).second)
+        graph.usedCapacity[e]++;
+    }
+    switchboxes[std::make_pair(xDest, yDest)].push_back(
+        std::make_pair(std::make_pair(lastPort, destPort), flowID));
+
+    if (switchboxFlows.insert(std::make_pair(src, flowID)).second)
+      switchboxLoad[src]++;
+    for (EdgeID e : path)
+      if (switchboxFlows.insert(std::make_pair(graph.edgeTarget[e], flowID))
+              .second)
+        switchboxLoad[graph.edgeTarget[e]]++;
+    return true;
+  }
+};
+
 SwitchboxOp getOrCreateSwitchbox(OpBuilder &builder, TileOp tile) {
   for (auto i : tile.getResult().getUsers()) {
     if (llvm::isa<SwitchboxOp>(*i)) {
@@ -226,6 +428,54 @@ SwitchboxOp getOrCreateSwitchbox(OpBuilder &builder, TileOp tile) {
   }
   return builder.create<SwitchboxOp>(builder.getUnknownLoc(), tile);
 }
+
+/// Function that returns the packet rules, as pairs of a mask and a value,
+/// which match all the packet IDs of ids and none of the other IDs of
+/// usedIDs.  The IDs no packet flow uses are don't cares, so that one rule
+/// can match a range of IDs with gaps.  The rules are picked greedily, each
+/// matching the most IDs of ids not matched yet, then the fewest IDs.
+static SmallVector<std::pair<int, int>, 4>
+coverPacketIDs(ArrayRef<int> ids, const std::set<int> &usedIDs) {
+  std::set<int> onSet(ids.begin(), ids.end());
+  std::set<int> uncovered(onSet);
+  SmallVector<std::pair<int, int>, 4> rules;
+  while (!uncovered.empty()) {
+    int bestMask = 0, bestValue = 0, bestCovered = 0, bestSize = 0;
+    for (int mask = 0; mask < 32; mask++) {
+      int size = 1;
+      for (int bit = 0; bit < 5; bit++)
+        if (!((mask >> bit) & 0x1))
+          size *= 2;
+      for (int value = 0; value < 32; value++) {
+        if (value & ~mask)
+          continue;
+        auto matches = [&](int ID) { return (ID & mask) == value; };
+        if (llvm::any_of(usedIDs, [&](int ID) {
+              return matches(ID) && !onSet.count(ID);
+            }))
+          continue;
+        int covered = llvm::count_if(uncovered, matches);
+        if (covered > bestCovered ||
+            (covered == bestCovered && covered > 0 && size < bestSize)) {
+          bestMask = mask;
+          bestValue = value;
+          bestCovered = covered;
+          bestSize = size;
+        }
+      }
+    }
+    // A rule matching a single ID is always valid.
+    assert(bestCovered > 0 && "no packet rule matches the ID");
+    rules.push_back(std::make_pair(bestMask, bestValue));
+    for (auto it = uncovered.begin(); it != uncovered.end();)
+      if ((*it & bestMask) == bestValue)
+        it = uncovered.erase(it);
+      else
+        it++;
+  }
+  return rules;
+}
+
 struct AIERoutePacketFlowsPass
     : public AIERoutePacketFlowsBase<AIERoutePacketFlowsPass> {
   // Map from tile coordinates to TileOp
@@ -240,11 +490,126 @@ struct AIERoutePacketFlowsPass
     }
     return tileOp;
   }
+
+  /// Function that renumbers the packet flows of device so that the IDs with
+  /// the same routes form an aligned range of a power of two IDs, which one
+  /// packet rule of each slave port on the routes matches.  The packet
+  /// headers written by the DMAs of the sources, and the IDs of the control
+  /// packets of aie-route-control-packets, follow their flows.  The IDs of
+  /// the flows from other ports than DMAs, such as traces or cores, are kept.
+  void assignPacketIDs(DeviceOp device) {
+    // Packet IDs have five bits.
+    int numPacketIDs = 32;
+    // The source and destination ports of a route, by column, row, bundle
+    // and channel.
+    typedef std::tuple<int, int, int, int, int, int, int, int> Route;
+    std::map<int, std::set<Route>> routes;
+    std::set<int> fixedIDs;
+    for (auto pktflow : device.getOps<PacketFlowOp>()) {
+      int ID = pktflow.IDInt();
+      TileOp srcTile;
+      Port sourcePort;
+      for (Operation &op : pktflow.getPorts().front()) {
+        if (auto pktSource = dyn_cast<PacketSourceOp>(op)) {
+          srcTile = pktSource.getTile().getDefiningOp<TileOp>();
+          sourcePort = pktSource.port();
+          if (sourcePort.first != WireBundle::DMA)
+            fixedIDs.insert(ID);
+        } else if (auto pktDest = dyn_cast<PacketDestOp>(op)) {
+          TileOp destTile = pktDest.getTile().getDefiningOp<TileOp>();
+          Port destPort = pktDest.port();
+          routes[ID].insert(std::make_tuple(
+              srcTile.colIndex(), srcTile.rowIndex(),
+              static_cast<int>(sourcePort.first), sourcePort.second,
+              destTile.colIndex(), destTile.rowIndex(),
+              static_cast<int>(destPort.first), destPort.second));
+        }
+      }
+    }
+
+    // The IDs with the same routes share their packet rules, the largest
+    // groups get their range first.
+    std::map<std::set<Route>, SmallVector<int, 4>> classes;
+    for (auto &[ID, idRoutes] : routes)
+      if (!fixedIDs.count(ID))
+        classes[idRoutes].push_back(ID);
+    SmallVector<SmallVector<int, 4>, 8> groups;
+    for (auto &idClass : classes)
+      groups.push_back(idClass.second);
+    std::stable_sort(groups.begin(), groups.end(),
+                     [](const auto &a, const auto &b) {
+                       return a.size() > b.size();
+                     });
+
+    std::vector<bool> usedIDs(numPacketIDs);
+    for (int ID : fixedIDs)
+      if (ID < numPacketIDs)
+        usedIDs[ID] = true;
+    DenseMap<int, int> newIDs;
+    for (auto &group : groups) {
+      int size = llvm::PowerOf2Ceil(group.size());
+      int base = -1;
+      for (int b = 0; base < 0 && b + size <= numPacketIDs; b += size)
+        if (std::none_of(usedIDs.begin() + b, usedIDs.begin() + b + size,
+                         [](bool used) { return used; }))
+          base = b;
+      if (base < 0) {
+        device.emitWarning("the packet flows need more than ")
+            << numPacketIDs << " packet IDs in aligned ranges, keeping "
+            << "their IDs";
+        return;
+      }
+      std::fill(usedIDs.begin() + base, usedIDs.begin() + base + size, true);
+      for (auto [i, ID] : llvm::enumerate(group)) {
+        LLVM_DEBUG(llvm::dbgs() << "Packet ID " << ID << " -> " << base + i
+                                << "\n");
+        newIDs[ID] = base + i;
+      }
+    }
+
+    // Collect everything first, the old and new IDs overlap.
+    OpBuilder builder(device.getContext());
+    DenseMap<Operation *, int> headers;
+    DenseMap<Operation *, int> controlledTiles;
+    SmallVector<std::pair<PacketFlowOp, int>, 8> flows;
+    for (auto pktflow : device.getOps<PacketFlowOp>()) {
+      auto newID = newIDs.find(pktflow.IDInt());
+      if (newID == newIDs.end())
+        continue;
+      flows.push_back(std::make_pair(pktflow, newID->second));
+      for (Operation &op : pktflow.getPorts().front()) {
+        if (auto pktSource = dyn_cast<PacketSourceOp>(op)) {
+          for (Operation *user : pktSource.getTile().getUsers())
+            if (isa<MemOp, MemTileDMAOp, ShimDMAOp>(user))
+              user->walk([&](DMABDPACKETOp header) {
+                if (static_cast<int>(header.getPacketId()) == newID->first)
+                  headers[header] = newID->second;
+              });
+        } else if (auto pktDest = dyn_cast<PacketDestOp>(op)) {
+          Operation *tile = pktDest.getTile().getDefiningOp();
+          auto ctrlID = tile->getAttrOfType<IntegerAttr>("ctrl_packet_id");
+          if (ctrlID && ctrlID.getInt() == newID->first)
+            controlledTiles[tile] = newID->second;
+        }
+      }
+    }
+    for (auto [pktflow, ID] : flows)
+      pktflow.setIDAttr(builder.getI8IntegerAttr(ID));
+    for (auto [header, ID] : headers)
+      cast<DMABDPACKETOp>(header).setPacketIdAttr(
+          builder.getI32IntegerAttr(ID));
+    for (auto [tile, ID] : controlledTiles)
+      tile->setAttr("ctrl_packet_id", builder.getI32IntegerAttr(ID));
+  }
+
   void runOnOperation() override {
 
     DeviceOp device = getOperation();
     OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
 
+    if (assignIDs)
+      assignPacketIDs(device);
+
     ConversionTarget target(getContext());
 
     // Some communication patterns:
@@ -266,6 +631,10 @@ struct AIERoutePacketFlowsPass
 
     // Map from a port and flowID to
     DenseMap<std::pair<PhysPort, int>, SmallVector<PhysPort, 4>> packetFlows;
+    // The keys of packetFlows in the order they were added.  packetFlows is
+    // keyed by Operation pointers, so it is iterated in this order instead to
+    // keep the arbiter assignment the same in every run.
+    SmallVector<std::pair<PhysPort, int>, 4> packetFlowOrder;
     SmallVector<std::pair<PhysPort, int>, 4> slavePorts;
     DenseMap<std::pair<PhysPort, int>, int> slaveAMSels;
 
@@ -278,6 +647,23 @@ struct AIERoutePacketFlowsPass
     // The logical model of all the switchboxes.
     DenseMap<std::pair<int, int>, SmallVector<std::pair<Connect, int>, 8>>
         switchboxes;
+    // Circuit-switched routes and packet-switched routes share the same
+    // switchbox ports, so collect the master ports already driven by
+    // circuit-switched connections (e.g. from aie-create-pathfinder-flows).
+    CircuitPortMap circuitPorts;
+    for (auto switchboxOp : device.getOps<SwitchboxOp>())
+      for (auto connectOp : switchboxOp.getOps<ConnectOp>())
+        circuitPorts[std::make_pair(switchboxOp.colIndex(),
+                                    switchboxOp.rowIndex())]
+            .push_back(connectOp.destPort());
+    FlowBandwidthMap bandwidths;
+    for (auto pktflow : device.getOps<PacketFlowOp>())
+      if (pktflow.getBandwidth().has_value())
+        bandwidths[pktflow.IDInt()] = std::max<int>(
+            bandwidths.lookup(pktflow.IDInt()), pktflow.getBandwidth().value());
+    std::unique_ptr<PacketRouter> router;
+    if (congestionAware)
+      router = std::make_unique<PacketRouter>(device, circuitPorts, bandwidths);
     for (auto pktflow : device.getOps<PacketFlowOp>()) {
       Region &r = pktflow.getPorts();
       Block &b = r.front();
@@ -298,22 +684,32 @@ struct AIERoutePacketFlowsPass
           int yDest = destTile.rowIndex();
           Port destPort = pktDest.port();
 
-          buildPSRoute(xSrc, ySrc, sourcePort, xDest, yDest, destPort, flowID,
-                       switchboxes);
+          if (!router ||
+              !router->buildRoute(xSrc, ySrc, sourcePort, xDest, yDest,
+                                  destPort, flowID, switchboxes))
+            buildPSRoute(xSrc, ySrc, sourcePort, xDest, yDest, destPort,
+                         flowID, switchboxes, circuitPorts, bandwidths);
         }
       }
     }
 
     LLVM_DEBUG(llvm::dbgs() << "Check switchboxes\n");
 
-    for (auto swbox : switchboxes) {
-      int col = swbox.first.first;
-      int row = swbox.first.second;
+    // Visit the switchboxes in coordinate order, so that missing tiles are
+    // created in the same order in every run.
+    SmallVector<std::pair<int, int>, 16> switchboxCoords;
+    for (auto &swbox : switchboxes)
+      switchboxCoords.push_back(swbox.first);
+    std::sort(switchboxCoords.begin(), switchboxCoords.end());
+
+    for (auto coord : switchboxCoords) {
+      int col = coord.first;
+      int row = coord.second;
       Operation *tileOp = getOrCreateTile(builder, col, row);
 
       LLVM_DEBUG(llvm::dbgs()
                  << "***switchbox*** " << col << " " << row << '\n');
-      SmallVector<std::pair<Connect, int>, 8> connects(swbox.second);
+      SmallVector<std::pair<Connect, int>, 8> connects(switchboxes[coord]);
       for (auto connect : connects) {
         Port sourcePort = connect.first.first;
         Port destPort = connect.first.second;
@@ -330,6 +726,8 @@ struct AIERoutePacketFlowsPass
 
         auto sourceFlow =
             std::make_pair(std::make_pair(tileOp, sourcePort), flowID);
+        if (!packetFlows.count(sourceFlow))
+          packetFlowOrder.push_back(sourceFlow);
         packetFlows[sourceFlow].push_back(std::make_pair(tileOp, destPort));
         slavePorts.push_back(sourceFlow);
       }
@@ -352,13 +750,16 @@ struct AIERoutePacketFlowsPass
     DenseMap<Operation *, int> amselValues;
     int numMsels = 4;
     int numArbiters = 6;
+    // Each slave port has four packet rules.
+    int numRuleSlots = 4;
 
     // Check all multi-cast flows (same source, same ID). They should be
     // assigned the same arbiter and msel so that the flow can reach all the
     // destination ports at the same time For destination ports that appear in
     // different (multicast) flows, it should have a different <arbiterID, msel>
     // value pair for each flow
-    for (auto packetFlow : packetFlows) {
+    for (auto &sourceFlow : packetFlowOrder) {
+      auto packetFlow = *packetFlows.find(sourceFlow);
       // The Source Tile of the flow
       Operation *tileOp = packetFlow.first.first.first;
       if (amselValues.count(tileOp) == 0)
@@ -378,16 +779,17 @@ struct AIERoutePacketFlowsPass
       // If there is an assignment of an arbiter to a master port before, we
       // assign all the master ports here with the same arbiter but different
       // msel
+      // Look at the assignments in order of their amsel value rather than in
+      // the (pointer dependent) order of masterAMSels.
       bool foundMatchedDest = false;
-      for (auto map : masterAMSels) {
-        if (map.first.first != tileOp)
+      for (int value = 0; value < numArbiters * numMsels; value++) {
+        auto map = masterAMSels.find(std::make_pair(tileOp, value));
+        if (map == masterAMSels.end())
           continue;
-        amselValue = map.first.second;
+        amselValue = value;
 
         // check if same destinations
-        // SmallVector<Port, 4> ports(map.second);
-        SmallVector<Port, 4> ports(
-            masterAMSels[std::make_pair(tileOp, amselValue)]);
+        SmallVector<Port, 4> ports(map->second);
         if (ports.size() != packetFlow.second.size())
           continue;
 
@@ -443,6 +845,10 @@ struct AIERoutePacketFlowsPass
         mastersets[physPort].push_back(amselValue);
       }
     }
+    // masterAMSels is iterated in pointer order, so sort the amsel values of
+    // each master set before they become operands of a masterset op.
+    for (auto &masterset : mastersets)
+      std::sort(masterset.second.begin(), masterset.second.end());
 
     LLVM_DEBUG(llvm::dbgs() << "CHECK mastersets\n");
 #ifndef NDEBUG
@@ -503,57 +909,40 @@ struct AIERoutePacketFlowsPass
       }
     }
 
-    DenseMap<std::pair<PhysPort, int>, int> slaveMasks;
-    for (auto group : slaveGroups) {
-      // Iterate over all the ID values in a group
-      // If bit n-th (n <= 5) of an ID value differs from bit n-th of another ID
-      // value, the bit position should be "don't care", and we will set the
-      // mask bit of that position to 0
-      int mask[5] = {-1, -1, -1, -1, -1};
-      for (auto port : group) {
-        int ID = port.second;
-        for (int i = 0; i < 5; i++) {
-          if (mask[i] == -1)
-            mask[i] = ((ID >> i) & 0x1);
-          else if (mask[i] != ((ID >> i) & 0x1))
-            mask[i] = 2; // found bit difference --> mark as "don't care"
-        }
-      }
-
-      int maskValue = 0;
-      for (int i = 4; i >= 0; i--) {
-        if (mask[i] == 2) // don't care
-          mask[i] = 0;
-        else
-          mask[i] = 1;
-        maskValue = (maskValue << 1) + mask[i];
-      }
+    // The packet rules of each group, which match the IDs of the group and
+    // no other ID of the device, so that the rules of a slave port never
+    // overlap.
+    std::set<int> usedIDs;
+    for (auto &sourceFlow : packetFlowOrder)
+      usedIDs.insert(sourceFlow.second);
+    SmallVector<SmallVector<std::pair<int, int>, 4>, 4> groupRules;
+    for (auto &group : slaveGroups) {
+      SmallVector<int, 4> ids;
       for (auto port : group)
-        slaveMasks[port] = maskValue;
+        ids.push_back(port.second);
+      groupRules.push_back(coverPacketIDs(ids, usedIDs));
     }
 
 #ifndef NDEBUG
     LLVM_DEBUG(llvm::dbgs() << "CHECK Slave Masks\n");
-    for (auto map : slaveMasks) {
-      auto port = map.first.first;
+    for (auto [group, rules] : llvm::zip(slaveGroups, groupRules)) {
+      auto port = group.front().first;
       TileOp tile = dyn_cast<TileOp>(port.first);
       WireBundle bundle = port.second.first;
       int channel = port.second.second;
-      int ID = map.first.second;
-      int mask = map.second;
 
       LLVM_DEBUG(llvm::dbgs()
                  << "Port " << tile << " " << stringifyWireBundle(bundle) << " "
                  << channel << '\n');
-      LLVM_DEBUG(llvm::dbgs() << "Mask "
-                              << "0x" << llvm::Twine::utohexstr(mask) << '\n');
-      LLVM_DEBUG(llvm::dbgs() << "ID "
-                              << "0x" << llvm::Twine::utohexstr(ID) << '\n');
-      for (int i = 0; i < 31; i++) {
-        if ((i & mask) == (ID & mask))
-          LLVM_DEBUG(llvm::dbgs() << "matches flow ID "
-                                  << "0x" << llvm::Twine::utohexstr(i) << '\n');
-      }
+      for (auto slave : group)
+        LLVM_DEBUG(llvm::dbgs() << "ID "
+                                << "0x" << llvm::Twine::utohexstr(slave.second)
+                                << '\n');
+      for (auto [mask, ID] : rules)
+        LLVM_DEBUG(llvm::dbgs()
+                   << "Mask "
+                   << "0x" << llvm::Twine::utohexstr(mask) << " value "
+                   << "0x" << llvm::Twine::utohexstr(ID) << '\n');
     }
 #endif
 
@@ -618,7 +1007,8 @@ struct AIERoutePacketFlowsPass
 
       // Generate the packet rules
       DenseMap<Port, PacketRulesOp> slaveRules;
-      for (auto group : slaveGroups) {
+      DenseMap<Port, int> numSlaveRules;
+      for (auto [group, rules] : llvm::zip(slaveGroups, groupRules)) {
         builder.setInsertionPoint(b.getTerminator());
 
         auto port = group.front().first;
@@ -629,14 +1019,16 @@ struct AIERoutePacketFlowsPass
         int channel = port.second.second;
         auto slave = port.second;
 
-        int mask = slaveMasks[group.front()];
-        int ID = group.front().second & mask;
+        numSlaveRules[slave] += rules.size();
+        if (numSlaveRules[slave] > numRuleSlots) {
+          swbox.emitOpError("needs more than ")
+              << numRuleSlots << " packet rules on "
+              << stringifyWireBundle(bundle) << " : " << channel
+              << ", use packet IDs in aligned ranges for the flows with the "
+              << "same routes";
+          return signalPassFailure();
+        }
 
-        // Verify that we actually map all the ID's correctly.
-#ifndef NDEBUG
-        for (auto slave : group)
-          assert((slave.second & mask) == ID);
-#endif
         Value amsel = amselOps[slaveAMSels[group.front()]];
 
         PacketRulesOp packetrules;
@@ -649,9 +1041,11 @@ struct AIERoutePacketFlowsPass
         } else
           packetrules = slaveRules[slave];
 
-        Block &rules = packetrules.getRules().front();
-        builder.setInsertionPoint(rules.getTerminator());
-        builder.create<PacketRuleOp>(builder.getUnknownLoc(), mask, ID, amsel);
+        Block &rulesBlock = packetrules.getRules().front();
+        builder.setInsertionPoint(rulesBlock.getTerminator());
+        for (auto [mask, ID] : rules)
+          builder.create<PacketRuleOp>(builder.getUnknownLoc(), mask, ID,
+                                       amsel);
       }
     }
 
@@ -8,6 +8,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "aie/Dialect/AIE/AIEDeviceIndex.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/IRMapping.h"
@@ -17,6 +18,11 @@
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/raw_os_ostream.h"
 
 #include <aie/Dialect/AIE/Transforms/AIEPathfinder.h>
@@ -31,16 +37,6 @@ static llvm::cl::opt<bool>
                llvm::cl::desc("Enable Debugging of Pathfinder routing process"),
                llvm::cl::init(false));
 
-#define BOOST_NO_EXCEPTIONS
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Winvalid-noreturn"
-#include <boost/throw_exception.hpp>
-void boost::throw_exception(std::exception const &e) {
-  // boost expects this exception to be defined.
-  assert(false);
-}
-#pragma clang diagnostic pop
-
 std::string stringifyDirs(std::set<Port> dirs) {
   unsigned int count = 0;
   std::string out = "{";
@@ -89,6 +85,111 @@ std::string stringifySwitchSettings(SwitchSettings settings) {
   return out + "\n";
 }
 
+// RoutingCache stores legal Pathfinder solutions on disk, keyed by a hash of
+// everything the routing depends on: the device, the size of the routing
+// graph, the router options, the flows and the fixed connections.  Routing an
+// unchanged set of flows again only needs to read back the switch settings.
+class RoutingCache {
+  std::string dir;
+  std::string key;
+
+  std::string getPath() const {
+    llvm::MD5 hasher;
+    hasher.update(key);
+    llvm::MD5::MD5Result result;
+    hasher.final(result);
+    SmallString<256> path(dir);
+    llvm::sys::path::append(path,
+                            Twine("pathfinder-") + result.digest() + ".route");
+    return std::string(path);
+  }
+
+public:
+  RoutingCache(StringRef dir) : dir(dir) {}
+
+  bool isEnabled() const { return !dir.empty(); }
+
+  void addToKey(const Twine &text) { key += text.str() + ";"; }
+  void addToKey(StringRef kind, Coord coords, Port port) {
+    addToKey(kind + " " + Twine(coords.first) + " " + Twine(coords.second) +
+             " " + Twine((int)port.first) + " " + Twine(port.second));
+  }
+
+  // Read the solution for the current key.  Returns false if there is no
+  // cached solution, or if it cannot be parsed.
+  bool load(Pathfinder &pathfinder, RoutingSolution &solution) {
+    auto buffer = llvm::MemoryBuffer::getFile(getPath());
+    if (!buffer)
+      return false;
+    SmallVector<StringRef, 64> lines;
+    (*buffer)->getBuffer().split(lines, '\n', -1, false);
+    if (lines.empty() || lines.front() != "key " + key)
+      return false;
+
+    RoutingSolution cached;
+    SwitchSettings *current = nullptr;
+    for (StringRef line : llvm::drop_begin(lines)) {
+      SmallVector<StringRef, 16> tokens;
+      line.split(tokens, ' ', -1, false);
+      SmallVector<int, 16> values;
+      for (StringRef token : llvm::drop_begin(tokens)) {
+        int value;
+        if (token.getAsInteger(10, value))
+          return false;
+        values.push_back(value);
+      }
+      auto getPort = [&](unsigned i) {
+        return std::make_pair((WireBundle)values[i], values[i + 1]);
+      };
+      if (tokens.empty() || values.size() < 4)
+        return false;
+      Switchbox *sb = pathfinder.getSwitchbox({values[0], values[1]});
+      if (!sb)
+        return false;
+      if (tokens[0] == "flow") {
+        current = &cached[std::make_pair(sb, getPort(2))];
+      } else if (tokens[0] == "sb" && current && values.size() % 2 == 0) {
+        SwitchSetting &setting = (*current)[sb];
+        setting.first = getPort(2);
+        for (unsigned i = 4; i < values.size(); i += 2)
+          setting.second.insert(getPort(i));
+      } else {
+        return false;
+      }
+    }
+    solution = cached;
+    return true;
+  }
+
+  void store(const RoutingSolution &solution) {
+    if (llvm::sys::fs::create_directories(dir))
+      return;
+    std::string path = getPath();
+    std::string tmpPath = path + ".tmp";
+    {
+      std::error_code EC;
+      llvm::raw_fd_ostream os(tmpPath, EC, llvm::sys::fs::OF_Text);
+      if (EC)
+        return;
+      os << "key " << key << "\n";
+      for (auto &flow : solution) {
+        os << "flow " << flow.first.first->col << " "
+           << flow.first.first->row << " " << (int)flow.first.second.first
+           << " " << flow.first.second.second << "\n";
+        for (auto &setting : flow.second) {
+          os << "sb " << setting.first->col << " " << setting.first->row
+             << " " << (int)setting.second.first.first << " "
+             << setting.second.first.second;
+          for (Port port : setting.second.second)
+            os << " " << (int)port.first << " " << port.second;
+          os << "\n";
+        }
+      }
+    }
+    llvm::sys::fs::rename(tmpPath, path);
+  }
+};
+
 // DynamicTileAnalysis integrates the Pathfinder class into the MLIR
 // environment. It passes flows to the Pathfinder as ordered pairs of ints.
 // Detailed routing is received as SwitchboxSettings
@@ -98,8 +199,9 @@ public:
   DeviceOp &device;
   int maxcol, maxrow;
   Pathfinder pathfinder;
-  std::map<PathEndPoint, SwitchSettings> flow_solutions;
-  std::map<PathEndPoint, bool> processed_flows;
+  RoutingSolution flow_solutions;
+  std::map<PathEndPoint, bool, PathEndPointLess> processed_flows;
+  bool legal = true;
 
   DenseMap<Coord, TileOp> coordToTile;
   DenseMap<Coord, SwitchboxOp> coordToSwitchbox;
@@ -108,18 +210,31 @@ public:
 
   const int MAX_ITERATIONS = 1000; // how long until declared unroutable
 
-  DynamicTileAnalysis(DeviceOp &d) : device(d) {
+  DynamicTileAnalysis(DeviceOp &d, const AIEDeviceIndex &index,
+                      PathfinderOptions options, StringRef cacheDir = "")
+      : device(d) {
     LLVM_DEBUG(llvm::dbgs()
                << "\t---Begin DynamicTileAnalysis Constructor---\n");
     // find the maxcol and maxrow
     maxcol = 0;
     maxrow = 0;
-    for (TileOp tileOp : d.getOps<TileOp>()) {
-      maxcol = std::max(maxcol, tileOp.colIndex());
-      maxrow = std::max(maxrow, tileOp.rowIndex());
+    for (TileID coords : index.getTileIDs()) {
+      maxcol = std::max(maxcol, coords.first);
+      maxrow = std::max(maxrow, coords.second);
     }
 
-    pathfinder = Pathfinder(maxcol, maxrow, d);
+    pathfinder = Pathfinder(maxcol, maxrow, d, options);
+
+    // only whether clusters are routed separately changes the routing, not the
+    // exact number of threads
+    RoutingCache cache(cacheDir);
+    cache.addToKey(stringifyAIEDevice(d.getDevice()) + " " + Twine(maxcol) +
+                   " " + Twine(maxrow));
+    cache.addToKey("options " + Twine((int)options.useAStar) + " " +
+                   Twine(options.boundingBoxMargin) + " " +
+                   Twine((int)options.incremental) + " " +
+                   Twine((int)(options.threads > 1)) + " " +
+                   Twine((int)options.steinerTrees));
 
     // for each flow in the device, add it to pathfinder
     // each source can map to multiple different destinations (fanout)
@@ -139,7 +254,21 @@ public:
                  << " -> (" << dstCoords.first << ", " << dstCoords.second
                  << ")" << stringifyWireBundle(dstPort.first)
                  << (int)dstPort.second << "\n");
-      pathfinder.addFlow(srcCoords, srcPort, dstCoords, dstPort);
+      int hopBudget = -1;
+      if (flowOp.getLatencyBudget().has_value())
+        hopBudget = flowOp.getLatencyBudget().value();
+      int bandwidth = 0;
+      if (flowOp.getBandwidth().has_value())
+        bandwidth = flowOp.getBandwidth().value();
+      bool steiner = flowOp.getSteiner();
+      pathfinder.addFlow(srcCoords, srcPort, dstCoords, dstPort, hopBudget,
+                         bandwidth, steiner);
+      cache.addToKey("src", srcCoords, srcPort);
+      cache.addToKey("dst", dstCoords, dstPort);
+      cache.addToKey("budget " + Twine(hopBudget));
+      cache.addToKey("bandwidth " + Twine(bandwidth));
+      if (steiner)
+        cache.addToKey("steiner");
     }
 
     // add existing connections so Pathfinder knows which resources are
@@ -151,15 +280,31 @@ public:
         Port existing_port = std::make_pair(connectOp.getDestBundle(),
                                             connectOp.getDestChannel());
         pathfinder.addFixedConnection(existing_coord, existing_port);
+        cache.addToKey("fixed", existing_coord, existing_port);
+      }
+      // packet-switched routes share the same ports, so master ports which
+      // are already used by packet flows are not available either
+      for (MasterSetOp masterSetOp : switchboxOp.getOps<MasterSetOp>()) {
+        Coord existing_coord =
+            std::make_pair(switchboxOp.colIndex(), switchboxOp.rowIndex());
+        pathfinder.addFixedConnection(existing_coord, masterSetOp.destPort());
+        cache.addToKey("fixed", existing_coord, masterSetOp.destPort());
       }
     }
 
     // all flows are now populated, call the congestion-aware pathfinder
     // algorithm
     // check whether the pathfinder algorithm creates a legal routing
-    flow_solutions = pathfinder.findPaths(MAX_ITERATIONS);
-    if (!pathfinder.isLegal())
-      d.emitError("Unable to find a legal routing");
+    if (cache.isEnabled() && cache.load(pathfinder, flow_solutions)) {
+      LLVM_DEBUG(llvm::dbgs() << "\tUsing cached routing solution\n");
+    } else {
+      flow_solutions = pathfinder.findPaths(MAX_ITERATIONS);
+      legal = pathfinder.isLegal();
+      if (!legal)
+        d.emitError("Unable to find a legal routing");
+      else if (cache.isEnabled())
+        cache.store(flow_solutions);
+    }
 
     // initialize all flows as unprocessed to prep for rewrite
     for (auto iter = flow_solutions.begin(); iter != flow_solutions.end();
@@ -172,31 +317,182 @@ public:
     }
 
     // fill in coords to TileOps, SwitchboxOps, and ShimMuxOps
-    for (auto tileOp : device.getOps<TileOp>()) {
-      int col, row;
-      col = tileOp.colIndex();
-      row = tileOp.rowIndex();
-      maxcol = std::max(maxcol, col);
-      maxrow = std::max(maxrow, row);
-      assert(coordToTile.count(std::make_pair(col, row)) == 0);
-      coordToTile[std::make_pair(col, row)] = tileOp;
+    for (TileID coords : index.getTileIDs()) {
+      const AIEDeviceIndex::TileOps *ops = index.lookup(coords);
+      coordToTile[coords] = ops->tile;
+      if (ops->switchbox)
+        coordToSwitchbox[coords] = ops->switchbox;
+      if (ops->shimMux)
+        coordToShimMux[coords] = ops->shimMux;
     }
-    for (auto switchboxOp : device.getOps<SwitchboxOp>()) {
-      int col, row;
-      col = switchboxOp.colIndex();
-      row = switchboxOp.rowIndex();
-      assert(coordToSwitchbox.count(std::make_pair(col, row)) == 0);
-      coordToSwitchbox[std::make_pair(col, row)] = switchboxOp;
+
+    LLVM_DEBUG(llvm::dbgs() << "\t---End DynamicTileAnalysis Constructor---\n");
+  }
+
+  // Count the switchbox-to-switchbox hops taken by the routed flow from
+  // srcPort of srcCoords to dstCoords, by following the switch settings of
+  // the flow outwards from its source.  Returns -1 if the destination is not
+  // reached.
+  int getHopCount(Coord srcCoords, Port srcPort, Coord dstCoords) {
+    Switchbox *src = pathfinder.getSwitchbox(srcCoords);
+    Switchbox *dst = pathfinder.getSwitchbox(dstCoords);
+    auto solution = flow_solutions.find(std::make_pair(src, srcPort));
+    if (!src || !dst || solution == flow_solutions.end())
+      return -1;
+    SwitchSettings &settings = solution->second;
+    std::map<Switchbox *, int, SwitchboxLess> hops;
+    std::queue<Switchbox *> worklist;
+    hops[src] = 0;
+    worklist.push(src);
+    while (!worklist.empty()) {
+      Switchbox *sb = worklist.front();
+      worklist.pop();
+      if (sb == dst)
+        return hops[sb];
+      if (!settings.count(sb))
+        continue;
+      for (Port port : settings[sb].second) {
+        Coord next = std::make_pair(sb->col, sb->row);
+        if (port.first == WireBundle::North)
+          next.second++;
+        else if (port.first == WireBundle::South)
+          next.second--;
+        else if (port.first == WireBundle::East)
+          next.first++;
+        else if (port.first == WireBundle::West)
+          next.first--;
+        else
+          continue;
+        Switchbox *nextSb = pathfinder.getSwitchbox(next);
+        if (nextSb && !hops.count(nextSb)) {
+          hops[nextSb] = hops[sb] + 1;
+          worklist.push(nextSb);
+        }
+      }
     }
-    for (auto shimmuxOp : device.getOps<ShimMuxOp>()) {
-      int col, row;
-      col = shimmuxOp.colIndex();
-      row = shimmuxOp.rowIndex();
-      assert(coordToShimMux.count(std::make_pair(col, row)) == 0);
-      coordToShimMux[std::make_pair(col, row)] = shimmuxOp;
+    return -1;
+  }
+
+  // Write a JSON summary of the routing: the use of every Channel, the total
+  // wirelength in switchbox-to-switchbox hops, the largest fanout, and the
+  // flows on the most heavily used Channels.  The "switchbox" entries have the
+  // same format as those written by aie-translate --aie-flows-to-json, so
+  // tools/aie-routing-command-line/visualize.py can draw them.  This must be
+  // called before the flows are rewritten.
+  void writeReport(raw_ostream &os, unsigned numHottest = 10) {
+    const RoutingGraph &graph = pathfinder.getGraph();
+
+    // find the flows using each Channel from the switch settings
+    std::vector<std::vector<PathEndPoint>> channelFlows(graph.numEdges());
+    unsigned wirelength = 0;
+    for (auto &flow : flow_solutions) {
+      for (auto &setting : flow.second) {
+        vertex_descriptor v =
+            pathfinder.getVertex(setting.first->col, setting.first->row);
+        for (Port port : setting.second.second) {
+          edge_descriptor e;
+          if (graph.findOutEdge(v, port.first, e)) {
+            channelFlows[e].push_back(flow.first);
+            wirelength++;
+          }
+        }
+      }
     }
+    auto getUsed = [&](edge_descriptor e) -> int64_t {
+      return channelFlows[e].size() + graph.numFixedChannels(e);
+    };
 
-    LLVM_DEBUG(llvm::dbgs() << "\t---End DynamicTileAnalysis Constructor---\n");
+    std::map<PathEndPoint, unsigned, PathEndPointLess> fanout;
+    std::map<Coord, unsigned> sourceCounts, destinationCounts;
+    for (FlowOp flowOp : device.getOps<FlowOp>()) {
+      TileOp srcTile = cast<TileOp>(flowOp.getSource().getDefiningOp());
+      TileOp dstTile = cast<TileOp>(flowOp.getDest().getDefiningOp());
+      Coord srcCoords = std::make_pair(srcTile.colIndex(), srcTile.rowIndex());
+      Port srcPort =
+          std::make_pair(flowOp.getSourceBundle(), flowOp.getSourceChannel());
+      fanout[std::make_pair(pathfinder.getSwitchbox(srcCoords), srcPort)]++;
+      sourceCounts[srcCoords]++;
+      destinationCounts[std::make_pair(dstTile.colIndex(),
+                                       dstTile.rowIndex())]++;
+    }
+    unsigned maxFanout = 0;
+    for (auto &f : fanout)
+      maxFanout = std::max(maxFanout, f.second);
+
+    // the hottest Channels are those with the highest utilization
+    std::vector<edge_descriptor> hottest;
+    for (edge_descriptor e = 0; e < graph.numEdges(); e++)
+      if (!channelFlows[e].empty())
+        hottest.push_back(e);
+    std::stable_sort(hottest.begin(), hottest.end(),
+                     [&](edge_descriptor a, edge_descriptor b) {
+                       return getUsed(a) * graph.maxCapacity[b] >
+                              getUsed(b) * graph.maxCapacity[a];
+                     });
+    if (hottest.size() > numHottest)
+      hottest.resize(numHottest);
+
+    llvm::json::OStream J(os, 2);
+    auto writeChannel = [&](edge_descriptor e) {
+      const Switchbox &sb = graph.getSwitchbox(graph.edgeSource[e]);
+      J.attribute("col", sb.col);
+      J.attribute("row", sb.row);
+      J.attribute("bundle", stringifyWireBundle(graph.bundle[e]));
+      J.attribute("used", getUsed(e));
+      J.attribute("fixed", (int64_t)graph.numFixedChannels(e));
+      J.attribute("max", (int64_t)graph.maxCapacity[e]);
+    };
+    J.object([&] {
+      J.attribute("legal", legal);
+      J.attribute("iterations", pathfinder.getIterationCount());
+      J.attribute("flows", (int64_t)flow_solutions.size());
+      J.attribute("wirelength", (int64_t)wirelength);
+      J.attribute("max_fanout", (int64_t)maxFanout);
+      J.attributeArray("channels", [&] {
+        for (edge_descriptor e = 0; e < graph.numEdges(); e++)
+          J.object([&] { writeChannel(e); });
+      });
+      J.attributeArray("hottest_channels", [&] {
+        for (edge_descriptor e : hottest) {
+          J.object([&] {
+            writeChannel(e);
+            J.attributeArray("sources", [&] {
+              for (PathEndPoint &src : channelFlows[e]) {
+                J.object([&] {
+                  J.attribute("col", src.first->col);
+                  J.attribute("row", src.first->row);
+                  J.attribute("bundle", stringifyWireBundle(src.second.first));
+                  J.attribute("channel", src.second.second);
+                });
+              }
+            });
+          });
+        }
+      });
+      for (int col = 0; col <= maxcol; col++) {
+        for (int row = 0; row <= maxrow; row++) {
+          Coord coords = std::make_pair(col, row);
+          vertex_descriptor v = pathfinder.getVertex(col, row);
+          auto getBound = [&](WireBundle bundle) -> int64_t {
+            edge_descriptor e;
+            return graph.findOutEdge(v, bundle, e) ? getUsed(e) : 0;
+          };
+          J.attributeObject(
+              "switchbox" + std::to_string(col) + std::to_string(row), [&] {
+                J.attribute("col", col);
+                J.attribute("row", row);
+                J.attribute("source_count", (int64_t)sourceCounts[coords]);
+                J.attribute("destination_count",
+                            (int64_t)destinationCounts[coords]);
+                J.attribute("northbound", getBound(WireBundle::North));
+                J.attribute("eastbound", getBound(WireBundle::East));
+                J.attribute("southbound", getBound(WireBundle::South));
+                J.attribute("westbound", getBound(WireBundle::West));
+              });
+        }
+      }
+    });
+    os << "\n";
   }
 
   int getMaxCol() { return maxcol; }
@@ -452,9 +748,46 @@ struct AIEPathfinderPass
     LLVM_DEBUG(llvm::dbgs() << "---Begin AIEPathfinderPass---\n");
 
     DeviceOp d = getOperation();
-    DynamicTileAnalysis analyzer(d);
+    PathfinderOptions options;
+    options.useAStar = useAStar;
+    options.boundingBoxMargin = boundingBoxMargin;
+    options.incremental = incremental;
+    options.threads = threads;
+    options.steinerTrees = steinerTrees;
+    DynamicTileAnalysis analyzer(d, getAnalysis<AIEDeviceIndex>(), options,
+                                 cacheDir);
     OpBuilder builder = OpBuilder::atBlockEnd(d.getBody());
 
+    if (!reportFile.empty()) {
+      std::error_code EC;
+      llvm::raw_fd_ostream os(reportFile, EC, llvm::sys::fs::OF_Text);
+      if (EC) {
+        d.emitError("Unable to open routing report file ")
+            << reportFile << ": " << EC.message();
+        return signalPassFailure();
+      }
+      analyzer.writeReport(os);
+    }
+
+    // report the hops taken by each flow before the flows are rewritten
+    for (FlowOp flowOp : d.getOps<FlowOp>()) {
+      TileOp srcTile = cast<TileOp>(flowOp.getSource().getDefiningOp());
+      TileOp dstTile = cast<TileOp>(flowOp.getDest().getDefiningOp());
+      int hops = analyzer.getHopCount(
+          std::make_pair(srcTile.colIndex(), srcTile.rowIndex()),
+          std::make_pair(flowOp.getSourceBundle(), flowOp.getSourceChannel()),
+          std::make_pair(dstTile.colIndex(), dstTile.rowIndex()));
+      if (hops < 0)
+        continue;
+      if (flowOp.getLatencyBudget().has_value() &&
+          hops > (int)flowOp.getLatencyBudget().value())
+        flowOp.emitWarning("flow takes ")
+            << hops << " hops, exceeding its latency budget of "
+            << flowOp.getLatencyBudget().value() << " hops";
+      else if (reportHops)
+        flowOp.emitRemark("flow routed with ") << hops << " hops";
+    }
+
     // Apply rewrite rule to switchboxes to add assignments to every 'connect'
     // operation inside
     ConversionTarget target(getContext());
@@ -0,0 +1,173 @@
+//===- AIEEliminateDeadResources.cpp ----------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the removal of the resources of a design which nothing
+// uses: the flows and the switchbox connections whose data nothing consumes,
+// the switchboxes left without connections, and the buffers and the locks
+// without users, so that they take no lock IDs, memory, routing capacity or
+// configuration writes.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/Support/Debug.h"
+
+#include <map>
+#include <optional>
+#include <set>
+
+#define DEBUG_TYPE "aie-eliminate-dead-resources"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+static WireBundle getOppositeBundle(WireBundle bundle) {
+  return (bundle == WireBundle::East)    ? WireBundle::West
+         : (bundle == WireBundle::West)  ? WireBundle::East
+         : (bundle == WireBundle::North) ? WireBundle::South
+                                         : WireBundle::North;
+}
+
+/// Function that returns the tile the switchbox of tile leads to through the
+/// ports of bundle, or std::nullopt if bundle does not lead to a switchbox.
+static std::optional<TileID> getNeighbour(TileID tile, WireBundle bundle) {
+  switch (bundle) {
+  case WireBundle::North:
+    return TileID(tile.first, tile.second + 1);
+  case WireBundle::South:
+    // The south ports of the shim switchboxes lead to the shim mux.
+    if (tile.second == 0)
+      return std::nullopt;
+    return TileID(tile.first, tile.second - 1);
+  case WireBundle::East:
+    return TileID(tile.first + 1, tile.second);
+  case WireBundle::West:
+    if (tile.first == 0)
+      return std::nullopt;
+    return TileID(tile.first - 1, tile.second);
+  default:
+    return std::nullopt;
+  }
+}
+
+struct AIEEliminateDeadResourcesPass
+    : public AIEEliminateDeadResourcesBase<AIEEliminateDeadResourcesPass> {
+  // the S2MM channels of the DMAs of the tiles
+  std::set<std::pair<TileID, int>> s2mmChannels;
+  // the switchboxes of the tiles
+  std::map<TileID, SwitchboxOp> switchboxes;
+  // the connections already removed
+  DenseSet<Operation *> dead;
+
+  /// Function that returns true if nothing consumes the data a stream carries
+  /// into port of tile.  The shim DMAs can be configured by the host at run
+  /// time, so the ports of the shim tiles always have a consumer.
+  bool hasNoConsumer(TileOp tile, Port port) {
+    if (tile.isShimTile())
+      return false;
+    if (port.first == WireBundle::Core)
+      return !tile.getCoreOp();
+    if (port.first == WireBundle::DMA)
+      return !s2mmChannels.count({tile.getTileID(), port.second});
+    return false;
+  }
+
+  /// Function that returns true if the connect of the switchbox of tile
+  /// leads to nothing which consumes its data.
+  bool isDead(TileOp tile, ConnectOp connect) {
+    Port dest = connect.destPort();
+    auto neighbour = getNeighbour(tile.getTileID(), dest.first);
+    if (!neighbour)
+      return hasNoConsumer(tile, dest);
+    auto it = switchboxes.find(*neighbour);
+    if (it == switchboxes.end())
+      return true;
+    Port source = {getOppositeBundle(dest.first), dest.second};
+    for (Operation &op : it->second.getConnections().front()) {
+      if (auto next = dyn_cast<ConnectOp>(op))
+        if (next.sourcePort() == source && !dead.contains(next))
+          return false;
+      if (auto rules = dyn_cast<PacketRulesOp>(op))
+        if (rules.sourcePort() == source)
+          return false;
+    }
+    return true;
+  }
+
+  /// Function that returns true if op, a buffer or a lock without users, can
+  /// be removed.  The host code can access the ones with a name through
+  /// their generated accessors.
+  bool isUnused(Operation *op) {
+    return op->use_empty() &&
+           !(keepNamed && op->hasAttr(SymbolTable::getSymbolAttrName()));
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    s2mmChannels.clear();
+    switchboxes.clear();
+    dead.clear();
+    device.walk([&](DMAStartOp start) {
+      auto element = dyn_cast<TileElement>(start->getParentOp());
+      if (element && start.getChannelDir() == DMAChannelDir::S2MM)
+        s2mmChannels.insert({element.getTileID(), start.getChannelIndex()});
+    });
+    for (auto switchbox : device.getOps<SwitchboxOp>())
+      switchboxes[switchbox.getTileOp().getTileID()] = switchbox;
+
+    for (auto flow : llvm::make_early_inc_range(device.getOps<FlowOp>())) {
+      auto dest = flow.getDest().getDefiningOp<TileOp>();
+      if (!dest ||
+          !hasNoConsumer(dest, {flow.getDestBundle(), flow.destIndex()}))
+        continue;
+      LLVM_DEBUG(llvm::dbgs() << "Removing the flow to the unused port "
+                              << stringifyWireBundle(flow.getDestBundle())
+                              << " " << flow.destIndex() << "\n");
+      flow.erase();
+    }
+
+    // The connections leading to dead ones are dead in turn.
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (auto &[tileID, switchbox] : switchboxes)
+        for (auto connect : switchbox.getConnections().getOps<ConnectOp>())
+          if (!dead.contains(connect) &&
+              isDead(switchbox.getTileOp(), connect)) {
+            dead.insert(connect);
+            changed = true;
+          }
+    }
+    for (Operation *connect : dead)
+      connect->erase();
+    LLVM_DEBUG(llvm::dbgs() << "Removed " << dead.size()
+                            << " unused switchbox connections\n");
+    for (auto switchbox :
+         llvm::make_early_inc_range(device.getOps<SwitchboxOp>()))
+      if (switchbox->use_empty() &&
+          llvm::all_of(switchbox.getConnections().front(),
+                       [](Operation &op) { return isa<EndOp>(op); }))
+        switchbox.erase();
+
+    for (auto buffer : llvm::make_early_inc_range(device.getOps<BufferOp>()))
+      if (isUnused(buffer))
+        buffer.erase();
+    for (auto lock : llvm::make_early_inc_range(device.getOps<LockOp>()))
+      if (isUnused(lock))
+        lock.erase();
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEEliminateDeadResourcesPass() {
+  return std::make_unique<AIEEliminateDeadResourcesPass>();
+}
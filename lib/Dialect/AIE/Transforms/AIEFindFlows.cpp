@@ -26,87 +26,94 @@ typedef std::pair<Operation *, Port> PortConnection;
 typedef std::pair<Port, MaskValue> PortMaskValue;
 typedef std::pair<PortConnection, MaskValue> PacketConnection;
 
+// ConnectivityAnalysis indexes the netlist of a device in a single sweep
+// when it is constructed: the other end of every wire, and the ports reached
+// from each input port of every switchbox and shim mux.  Following a
+// connection is then a lookup rather than a walk over the device.
 class ConnectivityAnalysis {
   DeviceOp &device;
+  // the operation and bundle at the other end of a wire, for each end
+  std::map<std::pair<Operation *, WireBundle>,
+           std::pair<Operation *, WireBundle>>
+      wires;
+  // the output ports reached from an input port of a switchbox or shim mux,
+  // with the packet mask and value of the rule
+  std::map<PortConnection, std::vector<PortMaskValue>> switchboxConnections;
 
 public:
-  ConnectivityAnalysis(DeviceOp &d) : device(d) {}
-
-private:
-  llvm::Optional<PortConnection>
-  getConnectionThroughWire(Operation *op, Port masterPort) const {
-    LLVM_DEBUG(llvm::dbgs()
-               << "Wire:" << *op << " " << stringifyWireBundle(masterPort.first)
-               << " " << masterPort.second << "\n");
+  ConnectivityAnalysis(DeviceOp &d) : device(d) {
+    // the first wire found for an end wins, as for a search in op order
     for (auto wireOp : device.getOps<WireOp>()) {
-      if (wireOp.getSource().getDefiningOp() == op &&
-          wireOp.getSourceBundle() == masterPort.first) {
-        Operation *other = wireOp.getDest().getDefiningOp();
-        Port otherPort =
-            std::make_pair(wireOp.getDestBundle(), masterPort.second);
-        LLVM_DEBUG(llvm::dbgs() << "Connects To:" << *other << " "
-                                << stringifyWireBundle(otherPort.first) << " "
-                                << otherPort.second << "\n");
-        return std::make_pair(other, otherPort);
-      }
-      if (wireOp.getDest().getDefiningOp() == op &&
-          wireOp.getDestBundle() == masterPort.first) {
-        Operation *other = wireOp.getSource().getDefiningOp();
-        Port otherPort =
-            std::make_pair(wireOp.getSourceBundle(), masterPort.second);
-        LLVM_DEBUG(llvm::dbgs() << "Connects To:" << *other << " "
-                                << stringifyWireBundle(otherPort.first) << " "
-                                << otherPort.second << "\n");
-        return std::make_pair(other, otherPort);
-      }
+      auto source = std::make_pair(wireOp.getSource().getDefiningOp(),
+                                   wireOp.getSourceBundle());
+      auto dest = std::make_pair(wireOp.getDest().getDefiningOp(),
+                                 wireOp.getDestBundle());
+      wires.insert(std::make_pair(source, dest));
+      wires.insert(std::make_pair(dest, source));
     }
-    LLVM_DEBUG(llvm::dbgs() << "*** Missing Wire!\n");
-    return std::nullopt;
+    for (auto switchboxOp : device.getOps<SwitchboxOp>())
+      addSwitchboxConnections(switchboxOp, switchboxOp.getConnections());
+    for (auto shimMuxOp : device.getOps<ShimMuxOp>())
+      addSwitchboxConnections(shimMuxOp, shimMuxOp.getConnections());
   }
 
-  std::vector<PortMaskValue>
-  getConnectionsThroughSwitchbox(Region &r, Port sourcePort) const {
-    LLVM_DEBUG(llvm::dbgs() << "Switchbox:\n");
+private:
+  void addSwitchboxConnections(Operation *switchOp, Region &r) {
     Block &b = r.front();
-    std::vector<PortMaskValue> portSet;
     for (auto connectOp : b.getOps<ConnectOp>()) {
-      if (connectOp.sourcePort() == sourcePort) {
-        MaskValue maskValue = std::make_pair(0, 0);
-        portSet.push_back(std::make_pair(connectOp.destPort(), maskValue));
-        LLVM_DEBUG(llvm::dbgs()
-                   << "To:" << stringifyWireBundle(connectOp.destPort().first)
-                   << " " << connectOp.destPort().second << "\n");
-      }
+      MaskValue maskValue = std::make_pair(0, 0);
+      switchboxConnections[std::make_pair(switchOp, connectOp.sourcePort())]
+          .push_back(std::make_pair(connectOp.destPort(), maskValue));
     }
     for (auto connectOp : b.getOps<PacketRulesOp>()) {
-      if (connectOp.sourcePort() == sourcePort) {
-        LLVM_DEBUG(llvm::dbgs()
-                   << "Packet From: "
-                   << stringifyWireBundle(connectOp.sourcePort().first) << " "
-                   << (int)sourcePort.first << "\n");
-        for (auto masterSetOp : b.getOps<MasterSetOp>())
-          for (Value amsel : masterSetOp.getAmsels())
-            for (auto ruleOp :
-                 connectOp.getRules().front().getOps<PacketRuleOp>()) {
-              if (ruleOp.getAmsel() == amsel) {
-                LLVM_DEBUG(llvm::dbgs()
-                           << "To:"
-                           << stringifyWireBundle(masterSetOp.destPort().first)
-                           << " " << masterSetOp.destPort().second << "\n");
-                MaskValue maskValue =
-                    std::make_pair(ruleOp.maskInt(), ruleOp.valueInt());
-                portSet.push_back(
-                    std::make_pair(masterSetOp.destPort(), maskValue));
-              }
+      std::vector<PortMaskValue> &portSet =
+          switchboxConnections[std::make_pair(switchOp,
+                                              connectOp.sourcePort())];
+      for (auto masterSetOp : b.getOps<MasterSetOp>())
+        for (Value amsel : masterSetOp.getAmsels())
+          for (auto ruleOp :
+               connectOp.getRules().front().getOps<PacketRuleOp>()) {
+            if (ruleOp.getAmsel() == amsel) {
+              MaskValue maskValue =
+                  std::make_pair(ruleOp.maskInt(), ruleOp.valueInt());
+              portSet.push_back(
+                  std::make_pair(masterSetOp.destPort(), maskValue));
             }
-      }
+          }
     }
-    return portSet;
+  }
+
+  llvm::Optional<PortConnection>
+  getConnectionThroughWire(Operation *op, Port masterPort) const {
+    LLVM_DEBUG(llvm::dbgs()
+               << "Wire:" << *op << " " << stringifyWireBundle(masterPort.first)
+               << " " << masterPort.second << "\n");
+    auto wire = wires.find(std::make_pair(op, masterPort.first));
+    if (wire == wires.end()) {
+      LLVM_DEBUG(llvm::dbgs() << "*** Missing Wire!\n");
+      return std::nullopt;
+    }
+    Operation *other = wire->second.first;
+    Port otherPort = std::make_pair(wire->second.second, masterPort.second);
+    LLVM_DEBUG(llvm::dbgs() << "Connects To:" << *other << " "
+                            << stringifyWireBundle(otherPort.first) << " "
+                            << otherPort.second << "\n");
+    return std::make_pair(other, otherPort);
+  }
+
+  const std::vector<PortMaskValue> &
+  getConnectionsThroughSwitchbox(Operation *switchOp, Port sourcePort) const {
+    static const std::vector<PortMaskValue> noConnections;
+    auto connections =
+        switchboxConnections.find(std::make_pair(switchOp, sourcePort));
+    if (connections == switchboxConnections.end())
+      return noConnections;
+    return connections->second;
   }
 
   std::vector<PacketConnection>
   maskSwitchboxConnections(Operation *switchOp,
-                           std::vector<PortMaskValue> nextPortMaskValues,
+                           const std::vector<PortMaskValue> &nextPortMaskValues,
                            MaskValue maskValue) const {
     std::vector<PacketConnection> worklist;
     for (auto &nextPortMaskValue : nextPortMaskValues) {
@@ -174,26 +181,11 @@ public:
       if (isa<FlowEndPoint>(other)) {
         // If we got to a tile, then add it to the result.
         connectedTiles.push_back(t);
-      } else if (auto switchOp = dyn_cast_or_null<SwitchboxOp>(other)) {
-        std::vector<PortMaskValue> nextPortMaskValues =
-            getConnectionsThroughSwitchbox(switchOp.getConnections(),
-                                           otherPort);
-        std::vector<PacketConnection> newWorkList =
-            maskSwitchboxConnections(switchOp, nextPortMaskValues, maskValue);
-        // append to the worklist
-        worklist.insert(worklist.end(), newWorkList.begin(), newWorkList.end());
-        if (nextPortMaskValues.size() > 0 && newWorkList.size() == 0) {
-          // No rule matched some incoming packet.  This is likely a
-          // configuration error.
-          LLVM_DEBUG(llvm::dbgs() << "No rule matched incoming packet here: ");
-          LLVM_DEBUG(other->dump());
-        }
-      } else if (auto switchOp = dyn_cast_or_null<ShimMuxOp>(other)) {
-        std::vector<PortMaskValue> nextPortMaskValues =
-            getConnectionsThroughSwitchbox(switchOp.getConnections(),
-                                           otherPort);
+      } else if (isa<SwitchboxOp, ShimMuxOp>(other)) {
+        const std::vector<PortMaskValue> &nextPortMaskValues =
+            getConnectionsThroughSwitchbox(other, otherPort);
         std::vector<PacketConnection> newWorkList =
-            maskSwitchboxConnections(switchOp, nextPortMaskValues, maskValue);
+            maskSwitchboxConnections(other, nextPortMaskValues, maskValue);
         // append to the worklist
         worklist.insert(worklist.end(), newWorkList.begin(), newWorkList.end());
         if (nextPortMaskValues.size() > 0 && newWorkList.size() == 0) {
@@ -0,0 +1,192 @@
+//===- AIEInsertOverlayLoads.cpp --------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the requests the cores make to the host for the
+// program-memory overlays they call, at the boundaries of the phases of the
+// cores, i.e. before the ops calling into an overlay other than the one in
+// the overlay window of the core.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/SmallSet.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-insert-overlay-loads"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+static const char *OVERLAY_ATTR_NAME = "aie.overlay";
+
+// The overlay of the function called by op, if any.
+static std::optional<int64_t> getCalledOverlay(Operation *op) {
+  auto call = dyn_cast<func::CallOp>(op);
+  if (!call)
+    return std::nullopt;
+  auto callee = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+      call, call.getCalleeAttr());
+  if (!callee)
+    return std::nullopt;
+  if (auto overlay = callee->getAttrOfType<IntegerAttr>(OVERLAY_ATTR_NAME))
+    return overlay.getInt();
+  return std::nullopt;
+}
+
+namespace {
+
+// The buffer and the locks through which a core requests its overlays.
+struct OverlayRequests {
+  BufferOp overlay;
+  LockOp request;
+  LockOp loaded;
+};
+
+struct AIEInsertOverlayLoadsPass
+    : public AIEInsertOverlayLoadsBase<AIEInsertOverlayLoadsPass> {
+  /// Function that creates the buffer holding the overlay in the window of
+  /// the core, and the locks with which it requests an overlay from the host
+  /// and waits for it to be loaded.
+  OverlayRequests createRequests(CoreOp core) {
+    TileOp tile = core.getTileOp();
+    std::string name = "core_" + std::to_string(tile.getCol()) + "_" +
+                       std::to_string(tile.getRow()) + "_overlay";
+    OpBuilder builder(core);
+    auto type = MemRefType::get({1}, builder.getI32Type());
+    OverlayRequests requests;
+    requests.overlay = builder.create<BufferOp>(core.getLoc(), type, tile);
+    requests.overlay->setAttr(SymbolTable::getSymbolAttrName(),
+                              builder.getStringAttr(name));
+    // The IDs of the locks are left to aie-assign-lock-ids.
+    auto createLock = [&](StringRef suffix) {
+      LockOp lock = builder.create<LockOp>(
+          core.getLoc(), builder.getIndexType(), tile, IntegerAttr(),
+          IntegerAttr());
+      lock->setAttr(SymbolTable::getSymbolAttrName(),
+                    builder.getStringAttr(name + suffix));
+      return lock;
+    };
+    requests.request = createLock("_request");
+    requests.loaded = createLock("_loaded");
+
+    // No overlay is in the window when the core starts.
+    builder.setInsertionPointToStart(&core.getBody().front());
+    Value none = builder.create<arith::ConstantOp>(
+        core.getLoc(), builder.getI32IntegerAttr(-1));
+    Value zero = builder.create<arith::ConstantIndexOp>(core.getLoc(), 0);
+    builder.create<memref::StoreOp>(core.getLoc(), none, requests.overlay,
+                                    zero);
+    return requests;
+  }
+
+  /// Function that requests overlay before op, where the overlay in the
+  /// window of the core is known only at runtime if checked is set.
+  void request(Operation *op, int64_t overlay, bool checked,
+               OverlayRequests &requests) {
+    OpBuilder builder(op);
+    Location loc = op->getLoc();
+    Value id = builder.create<arith::ConstantOp>(
+        loc, builder.getI32IntegerAttr(overlay));
+    Value zero = builder.create<arith::ConstantIndexOp>(loc, 0);
+    if (checked) {
+      Value current =
+          builder.create<memref::LoadOp>(loc, requests.overlay, zero);
+      Value missing = builder.create<arith::CmpIOp>(
+          loc, arith::CmpIPredicate::ne, current, id);
+      auto ifOp = builder.create<scf::IfOp>(loc, missing,
+                                            /*withElseRegion=*/false);
+      builder.setInsertionPointToStart(&ifOp.getThenRegion().front());
+    }
+    builder.create<memref::StoreOp>(loc, id, requests.overlay, zero);
+    builder.create<UseLockOp>(loc, requests.request, 1, LockAction::Release);
+    if (getTargetModel(op).getTargetArch() == AIEArch::AIE1) {
+      builder.create<UseLockOp>(loc, requests.loaded, 1, LockAction::Acquire);
+      builder.create<UseLockOp>(loc, requests.loaded, 0, LockAction::Release);
+    } else {
+      builder.create<UseLockOp>(loc, requests.loaded, 1,
+                                LockAction::AcquireGreaterEqual);
+    }
+  }
+
+  /// Function that requests the overlays called by the ops of block, where
+  /// current is the overlay in the window when the block starts, or -1 if
+  /// it is only known at runtime.  An op calling a single overlay, itself or
+  /// in its regions, makes a single request before it.  The regions of an
+  /// op calling several overlays are visited with an unknown overlay, as
+  /// they may loop.  Returns the overlay in the window when the block ends.
+  int64_t insertRequests(Block &block, int64_t current,
+                         OverlayRequests &requests) {
+    for (Operation &op : llvm::make_early_inc_range(block)) {
+      llvm::SmallSet<int64_t, 4> overlays;
+      op.walk([&](Operation *nested) {
+        if (auto overlay = getCalledOverlay(nested))
+          overlays.insert(*overlay);
+      });
+      if (overlays.empty())
+        continue;
+      if (overlays.size() == 1) {
+        int64_t overlay = *overlays.begin();
+        if (overlay != current)
+          request(&op, overlay, current < 0, requests);
+        current = overlay;
+        continue;
+      }
+      for (Region &region : op.getRegions())
+        for (Block &nested : region)
+          insertRequests(nested, -1, requests);
+      current = -1;
+    }
+    return current;
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+
+    // The window of a core is only ever switched from the body of the core.
+    WalkResult result = device.walk([&](func::CallOp call) {
+      auto overlay = getCalledOverlay(call);
+      if (!overlay)
+        return WalkResult::advance();
+      if (*overlay < 0) {
+        call.emitOpError("calls a function of negative overlay ") << *overlay;
+        return WalkResult::interrupt();
+      }
+      if (!call->getParentOfType<CoreOp>()) {
+        call.emitOpError("calls a function of overlay ")
+            << *overlay << " outside of the body of an AIE.core";
+        return WalkResult::interrupt();
+      }
+      return WalkResult::advance();
+    });
+    if (result.wasInterrupted()) {
+      signalPassFailure();
+      return;
+    }
+
+    for (auto core : llvm::to_vector(device.getOps<CoreOp>())) {
+      if (core.getOverlays().empty())
+        continue;
+      OverlayRequests requests = createRequests(core);
+      for (Block &block : core.getBody())
+        insertRequests(block, -1, requests);
+    }
+  }
+};
+
+} // namespace
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEInsertOverlayLoadsPass() {
+  return std::make_unique<AIEInsertOverlayLoadsPass>();
+}
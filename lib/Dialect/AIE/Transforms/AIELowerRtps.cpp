@@ -0,0 +1,105 @@
+//===- AIELowerRtps.cpp -----------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-lower-rtps"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+// The buffers an rtp block is lowered to.
+struct RtpBuffers {
+  BufferOp copies[2];
+  BufferOp version;
+  BufferOp ack;
+};
+
+} // namespace
+
+struct AIELowerRtpsPass : public AIELowerRtpsBase<AIELowerRtpsPass> {
+  void getDependentDialects(::mlir::DialectRegistry &registry) const override {
+    registry.insert<arith::ArithDialect, memref::MemRefDialect>();
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+
+    // The core reading each rtp block, which is the only one acknowledging
+    // its versions.
+    DenseMap<Operation *, CoreOp> readers;
+    WalkResult result = device.walk([&](RtpGetOp get) {
+      auto core = get->getParentOfType<CoreOp>();
+      auto [it, inserted] = readers.try_emplace(get.getRtp(), core);
+      if (!inserted && it->second != core) {
+        get.emitOpError("gets rtp block ")
+            << get.getRtpName() << " from a second core, it can only be "
+            << "read by one";
+        return WalkResult::interrupt();
+      }
+      return WalkResult::advance();
+    });
+    if (result.wasInterrupted())
+      return signalPassFailure();
+
+    DenseMap<Operation *, RtpBuffers> buffers;
+    for (auto rtp : device.getOps<RtpOp>()) {
+      // The buffers come right after the tile, before any core using them.
+      builder.setInsertionPointAfter(rtp.getTileOp());
+      auto createBuffer = [&](Type type, const char *suffix) {
+        auto buffer =
+            builder.create<BufferOp>(rtp.getLoc(), type, rtp.getTile());
+        buffer->setAttr(SymbolTable::getSymbolAttrName(),
+                        builder.getStringAttr(rtp.getSymName() + suffix));
+        return buffer;
+      };
+      auto word = MemRefType::get({1}, builder.getI32Type());
+      RtpBuffers &rtpBuffers = buffers[rtp];
+      rtpBuffers.copies[0] = createBuffer(rtp.getElemType(), "_0");
+      rtpBuffers.copies[1] = createBuffer(rtp.getElemType(), "_1");
+      rtpBuffers.version = createBuffer(word, "_version");
+      rtpBuffers.ack = createBuffer(word, "_ack");
+    }
+
+    // Acknowledge the latest version before reading its copy, so that the
+    // host no longer writes it.
+    device.walk([&](RtpGetOp get) {
+      RtpBuffers &rtpBuffers = buffers[get.getRtp()];
+      Location loc = get.getLoc();
+      builder.setInsertionPoint(get);
+      Value zero = builder.create<arith::ConstantIndexOp>(loc, 0);
+      Value version =
+          builder.create<memref::LoadOp>(loc, rtpBuffers.version, zero);
+      builder.create<memref::StoreOp>(loc, version, rtpBuffers.ack, zero);
+      Value odd = builder.create<arith::TruncIOp>(loc, builder.getI1Type(),
+                                                  version);
+      Value block = builder.create<arith::SelectOp>(
+          loc, odd, rtpBuffers.copies[1], rtpBuffers.copies[0]);
+      get.getBlock().replaceAllUsesWith(block);
+      get.erase();
+    });
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIELowerRtpsPass() {
+  return std::make_unique<AIELowerRtpsPass>();
+}
@@ -0,0 +1,159 @@
+//===- AIELowerStreamFifos.cpp ----------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-lower-stream-fifos"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+// The Core ports of the stream switches, which are either taken by the flows
+// of the design or handed out to its streamFifos.
+class CorePortAllocator {
+  const AIETargetModel &targetModel;
+  // the core ports into (masters of the cores) and out of (slaves of the
+  // cores) the switchbox of each tile which are in use
+  DenseSet<std::pair<Operation *, int>> usedMasters, usedSlaves;
+
+  static int allocate(DenseSet<std::pair<Operation *, int>> &used,
+                      Operation *tile, int numPorts) {
+    for (int channel = 0; channel < numPorts; channel++)
+      if (used.insert({tile, channel}).second)
+        return channel;
+    return -1;
+  }
+
+public:
+  CorePortAllocator(DeviceOp device) : targetModel(device.getTargetModel()) {
+    for (auto flow : device.getOps<FlowOp>()) {
+      if (flow.getSourceBundle() == WireBundle::Core)
+        usedMasters.insert(
+            {flow.getSource().getDefiningOp(), flow.getSourceChannel()});
+      if (flow.getDestBundle() == WireBundle::Core)
+        usedSlaves.insert(
+            {flow.getDest().getDefiningOp(), flow.getDestChannel()});
+    }
+    for (auto packetFlow : device.getOps<PacketFlowOp>())
+      for (Operation &op : packetFlow.getPorts().getOps()) {
+        if (auto source = dyn_cast<PacketSourceOp>(op)) {
+          if (source.getBundle() == WireBundle::Core)
+            usedMasters.insert(
+                {source.getTile().getDefiningOp(), source.channelIndex()});
+        } else if (auto dest = dyn_cast<PacketDestOp>(op)) {
+          if (dest.getBundle() == WireBundle::Core)
+            usedSlaves.insert(
+                {dest.getTile().getDefiningOp(), dest.channelIndex()});
+        }
+      }
+  }
+
+  /// Return a free channel through which the core of the tile can put values
+  /// into the stream switch, or -1 if they are all in use.
+  int allocateMaster(TileOp tile) {
+    return allocate(usedMasters, tile,
+                    targetModel.getNumSourceSwitchboxConnections(
+                        tile.colIndex(), tile.rowIndex(), WireBundle::Core));
+  }
+  /// Return a free channel through which the core of the tile can get values
+  /// from the stream switch, or -1 if they are all in use.
+  int allocateSlave(TileOp tile) {
+    return allocate(usedSlaves, tile,
+                    targetModel.getNumDestSwitchboxConnections(
+                        tile.colIndex(), tile.rowIndex(), WireBundle::Core));
+  }
+};
+
+} // namespace
+
+struct AIELowerStreamFifosPass
+    : public AIELowerStreamFifosBase<AIELowerStreamFifosPass> {
+  void getDependentDialects(::mlir::DialectRegistry &registry) const override {
+    registry.insert<arith::ArithDialect>();
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+    CorePortAllocator ports(device);
+
+    // The channel of the producer port of each streamFifo, and the channel of
+    // its consumer port on each consumer tile.
+    DenseMap<Operation *, int> putChannels;
+    DenseMap<std::pair<Operation *, Value>, int> getChannels;
+    for (auto streamFifo : device.getOps<StreamFifoCreateOp>()) {
+      TileOp producer = streamFifo.getProducerTileOp();
+      int putChannel = ports.allocateMaster(producer);
+      if (putChannel < 0) {
+        streamFifo.emitOpError("no free core stream port to put values on "
+                               "tile (")
+            << producer.colIndex() << ", " << producer.rowIndex() << ")";
+        return signalPassFailure();
+      }
+      putChannels[streamFifo] = putChannel;
+
+      builder.setInsertionPointAfter(streamFifo);
+      for (Value consumer : streamFifo.getConsumerTiles()) {
+        auto consumerOp = cast<TileOp>(consumer.getDefiningOp());
+        int getChannel = ports.allocateSlave(consumerOp);
+        if (getChannel < 0) {
+          streamFifo.emitOpError("no free core stream port to get values on "
+                                 "tile (")
+              << consumerOp.colIndex() << ", " << consumerOp.rowIndex() << ")";
+          return signalPassFailure();
+        }
+        getChannels[{streamFifo, consumer}] = getChannel;
+        builder.create<FlowOp>(streamFifo.getLoc(),
+                               streamFifo.getProducerTile(), WireBundle::Core,
+                               putChannel, consumer, WireBundle::Core,
+                               getChannel);
+      }
+    }
+
+    // Replace the puts and gets with stream operations on the allocated
+    // ports.
+    device.walk([&](StreamFifoPutOp put) {
+      builder.setInsertionPoint(put);
+      Value channel = builder.create<arith::ConstantIntOp>(
+          put.getLoc(), putChannels[put.getStreamFifo()], 32);
+      builder.create<PutStreamOp>(put.getLoc(), channel, put.getValue());
+      put.erase();
+    });
+    device.walk([&](StreamFifoGetOp get) {
+      Value tile = get->getParentOfType<CoreOp>().getTile();
+      builder.setInsertionPoint(get);
+      Value channel = builder.create<arith::ConstantIntOp>(
+          get.getLoc(), getChannels[{get.getStreamFifo(), tile}], 32);
+      auto getStream = builder.create<GetStreamOp>(
+          get.getLoc(), get.getValue().getType(), channel);
+      get.getValue().replaceAllUsesWith(getStream.getStreamValue());
+      get.erase();
+    });
+
+    for (auto streamFifo :
+         llvm::make_early_inc_range(device.getOps<StreamFifoCreateOp>()))
+      streamFifo.erase();
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIELowerStreamFifosPass() {
+  return std::make_unique<AIELowerStreamFifosPass>();
+}
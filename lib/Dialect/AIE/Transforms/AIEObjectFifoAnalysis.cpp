@@ -0,0 +1,373 @@
+//===- AIEObjectFifoAnalysis.cpp --------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/MathExtras.h"
+
+#include <functional>
+#include <optional>
+
+#define DEBUG_TYPE "aie-objectFifo-analysis"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+// How a process accesses one port of an objectFifo, with the port either
+// being the producer or one of the consumers.
+struct PortUsage {
+  // the first operation accessing the port, used to report diagnostics
+  Operation *op = nullptr;
+  // the number of elements released over the whole execution
+  uint64_t released = 0;
+  // false if some releases happen in loops with non-constant bounds or under
+  // a condition, in which case released is only a lower bound
+  bool releasedKnown = true;
+  // the largest number of elements held at once
+  int maxAcquired = 0;
+
+  bool hasProcess() const { return op != nullptr; }
+  // DMAs hold one element at a time
+  int getHeld() const { return hasProcess() ? maxAcquired : 1; }
+};
+
+struct FifoUsage {
+  PortUsage producer;
+  std::vector<PortUsage> consumers;
+  // the objectFifos this one waits on for its first element: the producer
+  // acquires elements of these as a consumer before it first releases
+  SmallVector<ObjectFifoCreateOp, 4> waitsOn;
+};
+
+} // namespace
+
+struct AIEObjectFifoAnalysisPass
+    : public AIEObjectFifoAnalysisBase<AIEObjectFifoAnalysisPass> {
+  DenseMap<ObjectFifoCreateOp, FifoUsage> usages;
+
+  /// Function that returns the usage of the port of objFifo accessed from
+  /// tile, or nullptr if tile is not an endpoint of that port.
+  PortUsage *getPortUsage(ObjectFifoCreateOp objFifo, ObjectFifoPort port,
+                          Value tile) {
+    FifoUsage &usage = usages[objFifo];
+    if (port == ObjectFifoPort::Produce)
+      return objFifo.getProducerTile() == tile ? &usage.producer : nullptr;
+    auto consumerTiles = objFifo.getConsumerTiles();
+    for (unsigned i = 0; i < consumerTiles.size(); i++)
+      if (consumerTiles[i] == tile)
+        return &usage.consumers[i];
+    return nullptr;
+  }
+
+  /// Function that returns how many times op is executed each time its core
+  /// runs, if this is known statically.
+  std::optional<uint64_t> getExecutionCount(Operation *op, CoreOp core) {
+    uint64_t count = 1;
+    for (Operation *parent = op->getParentOp(); parent != core;
+         parent = parent->getParentOp()) {
+      auto forOp = dyn_cast<scf::ForOp>(parent);
+      if (!forOp)
+        return std::nullopt;
+      auto lb = forOp.getLowerBound().getDefiningOp<arith::ConstantIndexOp>();
+      auto ub = forOp.getUpperBound().getDefiningOp<arith::ConstantIndexOp>();
+      auto step = forOp.getStep().getDefiningOp<arith::ConstantIndexOp>();
+      if (!lb || !ub || !step || step.value() <= 0)
+        return std::nullopt;
+      uint64_t tripCount = 0;
+      if (ub.value() > lb.value())
+        tripCount = (ub.value() - lb.value() + step.value() - 1) / step.value();
+      count = llvm::SaturatingMultiply(count, tripCount);
+    }
+    return count;
+  }
+
+  /// Function that collects the accesses of the cores to objectFifos.
+  void analyzeCore(CoreOp core) {
+    // the objectFifos acquired as a consumer so far, and the objectFifos
+    // released as a producer so far, in program order
+    SmallVector<ObjectFifoCreateOp, 4> consumed;
+    SmallVector<ObjectFifoCreateOp, 4> produced;
+    core.walk<WalkOrder::PreOrder>([&](Operation *op) {
+      if (auto acqOp = dyn_cast<ObjectFifoAcquireOp>(op)) {
+        ObjectFifoCreateOp objFifo = acqOp.getObjectFifo();
+        PortUsage *port =
+            getPortUsage(objFifo, acqOp.getPort(), core.getTile());
+        if (!port)
+          return;
+        if (!port->op)
+          port->op = op;
+        port->maxAcquired = std::max(port->maxAcquired, acqOp.acqNumber());
+        if (acqOp.getPort() == ObjectFifoPort::Consume &&
+            !llvm::is_contained(consumed, objFifo))
+          consumed.push_back(objFifo);
+
+      } else if (auto relOp = dyn_cast<ObjectFifoReleaseOp>(op)) {
+        ObjectFifoCreateOp objFifo = relOp.getObjectFifo();
+        PortUsage *port =
+            getPortUsage(objFifo, relOp.getPort(), core.getTile());
+        if (!port)
+          return;
+        if (!port->op)
+          port->op = op;
+        std::optional<uint64_t> count = getExecutionCount(op, core);
+        if (count)
+          port->released = llvm::SaturatingAdd(
+              port->released,
+              llvm::SaturatingMultiply<uint64_t>(*count, relOp.relNumber()));
+        else
+          port->releasedKnown = false;
+        if (relOp.getPort() == ObjectFifoPort::Produce &&
+            !llvm::is_contained(produced, objFifo)) {
+          produced.push_back(objFifo);
+          for (auto input : consumed)
+            if (input != objFifo)
+              usages[objFifo].waitsOn.push_back(input);
+        }
+      }
+    });
+  }
+
+  /// Function that collects the accesses of the processes registered to
+  /// objectFifos, following the patterns generated by
+  /// AIEObjectFifoRegisterProcess.
+  void analyzeRegisteredProcess(ObjectFifoRegisterProcessOp regOp,
+                                DenseMap<ObjectFifoCreateOp, int> &consumers) {
+    ObjectFifoCreateOp objFifo = regOp.getObjectFifo();
+    FifoUsage &usage = usages[objFifo];
+    PortUsage *port;
+    if (regOp.getPort() == ObjectFifoPort::Produce) {
+      port = &usage.producer;
+    } else {
+      int index = consumers[objFifo]++;
+      if (index >= (int)usage.consumers.size())
+        return;
+      port = &usage.consumers[index];
+    }
+    if (!port->op)
+      port->op = regOp;
+
+    for (auto acqNumber : regOp.getAcquirePattern().getValues<int32_t>())
+      port->maxAcquired = std::max(port->maxAcquired, (int)acqNumber);
+    auto relPattern = regOp.getReleasePattern().getValues<int32_t>();
+    uint64_t released = 0;
+    if (regOp.getReleasePattern().size() == 1)
+      released = (uint64_t)relPattern[0] * regOp.getProcessLength();
+    else
+      for (auto relNumber : relPattern)
+        released += relNumber;
+    port->released = llvm::SaturatingAdd(port->released, released);
+  }
+
+  /// Function that returns true if the elements of objFifo are shared by its
+  /// producer and consumer, the same way AIEObjectFifoStatefulTransform
+  /// decides to use shared memory instead of DMAs.
+  bool isSharedMemory(ObjectFifoCreateOp objFifo) {
+    if (objFifo.getConsumerTiles().size() != 1)
+      return false;
+    TileOp a = objFifo.getProducerTileOp();
+    TileOp b = objFifo.getConsumerTiles()[0].getDefiningOp<TileOp>();
+    if (a.isShimTile() || b.isShimTile() || a.isMemTile() || b.isMemTile())
+      return false;
+    const auto &targetModel = getTargetModel(objFifo.getOperation());
+    return targetModel.isLegalMemAffinity(a.colIndex(), a.rowIndex(),
+                                          b.colIndex(), b.rowIndex()) ||
+           targetModel.isLegalMemAffinity(b.colIndex(), b.rowIndex(),
+                                          a.colIndex(), a.rowIndex());
+  }
+
+  /// Function that returns the number of elements of objFifo on the side of
+  /// the port with the given index (0 for the producer, i + 1 for consumer
+  /// i) when it is split by DMAs, the same way
+  /// AIEObjectFifoStatefulTransform sizes them.
+  int getSplitDepth(ObjectFifoCreateOp objFifo, int index,
+                    const PortUsage &port) {
+    if (isa<ArrayAttr>(objFifo.getElemNumber()))
+      return objFifo.size(index);
+    if (!port.hasProcess() || port.maxAcquired == 0)
+      return objFifo.size();
+    if (port.maxAcquired == 1 && objFifo.size() == 1)
+      return 1;
+    return port.maxAcquired + 1;
+  }
+
+  static std::string getTileName(Value tile) {
+    TileOp tileOp = tile.getDefiningOp<TileOp>();
+    return "(" + std::to_string(tileOp.colIndex()) + ", " +
+           std::to_string(tileOp.rowIndex()) + ")";
+  }
+
+  /// Function that reports a process that acquires more elements than the
+  /// objectFifo has on its side, as it can never proceed.
+  void checkDepth(ObjectFifoCreateOp objFifo, const PortUsage &port,
+                  int depth) {
+    if (port.hasProcess() && port.maxAcquired > depth)
+      port.op->emitWarning("deadlock: acquires ")
+          << port.maxAcquired << " elements of objectFifo @"
+          << objFifo.getSymName() << ", which only has " << depth;
+  }
+
+  void checkDepths(ObjectFifoCreateOp objFifo, const FifoUsage &usage) {
+    if (isSharedMemory(objFifo)) {
+      checkDepth(objFifo, usage.producer, objFifo.size());
+      checkDepth(objFifo, usage.consumers[0], objFifo.size());
+      return;
+    }
+    checkDepth(objFifo, usage.producer,
+               getSplitDepth(objFifo, 0, usage.producer));
+    for (unsigned i = 0; i < usage.consumers.size(); i++)
+      checkDepth(objFifo, usage.consumers[i],
+                 getSplitDepth(objFifo, i + 1, usage.consumers[i]));
+  }
+
+  /// Function that reports producers and consumers whose total number of
+  /// released elements do not balance: a consumer releasing more than is
+  /// produced waits forever, and a producer releasing more than is consumed
+  /// plus what fits in the objectFifo blocks forever.
+  void checkBalance(ObjectFifoCreateOp objFifo, const FifoUsage &usage) {
+    const PortUsage &producer = usage.producer;
+    if (!producer.hasProcess() || !producer.releasedKnown)
+      return;
+    for (unsigned i = 0; i < usage.consumers.size(); i++) {
+      const PortUsage &consumer = usage.consumers[i];
+      if (!consumer.hasProcess() || !consumer.releasedKnown)
+        continue;
+      std::string consumerTile = getTileName(objFifo.getConsumerTiles()[i]);
+      if (consumer.released > producer.released)
+        consumer.op->emitWarning("deadlock: the consumer on tile ")
+            << consumerTile << " releases " << consumer.released
+            << " elements of objectFifo @" << objFifo.getSymName()
+            << " but the producer only releases " << producer.released;
+      else if (producer.released - consumer.released >
+               (uint64_t)objFifo.size())
+        producer.op->emitWarning("deadlock: the producer releases ")
+            << producer.released << " elements of objectFifo @"
+            << objFifo.getSymName() << " but the consumer on tile "
+            << consumerTile << " only releases " << consumer.released;
+    }
+  }
+
+  /// Function that reports whether the depth of objFifo lets its producer
+  /// and consumers work at the same time. In steady state, each side holds
+  /// up to the number of elements it acquires, and the other side can only
+  /// proceed if the objectFifo has room for both. Otherwise they alternate,
+  /// and the throughput is bound by their combined time per element.
+  void reportThroughput(ObjectFifoCreateOp objFifo, const FifoUsage &usage) {
+    int producerHeld = usage.producer.getHeld();
+    if (isSharedMemory(objFifo)) {
+      int needed = producerHeld + usage.consumers[0].getHeld();
+      if (objFifo.size() >= needed)
+        objFifo.emitRemark("objectFifo @")
+            << objFifo.getSymName() << " overlaps its producer and consumer, "
+            << "its throughput is bound by the slowest of them";
+      else
+        objFifo.emitRemark("objectFifo @")
+            << objFifo.getSymName() << " serializes its producer and consumer, "
+            << "its throughput is bound by their combined time per element; "
+            << "a depth of " << needed << " would overlap them";
+      return;
+    }
+
+    // when split, the DMA on each side holds one element
+    int needed = 0;
+    std::string serialized;
+    if (getSplitDepth(objFifo, 0, usage.producer) < producerHeld + 1) {
+      needed = producerHeld + 1;
+      serialized = " the producer on tile " +
+                   getTileName(objFifo.getProducerTile());
+    }
+    for (unsigned i = 0; i < usage.consumers.size(); i++) {
+      const PortUsage &consumer = usage.consumers[i];
+      if (getSplitDepth(objFifo, i + 1, consumer) >= consumer.getHeld() + 1)
+        continue;
+      needed = std::max(needed, consumer.getHeld() + 1);
+      serialized += std::string(serialized.empty() ? "" : " and") +
+                    " the consumer on tile " +
+                    getTileName(objFifo.getConsumerTiles()[i]);
+    }
+    if (!needed)
+      objFifo.emitRemark("objectFifo @")
+          << objFifo.getSymName() << " overlaps its endpoints and DMAs, "
+          << "its throughput is bound by the slowest of them";
+    else
+      objFifo.emitRemark("objectFifo @")
+          << objFifo.getSymName() << " serializes" << serialized
+          << " with its DMA, its throughput is bound by their combined time "
+          << "per element; a depth of " << needed << " would overlap them";
+  }
+
+  /// Function that reports the cycles of objectFifos whose first elements
+  /// wait on each other, which can never be produced.
+  void checkCycles(DeviceOp device) {
+    DenseMap<ObjectFifoCreateOp, int> state; // 1: on the stack, 2: done
+    SmallVector<ObjectFifoCreateOp, 8> stack;
+    std::function<void(ObjectFifoCreateOp)> visit =
+        [&](ObjectFifoCreateOp objFifo) {
+          state[objFifo] = 1;
+          stack.push_back(objFifo);
+          for (auto input : usages[objFifo].waitsOn) {
+            if (state.lookup(input) == 1) {
+              auto cycleStart = llvm::find(stack, input);
+              auto diag = input.emitWarning(
+                  "deadlock: the first elements of these objectFifos wait "
+                  "on each other: ");
+              for (auto it = cycleStart; it != stack.end(); ++it)
+                diag << "@" << it->getSymName() << " -> ";
+              diag << "@" << input.getSymName();
+            } else if (!state.lookup(input)) {
+              visit(input);
+            }
+          }
+          stack.pop_back();
+          state[objFifo] = 2;
+        };
+    for (auto objFifo : device.getOps<ObjectFifoCreateOp>())
+      if (!state.lookup(objFifo))
+        visit(objFifo);
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+
+    for (auto objFifo : device.getOps<ObjectFifoCreateOp>())
+      usages[objFifo].consumers.resize(objFifo.getConsumerTiles().size());
+
+    for (auto core : device.getOps<CoreOp>())
+      analyzeCore(core);
+    DenseMap<ObjectFifoCreateOp, int> registeredConsumers;
+    for (auto regOp : device.getOps<ObjectFifoRegisterProcessOp>())
+      analyzeRegisteredProcess(regOp, registeredConsumers);
+
+    for (auto objFifo : device.getOps<ObjectFifoCreateOp>()) {
+      const FifoUsage &usage = usages[objFifo];
+      LLVM_DEBUG(llvm::dbgs() << "objectFifo @" << objFifo.getSymName()
+                              << ": producer releases "
+                              << usage.producer.released << ", holds "
+                              << usage.producer.maxAcquired << "\n");
+      checkDepths(objFifo, usage);
+      checkBalance(objFifo, usage);
+      if (reportThroughputBound)
+        reportThroughput(objFifo, usage);
+    }
+    checkCycles(device);
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEObjectFifoAnalysisPass() {
+  return std::make_unique<AIEObjectFifoAnalysisPass>();
+}
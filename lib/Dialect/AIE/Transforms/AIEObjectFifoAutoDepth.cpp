@@ -0,0 +1,225 @@
+//===- AIEObjectFifoAutoDepth.cpp -------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-objectFifo-auto-depth"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+struct AIEObjectFifoAutoDepthPass
+    : public AIEObjectFifoAutoDepthBase<AIEObjectFifoAutoDepthPass> {
+  DenseMap<std::pair<ObjectFifoCreateOp, Operation *>, int>
+      maxAcquired; // maps each objFifo and tile to the largest number of
+                   // elements acquired at once by the process on that tile
+  DenseMap<Operation *, int64_t>
+      allocatedMemory; // maps each tile to the number of bytes of its memory
+                       // that are used or planned to be used
+
+  /// Function that collects the largest acquires of the cores and of the
+  /// processes registered to objectFifos.
+  void collectAcquires(DeviceOp device) {
+    for (auto core : device.getOps<CoreOp>()) {
+      Operation *tile = core.getTile().getDefiningOp();
+      core.walk([&](ObjectFifoAcquireOp acqOp) {
+        int &held = maxAcquired[{acqOp.getObjectFifo(), tile}];
+        held = std::max(held, acqOp.acqNumber());
+      });
+    }
+    DenseMap<ObjectFifoCreateOp, int> consumers;
+    for (auto regOp : device.getOps<ObjectFifoRegisterProcessOp>()) {
+      ObjectFifoCreateOp objFifo = regOp.getObjectFifo();
+      Value tile = objFifo.getProducerTile();
+      if (regOp.getPort() == ObjectFifoPort::Consume) {
+        unsigned index = consumers[objFifo]++;
+        if (index >= objFifo.getConsumerTiles().size())
+          continue;
+        tile = objFifo.getConsumerTiles()[index];
+      }
+      int &held = maxAcquired[{objFifo, tile.getDefiningOp()}];
+      for (auto acqNumber : regOp.getAcquirePattern().getValues<int32_t>())
+        held = std::max(held, (int)acqNumber);
+    }
+  }
+
+  /// Function that returns the largest number of elements of objFifo held at
+  /// once on tile. Tiles without a process are served by DMAs, which hold one
+  /// element at a time.
+  int getHeld(ObjectFifoCreateOp objFifo, Value tile) {
+    auto it = maxAcquired.find({objFifo, tile.getDefiningOp()});
+    return it == maxAcquired.end() ? 1 : it->second;
+  }
+
+  /// Function that returns the number of bytes of data memory of tile, as
+  /// used by AIEAssignBufferAddresses.
+  int64_t getMemorySize(TileOp tile) {
+    const auto &targetModel = getTargetModel(tile.getOperation());
+    if (tile.isMemTile())
+      return targetModel.getMemTileSize();
+    return targetModel.getLocalMemorySize();
+  }
+
+  /// Function that records the memory used by the stack of the cores and by
+  /// the buffers, as counted by AIEAssignBufferAddresses.
+  void collectAllocatedMemory(DeviceOp device) {
+    for (auto core : device.getOps<CoreOp>())
+      allocatedMemory[core.getTile().getDefiningOp()] += core.getStackSize();
+    for (auto buffer : device.getOps<BufferOp>())
+      allocatedMemory[buffer.getTileOp()] += buffer.getAllocationSize();
+  }
+
+  static int64_t getElementBytes(ObjectFifoCreateOp objFifo) {
+    MemRefType elemType = objFifo.getElemType()
+                              .cast<AIEObjectFifoType>()
+                              .getElementType()
+                              .cast<MemRefType>();
+    return elemType.getNumElements() * elemType.getElementTypeBitWidth() / 8;
+  }
+
+  /// Function that returns true if the elements of objFifo are shared by its
+  /// producer and consumer, the same way AIEObjectFifoStatefulTransform
+  /// decides to use shared memory instead of DMAs.
+  bool isSharedMemory(ObjectFifoCreateOp objFifo) {
+    if (objFifo.getConsumerTiles().size() != 1)
+      return false;
+    TileOp a = objFifo.getProducerTileOp();
+    TileOp b = objFifo.getConsumerTiles()[0].getDefiningOp<TileOp>();
+    if (a.isShimTile() || b.isShimTile() || a.isMemTile() || b.isMemTile())
+      return false;
+    const auto &targetModel = getTargetModel(objFifo.getOperation());
+    return targetModel.isLegalMemAffinity(a.colIndex(), a.rowIndex(),
+                                          b.colIndex(), b.rowIndex()) ||
+           targetModel.isLegalMemAffinity(b.colIndex(), b.rowIndex(),
+                                          a.colIndex(), a.rowIndex());
+  }
+
+  /// Function that returns the number of elements of a split objFifo of
+  /// depth size created on tile, the same way AIEObjectFifoStatefulTransform
+  /// sizes them, or 0 if the elements are not allocated by the compiler.
+  int getSplitDepth(ObjectFifoCreateOp objFifo, Value tile, int size) {
+    TileOp tileOp = tile.getDefiningOp<TileOp>();
+    if (tileOp.isShimTile())
+      return 0;
+    if (tileOp.isMemTile())
+      return size;
+    auto it = maxAcquired.find({objFifo, tile.getDefiningOp()});
+    if (it == maxAcquired.end() || it->second == 0)
+      return size;
+    if (it->second == 1 && size == 1)
+      return 1;
+    return it->second + 1;
+  }
+
+  /// Function that returns the tiles holding the elements of objFifo, with
+  /// the number of elements on each of them if its depth is size.
+  SmallVector<std::pair<TileOp, int>, 4>
+  getElementTiles(ObjectFifoCreateOp objFifo, int size) {
+    SmallVector<std::pair<TileOp, int>, 4> tiles;
+    if (isSharedMemory(objFifo)) {
+      tiles.push_back({objFifo.getProducerTileOp(), size});
+      return tiles;
+    }
+    tiles.push_back({objFifo.getProducerTileOp(),
+                     getSplitDepth(objFifo, objFifo.getProducerTile(), size)});
+    for (auto consumerTile : objFifo.getConsumerTiles())
+      tiles.push_back({consumerTile.getDefiningOp<TileOp>(),
+                       getSplitDepth(objFifo, consumerTile, size)});
+    return tiles;
+  }
+
+  /// Function that returns the smallest depth of objFifo which lets its
+  /// producer and consumers work at the same time: when shared, both hold
+  /// their elements at once, and when split, the DMA on each side holds one
+  /// more element.
+  int getUsefulDepth(ObjectFifoCreateOp objFifo) {
+    if (isSharedMemory(objFifo))
+      return getHeld(objFifo, objFifo.getProducerTile()) +
+             getHeld(objFifo, objFifo.getConsumerTiles()[0]);
+    // split objectFifos already get one element more than is acquired,
+    // except those of depth 1 acquiring one element
+    return 2;
+  }
+
+  /// Function that returns true if the depth of objFifo can be set to
+  /// newSize with the memory left on the tiles holding its elements.
+  bool fits(ObjectFifoCreateOp objFifo, int newSize) {
+    int64_t elemBytes = getElementBytes(objFifo);
+    auto oldTiles = getElementTiles(objFifo, objFifo.size());
+    auto newTiles = getElementTiles(objFifo, newSize);
+    for (unsigned i = 0; i < newTiles.size(); i++) {
+      TileOp tile = newTiles[i].first;
+      int64_t extra = (newTiles[i].second - oldTiles[i].second) * elemBytes;
+      if (extra > 0 &&
+          allocatedMemory[tile] + extra > getMemorySize(tile))
+        return false;
+    }
+    return true;
+  }
+
+  void resize(ObjectFifoCreateOp objFifo, int newSize) {
+    int64_t elemBytes = getElementBytes(objFifo);
+    auto oldTiles = getElementTiles(objFifo, objFifo.size());
+    auto newTiles = getElementTiles(objFifo, newSize);
+    for (unsigned i = 0; i < newTiles.size(); i++)
+      allocatedMemory[newTiles[i].first] +=
+          (newTiles[i].second - oldTiles[i].second) * elemBytes;
+    objFifo->setAttr("elemNumber",
+                     IntegerAttr::get(IntegerType::get(&getContext(), 32),
+                                      newSize));
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    collectAcquires(device);
+    collectAllocatedMemory(device);
+
+    // objectFifos with a depth per tile are left as they are
+    SmallVector<ObjectFifoCreateOp, 16> objFifos;
+    for (auto objFifo : device.getOps<ObjectFifoCreateOp>())
+      if (!isa<ArrayAttr>(objFifo.getElemNumber()) && objFifo.size() > 0)
+        objFifos.push_back(objFifo);
+
+    for (auto objFifo : objFifos)
+      for (auto [tile, numElem] : getElementTiles(objFifo, objFifo.size()))
+        allocatedMemory[tile] += numElem * getElementBytes(objFifo);
+
+    // in program order, deepen each objectFifo up to the depth which lets its
+    // endpoints overlap, as far as the memory left allows
+    for (auto objFifo : objFifos) {
+      int size = objFifo.size();
+      int target = std::min(getUsefulDepth(objFifo), (int)maxDepth);
+      int newSize = target;
+      while (newSize > size && !fits(objFifo, newSize))
+        newSize--;
+      if (newSize <= size) {
+        if (target > size)
+          objFifo.emitRemark("not enough memory left to deepen objectFifo @")
+              << objFifo.getSymName() << " from " << size << " to "
+              << target << " elements";
+        continue;
+      }
+      LLVM_DEBUG(llvm::dbgs() << "Deepen objectFifo @" << objFifo.getSymName()
+                              << " from " << size << " to " << newSize
+                              << "\n");
+      resize(objFifo, newSize);
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEObjectFifoAutoDepthPass() {
+  return std::make_unique<AIEObjectFifoAutoDepthPass>();
+}
@@ -0,0 +1,241 @@
+//===- AIEObjectFifoCopyElision.cpp -----------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the elision of the copies between the objectFifo
+// elements acquired by the cores and the local buffers their kernels compute
+// in, so that the kernels work directly in the elements the DMAs move.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Interfaces/CopyOpInterface.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-objectFifo-copy-elision"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+// The buffers of a core a copy from or to an objectFifo element can be
+// elided into.
+enum class LocalBuffer {
+  None,
+  // A memref.alloc or memref.alloca of the core
+  Allocated,
+  // An unnamed AIE.buffer only used by the core
+  Declared
+};
+
+} // namespace
+
+/// Function that returns the acquire holding the objectFifo element memref,
+/// or nullptr if memref is not an objectFifo element.
+static ObjectFifoAcquireOp getElementAcquire(Value memref) {
+  auto access = memref.getDefiningOp<ObjectFifoSubviewAccessOp>();
+  if (!access)
+    return nullptr;
+  return access.getSubview().getDefiningOp<ObjectFifoAcquireOp>();
+}
+
+/// Function that returns the kind of local buffer of core that local is.
+/// Named AIE.buffers can be accessed by the host and are not local.
+static LocalBuffer getLocalBuffer(Value local, CoreOp core) {
+  Operation *def = local.getDefiningOp();
+  if (!def)
+    return LocalBuffer::None;
+  if (isa<memref::AllocOp, memref::AllocaOp>(def))
+    return core->isProperAncestor(def) ? LocalBuffer::Allocated
+                                       : LocalBuffer::None;
+  auto buffer = dyn_cast<BufferOp>(def);
+  if (!buffer || buffer.hasName())
+    return LocalBuffer::None;
+  for (Operation *user : local.getUsers())
+    if (!core->isProperAncestor(user))
+      return LocalBuffer::None;
+  return LocalBuffer::Declared;
+}
+
+/// Function that returns true if op, which uses value, may write to it.
+/// The writes through the views of value are not tracked.
+static bool mayWrite(Operation *op, Value value) {
+  if (llvm::any_of(op->getResultTypes(),
+                   [](Type type) { return isa<BaseMemRefType>(type); }))
+    return true;
+  auto effectOp = dyn_cast<MemoryEffectOpInterface>(op);
+  if (!effectOp)
+    return true;
+  SmallVector<MemoryEffects::EffectInstance, 4> effects;
+  effectOp.getEffects(effects);
+  return llvm::any_of(effects, [&](MemoryEffects::EffectInstance &effect) {
+    return isa<MemoryEffects::Write>(effect.getEffect()) &&
+           (!effect.getValue() || effect.getValue() == value);
+  });
+}
+
+/// Function that returns true if an operation from first to last, in the same
+/// block, or nested in one of them, releases elements of the port of
+/// objFifo.
+static bool releasesBetween(Operation *first, Operation *last,
+                            ObjectFifoCreateOp objFifo, ObjectFifoPort port) {
+  for (Operation *op = first; op; op = op->getNextNode()) {
+    auto result = op->walk([&](ObjectFifoReleaseOp release) {
+      if (release.getObjectFifo() == objFifo && release.getPort() == port)
+        return WalkResult::interrupt();
+      return WalkResult::advance();
+    });
+    if (result.wasInterrupted())
+      return true;
+    if (op == last)
+      break;
+  }
+  return false;
+}
+
+/// Function that returns true if element is the only access to its index of
+/// the subview acquired by acquire.
+static bool isOnlyAccess(Value element, ObjectFifoAcquireOp acquire) {
+  auto access = element.getDefiningOp<ObjectFifoSubviewAccessOp>();
+  return llvm::all_of(acquire->getUsers(), [&](Operation *user) {
+    auto other = dyn_cast<ObjectFifoSubviewAccessOp>(user);
+    return other && (other == access || other.getIndex() != access.getIndex());
+  });
+}
+
+/// Function that replaces local by element after erasing copy, and removes
+/// local if it is not used anymore.
+static void replaceLocalBuffer(CopyOpInterface copy, Value local,
+                               Value element) {
+  LLVM_DEBUG(llvm::dbgs() << "Eliding " << copy << "\n");
+  copy->erase();
+  for (Operation *user : llvm::make_early_inc_range(local.getUsers()))
+    if (isa<memref::DeallocOp>(user))
+      user->erase();
+  local.replaceAllUsesWith(element);
+  local.getDefiningOp()->erase();
+}
+
+struct AIEObjectFifoCopyElisionPass
+    : public AIEObjectFifoCopyElisionBase<AIEObjectFifoCopyElisionPass> {
+
+  /// Function that makes the kernels of core read the objectFifo element
+  /// that copy copies to a local buffer, instead of the local buffer. The
+  /// local buffer must only be used after the copy in the same block, and
+  /// before the element is released. If the kernels may write to it, the
+  /// element must not be visible to anyone else: its objectFifo has a single
+  /// consumer, which acquires one element at a time.
+  bool elideInputCopy(CopyOpInterface copy, CoreOp core) {
+    Value element = copy.getSource(), local = copy.getTarget();
+    auto acquire = getElementAcquire(element);
+    if (!acquire || acquire.getPort() != ObjectFifoPort::Consume ||
+        element.getType() != local.getType() ||
+        getLocalBuffer(local, core) == LocalBuffer::None)
+      return false;
+
+    Block *block = copy->getBlock();
+    Operation *last = copy;
+    bool written = false;
+    for (Operation *user : local.getUsers()) {
+      if (user == copy || isa<memref::DeallocOp>(user))
+        continue;
+      Operation *ancestor = block->findAncestorOpInBlock(*user);
+      if (!ancestor || !copy->isBeforeInBlock(ancestor))
+        return false;
+      if (last->isBeforeInBlock(ancestor))
+        last = ancestor;
+      written |= mayWrite(user, local);
+    }
+
+    ObjectFifoCreateOp objFifo = acquire.getObjectFifo();
+    if (last != copy && releasesBetween(copy->getNextNode(), last, objFifo,
+                                        ObjectFifoPort::Consume))
+      return false;
+    if (written) {
+      if (objFifo.getConsumerTiles().size() != 1 || !element.hasOneUse() ||
+          !isOnlyAccess(element, acquire))
+        return false;
+      auto result = core.walk([&](ObjectFifoAcquireOp other) {
+        if (other.getObjectFifo() == objFifo &&
+            other.getPort() == ObjectFifoPort::Consume &&
+            other.acqNumber() != 1)
+          return WalkResult::interrupt();
+        return WalkResult::advance();
+      });
+      if (result.wasInterrupted())
+        return false;
+    }
+
+    replaceLocalBuffer(copy, local, element);
+    return true;
+  }
+
+  /// Function that makes the kernels of core write the objectFifo element
+  /// that copy copies a local buffer to, instead of the local buffer. The
+  /// local buffer must only be used before the copy in the same block, once
+  /// the element is accessed, and the element must not be accessed nor
+  /// released in between. Unless assumeOverwrite is set, the local buffer
+  /// must also be allocated in the block, so that the kernels cannot read
+  /// what they wrote to it before.
+  bool elideOutputCopy(CopyOpInterface copy, CoreOp core) {
+    Value local = copy.getSource(), element = copy.getTarget();
+    auto acquire = getElementAcquire(element);
+    if (!acquire || acquire.getPort() != ObjectFifoPort::Produce ||
+        element.getType() != local.getType())
+      return false;
+    LocalBuffer kind = getLocalBuffer(local, core);
+    if (kind == LocalBuffer::None)
+      return false;
+
+    Block *block = copy->getBlock();
+    Operation *access = block->findAncestorOpInBlock(*element.getDefiningOp());
+    Operation *first = copy;
+    for (Operation *user : local.getUsers()) {
+      if (user == copy || isa<memref::DeallocOp>(user))
+        continue;
+      Operation *ancestor = block->findAncestorOpInBlock(*user);
+      if (!ancestor || !ancestor->isBeforeInBlock(copy) ||
+          (access && !access->isBeforeInBlock(ancestor)))
+        return false;
+      if (ancestor->isBeforeInBlock(first))
+        first = ancestor;
+    }
+
+    bool fresh = kind == LocalBuffer::Allocated &&
+                 local.getDefiningOp()->getBlock() == block;
+    if (!fresh && !assumeOverwrite)
+      return false;
+    if (!element.hasOneUse() || !isOnlyAccess(element, acquire) ||
+        releasesBetween(first, copy, acquire.getObjectFifo(),
+                        ObjectFifoPort::Produce))
+      return false;
+
+    replaceLocalBuffer(copy, local, element);
+    return true;
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    for (auto core : device.getOps<CoreOp>()) {
+      SmallVector<CopyOpInterface, 4> copies;
+      core.walk([&](CopyOpInterface copy) { copies.push_back(copy); });
+      for (auto copy : copies)
+        if (!elideInputCopy(copy, core))
+          elideOutputCopy(copy, core);
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEObjectFifoCopyElisionPass() {
+  return std::make_unique<AIEObjectFifoCopyElisionPass>();
+}
@@ -0,0 +1,148 @@
+//===- AIEObjectFifoHoistAcquires.cpp ---------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the hoisting of the objectFifo acquires the loops of
+// the cores repeat on elements they already hold, and the peeling of the
+// first iteration of the loops holding elements across iterations, so that
+// aie-objectFifo-stateful-transform only acquires the locks of the elements
+// each iteration of their steady state needs.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-objectFifo-hoist-acquires"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+// The elements an iteration of a loop acquires and releases on a port of an
+// objectFifo.
+struct PortAccesses {
+  int acquired = 0;
+  int released = 0;
+};
+
+} // namespace
+
+/// Function that returns the number of iterations of forLoop, or -1 if its
+/// bounds are not constants.
+static int64_t getTripCount(scf::ForOp forLoop) {
+  auto lb = getConstantIntValue(forLoop.getLowerBound());
+  auto ub = getConstantIntValue(forLoop.getUpperBound());
+  auto step = getConstantIntValue(forLoop.getStep());
+  if (!lb || !ub || !step || *step <= 0)
+    return -1;
+  if (*ub <= *lb)
+    return 0;
+  return (*ub - *lb + *step - 1) / *step;
+}
+
+/// Function that returns true if forLoop, or a region nested in it, releases
+/// elements of the port of objFifo.
+static bool releasesIn(scf::ForOp forLoop, ObjectFifoCreateOp objFifo,
+                       ObjectFifoPort port) {
+  auto result = forLoop.walk([&](ObjectFifoReleaseOp release) {
+    if (release.getObjectFifo() == objFifo && release.getPort() == port)
+      return WalkResult::interrupt();
+    return WalkResult::advance();
+  });
+  return result.wasInterrupted();
+}
+
+struct AIEObjectFifoHoistAcquiresPass
+    : public AIEObjectFifoHoistAcquiresBase<AIEObjectFifoHoistAcquiresPass> {
+
+  /// Function that moves the acquires of the body of forLoop on ports of
+  /// objectFifos it never releases before it: its first iteration acquires
+  /// their elements and the next ones only access them again.
+  void hoistAcquires(scf::ForOp forLoop) {
+    for (auto acquire : llvm::make_early_inc_range(
+             forLoop.getBody()->getOps<ObjectFifoAcquireOp>())) {
+      if (releasesIn(forLoop, acquire.getObjectFifo(), acquire.getPort()))
+        continue;
+      LLVM_DEBUG(llvm::dbgs() << "Hoisting " << acquire << "\n");
+      acquire->moveBefore(forLoop);
+    }
+  }
+
+  /// Function that returns true if an iteration of forLoop acquires elements
+  /// of a port of an objectFifo that it does not release, and which the next
+  /// iteration accesses again.
+  bool holdsAcrossIterations(scf::ForOp forLoop) {
+    DenseMap<std::pair<Operation *, int>, PortAccesses> accesses;
+    for (Operation &op : *forLoop.getBody()) {
+      if (auto acquire = dyn_cast<ObjectFifoAcquireOp>(op)) {
+        PortAccesses &port = accesses[{acquire.getObjectFifo(),
+                                       static_cast<int>(acquire.getPort())}];
+        port.acquired = std::max(port.acquired, acquire.acqNumber());
+      } else if (auto release = dyn_cast<ObjectFifoReleaseOp>(op)) {
+        accesses[{release.getObjectFifo(),
+                  static_cast<int>(release.getPort())}]
+            .released += release.relNumber();
+      }
+    }
+    return llvm::any_of(accesses, [](auto &entry) {
+      return entry.second.released > 0 &&
+             entry.second.acquired > entry.second.released;
+    });
+  }
+
+  /// Function that copies the first iteration of forLoop before it, as the
+  /// prologue acquiring the elements the steady state keeps acquired.
+  void peelFirstIteration(OpBuilder &builder, scf::ForOp forLoop) {
+    LLVM_DEBUG(llvm::dbgs() << "Peeling the first iteration of " << forLoop
+                            << "\n");
+    builder.setInsertionPoint(forLoop);
+    IRMapping mapping;
+    mapping.map(forLoop.getInductionVar(), forLoop.getLowerBound());
+    for (Operation &op : forLoop.getBody()->without_terminator())
+      builder.clone(op, mapping);
+
+    int64_t lb = *getConstantIntValue(forLoop.getLowerBound());
+    int64_t step = *getConstantIntValue(forLoop.getStep());
+    forLoop.setLowerBound(builder.create<arith::ConstantIndexOp>(
+        forLoop.getLoc(), lb + step));
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+    for (auto core : device.getOps<CoreOp>()) {
+      // Inner loops first, so that their hoisted acquires can be hoisted out
+      // of the loops around them.
+      SmallVector<scf::ForOp, 4> loops;
+      core.walk([&](scf::ForOp forLoop) { loops.push_back(forLoop); });
+      for (auto forLoop : loops) {
+        // Hoisting or peeling the acquires of a loop that may not run would
+        // acquire elements the core never did.
+        int64_t tripCount = getTripCount(forLoop);
+        if (tripCount < 1 || forLoop.getNumRegionIterArgs() > 0)
+          continue;
+        hoistAcquires(forLoop);
+        if (tripCount > 1 && holdsAcrossIterations(forLoop))
+          peelFirstIteration(builder, forLoop);
+      }
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEObjectFifoHoistAcquiresPass() {
+  return std::make_unique<AIEObjectFifoHoistAcquiresPass>();
+}
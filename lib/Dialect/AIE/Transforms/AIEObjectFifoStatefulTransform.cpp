@@ -22,6 +22,7 @@
 #include "mlir/Pass/Pass.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/Support/Debug.h"
 #include <numeric>
 
@@ -83,6 +84,17 @@ public:
     }
     return -1;
   }
+
+  /// Given a tile, returns the number of its lockIDs still usable.
+  int getNumFreeLocks(TileOp &tileOp) {
+    const auto &target_model = xilinx::AIE::getTargetModel(tileOp);
+    int numFree = 0;
+    for (unsigned i = 0;
+         i < target_model.getNumLocks(tileOp.getCol(), tileOp.getRow()); i++)
+      if (locksPerTile.lookup(std::make_pair(tileOp, i)) == 0)
+        numFree++;
+    return numFree;
+  }
 };
 
 //===----------------------------------------------------------------------===//
@@ -130,6 +142,17 @@ public:
     return dmaChan;
   }
 
+  /// Given an AIE tile, returns the number of its master channels which are
+  /// not used yet.
+  int getNumFreeMasterDMAChannels(Value tile) {
+    TileOp tileOp = tile.getDefiningOp<TileOp>();
+    int numChannels = tileOp.getNumSourceConnections(WireBundle::DMA);
+    auto used = masterChannelsPerTile.find(tile);
+    if (used == masterChannelsPerTile.end())
+      return numChannels;
+    return numChannels - used->second - 1;
+  }
+
   /// Given an AIE tile, returns its next usable slave channel.
   xilinx::AIE::DMAChannel getSlaveDMAChannel(Value tile) {
     xilinx::AIE::DMAChannel dmaChan;
@@ -171,13 +194,41 @@ struct AIEObjectFifoStatefulTransformPass
   DenseMap<ObjectFifoLinkOp, ObjectFifoCreateOp>
       objFifoLinks; // maps each ObjectFifoLinkOp to objFifo whose elements
                     // have been created and should be used
+  DenseMap<ObjectFifoLinkOp, std::vector<std::vector<LockOp>>>
+      linkSliceLocks; // maps each distribute or join ObjectFifoLinkOp in a
+                      // memtile to the locks of each slice of its elements
+  DenseSet<mlir::scf::ForOp>
+      dynamicIndexLoops; // loops that are not unrolled, whose objFifo
+                         // elements are selected with a runtime index
+  DenseMap<ObjectFifoCreateOp, std::vector<TileOp>>
+      sharedConsumers; // maps each broadcast objFifo whose consumers all
+                       // access the memory of its producer to its consumer
+                       // tiles, each with locks of its own
+
+  /// Function that returns the number of bytes of data memory of a tile
+  /// that are already used, by the stack of its core and by its buffers,
+  /// as they are counted by AIEAssignBufferAddresses.
+  int64_t getAllocatedMemory(TileOp tile) {
+    int64_t allocated = 0;
+    if (auto core = tile.getCoreOp())
+      allocated += core.getStackSize();
+    auto device = tile->getParentOfType<DeviceOp>();
+    for (auto buffer : device.getOps<BufferOp>())
+      if (buffer.getTileOp() == tile)
+        allocated += buffer.getAllocationSize();
+    return allocated;
+  }
 
   /// Function that returns true if two tiles in the AIE array share a memory
   /// module. share_direction is equal to:
   ///   * -1 if the shared memory module is that of the first input tile,
   ///   * 1 if it is that of the second input tile,
   ///   * 0 is no memory module is shared.
-  bool isSharedMemory(TileOp a, TileOp b, int *share_direction) {
+  /// If both tiles can access the memory of the other, the memory of the
+  /// first tile is used unless fifoBytes more bytes do not fit in it. In that
+  /// case, the memory that would be the least full is used.
+  bool isSharedMemory(TileOp a, TileOp b, int *share_direction,
+                      int64_t fifoBytes = 0) {
     const auto &target_model = getTargetModel(a.getOperation());
 
     if ((a.isShimTile() && !b.isShimTile()) ||
@@ -198,6 +249,19 @@ struct AIEObjectFifoStatefulTransformPass
     bool leftShared = target_model.isLegalMemAffinity(
         b.colIndex(), b.rowIndex(), a.colIndex(), a.rowIndex());
 
+    if (leftShared && rightShared && fifoBytes > 0) {
+      int64_t capacity = target_model.getLocalMemorySize();
+      int64_t aAllocated = getAllocatedMemory(a) + fifoBytes;
+      int64_t bAllocated = getAllocatedMemory(b) + fifoBytes;
+      if (aAllocated > capacity && bAllocated < aAllocated) {
+        LLVM_DEBUG(llvm::dbgs()
+                   << "Shared objectFifo does not fit in tile (" << a.colIndex()
+                   << ", " << a.rowIndex() << "), using tile (" << b.colIndex()
+                   << ", " << b.rowIndex() << ")\n");
+        leftShared = false;
+      }
+    }
+
     if (leftShared)
       *share_direction = -1;
     else if (rightShared)
@@ -208,6 +272,41 @@ struct AIEObjectFifoStatefulTransformPass
     return leftShared || rightShared;
   }
 
+  /// Function that returns true if the consumers of the broadcast op can all
+  /// access its elements in the memory of its producer, which has room for
+  /// them and for the locks of each consumer.
+  bool isSharedBroadcast(ObjectFifoCreateOp op, LockAnalysis &lockAnalysis,
+                         int64_t fifoBytes) {
+    TileOp producer = op.getProducerTileOp();
+    const auto &target_model = getTargetModel(producer.getOperation());
+    if (op.getConsumerTiles().size() < 2 || producer.isShimTile() ||
+        producer.isMemTile() || getOptionalLinkOp(op))
+      return false;
+    // the consumers share the elements of the producer
+    if (isa<ArrayAttr>(op.getElemNumber()))
+      for (unsigned i = 1; i <= op.getConsumerTiles().size(); i++)
+        if (op.size(i) != op.size())
+          return false;
+    for (auto consumerTile : op.getConsumerTiles()) {
+      auto consumer = consumerTile.getDefiningOp<TileOp>();
+      if (consumer == producer || consumer.isShimTile() ||
+          consumer.isMemTile() ||
+          !target_model.isLegalMemAffinity(consumer.colIndex(),
+                                           consumer.rowIndex(),
+                                           producer.colIndex(),
+                                           producer.rowIndex()))
+        return false;
+    }
+    if (getAllocatedMemory(producer) + fifoBytes >
+        target_model.getLocalMemorySize())
+      return false;
+    int numConsumers = op.getConsumerTiles().size();
+    int numLocks = target_model.getTargetArch() == AIEArch::AIE1
+                       ? numConsumers * op.size()
+                       : numConsumers + 1;
+    return lockAnalysis.getNumFreeLocks(producer) >= numLocks;
+  }
+
   /// Function to multiply all dimensions of a memref.
   int64_t getMemrefTypeSize(MemRefType memref) {
     int64_t size = 1;
@@ -246,46 +345,68 @@ struct AIEObjectFifoStatefulTransformPass
   std::vector<LockOp> createObjectFifoLocks(OpBuilder &builder,
                                             LockAnalysis &lockAnalysis,
                                             ObjectFifoCreateOp op, int numElem,
-                                            TileOp creation_tile) {
+                                            TileOp creation_tile,
+                                            std::string name = "") {
     std::vector<LockOp> locks;
+    if (name.empty())
+      name = op.name().str();
     auto dev = op->getParentOfType<xilinx::AIE::DeviceOp>();
     auto &target = dev.getTargetModel();
     if (creation_tile.isShimTile())
       numElem = externalBuffersPerFifo[op].size();
+    // the consumers of a shared broadcast each have their own locks, named
+    // after their index
+    int numConsumers = 1;
+    if (sharedConsumers.count(op))
+      numConsumers = sharedConsumers[op].size();
+    auto getConsumerName = [&](int consumer) {
+      if (numConsumers == 1)
+        return name;
+      return name + "_" + std::to_string(consumer);
+    };
     if (target.getTargetArch() == xilinx::AIE::AIEArch::AIE1) {
-      int of_elem_index = 0; // used to give objectFifo elements a symbolic name
-      for (int i = 0; i < numElem; i++) {
-        // create corresponding aie1 locks
-        int lockID = lockAnalysis.getLockID(creation_tile);
-        assert(lockID >= 0 && "No more locks to allocate!");
-        LockOp lock = builder.create<LockOp>(builder.getUnknownLoc(),
-                                             creation_tile, lockID, 0);
-        lock.getOperation()->setAttr(
-            mlir::SymbolTable::getSymbolAttrName(),
-            builder.getStringAttr(op.name().str() + "_lock_" +
-                                  std::to_string(of_elem_index)));
-        locks.push_back(lock);
-        of_elem_index++;
+      // the locks of consumer c are the elements c * numElem to
+      // (c + 1) * numElem - 1
+      for (int c = 0; c < numConsumers; c++) {
+        int of_elem_index = 0; // used to give objectFifo elements a symbolic
+                               // name
+        for (int i = 0; i < numElem; i++) {
+          // create corresponding aie1 locks
+          int lockID = lockAnalysis.getLockID(creation_tile);
+          assert(lockID >= 0 && "No more locks to allocate!");
+          LockOp lock = builder.create<LockOp>(builder.getUnknownLoc(),
+                                               creation_tile, lockID, 0);
+          lock.getOperation()->setAttr(
+              mlir::SymbolTable::getSymbolAttrName(),
+              builder.getStringAttr(getConsumerName(c) + "_lock_" +
+                                    std::to_string(of_elem_index)));
+          locks.push_back(lock);
+          of_elem_index++;
+        }
       }
     } else {
-      // create corresponding aie2 locks
+      // create corresponding aie2 locks: each element is released by all the
+      // consumers before the producer acquires it again
       int prodLockID = lockAnalysis.getLockID(creation_tile);
       assert(prodLockID >= 0 && "No more locks to allocate!");
-      LockOp prodLock = builder.create<LockOp>(
-          builder.getUnknownLoc(), creation_tile, prodLockID, numElem);
+      LockOp prodLock =
+          builder.create<LockOp>(builder.getUnknownLoc(), creation_tile,
+                                 prodLockID, numElem * numConsumers);
       prodLock.getOperation()->setAttr(
           mlir::SymbolTable::getSymbolAttrName(),
-          builder.getStringAttr(op.name().str() + "_prod_lock"));
+          builder.getStringAttr(name + "_prod_lock"));
       locks.push_back(prodLock);
 
-      int consLockID = lockAnalysis.getLockID(creation_tile);
-      assert(consLockID >= 0 && "No more locks to allocate!");
-      LockOp consLock = builder.create<LockOp>(builder.getUnknownLoc(),
-                                               creation_tile, consLockID, 0);
-      consLock.getOperation()->setAttr(
-          mlir::SymbolTable::getSymbolAttrName(),
-          builder.getStringAttr(op.name().str() + "_cons_lock"));
-      locks.push_back(consLock);
+      for (int c = 0; c < numConsumers; c++) {
+        int consLockID = lockAnalysis.getLockID(creation_tile);
+        assert(consLockID >= 0 && "No more locks to allocate!");
+        LockOp consLock = builder.create<LockOp>(
+            builder.getUnknownLoc(), creation_tile, consLockID, 0);
+        consLock.getOperation()->setAttr(
+            mlir::SymbolTable::getSymbolAttrName(),
+            builder.getStringAttr(getConsumerName(c) + "_cons_lock"));
+        locks.push_back(consLock);
+      }
     }
     return locks;
   }
@@ -372,11 +493,25 @@ struct AIEObjectFifoStatefulTransformPass
       of_elem_index++;
     }
     if (linked) {
+      objFifoLinks[*linkOp] = op;
+      // the objFifos of a distribute or join in a memtile each use a slice
+      // of the elements, guarded by its own locks, so that the DMA channels
+      // of the slices do not need any copy and do not compete for locks
+      if (creation_tile.isMemTile() &&
+          (linkOp->isDistribute() || linkOp->isJoin())) {
+        int numSlices = linkOp->isDistribute() ? linkOp->getFifoOuts().size()
+                                               : linkOp->getFifoIns().size();
+        for (int i = 0; i < numSlices; i++)
+          linkSliceLocks[*linkOp].push_back(createObjectFifoLocks(
+              builder, lockAnalysis, op, numElem, creation_tile,
+              op.name().str() + "_" + std::to_string(i)));
+        buffersPerFifo[op] = buffers;
+        return;
+      }
       if (linkOp->isDistribute())
         numElem *= linkOp->getFifoOuts().size();
       else if (linkOp->isJoin())
         numElem *= linkOp->getFifoIns().size();
-      objFifoLinks[*linkOp] = op;
     }
     locks = createObjectFifoLocks(builder, lockAnalysis, op, numElem,
                                   creation_tile);
@@ -394,16 +529,43 @@ struct AIEObjectFifoStatefulTransformPass
     return endBlock;
   }
 
+  /// The data layout transformation and the encoding applied by the Bds of
+  /// a DMA channel of an objectFifo: the strides and wraps of the
+  /// transformation, the zeros padding it, and the zero compression.
+  struct BdTransform {
+    DimTupleArrayAttr dims;
+    PadTupleArrayAttr padding;
+    bool compression = false;
+    // The ID of the packet header the Bd sends its data with, if any.
+    int packetID = -1;
+  };
+
   /// Function used to create a Bd block.
+  /// transform gives the data layout transformation and the encoding
+  /// applied by the Bd. The Bd does not acquire acqLock, or release relLock,
+  /// if it is null.
   template <typename MyOp>
   void createBd(OpBuilder &builder, LockOp acqLock, int acqMode,
                 LockAction acqLockAction, LockOp relLock, int relMode,
-                MyOp buff, int offset, int len, Block *succ) {
-    builder.create<UseLockOp>(builder.getUnknownLoc(), acqLock, acqMode,
-                              acqLockAction);
-    builder.create<DMABDOp>(builder.getUnknownLoc(), buff, offset, len, 0);
-    builder.create<UseLockOp>(builder.getUnknownLoc(), relLock, relMode,
-                              LockAction::Release);
+                MyOp buff, int offset, int len, const BdTransform &transform,
+                Block *succ) {
+    if (acqLock)
+      builder.create<UseLockOp>(builder.getUnknownLoc(), acqLock, acqMode,
+                                acqLockAction);
+    if (transform.packetID >= 0)
+      builder.create<DMABDPACKETOp>(builder.getUnknownLoc(), 0,
+                                    transform.packetID);
+    DMABDOp bd =
+        builder.create<DMABDOp>(builder.getUnknownLoc(), buff, offset, len, 0);
+    if (transform.dims)
+      bd.setDimensionsAttr(transform.dims);
+    if (transform.padding)
+      bd.setPaddingAttr(transform.padding);
+    if (transform.compression)
+      bd.setCompression(true);
+    if (relLock)
+      builder.create<UseLockOp>(builder.getUnknownLoc(), relLock, relMode,
+                                LockAction::Release);
     builder.create<NextBDOp>(builder.getUnknownLoc(), succ);
   }
 
@@ -413,7 +575,8 @@ struct AIEObjectFifoStatefulTransformPass
   template <typename MyOp>
   void createBdBlock(OpBuilder &builder, ObjectFifoCreateOp op, int lockMode,
                      int acqNum, int relNum, MyOp buff, int offset, int len,
-                     DMAChannelDir channelDir, int blockIndex, Block *succ) {
+                     DMAChannelDir channelDir, int blockIndex,
+                     const BdTransform &transform, Block *succ) {
     LockOp acqLock;
     LockOp relLock;
     int acqMode = 1;
@@ -436,60 +599,45 @@ struct AIEObjectFifoStatefulTransformPass
                                                     : locksPerFifo[op][0];
     }
     createBd(builder, acqLock, acqMode, acqLockAction, relLock, relMode, buff,
-             offset, len, succ);
+             offset, len, transform, succ);
   }
 
   /// Function that either calls createAIETileDMA(), createShimDMA() or
   /// createMemTileDMA() based on op tile row value.
+  /// transform is applied to every Bd of the channel.
   void createDMA(DeviceOp &device, OpBuilder &builder, ObjectFifoCreateOp op,
-                 DMAChannelDir channelDir, int channelIndex, int lockMode) {
+                 DMAChannelDir channelDir, int channelIndex, int lockMode,
+                 const BdTransform &transform) {
     if (op.getProducerTileOp().isShimTile())
-      createShimDMA(device, builder, op, channelDir, channelIndex, lockMode);
+      createShimDMA(device, builder, op, channelDir, channelIndex, lockMode,
+                    transform);
     else if (op.getProducerTileOp().isMemTile())
-      createMemTileDMA(device, builder, op, channelDir, channelIndex, lockMode);
+      createMemTileDMA(device, builder, op, channelDir, channelIndex, lockMode,
+                       transform);
     else
-      createAIETileDMA(device, builder, op, channelDir, channelIndex, lockMode);
+      createAIETileDMA(device, builder, op, channelDir, channelIndex, lockMode,
+                       transform);
   }
 
-  /// Function used to create a MemOp region with a DMA channel.
-  /// It uses creatBdBlock(), see there for lockMode input.
-  void createAIETileDMA(DeviceOp &device, OpBuilder &builder,
-                        ObjectFifoCreateOp op, DMAChannelDir channelDir,
-                        int channelIndex, int lockMode) {
-    int numBlocks = op.size();
-    if (numBlocks == 0)
-      return;
-
-    int acqNum = 1;
-    int relNum = 1;
-    int offset = 0;
-
-    AIEObjectFifoType fifo = op.getElemType().cast<AIEObjectFifoType>();
-    MemRefType elemType = fifo.getElementType().cast<MemRefType>();
-    int len = getMemrefTypeSize(elemType);
-
-    // search for the buffers/locks (based on if this objFifo has a link)
-    ObjectFifoCreateOp target = op;
-    auto linkOp = getOptionalLinkOp(op);
-    if (linkOp)
-      if (objFifoLinks.find(*linkOp) != objFifoLinks.end())
-        target = objFifoLinks[*linkOp];
-
+  /// Function that adds a DMA channel to the MemOp of tile, creating the
+  /// MemOp if it does not exist, and returns the first Bd block of the
+  /// channel. endBlock is set to the end block of the MemOp.
+  Block *createAIETileDMAChannel(DeviceOp &device, OpBuilder &builder,
+                                 TileOp tile, DMAChannelDir channelDir,
+                                 int channelIndex, Block *&endBlock) {
     // search for MemOp
     MemOp *producerMem = nullptr;
     for (auto memOp : device.getOps<MemOp>()) {
-      if (memOp.getTile() == op.getProducerTile()) {
+      if (memOp.getTile() == tile.getResult()) {
         producerMem = &memOp;
         break;
       }
     }
 
     // if none exists, create one
-    TileOp objFifoTileOp = target.getProducerTileOp();
     if (producerMem == nullptr) {
       builder.setInsertionPointToEnd(device.getBody());
-      MemOp newMemOp =
-          builder.create<MemOp>(builder.getUnknownLoc(), objFifoTileOp);
+      MemOp newMemOp = builder.create<MemOp>(builder.getUnknownLoc(), tile);
       producerMem = &newMemOp;
       Region &r = producerMem->getBody();
       r.push_back(new Block);
@@ -499,7 +647,7 @@ struct AIEObjectFifoStatefulTransformPass
       builder.create<EndOp>(builder.getUnknownLoc());
     }
 
-    Block *endBlock = findEndOpBlock(&(producerMem->getBody()));
+    endBlock = findEndOpBlock(&(producerMem->getBody()));
     Block *lastDmaBlock = endBlock->getSinglePredecessor();
     Block *dmaBlock = builder.createBlock(endBlock);
     Block *bdBlock = builder.createBlock(endBlock);
@@ -510,6 +658,85 @@ struct AIEObjectFifoStatefulTransformPass
                                channelIndex, bdBlock, endBlock);
     if (lastDmaBlock != nullptr)
       lastDmaBlock->getTerminator()->setSuccessor(dmaBlock, 1);
+    return bdBlock;
+  }
+
+  /// Function used to create a MemOp region with a MM2S channel shared by
+  /// several objectFifos of the same depth, produced by the same AIE tile.
+  /// The Bds send element i of each objectFifo in turn before element i + 1,
+  /// each with the packet header of its objectFifo.
+  void createMultiplexedAIETileDMA(DeviceOp &device, OpBuilder &builder,
+                                   ArrayRef<ObjectFifoCreateOp> ops,
+                                   ArrayRef<BdTransform> transforms,
+                                   int channelIndex) {
+    ObjectFifoCreateOp first = ops.front();
+    int numBlocks = first.size();
+    if (numBlocks == 0)
+      return;
+
+    Block *endBlock;
+    Block *bdBlock =
+        createAIETileDMAChannel(device, builder, first.getProducerTileOp(),
+                                DMAChannelDir::MM2S, channelIndex, endBlock);
+
+    // create Bd blocks
+    Block *succ = nullptr;
+    Block *curr = bdBlock;
+    int numBds = numBlocks * ops.size();
+    for (int i = 0; i < numBds; i++) {
+      if (i == numBds - 1)
+        succ = bdBlock;
+      else
+        succ = builder.createBlock(endBlock);
+
+      ObjectFifoCreateOp op = ops[i % ops.size()];
+      int blockIndex = i / ops.size();
+      ObjectFifoCreateOp target = op;
+      auto linkOp = getOptionalLinkOp(op);
+      if (linkOp)
+        if (objFifoLinks.find(*linkOp) != objFifoLinks.end())
+          target = objFifoLinks[*linkOp];
+      AIEObjectFifoType fifo = op.getElemType().cast<AIEObjectFifoType>();
+      int len = getMemrefTypeSize(fifo.getElementType().cast<MemRefType>());
+
+      builder.setInsertionPointToStart(curr);
+      createBdBlock<BufferOp>(builder, target, 0, 1, 1,
+                              buffersPerFifo[target][blockIndex], 0, len,
+                              DMAChannelDir::MM2S, blockIndex,
+                              transforms[i % ops.size()], succ);
+      curr = succ;
+    }
+  }
+
+  /// Function used to create a MemOp region with a DMA channel.
+  /// It uses creatBdBlock(), see there for lockMode input.
+  void createAIETileDMA(DeviceOp &device, OpBuilder &builder,
+                        ObjectFifoCreateOp op, DMAChannelDir channelDir,
+                        int channelIndex, int lockMode,
+                        const BdTransform &transform) {
+    int numBlocks = op.size();
+    if (numBlocks == 0)
+      return;
+
+    int acqNum = 1;
+    int relNum = 1;
+    int offset = 0;
+
+    AIEObjectFifoType fifo = op.getElemType().cast<AIEObjectFifoType>();
+    MemRefType elemType = fifo.getElementType().cast<MemRefType>();
+    int len = getMemrefTypeSize(elemType);
+
+    // search for the buffers/locks (based on if this objFifo has a link)
+    ObjectFifoCreateOp target = op;
+    auto linkOp = getOptionalLinkOp(op);
+    if (linkOp)
+      if (objFifoLinks.find(*linkOp) != objFifoLinks.end())
+        target = objFifoLinks[*linkOp];
+
+    Block *endBlock;
+    Block *bdBlock = createAIETileDMAChannel(
+        device, builder, target.getProducerTileOp(), channelDir, channelIndex,
+        endBlock);
 
     // create Bd blocks
     Block *succ = nullptr;
@@ -524,7 +751,7 @@ struct AIEObjectFifoStatefulTransformPass
       builder.setInsertionPointToStart(curr);
       createBdBlock<BufferOp>(builder, target, lockMode, acqNum, relNum,
                               buffersPerFifo[target][blockIndex], offset, len,
-                              channelDir, blockIndex, succ);
+                              channelDir, blockIndex, transform, succ);
       curr = succ;
       blockIndex++;
     }
@@ -534,7 +761,8 @@ struct AIEObjectFifoStatefulTransformPass
   /// It uses creatBdBlock(), see there for lockMode input.
   void createShimDMA(DeviceOp &device, OpBuilder &builder,
                      ObjectFifoCreateOp op, DMAChannelDir channelDir,
-                     int channelIndex, int lockMode) {
+                     int channelIndex, int lockMode,
+                     const BdTransform &transform) {
     int numBlocks = externalBuffersPerFifo[op].size();
     if (numBlocks == 0)
       return;
@@ -595,7 +823,7 @@ struct AIEObjectFifoStatefulTransformPass
       createBdBlock<ExternalBufferOp>(builder, op, lockMode, acqNum, relNum,
                                       externalBuffersPerFifo[op][blockIndex],
                                       offset, len, channelDir, blockIndex,
-                                      succ);
+                                      transform, succ);
       curr = succ;
       blockIndex++;
     }
@@ -603,67 +831,50 @@ struct AIEObjectFifoStatefulTransformPass
 
   /// Function used to create a MemTileDMAOp region with a DMA channel.
   /// It uses creatBdBlock(), see there for lockMode input.
+  /// If op is part of a distribute or join link, the elements of the bigger
+  /// objFifo are shared by all objFifos of the link: the channel of each
+  /// smaller objFifo accesses its slice of the elements, and the channel of
+  /// the bigger objFifo uses one Bd per slice of each element.
   void createMemTileDMA(DeviceOp &device, OpBuilder &builder,
                         ObjectFifoCreateOp op, DMAChannelDir channelDir,
-                        int channelIndex, int lockMode) {
+                        int channelIndex, int lockMode,
+                        const BdTransform &transform) {
     int numBlocks = op.size();
     if (numBlocks == 0)
       return;
 
-    int offset = 0;
     AIEObjectFifoType fifo = op.getElemType().cast<AIEObjectFifoType>();
     MemRefType elemType = fifo.getElementType().cast<MemRefType>();
     int lenOut = getMemrefTypeSize(elemType);
     int bytes = elemType.getElementTypeBitWidth() / 8;
-    int acqNum = 1;
-    int relNum = 1;
 
     // search for the buffers/locks (based on if this objFifo has a link)
     // identify size difference between input and output memrefs
     ObjectFifoCreateOp target = op;
-    bool isDistribute = false;
-    bool isJoin = false;
-    int extraOffset = 0;
+    std::vector<int> sliceOffsets; // offset of each slice of a distribute or
+                                   // join, in number of elements
+    std::vector<int> sliceLens;
+    int sliceIndex = -1; // index of op among the slices
     auto linkOp = getOptionalLinkOp(op);
     if (linkOp) {
       if (objFifoLinks.find(*linkOp) != objFifoLinks.end()) {
         target = objFifoLinks[*linkOp];
 
-        if (linkOp->isJoin()) {
-          // find offset based on order of this op in join list
-          isJoin = true;
-          if (target == op) {
-            acqNum = linkOp->getFifoIns().size();
-            relNum = linkOp->getFifoIns().size();
-          } else {
-            for (auto fifoIn : linkOp->getInputObjectFifos()) {
-              AIEObjectFifoType fifoType =
-                  fifoIn.getElemType().cast<AIEObjectFifoType>();
-              MemRefType elemType =
-                  fifoType.getElementType().cast<MemRefType>();
-              if (fifoIn.name() == op.name())
-                break;
-              else
-                extraOffset += (int)getMemrefTypeSize(elemType);
-            }
-          }
-        } else if (linkOp->isDistribute()) {
-          // find offset based on order of this op in distribute list
-          isDistribute = true;
-          if (target == op) {
-            acqNum = linkOp->getFifoOuts().size();
-            relNum = linkOp->getFifoOuts().size();
-          } else {
-            for (auto fifoOut : linkOp->getOutputObjectFifos()) {
-              AIEObjectFifoType fifoType =
-                  fifoOut.getElemType().cast<AIEObjectFifoType>();
-              MemRefType elemType =
-                  fifoType.getElementType().cast<MemRefType>();
-              if (fifoOut.name() == op.name())
-                break;
-              else
-                extraOffset += (int)getMemrefTypeSize(elemType);
-            }
+        if (linkOp->isJoin() || linkOp->isDistribute()) {
+          // find offsets based on order of the ops in join / distribute list
+          std::vector<ObjectFifoCreateOp> slices =
+              linkOp->isJoin() ? linkOp->getInputObjectFifos()
+                               : linkOp->getOutputObjectFifos();
+          int extraOffset = 0;
+          for (auto slice : slices) {
+            AIEObjectFifoType fifoType =
+                slice.getElemType().cast<AIEObjectFifoType>();
+            MemRefType elemType = fifoType.getElementType().cast<MemRefType>();
+            if (slice.name() == op.name())
+              sliceIndex = sliceOffsets.size();
+            sliceOffsets.push_back(extraOffset);
+            sliceLens.push_back(getMemrefTypeSize(elemType));
+            extraOffset += getMemrefTypeSize(elemType);
           }
         } else {
           if (target != op) {
@@ -717,24 +928,45 @@ struct AIEObjectFifoStatefulTransformPass
     if (lastDmaBlock != nullptr)
       lastDmaBlock->getTerminator()->setSuccessor(dmaBlock, 1);
 
-    // create Bd blocks
+    // create Bd blocks, the bigger objFifo of a distribute or join
+    // transfers each element with one Bd per slice, and the producer of an
+    // objFifo with a repeatCount sends each slice with that many Bds, the
+    // first acquiring it and the last releasing it
+    bool sliced = !sliceOffsets.empty();
+    int bdsPerBlock = (sliced && target == op) ? sliceOffsets.size() : 1;
+    int repeat = 1;
+    if (channelDir == DMAChannelDir::MM2S && op.getRepeatCount())
+      repeat = *op.getRepeatCount();
+    int numBds = numBlocks * bdsPerBlock * repeat;
     Block *succ = nullptr;
     Block *curr = bdBlock;
-    int blockIndex = 0;
-    for (int i = 0; i < numBlocks; i++) {
-      if (i == numBlocks - 1)
+    for (int i = 0; i < numBds; i++) {
+      if (i == numBds - 1)
         succ = bdBlock;
       else
         succ = builder.createBlock(endBlock);
 
       builder.setInsertionPointToStart(curr);
-      if (isDistribute || isJoin)
-        offset = extraOffset * bytes;
-      createBdBlock<BufferOp>(builder, target, lockMode, acqNum, relNum,
-                              buffersPerFifo[target][blockIndex], offset,
-                              lenOut, channelDir, blockIndex, succ);
+      int sent = i % repeat;
+      int bdIndex = i / repeat;
+      int blockIndex = bdIndex / bdsPerBlock;
+      BufferOp buff = buffersPerFifo[target][blockIndex];
+      int slice = 0;
+      std::vector<LockOp> *locks = &locksPerFifo[target];
+      if (sliced) {
+        slice = (target == op) ? bdIndex % bdsPerBlock : sliceIndex;
+        locks = &linkSliceLocks[*linkOp][slice];
+      }
+      LockOp acqLock =
+          (channelDir == DMAChannelDir::S2MM) ? (*locks)[0] : (*locks)[1];
+      LockOp relLock =
+          (channelDir == DMAChannelDir::S2MM) ? (*locks)[1] : (*locks)[0];
+      createBd(builder, sent == 0 ? acqLock : LockOp(), 1,
+               LockAction::AcquireGreaterEqual,
+               sent == repeat - 1 ? relLock : LockOp(), 1, buff,
+               sliced ? sliceOffsets[slice] * bytes : 0,
+               sliced ? sliceLens[slice] : lenOut, transform, succ);
       curr = succ;
-      blockIndex++;
     }
   }
 
@@ -865,7 +1097,102 @@ struct AIEObjectFifoStatefulTransformPass
     }
   }
 
+  // Function that returns true if, instead of unrolling forLoop, the
+  // objectFifo elements it accesses can be selected with an index computed
+  // from its induction variable. This requires AIE2 locks, which do not depend
+  // on the element, constant loop bounds, and for every objectFifo port used
+  // in the loop that all its acquire and release operations in the core are
+  // directly in the loop body, and that each iteration releases all the
+  // elements it acquires.
+  bool canUseDynamicIndex(CoreOp coreOp, mlir::scf::ForOp forLoop) {
+    auto dev = coreOp->getParentOfType<DeviceOp>();
+    if (dev.getTargetModel().getTargetArch() == AIEArch::AIE1)
+      return false;
+    if (!forLoop.getLowerBound().getDefiningOp<arith::ConstantOp>() ||
+        !forLoop.getUpperBound().getDefiningOp<arith::ConstantOp>() ||
+        !forLoop.getStep().getDefiningOp<arith::ConstantOp>())
+      return false;
+
+    // number of elements held by each objFifo port during an iteration
+    DenseMap<std::pair<ObjectFifoCreateOp, int>, int> held;
+    for (Operation &op : forLoop.getBody()->without_terminator()) {
+      if (auto acqOp = dyn_cast<ObjectFifoAcquireOp>(op)) {
+        int portNum = acqOp.getPort() == ObjectFifoPort::Produce ? 0 : 1;
+        int &numHeld = held[{acqOp.getObjectFifo(), portNum}];
+        numHeld = std::max(numHeld, acqOp.acqNumber());
+      } else if (auto relOp = dyn_cast<ObjectFifoReleaseOp>(op)) {
+        int portNum = relOp.getPort() == ObjectFifoPort::Produce ? 0 : 1;
+        int &numHeld = held[{relOp.getObjectFifo(), portNum}];
+        numHeld -= relOp.relNumber();
+        if (numHeld < 0)
+          return false;
+      }
+    }
+    for (auto &port : held)
+      if (port.second != 0)
+        return false;
+
+    bool usedElsewhere = false;
+    coreOp.walk([&](Operation *op) {
+      std::pair<ObjectFifoCreateOp, int> port;
+      if (auto acqOp = dyn_cast<ObjectFifoAcquireOp>(op))
+        port = {acqOp.getObjectFifo(),
+                acqOp.getPort() == ObjectFifoPort::Produce ? 0 : 1};
+      else if (auto relOp = dyn_cast<ObjectFifoReleaseOp>(op))
+        port = {relOp.getObjectFifo(),
+                relOp.getPort() == ObjectFifoPort::Produce ? 0 : 1};
+      else
+        return;
+      if (held.count(port) && op->getParentOp() != forLoop)
+        usedElsewhere = true;
+    });
+    return !usedElsewhere;
+  }
+
+  // Function that creates the access to the element of op which is at
+  // position staticIndex in the first iteration of forLoop, a loop in
+  // dynamicIndexLoops which releases advance elements of the same objFifo
+  // port per iteration. The element accessed in iteration k is
+  // (staticIndex + k * advance) % size, which is selected among the buffers
+  // that the loop can reach.
+  Value createDynamicAccess(OpBuilder &builder, mlir::scf::ForOp forLoop,
+                            ObjectFifoCreateOp op, int staticIndex,
+                            int advance) {
+    int size = op.size();
+    std::vector<BufferOp> &buffers = buffersPerFifo[op];
+    advance %= size;
+    if (advance == 0)
+      return buffers[staticIndex].getBuffer();
+
+    auto loc = builder.getUnknownLoc();
+    auto constant = [&](int64_t value) -> Value {
+      return builder.create<arith::ConstantOp>(loc, builder.getIndexAttr(value),
+                                               builder.getIndexType());
+    };
+    Value iteration = builder.create<arith::SubIOp>(
+        loc, forLoop.getInductionVar(), forLoop.getLowerBound());
+    iteration =
+        builder.create<arith::DivUIOp>(loc, iteration, forLoop.getStep());
+    Value index = builder.create<arith::MulIOp>(loc, iteration,
+                                                constant(advance));
+    index = builder.create<arith::AddIOp>(loc, index, constant(staticIndex));
+    index = builder.create<arith::RemUIOp>(loc, index, constant(size));
+
+    int numReachable = size / std::gcd(size, advance);
+    Value result = buffers[staticIndex].getBuffer();
+    for (int k = 1; k < numReachable; k++) {
+      int elem = (staticIndex + k * advance) % size;
+      Value isElem = builder.create<arith::CmpIOp>(
+          loc, arith::CmpIPredicate::eq, index, constant(elem));
+      result = builder.create<arith::SelectOp>(
+          loc, isElem, buffers[elem].getBuffer(), result);
+    }
+    return result;
+  }
+
   // Function that unrolls for-loops that contain objectFifo operations.
+  // Loops whose unroll factor exceeds dynamicIndexThreshold are not unrolled
+  // if canUseDynamicIndex() allows it.
   void unrollForLoops(DeviceOp &device, OpBuilder &builder,
                       std::set<TileOp> objectFifoTiles) {
     for (auto coreOp : device.getOps<CoreOp>()) {
@@ -890,6 +1217,15 @@ struct AIEObjectFifoStatefulTransformPass
           unrollFactor =
               computeLCM(objFifoSizes); // also counts original loop body
 
+          if (found && dynamicIndexThreshold > 0 &&
+              unrollFactor > dynamicIndexThreshold &&
+              canUseDynamicIndex(coreOp, forLoop)) {
+            LLVM_DEBUG(llvm::dbgs() << "Using a dynamic index instead of "
+                                    << "unrolling by " << unrollFactor << "\n");
+            dynamicIndexLoops.insert(forLoop);
+            return;
+          }
+
           if (found) {
             std::vector<Operation *>
                 operations; // operations in original loop body, without
@@ -994,6 +1330,23 @@ struct AIEObjectFifoStatefulTransformPass
       if (objFifoLinks.find(*linkOp) != objFifoLinks.end())
         target = objFifoLinks[*linkOp];
 
+    // the producer of a shared broadcast uses the locks of all the
+    // consumers, each consumer only its own
+    int numConsumers = 1;
+    int consumer = 0;
+    if (sharedConsumers.count(target)) {
+      auto &consumers = sharedConsumers[target];
+      numConsumers = consumers.size();
+      auto core =
+          builder.getInsertionBlock()->getParent()->getParentOfType<CoreOp>();
+      if (port == ObjectFifoPort::Consume && core)
+        consumer = std::distance(consumers.begin(),
+                                 llvm::find(consumers, core.getTileOp()));
+    }
+    int firstConsumer = port == ObjectFifoPort::Produce ? 0 : consumer;
+    int lastConsumer =
+        port == ObjectFifoPort::Produce ? numConsumers - 1 : consumer;
+
     auto dev = op->getParentOfType<xilinx::AIE::DeviceOp>();
     auto &targetArch = dev.getTargetModel();
     if (targetArch.getTargetArch() == xilinx::AIE::AIEArch::AIE1) {
@@ -1005,9 +1358,11 @@ struct AIEObjectFifoStatefulTransformPass
         lockMode = 1;
       for (int i = 0; i < numLocks; i++) {
         int lockID = acc[{op, portNum}];
-        builder.create<UseLockOp>(builder.getUnknownLoc(),
-                                  locksPerFifo[target][lockID], lockMode,
-                                  lockAction);
+        for (int c = firstConsumer; c <= lastConsumer; c++)
+          builder.create<UseLockOp>(
+              builder.getUnknownLoc(),
+              locksPerFifo[target][c * op.size() + lockID], lockMode,
+              lockAction);
         acc[{op, portNum}] =
             (lockID + 1) % op.size(); // update to next objFifo elem
       }
@@ -1016,20 +1371,26 @@ struct AIEObjectFifoStatefulTransformPass
         return;
       // search for the correct lock based on the port of the acq/rel
       // operation e.g. acq as consumer is the read lock (second)
-      LockOp lock;
       if (lockAction == LockAction::AcquireGreaterEqual) {
         if (port == ObjectFifoPort::Produce)
-          lock = locksPerFifo[target][0];
+          builder.create<UseLockOp>(builder.getUnknownLoc(),
+                                    locksPerFifo[target][0],
+                                    numLocks * numConsumers, lockAction);
         else
-          lock = locksPerFifo[target][1];
+          builder.create<UseLockOp>(builder.getUnknownLoc(),
+                                    locksPerFifo[target][1 + consumer],
+                                    numLocks, lockAction);
       } else {
         if (port == ObjectFifoPort::Produce)
-          lock = locksPerFifo[target][1];
+          for (int c = 0; c < numConsumers; c++)
+            builder.create<UseLockOp>(builder.getUnknownLoc(),
+                                      locksPerFifo[target][1 + c], numLocks,
+                                      lockAction);
         else
-          lock = locksPerFifo[target][0];
+          builder.create<UseLockOp>(builder.getUnknownLoc(),
+                                    locksPerFifo[target][0], numLocks,
+                                    lockAction);
       }
-      builder.create<UseLockOp>(builder.getUnknownLoc(), lock, numLocks,
-                                lockAction);
       acc[{op, portNum}] = (acc[{op, portNum}] + numLocks) %
                            op.size(); // update to next objFifo elem
     }
@@ -1165,14 +1526,43 @@ struct AIEObjectFifoStatefulTransformPass
       int consumerIndex = 0;
       int consumerDepth = createOp.size();
 
+      // a broadcast to tiles which all access the memory of the producer
+      // uses one set of elements in that memory, without any DMA
+      MemRefType fifoElemType = createOp.getElemType()
+                                    .cast<AIEObjectFifoType>()
+                                    .getElementType()
+                                    .cast<MemRefType>();
+      if (isSharedBroadcast(createOp, lockAnalysis,
+                            createOp.size() * fifoElemType.getNumElements() *
+                                fifoElemType.getElementTypeBitWidth() / 8)) {
+        for (auto consumerTile : createOp.getConsumerTiles()) {
+          objectFifoTiles.insert(consumerTile.getDefiningOp<TileOp>());
+          sharedConsumers[createOp].push_back(
+              consumerTile.getDefiningOp<TileOp>());
+        }
+        LLVM_DEBUG(llvm::dbgs() << "Broadcasting " << createOp.name()
+                                << " in the memory of its producer\n");
+        shared = true;
+        share_direction = -1;
+      }
+
       for (auto consumerTile : createOp.getConsumerTiles()) {
+        if (shared)
+          break;
         TileOp consumerTileOp = dyn_cast<TileOp>(consumerTile.getDefiningOp());
         objectFifoTiles.insert(consumerTileOp);
 
         // if there is no broadcast, we can optimize in shared memory case
         if (createOp.getConsumerTiles().size() == 1) {
-          bool memoryAdjacent = isSharedMemory(
-              createOp.getProducerTileOp(), consumerTileOp, &share_direction);
+          MemRefType elemType = createOp.getElemType()
+                                    .cast<AIEObjectFifoType>()
+                                    .getElementType()
+                                    .cast<MemRefType>();
+          int64_t fifoBytes = createOp.size() * elemType.getNumElements() *
+                              elemType.getElementTypeBitWidth() / 8;
+          bool memoryAdjacent =
+              isSharedMemory(createOp.getProducerTileOp(), consumerTileOp,
+                             &share_direction, fifoBytes);
           if (memoryAdjacent) {
             shared = true;
             break;
@@ -1255,15 +1645,91 @@ struct AIEObjectFifoStatefulTransformPass
       }
     }
 
+    //===------------------------------------------------------------------===//
+    // Multiplex objectFifos on packet-switched DMA channels
+    //===------------------------------------------------------------------===//
+    // When an AIE tile sends more objectFifos than it has free MM2S
+    // channels, the objectFifos left once the other channels are taken
+    // share its last free channel, each with a packet ID of its own.
+    DenseMap<Value, int> fifosPerTile;
+    for (auto &[producer, consumers] : splitFifos)
+      if (!producer.getProducerTileOp().isShimTile() &&
+          !producer.getProducerTileOp().isMemTile())
+        fifosPerTile[producer.getProducerTile()]++;
+
+    int nextPacketID = 0;
+    for (auto flow : device.getOps<PacketFlowOp>())
+      nextPacketID = std::max(nextPacketID, flow.IDInt() + 1);
+    DenseMap<Value, SmallVector<ObjectFifoCreateOp>> multiplexedFifos;
+    DenseMap<ObjectFifoCreateOp, int> packetIDs;
+    DenseMap<Value, int> dedicatedChannels;
+    for (auto &[producer, consumers] : splitFifos) {
+      Value tile = producer.getProducerTile();
+      auto numFifos = fifosPerTile.find(tile);
+      if (numFifos == fifosPerTile.end())
+        continue;
+      int freeChannels = dmaAnalysis.getNumFreeMasterDMAChannels(tile);
+      if (numFifos->second <= freeChannels || freeChannels == 0 ||
+          dedicatedChannels[tile]++ < freeChannels - 1)
+        continue;
+      SmallVector<ObjectFifoCreateOp> &group = multiplexedFifos[tile];
+      if (!group.empty() && group.front().size() != producer.size()) {
+        producer.emitOpError("shares a DMA channel of its producer tile with ")
+            << group.front().name() << ", but they have different depths";
+        return signalPassFailure();
+      }
+      if (nextPacketID > 31) {
+        producer.emitOpError("shares a DMA channel of its producer tile, but "
+                             "no packet ID is left");
+        return signalPassFailure();
+      }
+      group.push_back(producer);
+      packetIDs[producer] = nextPacketID++;
+    }
+
     //===------------------------------------------------------------------===//
     // Create flows and tile DMAs
     //===------------------------------------------------------------------===//
+    DenseMap<Value, xilinx::AIE::DMAChannel> multiplexedChannels;
     for (auto &[producer, consumers] : splitFifos) {
       // create producer tile DMA
-      xilinx::AIE::DMAChannel producerChan =
-          dmaAnalysis.getMasterDMAChannel(producer.getProducerTile());
-      createDMA(device, builder, producer, producerChan.first,
-                producerChan.second, 0);
+      BdTransform producerTransform = {producer.getDimensionsToStreamAttr(),
+                                       producer.getPaddingToStreamAttr(),
+                                       producer.getCompression()};
+      xilinx::AIE::DMAChannel producerChan;
+      PacketFlowOp packetFlow;
+      auto packetID = packetIDs.find(producer);
+      if (packetID == packetIDs.end()) {
+        producerChan =
+            dmaAnalysis.getMasterDMAChannel(producer.getProducerTile());
+        createDMA(device, builder, producer, producerChan.first,
+                  producerChan.second, 0, producerTransform);
+      } else {
+        // the shared channel is created with the first of its objectFifos
+        auto &group = multiplexedFifos[producer.getProducerTile()];
+        if (producer == group.front()) {
+          producerChan =
+              dmaAnalysis.getMasterDMAChannel(producer.getProducerTile());
+          SmallVector<BdTransform> transforms;
+          for (auto fifo : group)
+            transforms.push_back({fifo.getDimensionsToStreamAttr(),
+                                  fifo.getPaddingToStreamAttr(),
+                                  fifo.getCompression(), packetIDs[fifo]});
+          createMultiplexedAIETileDMA(device, builder, group, transforms,
+                                      producerChan.second);
+          multiplexedChannels[producer.getProducerTile()] = producerChan;
+        }
+        producerChan = multiplexedChannels[producer.getProducerTile()];
+
+        builder.setInsertionPointAfter(producer);
+        packetFlow = builder.create<PacketFlowOp>(builder.getUnknownLoc(),
+                                                  packetID->second);
+        builder.createBlock(&packetFlow.getPorts());
+        builder.create<PacketSourceOp>(builder.getUnknownLoc(),
+                                       producer.getProducerTile(),
+                                       WireBundle::DMA, producerChan.second);
+        builder.create<EndOp>(builder.getUnknownLoc());
+      }
       // generate objectFifo allocation info
       builder.setInsertionPoint(&device.getBody()->back());
       if (producer.getProducerTileOp().isShimTile())
@@ -1277,7 +1743,9 @@ struct AIEObjectFifoStatefulTransformPass
         xilinx::AIE::DMAChannel consumerChan =
             dmaAnalysis.getSlaveDMAChannel(consumer.getProducerTile());
         createDMA(device, builder, consumer, consumerChan.first,
-                  consumerChan.second, 1);
+                  consumerChan.second, 1,
+                  {producer.getDimensionsFromStreamAttr(), nullptr,
+                   producer.getCompression()});
         // generate objectFifo allocation info
         builder.setInsertionPoint(&device.getBody()->back());
         if (consumer.getProducerTileOp().isShimTile())
@@ -1287,6 +1755,14 @@ struct AIEObjectFifoStatefulTransformPass
               consumerChan.second);
 
         // create flow
+        if (packetFlow) {
+          Block &ports = packetFlow.getPorts().front();
+          builder.setInsertionPoint(ports.getTerminator());
+          builder.create<PacketDestOp>(builder.getUnknownLoc(),
+                                       consumer.getProducerTile(),
+                                       WireBundle::DMA, consumerChan.second);
+          continue;
+        }
         builder.setInsertionPointAfter(producer);
         builder.create<FlowOp>(builder.getUnknownLoc(),
                                producer.getProducerTile(), WireBundle::DMA,
@@ -1307,6 +1783,9 @@ struct AIEObjectFifoStatefulTransformPass
       DenseMap<ObjectFifoAcquireOp, std::vector<BufferOp *>>
           subviews; // maps each "subview" to its buffer references (subviews
                     // are created by AcquireOps)
+      DenseMap<ObjectFifoAcquireOp, std::vector<int>>
+          subviewIndices; // maps each "subview" to the indices of its
+                          // buffers in the objFifo
       DenseMap<std::pair<ObjectFifoCreateOp, int>, std::vector<int>>
           acquiresPerFifo; // maps each objFifo to indices of buffers acquired
                            // in latest subview of that objFifo (useful to
@@ -1503,6 +1982,7 @@ struct AIEObjectFifoStatefulTransformPass
           subviewRefs.push_back(&buffersPerFifo[target][index]);
 
         subviews[acquireOp] = subviewRefs;
+        subviewIndices[acquireOp] = acquiredIndices;
         acquiresPerFifo[{op, portNum}] = acquiredIndices;
       });
 
@@ -1519,6 +1999,20 @@ struct AIEObjectFifoStatefulTransformPass
                                 "ObjectFifoLinkOp");
           return;
         }
+        auto forLoop = dyn_cast<mlir::scf::ForOp>(acqOp->getParentOp());
+        if (forLoop && dynamicIndexLoops.count(forLoop)) {
+          // elements released by the loop per iteration on this port
+          int advance = 0;
+          for (auto relOp : forLoop.getBody()->getOps<ObjectFifoReleaseOp>())
+            if (relOp.getObjectFifo() == op &&
+                relOp.getPort() == acqOp.getPort())
+              advance += relOp.relNumber();
+          builder.setInsertionPoint(accessOp);
+          int staticIndex = subviewIndices[acqOp][accessOp.getIndex()];
+          accessOp.getOutput().replaceAllUsesWith(createDynamicAccess(
+              builder, forLoop, op, staticIndex, advance));
+          return;
+        }
         accessOp.getOutput().replaceAllUsesWith(
             subviews[acqOp][accessOp.getIndex()]->getBuffer());
       });
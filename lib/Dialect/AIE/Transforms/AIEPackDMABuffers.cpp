@@ -0,0 +1,246 @@
+//===- AIEPackDMABuffers.cpp ------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the packing of the buffers which consecutive BDs of a
+// DMA channel transfer one after the other: they are laid out contiguously
+// in the memory of their tile, in the order of the transfers, and their BDs
+// are merged into one BD transferring all of them.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/MathExtras.h"
+
+#include <optional>
+
+#define DEBUG_TYPE "aie-pack-dma-buffers"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// The alignment of aie-assign-buffer-addresses: vector loads and stores move
+// up to 256 bits at once.
+static const int64_t MAX_BUFFER_ALIGNMENT = 32;
+
+static int64_t getAlignment(BufferOp buffer) {
+  return std::min<int64_t>(llvm::PowerOf2Ceil(buffer.getAllocationSize()),
+                           MAX_BUFFER_ALIGNMENT);
+}
+
+/// Function that returns the BD of block, if block only holds lock operations
+/// around one BD transferring a whole buffer with an address, contiguously.
+static DMABDOp getWholeBufferBD(Block *block) {
+  DMABDOp bd;
+  for (Operation &op : *block) {
+    if (isa<UseLockOp, NextBDOp>(op))
+      continue;
+    auto bdOp = dyn_cast<DMABDOp>(op);
+    if (!bdOp || bd)
+      return nullptr;
+    bd = bdOp;
+  }
+  if (!bd || bd.getDimensions() || bd.getPadding() || bd.getCompression() ||
+      bd.getOffsetValue() != 0)
+    return nullptr;
+  MemRefType type = bd.getBuffer().getType();
+  auto buffer = bd.getBufferOp();
+  if (!buffer || !type.hasStaticShape() ||
+      bd.getLenValue() != type.getNumElements() ||
+      !buffer->getAttrOfType<IntegerAttr>("address"))
+    return nullptr;
+  return bd;
+}
+
+/// Function that returns true if bd is the only BD transferring its buffer.
+static bool isOnlyBD(DMABDOp bd) {
+  return llvm::count_if(bd.getBufferOp()->getUsers(), [](Operation *user) {
+           return isa<DMABDOp>(user);
+         }) == 1;
+}
+
+/// Function that returns true if the block of bd has lock operations after
+/// it.
+static bool releasesAfter(DMABDOp bd) {
+  for (Operation *op = bd->getNextNode(); op; op = op->getNextNode())
+    if (isa<UseLockOp>(op))
+      return true;
+  return false;
+}
+
+/// Function that returns true if the block of bd has lock operations before
+/// it.
+static bool acquiresBefore(DMABDOp bd) {
+  for (Operation *op = bd->getPrevNode(); op; op = op->getPrevNode())
+    if (isa<UseLockOp>(op))
+      return true;
+  return false;
+}
+
+struct AIEPackDMABuffersPass
+    : public AIEPackDMABuffersBase<AIEPackDMABuffersPass> {
+  // the buffers already packed, which keep their place
+  DenseSet<Operation *> packed;
+
+  /// Function that returns the address at which the buffers of run, of size
+  /// bytes, can be laid out in the memory of their tile, or std::nullopt if
+  /// there is no room for them.
+  std::optional<int64_t> findRoom(DeviceOp device, ArrayRef<BufferOp> run,
+                                  int64_t bytes, int64_t alignment) {
+    TileOp tile = run.front().getTileOp();
+    const auto &targetModel = device.getTargetModel();
+    int64_t size = tile.isMemTile() ? targetModel.getMemTileSize()
+                                    : targetModel.getLocalMemorySize();
+    SmallVector<std::pair<int64_t, int64_t>, 8> used;
+    if (auto core = tile.getCoreOp())
+      used.push_back({0, core.getStackSize()});
+    for (auto buffer : device.getOps<BufferOp>())
+      if (buffer.getTileOp() == tile && !llvm::is_contained(run, buffer) &&
+          buffer->getAttrOfType<IntegerAttr>("address"))
+        used.push_back({buffer.address(),
+                        buffer.address() + buffer.getAllocationSize()});
+
+    // The lowest start, which is 0 or the end of another range.
+    std::optional<int64_t> best;
+    auto tryStart = [&](int64_t start) {
+      start = llvm::alignTo(start, alignment);
+      if (start + bytes > size || (best && *best <= start))
+        return;
+      if (llvm::all_of(used, [&](auto range) {
+            return start + bytes <= range.first || range.second <= start;
+          }))
+        best = start;
+    };
+    tryStart(0);
+    for (auto range : used)
+      tryStart(range.second);
+    return best;
+  }
+
+  /// Function that lays out the buffers of the BDs of run contiguously, and
+  /// replaces the BDs by one transferring all of them.  Returns false if the
+  /// buffers cannot be laid out contiguously.
+  bool packRun(DeviceOp device, ArrayRef<Block *> run) {
+    SmallVector<DMABDOp, 4> bds;
+    SmallVector<BufferOp, 4> buffers;
+    for (Block *block : run) {
+      bds.push_back(getWholeBufferBD(block));
+      buffers.push_back(bds.back().getBufferOp());
+    }
+
+    // The buffers must keep the alignment of aie-assign-buffer-addresses.
+    int64_t bytes = 0, alignment = 1;
+    bool contiguous = true;
+    for (auto buffer : buffers) {
+      if (bytes % getAlignment(buffer) != 0)
+        return false;
+      contiguous &= buffers.front().address() + bytes == buffer.address();
+      bytes += buffer.getAllocationSize();
+      alignment = std::max(alignment, getAlignment(buffer));
+    }
+    if (!contiguous) {
+      auto start = findRoom(device, buffers, bytes, alignment);
+      if (!start) {
+        LLVM_DEBUG(llvm::dbgs() << "No room to pack " << buffers.front().name()
+                                << " with the next buffers of its BDs\n");
+        return false;
+      }
+      Builder builder(device.getContext());
+      int64_t address = *start;
+      for (auto buffer : buffers) {
+        buffer->setAttr("address", builder.getI32IntegerAttr(address));
+        address += buffer.getAllocationSize();
+      }
+    }
+
+    int64_t len = 0;
+    for (auto bd : bds)
+      len += bd.getLenValue();
+    LLVM_DEBUG(llvm::dbgs() << "Packing " << run.size() << " BDs from "
+                            << buffers.front().name() << "\n");
+    bds.front().setLen(len);
+    packed.insert(buffers.begin(), buffers.end());
+
+    // The releases of the last block follow the merged BD, which goes on
+    // with the BD after the last one.
+    Operation *next = run.front()->getTerminator();
+    for (Operation &op : llvm::make_early_inc_range(*run.back()))
+      if (isa<UseLockOp>(op))
+        op.moveBefore(next);
+    next->setSuccessor(run.back()->getSuccessor(0), 0);
+    for (Block *block : run.drop_front())
+      block->erase();
+    return true;
+  }
+
+  /// Function that returns true if the BD of block, which follows the last
+  /// BD of run, prev, can be merged with them.
+  bool canFollow(Block *prev, Block *block, ArrayRef<Block *> run) {
+    DMABDOp prevBD = getWholeBufferBD(prev);
+    DMABDOp bd = getWholeBufferBD(block);
+    if (!bd || block->getSinglePredecessor() != prev ||
+        llvm::is_contained(run, block) || releasesAfter(prevBD) ||
+        acquiresBefore(bd) || !isOnlyBD(bd) ||
+        packed.contains(bd.getBufferOp()))
+      return false;
+    BufferOp buffer = bd.getBufferOp();
+    if (buffer.getTileOp() != prevBD.getBufferOp().getTileOp() ||
+        bd.getAB() != prevBD.getAB() ||
+        bd.getBuffer().getType().getElementType() !=
+            prevBD.getBuffer().getType().getElementType())
+      return false;
+    return true;
+  }
+
+  /// Function that packs the runs of BDs of the chains of the channels of a
+  /// DMA, from the first BD of each chain.
+  void packChannels(DeviceOp device, Region &body) {
+    SmallVector<DMAStartOp, 4> starts;
+    for (Block &block : body)
+      for (auto start : block.getOps<DMAStartOp>())
+        starts.push_back(start);
+    for (auto start : starts) {
+      SmallVector<Block *, 8> chain;
+      DenseSet<Block *> visited;
+      for (Block *bd = start.getDest(); bd && visited.insert(bd).second;
+           bd = bd->getNumSuccessors() > 0 ? bd->getSuccessor(0) : nullptr)
+        chain.push_back(bd);
+      // The blocks merged into a run are erased.
+      DenseSet<Block *> merged;
+      for (Block *block : chain) {
+        DMABDOp bd = getWholeBufferBD(block);
+        if (merged.contains(block) || !bd || !isOnlyBD(bd) ||
+            packed.contains(bd.getBufferOp()))
+          continue;
+        SmallVector<Block *, 4> run = {block};
+        while (isa<NextBDOp>(run.back()->getTerminator()) &&
+               canFollow(run.back(), run.back()->getSuccessor(0), run))
+          run.push_back(run.back()->getSuccessor(0));
+        if (run.size() > 1 && packRun(device, run))
+          merged.insert(run.begin() + 1, run.end());
+      }
+    }
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    packed.clear();
+    for (auto mem : device.getOps<MemOp>())
+      packChannels(device, mem.getBody());
+    for (auto memTileDMA : device.getOps<MemTileDMAOp>())
+      packChannels(device, memTileDMA.getBody());
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEPackDMABuffersPass() {
+  return std::make_unique<AIEPackDMABuffersPass>();
+}
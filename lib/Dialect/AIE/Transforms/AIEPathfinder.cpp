@@ -8,6 +8,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "mlir/IR/Threading.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_os_ostream.h"
 #include <iostream>
@@ -40,60 +41,19 @@ WireBundle getConnectingBundle(WireBundle dir) {
 
 Pathfinder::Pathfinder() {}
 
-Pathfinder::Pathfinder(int _maxcol, int _maxrow, DeviceOp &d) {
+Pathfinder::Pathfinder(int _maxcol, int _maxrow, DeviceOp &d,
+                       PathfinderOptions _options)
+    : options(_options) {
   initializeGraph(_maxcol, _maxrow, d);
 }
 
 void Pathfinder::initializeGraph(int maxcol, int maxrow, DeviceOp &d) {
-  const auto &targetModel = d.getTargetModel();
   // make grid of switchboxes
-  for (int row = 0; row <= maxrow; row++) {
-    for (int col = 0; col <= maxcol; col++) {
-      int id = add_vertex(graph);
-      graph[id].row = row;
-      graph[id].col = col;
-      graph[id].pred = 0;
-      graph[id].processed = false;
-      if (row > 0) { // if not in row 0 add channel to North/South
-        if (auto max_capacity = targetModel.getNumSourceSwitchboxConnections(
-                col, row, WireBundle::South)) {
-          auto north_edge = add_edge(id - maxcol - 1, id, graph).first;
-          graph[north_edge].bundle = WireBundle::North;
-          graph[north_edge].max_capacity = max_capacity;
-        }
-        if (auto max_capacity = targetModel.getNumDestSwitchboxConnections(
-                col, row, WireBundle::South)) {
-          auto south_edge = add_edge(id, id - maxcol - 1, graph).first;
-          graph[south_edge].bundle = WireBundle::South;
-          graph[south_edge].max_capacity = max_capacity;
-        }
-      }
-      if (col > 0) { // if not in col 0 add channel to East/West
-        if (auto max_capacity = targetModel.getNumSourceSwitchboxConnections(
-                col, row, WireBundle::West)) {
-          auto east_edge = add_edge(id - 1, id, graph).first;
-          graph[east_edge].bundle = WireBundle::East;
-          graph[east_edge].max_capacity = max_capacity;
-        }
-        if (auto max_capacity = targetModel.getNumDestSwitchboxConnections(
-                col, row, WireBundle::West)) {
-          auto west_edge = add_edge(id, id - 1, graph).first;
-          graph[west_edge].bundle = WireBundle::West;
-          graph[west_edge].max_capacity = max_capacity;
-        }
-      }
-    }
-  }
-
-  // initialize weights of all Channels to 1
-  // initialize other variables
-  auto edge_pair = edges(graph);
-  for (auto edge = edge_pair.first; edge != edge_pair.second; edge++) {
-    graph[*edge].demand = 1;
-    graph[*edge].used_capacity = 0;
-    graph[*edge].fixed_capacity.clear();
-    graph[*edge].over_capacity_count = 0;
-  }
+  graph.initialize(maxcol, maxrow, d.getTargetModel());
+  pred.assign(graph.numVertices(), 0);
+  processed.assign(graph.numVertices(), false);
+  region = {0, 0, maxcol, maxrow};
+  context = d.getContext();
 
   // initialize maximum iterations flag
   Pathfinder::maxIterReached = false;
@@ -102,45 +62,41 @@ void Pathfinder::initializeGraph(int maxcol, int maxrow, DeviceOp &d) {
 // Pathfinder::addFlow
 // add a flow from src to dst
 // can have an arbitrary number of dst locations due to fanout
+// if hopBudget is non-negative, the flow is routed with as few hops as
+// possible, and a fanout flow takes the tightest budget of its destinations
+// flows with a higher bandwidth are routed before flows with a lower one
+// a fanout flow is routed as a Steiner tree if any of its destinations asks
 void Pathfinder::addFlow(Coord srcCoords, Port srcPort, Coord dstCoords,
-                         Port dstPort) {
+                         Port dstPort, int hopBudget, int bandwidth,
+                         bool steiner) {
+  PathEndPoint dst =
+      std::make_pair(getSwitchbox(dstCoords), dstPort);
+
   // check if a flow with this source already exists
   for (unsigned int i = 0; i < flows.size(); i++) {
     Switchbox *otherSrc = flows[i].first.first;
     Port otherPort = flows[i].first.second;
     if (otherSrc->col == srcCoords.first && otherSrc->row == srcCoords.second &&
         otherPort == srcPort) {
-      // find the vertex corresponding to the destination
-      PathEndPoint dst;
-      auto vpair = vertices(graph);
-      for (vertex_iterator v = vpair.first; v != vpair.second; v++) {
-        Switchbox *sb = &graph[*v];
-        if (sb->col == dstCoords.first && sb->row == dstCoords.second) {
-          dst = std::make_pair(sb, dstPort);
-          break;
-        }
-      }
       // add the destination to this existing flow, and finish
       flows[i].second.push_back(dst);
+      if (hopBudget >= 0 && (hopBudgets[i] < 0 || hopBudget < hopBudgets[i]))
+        hopBudgets[i] = hopBudget;
+      bandwidths[i] = std::max(bandwidths[i], bandwidth);
+      if (steiner)
+        steinerFlows[i] = true;
       return;
     }
   }
 
   // if no existing flow was found with this source, create a new flow
   Flow flow;
-  auto vpair = vertices(graph);
-  for (vertex_iterator v = vpair.first; v != vpair.second; v++) {
-    Switchbox *sb = &graph[*v];
-    // check if this vertex matches the source
-    if (sb->col == srcCoords.first && sb->row == srcCoords.second)
-      flow.first = std::make_pair(sb, srcPort);
-
-    // check if this vertex matches the destination
-    if (sb->col == dstCoords.first && sb->row == dstCoords.second)
-      flow.second.push_back(std::make_pair(sb, dstPort));
-  }
-
+  flow.first = std::make_pair(getSwitchbox(srcCoords), srcPort);
+  flow.second.push_back(dst);
   flows.push_back(flow);
+  hopBudgets.push_back(hopBudget);
+  bandwidths.push_back(bandwidth);
+  steinerFlows.push_back(steiner);
   return;
 }
 
@@ -149,15 +105,238 @@ void Pathfinder::addFlow(Coord srcCoords, Port srcPort, Coord dstCoords,
 // Pathfinder algorithm will avoid using these
 void Pathfinder::addFixedConnection(Coord coords, Port port) {
   // find the correct Channel and indicate the fixed direction
-  auto edge_pair = edges(graph);
-  for (edge_iterator e = edge_pair.first; e != edge_pair.second; e++) {
-    if (graph[source(*e, graph)].col == coords.first &&
-        graph[source(*e, graph)].row == coords.second &&
-        graph[*e].bundle == port.first) {
-      graph[*e].fixed_capacity.insert(port.second);
-      break;
+  edge_descriptor e;
+  if (graph.findOutEdge(getVertex(coords.first, coords.second), port.first, e))
+    graph.addFixedChannel(e, port.second);
+}
+
+BoundingBox Pathfinder::getBoundingBox(vertex_descriptor src,
+                                       vertex_descriptor dst) {
+  const Switchbox &s = graph.getSwitchbox(src), &d = graph.getSwitchbox(dst);
+  return {std::min<int>(s.col, d.col), std::min<int>(s.row, d.row),
+          std::max<int>(s.col, d.col), std::max<int>(s.row, d.row)};
+}
+
+// Pathfinder::findShortestPaths
+// Dijkstra's shortest paths from the nearest of the given sources, using the
+// current channel demand as edge weights and staying inside region.  The cost
+// and the predecessor of every vertex on its shortest path are recorded in
+// cost and pred; sources and unreachable vertices are their own predecessor.
+void Pathfinder::findShortestPaths(ArrayRef<vertex_descriptor> sources,
+                                   bool critical, std::vector<float> &cost) {
+  unsigned int numV = graph.numVertices();
+  cost.assign(numV, std::numeric_limits<float>::infinity());
+  std::vector<bool> closed(numV, false);
+  for (vertex_descriptor v = 0; v < numV; v++)
+    pred[v] = v;
+  typedef std::pair<float, vertex_descriptor> QueueEntry;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                      std::greater<QueueEntry>>
+      open;
+  for (vertex_descriptor src : sources) {
+    cost[src] = 0;
+    open.push(std::make_pair(0.0f, src));
+  }
+  while (!open.empty()) {
+    vertex_descriptor curr = open.top().second;
+    open.pop();
+    if (closed[curr])
+      continue;
+    closed[curr] = true;
+    for (edge_descriptor e = graph.outEdgesBegin(curr);
+         e != graph.outEdgesEnd(curr); e++) {
+      vertex_descriptor next = graph.edgeTarget[e];
+      const Switchbox &sb = graph.getSwitchbox(next);
+      if (closed[next] || !region.contains(sb.col, sb.row))
+        continue;
+      float nextCost = cost[curr] + getCost(e, critical);
+      if (nextCost < cost[next]) {
+        cost[next] = nextCost;
+        pred[next] = curr;
+        open.push(std::make_pair(nextCost, next));
+      }
+    }
+  }
+}
+
+// Pathfinder::findAStarPath
+// Goal-directed search from src to dst using the current channel demand as
+// edge weights.  Every channel costs at least 1, so the Manhattan distance to
+// dst never overestimates the remaining cost and the path found is as short
+// as the one Dijkstra would find.  On success the predecessors of the vertices
+// on the path are recorded in pred.
+bool Pathfinder::findAStarPath(vertex_descriptor src, vertex_descriptor dst,
+                               int boundingBoxMargin, bool critical) {
+  int dstCol = graph.getSwitchbox(dst).col;
+  int dstRow = graph.getSwitchbox(dst).row;
+  BoundingBox box = region;
+  if (boundingBoxMargin >= 0)
+    box = getBoundingBox(src, dst).grow(boundingBoxMargin, region);
+  float minCost = 1 + (critical ? CRITICAL_HOP_COST : 0);
+  auto heuristic = [&](vertex_descriptor v) -> float {
+    const Switchbox &sb = graph.getSwitchbox(v);
+    return minCost * (std::abs(sb.col - dstCol) + std::abs(sb.row - dstRow));
+  };
+
+  std::vector<float> cost(graph.numVertices(),
+                          std::numeric_limits<float>::infinity());
+  std::vector<bool> closed(graph.numVertices(), false);
+  typedef std::pair<float, vertex_descriptor> QueueEntry;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                      std::greater<QueueEntry>>
+      open;
+  cost[src] = 0;
+  pred[src] = src;
+  open.push(std::make_pair(heuristic(src), src));
+  while (!open.empty()) {
+    vertex_descriptor curr = open.top().second;
+    open.pop();
+    if (closed[curr])
+      continue;
+    if (curr == dst)
+      return true;
+    closed[curr] = true;
+    for (edge_descriptor e = graph.outEdgesBegin(curr);
+         e != graph.outEdgesEnd(curr); e++) {
+      vertex_descriptor next = graph.edgeTarget[e];
+      const Switchbox &sb = graph.getSwitchbox(next);
+      if (closed[next] || !box.contains(sb.col, sb.row))
+        continue;
+      float nextCost = cost[curr] + getCost(e, critical);
+      if (nextCost < cost[next]) {
+        cost[next] = nextCost;
+        pred[next] = curr;
+        open.push(std::make_pair(nextCost + heuristic(next), next));
+      }
     }
   }
+  return false;
+}
+
+// Pathfinder::routeFlow
+// Find a route for a single flow given the current demand on every Channel,
+// and allocate a channel index on each Channel along the route.  The
+// allocations are recorded in usedChannels so that the route can be ripped up
+// later without disturbing the other flows.  A critical flow is routed with
+// as few hops as possible, using the demand only to choose between routes of
+// the same length.
+//
+// By default the route of a fanout flow is the tree of shortest paths from
+// the source to each destination.  When building Steiner trees, the tree is
+// instead grown one destination at a time, each time connecting the
+// destination which is cheapest to reach from any switchbox already in the
+// tree, so that destinations share as much of the route as possible.  This
+// is done for every flow with steinerTrees, or for a single flow with steiner.
+SwitchSettings Pathfinder::routeFlow(const Flow &flow, bool critical,
+                                     bool steiner,
+                                     std::vector<ChannelUse> &usedChannels) {
+  steiner |= options.steinerTrees;
+  processed.assign(graph.numVertices(), false);
+  vertex_descriptor src =
+      getVertex(flow.first.first->col, flow.first.first->row);
+
+  // use dijkstra to find path given current demand
+  // from the start switchbox, find shortest path to each other switchbox
+  // output is in the predecessor map, which must then be processed to get
+  // individual switchbox settings
+  // In A* mode, a path is searched separately towards each destination just
+  // before it is traced below.
+  std::vector<float> cost;
+  if (!options.useAStar && !steiner)
+    findShortestPaths(src, critical, cost);
+
+  // trace the path of the flow backwards via predecessors
+  // increment used_capacity for the associated channels
+  SwitchSettings switchSettings = SwitchSettings();
+  // set the input bundle for the source endpoint
+  switchSettings[&graph.getSwitchbox(src)].first = flow.first.second;
+  processed[src] = true;
+  std::vector<bool> connected(flow.second.size(), false);
+  for (unsigned int n = 0; n < flow.second.size(); n++) {
+    unsigned int i = n;
+    if (steiner) {
+      std::vector<vertex_descriptor> tree;
+      for (vertex_descriptor v = 0; v < graph.numVertices(); v++)
+        if (processed[v])
+          tree.push_back(v);
+      findShortestPaths(tree, critical, cost);
+      bool found = false;
+      float best = 0;
+      for (unsigned int j = 0; j < flow.second.size(); j++) {
+        vertex_descriptor dst =
+            getVertex(flow.second[j].first->col, flow.second[j].first->row);
+        if (!connected[j] && (!found || cost[dst] < best)) {
+          i = j;
+          best = cost[dst];
+          found = true;
+        }
+      }
+    }
+    connected[i] = true;
+    vertex_descriptor curr =
+        getVertex(flow.second[i].first->col, flow.second[i].first->row);
+    Switchbox *sb = &graph.getSwitchbox(curr);
+
+    if (options.useAStar && !steiner && !processed[curr] &&
+        !findAStarPath(src, curr, options.boundingBoxMargin, critical)) {
+      LLVM_DEBUG(llvm::dbgs() << "A* search in bounding box failed for ("
+                              << sb->col << ", " << sb->row
+                              << "), retrying on the whole graph\n");
+      findAStarPath(src, curr, -1, critical);
+    }
+
+    // set the output bundle for this destination endpoint
+    switchSettings[sb].second.insert(flow.second[i].second);
+
+    // trace backwards until a vertex already processed is reached
+    while (processed[curr] == false) {
+      // find the edge from the pred to curr by searching incident edges
+      bool found = false;
+      edge_descriptor e;
+      for (unsigned int i = graph.inEdgesBegin(curr);
+           i != graph.inEdgesEnd(curr); i++) {
+        if (graph.edgeSource[graph.inEdge(i)] == pred[curr]) {
+          // found the channel used in the path
+          e = graph.inEdge(i);
+          found = true;
+          break;
+        }
+      }
+      assert(found);
+      (void)found;
+
+      // use the lowest channel index which is neither fixed nor already
+      // allocated to another flow
+      short index = graph.allocateChannel(e);
+      usedChannels.push_back(std::make_pair(e, index));
+
+      // add the entrance port for this Switchbox
+      switchSettings[sb].first =
+          std::make_pair(getConnectingBundle(graph.bundle[e]), index);
+      // add the current Switchbox to the map of the predecessor
+      switchSettings[&graph.getSwitchbox(pred[curr])].second.insert(
+          std::make_pair(graph.bundle[e], index));
+
+      // if at capacity, bump demand to discourage using this Channel
+      if (graph.usedCapacity[e] >= graph.maxCapacity[e]) {
+        // this means the order matters!
+        graph.demand[e] *= 1.1;
+      }
+
+      processed[curr] = true;
+      curr = pred[curr];
+      sb = &graph.getSwitchbox(curr);
+    }
+  }
+  return switchSettings;
+}
+
+// Pathfinder::ripUpFlow
+// Release the channel indices allocated to a flow by routeFlow.
+void Pathfinder::ripUpFlow(std::vector<ChannelUse> &usedChannels) {
+  for (auto &use : usedChannels)
+    graph.releaseChannel(use.first, use.second);
+  usedChannels.clear();
 }
 
 // Pathfinder::findPaths
@@ -167,18 +346,45 @@ void Pathfinder::addFixedConnection(Coord coords, Port port) {
 // if the routing finds too much congestion, update the demand weights
 // and repeat the process until a vaild solution is found
 //
+// By default every flow is ripped up and rerouted on each iteration.  In
+// incremental mode, only flows crossing a Channel which is over capacity are
+// ripped up and rerouted, in the style of negotiated congestion routing, and
+// all other routes are kept in place.
+//
+// Flows with a hop budget are routed first in every iteration, tightest
+// budget first, so that they get the shortest routes before the Channels
+// fill up.
+//
 // returns a map specifying switchbox settings for all flows
 // if no legal routing can be found after MAX_ITERATIONS, returns empty vector
-std::map<PathEndPoint, SwitchSettings>
-Pathfinder::findPaths(const int MAX_ITERATIONS) {
+RoutingSolution Pathfinder::findPaths(const int MAX_ITERATIONS) {
   LLVM_DEBUG(llvm::dbgs() << "Begin Pathfinder::findPaths\n");
   int iteration_count = 0;
-  std::map<PathEndPoint, SwitchSettings> routing_solution;
+  RoutingSolution routing_solution;
+  iterations = 0;
+  if (options.threads > 1 && context &&
+      findPathsInParallel(MAX_ITERATIONS, routing_solution))
+    return routing_solution;
+  // channel indices allocated to each flow, in the same order as flows
+  std::vector<std::vector<ChannelUse>> flowChannels(flows.size());
+  std::vector<unsigned int> order(flows.size());
+  for (unsigned int i = 0; i < flows.size(); i++)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](unsigned int a, unsigned int b) {
+                     // unsigned, so that flows without a budget come last
+                     if (hopBudgets[a] != hopBudgets[b])
+                       return (unsigned int)hopBudgets[a] <
+                              (unsigned int)hopBudgets[b];
+                     return bandwidths[a] > bandwidths[b];
+                   });
 
   // initialize all Channel histories to 0
-  auto edge_pair = edges(graph);
-  for (auto edge = edge_pair.first; edge != edge_pair.second; edge++) {
-    graph[*edge].over_capacity_count = 0;
+  for (edge_descriptor e = 0; e < graph.numEdges(); e++) {
+    graph.overCapacityCount[e] = 0;
+    graph.usedCapacity[e] = 0;
+    graph.allocatedCapacity[e] = 0;
+    graph.overflowCount[e] = 0;
   }
 
 // Pathfinder iteration loop
@@ -188,20 +394,15 @@ Pathfinder::findPaths(const int MAX_ITERATIONS) {
     LLVM_DEBUG(llvm::dbgs()
                << "Begin findPaths iteration #" << iteration_count << "\n");
     // update demand on all channels
-    edge_pair = edges(graph);
-    for (edge_iterator it = edge_pair.first; it != edge_pair.second; it++) {
-      Channel *ch = &graph[*it];
-      // LLVM_DEBUG(llvm::dbgs() << "Pre update:\tEdge " << *it << "\t: used = "
-      // << ch->used_capacity <<
-      //   "\t demand = " << ch->demand << "\t over_capacity_count= " <<
-      //   ch->over_capacity_count<< "\t");
-      if (ch->fixed_capacity.size() >= ch->max_capacity) {
-        ch->demand = std::numeric_limits<float>::max();
+    // the channel attributes are contiguous arrays, so this is a linear sweep
+    for (edge_descriptor e = 0; e < graph.numEdges(); e++) {
+      if (graph.numFixedChannels(e) >= graph.maxCapacity[e]) {
+        graph.demand[e] = std::numeric_limits<float>::max();
       } else {
-        float history = 1 + over_capacity_coeff * ch->over_capacity_count;
-        float congestion = 1 + used_capacity_coeff * ch->used_capacity;
+        float history = 1 + over_capacity_coeff * graph.overCapacityCount[e];
+        float congestion = 1 + used_capacity_coeff * graph.usedCapacity[e];
         // std::max(0, ch->used_capacity - ch->max_capacity);
-        ch->demand = history * congestion;
+        graph.demand[e] = history * congestion;
       }
     }
     // if reach MAX_ITERATIONS, throw an error since no routing can be found
@@ -217,117 +418,183 @@ Pathfinder::findPaths(const int MAX_ITERATIONS) {
       return routing_solution;
     }
 
-    // "rip up" all routes, i.e. set used capacity in each Channel to 0
-    routing_solution = {};
-    auto edge_pair = edges(graph);
-    for (edge_iterator e = edge_pair.first; e != edge_pair.second; e++) {
-      graph[*e].used_capacity = 0;
+    // "rip up" routes: all of them, or in incremental mode after the first
+    // iteration, only those using a Channel which is over capacity
+    std::vector<bool> reroute(flows.size(), true);
+    if (options.incremental && iteration_count > 1) {
+      for (unsigned int i = 0; i < flows.size(); i++)
+        reroute[i] = std::any_of(
+            flowChannels[i].begin(), flowChannels[i].end(),
+            [&](const ChannelUse &use) {
+              return graph.usedCapacity[use.first] >
+                     graph.maxCapacity[use.first];
+            });
     }
+    for (unsigned int i = 0; i < flows.size(); i++)
+      if (reroute[i])
+        ripUpFlow(flowChannels[i]);
 
     // for each flow, find the shortest path from source to destination
     // update used_capacity for the path between them
-    for (auto flow : flows) {
-      auto vpair = vertices(graph);
-
-      vertex_descriptor src;
-      for (vertex_iterator v = vpair.first; v != vpair.second; v++) {
-        Switchbox *sb = &graph[*v];
-        sb->processed = false;
-        if (sb->col == flow.first.first->col &&
-            sb->row == flow.first.first->row)
-          src = *v;
+    unsigned int rerouted = 0;
+    for (unsigned int i : order) {
+      if (!reroute[i])
+        continue;
+      // add this flow to the proposed solution
+      routing_solution[flows[i].first] =
+          routeFlow(flows[i], hopBudgets[i] >= 0, steinerFlows[i],
+                    flowChannels[i]);
+      rerouted++;
+    }
+    LLVM_DEBUG(llvm::dbgs() << "Rerouted " << rerouted << " of "
+                            << flows.size() << " flows\n");
+    iterations = iteration_count;
+  } while (!isLegal()); // continue iterations until a legal routing is found
+  return routing_solution;
+}
+
+// Pathfinder::findPathsInParallel
+// Partition the flows into clusters whose bounding boxes do not overlap, and
+// route each cluster concurrently with its own copy of the graph where all
+// searches are confined to the cluster's box.  The clusters use disjoint sets
+// of Channels, so their results are merged back in cluster order, which
+// keeps the solution independent of the thread schedule.
+//
+// returns false, leaving the graph untouched, if there is only a single
+// cluster or if some cluster cannot be routed legally inside its box
+bool Pathfinder::findPathsInParallel(const int MAX_ITERATIONS,
+                                     RoutingSolution &solution) {
+  int margin = options.boundingBoxMargin >= 0 ? options.boundingBoxMargin : 1;
+
+  // greedily merge each flow into the clusters its box overlaps, until no two
+  // cluster boxes overlap
+  std::vector<BoundingBox> boxes;
+  std::vector<std::vector<unsigned int>> members;
+  for (unsigned int i = 0; i < flows.size(); i++) {
+    vertex_descriptor src =
+        getVertex(flows[i].first.first->col, flows[i].first.first->row);
+    BoundingBox box = getBoundingBox(src, src);
+    for (auto &dst : flows[i].second)
+      box.extend(
+          getBoundingBox(src, getVertex(dst.first->col, dst.first->row)));
+    box = box.grow(margin, region);
+    std::vector<unsigned int> cluster = {i};
+    bool merged;
+    do {
+      merged = false;
+      for (unsigned int c = 0; c < boxes.size(); c++) {
+        if (!boxes[c].overlaps(box))
+          continue;
+        box.extend(boxes[c]);
+        cluster.insert(cluster.end(), members[c].begin(), members[c].end());
+        boxes.erase(boxes.begin() + c);
+        members.erase(members.begin() + c);
+        merged = true;
+        break;
       }
+    } while (merged);
+    std::sort(cluster.begin(), cluster.end());
+    boxes.push_back(box);
+    members.push_back(cluster);
+  }
+  LLVM_DEBUG(llvm::dbgs() << "Pathfinder: " << flows.size()
+                          << " flows partitioned into " << boxes.size()
+                          << " independent clusters\n");
+  if (boxes.size() < 2)
+    return false;
+
+  // route every cluster on a private copy of the graph
+  std::vector<Pathfinder> clusters(boxes.size(), *this);
+  std::vector<RoutingSolution> solutions(boxes.size());
+  std::vector<bool> legal(boxes.size(), false);
+  for (unsigned int c = 0; c < boxes.size(); c++) {
+    Pathfinder &cluster = clusters[c];
+    cluster.region = boxes[c];
+    cluster.options.useAStar = true;
+    cluster.options.threads = 1;
+    cluster.flows.clear();
+    cluster.hopBudgets.clear();
+    cluster.bandwidths.clear();
+    cluster.steinerFlows.clear();
+    for (unsigned int i : members[c]) {
+      Flow flow = flows[i];
+      flow.first.first = cluster.getSwitchbox(
+          std::make_pair(flow.first.first->col, flow.first.first->row));
+      for (auto &dst : flow.second)
+        dst.first = cluster.getSwitchbox(
+            std::make_pair(dst.first->col, dst.first->row));
+      cluster.flows.push_back(flow);
+      cluster.hopBudgets.push_back(hopBudgets[i]);
+      cluster.bandwidths.push_back(bandwidths[i]);
+      cluster.steinerFlows.push_back(steinerFlows[i]);
+    }
+  }
+  unsigned int numTasks = std::min<unsigned int>(options.threads, boxes.size());
+  mlir::parallelFor(context, 0, numTasks, [&](size_t task) {
+    for (size_t c = task; c < clusters.size(); c += numTasks) {
+      solutions[c] = clusters[c].findPaths(MAX_ITERATIONS);
+      legal[c] = clusters[c].isLegal();
+    }
+  });
+  for (unsigned int c = 0; c < boxes.size(); c++) {
+    if (!legal[c]) {
+      LLVM_DEBUG(llvm::dbgs() << "Pathfinder: cluster " << c
+                              << " could not be routed in its bounding box, "
+                                 "routing all flows sequentially\n");
+      return false;
+    }
+  }
 
-      // use dijkstra to find path given current demand
-      // from the start switchbox, find shortest path to each other switchbox
-      // output is in the predecessor map, which must then be processed to get
-      // individual switchbox settings
-      dijkstra_shortest_paths(
-          graph, src,
-          weight_map(get(&Channel::demand, graph))
-              .predecessor_map(get(&Switchbox::pred, graph)));
-
-      // trace the path of the flow backwards via predecessors
-      // increment used_capacity for the associated channels
-      SwitchSettings switchSettings = SwitchSettings();
-      // set the input bundle for the source endpoint
-      switchSettings[&graph[src]].first = flow.first.second;
-      graph[src].processed = true;
-      for (unsigned int i = 0; i < flow.second.size(); i++) {
-        vertex_descriptor curr;
-        for (vertex_iterator v = vpair.first; v != vpair.second; v++)
-          if (graph[*v].col == flow.second[i].first->col &&
-              graph[*v].row == flow.second[i].first->row)
-            curr = *v;
-        Switchbox *sb = &graph[curr];
-
-        // set the output bundle for this destination endpoint
-        switchSettings[sb].second.insert(flow.second[i].second);
-
-        // trace backwards until a vertex already processed is reached
-        while (sb->processed == false) {
-          // find the edge from the pred to curr by searching incident edges
-          auto inedges = in_edges(curr, graph);
-          Channel *ch = nullptr;
-          for (in_edge_iterator it = inedges.first; it != inedges.second;
-               it++) {
-            if (source(*it, graph) == (unsigned)sb->pred) {
-              // found the channel used in the path
-              ch = &graph[*it];
-              break;
-            }
-          }
-          assert(ch != nullptr);
-
-          // don't use fixed channels
-          while (ch->fixed_capacity.count(ch->used_capacity))
-            ch->used_capacity++;
-
-          // add the entrance port for this Switchbox
-          switchSettings[sb].first = std::make_pair(
-              getConnectingBundle(ch->bundle), ch->used_capacity);
-          // add the current Switchbox to the map of the predecessor
-          switchSettings[&graph[sb->pred]].second.insert(
-              std::make_pair(ch->bundle, ch->used_capacity));
-
-          ch->used_capacity++;
-          // if at capacity, bump demand to discourage using this Channel
-          if (ch->used_capacity >= ch->max_capacity) {
-            // this means the order matters!
-            ch->demand *= 1.1;
-          }
-
-          sb->processed = true;
-          curr = sb->pred;
-          sb = &graph[curr];
+  // merge the cluster results back into this graph
+  for (unsigned int c = 0; c < boxes.size(); c++) {
+    Pathfinder &cluster = clusters[c];
+    iterations = std::max(iterations, cluster.iterations);
+    auto toThisGraph = [&](Switchbox *sb) {
+      return getSwitchbox(std::make_pair(sb->col, sb->row));
+    };
+    for (auto &flowSolution : solutions[c]) {
+      PathEndPoint src = flowSolution.first;
+      src.first = toThisGraph(src.first);
+      SwitchSettings &settings = solution[src];
+      for (auto &setting : flowSolution.second)
+        settings[toThisGraph(setting.first)] = setting.second;
+    }
+    // the copied graph has the same edge ids as ours
+    RoutingGraph &other = cluster.graph;
+    for (int row = boxes[c].minRow; row <= boxes[c].maxRow; row++) {
+      for (int col = boxes[c].minCol; col <= boxes[c].maxCol; col++) {
+        vertex_descriptor v = getVertex(col, row);
+        for (edge_descriptor e = graph.outEdgesBegin(v);
+             e != graph.outEdgesEnd(v); e++) {
+          graph.demand[e] = other.demand[e];
+          graph.usedCapacity[e] = other.usedCapacity[e];
+          graph.overCapacityCount[e] = other.overCapacityCount[e];
+          graph.allocatedCapacity[e] = other.allocatedCapacity[e];
+          graph.overflowCount[e] = other.overflowCount[e];
         }
       }
-      // add this flow to the proposed solution
-      routing_solution[flow.first] = switchSettings;
     }
-  } while (!isLegal()); // continue iterations until a legal routing is found
-  return routing_solution;
+  }
+  return true;
 }
 
 // check that every channel does not exceed max capacity
 bool Pathfinder::isLegal() {
-  auto edge_pair = edges(graph);
   bool legal = true; // assume legal until found otherwise
   // check if maximum number of iterations has been reached
   if (maxIterReached)
     legal = false;
-  for (edge_iterator e = edge_pair.first; e != edge_pair.second; e++) {
-    if (graph[*e].used_capacity > graph[*e].max_capacity) {
+  for (edge_descriptor e = 0; e < graph.numEdges(); e++) {
+    if (graph.usedCapacity[e] > graph.maxCapacity[e]) {
+      const Switchbox &sb = graph.getSwitchbox(graph.edgeSource[e]);
       LLVM_DEBUG(llvm::dbgs()
-                 << "Too much capacity on Edge ("
-                 << graph[source(*e, graph)].col << ", "
-                 << graph[source(*e, graph)].row << ") -> "
-                 << stringifyWireBundle(graph[*e].bundle)
-                 << "\t: used_capacity = " << graph[*e].used_capacity
-                 << "\t: Demand = " << graph[*e].demand << "\n");
-      graph[*e].over_capacity_count++;
+                 << "Too much capacity on Edge (" << sb.col << ", " << sb.row
+                 << ") -> " << stringifyWireBundle(graph.bundle[e])
+                 << "\t: used_capacity = " << graph.usedCapacity[e]
+                 << "\t: Demand = " << graph.demand[e] << "\n");
+      graph.overCapacityCount[e]++;
       LLVM_DEBUG(llvm::dbgs() << "over_capacity_count = "
-                              << graph[*e].over_capacity_count << "\n");
+                              << graph.overCapacityCount[e] << "\n");
       legal = false;
     }
   }
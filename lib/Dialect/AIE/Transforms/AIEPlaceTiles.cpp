@@ -0,0 +1,288 @@
+//===- AIEPlaceTiles.cpp ----------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#include <limits>
+
+#define DEBUG_TYPE "aie-place-tiles"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// Tiles carrying this attribute are placed by the pass.  Their coordinates
+// are ignored.
+static const char *UNPLACED_ATTR_NAME = "unplaced";
+
+// the cost of sending an objectFifo through DMAs and the stream network
+// instead of through shared memory, on top of the stream wirelength
+static const int DMA_COST = 4;
+// the cost of a core accessing the memory of a tile it cannot reach, or
+// cascading to a core which is not its cascade neighbour
+static const int ILLEGAL_AFFINITY_COST = 10000;
+
+namespace {
+
+// A connection between two tiles which the placement should keep short.
+struct Net {
+  enum Kind {
+    // an aie.flow or aie.streamFifo, costing its wirelength
+    Stream,
+    // an objectFifo, free between neighbours which can share memory
+    ObjectFifo,
+    // a core using a buffer or lock of another tile, which must be able to
+    // access its memory
+    SharedMemory,
+    // an aie.cascadeFlow, whose dest must be the cascade neighbour of its
+    // source
+    Cascade
+  };
+  Kind kind;
+  Operation *a, *b;
+};
+
+class TilePlacer {
+  const AIETargetModel &targetModel;
+  std::vector<Net> nets;
+  // the nets of each tile, as indices into nets
+  DenseMap<Operation *, SmallVector<unsigned, 4>> tileNets;
+  DenseMap<Operation *, TileID> position;
+  // the tile at each position, for the tiles which are placed so far
+  std::map<TileID, Operation *> occupant;
+
+  static int getDistance(TileID a, TileID b) {
+    return std::abs(a.first - b.first) + std::abs(a.second - b.second);
+  }
+
+  bool canShareMemory(TileID a, TileID b) const {
+    return targetModel.isLegalMemAffinity(a.first, a.second, b.first,
+                                          b.second) ||
+           targetModel.isLegalMemAffinity(b.first, b.second, a.first,
+                                          a.second);
+  }
+
+  int getCost(const Net &net, TileID a, TileID b) const {
+    switch (net.kind) {
+    case Net::Stream:
+      return getDistance(a, b);
+    case Net::ObjectFifo:
+      return canShareMemory(a, b) ? 0 : DMA_COST + getDistance(a, b);
+    case Net::SharedMemory:
+      return targetModel.isLegalMemAffinity(a.first, a.second, b.first,
+                                            b.second)
+                 ? 0
+                 : ILLEGAL_AFFINITY_COST;
+    case Net::Cascade:
+      return targetModel.isLegalCascade(a, b) ? 0 : ILLEGAL_AFFINITY_COST;
+    }
+    llvm_unreachable("unknown net kind");
+  }
+
+  // The cost of the nets of tile if it were at pos, counting only the nets
+  // whose other end is placed.  The other tile other, if given, is assumed
+  // to be at otherPos.
+  int getTileCost(Operation *tile, TileID pos, Operation *other = nullptr,
+                  TileID otherPos = {0, 0}) const {
+    int cost = 0;
+    auto netsOfTile = tileNets.find(tile);
+    if (netsOfTile == tileNets.end())
+      return 0;
+    for (unsigned n : netsOfTile->second) {
+      const Net &net = nets[n];
+      Operation *peer = net.a == tile ? net.b : net.a;
+      TileID peerPos;
+      if (peer == tile)
+        continue;
+      if (peer == other)
+        peerPos = otherPos;
+      else if (position.count(peer))
+        peerPos = position.lookup(peer);
+      else
+        continue;
+      cost += net.a == tile ? getCost(net, pos, peerPos)
+                            : getCost(net, peerPos, pos);
+    }
+    return cost;
+  }
+
+  void place(Operation *tile, TileID pos) {
+    position[tile] = pos;
+    occupant[pos] = tile;
+  }
+
+public:
+  TilePlacer(const AIETargetModel &targetModel) : targetModel(targetModel) {}
+
+  void addNet(Net::Kind kind, Operation *a, Operation *b) {
+    if (a == b)
+      return;
+    tileNets[a].push_back(nets.size());
+    tileNets[b].push_back(nets.size());
+    nets.push_back({kind, a, b});
+  }
+
+  void addFixedTile(TileOp tile) { place(tile, tile.getTileID()); }
+
+  // Place each tile on a free core tile, first greedily in the given order,
+  // then improving the placement by moving single tiles or swapping pairs of
+  // tiles while this lowers the total cost.  Returns false if there are not
+  // enough free core tiles.
+  bool placeTiles(ArrayRef<Operation *> tiles, int maxIterations) {
+    std::vector<TileID> sites;
+    for (int col = 0; col < targetModel.columns(); col++)
+      for (int row = 0; row < targetModel.rows(); row++)
+        if (targetModel.isCoreTile(col, row) &&
+            !occupant.count(std::make_pair(col, row)))
+          sites.push_back(std::make_pair(col, row));
+    if (sites.size() < tiles.size())
+      return false;
+
+    for (Operation *tile : tiles) {
+      int bestCost = std::numeric_limits<int>::max();
+      TileID best = {0, 0};
+      for (TileID site : sites) {
+        if (occupant.count(site))
+          continue;
+        int cost = getTileCost(tile, site);
+        if (cost < bestCost) {
+          bestCost = cost;
+          best = site;
+        }
+      }
+      place(tile, best);
+    }
+
+    DenseSet<Operation *> movable(tiles.begin(), tiles.end());
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+      bool improved = false;
+      for (Operation *tile : tiles) {
+        TileID from = position[tile];
+        for (TileID site : sites) {
+          if (site == from)
+            continue;
+          auto found = occupant.find(site);
+          Operation *other = found == occupant.end() ? nullptr : found->second;
+          if (other && !movable.count(other))
+            continue;
+          int before = getTileCost(tile, from);
+          int after = getTileCost(tile, site, other, from);
+          if (other) {
+            // a net between the two tiles is counted twice on both sides
+            before += getTileCost(other, site, tile, from);
+            after += getTileCost(other, from, tile, site);
+          }
+          if (after >= before)
+            continue;
+          occupant.erase(from);
+          occupant.erase(site);
+          place(tile, site);
+          if (other)
+            place(other, from);
+          from = site;
+          improved = true;
+        }
+      }
+      LLVM_DEBUG(llvm::dbgs() << "Placement iteration " << iteration
+                              << (improved ? " improved" : " converged")
+                              << "\n");
+      if (!improved)
+        break;
+    }
+    return true;
+  }
+
+  TileID getPosition(Operation *tile) const { return position.lookup(tile); }
+  int getTileCost(Operation *tile) const {
+    return getTileCost(tile, getPosition(tile));
+  }
+};
+
+} // namespace
+
+struct AIEPlaceTilesPass : public AIEPlaceTilesBase<AIEPlaceTilesPass> {
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    TilePlacer placer(device.getTargetModel());
+
+    SmallVector<Operation *, 16> unplaced;
+    for (auto tile : device.getOps<TileOp>()) {
+      // Unplaced shim tiles are assigned by aie-assign-shim-tiles.
+      if (!tile->hasAttr(UNPLACED_ATTR_NAME))
+        placer.addFixedTile(tile);
+      else if (!tile.isShimTile())
+        unplaced.push_back(tile);
+    }
+    if (unplaced.empty())
+      return;
+
+    for (auto flow : device.getOps<FlowOp>())
+      placer.addNet(Net::Stream, flow.getSource().getDefiningOp(),
+                    flow.getDest().getDefiningOp());
+    for (auto streamFifo : device.getOps<StreamFifoCreateOp>())
+      for (Value consumer : streamFifo.getConsumerTiles())
+        placer.addNet(Net::Stream, streamFifo.getProducerTile().getDefiningOp(),
+                      consumer.getDefiningOp());
+    for (auto objFifo : device.getOps<ObjectFifoCreateOp>())
+      for (Value consumer : objFifo.getConsumerTiles())
+        placer.addNet(Net::ObjectFifo,
+                      objFifo.getProducerTile().getDefiningOp(),
+                      consumer.getDefiningOp());
+    for (auto cascade : device.getOps<CascadeFlowOp>())
+      placer.addNet(Net::Cascade, cascade.getSource().getDefiningOp(),
+                    cascade.getDest().getDefiningOp());
+    for (auto core : device.getOps<CoreOp>()) {
+      Operation *coreTile = core.getTile().getDefiningOp();
+      DenseSet<Operation *> memTiles;
+      core.walk([&](Operation *op) {
+        for (Value operand : op->getOperands()) {
+          if (auto buffer = operand.getDefiningOp<BufferOp>())
+            memTiles.insert(buffer.getTileOp());
+          else if (auto lock = operand.getDefiningOp<LockOp>())
+            memTiles.insert(lock.getTileOp());
+        }
+      });
+      // add the nets in a fixed order, so that the placement is deterministic
+      for (auto tile : device.getOps<TileOp>())
+        if (memTiles.count(tile))
+          placer.addNet(Net::SharedMemory, coreTile, tile);
+    }
+
+    if (!placer.placeTiles(unplaced, maxIterations)) {
+      device.emitError("not enough free core tiles to place ")
+          << unplaced.size() << " tiles";
+      return signalPassFailure();
+    }
+
+    Builder builder(device.getContext());
+    for (Operation *op : unplaced) {
+      TileOp tile = cast<TileOp>(op);
+      TileID pos = placer.getPosition(op);
+      LLVM_DEBUG(llvm::dbgs() << "Placed " << tile << " at (" << pos.first
+                              << ", " << pos.second << ")\n");
+      tile.setColAttr(builder.getI32IntegerAttr(pos.first));
+      tile.setRowAttr(builder.getI32IntegerAttr(pos.second));
+      tile->removeAttr(UNPLACED_ATTR_NAME);
+    }
+    for (Operation *op : unplaced)
+      if (placer.getTileCost(op) >= ILLEGAL_AFFINITY_COST)
+        op->emitWarning("tile placed where a core cannot access the memory "
+                        "it uses or cascade to its neighbour");
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIEPlaceTilesPass() {
+  return std::make_unique<AIEPlaceTilesPass>();
+}
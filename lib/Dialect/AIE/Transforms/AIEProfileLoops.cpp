@@ -0,0 +1,79 @@
+//===- AIEProfileLoops.cpp --------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the marking of the vectorized loops of the kernels
+// and cores with the AIE.event ops starting and stopping the performance
+// counters of the cores, so that the cycles of a loop can be measured.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Interfaces/LoopLikeInterface.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-profile-loops"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+/// Function that returns true if the body of loop, outside of its nested
+/// loops, computes vectors.
+static bool isVectorizedLoop(LoopLikeOpInterface loop) {
+  bool vectorized = false;
+  loop->walk<WalkOrder::PreOrder>([&](Operation *op) {
+    if (op != loop && isa<LoopLikeOpInterface>(op))
+      return WalkResult::skip();
+    if (llvm::any_of(op->getResultTypes(),
+                     [](Type type) { return isa<VectorType>(type); })) {
+      vectorized = true;
+      return WalkResult::interrupt();
+    }
+    return WalkResult::advance();
+  });
+  return vectorized;
+}
+
+struct AIEProfileLoopsPass : public AIEProfileLoopsBase<AIEProfileLoopsPass> {
+  /// Function that brackets the loop-th vectorized loop of kernel with
+  /// AIE.event(0) and AIE.event(1).
+  void profileLoop(Operation *kernel) {
+    SmallVector<LoopLikeOpInterface, 4> loops;
+    kernel->walk<WalkOrder::PreOrder>([&](LoopLikeOpInterface loopOp) {
+      if (isVectorizedLoop(loopOp))
+        loops.push_back(loopOp);
+    });
+    if (loop >= loops.size())
+      return;
+
+    Operation *op = loops[loop];
+    OpBuilder builder(op);
+    builder.create<EventOp>(op->getLoc(), 0);
+    builder.setInsertionPointAfter(op);
+    builder.create<EventOp>(op->getLoc(), 1);
+    op->emitRemark("profiling vectorized loop ")
+        << loop << " of " << loops.size() << " between AIE.event(0) and "
+        << "AIE.event(1)";
+  }
+
+  void runOnOperation() override {
+    ModuleOp module = getOperation();
+    module.walk([&](Operation *op) {
+      auto func = dyn_cast<func::FuncOp>(op);
+      if ((func && !func.isDeclaration()) || isa<CoreOp>(op))
+        profileLoop(op);
+    });
+  }
+};
+
+std::unique_ptr<OperationPass<ModuleOp>>
+xilinx::AIE::createAIEProfileLoopsPass() {
+  return std::make_unique<AIEProfileLoopsPass>();
+}
@@ -0,0 +1,141 @@
+//===- AIERouteControlPackets.cpp -------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the routing of a shim DMA to the control ports of the
+// tiles marked for reconfiguration, as packet flows, so that the control
+// packets generated by aie-translate --aie-generate-ctrlpkt can be played
+// from DDR into the array.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#include <map>
+
+#define DEBUG_TYPE "aie-route-control-packets"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// The packet IDs of the packet headers have 5 bits.
+static const int maxPacketID = 31;
+
+/// Function that returns the ELF file the core of tile loads, as the
+/// configuration targets name it, or an empty string if it has no core.
+static std::string getElfFile(TileOp tile) {
+  CoreOp core = tile.getCoreOp();
+  if (!core)
+    return "";
+  if (auto fileAttr = core->getAttrOfType<StringAttr>("elf_file"))
+    return fileAttr.getValue().str();
+  return "core_" + std::to_string(tile.colIndex()) + "_" +
+         std::to_string(tile.rowIndex()) + ".elf";
+}
+
+struct AIERouteControlPacketsPass
+    : public AIERouteControlPacketsBase<AIERouteControlPacketsPass> {
+  /// Function that returns the tile of device at col, row, creating it at
+  /// the start of the device if it does not exist.
+  TileOp getOrCreateTile(DeviceOp device, int col, int row) {
+    for (auto tile : device.getOps<TileOp>())
+      if (tile.colIndex() == col && tile.rowIndex() == row)
+        return tile;
+    OpBuilder builder = OpBuilder::atBlockBegin(device.getBody());
+    return builder.create<TileOp>(builder.getUnknownLoc(), col, row);
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    const auto &targetModel = device.getTargetModel();
+
+    SmallVector<TileOp, 8> controlled;
+    for (auto tile : device.getOps<TileOp>())
+      if (tile->hasAttr("ctrl"))
+        controlled.push_back(tile);
+    if (controlled.empty())
+      return;
+
+    int col = shimCol;
+    for (int c = 0; col < 0 && c < targetModel.columns(); c++)
+      if (targetModel.isShimNOCTile(c, 0))
+        col = c;
+    if (col < 0 || col >= targetModel.columns() ||
+        !targetModel.isShimNOCTile(col, 0)) {
+      device.emitError("no shim NOC tile in column ")
+          << col << " to route the control packets from";
+      return signalPassFailure();
+    }
+
+    int nextID = packetID;
+    if (nextID < 0) {
+      nextID = 0;
+      for (auto flow : device.getOps<PacketFlowOp>())
+        nextID = std::max(nextID, flow.IDInt() + 1);
+    }
+
+    // The tiles loading the same ELF file share a broadcast flow, their
+    // program memories are written once for all of them.
+    std::map<std::string, SmallVector<TileOp, 4>> elfTiles;
+    if (broadcastElfs)
+      for (auto tile : controlled)
+        if (std::string elf = getElfFile(tile); !elf.empty())
+          elfTiles[elf].push_back(tile);
+
+    TileOp shim = getOrCreateTile(device, col, 0);
+    OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+    for (auto tile : controlled) {
+      if (nextID > maxPacketID) {
+        tile.emitError("no packet ID left to route its control packets");
+        return signalPassFailure();
+      }
+      auto flow = builder.create<PacketFlowOp>(tile.getLoc(), nextID);
+      builder.createBlock(&flow.getPorts());
+      builder.create<PacketSourceOp>(tile.getLoc(), shim, WireBundle::DMA,
+                                     channel);
+      builder.create<PacketDestOp>(tile.getLoc(), tile, WireBundle::Ctrl, 0);
+      builder.create<EndOp>(tile.getLoc());
+      builder.setInsertionPointAfter(flow);
+      LLVM_DEBUG(llvm::dbgs() << "Routing the control packets of " << tile
+                              << " with ID " << nextID << "\n");
+      tile->removeAttr("ctrl");
+      tile->setAttr("ctrl_packet_id", builder.getI32IntegerAttr(nextID++));
+    }
+
+    for (auto &[elf, tiles] : elfTiles) {
+      if (tiles.size() < 2)
+        continue;
+      if (nextID > maxPacketID) {
+        tiles.front().emitError("no packet ID left to broadcast ") << elf;
+        return signalPassFailure();
+      }
+      auto flow = builder.create<PacketFlowOp>(tiles.front().getLoc(), nextID);
+      builder.createBlock(&flow.getPorts());
+      builder.create<PacketSourceOp>(flow.getLoc(), shim, WireBundle::DMA,
+                                     channel);
+      for (auto tile : tiles) {
+        builder.create<PacketDestOp>(flow.getLoc(), tile, WireBundle::Ctrl,
+                                     0);
+        tile->setAttr("ctrl_broadcast_id", builder.getI32IntegerAttr(nextID));
+      }
+      builder.create<EndOp>(flow.getLoc());
+      builder.setInsertionPointAfter(flow);
+      LLVM_DEBUG(llvm::dbgs() << "Broadcasting " << elf << " to "
+                              << tiles.size() << " tiles with ID " << nextID
+                              << "\n");
+      nextID++;
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIERouteControlPacketsPass() {
+  return std::make_unique<AIERouteControlPacketsPass>();
+}
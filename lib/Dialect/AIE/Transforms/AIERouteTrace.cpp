@@ -0,0 +1,102 @@
+//===- AIERouteTrace.cpp ----------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the routing of the trace ports of the tiles marked for
+// tracing to a shim DMA, as packet flows, so that the host can capture their
+// trace in DDR.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-route-trace"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+// The packet IDs of the packet headers have 5 bits.
+static const int maxPacketID = 31;
+
+struct AIERouteTracePass : public AIERouteTraceBase<AIERouteTracePass> {
+  /// Function that returns the tile of device at col, row, creating it at
+  /// the start of the device if it does not exist.
+  TileOp getOrCreateTile(DeviceOp device, int col, int row) {
+    for (auto tile : device.getOps<TileOp>())
+      if (tile.colIndex() == col && tile.rowIndex() == row)
+        return tile;
+    OpBuilder builder = OpBuilder::atBlockBegin(device.getBody());
+    return builder.create<TileOp>(builder.getUnknownLoc(), col, row);
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    const auto &targetModel = device.getTargetModel();
+
+    SmallVector<TileOp, 8> traced;
+    for (auto tile : device.getOps<TileOp>())
+      if (tile->hasAttr("trace"))
+        traced.push_back(tile);
+    if (traced.empty())
+      return;
+
+    int col = shimCol;
+    for (int c = 0; col < 0 && c < targetModel.columns(); c++)
+      if (targetModel.isShimNOCTile(c, 0))
+        col = c;
+    if (col < 0 || col >= targetModel.columns() ||
+        !targetModel.isShimNOCTile(col, 0)) {
+      device.emitError("no shim NOC tile in column ")
+          << col << " to route the trace to";
+      return signalPassFailure();
+    }
+
+    int nextID = packetID;
+    if (nextID < 0) {
+      nextID = 0;
+      for (auto flow : device.getOps<PacketFlowOp>())
+        nextID = std::max(nextID, flow.IDInt() + 1);
+    }
+
+    TileOp shim = getOrCreateTile(device, col, 0);
+    OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
+    for (auto tile : traced) {
+      // The trace units of a tile, e.g. of the core and memory modules of a
+      // core tile, each have their own packet ID.
+      SmallVector<int32_t, 2> ids;
+      int ports = targetModel.getNumSourceSwitchboxConnections(
+          tile.colIndex(), tile.rowIndex(), WireBundle::Trace);
+      for (int port = 0; port < ports; port++) {
+        if (nextID > maxPacketID) {
+          tile.emitError("no packet ID left to route its trace");
+          return signalPassFailure();
+        }
+        auto flow = builder.create<PacketFlowOp>(tile.getLoc(), nextID);
+        builder.createBlock(&flow.getPorts());
+        builder.create<PacketSourceOp>(tile.getLoc(), tile, WireBundle::Trace,
+                                       port);
+        builder.create<PacketDestOp>(tile.getLoc(), shim, WireBundle::DMA,
+                                     channel);
+        builder.create<EndOp>(tile.getLoc());
+        builder.setInsertionPointAfter(flow);
+        LLVM_DEBUG(llvm::dbgs() << "Routing trace port " << port << " of "
+                                << tile << " with ID " << nextID << "\n");
+        ids.push_back(nextID++);
+      }
+      tile->removeAttr("trace");
+      tile->setAttr("trace_packet_ids", builder.getDenseI32ArrayAttr(ids));
+    }
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIERouteTracePass() {
+  return std::make_unique<AIERouteTracePass>();
+}
@@ -0,0 +1,146 @@
+//===- AIERoutingGraph.cpp --------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/Transforms/AIERoutingGraph.h"
+
+#include <bitset>
+
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+void RoutingGraph::initialize(int _maxcol, int _maxrow,
+                              const AIETargetModel &targetModel) {
+  maxcol = _maxcol;
+  maxrow = _maxrow;
+  switchboxes.clear();
+
+  // collect the edges between neighbouring switchboxes
+  struct EdgeInfo {
+    VertexID src, dst;
+    WireBundle bundle;
+    unsigned short maxCapacity;
+  };
+  std::vector<EdgeInfo> edgeList;
+  for (int row = 0; row <= maxrow; row++) {
+    for (int col = 0; col <= maxcol; col++) {
+      VertexID id = switchboxes.size();
+      assert(id == getVertex(col, row));
+      switchboxes.push_back({(unsigned short)col, (unsigned short)row});
+      if (row > 0) { // if not in row 0 add channel to North/South
+        VertexID south = getVertex(col, row - 1);
+        if (auto maxCapacity = targetModel.getNumSourceSwitchboxConnections(
+                col, row, WireBundle::South))
+          edgeList.push_back(
+              {south, id, WireBundle::North, (unsigned short)maxCapacity});
+        if (auto maxCapacity = targetModel.getNumDestSwitchboxConnections(
+                col, row, WireBundle::South))
+          edgeList.push_back(
+              {id, south, WireBundle::South, (unsigned short)maxCapacity});
+      }
+      if (col > 0) { // if not in col 0 add channel to East/West
+        VertexID west = getVertex(col - 1, row);
+        if (auto maxCapacity = targetModel.getNumSourceSwitchboxConnections(
+                col, row, WireBundle::West))
+          edgeList.push_back(
+              {west, id, WireBundle::East, (unsigned short)maxCapacity});
+        if (auto maxCapacity = targetModel.getNumDestSwitchboxConnections(
+                col, row, WireBundle::West))
+          edgeList.push_back(
+              {id, west, WireBundle::West, (unsigned short)maxCapacity});
+      }
+    }
+  }
+
+  // number the edges by source vertex, keeping the order in which they were
+  // created among the edges leaving the same vertex
+  unsigned int numV = switchboxes.size();
+  outOffsets.assign(numV + 1, 0);
+  inOffsets.assign(numV + 1, 0);
+  for (auto &e : edgeList) {
+    outOffsets[e.src + 1]++;
+    inOffsets[e.dst + 1]++;
+  }
+  for (unsigned int v = 0; v < numV; v++) {
+    outOffsets[v + 1] += outOffsets[v];
+    inOffsets[v + 1] += inOffsets[v];
+  }
+  unsigned int numE = edgeList.size();
+  edgeSource.resize(numE);
+  edgeTarget.resize(numE);
+  bundle.resize(numE);
+  maxCapacity.resize(numE);
+  std::vector<EdgeID> nextOut(outOffsets.begin(), outOffsets.end() - 1);
+  for (auto &e : edgeList) {
+    EdgeID id = nextOut[e.src]++;
+    edgeSource[id] = e.src;
+    edgeTarget[id] = e.dst;
+    bundle[id] = e.bundle;
+    maxCapacity[id] = e.maxCapacity;
+  }
+  inEdges.resize(numE);
+  std::vector<unsigned int> nextIn(inOffsets.begin(), inOffsets.end() - 1);
+  for (EdgeID id = 0; id < numE; id++)
+    inEdges[nextIn[edgeTarget[id]]++] = id;
+
+  // initialize weights of all Channels to 1
+  demand.assign(numE, 1);
+  clearChannels();
+}
+
+void RoutingGraph::clearChannels() {
+  unsigned int numE = numEdges();
+  usedCapacity.assign(numE, 0);
+  overCapacityCount.assign(numE, 0);
+  fixedCapacity.assign(numE, 0);
+  allocatedCapacity.assign(numE, 0);
+  overflowCount.assign(numE, 0);
+}
+
+void RoutingGraph::addFixedChannel(EdgeID edge, short index) {
+  if (index >= 0 && index < OVERFLOW_CHANNEL)
+    fixedCapacity[edge] |= ChannelMask(1) << index;
+}
+
+unsigned int RoutingGraph::numFixedChannels(EdgeID edge) const {
+  return std::bitset<OVERFLOW_CHANNEL>(fixedCapacity[edge]).count();
+}
+
+short RoutingGraph::allocateChannel(EdgeID edge) {
+  ChannelMask taken = fixedCapacity[edge] | allocatedCapacity[edge];
+  short index = 0;
+  while (index < OVERFLOW_CHANNEL && (taken >> index) & 1)
+    index++;
+  if (index < OVERFLOW_CHANNEL)
+    allocatedCapacity[edge] |= ChannelMask(1) << index;
+  else
+    overflowCount[edge]++;
+  updateUsedCapacity(edge);
+  return index;
+}
+
+void RoutingGraph::releaseChannel(EdgeID edge, short index) {
+  if (index < OVERFLOW_CHANNEL)
+    allocatedCapacity[edge] &= ~(ChannelMask(1) << index);
+  else
+    overflowCount[edge]--;
+  updateUsedCapacity(edge);
+}
+
+// the used capacity is one past the highest allocated channel index
+void RoutingGraph::updateUsedCapacity(EdgeID edge) {
+  if (overflowCount[edge]) {
+    usedCapacity[edge] = OVERFLOW_CHANNEL + 1;
+    return;
+  }
+  unsigned short used = 0;
+  for (ChannelMask mask = allocatedCapacity[edge]; mask; mask >>= 1)
+    used++;
+  usedCapacity[edge] = used;
+}
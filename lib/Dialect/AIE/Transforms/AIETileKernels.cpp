@@ -0,0 +1,859 @@
+//===- AIETileKernels.cpp ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "mlir/Dialect/Affine/IR/AffineOps.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Pass/Pass.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "aie-tile-kernels"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+static const char *TILE_KERNEL_ATTR_NAME = "aie.tile_kernel";
+
+// The elements of the objectFifos feeding the tiles are double buffered, so
+// that the DMAs move the next tile while the core works on the current one.
+// The exploration of the tilings lowers it to one for the tiles moved once,
+// or when double buffering does not pay off.
+static const int TILE_FIFO_DEPTH = 2;
+
+namespace {
+
+// The index of an access along one memref dimension, as a linear function
+// of the loops of the band: sum(coeffs[l] * iv_l) + constant.
+struct LinearIndex {
+  SmallVector<int64_t, 4> coeffs;
+  int64_t constant = 0;
+
+  bool isConstant() const {
+    return llvm::all_of(coeffs, [](int64_t c) { return c == 0; });
+  }
+};
+
+// The accesses of the kernel to one of its memref arguments.
+struct ArgAccesses {
+  BlockArgument arg;
+  MemRefType type;
+  SmallVector<Operation *, 4> ops;
+  // The index of each access along each dimension.
+  SmallVector<SmallVector<LinearIndex, 4>, 4> indices;
+  bool isRead = false;
+  bool isWrite = false;
+  // The depth of the objectFifos of the argument
+  int64_t depth = TILE_FIFO_DEPTH;
+  // The shape of a tile of the argument, and the position in the tile of
+  // the element at the origin of the loops.
+  SmallVector<int64_t, 4> tileShape;
+  SmallVector<int64_t, 4> tileBase;
+
+  bool dependsOn(unsigned loop) const {
+    return llvm::any_of(indices[0], [&](const LinearIndex &index) {
+      return index.coeffs[loop] != 0;
+    });
+  }
+};
+
+} // namespace
+
+/// Function that returns expr, mapping the dimensions and symbols of an
+/// affine map to operands, as a linear function of the ivs of a band.
+static std::optional<LinearIndex> getLinearIndex(AffineExpr expr,
+                                                 ValueRange operands,
+                                                 unsigned numDims,
+                                                 ArrayRef<Value> ivs) {
+  LinearIndex index;
+  index.coeffs.assign(ivs.size(), 0);
+  auto getOperandIndex = [&](Value operand) -> std::optional<LinearIndex> {
+    auto it = llvm::find(ivs, operand);
+    if (it != ivs.end()) {
+      index.coeffs[it - ivs.begin()] = 1;
+      return index;
+    }
+    if (auto cst = getConstantIntValue(operand)) {
+      index.constant = *cst;
+      return index;
+    }
+    return std::nullopt;
+  };
+
+  if (auto dim = expr.dyn_cast<AffineDimExpr>())
+    return getOperandIndex(operands[dim.getPosition()]);
+  if (auto sym = expr.dyn_cast<AffineSymbolExpr>())
+    return getOperandIndex(operands[numDims + sym.getPosition()]);
+  if (auto cst = expr.dyn_cast<AffineConstantExpr>()) {
+    index.constant = cst.getValue();
+    return index;
+  }
+  auto bin = expr.dyn_cast<AffineBinaryOpExpr>();
+  if (!bin)
+    return std::nullopt;
+  auto lhs = getLinearIndex(bin.getLHS(), operands, numDims, ivs);
+  auto rhs = getLinearIndex(bin.getRHS(), operands, numDims, ivs);
+  if (!lhs || !rhs)
+    return std::nullopt;
+  if (expr.getKind() == AffineExprKind::Add) {
+    for (unsigned l = 0; l < ivs.size(); ++l)
+      lhs->coeffs[l] += rhs->coeffs[l];
+    lhs->constant += rhs->constant;
+    return lhs;
+  }
+  if (expr.getKind() == AffineExprKind::Mul) {
+    if (!rhs->isConstant())
+      std::swap(lhs, rhs);
+    if (!rhs->isConstant())
+      return std::nullopt;
+    for (auto &c : lhs->coeffs)
+      c *= rhs->constant;
+    lhs->constant *= rhs->constant;
+    return lhs;
+  }
+  return std::nullopt;
+}
+
+static int64_t getSmallestFactor(int64_t n) {
+  for (int64_t f = 2; f * f <= n; ++f)
+    if (n % f == 0)
+      return f;
+  return n;
+}
+
+struct AIETileKernelsPass : public AIETileKernelsBase<AIETileKernelsPass> {
+  func::FuncOp kernel;
+  // The perfectly nested loops of the kernel, with their trip counts and
+  // tile sizes.
+  SmallVector<AffineForOp, 4> band;
+  SmallVector<int64_t, 4> trips;
+  SmallVector<int64_t, 4> tiles;
+  SmallVector<ArgAccesses, 4> args;
+  // The bytes moved per cycle by a DMA channel of the shim tile.
+  int64_t shimDmaBytesPerCycle = 0;
+
+  /// Function that collects the band and the accesses of kernel. Emits an
+  /// error and returns failure if the kernel cannot be tiled.
+  LogicalResult analyzeKernel() {
+    Block &entry = kernel.getBody().front();
+    auto loops = entry.getOps<AffineForOp>();
+    if (!llvm::hasSingleElement(loops) || entry.getOperations().size() != 2)
+      return kernel.emitError(
+          "tile kernel must hold a single affine.for nest");
+
+    AffineForOp loop = *loops.begin();
+    while (true) {
+      if (!loop.hasConstantBounds() || loop.getConstantLowerBound() != 0 ||
+          loop.getStep() != 1)
+        return loop.emitError(
+            "tile kernel loops must run from 0 to a constant with step 1");
+      band.push_back(loop);
+      trips.push_back(loop.getConstantUpperBound());
+      Block *body = loop.getBody();
+      if (body->getOperations().size() != 2)
+        break;
+      auto inner = dyn_cast<AffineForOp>(body->front());
+      if (!inner)
+        break;
+      loop = inner;
+    }
+    for (Operation &op : band.back().getBody()->without_terminator())
+      if (op.getNumRegions() > 0)
+        return op.emitError("tile kernel loops must be perfectly nested");
+
+    SmallVector<Value, 4> ivs;
+    for (auto forOp : band)
+      ivs.push_back(forOp.getInductionVar());
+
+    for (BlockArgument arg : kernel.getArguments()) {
+      auto type = arg.getType().dyn_cast<MemRefType>();
+      if (!type || !type.hasStaticShape() || !type.getLayout().isIdentity())
+        return kernel.emitError("tile kernel arguments must be memrefs of "
+                                "static shape and identity layout");
+      ArgAccesses accesses{arg, type};
+      for (Operation *user : arg.getUsers()) {
+        AffineMap map;
+        ValueRange operands;
+        if (auto load = dyn_cast<AffineLoadOp>(user)) {
+          map = load.getAffineMap();
+          operands = load.getMapOperands();
+          accesses.isRead = true;
+        } else if (auto store = dyn_cast<AffineStoreOp>(user);
+                   store && store.getMemRef() == arg) {
+          map = store.getAffineMap();
+          operands = store.getMapOperands();
+          accesses.isWrite = true;
+        } else {
+          return user->emitError(
+              "tile kernel arguments must only be accessed by affine.load "
+              "and affine.store");
+        }
+        SmallVector<LinearIndex, 4> indices;
+        for (AffineExpr expr : map.getResults()) {
+          auto index = getLinearIndex(expr, operands, map.getNumDims(), ivs);
+          if (!index)
+            return user->emitError("access index is not a linear function "
+                                   "of the loops of the tile kernel");
+          indices.push_back(*index);
+        }
+        accesses.ops.push_back(user);
+        accesses.indices.push_back(indices);
+      }
+      if (accesses.ops.empty())
+        continue;
+
+      // A tile is moved as a whole between two tiles of the loops, which
+      // needs all the accesses to move with the loops at the same rate.
+      for (auto &indices : accesses.indices)
+        for (auto [index, first] : llvm::zip(indices, accesses.indices[0]))
+          if (index.coeffs != first.coeffs)
+            return accesses.ops[0]->emitError(
+                "accesses to a tile kernel argument must have the same "
+                "strides along the loops");
+      // The tiles of the results must not overlap, so that each element is
+      // written back once.
+      if (accesses.isWrite)
+        for (auto &indices : accesses.indices)
+          for (auto &index : indices)
+            if (index.constant != 0 ||
+                llvm::count_if(index.coeffs, [](int64_t c) { return c; }) >
+                    1 ||
+                llvm::any_of(index.coeffs,
+                             [](int64_t c) { return c != 0 && c != 1; }))
+              return accesses.ops[0]->emitError(
+                  "written tile kernel arguments must be indexed by the "
+                  "loop ivs directly");
+      args.push_back(accesses);
+    }
+    return success();
+  }
+
+  /// Function that computes the shape of the tiles of each argument for the
+  /// current tile sizes, and returns the bytes they take on the core.
+  int64_t computeTileShapes() {
+    int64_t bytes = 0;
+    for (auto &accesses : args) {
+      unsigned rank = accesses.type.getRank();
+      accesses.tileShape.assign(rank, 0);
+      accesses.tileBase.assign(rank, 0);
+      for (unsigned d = 0; d < rank; ++d) {
+        int64_t lo = std::numeric_limits<int64_t>::max();
+        int64_t hi = std::numeric_limits<int64_t>::min();
+        for (auto &indices : accesses.indices) {
+          int64_t min = indices[d].constant, max = indices[d].constant;
+          for (auto [c, tile] : llvm::zip(indices[d].coeffs, tiles))
+            (c < 0 ? min : max) += c * (tile - 1);
+          lo = std::min(lo, min);
+          hi = std::max(hi, max);
+        }
+        accesses.tileShape[d] = hi - lo + 1;
+        accesses.tileBase[d] = lo;
+      }
+      int64_t elems = 1;
+      for (int64_t size : accesses.tileShape)
+        elems *= size;
+      int64_t elemBytes = accesses.type.getElementTypeBitWidth() / 8;
+      int64_t fifos = accesses.isRead && accesses.isWrite ? 2 : 1;
+      bytes += elems * elemBytes * fifos * accesses.depth;
+    }
+    return bytes;
+  }
+
+  /// Function that computes which loops can be tiled, and the tile size
+  /// along each loop below which the tiles along the innermost dimension of
+  /// an argument are no longer a multiple of the vector lanes.
+  void getTilingConstraints(unsigned laneBits, SmallVector<bool, 4> &splittable,
+                            SmallVector<int64_t, 4> &minTiles) {
+    unsigned numLoops = band.size();
+
+    // The loops inside which a result has its elements accumulated over
+    // another loop must run in full, or the partial results would leave the
+    // core between two tiles of the outer loop.
+    splittable.assign(numLoops, true);
+    minTiles.assign(numLoops, 1);
+    for (auto &accesses : args) {
+      if (accesses.isWrite) {
+        int innermost = -1;
+        for (unsigned l = 0; l < numLoops; ++l)
+          if (accesses.dependsOn(l))
+            innermost = l;
+        for (int l = 0; l < innermost; ++l)
+          if (!accesses.dependsOn(l))
+            splittable[l] = false;
+      }
+      int64_t lanes = laneBits / accesses.type.getElementTypeBitWidth();
+      for (auto &indices : accesses.indices)
+        for (unsigned l = 0; l < numLoops; ++l)
+          if (indices.back().coeffs[l] == 1)
+            minTiles[l] = std::max(minTiles[l], std::min(lanes, trips[l]));
+    }
+  }
+
+  /// Function that returns the loops over the tiles which run more than
+  /// once.
+  SmallVector<unsigned, 4> getTileLoops() {
+    SmallVector<unsigned, 4> tileLoops;
+    for (unsigned l = 0; l < band.size(); ++l)
+      if (tiles[l] < trips[l])
+        tileLoops.push_back(l);
+    return tileLoops;
+  }
+
+  /// Function that shrinks the tiles until the tiles of the arguments fit in
+  /// budget bytes. The tiles along the innermost dimension of an argument
+  /// are kept a multiple of the vector lanes as long as possible.
+  LogicalResult chooseTileSizes(int64_t budget, unsigned laneBits) {
+    tiles = trips;
+    unsigned numLoops = band.size();
+    SmallVector<bool, 4> splittable;
+    SmallVector<int64_t, 4> minTiles;
+    getTilingConstraints(laneBits, splittable, minTiles);
+
+    while (computeTileShapes() > budget) {
+      int best = -1;
+      for (bool keepLanes : {true, false}) {
+        for (unsigned l = 0; l < numLoops; ++l) {
+          if (!splittable[l] || tiles[l] == 1)
+            continue;
+          int64_t next = tiles[l] / getSmallestFactor(tiles[l]);
+          if (keepLanes && next < minTiles[l])
+            continue;
+          if (best < 0 || tiles[l] > tiles[best])
+            best = l;
+        }
+        if (best >= 0)
+          break;
+      }
+      if (best < 0)
+        return kernel.emitError("tile kernel does not fit in ")
+               << budget << " bytes of local memory";
+      tiles[best] /= getSmallestFactor(tiles[best]);
+      LLVM_DEBUG(llvm::dbgs() << "Tiling loop " << best << " of "
+                              << kernel.getName() << " by " << tiles[best]
+                              << "\n");
+    }
+    return success();
+  }
+
+  // The cost of running the kernel with some tile sizes and objectFifo
+  // depths.
+  struct TilingCost {
+    // The estimated cycles of the kernel
+    int64_t cycles;
+    // The bytes moved by the shim DMAs
+    int64_t traffic;
+    int64_t numTiles;
+  };
+
+  /// Function that estimates the cost of the current tile sizes and
+  /// objectFifo depths. The core runs the tile function, vectorized when its
+  /// innermost loop covers whole vectors, plus tileOverhead cycles of
+  /// synchronization per tile. Each objectFifo has a shim DMA channel moving
+  /// shimDmaBytesPerCycle bytes per cycle, in the shadow of the core when the
+  /// tiles it moves more than once are double buffered.
+  TilingCost estimateCost(unsigned laneBits) {
+    SmallVector<unsigned, 4> tileLoops = getTileLoops();
+    int64_t numTiles = 1, tileIters = 1;
+    for (auto [trip, tile] : llvm::zip(trips, tiles)) {
+      numTiles *= trip / tile;
+      tileIters *= tile;
+    }
+    unsigned elemBits = 8;
+    for (auto &accesses : args)
+      elemBits = std::max(elemBits, accesses.type.getElementTypeBitWidth());
+    int64_t lanes = laneBits / elemBits;
+    if (tiles.back() % lanes == 0)
+      tileIters /= lanes;
+    int64_t computeCycles = numTiles * (tileIters + tileOverhead);
+
+    int64_t traffic = 0, dmaCycles = 0;
+    bool overlapped = true;
+    for (auto &accesses : args) {
+      unsigned level = getAcquireLevel(accesses, tileLoops);
+      int64_t transfers = 1;
+      for (unsigned l : ArrayRef<unsigned>(tileLoops).take_front(level))
+        transfers *= trips[l] / tiles[l];
+      int64_t bytes = accesses.type.getElementTypeBitWidth() / 8 * transfers;
+      for (int64_t size : accesses.tileShape)
+        bytes *= size;
+      int64_t fifos = accesses.isRead && accesses.isWrite ? 2 : 1;
+      traffic += bytes * fifos;
+      dmaCycles = std::max(
+          dmaCycles, bytes / std::max<int64_t>(shimDmaBytesPerCycle, 1));
+      if (transfers > 1 && accesses.depth < 2)
+        overlapped = false;
+    }
+    int64_t cycles = overlapped ? std::max(computeCycles, dmaCycles)
+                                : computeCycles + dmaCycles;
+    return {cycles, traffic, numTiles};
+  }
+
+  /// Function that sets the depth of the objectFifos of each argument: two
+  /// if doubleBuffer is set and its tiles are moved more than once, one
+  /// otherwise.
+  void setFifoDepths(bool doubleBuffer) {
+    SmallVector<unsigned, 4> tileLoops = getTileLoops();
+    for (auto &accesses : args)
+      accesses.depth =
+          doubleBuffer && getAcquireLevel(accesses, tileLoops) > 0 ? 2 : 1;
+  }
+
+  /// Function that tries all the tile sizes dividing the trip counts of the
+  /// loops which can be tiled, double buffered or not, and keeps the ones
+  /// fitting in budget bytes with the fewest estimated cycles. Ties go to
+  /// the least traffic, the fewest tiles, then the longest tiles along the
+  /// innermost loops.
+  LogicalResult exploreTileSizes(int64_t budget, unsigned laneBits) {
+    unsigned numLoops = band.size();
+    SmallVector<bool, 4> splittable;
+    SmallVector<int64_t, 4> minTiles;
+    getTilingConstraints(laneBits, splittable, minTiles);
+
+    SmallVector<SmallVector<int64_t, 8>, 4> sizes(numLoops);
+    for (unsigned l = 0; l < numLoops; ++l) {
+      for (int64_t size = trips[l]; size >= 1; --size)
+        if (trips[l] % size == 0 && (splittable[l] || size == trips[l]))
+          sizes[l].push_back(size);
+    }
+
+    std::optional<TilingCost> best;
+    SmallVector<int64_t, 4> bestTiles;
+    bool bestDoubleBuffer = true;
+    auto isBetter = [&](const TilingCost &cost) {
+      if (!best)
+        return true;
+      if (cost.cycles != best->cycles)
+        return cost.cycles < best->cycles;
+      if (cost.traffic != best->traffic)
+        return cost.traffic < best->traffic;
+      if (cost.numTiles != best->numTiles)
+        return cost.numTiles < best->numTiles;
+      for (int l = numLoops - 1; l >= 0; --l)
+        if (tiles[l] != bestTiles[l])
+          return tiles[l] > bestTiles[l];
+      return false;
+    };
+
+    tiles = trips;
+    std::function<void(unsigned)> tryTiles = [&](unsigned loop) {
+      if (loop == numLoops) {
+        for (bool doubleBuffer : {true, false}) {
+          setFifoDepths(doubleBuffer);
+          if (computeTileShapes() > budget)
+            continue;
+          TilingCost cost = estimateCost(laneBits);
+          if (isBetter(cost)) {
+            best = cost;
+            bestTiles = tiles;
+            bestDoubleBuffer = doubleBuffer;
+          }
+        }
+        return;
+      }
+      for (int64_t size : sizes[loop]) {
+        // The tiles only grow with the tile sizes: skip the sizes which do
+        // not fit even with the smallest tiles along the inner loops.
+        tiles[loop] = size;
+        for (unsigned l = loop + 1; l < numLoops; ++l)
+          tiles[l] = sizes[l].back();
+        setFifoDepths(false);
+        if (computeTileShapes() > budget)
+          continue;
+        tryTiles(loop + 1);
+      }
+    };
+    tryTiles(0);
+
+    if (!best)
+      return kernel.emitError("tile kernel does not fit in ")
+             << budget << " bytes of local memory";
+    tiles = bestTiles;
+    setFifoDepths(bestDoubleBuffer);
+    computeTileShapes();
+
+    std::string tileSizes;
+    llvm::raw_string_ostream os(tileSizes);
+    llvm::interleave(tiles, os, "x");
+    auto remark = kernel.emitRemark("tiles ")
+                  << os.str() << " of " << kernel.getName()
+                  << " with objectFifo depths ";
+    llvm::interleaveComma(args, remark, [&](const ArgAccesses &accesses) {
+      remark << accesses.depth;
+    });
+    remark << ": estimated " << best->cycles << " cycles, " << best->traffic
+           << " bytes moved";
+    return success();
+  }
+
+  /// Function that creates the function running one tile of the kernel on
+  /// tile-sized memrefs, and returns it.
+  func::FuncOp createTileFunction(OpBuilder &builder) {
+    SmallVector<Type, 4> types;
+    for (auto &accesses : args)
+      types.push_back(MemRefType::get(accesses.tileShape,
+                                      accesses.type.getElementType()));
+    auto tileFunc = builder.create<func::FuncOp>(
+        kernel.getLoc(), (kernel.getName() + "_tile").str(),
+        builder.getFunctionType(types, {}));
+    Block *entry = tileFunc.addEntryBlock();
+    OpBuilder b = OpBuilder::atBlockEnd(entry);
+
+    SmallVector<Value, 4> ivs;
+    for (auto [forOp, tile] : llvm::zip(band, tiles)) {
+      auto pointLoop = b.create<AffineForOp>(forOp.getLoc(), 0, tile);
+      ivs.push_back(pointLoop.getInductionVar());
+      b.setInsertionPoint(pointLoop.getBody()->getTerminator());
+    }
+
+    IRMapping mapping;
+    for (auto [forOp, iv] : llvm::zip(band, ivs))
+      mapping.map(forOp.getInductionVar(), iv);
+    DenseMap<Operation *, std::pair<Value, AffineMap>> newAccesses;
+    for (auto [accesses, arg] : llvm::zip(args, entry->getArguments()))
+      for (auto [op, indices] : llvm::zip(accesses.ops, accesses.indices)) {
+        SmallVector<AffineExpr, 4> exprs;
+        for (auto [index, base] : llvm::zip(indices, accesses.tileBase)) {
+          AffineExpr expr = b.getAffineConstantExpr(index.constant - base);
+          for (auto [l, c] : llvm::enumerate(index.coeffs))
+            expr = expr + b.getAffineDimExpr(l) * c;
+          exprs.push_back(expr);
+        }
+        newAccesses[op] = {arg, AffineMap::get(ivs.size(), 0, exprs,
+                                               builder.getContext())};
+      }
+
+    for (Operation &op : band.back().getBody()->without_terminator()) {
+      auto it = newAccesses.find(&op);
+      if (it == newAccesses.end()) {
+        b.clone(op, mapping);
+        continue;
+      }
+      auto [memref, map] = it->second;
+      if (auto load = dyn_cast<AffineLoadOp>(op)) {
+        auto newLoad = b.create<AffineLoadOp>(load.getLoc(), memref, map, ivs);
+        mapping.map(load.getResult(), newLoad.getResult());
+      } else {
+        auto store = cast<AffineStoreOp>(op);
+        b.create<AffineStoreOp>(store.getLoc(),
+                                mapping.lookupOrDefault(store.getValue()),
+                                memref, map, ivs);
+      }
+    }
+    b.setInsertionPointToEnd(entry);
+    b.create<func::ReturnOp>(kernel.getLoc());
+    return tileFunc;
+  }
+
+  /// Function that returns the index in tileLoops of the innermost loop
+  /// the tiles of accesses depend on, plus one, or zero if they do not
+  /// depend on any.
+  static unsigned getAcquireLevel(const ArgAccesses &accesses,
+                                  ArrayRef<unsigned> tileLoops) {
+    unsigned level = 0;
+    for (auto [i, l] : llvm::enumerate(tileLoops))
+      if (accesses.dependsOn(l))
+        level = i + 1;
+    return level;
+  }
+
+  /// Function that returns the strides and wraps, in 32-bit words and from
+  /// the highest dimension to the lowest, with which the shim DMA walks the
+  /// tiles of accesses in the order the core acquires them. Returns an empty
+  /// list if the tiles are contiguous, or std::nullopt if the DMA cannot
+  /// walk them.
+  std::optional<SmallVector<DimTupleAttr, 4>>
+  getTileDimensions(const ArgAccesses &accesses, ArrayRef<unsigned> tileLoops,
+                    unsigned level) {
+    unsigned rank = accesses.type.getRank();
+    SmallVector<int64_t, 4> rowStrides(rank, 1);
+    for (int d = rank - 2; d >= 0; --d)
+      rowStrides[d] = rowStrides[d + 1] * accesses.type.getDimSize(d + 1);
+    int64_t base = 0;
+    for (unsigned d = 0; d < rank; ++d)
+      base += accesses.tileBase[d] * rowStrides[d];
+    if (base != 0)
+      return std::nullopt;
+
+    // The (stride, wrap) of the loops over the tiles, then of the rows of a
+    // tile, in elements.
+    SmallVector<std::pair<int64_t, int64_t>, 8> dims;
+    for (unsigned l : ArrayRef<unsigned>(tileLoops).take_front(level)) {
+      int64_t stride = 0;
+      for (unsigned d = 0; d < rank; ++d)
+        stride += accesses.indices[0][d].coeffs[l] * tiles[l] * rowStrides[d];
+      dims.push_back({stride, trips[l] / tiles[l]});
+    }
+    for (unsigned d = 0; d < rank; ++d)
+      dims.push_back({rowStrides[d], accesses.tileShape[d]});
+
+    // Drop the dimensions of one iteration and merge the contiguous ones.
+    SmallVector<std::pair<int64_t, int64_t>, 8> merged;
+    for (auto dim : dims) {
+      if (dim.second == 1)
+        continue;
+      // A tile sent again for each iteration of a loop it does not depend
+      // on needs a zero stride.
+      if (dim.first <= 0)
+        return std::nullopt;
+      merged.push_back(dim);
+    }
+    for (int i = merged.size() - 1; i > 0; --i)
+      if (merged[i - 1].first == merged[i].first * merged[i].second) {
+        merged[i].second *= merged[i - 1].second;
+        merged.erase(merged.begin() + i - 1);
+      }
+    if (merged.empty() ||
+        (merged.size() == 1 && merged[0].first == 1 &&
+         merged[0].second == accesses.type.getNumElements()))
+      return SmallVector<DimTupleAttr, 4>();
+
+    // The DMAs move 32-bit words
+    int64_t bits = accesses.type.getElementTypeBitWidth();
+    if (merged.back().first != 1)
+      return std::nullopt;
+    SmallVector<DimTupleAttr, 4> words;
+    for (auto [i, dim] : llvm::enumerate(merged)) {
+      auto [stride, wrap] = dim;
+      if (i + 1 == merged.size()) {
+        if ((wrap * bits) % 32 != 0)
+          return std::nullopt;
+        wrap = wrap * bits / 32;
+      } else {
+        if ((stride * bits) % 32 != 0)
+          return std::nullopt;
+        stride = stride * bits / 32;
+      }
+      if (wrap > std::numeric_limits<uint16_t>::max() ||
+          stride > std::numeric_limits<uint32_t>::max())
+        return std::nullopt;
+      words.push_back(DimTupleAttr::get(&getContext(), (uint32_t)stride,
+                                        (uint16_t)wrap));
+    }
+    // The shim DMAs have three dimensions
+    if (words.size() > 3)
+      return std::nullopt;
+    return words;
+  }
+
+  static TileOp getOrCreateTile(OpBuilder &builder, DeviceOp device, int col,
+                                int row) {
+    for (auto tile : device.getOps<TileOp>())
+      if (tile.colIndex() == col && tile.rowIndex() == row)
+        return tile;
+    OpBuilder::InsertionGuard guard(builder);
+    builder.setInsertionPointToStart(device.getBody());
+    return builder.create<TileOp>(builder.getUnknownLoc(), col, row);
+  }
+
+  void runOnOperation() override {
+    DeviceOp device = getOperation();
+    const auto &targetModel = getTargetModel(device);
+    MLIRContext *ctx = &getContext();
+
+    SmallVector<func::FuncOp, 1> kernels;
+    for (auto func : device.getOps<func::FuncOp>())
+      if (func->hasAttr(TILE_KERNEL_ATTR_NAME))
+        kernels.push_back(func);
+    if (kernels.empty())
+      return;
+    if (kernels.size() > 1) {
+      kernels[1].emitError("only one tile kernel per device is supported");
+      return signalPassFailure();
+    }
+    kernel = kernels[0];
+    if (!targetModel.isCoreTile(col, row) || targetModel.isMemTile(col, row)) {
+      kernel.emitError("(") << col << ", " << row << ") is not a core tile";
+      return signalPassFailure();
+    }
+    if (failed(analyzeKernel()))
+      return signalPassFailure();
+
+    OpBuilder builder(kernel);
+    TileOp computeTile = getOrCreateTile(builder, device, col, row);
+    TileOp shimTile = getOrCreateTile(
+        builder, device, shimCol < 0 ? (int)col : (int)shimCol, 0);
+    for (auto core : device.getOps<CoreOp>())
+      if (core.getTile() == computeTile.getResult()) {
+        core.emitError("tile kernel needs a core on a tile without one");
+        return signalPassFailure();
+      }
+
+    // The tiles of the arguments go in the memory left beside the stack of
+    // the core and the buffers already on the tile.
+    int64_t budget = targetModel.getLocalMemorySize() - stackSize;
+    for (auto buffer : device.getOps<BufferOp>())
+      if (buffer.getTileOp() == computeTile)
+        budget -= buffer.getAllocationSize();
+    // The width of the vectors of the aievec schemes
+    unsigned laneBits =
+        targetModel.getTargetArch() == AIEArch::AIE1 ? 256 : 512;
+    shimDmaBytesPerCycle =
+        dmaBytesPerCycle
+            ? dmaBytesPerCycle
+            : targetModel.getDmaBytesPerCycle(shimTile.colIndex(), 0);
+    if (failed(explore ? exploreTileSizes(budget, laneBits)
+                       : chooseTileSizes(budget, laneBits)))
+      return signalPassFailure();
+
+    func::FuncOp tileFunc = createTileFunction(builder);
+
+    SmallVector<unsigned, 4> tileLoops = getTileLoops();
+
+    // Move the tiles of each argument between the external memory and the
+    // core through objectFifos, the shim DMA arranging them in blocks.
+    struct ArgFifos {
+      ObjectFifoCreateOp in, out;
+      MemRefType elemType;
+      unsigned level;
+    };
+    SmallVector<ArgFifos, 4> fifos;
+    builder.setInsertionPoint(tileFunc);
+    for (auto &accesses : args) {
+      std::string name = (kernel.getName() + "_arg" +
+                          Twine(accesses.arg.getArgNumber()))
+                             .str();
+      auto elemType = MemRefType::get(accesses.tileShape,
+                                      accesses.type.getElementType());
+      unsigned level = getAcquireLevel(accesses, tileLoops);
+      auto dims = getTileDimensions(accesses, tileLoops, level);
+      if (dims && !dims->empty() &&
+          targetModel.getTargetArch() == AIEArch::AIE1)
+        dims = std::nullopt;
+      bool hasDims = dims && !dims->empty();
+
+      // The DMAs only walk flat buffers of 32-bit words
+      MemRefType extType = accesses.type;
+      if (hasDims)
+        extType = MemRefType::get(
+            {accesses.type.getNumElements() *
+             accesses.type.getElementTypeBitWidth() / 32},
+            builder.getI32Type());
+      auto extBuffer =
+          builder.create<ExternalBufferOp>(accesses.arg.getLoc(), extType);
+      extBuffer->setAttr(SymbolTable::getSymbolAttrName(),
+                         builder.getStringAttr(name));
+
+      auto fifoType = AIEObjectFifoType::get(elemType);
+      auto depth = builder.getI32IntegerAttr(accesses.depth);
+      ArgFifos argFifos{nullptr, nullptr, elemType, level};
+      auto createFifo = [&](StringRef suffix, TileOp prod, TileOp cons) {
+        auto fifo = builder.create<ObjectFifoCreateOp>(
+            accesses.arg.getLoc(), builder.getStringAttr(name + suffix),
+            prod.getResult(), cons.getResult(), depth, fifoType);
+        builder.create<ObjectFifoRegisterExternalBuffersOp>(
+            accesses.arg.getLoc(),
+            FlatSymbolRefAttr::get(ctx, fifo.getSymName()),
+            shimTile.getResult(), ValueRange{extBuffer.getResult()});
+        if (!dims)
+          fifo.emitRemark("the shim DMA cannot walk the tiles of argument ")
+              << accesses.arg.getArgNumber() << " of " << kernel.getName()
+              << ", the external buffer must hold them in the order the "
+                 "core acquires them";
+        return fifo;
+      };
+      if (accesses.isRead) {
+        argFifos.in = createFifo("_in", shimTile, computeTile);
+        if (hasDims)
+          argFifos.in.setDimensionsToStreamAttr(
+              DimTupleArrayAttr::get(ctx, *dims));
+      }
+      if (accesses.isWrite) {
+        argFifos.out = createFifo("_out", computeTile, shimTile);
+        if (hasDims)
+          argFifos.out.setDimensionsFromStreamAttr(
+              DimTupleArrayAttr::get(ctx, *dims));
+      }
+      fifos.push_back(argFifos);
+    }
+
+    // The core acquires the tile of each argument in the innermost loop
+    // over the tiles it depends on, runs the tile function in the innermost
+    // one and releases the tiles at the end of the loop iterations they were
+    // acquired in.
+    builder.setInsertionPointAfter(tileFunc);
+    Location loc = kernel.getLoc();
+    CoreOp core = builder.create<CoreOp>(loc, builder.getIndexType(),
+                                         computeTile.getResult());
+    core.getBody().push_back(new Block);
+    builder.setInsertionPointToStart(&core.getBody().front());
+
+    SmallVector<Value, 4> callOperands(fifos.size());
+    std::function<void(unsigned)> emitLevel = [&](unsigned level) {
+      auto acquire = [&](ObjectFifoCreateOp fifo, ObjectFifoPort port,
+                         MemRefType elemType) {
+        auto acq = builder.create<ObjectFifoAcquireOp>(
+            loc, AIEObjectFifoSubviewType::get(elemType), port,
+            fifo.getSymName(), 1);
+        return builder
+            .create<ObjectFifoSubviewAccessOp>(loc, elemType, acq.getSubview(),
+                                               builder.getI32IntegerAttr(0))
+            .getOutput();
+      };
+      for (auto [argFifos, operand] : llvm::zip(fifos, callOperands)) {
+        if (argFifos.level != level)
+          continue;
+        if (argFifos.out)
+          operand =
+              acquire(argFifos.out, ObjectFifoPort::Produce, argFifos.elemType);
+        if (argFifos.in) {
+          Value tile =
+              acquire(argFifos.in, ObjectFifoPort::Consume, argFifos.elemType);
+          // An accumulated result starts from its value in the external
+          // memory.
+          if (argFifos.out) {
+            builder.create<memref::CopyOp>(loc, tile, operand);
+            builder.create<ObjectFifoReleaseOp>(loc, ObjectFifoPort::Consume,
+                                                argFifos.in.getSymName(), 1);
+          } else {
+            operand = tile;
+          }
+        }
+      }
+
+      if (level == tileLoops.size()) {
+        builder.create<func::CallOp>(loc, tileFunc, callOperands);
+      } else {
+        unsigned l = tileLoops[level];
+        auto forOp = builder.create<scf::ForOp>(
+            loc, builder.create<arith::ConstantIndexOp>(loc, 0),
+            builder.create<arith::ConstantIndexOp>(loc, trips[l] / tiles[l]),
+            builder.create<arith::ConstantIndexOp>(loc, 1));
+        builder.setInsertionPoint(forOp.getBody()->getTerminator());
+        emitLevel(level + 1);
+        builder.setInsertionPointAfter(forOp);
+      }
+
+      for (auto &argFifos : fifos) {
+        if (argFifos.level != level)
+          continue;
+        if (argFifos.out)
+          builder.create<ObjectFifoReleaseOp>(loc, ObjectFifoPort::Produce,
+                                              argFifos.out.getSymName(), 1);
+        else
+          builder.create<ObjectFifoReleaseOp>(loc, ObjectFifoPort::Consume,
+                                              argFifos.in.getSymName(), 1);
+      }
+    };
+    emitLevel(0);
+    builder.create<EndOp>(loc);
+
+    kernel.erase();
+  }
+};
+
+std::unique_ptr<OperationPass<DeviceOp>>
+xilinx::AIE::createAIETileKernelsPass() {
+  return std::make_unique<AIETileKernelsPass>();
+}
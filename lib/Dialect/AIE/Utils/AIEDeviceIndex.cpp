@@ -0,0 +1,122 @@
+//===- AIEDeviceIndex.cpp ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/AIEDeviceIndex.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+AIEDeviceIndex::AIEDeviceIndex(Operation *op) {
+  DeviceOp device = cast<DeviceOp>(op);
+  const AIETargetModel &targetModel = device.getTargetModel();
+  numCols = targetModel.columns();
+  numRows = targetModel.rows();
+  grid.assign(numCols * numRows, NoSlot);
+  for (Operation &nested : device.getBody()->getOperations())
+    add(&nested);
+}
+
+unsigned AIEDeviceIndex::gridSlot(TileID coords) const {
+  auto [col, row] = coords;
+  if (col < 0 || row < 0 || col >= numCols || row >= numRows)
+    return NoSlot;
+  return col * numRows + row;
+}
+
+AIEDeviceIndex::TileOps &AIEDeviceIndex::getOrCreate(TileID coords) {
+  unsigned cell = gridSlot(coords);
+  if (cell != NoSlot) {
+    if (grid[cell] == NoSlot) {
+      grid[cell] = tiles.size();
+      tiles.emplace_back();
+    }
+    return tiles[grid[cell]];
+  }
+  auto [slot, inserted] = slots.try_emplace(coords, tiles.size());
+  if (inserted)
+    tiles.emplace_back();
+  return tiles[slot->second];
+}
+
+void AIEDeviceIndex::add(Operation *op) {
+  if (auto tile = dyn_cast<TileOp>(op)) {
+    TileOps &ops = getOrCreate(tile.getTileID());
+    if (!ops.tile)
+      order.push_back(tile.getTileID());
+    ops.tile = tile;
+    return;
+  }
+  auto element = dyn_cast<TileElement>(op);
+  if (!element)
+    return;
+  TileOps &ops = getOrCreate(element.getTileID());
+  if (auto core = dyn_cast<CoreOp>(op))
+    ops.core = core;
+  else if (auto mem = dyn_cast<MemOp>(op))
+    ops.mem = mem;
+  else if (auto memTileDMA = dyn_cast<MemTileDMAOp>(op))
+    ops.memTileDMA = memTileDMA;
+  else if (auto shimDMA = dyn_cast<ShimDMAOp>(op))
+    ops.shimDMA = shimDMA;
+  else if (auto switchbox = dyn_cast<SwitchboxOp>(op))
+    ops.switchbox = switchbox;
+  else if (auto shimMux = dyn_cast<ShimMuxOp>(op))
+    ops.shimMux = shimMux;
+  else if (auto buffer = dyn_cast<BufferOp>(op))
+    ops.buffers.push_back(buffer);
+  else if (auto lock = dyn_cast<LockOp>(op))
+    ops.locks.push_back(lock);
+}
+
+const AIEDeviceIndex::TileOps *AIEDeviceIndex::lookup(TileID coords) const {
+  unsigned cell = gridSlot(coords);
+  if (cell != NoSlot)
+    return grid[cell] == NoSlot ? nullptr : &tiles[grid[cell]];
+  auto slot = slots.find(coords);
+  if (slot == slots.end())
+    return nullptr;
+  return &tiles[slot->second];
+}
+
+TileOp AIEDeviceIndex::getTile(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ops->tile : TileOp();
+}
+
+CoreOp AIEDeviceIndex::getCore(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ops->core : CoreOp();
+}
+
+MemOp AIEDeviceIndex::getMem(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ops->mem : MemOp();
+}
+
+SwitchboxOp AIEDeviceIndex::getSwitchbox(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ops->switchbox : SwitchboxOp();
+}
+
+ShimMuxOp AIEDeviceIndex::getShimMux(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ops->shimMux : ShimMuxOp();
+}
+
+ArrayRef<BufferOp> AIEDeviceIndex::getBuffers(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ArrayRef<BufferOp>(ops->buffers) : ArrayRef<BufferOp>();
+}
+
+ArrayRef<LockOp> AIEDeviceIndex::getLocks(TileID coords) const {
+  const TileOps *ops = lookup(coords);
+  return ops ? ArrayRef<LockOp>(ops->locks) : ArrayRef<LockOp>();
+}
@@ -16,80 +16,52 @@
 #include "mlir/Pass/Pass.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/SmallPtrSet.h"
 
 using namespace mlir;
 using namespace xilinx;
 using namespace xilinx::AIE;
 
+// Collect the users of the buffers, the DMA channels of the mems and the
+// lock pairs in one walk of the device, then connect the DMA channels and
+// chain the lock pairs.
 void xilinx::AIE::NetlistAnalysis::runAnalysis() {
+  DenseMap<Value, SmallVector<Operation *, 4>> visitors;
 
-  // Collect op instances
-  collectTiles(tiles);
-  collectCores(cores);
-  collectMems(mems);
-  collectLocks(locks);
-  collectBuffers(buffers);
-  collectSwitchboxes(switchboxes);
-}
-
-void xilinx::AIE::NetlistAnalysis::collectTiles(
-    DenseMap<std::pair<int, int>, Operation *> &tiles) {
-  for (auto tile : device.getOps<TileOp>()) {
-    int colIndex = tile.colIndex();
-    int rowIndex = tile.rowIndex();
-    tiles[std::make_pair(colIndex, rowIndex)] = tile;
-  }
-}
-
-void xilinx::AIE::NetlistAnalysis::collectCores(
-    DenseMap<Operation *, CoreOp> &cores) {
-  for (auto core : device.getOps<CoreOp>()) {
-    Operation *tileOp = core.getTile().getDefiningOp();
-    assert(cores.count(tileOp) == 0 &&
-           "Invalid netlist! Expected 1-1 mapping of tile and core");
-    cores[tileOp] = core;
-  }
-}
-
-void xilinx::AIE::NetlistAnalysis::collectMems(
-    DenseMap<Operation *, MemOp> &mems) {
-  for (auto mem : device.getOps<MemOp>()) {
-    Operation *tileOp = mem.getTile().getDefiningOp();
-    assert(mems.count(tileOp) == 0 &&
-           "Invalid netlist! Expected 1-1 mapping of tile and mem");
-    mems[tileOp] = mem;
-  }
-}
-
-void xilinx::AIE::NetlistAnalysis::collectLocks(
-    DenseMap<std::pair<Operation *, int>, LockOp> &locks) {
-  for (auto lock : device.getOps<LockOp>()) {
-    Operation *tileOp = lock.getTile().getDefiningOp();
-    int lockID = lock.getLockIDValue();
-    assert(locks.count(std::make_pair(tileOp, lockID)) == 0 &&
-           "Invalid netlist! Expected 1-1 mapping of (tile, lockID) and lock");
-    locks[std::make_pair(tileOp, lockID)] = lock;
-  }
-}
-
-void xilinx::AIE::NetlistAnalysis::collectBuffers(
-    DenseMap<Operation *, SmallVector<BufferOp, 4>> &buffers) {
-
-  for (auto buffer : device.getOps<BufferOp>()) {
-    Operation *tileOp = buffer.getTile().getDefiningOp();
-    buffers[tileOp].push_back(buffer);
+  for (Operation &top : device.getBody()->getOperations()) {
+    Operation *user = isa<CoreOp, MemOp>(&top) ? &top : nullptr;
+    MemOp mem = dyn_cast<MemOp>(&top);
+    top.walk([&](Operation *Op) {
+      if (auto op = dyn_cast<UseLockOp>(Op)) {
+        Value lock = op.getLock();
+        if (op.acquire() || op.acquire_ge()) {
+          visitors[lock].push_back(op);
+        } else if (op.release()) {
+          if (!visitors[lock].empty()) {
+            Operation *Op = visitors[lock].pop_back_val();
+            lockPairs[Op] = op;
+          }
+        }
+        return;
+      }
+      if (auto dmaStart = dyn_cast<DMAStartOp>(Op))
+        if (mem && Op->getParentOp() == mem.getOperation())
+          collectDMAChannel(mem, dmaStart);
+      for (Value operand : Op->getOperands()) {
+        BufferOp buf = operand.getDefiningOp<BufferOp>();
+        if (!buf)
+          continue;
+        if (user && Op != user)
+          bufferUsers[buf].push_back(user);
+        for (auto &map : visitors)
+          for (auto acqLock : map.second)
+            bufAcqLocks[buf].push_back(acqLock);
+      }
+    });
   }
-}
 
-void xilinx::AIE::NetlistAnalysis::collectSwitchboxes(
-    DenseMap<Operation *, SwitchboxOp> &switchboxes) {
-
-  for (auto switchbox : device.getOps<SwitchboxOp>()) {
-    Operation *tileOp = switchbox.getTile().getDefiningOp();
-    assert(switchboxes.count(tileOp) == 0 &&
-           "Invalid netlist! Expected 1-1 mapping of tile and switchbox");
-    switchboxes[tileOp] = switchbox;
-  }
+  dmaAnalysis();
+  lockAnalysis();
 }
 
 std::pair<int, int>
@@ -186,68 +158,32 @@ bool xilinx::AIE::NetlistAnalysis::validateCoreOrMemRegion(
   return IsValid;
 }
 
-void xilinx::AIE::NetlistAnalysis::collectBufferUsage() {
-  SmallVector<Operation *, 4> CoreOrMemOps;
-  for (auto map : cores) {
-    CoreOrMemOps.push_back(map.second);
-  }
-
-  for (auto map : mems) {
-    CoreOrMemOps.push_back(map.second);
-  }
-
-  for (auto CoreOrMemOp : CoreOrMemOps) {
-    Region *r = nullptr;
-    if (CoreOp core = dyn_cast<CoreOp>(CoreOrMemOp))
-      r = &core.getBody();
-    else if (MemOp mem = dyn_cast<MemOp>(CoreOrMemOp))
-      r = &mem.getBody();
-
-    assert(r && "Expected non-null region!");
-
-    r->walk([&](Operation *Op) {
-      for (Value operand : Op->getOperands()) {
-        if (BufferOp buf = dyn_cast<BufferOp>(operand.getDefiningOp())) {
-          bufferUsers[buf].push_back(CoreOrMemOp);
-        }
-      }
-    });
-  }
-}
-
-void xilinx::AIE::NetlistAnalysis::collectDMAUsage() {
-  for (auto map : mems) {
-    MemOp mem = map.second;
-    Region &r = mem.getBody();
-    Block *endBlock = &r.back();
-    for (auto op : r.getOps<cf::CondBranchOp>()) {
-      DMAStartOp dmaSt =
-          dyn_cast<DMAStartOp>(op.getCondition().getDefiningOp());
-      xilinx::AIE::DMAChannel dmaChan =
-          std::make_pair(dmaSt.getChannelDir(), dmaSt.getChannelIndex());
-      dmas[std::make_pair(mem, dmaChan)] = dmaSt;
-      Block *firstBd = op.getTrueDest();
-      Block *curBd = firstBd;
-
-      while (curBd != endBlock) {
-        for (auto bdOp : curBd->getOps<DMABDOp>()) {
-          Operation *buf = bdOp.getBuffer().getDefiningOp();
-          if (std::find(dma2BufMap[dmaSt].begin(), dma2BufMap[dmaSt].end(),
-                        buf) != dma2BufMap[dmaSt].end())
-            continue;
-
-          dma2BufMap[dmaSt].push_back(bdOp.getBuffer().getDefiningOp());
-        }
-        curBd = curBd->getSuccessors()[0];
-      }
+// Record the DMA channel of dmaStart in mem and the buffers of its chain of
+// BDs, up to the end of the chain or back to its first BD.
+void xilinx::AIE::NetlistAnalysis::collectDMAChannel(MemOp mem,
+                                                     DMAStartOp dmaSt) {
+  xilinx::AIE::DMAChannel dmaChan =
+      std::make_pair(dmaSt.getChannelDir(), dmaSt.getChannelIndex());
+  dmas[std::make_pair(mem, dmaChan)] = dmaSt;
+  SmallVector<Operation *, 4> &bufs = dma2BufMap[dmaSt];
+  SmallPtrSet<Block *, 8> visited;
+  Block *curBd = dmaSt.getDest();
+  while (visited.insert(curBd).second) {
+    for (auto bdOp : curBd->getOps<DMABDOp>()) {
+      Operation *buf = bdOp.getBuffer().getDefiningOp();
+      if (!llvm::is_contained(bufs, buf))
+        bufs.push_back(buf);
     }
+    if (curBd->getNumSuccessors() != 1)
+      break;
+    curBd = curBd->getSuccessor(0);
   }
 }
 
 uint64_t
 xilinx::AIE::NetlistAnalysis::getMemUsageInBytes(Operation *tileOp) const {
   uint64_t memUsage = 0;
-  for (auto buf : buffers[tileOp]) {
+  for (auto buf : index.getBuffers(getCoord(tileOp))) {
     auto t = buf.getType().cast<ShapedType>();
     memUsage += t.getSizeInBits();
   }
@@ -304,9 +240,9 @@ SmallVector<Operation *, 4> xilinx::AIE::NetlistAnalysis::getNextConnectOps(
   assert((nextCol >= 0 && nextRow >= 0) &&
          "Invalid ConnectOp! Could not find next tile!");
 
-  Operation *nextTileOp = tiles[std::make_pair(nextCol, nextRow)];
-  Operation *nextSwboxOp = switchboxes[nextTileOp];
-  SwitchboxOp nextSwbox = dyn_cast<SwitchboxOp>(nextSwboxOp);
+  SwitchboxOp nextSwbox = index.getSwitchbox({nextCol, nextRow});
+  if (!nextSwbox)
+    return nextConnectOps;
 
   for (auto connect : nextSwbox.getOps<ConnectOp>()) {
     if (connect.getSourceBundle() == nextSrcBundle &&
@@ -369,9 +305,7 @@ xilinx::AIE::NetlistAnalysis::findDestConnectOps(ConnectOp source,
 void xilinx::AIE::NetlistAnalysis::dmaAnalysis() {
   // Source(DMAChannel, <Buffer0, Buffer1, ...>) --> Dest(DMAChannel, <Buffer0,
   // Buffer1, ...>)
-  collectDMAUsage();
-
-  for (auto map : dma2BufMap) {
+  for (auto &map : dma2BufMap) {
     Operation *srcDmaOp = map.first;
     DMAStartOp srcDma = dyn_cast<DMAStartOp>(srcDmaOp);
     if (srcDma.isRecv())
@@ -381,7 +315,10 @@ void xilinx::AIE::NetlistAnalysis::dmaAnalysis() {
 
     Operation *srcMemOp = srcDmaOp->getParentOp();
     MemOp srcMem = dyn_cast<MemOp>(srcMemOp);
-    SwitchboxOp swbox = switchboxes[srcMem.getTile().getDefiningOp()];
+    SwitchboxOp swbox =
+        index.getSwitchbox({srcMem.colIndex(), srcMem.rowIndex()});
+    if (!swbox)
+      continue;
     for (auto connect : swbox.getOps<ConnectOp>()) {
       WireBundle srcBundle = connect.getSourceBundle();
       int srcIndex = connect.sourceIndex();
@@ -395,7 +332,8 @@ void xilinx::AIE::NetlistAnalysis::dmaAnalysis() {
         ConnectOp destConnect = dyn_cast<ConnectOp>(destConnectOp);
         SwitchboxOp destSwbox =
             dyn_cast<SwitchboxOp>(destConnect->getParentOp());
-        Operation *destMemOp = mems[destSwbox.getTile().getDefiningOp()];
+        Operation *destMemOp =
+            index.getMem({destSwbox.colIndex(), destSwbox.rowIndex()});
         xilinx::AIE::DMAChannel dmaChan =
             std::make_pair(DMAChannelDir::S2MM, destConnect.destIndex());
         Operation *destDmaOp = dmas[std::make_pair(destMemOp, dmaChan)];
@@ -406,34 +344,9 @@ void xilinx::AIE::NetlistAnalysis::dmaAnalysis() {
   }
 }
 
+// Chain the release of each lock pair to the acquires of the other pairs of
+// the same value.
 void xilinx::AIE::NetlistAnalysis::lockAnalysis() {
-
-  DenseMap<Value, SmallVector<Operation *, 4>> visitors;
-
-  device.getBodyRegion().walk([&](Operation *Op) {
-    if (auto op = dyn_cast<UseLockOp>(Op)) {
-      Value lock = op.getLock();
-      if (op.acquire() || op.acquire_ge()) {
-        visitors[lock].push_back(op);
-      } else if (op.release()) {
-        if (!visitors[lock].empty()) {
-          Operation *Op = visitors[lock].pop_back_val();
-          lockPairs[Op] = op;
-        }
-      }
-    } else {
-      for (Value operand : Op->getOperands()) {
-        if (BufferOp buf = dyn_cast<BufferOp>(operand.getDefiningOp())) {
-          for (auto map : visitors) {
-            SmallVector<Operation *, 4> acqLocks(map.second);
-            for (auto acqLock : acqLocks)
-              bufAcqLocks[operand.getDefiningOp()].push_back(acqLock);
-          }
-        }
-      }
-    }
-  });
-
   for (auto pair1 : lockPairs) {
     Operation *srcRelLockOp = pair1.second;
     for (auto pair2 : lockPairs) {
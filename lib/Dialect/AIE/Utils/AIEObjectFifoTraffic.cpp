@@ -0,0 +1,71 @@
+//===- AIEObjectFifoTraffic.cpp ---------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIE/AIEObjectFifoTraffic.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+/// Function that returns the number of iterations of forLoop, or 1 if its
+/// bounds are not constants.
+static int64_t getTripCount(scf::ForOp forLoop) {
+  auto lb = getConstantIntValue(forLoop.getLowerBound());
+  auto ub = getConstantIntValue(forLoop.getUpperBound());
+  auto step = getConstantIntValue(forLoop.getStep());
+  if (!lb || !ub || !step || *step <= 0)
+    return 1;
+  if (*ub <= *lb)
+    return 0;
+  return (*ub - *lb + *step - 1) / *step;
+}
+
+AIEObjectFifoTraffic::AIEObjectFifoTraffic(Operation *op) {
+  DeviceOp device = cast<DeviceOp>(op);
+  for (auto core : device.getOps<CoreOp>()) {
+    DenseMap<Operation *, int64_t> released;
+    core.walk([&](ObjectFifoReleaseOp release) {
+      int64_t count = release.relNumber();
+      for (Operation *parent = release->getParentOp(); parent != core;
+           parent = parent->getParentOp())
+        if (auto forLoop = dyn_cast<scf::ForOp>(parent))
+          count *= getTripCount(forLoop);
+      released[release.getObjectFifo()] += count;
+    });
+    // The producer and the consumers of an objectFifo release the same
+    // elements, unless the design deadlocks.
+    for (auto [fifo, count] : released)
+      elements[fifo] = std::max(elements[fifo], count);
+  }
+
+  for (auto link : device.getOps<ObjectFifoLinkOp>()) {
+    int64_t linked = 0;
+    for (auto fifo : link.getInputObjectFifos())
+      linked = std::max(linked, elements.lookup(fifo));
+    for (auto fifo : link.getOutputObjectFifos())
+      linked = std::max(linked, elements.lookup(fifo));
+    for (auto fifo : link.getInputObjectFifos())
+      if (!elements.lookup(fifo))
+        elements[fifo] = linked;
+    for (auto fifo : link.getOutputObjectFifos())
+      if (!elements.lookup(fifo))
+        elements[fifo] = linked;
+  }
+}
+
+int64_t AIEObjectFifoTraffic::getElementBytes(ObjectFifoCreateOp fifo) {
+  auto elemType = fifo.getElemType()
+                      .cast<AIEObjectFifoType>()
+                      .getElementType()
+                      .cast<MemRefType>();
+  return elemType.getNumElements() * elemType.getElementTypeBitWidth() / 8;
+}
@@ -139,14 +139,19 @@ ParseResult UPDOp::parse(OpAsmParser &parser, OperationState &result) {
 
 // Print out Cast op.
 void CastOp::print(OpAsmPrinter &p) {
-  // Print the source accumulator
+  // Print the source accumulator, and the dynamic shift if any
   p << " " << getSource();
+  if (getDynamicShift())
+    p << ", " << getDynamicShift();
 
   // Print the attributes
   p.printOptionalAttrDict((*this)->getAttrs());
 
   // And now print the types
-  p << " : " << getSource().getType() << ", " << getResult().getType();
+  p << " : " << getSource().getType() << ", ";
+  if (getDynamicShift())
+    p << getDynamicShift().getType() << ", ";
+  p << getResult().getType();
 }
 
 // Verify Cast op.
@@ -210,6 +215,9 @@ ParseResult CastOp::parse(OpAsmParser &parser, OperationState &result) {
 
 // SRS fold method. It will fold with a preceding UPS operation.
 OpFoldResult SRSOp::fold(FoldAdaptor adaptor) {
+  // A shift only known at runtime need not undo the one of the UPS
+  if (getDynamicShift())
+    return nullptr;
   auto srcDefOp = getSource().getDefiningOp();
   if (!srcDefOp)
     return nullptr;
@@ -221,14 +229,19 @@ OpFoldResult SRSOp::fold(FoldAdaptor adaptor) {
 
 // Print out SRS op.
 void SRSOp::print(OpAsmPrinter &p) {
-  // Print the source accumulator
+  // Print the source accumulator, and the dynamic shift if any
   p << " " << getSource();
+  if (getDynamicShift())
+    p << ", " << getDynamicShift();
 
   // Print the attributes
   p.printOptionalAttrDict((*this)->getAttrs());
 
   // And now print the types
-  p << " : " << getSource().getType() << ", " << getResult().getType();
+  p << " : " << getSource().getType() << ", ";
+  if (getDynamicShift())
+    p << getDynamicShift().getType() << ", ";
+  p << getResult().getType();
 }
 
 // Verify SRS op.
@@ -268,12 +281,15 @@ LogicalResult SRSOp::verify() {
 // Parse SRS op.
 ParseResult SRSOp::parse(OpAsmParser &parser, OperationState &result) {
   llvm::SMLoc typesLoc;
-  SmallVector<Type, 2> types;
-  OpAsmParser::UnresolvedOperand source;
+  SmallVector<Type, 3> types;
+  OpAsmParser::UnresolvedOperand source, dynamicShift;
 
-  // Parse the source accumulator
+  // Parse the source accumulator, and the dynamic shift if any
   if (parser.parseOperand(source))
     return failure();
+  bool hasDynamicShift = succeeded(parser.parseOptionalComma());
+  if (hasDynamicShift && parser.parseOperand(dynamicShift))
+    return failure();
 
   // Parse all the attributes and types
   if (parser.parseOptionalAttrDict(result.attributes) ||
@@ -283,21 +299,26 @@ ParseResult SRSOp::parse(OpAsmParser &parser, OperationState &result) {
   if (result.attributes.getAttrs().size() != 1)
     return parser.emitError(typesLoc, "requires one attribute");
 
-  // Assert that there are two types (accumulator source and vector result)
-  if (types.size() != 2)
-    return parser.emitError(typesLoc, "requires two types");
+  // Assert that there are two types (accumulator source and vector result),
+  // or three with the type of the dynamic shift in between
+  if (types.size() != (hasDynamicShift ? 3 : 2))
+    return parser.emitError(typesLoc, hasDynamicShift ? "requires three types"
+                                                      : "requires two types");
 
   // Some verification of types
   VectorType accType = types[0].dyn_cast<VectorType>();
   if (!accType)
     return parser.emitError(typesLoc, "requires vector type");
-  VectorType vectorType = types[1].dyn_cast<VectorType>();
+  VectorType vectorType = types.back().dyn_cast<VectorType>();
   if (!vectorType)
     return parser.emitError(typesLoc, "requires vector type");
 
-  // Populate the source in result
+  // Populate the source, and the dynamic shift, in result
   if (parser.resolveOperand(source, accType, result.operands))
     return failure();
+  if (hasDynamicShift &&
+      parser.resolveOperand(dynamicShift, types[1], result.operands))
+    return failure();
 
   return parser.addTypeToList(vectorType, result.types);
 }
@@ -1798,5 +1819,38 @@ ParseResult FMAConvOp::parse(OpAsmParser &parser, OperationState &result) {
   return parseMulFMAConvOp(parser, result, true);
 }
 
+//===----------------------------------------------------------------------===//
+// MatMulOp
+//===----------------------------------------------------------------------===//
+
+// Verify MatMul op.
+LogicalResult MatMulOp::verify() {
+  VectorType lhsType = getLhs().getType().cast<VectorType>();
+  VectorType rhsType = getRhs().getType().cast<VectorType>();
+  VectorType accType = getAcc().getType().cast<VectorType>();
+  if (lhsType.getRank() != 1 || rhsType.getRank() != 1 ||
+      accType.getRank() != 1)
+    return emitError("requires 1D vector types");
+
+  auto shape =
+      getAIEMLMatMulShape(lhsType.getElementType(), rhsType.getElementType(),
+                          accType.getElementType());
+  if (!shape)
+    return emitError("unsupported element types of lhs, rhs and accumulator");
+
+  auto [M, K, N] = *shape;
+  if (getM() != M || getK() != K || getN() != N)
+    return emitError("the shape of the matrix multiplication must be ")
+           << M << "x" << K << "x" << N << " for these element types";
+
+  if (lhsType.getNumElements() != M * K ||
+      rhsType.getNumElements() != K * N ||
+      accType.getNumElements() != M * N)
+    return emitError("The number of lanes of lhs, rhs and accumulator must be "
+                     "M*K, K*N and M*N");
+
+  return success();
+}
+
 #define GET_OP_CLASSES
 #include "aie/Dialect/AIEVec/IR/AIEVecOps.cpp.inc"
@@ -0,0 +1,313 @@
+//===- AIEVecFuseLoops.cpp - Fuse the loops of reduction kernels -*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the fusion of consecutive affine.for loops running over
+// the same iterations, like the exp and sum loops of a softmax or the sum and
+// sum of squares loops of a layernorm. The values the first loop stores and
+// the second one loads back in the same iteration are forwarded, so that they
+// stay in registers instead of going through the local memory.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/Transforms/Passes.h"
+#include "mlir/Dialect/Affine/IR/AffineOps.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Vector/IR/VectorOps.h"
+#include "mlir/IR/Dominance.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "llvm/Support/Debug.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::aievec;
+
+#define DEBUG_TYPE "aievec-fuse-loops"
+
+namespace {
+
+// A load or a store of an affine.for body: the element or vector of memref
+// at map(indices).
+struct MemAccess {
+  Operation *op;
+  Value memref;
+  AffineMap map;
+  SmallVector<Value, 4> indices;
+  Type type;
+  bool isWrite;
+};
+
+} // namespace
+
+/// Function that returns the access of op, if op is an affine load or store
+/// or a vector transfer without a mask.
+static std::optional<MemAccess> getMemAccess(Operation *op) {
+  if (auto read = dyn_cast<AffineReadOpInterface>(op))
+    return MemAccess{op,
+                     read.getMemRef(),
+                     read.getAffineMap(),
+                     SmallVector<Value, 4>(read.getMapOperands()),
+                     op->getResult(0).getType(),
+                     false};
+  if (auto write = dyn_cast<AffineWriteOpInterface>(op))
+    return MemAccess{op,
+                     write.getMemRef(),
+                     write.getAffineMap(),
+                     SmallVector<Value, 4>(write.getMapOperands()),
+                     write.getValueToStore().getType(),
+                     true};
+  if (auto read = dyn_cast<vector::TransferReadOp>(op)) {
+    if (read.getMask() || !read.getPermutationMap().isMinorIdentity())
+      return std::nullopt;
+    return MemAccess{
+        op,
+        read.getSource(),
+        AffineMap::getMultiDimIdentityMap(read.getIndices().size(),
+                                          op->getContext()),
+        SmallVector<Value, 4>(read.getIndices()),
+        read.getVectorType(),
+        false};
+  }
+  if (auto write = dyn_cast<vector::TransferWriteOp>(op)) {
+    if (write.getMask() || !write.getPermutationMap().isMinorIdentity())
+      return std::nullopt;
+    return MemAccess{
+        op,
+        write.getSource(),
+        AffineMap::getMultiDimIdentityMap(write.getIndices().size(),
+                                          op->getContext()),
+        SmallVector<Value, 4>(write.getIndices()),
+        write.getVectorType(),
+        true};
+  }
+  return std::nullopt;
+}
+
+/// Function that returns true if a, in iteration iv1 of a loop, and b, in
+/// iteration iv2 of another one, hold the same value when iv1 == iv2.
+static bool isEquivalent(Value a, Value b, Value iv1, Value iv2) {
+  if (a == iv1 && b == iv2)
+    return true;
+  if (a == b)
+    return a != iv1 && b != iv2;
+  auto applyA = a.getDefiningOp<AffineApplyOp>();
+  auto applyB = b.getDefiningOp<AffineApplyOp>();
+  if (!applyA || !applyB || applyA.getAffineMap() != applyB.getAffineMap())
+    return false;
+  return llvm::all_of(
+      llvm::zip(applyA.getMapOperands(), applyB.getMapOperands()),
+      [&](auto operands) {
+        return isEquivalent(std::get<0>(operands), std::get<1>(operands), iv1,
+                            iv2);
+      });
+}
+
+/// Function that returns true if a and b access the same elements when iv1 ==
+/// iv2.
+static bool isSameAccess(const MemAccess &a, const MemAccess &b, Value iv1,
+                         Value iv2) {
+  return a.memref == b.memref && a.type == b.type && a.map == b.map &&
+         a.indices.size() == b.indices.size() &&
+         llvm::all_of(llvm::zip(a.indices, b.indices), [&](auto indices) {
+           return isEquivalent(std::get<0>(indices), std::get<1>(indices), iv1,
+                               iv2);
+         });
+}
+
+/// Function that returns true if the elements access touches in the
+/// iterations of forOp do not overlap: its innermost index is the induction
+/// variable, stepping over at least the size of what is accessed.
+static bool isDisjointAcrossIterations(const MemAccess &access,
+                                       AffineForOp forOp) {
+  if (access.map.getNumResults() == 0)
+    return false;
+  auto dim = access.map.getResults().back().dyn_cast<AffineDimExpr>();
+  if (!dim || access.indices[dim.getPosition()] != forOp.getInductionVar())
+    return false;
+  int64_t size = 1;
+  if (auto vecType = dyn_cast<VectorType>(access.type))
+    size = vecType.getShape().back();
+  return forOp.getStep() >= size;
+}
+
+/// Function that collects the memory accesses of the body of forOp. Returns
+/// false if the body has nested regions or other operations with side
+/// effects.
+static bool getBodyAccesses(AffineForOp forOp,
+                            SmallVectorImpl<MemAccess> &accesses) {
+  for (Operation &op : forOp.getBody()->without_terminator()) {
+    if (op.getNumRegions() > 0)
+      return false;
+    if (auto access = getMemAccess(&op)) {
+      accesses.push_back(*access);
+      continue;
+    }
+    if (!isMemoryEffectFree(&op))
+      return false;
+  }
+  return true;
+}
+
+/// Function that returns true if second can run interleaved with first, one
+/// iteration of second after each iteration of first.
+static bool canFuse(AffineForOp first, AffineForOp second,
+                    DominanceInfo &domInfo) {
+  if (!first.hasConstantBounds() || !second.hasConstantBounds() ||
+      first.getConstantLowerBound() != second.getConstantLowerBound() ||
+      first.getConstantUpperBound() != second.getConstantUpperBound() ||
+      first.getStep() != second.getStep())
+    return false;
+
+  // The operations in between stay after the fused loop, second moves before
+  // them.
+  for (Operation *op = first->getNextNode(); op != second;
+       op = op->getNextNode())
+    if (!isMemoryEffectFree(op))
+      return false;
+  bool dominates = true;
+  second.walk([&](Operation *op) {
+    for (Value operand : op->getOperands())
+      if (!second->isAncestor(operand.getParentBlock()->getParentOp()) &&
+          !domInfo.properlyDominates(operand, first))
+        dominates = false;
+  });
+  if (!dominates)
+    return false;
+
+  SmallVector<MemAccess, 8> firstAccesses, secondAccesses;
+  if (!getBodyAccesses(first, firstAccesses) ||
+      !getBodyAccesses(second, secondAccesses))
+    return false;
+
+  // An element written by one loop and accessed by the other one must be
+  // accessed in the same iteration by both, and only in this iteration.
+  Value iv1 = first.getInductionVar(), iv2 = second.getInductionVar();
+  for (auto &a : firstAccesses)
+    for (auto &b : secondAccesses) {
+      if (a.memref != b.memref || (!a.isWrite && !b.isWrite))
+        continue;
+      if (!isSameAccess(a, b, iv1, iv2) ||
+          !isDisjointAcrossIterations(a, first)) {
+        LLVM_DEBUG(llvm::dbgs() << "Cannot fuse because of " << *a.op
+                                << " and " << *b.op << "\n");
+        return false;
+      }
+    }
+  return true;
+}
+
+/// Function that replaces first and second by a single loop running the body
+/// of second after the body of first, and returns it.
+static AffineForOp fuseLoops(AffineForOp first, AffineForOp second) {
+  unsigned numFirstResults = first.getNumResults();
+  SmallVector<Value, 4> inits(first.getIterOperands());
+  inits.append(second.getIterOperands().begin(),
+               second.getIterOperands().end());
+
+  OpBuilder builder(first);
+  auto fused = builder.create<AffineForOp>(
+      first.getLoc(), first.getLowerBoundOperands(), first.getLowerBoundMap(),
+      first.getUpperBoundOperands(), first.getUpperBoundMap(),
+      first.getStep(), inits,
+      [&](OpBuilder &b, Location loc, Value iv, ValueRange args) {
+        IRMapping mapping;
+        SmallVector<Value, 4> yields;
+        auto cloneBody = [&](AffineForOp forOp, ValueRange iterArgs) {
+          mapping.map(forOp.getInductionVar(), iv);
+          mapping.map(forOp.getRegionIterArgs(), iterArgs);
+          for (Operation &op : forOp.getBody()->without_terminator())
+            b.clone(op, mapping);
+          for (Value yield : forOp.getBody()->getTerminator()->getOperands())
+            yields.push_back(mapping.lookupOrDefault(yield));
+        };
+        cloneBody(first, args.take_front(numFirstResults));
+        cloneBody(second, args.drop_front(numFirstResults));
+        b.create<AffineYieldOp>(loc, yields);
+      });
+
+  first->replaceAllUsesWith(fused.getResults().take_front(numFirstResults));
+  second->replaceAllUsesWith(fused.getResults().drop_front(numFirstResults));
+  first.erase();
+  second.erase();
+  return fused;
+}
+
+/// Function that replaces the loads of the body of forOp by the value stored
+/// to the same place earlier in the same iteration.
+static void forwardStores(AffineForOp forOp) {
+  DenseMap<Value, MemAccess> lastWrites;
+  Value iv = forOp.getInductionVar();
+  for (Operation &op :
+       llvm::make_early_inc_range(forOp.getBody()->without_terminator())) {
+    auto access = getMemAccess(&op);
+    if (!access)
+      continue;
+    if (access->isWrite) {
+      lastWrites.erase(access->memref);
+      lastWrites.insert({access->memref, *access});
+      continue;
+    }
+    auto it = lastWrites.find(access->memref);
+    if (it == lastWrites.end() || !isSameAccess(it->second, *access, iv, iv))
+      continue;
+    Operation *write = it->second.op;
+    Value stored;
+    if (auto transfer = dyn_cast<vector::TransferWriteOp>(write)) {
+      auto read = dyn_cast<vector::TransferReadOp>(op);
+      if (!read || read.getInBoundsAttr() != transfer.getInBoundsAttr())
+        continue;
+      stored = transfer.getVector();
+    } else {
+      if (!isa<AffineReadOpInterface>(op))
+        continue;
+      stored = cast<AffineWriteOpInterface>(write).getValueToStore();
+    }
+    LLVM_DEBUG(llvm::dbgs() << "Forwarding " << stored << " to " << op
+                            << "\n");
+    op.getResult(0).replaceAllUsesWith(stored);
+    op.erase();
+  }
+}
+
+struct AIEVecFuseLoopsPass : public AIEVecFuseLoopsBase<AIEVecFuseLoopsPass> {
+  void runOnOperation() override {
+    func::FuncOp func = getOperation();
+
+    SmallVector<Block *, 8> blocks;
+    // The nested blocks come first, so that the blocks of the loops erased by
+    // the fusion are already done.
+    func.walk<WalkOrder::PostOrder>(
+        [&](Block *block) { blocks.push_back(block); });
+    for (Block *block : blocks) {
+      for (auto it = block->begin(); it != block->end(); ++it) {
+        auto first = dyn_cast<AffineForOp>(*it);
+        if (!first)
+          continue;
+        // Fuse first with the next loops for as long as possible.
+        while (true) {
+          Operation *next = first->getNextNode();
+          while (next && !isa<AffineForOp>(next) && isMemoryEffectFree(next))
+            next = next->getNextNode();
+          auto second = dyn_cast_or_null<AffineForOp>(next);
+          DominanceInfo domInfo(func);
+          if (!second || !canFuse(first, second, domInfo))
+            break;
+          LLVM_DEBUG(llvm::dbgs() << "Fusing " << second << " into " << first
+                                  << "\n");
+          first = fuseLoops(first, second);
+          forwardStores(first);
+        }
+        it = first->getIterator();
+      }
+    }
+  }
+};
+
+std::unique_ptr<Pass> xilinx::aievec::createAIEVecFuseLoopsPass() {
+  return std::make_unique<AIEVecFuseLoopsPass>();
+}
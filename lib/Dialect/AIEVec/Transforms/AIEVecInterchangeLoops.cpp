@@ -0,0 +1,140 @@
+//===- AIEVecInterchangeLoops.cpp - Interchange loop nests ------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the interchange of perfectly nested affine.for loops
+// that moves the loop to vectorize innermost: the loop without loop-carried
+// dependences along which most of the memory accesses are contiguous. The
+// affine super-vectorizer and aie-vectorize vectorize the innermost loop of
+// the nests.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/Transforms/Passes.h"
+#include "mlir/Dialect/Affine/Analysis/AffineAnalysis.h"
+#include "mlir/Dialect/Affine/Analysis/Utils.h"
+#include "mlir/Dialect/Affine/IR/AffineOps.h"
+#include "mlir/Dialect/Affine/IR/AffineValueMap.h"
+#include "mlir/Dialect/Affine/LoopUtils.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "llvm/Support/Debug.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::aievec;
+
+#define DEBUG_TYPE "aievec-interchange-loops"
+
+/// Function that returns true if expr, over the dims of an access map, moves
+/// by one element when dim pos moves by one.
+static bool hasUnitStride(AffineExpr expr, unsigned pos) {
+  if (auto dim = expr.dyn_cast<AffineDimExpr>())
+    return dim.getPosition() == pos;
+  auto add = expr.dyn_cast<AffineBinaryOpExpr>();
+  if (!add || add.getKind() != AffineExprKind::Add)
+    return false;
+  AffineExpr lhs = add.getLHS(), rhs = add.getRHS();
+  if (hasUnitStride(lhs, pos))
+    return !rhs.isFunctionOfDim(pos);
+  if (hasUnitStride(rhs, pos))
+    return !lhs.isFunctionOfDim(pos);
+  return false;
+}
+
+/// Function that returns true if the memory access op touches contiguous
+/// elements in the consecutive iterations of forOp: only its innermost index
+/// depends on the induction variable, with a unit stride.
+static bool isContiguousAccess(Operation *op, AffineForOp forOp) {
+  MemRefAccess access(op);
+  AffineValueMap map;
+  access.getAccessMap(&map);
+  if (map.getNumResults() == 0)
+    return false;
+  Value iv = forOp.getInductionVar();
+  unsigned last = map.getNumResults() - 1;
+  for (unsigned i = 0; i < last; ++i)
+    if (map.isFunctionOf(i, iv))
+      return false;
+  for (unsigned pos = 0, e = map.getNumDims(); pos < e; ++pos)
+    if (map.getOperand(pos) == iv)
+      return hasUnitStride(map.getResult(last), pos);
+  return false;
+}
+
+/// Function that interchanges the perfect nest of loops so that the loop to
+/// vectorize is innermost. Returns true if the nest was interchanged.
+static bool interchangeNest(MutableArrayRef<AffineForOp> loops) {
+  SmallVector<Operation *, 8> accesses;
+  loops.back().walk([&](Operation *op) {
+    if (isa<AffineReadOpInterface, AffineWriteOpInterface>(op))
+      accesses.push_back(op);
+  });
+
+  // The loops to vectorize must be parallel. The innermost loop wins the
+  // ties, so that a nest which can already be vectorized is left alone.
+  std::optional<unsigned> best;
+  unsigned bestCount = 0;
+  for (unsigned i = 0, e = loops.size(); i < e; ++i) {
+    if (!isLoopParallel(loops[i])) {
+      LLVM_DEBUG(llvm::dbgs() << "Loop " << i << " of the nest at "
+                              << loops.front().getLoc()
+                              << " has loop-carried dependences\n");
+      continue;
+    }
+    unsigned count = llvm::count_if(accesses, [&](Operation *op) {
+      return isContiguousAccess(op, loops[i]);
+    });
+    if (!best || count >= bestCount) {
+      best = i;
+      bestCount = count;
+    }
+  }
+  if (!best || *best == loops.size() - 1 || bestCount == 0)
+    return false;
+
+  // loops[*best] becomes innermost, the loops after it move out by one.
+  SmallVector<unsigned, 4> permutation;
+  for (unsigned i = 0, e = loops.size(); i < e; ++i)
+    permutation.push_back(i < *best ? i : i == *best ? e - 1 : i - 1);
+  if (!isValidLoopInterchangePermutation(loops, permutation))
+    return false;
+  LLVM_DEBUG(llvm::dbgs() << "Moving loop " << *best << " of the nest at "
+                          << loops.front().getLoc() << " innermost\n");
+  permuteLoops(loops, permutation);
+  return true;
+}
+
+struct AIEVecInterchangeLoopsPass
+    : public AIEVecInterchangeLoopsBase<AIEVecInterchangeLoopsPass> {
+  void runOnOperation() override {
+    func::FuncOp func = getOperation();
+
+    // The outermost loops of the perfect nests: the loops which are not the
+    // only operation of the body of another loop.
+    SmallVector<AffineForOp, 4> roots;
+    func.walk([&](AffineForOp forOp) {
+      auto parent = dyn_cast<AffineForOp>(forOp->getParentOp());
+      if (!parent || !llvm::hasSingleElement(
+                         parent.getBody()->without_terminator()))
+        roots.push_back(forOp);
+    });
+
+    for (AffineForOp root : roots) {
+      SmallVector<AffineForOp, 4> loops;
+      getPerfectlyNestedLoops(loops, root);
+      if (loops.size() < 2 || llvm::any_of(loops, [](AffineForOp forOp) {
+            return forOp.getNumIterOperands() > 0;
+          }))
+        continue;
+      interchangeNest(loops);
+    }
+  }
+};
+
+std::unique_ptr<Pass> xilinx::aievec::createAIEVecInterchangeLoopsPass() {
+  return std::make_unique<AIEVecInterchangeLoopsPass>();
+}
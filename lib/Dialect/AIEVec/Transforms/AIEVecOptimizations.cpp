@@ -24,6 +24,9 @@
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "mlir/Transforms/Passes.h"
+#include "llvm/Support/Debug.h"
+
+#include <optional>
 
 #include "AIEVecOptimizations.h"
 #include "FoldMulAddChainToConvOp.h"
@@ -73,98 +76,135 @@ static bool canFoldAIEShiftAndBroadcast(aievec::BroadcastOp op,
   return true;
 }
 
-template <typename AIEv1MACLikeOp,
-          typename = std::enable_if_t<
-              std::is_same_v<AIEv1MACLikeOp, aievec::FMAOp> ||
-              std::is_same_v<AIEv1MACLikeOp, aievec::FMAOp::Adaptor>>>
-static bool isSingleColumnInt16VectorTimesScalarMac(AIEv1MACLikeOp fmaOp) {
-  // lhs is a 32xi16 vector
-  VectorType lhsVTy = cast<VectorType>(fmaOp.getLhs().getType());
-  auto intTy = dyn_cast<IntegerType>(lhsVTy.getElementType());
-  if (!intTy || intTy.getWidth() != 16)
-    return false;
-  if (lhsVTy.getShape()[0] != 32)
-    return false;
-  // Attributes match a Vector x Scalar mac
-  if (fmaOp.getXoffsets() != "0x73727170" ||
-      fmaOp.getXoffsetsHi() != "0x77767574" || fmaOp.getXstart() != "0" ||
-      fmaOp.getXsquare() != "0x3120" || fmaOp.getZoffsets() != "0" ||
-      fmaOp.getZoffsetsHi() != "0" || fmaOp.getZstep() != "1")
-    return false;
-  // lhs op is a concat of a vector and a dense<0> constant vector
-  if (!fmaOp.getLhs().getDefiningOp())
-    return false;
-  aievec::ConcatOp concatOp =
-      dyn_cast<aievec::ConcatOp>(fmaOp.getLhs().getDefiningOp());
-  if (!concatOp)
-    return false;
-  auto tailVec = concatOp.getSources()[1];
-  if (!tailVec.getDefiningOp())
-    return false;
-  auto constOp = dyn_cast<arith::ConstantOp>(tailVec.getDefiningOp());
-  if (!constOp)
+/// Function that returns the number of columns of the AIE1 vector times
+/// scalar MACs on xbuff elements of type elemTy: each lane sums the products
+/// of one xbuff element per column by the zbuff elements zstart, zstart +
+/// zstep, and so on.
+static unsigned getNumMacColumns(Type elemTy) {
+  auto intTy = dyn_cast<IntegerType>(elemTy);
+  if (intTy && intTy.getWidth() == 16)
+    return 2;
+  // The 32-bit MACs, integer and floating point, have a single column.
+  return 1;
+}
+
+/// Function that returns the zstart of fmaOp if it is a multi-column vector
+/// times scalar MAC of which only the first column holds data: its xbuff and
+/// zbuff attributes are the ones of a splat, and its lhs concatenates a
+/// vector with a zero vector per other column.
+static std::optional<unsigned> getSingleColumnMacZstart(aievec::FMAOp fmaOp) {
+  VectorType lhsVTy = fmaOp.getLhs().getType();
+  unsigned columns = getNumMacColumns(lhsVTy.getElementType());
+  if (columns < 2)
+    return std::nullopt;
+  unsigned zstart;
+  if (fmaOp.getZstart().getAsInteger(10, zstart))
+    return std::nullopt;
+  for (NamedAttribute attr : buildFMAOpSplatAttrForElemTy(fmaOp, zstart))
+    if (fmaOp->getAttr(attr.getName()) != attr.getValue())
+      return std::nullopt;
+
+  auto concatOp = fmaOp.getLhs().getDefiningOp<aievec::ConcatOp>();
+  if (!concatOp || concatOp.getSources().size() != columns)
+    return std::nullopt;
+  for (Value tailVec : concatOp.getSources().drop_front()) {
+    auto constOp = tailVec.getDefiningOp<arith::ConstantOp>();
+    if (!constOp)
+      return std::nullopt;
+    auto cstDense = dyn_cast<DenseIntElementsAttr>(constOp.getValue());
+    if (!cstDense ||
+        !llvm::all_of(cstDense, [](const APInt &val) { return val == 0; }))
+      return std::nullopt;
+  }
+  return zstart;
+}
+
+/// Function that returns the single-column MAC fmaOp accumulates on, if it
+/// can share a multi-column MAC with fmaOp: both multiply by the same zbuff,
+/// and fmaOp is the only user of its result, which is then not needed.
+static aievec::FMAOp getMergeableAccMac(aievec::FMAOp fmaOp) {
+  auto accFmaOp = fmaOp.getAcc().getDefiningOp<aievec::FMAOp>();
+  if (!accFmaOp || !accFmaOp->hasOneUse() ||
+      accFmaOp.getRhs() != fmaOp.getRhs() ||
+      accFmaOp.getLhs().getType() != fmaOp.getLhs().getType() ||
+      accFmaOp.getFmsub() != fmaOp.getFmsub() ||
+      !getSingleColumnMacZstart(accFmaOp))
+    return nullptr;
+  return accFmaOp;
+}
+
+/// Function that returns the position of the single-column MAC fmaOp in the
+/// chain of the mergeable MACs it accumulates on.
+static unsigned getSingleColumnMacChainIndex(aievec::FMAOp fmaOp) {
+  unsigned index = 0;
+  for (auto accFmaOp = getMergeableAccMac(fmaOp); accFmaOp;
+       accFmaOp = getMergeableAccMac(accFmaOp))
+    index++;
+  return index;
+}
+
+/// Function that fills group with the single-column MACs merged into one
+/// with fmaOp, as many as the MAC has columns, in the order of the zbuff
+/// elements they multiply by, and returns true if fmaOp ends such a group.
+/// A chain is split into groups from its first MAC, and the zbuff elements
+/// of a group must be evenly spaced.
+static bool getSingleColumnMacGroup(
+    aievec::FMAOp fmaOp,
+    SmallVectorImpl<std::pair<unsigned, aievec::FMAOp>> &group) {
+  if (!getSingleColumnMacZstart(fmaOp))
     return false;
-  auto cstDense = dyn_cast<DenseIntElementsAttr>(constOp.getValue());
-  if (!cstDense)
+  unsigned columns =
+      getNumMacColumns(fmaOp.getLhs().getType().getElementType());
+  if (getSingleColumnMacChainIndex(fmaOp) % columns != columns - 1)
     return false;
-  return llvm::all_of(cstDense, [](const APInt &val) { return val == 0; });
+  for (auto op = fmaOp; group.size() < columns; op = getMergeableAccMac(op))
+    group.push_back({*getSingleColumnMacZstart(op), op});
+  llvm::stable_sort(group, llvm::less_first());
+  for (unsigned i = 2; i < columns; i++)
+    if (group[i].first - group[i - 1].first != group[1].first - group[0].first)
+      return false;
+  return true;
 }
 
 static bool singleColumnFMAOpCanFold(aievec::FMAOp fmaOp) {
-  auto accProdOp = fmaOp.getAcc().getDefiningOp();
-  if (!accProdOp)
-    return false;
-  auto accFmaOp = dyn_cast<aievec::FMAOp>(accProdOp);
-  if (!accFmaOp)
-    return false;
-  if (!isSingleColumnInt16VectorTimesScalarMac(accFmaOp))
-    return false;
-  return fmaOp.getRhs() == accFmaOp.getRhs() &&
-         !singleColumnFMAOpCanFold(accFmaOp);
+  SmallVector<std::pair<unsigned, aievec::FMAOp>, 4> group;
+  return getSingleColumnMacGroup(fmaOp, group);
 }
 
 //===----------------------------------------------------------------------===//
 // Lowering patterns
 //===----------------------------------------------------------------------===//
-struct MergeSingleColumnI16FMAOpPattern
+struct MergeSingleColumnFMAOpPattern
     : public OpConversionPattern<aievec::FMAOp> {
   using OpConversionPattern<aievec::FMAOp>::OpConversionPattern;
 
   LogicalResult
   matchAndRewrite(aievec::FMAOp fmaOp, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
-    if (!isSingleColumnInt16VectorTimesScalarMac(adaptor))
-      return failure();
-    auto accProdOp = adaptor.getAcc().getDefiningOp();
-    if (!accProdOp)
-      return failure();
-    auto accFmaOp = dyn_cast<aievec::FMAOp>(accProdOp);
-    if (!accFmaOp)
-      return failure();
-    if (!isSingleColumnInt16VectorTimesScalarMac(accFmaOp))
-      return failure();
-    if (adaptor.getRhs() != accFmaOp.getRhs())
+    SmallVector<std::pair<unsigned, aievec::FMAOp>, 4> group;
+    if (!getSingleColumnMacGroup(fmaOp, group))
       return failure();
-    auto accConcatOp =
-        cast<aievec::ConcatOp>(accFmaOp.getLhs().getDefiningOp());
-    auto fmaConcatOp = cast<aievec::ConcatOp>(adaptor.getLhs().getDefiningOp());
-    unsigned fmaZstart, accFmaZstart;
-    if (adaptor.getZstart().getAsInteger(10, fmaZstart) ||
-        accFmaOp.getZstart().getAsInteger(10, accFmaZstart))
-      return failure();
-    auto start = std::min(fmaZstart, accFmaZstart);
-    auto step = std::max(fmaZstart, accFmaZstart) - start;
-    auto lowV = accConcatOp.getSources()[0];
-    auto hiV = fmaConcatOp.getSources()[0];
-    if (accFmaZstart > fmaZstart)
-      std::swap(lowV, hiV);
+
+    // The first MAC of the chain of the group accumulates on the previous
+    // group, if any.
+    aievec::FMAOp first = fmaOp;
+    for (unsigned i = 1; i < group.size(); i++)
+      first = getMergeableAccMac(first);
+    SmallVector<Value, 4> columnVecs;
+    for (auto &[zstart, op] : group) {
+      auto concatOp = op.getLhs().getDefiningOp<aievec::ConcatOp>();
+      columnVecs.push_back(
+          rewriter.getRemappedValue(concatOp.getSources()[0]));
+    }
+    unsigned start = group[0].first;
+    unsigned step = group[1].first - start;
     auto newConcatOp = rewriter.create<aievec::ConcatOp>(
-        fmaOp.getLoc(), adaptor.getLhs().getType(),
-        SmallVector<Value, 2>({lowV, hiV}));
+        fmaOp.getLoc(), adaptor.getLhs().getType(), columnVecs);
     auto newFmaOpAttr = buildFMAOpSplatAttrForElemTy(fmaOp, start, step);
     rewriter.replaceOpWithNewOp<aievec::FMAOp>(
         fmaOp, TypeRange({fmaOp.getResult().getType()}),
-        ValueRange({newConcatOp, adaptor.getRhs(), accFmaOp.getAcc()}),
+        ValueRange({newConcatOp, adaptor.getRhs(),
+                    rewriter.getRemappedValue(first.getAcc())}),
         newFmaOpAttr);
     return success();
   }
@@ -198,7 +238,7 @@ struct FoldAIEShiftAndBroadcast
 //===----------------------------------------------------------------------===//
 static void
 populateAIEVecV1TransformationPatterns(RewritePatternSet &patterns) {
-  patterns.add<MergeSingleColumnI16FMAOpPattern>(patterns.getContext());
+  patterns.add<MergeSingleColumnFMAOpPattern>(patterns.getContext());
 }
 
 static void
@@ -213,11 +253,8 @@ populateAIEVecV2TransformationPatterns(RewritePatternSet &patterns) {
 static void
 configureAIEVecV1TransformationLegalizations(ConversionTarget &target) {
   target.addLegalDialect<aievec::AIEVecDialect>();
-  target.addDynamicallyLegalOp<aievec::FMAOp>([](aievec::FMAOp fmaOp) {
-    if (isSingleColumnInt16VectorTimesScalarMac(fmaOp))
-      return !singleColumnFMAOpCanFold(fmaOp);
-    return true;
-  });
+  target.addDynamicallyLegalOp<aievec::FMAOp>(
+      [](aievec::FMAOp fmaOp) { return !singleColumnFMAOpCanFold(fmaOp); });
 }
 
 static void
@@ -374,6 +411,88 @@ createAIEVecConvOpTransformationPass(const OptimizeAIEVecOptions &options) {
   return std::make_unique<AIEVecConvOpTransformationPass>(options);
 }
 
+// Function that keeps the iter_arg of forOp at index idx in an accumulator
+// register, if the loop body only moves it to an accumulator with an UPS op
+// and yields it back with an SRS op of the same shift: the UPS op moves to
+// the initial value, before the loop, and the SRS op to the result, after the
+// loop. This saves an SRS and an UPS per iteration of a reduction, and the
+// bits the SRS op would drop at each iteration.
+static bool keepIterArgInAccumulator(Operation *forOp, unsigned idx) {
+  Block &body = forOp->getRegion(0).front();
+  BlockArgument iterArg = body.getArgument(idx + 1);
+  if (!iterArg.hasOneUse())
+    return false;
+  auto upsOp = dyn_cast<aievec::UPSOp>(*iterArg.getUsers().begin());
+  if (!upsOp || upsOp->getBlock() != &body)
+    return false;
+  OpOperand &yielded = body.getTerminator()->getOpOperand(idx);
+  auto srsOp = yielded.get().getDefiningOp<aievec::SRSOp>();
+  if (!srsOp || srsOp->getBlock() != &body || srsOp.getDynamicShift() ||
+      srsOp.getShift() != upsOp.getShift() ||
+      srsOp.getSource().getType() != upsOp.getResult().getType())
+    return false;
+
+  LLVM_DEBUG(llvm::dbgs() << "Keeping iter_arg " << idx << " of " << *forOp
+                          << " in an accumulator\n");
+  Type accType = upsOp.getResult().getType();
+  int8_t shift = upsOp.getShift();
+  Location srsLoc = srsOp.getLoc();
+  unsigned numInits = forOp->getNumResults();
+  OpOperand &init =
+      forOp->getOpOperand(forOp->getNumOperands() - numInits + idx);
+  OpBuilder builder(forOp);
+  auto initUps = builder.create<aievec::UPSOp>(upsOp.getLoc(), accType,
+                                               init.get(), shift);
+  init.set(initUps.getResult());
+
+  iterArg.setType(accType);
+  upsOp.getResult().replaceAllUsesWith(iterArg);
+  upsOp.erase();
+
+  yielded.set(srsOp.getSource());
+  if (srsOp->use_empty())
+    srsOp.erase();
+
+  Value result = forOp->getResult(idx);
+  Type vecType = result.getType();
+  result.setType(accType);
+  builder.setInsertionPointAfter(forOp);
+  auto resultSrs =
+      builder.create<aievec::SRSOp>(srsLoc, vecType, result, shift);
+  result.replaceAllUsesExcept(resultSrs.getResult(), resultSrs);
+  return true;
+}
+
+// This pass keeps the loop-carried values of reductions in accumulator
+// registers across the iterations of the loop, instead of moving them to a
+// vector register at the end of each iteration and back at the beginning of
+// the next one.
+struct AIEVecAccumulatorPlacementPass
+    : public PassWrapper<AIEVecAccumulatorPlacementPass, OperationPass<>> {
+  MLIR_DEFINE_EXPLICIT_INTERNAL_INLINE_TYPE_ID(AIEVecAccumulatorPlacementPass)
+
+  StringRef getArgument() const final {
+    return "test-aievec-accumulator-placement";
+  }
+  StringRef getDescription() const final {
+    return "Keep the loop-carried accumulators of reductions in accumulator "
+           "registers.";
+  }
+
+  void runOnOperation() override {
+    getOperation()->walk([](Operation *op) {
+      if (!isa<AffineForOp, scf::ForOp>(op))
+        return;
+      for (unsigned idx = 0; idx < op->getNumResults(); idx++)
+        keepIterArgInAccumulator(op, idx);
+    });
+  }
+};
+
+static std::unique_ptr<::mlir::Pass> createAIEVecAccumulatorPlacementPass() {
+  return std::make_unique<AIEVecAccumulatorPlacementPass>();
+}
+
 //============================================================================//
 //=============== Main AIEVec2AIEVec Pipeline Configuration ==================//
 //============================================================================//
@@ -392,6 +511,9 @@ void xilinx::aievec::buildOptimizeAIEVec(OpPassManager &pm,
     pm.addPass(createAIEVecConvOpTransformationPass(options));
   }
 
+  // Keep the loop-carried accumulators in accumulator registers.
+  pm.addPass(createAIEVecAccumulatorPlacementPass());
+
   // Add post-lowering canonicalization passes.
   pm.addPass(createCSEPass());
   pm.addPass(createCanonicalizerPass());
@@ -0,0 +1,179 @@
+//===- AIEVecPipelineLoads.cpp - Pipeline the loads of loops ---*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the software pipelining of the innermost scf.for loops
+// of vectorized kernels: the aievec.upd loads of an iteration are issued
+// `distance` iterations ahead of the operations using them, with an explicit
+// prologue and epilogue, so that the loads of the next iterations overlap with
+// the multiply-accumulates of the current one.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
+#include "aie/Dialect/AIEVec/Transforms/Passes.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/SCF/Transforms/Patterns.h"
+#include "mlir/Dialect/SCF/Transforms/Transforms.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "llvm/Support/Debug.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::aievec;
+
+#define DEBUG_TYPE "aievec-pipeline-loads"
+
+// Marks the loops created by the pipeliner, so that they are not pipelined
+// again.
+static const char *PIPELINED_ATTR_NAME = "aievec.pipelined";
+
+static Value getBaseMemRef(Value memref) {
+  while (auto view = memref.getDefiningOp<ViewLikeOpInterface>())
+    memref = view.getViewSource();
+  return memref;
+}
+
+/// Function that returns true if no operation of the loop body may write to
+/// memory read by one of upds. Different memrefs, after looking through
+/// views, are assumed not to alias.
+static bool hasNoStoreToLoads(scf::ForOp forOp, ArrayRef<UPDOp> upds) {
+  DenseSet<Value> sources;
+  for (auto upd : upds)
+    sources.insert(getBaseMemRef(upd.getSource()));
+  auto result = forOp.getBody()->walk([&](Operation *op) {
+    if (isa<UPDOp>(op) || isMemoryEffectFree(op))
+      return WalkResult::advance();
+    auto effectOp = dyn_cast<MemoryEffectOpInterface>(op);
+    if (!effectOp)
+      return WalkResult::interrupt();
+    SmallVector<MemoryEffects::EffectInstance, 4> effects;
+    effectOp.getEffects(effects);
+    for (auto &effect : effects) {
+      if (!isa<MemoryEffects::Write>(effect.getEffect()))
+        continue;
+      Value written = effect.getValue();
+      if (!written || sources.count(getBaseMemRef(written)))
+        return WalkResult::interrupt();
+    }
+    return WalkResult::advance();
+  });
+  return !result.wasInterrupted();
+}
+
+/// Function that fills schedule with the stage of each operation of the body
+/// of forOp: the UPD ops and the operations computing their operands go in
+/// stage 0, the other operations in stage distance. The schedule is left
+/// empty if forOp cannot be pipelined.
+static void
+getLoadSchedule(scf::ForOp forOp, unsigned distance,
+                std::vector<std::pair<Operation *, unsigned>> &schedule) {
+  if (forOp->hasAttr(PIPELINED_ATTR_NAME))
+    return;
+
+  // The prologue and the epilogue are peeled, which needs more iterations
+  // than the distance.
+  auto lb = getConstantIntValue(forOp.getLowerBound());
+  auto ub = getConstantIntValue(forOp.getUpperBound());
+  auto step = getConstantIntValue(forOp.getStep());
+  if (!lb || !ub || !step || *step <= 0)
+    return;
+  int64_t tripCount = (*ub - *lb + *step - 1) / *step;
+  if (tripCount <= (int64_t)distance)
+    return;
+
+  // Only straight-line bodies of UPD ops feeding AIE vector operations are
+  // pipelined.
+  Block *body = forOp.getBody();
+  SmallVector<UPDOp, 8> upds;
+  bool hasCompute = false;
+  for (Operation &op : *body) {
+    if (op.getNumRegions() > 0)
+      return;
+    if (auto upd = dyn_cast<UPDOp>(op))
+      upds.push_back(upd);
+    else if (isa<AIEVecDialect>(op.getDialect()))
+      hasCompute = true;
+  }
+  if (upds.empty() || !hasCompute)
+    return;
+
+  // Collect the operations the loads depend on.  They must not depend on the
+  // loop-carried values, which are only known a stage later.
+  DenseSet<Operation *> loadStage;
+  SmallVector<Operation *, 8> worklist(upds.begin(), upds.end());
+  loadStage.insert(worklist.begin(), worklist.end());
+  while (!worklist.empty()) {
+    Operation *op = worklist.pop_back_val();
+    for (Value operand : op->getOperands()) {
+      if (auto arg = dyn_cast<BlockArgument>(operand)) {
+        if (arg.getOwner() == body && arg != forOp.getInductionVar())
+          return;
+        continue;
+      }
+      Operation *def = operand.getDefiningOp();
+      if (def->getBlock() != body || loadStage.count(def))
+        continue;
+      if (!isMemoryEffectFree(def) ||
+          (isa<AIEVecDialect>(def->getDialect()) && !isa<UPDOp>(def)))
+        return;
+      loadStage.insert(def);
+      worklist.push_back(def);
+    }
+  }
+
+  if (!hasNoStoreToLoads(forOp, upds))
+    return;
+
+  for (Operation &op : body->without_terminator())
+    if (loadStage.count(&op))
+      schedule.push_back({&op, 0});
+  for (Operation &op : body->without_terminator())
+    if (!loadStage.count(&op))
+      schedule.push_back({&op, distance});
+  LLVM_DEBUG(llvm::dbgs() << "Pipelining the " << loadStage.size()
+                          << " load operations of " << forOp << "\n");
+}
+
+struct AIEVecPipelineLoadsPass
+    : public AIEVecPipelineLoadsBase<AIEVecPipelineLoadsPass> {
+  void runOnOperation() override {
+    func::FuncOp func = getOperation();
+    if (distance == 0)
+      return;
+
+    scf::PipeliningOption options;
+    options.getScheduleFn =
+        [&](scf::ForOp forOp,
+            std::vector<std::pair<Operation *, unsigned>> &schedule) {
+          getLoadSchedule(forOp, distance, schedule);
+        };
+    options.annotateFn = [](Operation *op,
+                            scf::PipeliningOption::PipelinerPart part,
+                            unsigned) {
+      if (part != scf::PipeliningOption::PipelinerPart::Kernel)
+        return;
+      if (auto loop = dyn_cast<scf::ForOp>(op->getParentOp()))
+        loop->setAttr(PIPELINED_ATTR_NAME, UnitAttr::get(op->getContext()));
+    };
+
+    RewritePatternSet patterns(&getContext());
+    scf::populateSCFLoopPipeliningPatterns(patterns, options);
+    (void)applyPatternsAndFoldGreedily(func, std::move(patterns));
+
+    func.walk(
+        [](scf::ForOp forOp) { forOp->removeAttr(PIPELINED_ATTR_NAME); });
+  }
+};
+
+std::unique_ptr<Pass> xilinx::aievec::createAIEVecPipelineLoadsPass() {
+  return std::make_unique<AIEVecPipelineLoadsPass>();
+}
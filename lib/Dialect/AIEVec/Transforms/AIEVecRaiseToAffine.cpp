@@ -0,0 +1,178 @@
+//===- AIEVecRaiseToAffine.cpp - Raise scf loops to affine ------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+// This file implements the raising of the scf.for loops and of the memref
+// accesses of a kernel whose bounds and indices are affine functions of the
+// enclosing loops to the affine dialect, which the affine super-vectorizer
+// and aie-vectorize vectorize.
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/Transforms/Passes.h"
+#include "mlir/Dialect/Affine/IR/AffineOps.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/Transforms/RegionUtils.h"
+#include "llvm/Support/Debug.h"
+
+#include <optional>
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::aievec;
+
+#define DEBUG_TYPE "aievec-raise-to-affine"
+
+/// Function that returns the affine expression computing the index value
+/// from the dims of operands, which it extends with the valid affine dims
+/// value uses, or std::nullopt if value is not an affine function of them.
+static std::optional<AffineExpr>
+getAffineExpr(Value value, SmallVectorImpl<Value> &operands) {
+  MLIRContext *context = value.getContext();
+  if (!value.getType().isIndex())
+    return std::nullopt;
+  if (auto constant = getConstantIntValue(value))
+    return getAffineConstantExpr(*constant, context);
+
+  Operation *op = value.getDefiningOp();
+  if (op && isa<arith::AddIOp, arith::SubIOp, arith::MulIOp>(op)) {
+    unsigned numOperands = operands.size();
+    auto lhs = getAffineExpr(op->getOperand(0), operands);
+    auto rhs = getAffineExpr(op->getOperand(1), operands);
+    if (lhs && rhs) {
+      if (isa<arith::AddIOp>(op))
+        return *lhs + *rhs;
+      if (isa<arith::SubIOp>(op))
+        return *lhs - *rhs;
+      // A product is affine if one of its factors is a constant.
+      if (lhs->isa<AffineConstantExpr>() || rhs->isa<AffineConstantExpr>())
+        return *lhs * *rhs;
+    }
+    operands.truncate(numOperands);
+  }
+
+  if (!isValidDim(value))
+    return std::nullopt;
+  auto it = llvm::find(operands, value);
+  if (it == operands.end())
+    it = operands.insert(operands.end(), value);
+  return getAffineDimExpr(it - operands.begin(), context);
+}
+
+/// Function that returns the affine map computing indices from the values of
+/// operands, or std::nullopt if one of the indices is not affine.
+static std::optional<AffineMap> getAffineMap(ValueRange indices,
+                                             SmallVectorImpl<Value> &operands,
+                                             MLIRContext *context) {
+  SmallVector<AffineExpr, 4> exprs;
+  for (Value index : indices) {
+    auto expr = getAffineExpr(index, operands);
+    if (!expr)
+      return std::nullopt;
+    exprs.push_back(*expr);
+  }
+  return AffineMap::get(operands.size(), 0, exprs, context);
+}
+
+/// Function that replaces forOp by an affine.for loop, if its step is a
+/// positive constant and its bounds are affine.
+static void raiseLoop(scf::ForOp forOp) {
+  MLIRContext *context = forOp.getContext();
+  auto step = getConstantIntValue(forOp.getStep());
+  if (!step || *step <= 0)
+    return;
+  SmallVector<Value, 4> lbOperands, ubOperands;
+  auto lbMap = getAffineMap(forOp.getLowerBound(), lbOperands, context);
+  auto ubMap = getAffineMap(forOp.getUpperBound(), ubOperands, context);
+  if (!lbMap || !ubMap)
+    return;
+
+  LLVM_DEBUG(llvm::dbgs() << "Raising the loop at " << forOp.getLoc()
+                          << " to affine\n");
+  OpBuilder builder(forOp);
+  auto affineFor = builder.create<AffineForOp>(
+      forOp.getLoc(), lbOperands, *lbMap, ubOperands, *ubMap, *step,
+      forOp.getInitArgs());
+
+  // The body of the scf loop replaces the one of the affine loop.
+  Block *body = affineFor.getBody();
+  Block *scfBody = forOp.getBody();
+  if (!body->empty())
+    body->back().erase();
+  for (auto [from, to] :
+       llvm::zip(scfBody->getArguments(), body->getArguments()))
+    from.replaceAllUsesWith(to);
+  body->getOperations().splice(body->end(), scfBody->getOperations());
+  auto yieldOp = cast<scf::YieldOp>(body->getTerminator());
+  builder.setInsertionPoint(yieldOp);
+  builder.create<AffineYieldOp>(yieldOp.getLoc(), yieldOp.getOperands());
+  yieldOp.erase();
+
+  forOp.replaceAllUsesWith(affineFor.getResults());
+  forOp.erase();
+}
+
+/// Function that replaces the memref.load or memref.store op by an affine
+/// access, if its indices are affine.
+static void raiseAccess(Operation *op) {
+  OpBuilder builder(op);
+  SmallVector<Value, 4> operands;
+  if (auto loadOp = dyn_cast<memref::LoadOp>(op)) {
+    auto map = getAffineMap(loadOp.getIndices(), operands, op->getContext());
+    if (!map)
+      return;
+    auto affineLoad = builder.create<AffineLoadOp>(
+        loadOp.getLoc(), loadOp.getMemRef(), *map, operands);
+    loadOp.replaceAllUsesWith(affineLoad.getResult());
+    loadOp.erase();
+  } else if (auto storeOp = dyn_cast<memref::StoreOp>(op)) {
+    auto map = getAffineMap(storeOp.getIndices(), operands, op->getContext());
+    if (!map)
+      return;
+    builder.create<AffineStoreOp>(storeOp.getLoc(), storeOp.getValue(),
+                                  storeOp.getMemRef(), *map, operands);
+    storeOp.erase();
+  }
+}
+
+struct AIEVecRaiseToAffinePass
+    : public AIEVecRaiseToAffineBase<AIEVecRaiseToAffinePass> {
+  void runOnOperation() override {
+    func::FuncOp func = getOperation();
+
+    // The outer loops first, so that their induction variables are valid
+    // affine dims in the bounds of the inner ones.
+    SmallVector<scf::ForOp, 8> loops;
+    func.walk<WalkOrder::PreOrder>([&](scf::ForOp forOp) {
+      if (forOp.getInductionVar().getType().isIndex())
+        loops.push_back(forOp);
+    });
+    for (scf::ForOp forOp : loops)
+      raiseLoop(forOp);
+
+    SmallVector<Operation *, 16> accesses;
+    func.walk([&](Operation *op) {
+      if (isa<memref::LoadOp, memref::StoreOp>(op))
+        accesses.push_back(op);
+    });
+    for (Operation *op : accesses)
+      raiseAccess(op);
+
+    // The index arithmetic of the raised accesses is left dead, and would
+    // keep the super-vectorizer from vectorizing the loops.
+    IRRewriter rewriter(&getContext());
+    (void)runRegionDCE(rewriter, func->getRegions());
+  }
+};
+
+std::unique_ptr<Pass> xilinx::aievec::createAIEVecRaiseToAffinePass() {
+  return std::make_unique<AIEVecRaiseToAffinePass>();
+}
@@ -16,17 +16,23 @@
 #include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
 #include "aie/Dialect/AIEVec/Transforms/IntervalReuse.h"
 #include "aie/Dialect/AIEVec/Transforms/Passes.h"
+#include "aie/Dialect/AIEVec/Utils/RegisterPressure.h"
 #include "mlir/Conversion/AffineToStandard/AffineToStandard.h"
 #include "mlir/Dialect/Affine/Analysis/LoopAnalysis.h"
 #include "mlir/Dialect/Affine/IR/AffineOps.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
 #include "mlir/Dialect/Vector/Transforms/VectorTransforms.h"
+#include "mlir/IR/IRMapping.h"
 #include "mlir/IR/TypeUtilities.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Transforms/Passes.h"
 #include "llvm/ADT/SmallSet.h"
+#include <limits>
 
 using namespace mlir;
 using namespace arith;
@@ -100,12 +106,25 @@ struct VectState {
   // i8xi8 scheme. An example of filter for i8xi8 scheme is {0,0,1,1,2,2,3,3},
   // with dupFactor=2.
   int32_t dupFactor;
+  // The longest chain of FMA ops fused to exploit the column topology of the
+  // AIE intrinsics, and the longest one actually fused. Shorter chains load
+  // narrower vectors, which lowers the register pressure.
+  int32_t maxFusedCols;
+  int32_t fusedCols;
+  // The number of independent accumulators the chains of dependent FMA ops
+  // are interleaved over.
+  int32_t numAccs;
 
   // Constructors
   VectState(MLIRContext *context)
-      : builder(context), shift(0), zeroOffset(0), dupFactor(2) {}
-  VectState(MLIRContext *context, int8_t s, int32_t z, int32_t d)
-      : builder(context), shift(s), zeroOffset(z), dupFactor(d) {}
+      : builder(context), shift(0), zeroOffset(0), dupFactor(2),
+        maxFusedCols(std::numeric_limits<int32_t>::max()), fusedCols(1),
+        numAccs(1) {}
+  VectState(MLIRContext *context, int8_t s, int32_t z, int32_t d,
+            int32_t maxCols = std::numeric_limits<int32_t>::max(),
+            int32_t accs = 1)
+      : builder(context), shift(s), zeroOffset(z), dupFactor(d),
+        maxFusedCols(maxCols), fusedCols(1), numAccs(accs) {}
 
   IntervalReuse *getIntervalForOperation(Operation *op);
 };
@@ -1741,6 +1760,7 @@ static void fuseFMAOps(Operation *refOp,
                        VectState *state) {
   // The number of columns must be greater than 1. refOp must be mul/fma op,
   // and should not be covered by the simple vector scheme.
+  cols = std::min(cols, state->maxFusedCols);
   if (cols <= 1 || !isa<MulIOp, MulFOp, vector::FMAOp>(refOp) ||
       isSimpleVectIntrinsic(refOp, state))
     return;
@@ -1853,6 +1873,8 @@ static void fuseFMAOps(Operation *refOp,
   // If there are no ops fused, return
   if (fusedOps.empty())
     return;
+  state->fusedCols =
+      std::max(state->fusedCols, static_cast<int32_t>(fusedOps.size()) + 1);
 
   LLVM_DEBUG(llvm::dbgs() << "\n\nFused following fma ops with op " << *refOp);
 
@@ -2030,7 +2052,8 @@ static void fuseFMAOpsForColumnTopology(func::FuncOp func, VectState *state) {
 
   // Fuse FMA ops to exploit column topology
   func.walk([&](mlir::Operation *op) {
-    if (isa<MulIOp, MulFOp, vector::FMAOp>(op)) {
+    if (isa<MulIOp, MulFOp, vector::FMAOp>(op) &&
+        op->getResult(0).getType().isa<VectorType>()) {
       // Only process fma ops that are not already fused with another mul/fma
       if (!fusedOpSet.count(op)) {
         // Get the rows and columns for this topology
@@ -2048,6 +2071,124 @@ static void fuseFMAOpsForColumnTopology(func::FuncOp func, VectState *state) {
     op->erase();
 }
 
+// Split the linear chain of mul/fma ops starting at head, where each fma
+// accumulates into the result of the previous op, into state->numAccs
+// interleaved chains accumulating into independent accumulators. The i-th op
+// of the chain then accumulates into the (i-numAccs)-th one, so that
+// consecutive fma ops do not wait for each other in the MAC pipeline. The
+// partial sums are added together at the end of the chain.
+static void interleaveFMAChain(Operation *head, VectState *state) {
+  SmallVector<Operation *, 16> chain = {head};
+  Operation *curOp = head;
+  while (curOp->hasOneUse()) {
+    auto usrOp = dyn_cast<vector::FMAOp>(*curOp->getUsers().begin());
+    if (!usrOp || usrOp->getBlock() != head->getBlock() ||
+        usrOp.getAcc() != curOp->getResult(0))
+      break;
+    chain.push_back(usrOp);
+    curOp = usrOp;
+  }
+
+  // Every chain must accumulate at least two products
+  int32_t numAccs =
+      std::min(state->numAccs, static_cast<int32_t>(chain.size()) / 2);
+  if (numAccs <= 1)
+    return;
+
+  // The paired ops of the i8xi8 scheme and the mul_conv/fma_conv ops only
+  // cover a single accumulator.
+  Type elementType = getElementTypeOrSelf(head->getResult(0).getType());
+  Operation *lhsDefOp = getOperandDefOp(state, head, 0);
+  auto lhsType = lhsDefOp->getResult(0).getType().cast<VectorType>();
+  if (getElementSizeInBits(lhsType) == 8)
+    return;
+  // The partial sums of integer chains are added after the SRS, which must
+  // then not drop any bits.
+  bool isFloat = elementType.isa<FloatType>();
+  if (!isFloat && state->shift != 0)
+    return;
+  // The first op of each new chain becomes a mul, which cannot subtract
+  for (int32_t k = 1; k < numAccs; ++k)
+    if (state->mscOps.count(chain[k]))
+      return;
+
+  LLVM_DEBUG(llvm::dbgs() << "\n\nInterleaving " << numAccs
+                          << " accumulators in the chain of " << chain.size()
+                          << " mul/fma ops starting at " << *head);
+
+  // Keep the users of the chain, which now use the sum of the partial sums
+  Operation *tail = chain.back();
+  SmallVector<OpOperand *, 4> tailUses;
+  for (OpOperand &use : tail->getUses())
+    tailUses.push_back(&use);
+
+  // Start the new chains with a mul op in place of their first fma op
+  SmallVector<Operation *, 16> interleaved(chain);
+  for (int32_t k = 1; k < numAccs; ++k) {
+    auto fmaOp = cast<vector::FMAOp>(chain[k]);
+    state->builder.setInsertionPoint(fmaOp);
+    Operation *mulOp =
+        isFloat ? state->builder
+                      .create<MulFOp>(fmaOp->getLoc(), fmaOp.getLhs(),
+                                      fmaOp.getRhs())
+                      .getOperation()
+                : state->builder
+                      .create<MulIOp>(fmaOp->getLoc(), fmaOp.getLhs(),
+                                      fmaOp.getRhs())
+                      .getOperation();
+    if (state->opToColOffsets.count(fmaOp)) {
+      state->opToColOffsets[mulOp] = state->opToColOffsets[fmaOp];
+      state->opToColOffsets.erase(fmaOp);
+    }
+    interleaved[k] = mulOp;
+  }
+  for (size_t i = numAccs; i < chain.size(); ++i)
+    cast<vector::FMAOp>(chain[i]).getAccMutable().assign(
+        interleaved[i - numAccs]->getResult(0));
+  for (int32_t k = numAccs - 1; k > 0; --k)
+    chain[k]->erase();
+
+  // Add the partial sums after the last op of the chain
+  state->builder.setInsertionPointAfter(tail);
+  Value sum = interleaved[chain.size() - numAccs]->getResult(0);
+  for (size_t i = chain.size() - numAccs + 1; i < chain.size(); ++i) {
+    Value partial = interleaved[i]->getResult(0);
+    sum = isFloat
+              ? state->builder.create<AddFOp>(tail->getLoc(), sum, partial)
+                    .getResult()
+              : state->builder.create<AddIOp>(tail->getLoc(), sum, partial)
+                    .getResult();
+  }
+  for (OpOperand *use : tailUses)
+    use->set(sum);
+}
+
+// Interleave state->numAccs accumulators in the chains of dependent mul/fma
+// ops left after the column topology fusion.
+static void interleaveFMAChainsInFunc(func::FuncOp func, VectState *state) {
+  if (state->numAccs <= 1)
+    return;
+
+  // Return true if op continues the chain of the op defining its accumulator
+  auto continuesChain = [](Operation *op) {
+    auto fmaOp = dyn_cast<vector::FMAOp>(op);
+    if (!fmaOp)
+      return false;
+    Operation *accOp = fmaOp.getAcc().getDefiningOp();
+    return accOp && isa<MulIOp, MulFOp, vector::FMAOp>(accOp) &&
+           accOp->getBlock() == op->getBlock() && accOp->hasOneUse();
+  };
+
+  SmallVector<Operation *, 8> heads;
+  func.walk([&](Operation *op) {
+    if (isa<MulIOp, MulFOp, vector::FMAOp>(op) &&
+        op->getResult(0).getType().isa<VectorType>() && !continuesChain(op))
+      heads.push_back(op);
+  });
+  for (Operation *head : heads)
+    interleaveFMAChain(head, state);
+}
+
 template <typename T1, typename T2>
 static bool matchAttributesAndDistanceForFusion(T1 curOp, T2 defOp) {
   return curOp.getOffset(0) == defOp.getOffset(0) &&
@@ -2289,7 +2430,8 @@ static void generateAIEMulOrFMAOpsInFunc(func::FuncOp func, VectState *state) {
   // For each mul/fma op, compute the scheme-dependent operand attributes, and
   // generate corresponding AIE dialect ops.
   func.walk([&](mlir::Operation *op) {
-    if (isa<MulIOp, MulFOp, vector::FMAOp>(op))
+    if (isa<MulIOp, MulFOp, vector::FMAOp>(op) &&
+        op->getResult(0).getType().isa<VectorType>())
       generateSchemeBasedMulOrFMAOp(op, state);
   });
 }
@@ -2429,7 +2571,8 @@ static void generateSchemeBasedAddOrSubOp(Operation *Op, VectState *state) {
 // splat, we must generate simple scheme add op.
 static void generateAIEAddOrSubOpsInFunc(func::FuncOp func, VectState *state) {
   func.walk([&](mlir::Operation *op) {
-    if (isa<AddIOp, AddFOp, SubIOp, SubFOp>(op))
+    if (isa<AddIOp, AddFOp, SubIOp, SubFOp>(op) &&
+        op->getResult(0).getType().isa<VectorType>())
       generateSchemeBasedAddOrSubOp(op, state);
   });
 }
@@ -2563,9 +2706,90 @@ static void insertSRSOp(Operation *Op, VectState *state) {
   }
 }
 
+// Return true if value is a vector whose lanes are all zero.
+static bool isZeroSplat(Value value) {
+  auto constOp = value.getDefiningOp<arith::ConstantOp>();
+  if (!constOp)
+    return false;
+  auto attr = constOp.getValue().dyn_cast<SplatElementsAttr>();
+  return attr && attr.getElementType().isa<IntegerType>() &&
+         attr.getSplatValue<APInt>().isZero();
+}
+
+// Incoming shrOp is the requantization of an accumulator: an arithmetic shift
+// right of all its lanes by the same amount, either a constant or a scalar
+// broadcast to the lanes (e.g., the shift of the output channel of a
+// convolution). Fold it in the SRS op moving the accumulator to a vector,
+// along with the ReLU clamping of its result to zero, so that the output of
+// the accumulation is requantized without a pass over the vector.
+static void fuseRequantization(ShRSIOp shrOp, VectState *state) {
+  Operation *accOp = shrOp.getLhs().getDefiningOp();
+  if (!accOp || !writesToAccumulator(accOp))
+    return;
+
+  Location loc = shrOp.getLoc();
+  state->builder.setInsertionPoint(shrOp);
+  int32_t shift = state->shift;
+  Value dynamicShift = nullptr;
+  Value rhs = shrOp.getRhs();
+  if (auto constOp = rhs.getDefiningOp<arith::ConstantOp>()) {
+    auto attr = constOp.getValue().dyn_cast<SplatElementsAttr>();
+    if (!attr)
+      return;
+    shift += attr.getSplatValue<APInt>().getSExtValue();
+    // The shift of the SRS intrinsic should be between 0 and 63
+    if (shift < 0 || shift > 63)
+      return;
+  } else if (auto bcastOp = rhs.getDefiningOp<vector::BroadcastOp>()) {
+    dynamicShift = bcastOp.getSource();
+    if (!dynamicShift.getType().isa<IntegerType>())
+      return;
+    // The shift of the ups intrinsics must still be undone
+    if (state->shift != 0) {
+      Value upsShift = state->builder.create<arith::ConstantOp>(
+          loc, state->builder.getIntegerAttr(dynamicShift.getType(),
+                                             state->shift));
+      dynamicShift =
+          state->builder.create<arith::AddIOp>(loc, dynamicShift, upsShift);
+    }
+  } else
+    return;
+
+  VectorType resType = shrOp.getType().cast<VectorType>();
+  aievec::SRSOp srsOp = state->builder.create<aievec::SRSOp>(
+      loc, resType, accOp->getResult(0),
+      state->builder.getI8IntegerAttr(dynamicShift ? 0 : shift), dynamicShift);
+  LLVM_DEBUG(llvm::dbgs() << "\n\nFused requantization " << shrOp
+                          << " in SRS op " << srsOp);
+
+  // A ReLU of the requantized vector is a max with a zero vector
+  for (Operation *user : llvm::make_early_inc_range(shrOp->getUsers())) {
+    auto maxOp = dyn_cast<MaxSIOp>(user);
+    if (!maxOp)
+      continue;
+    Value zero = maxOp.getLhs() == shrOp.getResult() ? maxOp.getRhs()
+                                                      : maxOp.getLhs();
+    if (!isZeroSplat(zero))
+      continue;
+    state->builder.setInsertionPoint(maxOp);
+    auto reluOp = state->builder.create<aievec::MaxOp>(
+        maxOp.getLoc(), resType, srsOp.getResult(), zero);
+    maxOp->replaceAllUsesWith(reluOp);
+    maxOp->erase();
+  }
+  shrOp->replaceAllUsesWith(srsOp);
+  shrOp->erase();
+}
+
 // Generate SRS op whenever we move data from an accumulator AIE dialect to a
 // vector.
 static void insertSRSOpsInFunc(func::FuncOp func, VectState *state) {
+  // The requantizations of the accumulators are folded in their SRS ops first
+  SmallVector<ShRSIOp, 4> shrOps;
+  func.walk([&](ShRSIOp shrOp) { shrOps.push_back(shrOp); });
+  for (ShRSIOp shrOp : shrOps)
+    fuseRequantization(shrOp, state);
+
   func.walk([&](mlir::Operation *op) {
     // Insert an SRS op if the op outputs to an accumulator
     if (writesToAccumulator(op))
@@ -2584,6 +2808,178 @@ template <typename TransferOp> static void setInBounds(TransferOp op) {
   op->setAttr(op.getInBoundsAttrName(), b.getBoolArrayAttr(bools));
 }
 
+// Return true if the permutation map of a 1-D transfer op either reads the
+// contiguous elements of the innermost memref dimension, or broadcasts one
+// element. The lane l of such a transfer op in the iteration iv of the
+// vectorized loop is then the element that the scalar iteration iv + l
+// accesses at the same indices.
+static bool isScalarizableTransfer(VectorTransferOpInterface op) {
+  if (op.getMask() || op.getVectorType().getRank() != 1 ||
+      !op.getShapedType().isa<MemRefType>())
+    return false;
+  AffineMap map = op.getPermutationMap();
+  return map.isMinorIdentity() || map.isConstant();
+}
+
+// Clone the operations of block, which belongs to a vectorized loop, at the
+// insertion point of builder as scalar operations computing a single lane.
+// The values of the vectorized loop are looked up in mapping. Return failure
+// if one of the operations cannot be scalarized.
+static LogicalResult scalarizeBlock(Block &block, IRMapping &mapping,
+                                    OpBuilder &builder) {
+  for (Operation &op : block.without_terminator()) {
+    Location loc = op.getLoc();
+    bool hasVectors =
+        llvm::any_of(op.getOperandTypes(),
+                     [](Type type) { return type.isa<VectorType>(); }) ||
+        llvm::any_of(op.getResultTypes(),
+                     [](Type type) { return type.isa<VectorType>(); });
+
+    if (auto forOp = dyn_cast<AffineForOp>(op)) {
+      if (forOp.getNumIterOperands() != 0)
+        return failure();
+      auto lbOperands = llvm::to_vector<4>(llvm::map_range(
+          forOp.getLowerBoundOperands(),
+          [&](Value v) { return mapping.lookupOrDefault(v); }));
+      auto ubOperands = llvm::to_vector<4>(llvm::map_range(
+          forOp.getUpperBoundOperands(),
+          [&](Value v) { return mapping.lookupOrDefault(v); }));
+      auto newForOp = builder.create<AffineForOp>(
+          loc, lbOperands, forOp.getLowerBoundMap(), ubOperands,
+          forOp.getUpperBoundMap(), forOp.getStep());
+      mapping.map(forOp.getInductionVar(), newForOp.getInductionVar());
+      OpBuilder::InsertionGuard guard(builder);
+      builder.setInsertionPointToStart(newForOp.getBody());
+      if (failed(scalarizeBlock(*forOp.getBody(), mapping, builder)))
+        return failure();
+      continue;
+    }
+
+    if (!hasVectors) {
+      if (op.getNumRegions() != 0)
+        return failure();
+      builder.clone(op, mapping);
+      continue;
+    }
+
+    auto mapOperands = [&](ValueRange values) {
+      return llvm::to_vector<4>(llvm::map_range(
+          values, [&](Value v) { return mapping.lookupOrDefault(v); }));
+    };
+
+    if (auto readOp = dyn_cast<TransferReadOp>(op)) {
+      if (!isScalarizableTransfer(readOp))
+        return failure();
+      Value load = builder.create<memref::LoadOp>(
+          loc, mapping.lookupOrDefault(readOp.getSource()),
+          mapOperands(readOp.getIndices()));
+      mapping.map(readOp.getResult(), load);
+    } else if (auto writeOp = dyn_cast<TransferWriteOp>(op)) {
+      if (!isScalarizableTransfer(writeOp) ||
+          !writeOp.getPermutationMap().isMinorIdentity())
+        return failure();
+      builder.create<memref::StoreOp>(
+          loc, mapping.lookupOrDefault(writeOp.getVector()),
+          mapping.lookupOrDefault(writeOp.getSource()),
+          mapOperands(writeOp.getIndices()));
+    } else if (auto broadcastOp = dyn_cast<vector::BroadcastOp>(op)) {
+      if (broadcastOp.getSource().getType().isa<VectorType>())
+        return failure();
+      mapping.map(broadcastOp.getResult(),
+                  mapping.lookupOrDefault(broadcastOp.getSource()));
+    } else if (auto fmaOp = dyn_cast<vector::FMAOp>(op)) {
+      Value mul =
+          builder.create<MulFOp>(loc, mapping.lookupOrDefault(fmaOp.getLhs()),
+                                 mapping.lookupOrDefault(fmaOp.getRhs()));
+      Value add = builder.create<AddFOp>(
+          loc, mul, mapping.lookupOrDefault(fmaOp.getAcc()));
+      mapping.map(fmaOp.getResult(), add);
+    } else if (auto constOp = dyn_cast<arith::ConstantOp>(op)) {
+      auto attr = constOp.getValue().dyn_cast<SplatElementsAttr>();
+      if (!attr)
+        return failure();
+      Value scalar = builder.create<arith::ConstantOp>(
+          loc, attr.getSplatValue<TypedAttr>());
+      mapping.map(constOp.getResult(), scalar);
+    } else if (isa<arith::ArithDialect>(op.getDialect()) &&
+               op.getNumRegions() == 0) {
+      // Elementwise arith ops keep their name and attributes, on the element
+      // types.
+      OperationState opState(loc, op.getName());
+      opState.addOperands(mapOperands(op.getOperands()));
+      for (Type type : op.getResultTypes())
+        opState.addTypes(getElementTypeOrSelf(type));
+      opState.addAttributes(op.getAttrs());
+      Operation *scalarOp = builder.create(opState);
+      mapping.map(op.getResults(), scalarOp->getResults());
+    } else {
+      return failure();
+    }
+  }
+  return success();
+}
+
+// The affine super-vectorizer keeps the bounds of the loops it vectorizes, so
+// a loop whose extent is not a multiple of the vector size accesses memory
+// past the arrays in its last iteration. Peel such a loop: the vectorized
+// loop is cut to the largest multiple of the vector size, and the remaining
+// iterations go to a scalar epilogue loop. This allows vectorizing kernels on
+// arbitrary sizes, without padding the data. Loops carrying values, like
+// reductions, are not peeled.
+static void peelRemainderIterations(func::FuncOp func) {
+  SmallVector<AffineForOp, 4> loops;
+  func.walk([&](AffineForOp forOp) {
+    int64_t step = forOp.getStep();
+    if (step == 1 || !forOp.hasConstantBounds())
+      return;
+    // Only loops vectorized with their step as vector size are of interest.
+    bool isVectorized = false;
+    forOp.getBody()->walk([&](VectorTransferOpInterface transferOp) {
+      auto vectorType = transferOp.getVectorType();
+      if (vectorType.getRank() == 1 && vectorType.getShape()[0] == step)
+        isVectorized = true;
+    });
+    int64_t extent =
+        forOp.getConstantUpperBound() - forOp.getConstantLowerBound();
+    if (isVectorized && extent > 0 && extent % step != 0)
+      loops.push_back(forOp);
+  });
+
+  for (AffineForOp forOp : loops) {
+    int64_t lb = forOp.getConstantLowerBound();
+    int64_t ub = forOp.getConstantUpperBound();
+    int64_t step = forOp.getStep();
+    int64_t mainUb = lb + (ub - lb) / step * step;
+
+    if (forOp.getNumIterOperands() != 0) {
+      forOp->emitWarning()
+          << "the trip count is not a multiple of the vector size " << step
+          << ", and the remainder of loops carrying values is not peeled";
+      continue;
+    }
+
+    OpBuilder builder(forOp->getContext());
+    builder.setInsertionPointAfter(forOp);
+    auto epilogue =
+        builder.create<AffineForOp>(forOp.getLoc(), mainUb, ub, /*step=*/1);
+    IRMapping mapping;
+    mapping.map(forOp.getInductionVar(), epilogue.getInductionVar());
+    builder.setInsertionPointToStart(epilogue.getBody());
+    if (failed(scalarizeBlock(*forOp.getBody(), mapping, builder))) {
+      epilogue.erase();
+      forOp->emitWarning()
+          << "the trip count is not a multiple of the vector size " << step
+          << ", and the loop body cannot be scalarized to peel the remainder";
+      continue;
+    }
+
+    if (mainUb == lb)
+      forOp.erase();
+    else
+      forOp.setConstantUpperBound(mainUb);
+  }
+}
+
 // Remove redundant vector load/stores (i.e., transfer ops) that could be
 // generated post unolling. The redundant operations are removed in two steps:
 // first, we do a store to load forwarding. This removes the loads that
@@ -2980,6 +3376,367 @@ static void reassociateOpsInFunc(func::FuncOp func, VectState *state) {
   reassociateAddOpInFunc(func, state);
 }
 
+//===----------------------------------------------------------------------===//
+// Cross-iteration reuse
+//===----------------------------------------------------------------------===//
+
+// The UPD ops loading one vector register in a loop body: a UPD op without
+// source vector, followed by the UPD op loading its upper half if the vector
+// is loaded in two halves. The vector holds the elements of the innermost
+// dimension of source starting at the loop induction variable plus start.
+namespace {
+struct UPDChain {
+  aievec::UPDOp root, last;
+  // the indices into all but the innermost dimension, defined outside of the
+  // loop
+  SmallVector<Value, 4> outerIndices;
+  // the constant added to the induction variable to index the innermost
+  // dimension
+  int64_t ivOffset;
+  // the first element loaded, relative to the induction variable
+  int64_t start;
+  bool halves;
+};
+} // namespace
+
+static Value getBaseMemRef(Value memref) {
+  while (auto view = memref.getDefiningOp<ViewLikeOpInterface>())
+    memref = view.getViewSource();
+  return memref;
+}
+
+// Return c if value is the induction variable of forOp plus the constant c.
+static std::optional<int64_t> getIVOffset(scf::ForOp forOp, Value value) {
+  if (value == forOp.getInductionVar())
+    return 0;
+  auto addOp = value.getDefiningOp<AddIOp>();
+  if (!addOp)
+    return std::nullopt;
+  if (addOp.getLhs() == forOp.getInductionVar())
+    return getConstantIntValue(addOp.getRhs());
+  if (addOp.getRhs() == forOp.getInductionVar())
+    return getConstantIntValue(addOp.getLhs());
+  return std::nullopt;
+}
+
+// Return the UPD chain whose first UPD op is updOp, if its vector register is
+// fully loaded from an access along the induction variable of forOp.
+static std::optional<UPDChain> getUPDChain(scf::ForOp forOp,
+                                           aievec::UPDOp updOp) {
+  if (updOp.getVector())
+    return std::nullopt;
+  VectorType vecType = updOp.getResult().getType().cast<VectorType>();
+  int32_t elementSizeInBits = getElementSizeInBits(vecType);
+  UPDChain chain;
+  chain.root = chain.last = updOp;
+  // Vectors larger than this are loaded in two halves by UPD idx=0 and idx=1
+  chain.halves = getVectorSizeInBits(vecType) > (AIEML ? 1024 : 256);
+  if (chain.halves) {
+    if (updOp.getIndex() != 0 || !updOp->hasOneUse())
+      return std::nullopt;
+    auto upperOp = dyn_cast<aievec::UPDOp>(*updOp->user_begin());
+    if (!upperOp || upperOp.getVector() != updOp.getResult() ||
+        upperOp.getIndex() != 1 || upperOp.getSource() != updOp.getSource() ||
+        !llvm::equal(upperOp.getIndices(), updOp.getIndices()) ||
+        upperOp.getOffset() != updOp.getOffset() +
+                                   getVectorSizeInBits(vecType) / 2)
+      return std::nullopt;
+    chain.last = upperOp;
+  }
+
+  auto indices = updOp.getIndices();
+  if (indices.empty() || updOp.getOffset() % elementSizeInBits)
+    return std::nullopt;
+  for (Value index : indices.drop_back()) {
+    if (!forOp.isDefinedOutsideOfLoop(index))
+      return std::nullopt;
+    chain.outerIndices.push_back(index);
+  }
+  auto ivOffset = getIVOffset(forOp, indices.back());
+  if (!ivOffset)
+    return std::nullopt;
+  chain.ivOffset = *ivOffset;
+  chain.start = *ivOffset + updOp.getOffset() / elementSizeInBits;
+  return chain;
+}
+
+// Return true if no operation in the body of forOp may write to the memory
+// read by the given UPD chains.
+static bool isReadOnlyInLoop(scf::ForOp forOp, ArrayRef<UPDChain> chains) {
+  DenseSet<Value> sources;
+  for (auto &chain : chains)
+    sources.insert(getBaseMemRef(chain.root.getSource()));
+  auto result = forOp.getBody()->walk([&](Operation *op) {
+    if (isMemoryEffectFree(op))
+      return WalkResult::advance();
+    auto effectOp = dyn_cast<MemoryEffectOpInterface>(op);
+    if (!effectOp)
+      return WalkResult::interrupt();
+    SmallVector<MemoryEffects::EffectInstance, 4> effects;
+    effectOp.getEffects(effects);
+    for (auto &effect : effects)
+      if (isa<MemoryEffects::Write>(effect.getEffect()) &&
+          (!effect.getValue() ||
+           sources.count(getBaseMemRef(effect.getValue()))))
+        return WalkResult::interrupt();
+    return WalkResult::advance();
+  });
+  return !result.wasInterrupted();
+}
+
+// A vector register of the current iteration which is, fully or for its
+// lower half, the register of another chain in the previous iteration.
+namespace {
+struct CarriedChain {
+  UPDChain chain;
+  // the chain whose register is carried to the next iteration
+  aievec::UPDOp from;
+  // true if only the lower half of chain is carried, from the upper half of
+  // from
+  bool lowerHalf;
+};
+} // namespace
+
+// Return true if the chains access the same rows of the same array.
+static bool sameArrayRows(const UPDChain &a, const UPDChain &b) {
+  return a.root.getSource() == b.root.getSource() &&
+         a.outerIndices == b.outerIndices &&
+         a.root.getResult().getType() == b.root.getResult().getType() &&
+         a.halves == b.halves;
+}
+
+// Carry the vector registers loaded by the UPD ops of the innermost loop
+// forOp across its iterations. The IntervalReuse objects share a register
+// between the reads of one iteration. With a sliding window, the next
+// iteration loads again most of that data: a register which holds the data a
+// register of the previous iteration held is carried as an iter_arg of the
+// loop instead of being loaded, and a register whose lower half was the upper
+// half of a register of the previous iteration only loads its upper half.
+static void reuseUPDsAcrossIterations(scf::ForOp forOp, bool limitPressure) {
+  auto lb = getConstantIntValue(forOp.getLowerBound());
+  auto step = getConstantIntValue(forOp.getStep());
+  if (!lb || !step || *step <= 0)
+    return;
+  Block *body = forOp.getBody();
+  SmallVector<UPDChain, 8> chains;
+  for (Operation &op : *body) {
+    if (op.getNumRegions() > 0)
+      return;
+    if (auto updOp = dyn_cast<aievec::UPDOp>(op))
+      if (auto chain = getUPDChain(forOp, updOp))
+        chains.push_back(*chain);
+  }
+  if (chains.empty() || !isReadOnlyInLoop(forOp, chains))
+    return;
+
+  // The chains are matched on the IR before any rewrite: a chain is fully
+  // carried if another chain loads in this iteration what it loads in the
+  // next one, or its lower half is carried if another chain loads it in its
+  // upper half.
+  SmallVector<CarriedChain, 8> carried;
+  for (auto &chain : chains) {
+    int64_t lanes =
+        chain.root.getResult().getType().cast<VectorType>().getNumElements();
+    const UPDChain *from = nullptr;
+    bool lowerHalf = false;
+    for (auto &other : chains)
+      if (sameArrayRows(chain, other) && other.start == chain.start + *step) {
+        from = &other;
+        break;
+      }
+    if (!from && chain.halves)
+      for (auto &other : chains)
+        if (sameArrayRows(chain, other) &&
+            other.start + lanes / 2 == chain.start + *step) {
+          from = &other;
+          lowerHalf = true;
+          break;
+        }
+    if (from)
+      carried.push_back({chain, from->last, lowerHalf});
+  }
+  if (carried.empty())
+    return;
+
+  // The carried registers stay live across the whole iteration: carry them
+  // only if the loop still fits in the vector registers.
+  if (limitPressure) {
+    RegisterPressure pressure = estimateRegisterPressure(forOp, AIEML);
+    for (auto &c : carried) {
+      auto vecType = c.chain.root.getResult().getType().cast<VectorType>();
+      pressure.vectorBits +=
+          vecType.getNumElements() * vecType.getElementTypeBitWidth();
+    }
+    if (pressure.exceeds(getRegisterFileSize(AIEML))) {
+      LLVM_DEBUG(llvm::dbgs() << "\n\nNot carrying the registers of " << forOp
+                              << " across iterations, it would spill");
+      return;
+    }
+  }
+
+  // Load the registers of the first iteration before the loop
+  OpBuilder builder(forOp);
+  Location loc = forOp.getLoc();
+  SmallVector<Value, 4> inits(forOp.getIterOperands().begin(),
+                              forOp.getIterOperands().end());
+  for (auto &c : carried) {
+    aievec::UPDOp root = c.chain.root;
+    SmallVector<Value, 4> indices(c.chain.outerIndices);
+    indices.push_back(
+        builder.create<arith::ConstantIndexOp>(loc, *lb + c.chain.ivOffset));
+    Type vecType = root.getResult().getType();
+    if (c.lowerHalf) {
+      // only the upper half of the carried register is used
+      inits.push_back(builder.create<aievec::UPDOp>(
+          loc, vecType, root.getSource(), indices, root.getOffset(), 1));
+      continue;
+    }
+    aievec::UPDOp init =
+        builder.create<aievec::UPDOp>(loc, vecType, root.getSource(), indices,
+                                      root.getOffset(), root.getIndex());
+    if (c.chain.halves)
+      init = builder.create<aievec::UPDOp>(
+          loc, vecType, root.getSource(), indices, c.chain.last.getOffset(), 1,
+          init.getResult());
+    inits.push_back(init);
+  }
+
+  // Create the loop with the carried registers as additional iter_args, and
+  // move the body into it
+  auto newForOp = builder.create<scf::ForOp>(
+      loc, forOp.getLowerBound(), forOp.getUpperBound(), forOp.getStep(),
+      inits);
+  Block *newBody = newForOp.getBody();
+  newBody->clear();
+  newBody->getOperations().splice(newBody->end(), body->getOperations());
+  for (auto [oldArg, newArg] :
+       llvm::zip(body->getArguments(), newBody->getArguments()))
+    oldArg.replaceAllUsesWith(newArg);
+  Operation *yield = newBody->getTerminator();
+  SmallVector<Value, 8> yields;
+  for (auto &c : carried)
+    yields.push_back(c.from.getResult());
+  yield->insertOperands(yield->getNumOperands(), yields);
+  for (auto [oldResult, newResult] :
+       llvm::zip(forOp.getResults(), newForOp.getResults()))
+    oldResult.replaceAllUsesWith(newResult);
+  forOp.erase();
+
+  // Use the carried registers instead of loading them
+  unsigned firstCarried = newForOp.getNumRegionIterArgs() - carried.size();
+  for (unsigned i = 0; i < carried.size(); i++) {
+    CarriedChain &c = carried[i];
+    Value carriedValue = newForOp.getRegionIterArgs()[firstCarried + i];
+    LLVM_DEBUG(llvm::dbgs() << "\n\nCarrying "
+                            << (c.lowerHalf ? "half of " : "")
+                            << c.chain.last << " across iterations");
+    if (c.lowerHalf) {
+      // The lower half comes from the upper half of the carried register
+      builder.setInsertionPoint(c.chain.last);
+      VectorType vecType = carriedValue.getType().cast<VectorType>();
+      VectorType halfType = createVectorType(vecType.getNumElements() / 2,
+                                             vecType.getElementType());
+      Value upper = builder.create<aievec::ExtOp>(loc, halfType, carriedValue,
+                                                  1);
+      Value window = builder.create<aievec::ConcatOp>(
+          loc, vecType, SmallVector<Value, 2>({upper, upper}));
+      c.chain.last.getVectorMutable().assign(window);
+      c.chain.root.erase();
+      continue;
+    }
+    c.chain.last.getResult().replaceAllUsesWith(carriedValue);
+    c.chain.last.erase();
+    if (c.chain.halves)
+      c.chain.root.erase();
+  }
+}
+
+// Carry the vector registers of the innermost loops of the function across
+// their iterations.
+static void reuseUPDsAcrossIterationsInFunc(func::FuncOp func,
+                                            bool limitPressure) {
+  SmallVector<scf::ForOp, 8> loops;
+  func.walk([&](scf::ForOp forOp) { loops.push_back(forOp); });
+  for (scf::ForOp forOp : loops)
+    reuseUPDsAcrossIterations(forOp, limitPressure);
+}
+
+// Generate the AIE vector intrinsics of func, fusing chains of at most
+// state->maxFusedCols FMA ops
+static LogicalResult vectorizeFunc(func::FuncOp func, VectState *state) {
+  // record the sext op and its operand's def op to sextTruncDefMap
+  recordSextOps(func, state);
+
+  // First compute the loops surrounding each load/store operation. This is
+  // necessary to identify loads/stores that are nested together.
+  for (AffineForOp forOp : func.getOps<AffineForOp>()) {
+    SmallVector<Operation *, 8> enclosingLoops;
+    enclosingLoops.push_back(forOp);
+    computeEnclosingLoopsPerBlock(forOp, state, enclosingLoops);
+  }
+
+  // Check whether there is any unalignment loads.
+  if (unalignedLoadsCheck && failed(hasUnalignedLoads(func, state))) {
+    func.emitError() << "Cannot apply aie-vectorize to " << func->getName()
+                     << " because alignment check has failed.\n";
+    return failure();
+  }
+
+  // Compute the reuse for all the transfer_read operations, and form the
+  // initial vector sizes.
+  computeReuseInFunc(func, state);
+  // We leverage the assumption that pointwise addition and multiplication
+  // are commutative and associative to reassociate the operands of some
+  // operators. This IR massaging makes it feasible to generate aie dialect
+  // fma/msc intrinsics.
+  reassociateOpsInFunc(func, state);
+  // Rewrite vector dialect add and mul operation chains as vector dialect
+  // fma operation if feasible.
+  rewriteFMAOpsInFunc(func, state);
+  // Coalesce vectors that only appear as LHS operands of mul/fma op if their
+  // size is <= 256 bits.
+  coalesceLHSOpVectorsInFunc(func, state);
+  // Check for opportunities of fusing FMA ops to exploit the column topology
+  // of the AIE vector intrinsic.
+  fuseFMAOpsForColumnTopology(func, state);
+  // Spread the remaining chains of dependent FMA ops over independent
+  // accumulators, to keep the MAC pipeline busy.
+  interleaveFMAChainsInFunc(func, state);
+  // For each vector dialect mul/fma op, compute the start and offset values
+  // of its operands. Finally, generate AIE dialect mul/FMA ops.
+  generateAIEMulOrFMAOpsInFunc(func, state);
+  // Insert SRS ops to move data from accumulator to vector when the producer
+  // is an AIE dialect op that writes to an accumulator, and the consumer
+  // isn't an AIE dialect op.
+  insertSRSOpsInFunc(func, state);
+  // For each vector dialect add/sub op, compute the start and offset values
+  // of its operands. Finally, generate AIE dialect add/sub ops. This should
+  // be done after srs ops are generated, so that the input to the add op is
+  // always vectors.
+  generateAIEAddOrSubOpsInFunc(func, state);
+  // Generate UPD ops that subsume all the transfer_read ops in affine
+  // dialect. This happens after generating aie dialect add/sub ops because
+  // those ops need to query transfer reads to know if their operand is
+  // splat.
+  insertUPDOpsInFunc(func, state);
+  // Check for the opportunities of fusing Mul and FMA ops by Mul_Conv or
+  // FMA_Conv.
+  if (AIEML)
+    fuseMulFMAOpsByMulFMAConv(func, state);
+  return success();
+}
+
+// Return the number of bits of pressure that do not fit in capacity
+static unsigned getSpilledBits(const RegisterPressure &pressure,
+                               const RegisterPressure &capacity) {
+  unsigned spilled = 0;
+  if (pressure.vectorBits > capacity.vectorBits)
+    spilled += pressure.vectorBits - capacity.vectorBits;
+  if (pressure.accBits > capacity.accBits)
+    spilled += pressure.accBits - capacity.accBits;
+  return spilled;
+}
+
 struct AIEVectorize : public AIEVectorizeBase<AIEVectorize> {
   AIEVectorize() = default;
   void runOnOperation() override;
@@ -3000,76 +3757,87 @@ void AIEVectorize::runOnOperation() {
 
   ModuleOp module = getOperation();
 
+  // Move the iterations past the last full vector of the vectorized loops to
+  // scalar epilogues, before all the transfer ops are assumed in bounds.
+  if (peelRemainder)
+    for (func::FuncOp func : module.getOps<func::FuncOp>())
+      peelRemainderIterations(func);
+
   // Canonicalize the incoming IR, mostly to simplify affine/compose apply ops
   preCanonicalizeIR(module);
 
   // Iterate over all the functions in this module, and vectorize them
+  RegisterPressure capacity = getRegisterFileSize(AIEML);
   for (func::FuncOp func : module.getOps<func::FuncOp>()) {
+    // Keep the function as it is, to vectorize it again with shorter chains
+    // of fused FMA ops if it would spill.
+    func::FuncOp original = limitRegisterPressure ? func.clone() : nullptr;
+
     // Create a new global state
     VectState *state =
-        new VectState(func.getContext(), shiftParam, zeroOffset, dupFactor);
-
-    // record the sext op and its operand's def op to sextTruncDefMap
-    recordSextOps(func, state);
-
-    // First compute the loops surrounding each load/store operation. This is
-    // necessary to identify loads/stores that are nested together.
-    for (AffineForOp forOp : func.getOps<AffineForOp>()) {
-      SmallVector<Operation *, 8> enclosingLoops;
-      enclosingLoops.push_back(forOp);
-      computeEnclosingLoopsPerBlock(forOp, state, enclosingLoops);
-    }
-
-    // Check whether there is any unalignment loads.
-    if (unalignedLoadsCheck && failed(hasUnalignedLoads(func, state))) {
-      func.emitError() << "Cannot apply aie-vectorize to " << func->getName()
-                       << " because alignment check has failed.\n";
+        new VectState(func.getContext(), shiftParam, zeroOffset, dupFactor,
+                      std::numeric_limits<int32_t>::max(), numAccumulators);
+    if (failed(vectorizeFunc(func, state))) {
+      if (original)
+        original.erase();
       return;
     }
+    if (!original)
+      continue;
 
-    // Compute the reuse for all the transfer_read operations, and form the
-    // initial vector sizes.
-    computeReuseInFunc(func, state);
-    // We leverage the assumption that pointwise addition and multiplication
-    // are commutative and associative to reassociate the operands of some
-    // operators. This IR massaging makes it feasible to generate aie dialect
-    // fma/msc intrinsics.
-    reassociateOpsInFunc(func, state);
-    // Rewrite vector dialect add and mul operation chains as vector dialect
-    // fma operation if feasible.
-    rewriteFMAOpsInFunc(func, state);
-    // Coalesce vectors that only appear as LHS operands of mul/fma op if their
-    // size is <= 256 bits.
-    coalesceLHSOpVectorsInFunc(func, state);
-    // Check for opportunities of fusing FMA ops to exploit the column topology
-    // of the AIE vector intrinsic.
-    fuseFMAOpsForColumnTopology(func, state);
-    // For each vector dialect mul/fma op, compute the start and offset values
-    // of its operands. Finally, generate AIE dialect mul/FMA ops.
-    generateAIEMulOrFMAOpsInFunc(func, state);
-    // Insert SRS ops to move data from accumulator to vector when the producer
-    // is an AIE dialect op that writes to an accumulator, and the consumer
-    // isn't an AIE dialect op.
-    insertSRSOpsInFunc(func, state);
-    // For each vector dialect add/sub op, compute the start and offset values
-    // of its operands. Finally, generate AIE dialect add/sub ops. This should
-    // be done after srs ops are generated, so that the input to the add op is
-    // always vectors.
-    generateAIEAddOrSubOpsInFunc(func, state);
-    // Generate UPD ops that subsume all the transfer_read ops in affine
-    // dialect. This happens after generating aie dialect add/sub ops because
-    // those ops need to query transfer reads to know if their operand is
-    // splat.
-    insertUPDOpsInFunc(func, state);
-    // Check for the opportunities of fusing Mul and FMA ops by Mul_Conv or
-    // FMA_Conv.
-    if (AIEML)
-      fuseMulFMAOpsByMulFMAConv(func, state);
+    // Halve the fused chains for as long as the estimated register pressure
+    // goes down.
+    unsigned spilled =
+        getSpilledBits(estimateRegisterPressure(func, AIEML), capacity);
+    int32_t fusedCols = state->fusedCols;
+    while (spilled && fusedCols > 1) {
+      func::FuncOp candidate = original.clone();
+      VectState *candidateState =
+          new VectState(func.getContext(), shiftParam, zeroOffset, dupFactor,
+                        fusedCols / 2, numAccumulators);
+      if (failed(vectorizeFunc(candidate, candidateState))) {
+        candidate.erase();
+        break;
+      }
+      unsigned candidateSpilled = getSpilledBits(
+          estimateRegisterPressure(candidate, AIEML), capacity);
+      if (candidateSpilled >= spilled) {
+        candidate.erase();
+        break;
+      }
+      LLVM_DEBUG(llvm::dbgs() << "\n\nFusing at most " << fusedCols / 2
+                              << " FMA ops in " << func.getName()
+                              << " to lower the register pressure");
+      func.getBody().takeBody(candidate.getBody());
+      candidate.erase();
+      spilled = candidateSpilled;
+      fusedCols = fusedCols / 2;
+    }
+    original.erase();
   }
 
   // Canonicalize the IR of all the functions in the module by running a set of
   // cleanup passes.
   postCanonicalizeIR(module);
+
+  // Carry the vector registers of sliding windows across the iterations of
+  // the innermost loops, which are scf.for loops after canonicalization.
+  if (crossIterationReuse)
+    for (func::FuncOp func : module.getOps<func::FuncOp>())
+      reuseUPDsAcrossIterationsInFunc(func, limitRegisterPressure);
+
+  // Flag the kernels whose live vectors and accumulators do not fit in the
+  // registers, which the backend will have to spill to the stack.
+  for (func::FuncOp func : module.getOps<func::FuncOp>()) {
+    RegisterPressure pressure = estimateRegisterPressure(func, AIEML);
+    if (!pressure.exceeds(capacity))
+      continue;
+    func.emitRemark() << "kernel will likely spill: up to "
+                      << pressure.vectorBits << " vector bits (of "
+                      << capacity.vectorBits << ") and " << pressure.accBits
+                      << " accumulator bits (of " << capacity.accBits
+                      << ") are live at once";
+  }
 }
 
 std::unique_ptr<Pass> xilinx::aievec::createAIEVectorizePass() {
@@ -14,14 +14,17 @@
 #include "aie/Dialect/AIEVec/AIEVecUtils.h"
 #include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
 #include "aie/Dialect/AIEVec/Pipelines/Passes.h"
+#include "mlir/Conversion/AffineToStandard/AffineToStandard.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Vector/Transforms/VectorTransforms.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/TypeUtilities.h"
 #include "mlir/Pass/PassManager.h"
+#include "mlir/Pass/PassRegistry.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "mlir/Transforms/Passes.h"
+#include "llvm/Support/FormatVariadic.h"
 
 #include "AIEVecOptimizations.h"
 #include "VectorToAIEVecConversions.h"
@@ -143,6 +146,41 @@ void xilinx::aievec::buildConvertVectorToAIEVec(
   pm.addPass(createCanonicalizerPass());
 }
 
+void xilinx::aievec::buildTosaToAIEVec(OpPassManager &pm,
+                                       const TosaToAIEVecOptions &options) {
+  //============================================================================
+  // TOSA to Vector: TOSA to fused Linalg, bufferized and vectorized.
+  //============================================================================
+
+  // NOTE: The elementwise ops of the graph, and the broadcasts feeding them,
+  // NOTE: are fused in a single linalg.generic op before bufferization, so
+  // NOTE: that they become a single loop nest reading each input and
+  // NOTE: writing each output only once.
+  std::string pipeline = llvm::formatv(
+      "func.func(tosa-to-linalg-named, tosa-to-linalg, tosa-to-tensor), "
+      "linalg-fuse-elementwise-ops, linalg-fold-unit-extent-dims, "
+      "eliminate-empty-tensors, empty-tensor-to-alloc-tensor, "
+      "one-shot-bufferize{{allow-return-allocs allow-unknown-ops "
+      "bufferize-function-boundaries "
+      "function-boundary-type-conversion=identity-layout-map "
+      "unknown-type-conversion=identity-layout-map}, "
+      "drop-equivalent-buffer-results, buffer-results-to-out-params, "
+      "func.func(buffer-deallocation), canonicalize, cse, "
+      "func.func(convert-linalg-to-affine-loops, "
+      "affine-super-vectorize{{virtual-vector-size={0}})",
+      options.vectorSize.getValue());
+  if (failed(parsePassPipeline(pipeline, pm)))
+    llvm::report_fatal_error("tosa-to-aievec needs the TOSA, Linalg, "
+                             "bufferization and affine passes registered");
+
+  //============================================================================
+  // Vector to AIEVec: all the AIEVec pipeline, then the affine loops to scf.
+  //============================================================================
+
+  buildConvertVectorToAIEVec(pm, options);
+  pm.addPass(createLowerAffinePass());
+}
+
 //===---------------------------------------------------------------------------
 // Pipeline registration
 //===---------------------------------------------------------------------------
@@ -172,4 +210,12 @@ void xilinx::aievec::registerAIEVecPipelines() {
       "This pass pipeline takes AIE vector code and applies target-specific "
       "optimizations.",
       buildOptimizeAIEVec);
+
+  PassPipelineRegistration<TosaToAIEVecOptions>(
+      "tosa-to-aievec",
+      "This pass pipeline takes a graph of \"TOSA\" ops, fuses its "
+      "elementwise ops and broadcasts in \"Linalg\", and converts it to "
+      "\"AIEVec\" code targeting the selected Xilinx AIE vector "
+      "architecture.",
+      buildTosaToAIEVec);
 }
@@ -38,6 +38,15 @@ namespace xilinx::aievec {
 #include "aie/Dialect/AIEVec/Analysis/Passes.h.inc"
 } // namespace xilinx::aievec
 
+/// Return the shape {M, N} of the convolution ops for a signal of type
+/// signalType: M outputs of N filter taps each, which is 32x8 for i8 and 16x4
+/// for i16 signals.
+static std::pair<int64_t, int64_t> getConvOpShape(VectorType signalType) {
+  if (getElementSizeInBits(signalType) == 8)
+    return {32, 8};
+  return {16, 4};
+}
+
 /// This analysis builds the longest possible chain of MAC operations whose
 /// operands are a vector that may or may not be shifted, and a broadcast.
 /// That is, these MACs represent `vector x scalar` ops, and are candidates to
@@ -152,10 +161,7 @@ struct LongestConvMACChainAnalysis {
     for (const auto &convMac : *convMacChain) {
       if (grpCurIdx > grpStartIdx) {
         if (curLhs != convMac->lhs || curRhs != convMac->rhs) {
-          groupsInChain.push_back({grpStartIdx, grpCurIdx,
-                                   getGroupSignalShift(grpStartIdx, grpCurIdx),
-                                   getGroupBcastShift(grpStartIdx, grpCurIdx),
-                                   getGroupBcastDist(grpStartIdx, grpCurIdx)});
+          addGroups(grpStartIdx, grpCurIdx);
           grpStartIdx = grpCurIdx;
           curLhs = convMac->lhs;
           curRhs = convMac->rhs;
@@ -164,13 +170,25 @@ struct LongestConvMACChainAnalysis {
       grpCurIdx++;
     }
     if (grpStartIdx < grpCurIdx)
-      groupsInChain.push_back({grpStartIdx, grpCurIdx,
-                               getGroupSignalShift(grpStartIdx, grpCurIdx),
-                               getGroupBcastShift(grpStartIdx, grpCurIdx),
-                               getGroupBcastDist(grpStartIdx, grpCurIdx)});
+      addGroups(grpStartIdx, grpCurIdx);
     return groupsInChain;
   }
 
+  // Add the MACs in [fromIdx, toIdx) of the chain, which share their sources,
+  // to the list of groups. A filter wider than the convolution ops is split
+  // into groups of N MACs, followed by a group with the remaining MACs.
+  void addGroups(uint64_t fromIdx, uint64_t toIdx) {
+    auto signalVecTy = cast<VectorType>((*convMacChain)[fromIdx]->lhs.getType());
+    uint64_t N = getConvOpShape(signalVecTy).second;
+    for (uint64_t grpFromIdx = fromIdx; grpFromIdx < toIdx; grpFromIdx += N) {
+      uint64_t grpToIdx = std::min(toIdx, grpFromIdx + N);
+      groupsInChain.push_back({grpFromIdx, grpToIdx,
+                               getGroupSignalShift(grpFromIdx, grpToIdx),
+                               getGroupBcastShift(grpFromIdx, grpToIdx),
+                               getGroupBcastDist(grpFromIdx, grpToIdx)});
+    }
+  }
+
   // Return the signal shift for the group in the MAC chain in [fromIdx, toIdx)
   // the top. This method verifies that the elements of the signal are
   // contiguously accessed. If they do not, or the specified group doesn't
@@ -219,10 +237,18 @@ struct LongestConvMACChainAnalysis {
     const auto &groups = getGroupsInChain();
     if (groups.size() == 0)
       return false;
-    for (const auto &group : groups)
+    for (const auto &group : groups) {
       if (group.signalShift == -1 || group.bcastShift == -1 ||
           group.bcastDist == -1)
         return false;
+      // The shifted signal must still hold all the elements the convolution
+      // op reads.
+      auto signalVecTy =
+          cast<VectorType>((*convMacChain)[group.fromIdx]->lhs.getType());
+      auto [M, N] = getConvOpShape(signalVecTy);
+      if (group.signalShift + M + N - 1 > signalVecTy.getNumElements())
+        return false;
+    }
     return true;
   }
 
@@ -419,8 +445,7 @@ struct FoldMulAddChainToConvOpPattern
     VectorType vecTy = cast<VectorType>(srcOp.getResult().getType());
     unsigned elemWidth = cast<IntegerType>(vecTy.getElementType()).getWidth();
     unsigned accWidth = elemWidth <= 8 ? 32 : 64;
-    int32_t M = elemWidth == 8 ? 32 : 16;
-    int32_t N = elemWidth == 8 ? 8 : 4;
+    auto [M, N] = getConvOpShape(vecTy);
 
     Type wideElemTy = IntegerType::get(getContext(), accWidth);
     Type accVecTy = VectorType::get(vecTy.getShape(), wideElemTy);
@@ -469,6 +494,31 @@ struct FoldMulAddChainToConvOpPattern
                                               shiftBytesCst)
                      .getResult();
       }
+      // If the group has fewer MACs than the convolution op has filter taps,
+      // i.e., it is a narrow filter or the remainder of a wide one, zero the
+      // taps past the group: they hold the coefficients of other MACs.
+      int64_t numTaps = group.toIdx - group.fromIdx;
+      if (numTaps < N) {
+        auto rhsVecTy = cast<VectorType>(grpRhs.getType());
+        int64_t elemBytes = getElementSizeInBits(rhsVecTy) / 8;
+        int64_t lanes = rhsVecTy.getNumElements();
+        auto zeroCst = rewriter.create<arith::ConstantOp>(
+            loc, rhsVecTy, rewriter.getZeroAttr(rhsVecTy));
+        // [0, ..., 0, f_0, ..., f_numTaps-1]
+        auto tapsBytesCst = rewriter.create<arith::ConstantOp>(
+            loc, rewriter.getI32IntegerAttr(numTaps * elemBytes));
+        grpRhs = rewriter
+                     .create<aievec::ShiftOp>(loc, rhsVecTy, zeroCst, grpRhs,
+                                              tapsBytesCst)
+                     .getResult();
+        // [f_0, ..., f_numTaps-1, 0, ..., 0]
+        auto restBytesCst = rewriter.create<arith::ConstantOp>(
+            loc, rewriter.getI32IntegerAttr((lanes - numTaps) * elemBytes));
+        grpRhs = rewriter
+                     .create<aievec::ShiftOp>(loc, rhsVecTy, grpRhs, zeroCst,
+                                              restBytesCst)
+                     .getResult();
+      }
       // Sort out the vector used as signal
       // If the signal to be convolved doesn't start at element 0, shift the
       // signal to align the first element to the beginning.
@@ -20,6 +20,7 @@
 #include "aie/Dialect/AIEVec/AIEVecUtils.h"
 #include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
 #include "aie/Dialect/AIEVec/Pipelines/Passes.h"
+#include "aie/Dialect/AIEVec/Utils/CostModel.h"
 #include "aie/Dialect/AIEVec/Utils/Utils.h"
 #include "mlir/Dialect/Affine/IR/AffineOps.h"
 #include "mlir/Dialect/EmitC/IR/EmitC.h"
@@ -27,6 +28,8 @@
 #include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/TypeUtilities.h"
 #include "mlir/Pass/PassManager.h"
@@ -161,6 +164,26 @@ convertValueToTargetTypeAieML(ConversionPatternRewriter &rewriter, Location loc,
   return std::nullopt;
 }
 
+// Return the offset of the window a `vector.shuffle` op selects out of the
+// concatenation of its two 1D operands, if it selects consecutive elements
+// straddling both of them into a vector of the same type, as generated for
+// unaligned transfer reads.
+static std::optional<int64_t>
+getShuffleWindowOffset(vector::ShuffleOp shuffleOp) {
+  auto vType = shuffleOp.getV1VectorType();
+  if (vType.getRank() != 1 || shuffleOp.getV2VectorType() != vType ||
+      shuffleOp.getVectorType() != vType)
+    return std::nullopt;
+  auto mask = shuffleOp.getMask();
+  int64_t offset = cast<IntegerAttr>(mask[0]).getInt();
+  if (offset <= 0 || offset >= vType.getNumElements())
+    return std::nullopt;
+  for (auto [i, attr] : llvm::enumerate(mask))
+    if (cast<IntegerAttr>(attr).getInt() != offset + (int64_t)i)
+      return std::nullopt;
+  return offset;
+}
+
 // Return the list of attributes that configure an `aievec.select` op to
 // perform a rotation of the input vector by `rotation` number of elements.
 // The attribute values depend on the vector type of the select operation.
@@ -407,6 +430,70 @@ static void generateAIEVecOpsForReductionOp(ConversionPatternRewriter &rewriter,
   return;
 }
 
+// Return the operand of a matrix multiplication before it was extended to the
+// element type of the accumulator, as the MMUL unit multiplies the narrow
+// elements into wide accumulators.
+static Value getMatMulOperand(Value operand) {
+  if (auto extOp = operand.getDefiningOp<arith::ExtSIOp>())
+    return extOp.getIn();
+  if (auto extOp = operand.getDefiningOp<arith::ExtFOp>())
+    return extOp.getIn();
+  return operand;
+}
+
+// If the `vector.contract` is the product of a row-major (M x K)matrix and a
+// row-major (K x N)matrix accumulated into a row-major (M x N)matrix, and an
+// AIE-ML MMUL instruction has the same shape and element types, return its
+// shape {M, K, N}. The contractions of the 1-D convolutions of a single batch
+// of M pixels of K channels with a (K x N) filter, as linalg vectorizes them,
+// are such products too, with (1 x M x K) pixels and (1 x M x N) outputs: the
+// channels of M consecutive pixels and their filter taps are contiguous in the
+// data layouts blocked by K input and N output channels.
+static std::optional<std::array<int64_t, 3>>
+getAIEMLMatMulShape(vector::ContractionOp contractOp) {
+  if (contractOp.getKind() != vector::CombiningKind::ADD)
+    return std::nullopt;
+  auto lhsType = dyn_cast<VectorType>(
+      getMatMulOperand(contractOp.getLhs()).getType());
+  auto rhsType = dyn_cast<VectorType>(
+      getMatMulOperand(contractOp.getRhs()).getType());
+  auto accType = dyn_cast<VectorType>(contractOp.getAccType());
+  if (!lhsType || !rhsType || !accType)
+    return std::nullopt;
+
+  MLIRContext *context = contractOp.getContext();
+  auto maps = contractOp.getIndexingMapsArray();
+  AffineExpr m, n, k;
+  bindDims(context, m, n, k);
+  AffineExpr b, w, f, c;
+  bindDims(context, b, w, f, c);
+  auto matMulMaps = AffineMap::inferFromExprList({{m, k}, {k, n}, {m, n}});
+  auto convMaps =
+      AffineMap::inferFromExprList({{b, w, c}, {c, f}, {b, w, f}});
+  SmallVector<int64_t> batch;
+  if (maps == ArrayRef<AffineMap>(convMaps))
+    batch.push_back(1);
+  else if (maps != ArrayRef<AffineMap>(matMulMaps))
+    return std::nullopt;
+
+  auto shape =
+      getAIEMLMatMulShape(lhsType.getElementType(), rhsType.getElementType(),
+                          accType.getElementType());
+  if (!shape)
+    return std::nullopt;
+  auto [M, K, N] = *shape;
+  auto withBatch = [&](std::initializer_list<int64_t> dims) {
+    SmallVector<int64_t> result(batch);
+    result.append(dims);
+    return result;
+  };
+  if (lhsType.getShape() != ArrayRef<int64_t>(withBatch({M, K})) ||
+      rhsType.getShape() != ArrayRef<int64_t>({K, N}) ||
+      accType.getShape() != ArrayRef<int64_t>(withBatch({M, N})))
+    return std::nullopt;
+  return shape;
+}
+
 //===----------------------------------------------------------------------===//
 // Analyses
 //===----------------------------------------------------------------------===//
@@ -612,6 +699,151 @@ struct ConvertMulAddToAIEVecFMAElemOpPattern
   unsigned shiftParam;
 };
 
+// Replace `op`, computing `lhs * rhs + acc` on a 16-lane vector of bf16 or
+// f32, with an `aievec.mac_elem` on bf16 operands and an fp32 accumulator.
+// The multiplicands must be bf16 vectors, or f32 vectors extended from bf16
+// vectors. A bf16 accumulator goes through `aievec.ups`/`aievec.srs`, an f32
+// one through `aievec.cast`.
+static LogicalResult
+genBf16FMAElemAieML(ConversionPatternRewriter &rewriter, Operation *op,
+                    Value lhs, Value rhs, Value acc, unsigned shiftParam) {
+  VectorType resultType = dyn_cast<VectorType>(op->getResult(0).getType());
+  if (!resultType || getVectorLaneSize(resultType) != 16)
+    return failure();
+  Type resultElType = resultType.getElementType();
+  if (!resultElType.isBF16() && !resultElType.isF32())
+    return failure();
+
+  lhs = getMatMulOperand(lhs);
+  rhs = getMatMulOperand(rhs);
+  VectorType lhsType = cast<VectorType>(lhs.getType());
+  if (lhsType != rhs.getType() || !lhsType.getElementType().isBF16())
+    return failure();
+
+  Location loc = op->getLoc();
+  VectorType inputType = createVectorType(32, lhsType.getElementType());
+  auto lhsX2 = convertValueToTargetTypeAieML(rewriter, loc, lhs, inputType);
+  auto rhsX2 = convertValueToTargetTypeAieML(rewriter, loc, rhs, inputType);
+  if (!lhsX2 || !rhsX2)
+    return failure();
+
+  Type accType = getVectorOpDestType(lhsType, /*AIEML =*/true);
+  Value accIn;
+  if (resultElType.isBF16())
+    accIn = rewriter.create<aievec::UPSOp>(loc, accType, acc, shiftParam);
+  else
+    accIn = rewriter.create<aievec::CastOp>(loc, resultType, acc,
+                                            /*isResAcc*/ true);
+  auto fmaElemOp = rewriter.create<aievec::FMAElemOp>(
+      loc, accType, *lhsX2, *rhsX2, accIn, /*fmsub=*/false);
+  if (resultElType.isBF16())
+    rewriter.replaceOpWithNewOp<aievec::SRSOp>(
+        op, resultType, fmaElemOp.getResult(), shiftParam);
+  else
+    rewriter.replaceOpWithNewOp<aievec::CastOp>(
+        op, resultType, fmaElemOp.getResult(), /*isResAcc*/ false);
+  return success();
+}
+
+// This pattern replaces `arith.mulf`+`arith.addf` on vectors of bf16, or on
+// vectors of f32 extended from bf16, with `aievec.mac_elem`. This pattern
+// works for aie-ml.
+struct ConvertMulAddFToAIEVecFMAElemOpPattern
+    : public OpConversionPattern<arith::AddFOp> {
+  using OpConversionPattern<arith::AddFOp>::OpConversionPattern;
+
+  ConvertMulAddFToAIEVecFMAElemOpPattern(MLIRContext *context,
+                                         unsigned shiftParam = 0)
+      : OpConversionPattern<arith::AddFOp>(context), shiftParam(shiftParam) {}
+
+  LogicalResult
+  matchAndRewrite(arith::AddFOp addOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto mulOp = adaptor.getLhs().getDefiningOp<arith::MulFOp>();
+    Value acc = adaptor.getRhs();
+    if (!mulOp) {
+      mulOp = adaptor.getRhs().getDefiningOp<arith::MulFOp>();
+      acc = adaptor.getLhs();
+    }
+    if (!mulOp || !mulOp->hasOneUse())
+      return failure();
+
+    return genBf16FMAElemAieML(rewriter, addOp, mulOp.getLhs(),
+                               mulOp.getRhs(), acc, shiftParam);
+  }
+
+  unsigned shiftParam;
+};
+
+// This pattern replaces `vector.fma` on vectors of bf16, or on vectors of f32
+// extended from bf16, with `aievec.mac_elem`. This pattern works for aie-ml.
+struct ConvertVectorFMAOpToAIEVecFMAElemOpPattern
+    : public OpConversionPattern<vector::FMAOp> {
+  using OpConversionPattern<vector::FMAOp>::OpConversionPattern;
+
+  ConvertVectorFMAOpToAIEVecFMAElemOpPattern(MLIRContext *context,
+                                             unsigned shiftParam = 0)
+      : OpConversionPattern<vector::FMAOp>(context), shiftParam(shiftParam) {}
+
+  LogicalResult
+  matchAndRewrite(vector::FMAOp fmaOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    return genBf16FMAElemAieML(rewriter, fmaOp, adaptor.getLhs(),
+                               adaptor.getRhs(), adaptor.getAcc(), shiftParam);
+  }
+
+  unsigned shiftParam;
+};
+
+// This pattern replaces `arith.extf` from a vector of bf16 to a vector of f32
+// with `aievec.ups` to an fp32 accumulator and `aievec.cast`. This pattern
+// works for aie-ml.
+struct LowerVectorExtFOpToAIEVecUPSOp
+    : public OpConversionPattern<arith::ExtFOp> {
+  using OpConversionPattern<arith::ExtFOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(arith::ExtFOp extOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    VectorType srcType = dyn_cast<VectorType>(adaptor.getIn().getType());
+    if (!srcType || getVectorLaneSize(srcType) != 16 ||
+        !srcType.getElementType().isBF16() ||
+        !getElementTypeOrSelf(extOp.getType()).isF32())
+      return failure();
+
+    Type accType = getVectorOpDestType(srcType, /*AIEML =*/true);
+    auto upsOp = rewriter.create<aievec::UPSOp>(extOp.getLoc(), accType,
+                                                adaptor.getIn());
+    rewriter.replaceOpWithNewOp<aievec::CastOp>(
+        extOp, extOp.getType(), upsOp.getResult(), /*isResAcc*/ false);
+    return success();
+  }
+};
+
+// This pattern replaces `arith.truncf` from a vector of f32 to a vector of
+// bf16 with `aievec.cast` to an fp32 accumulator and `aievec.srs`. This
+// pattern works for aie-ml.
+struct LowerVectorTruncFOpToAIEVecSRSOp
+    : public OpConversionPattern<arith::TruncFOp> {
+  using OpConversionPattern<arith::TruncFOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(arith::TruncFOp truncOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    VectorType srcType = dyn_cast<VectorType>(adaptor.getIn().getType());
+    if (!srcType || getVectorLaneSize(srcType) != 16 ||
+        !srcType.getElementType().isF32() ||
+        !getElementTypeOrSelf(truncOp.getType()).isBF16())
+      return failure();
+
+    auto castOp = rewriter.create<aievec::CastOp>(
+        truncOp.getLoc(), srcType, adaptor.getIn(), /*isResAcc*/ true);
+    rewriter.replaceOpWithNewOp<aievec::SRSOp>(truncOp, truncOp.getType(),
+                                               castOp.getResult());
+    return success();
+  }
+};
+
 // This pattern replaces `arith.mulf` on vectors with
 // `aievec.mul_elem`. This pattern works for aie-ml.
 struct ConvertMulFToAIEVecMulElemOpPattern
@@ -630,10 +862,8 @@ struct ConvertMulFToAIEVecMulElemOpPattern
     if (!resultType)
       return failure();
 
-    // FIXME: Verify it is not a part of FMA
-    auto isAddOp = [&](Operation *op) { return isa<arith::AddFOp>(op); };
-    if (mulOp->hasOneUse() && llvm::any_of(mulOp->getUsers(), isAddOp))
-      return failure();
+    // The multiplications folded into a MAC by the following addition are
+    // legal, see configureAIEVecV2Legalizations.
 
     unsigned resultElWidth =
         resultType.getElementType().getIntOrFloatBitWidth();
@@ -727,10 +957,8 @@ struct ConvertMulIToAIEVecMulElemOpPattern
     if (!resultType)
       return failure();
 
-    // FIXME: Verify it is not a part of MAC
-    auto isAddOp = [&](Operation *op) { return isa<arith::AddIOp>(op); };
-    if (mulOp->hasOneUse() && llvm::any_of(mulOp->getUsers(), isAddOp))
-      return failure();
+    // The multiplications folded into a MAC by the following addition are
+    // legal, see configureAIEVecV2Legalizations.
 
     // Verify the vector type is supported by AIEML
     unsigned resultElWidth =
@@ -1647,6 +1875,46 @@ struct LowerVectorReductionAddBfloat16Op
   }
 };
 
+// This pattern replaces a `vector.contract` with the shape and element types
+// of an AIE-ML MMUL instruction, a matrix multiplication or the contraction of
+// a convolution over blocks of channels, with `aievec.matmul`. The operands
+// are flattened into the row-major 1D vectors the instruction works on, and
+// the accumulator is moved into an accumulator register and back. This
+// pattern works for aie-ml.
+struct LowerVectorContractionOpToAIEVecMatMulPattern
+    : public OpConversionPattern<vector::ContractionOp> {
+  using OpConversionPattern<vector::ContractionOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(vector::ContractionOp contractOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto shape = getAIEMLMatMulShape(contractOp);
+    if (!shape)
+      return failure();
+    auto [M, K, N] = *shape;
+
+    Location loc = contractOp.getLoc();
+    auto flatten = [&](Value value) -> Value {
+      auto vType = cast<VectorType>(value.getType());
+      return rewriter.create<vector::ShapeCastOp>(
+          loc,
+          createVectorType(vType.getNumElements(), vType.getElementType()),
+          value);
+    };
+    Value lhs = flatten(getMatMulOperand(adaptor.getLhs()));
+    Value rhs = flatten(getMatMulOperand(adaptor.getRhs()));
+    auto accOp = rewriter.create<aievec::CastOp>(loc, flatten(adaptor.getAcc()),
+                                                 /*isResAcc*/ true);
+    auto matMulOp = rewriter.create<aievec::MatMulOp>(
+        loc, lhs, rhs, accOp.getResult(), M, K, N);
+    auto resultOp = rewriter.create<aievec::CastOp>(loc, matMulOp.getResult(),
+                                                    /*isResAcc*/ false);
+    rewriter.replaceOpWithNewOp<vector::ShapeCastOp>(
+        contractOp, contractOp.getResultType(), resultOp.getResult());
+    return success();
+  }
+};
+
 // Convert a `vector.extract_strided_slice` op on 1D vectors into an
 // `aievec.select` + `aievec.ext` op.
 struct LowerVectorExtractStridedSliceOpAIEv1Pattern
@@ -1733,6 +2001,66 @@ struct LowerVectorExtractStridedSliceOpAIEMLPattern
   }
 };
 
+// Convert a `vector.shuffle` op selecting an unaligned window out of two
+// vectors into an `aievec.concat` + `aievec.select` + `aievec.ext` op.
+struct LowerVectorShuffleOpAIEv1Pattern
+    : public OpConversionPattern<vector::ShuffleOp> {
+  using OpConversionPattern<vector::ShuffleOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(vector::ShuffleOp shuffleOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto offset = getShuffleWindowOffset(shuffleOp);
+    if (!offset)
+      return failure();
+
+    auto vType = shuffleOp.getVectorType();
+    // AIE doesn't support select operations on i8
+    if (getElementSizeInBits(vType) == 8)
+      return shuffleOp.emitError()
+             << "AIEv1 doesn't support select ops on int8 types";
+
+    auto longVecType =
+        VectorType::get(2 * vType.getNumElements(), vType.getElementType());
+    auto concatOp = rewriter.create<aievec::ConcatOp>(
+        shuffleOp.getLoc(), longVecType,
+        SmallVector<Value, 2>({adaptor.getV1(), adaptor.getV2()}));
+    auto selectOp = rewriter.create<aievec::SelectOp>(
+        shuffleOp.getLoc(), longVecType, concatOp.getResult(),
+        buildAttributeListForRotationSelectOp(rewriter, longVecType, *offset));
+    rewriter.replaceOpWithNewOp<aievec::ExtOp>(shuffleOp, vType,
+                                               selectOp.getResult(),
+                                               rewriter.getI8IntegerAttr(0));
+
+    return success();
+  }
+};
+
+// Convert a `vector.shuffle` op selecting an unaligned window out of two
+// vectors into an `aievec.shift` op.
+struct LowerVectorShuffleOpAIEMLPattern
+    : public OpConversionPattern<vector::ShuffleOp> {
+  using OpConversionPattern<vector::ShuffleOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(vector::ShuffleOp shuffleOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto offset = getShuffleWindowOffset(shuffleOp);
+    if (!offset)
+      return failure();
+
+    auto vType = shuffleOp.getVectorType();
+    int32_t shiftBytes = *offset * getElementSizeInBits(vType) / 8;
+    auto shiftBytesConstOp = rewriter.create<arith::ConstantOp>(
+        shuffleOp.getLoc(), rewriter.getIntegerType(32),
+        rewriter.getI32IntegerAttr(shiftBytes));
+    rewriter.replaceOpWithNewOp<aievec::ShiftOp>(
+        shuffleOp, vType, adaptor.getV1(), adaptor.getV2(), shiftBytesConstOp);
+
+    return success();
+  }
+};
+
 // Replaces a short UPD op with a wide one followed by an ext op of the bottom
 // half.
 struct ExpandUPDToUPDAndExtPattern : public OpConversionPattern<aievec::UPDOp> {
@@ -1887,6 +2215,46 @@ struct ComputeInvOpByLUTPattern : public OpConversionPattern<arith::DivFOp> {
   }
 };
 
+// Return true if divOp computes the inverse of a v16bfloat16 or v32bfloat16
+// vector, i.e. divides a splat of 1.0 by it.
+static bool isBf16VectorInverse(arith::DivFOp divOp) {
+  auto vecType = dyn_cast<VectorType>(divOp.getType());
+  if (!vecType || !vecType.getElementType().isBF16())
+    return false;
+  unsigned laneSize = getVectorLaneSize(vecType);
+  return (laneSize == 16 || laneSize == 32) &&
+         matchPattern(divOp.getLhs(), m_OneFloat());
+}
+
+// Convert the inverse of a bf16 vector, as AIE-ML has no vector division, to
+// a function call computing it by Newton-Raphson iterations
+//  %0 = arith.divf %cst, %x : vector<16xbf16>
+// to -
+//  %0 = emitc.call "getInvBf16"(%x) : vector<16xbf16> -> vector<16xbf16>
+struct ComputeVectorInvOpPattern : public OpConversionPattern<arith::DivFOp> {
+  using OpConversionPattern<arith::DivFOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(arith::DivFOp divOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    if (!isBf16VectorInverse(divOp))
+      return failure();
+
+    StringRef includeName = "vec_math.h";
+    ModuleOp moduleOp = divOp->getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(divOp);
+    SmallVector<Value> invOperands = {adaptor.getRhs()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        divOp, TypeRange{divOp.getResult().getType()}, "getInvBf16", nullptr,
+        nullptr, invOperands);
+    return success();
+  }
+};
+
 // Convert math.tanh to a function call to compute tanh(x) by look up tables
 struct ComputeTanhOpByLUTPattern : public OpConversionPattern<math::TanhOp> {
   using OpConversionPattern<math::TanhOp>::OpConversionPattern;
@@ -2030,6 +2398,193 @@ struct ComputeErfOpPattern : public OpConversionPattern<math::ErfOp> {
   }
 };
 
+// Convert math.log to a function call to compute log(x) for v16bfloat16 types
+// by looking up the exponent of x in a table and approximating the log of the
+// mantissa with a polynomial
+struct ComputeLogOpByLUTPattern : public OpConversionPattern<math::LogOp> {
+  using OpConversionPattern<math::LogOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(math::LogOp logOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    VectorType srcType = dyn_cast<VectorType>(logOp.getOperand().getType());
+    if (!srcType || !isa<FloatType>(srcType.getElementType())) {
+      return failure();
+    }
+
+    unsigned laneSize = getVectorLaneSize(srcType);
+    unsigned elWidth = srcType.getElementType().getIntOrFloatBitWidth();
+
+    if (elWidth != 16 || laneSize != 16) {
+      return failure();
+    }
+
+    StringRef includeName = "lut_based_ops.h";
+    ModuleOp moduleOp = logOp->getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(logOp);
+    SmallVector<Value> logOperands = {adaptor.getOperand()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        logOp, TypeRange{logOp.getResult().getType()}, "getLogBf16", nullptr,
+        nullptr, logOperands);
+    return success();
+  }
+};
+
+// Convert math.sin to a function call to compute sin(x) for v16bfloat16 and
+// v32bfloat16 types
+struct ComputeSinOpPattern : public OpConversionPattern<math::SinOp> {
+  using OpConversionPattern<math::SinOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(math::SinOp sinOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    VectorType srcType = dyn_cast<VectorType>(sinOp.getOperand().getType());
+    if (!srcType || !isa<FloatType>(srcType.getElementType())) {
+      return failure();
+    }
+
+    unsigned laneSize = getVectorLaneSize(srcType);
+    unsigned elWidth = srcType.getElementType().getIntOrFloatBitWidth();
+
+    if (elWidth != 16 || (laneSize != 16 && laneSize != 32)) {
+      return failure();
+    }
+
+    StringRef includeName = "vec_math.h";
+    ModuleOp moduleOp = sinOp->getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(sinOp);
+    SmallVector<Value> sinOperands = {adaptor.getOperand()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        sinOp, TypeRange{sinOp.getResult().getType()}, "getSinBf16", nullptr,
+        nullptr, sinOperands);
+    return success();
+  }
+};
+
+// Convert math.cos to a function call to compute cos(x) for v16bfloat16 and
+// v32bfloat16 types
+struct ComputeCosOpPattern : public OpConversionPattern<math::CosOp> {
+  using OpConversionPattern<math::CosOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(math::CosOp cosOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    VectorType srcType = dyn_cast<VectorType>(cosOp.getOperand().getType());
+    if (!srcType || !isa<FloatType>(srcType.getElementType())) {
+      return failure();
+    }
+
+    unsigned laneSize = getVectorLaneSize(srcType);
+    unsigned elWidth = srcType.getElementType().getIntOrFloatBitWidth();
+
+    if (elWidth != 16 || (laneSize != 16 && laneSize != 32)) {
+      return failure();
+    }
+
+    StringRef includeName = "vec_math.h";
+    ModuleOp moduleOp = cosOp->getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(cosOp);
+    SmallVector<Value> cosOperands = {adaptor.getOperand()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        cosOp, TypeRange{cosOp.getResult().getType()}, "getCosBf16", nullptr,
+        nullptr, cosOperands);
+    return success();
+  }
+};
+
+// Whether type is vector<8xf32> or vector<16xf32>, the float vectors the math
+// functions of the AIE1 vec_math.h are implemented for
+static bool isAIEv1FloatVector(Type type) {
+  auto vecType = dyn_cast<VectorType>(type);
+  if (!vecType || !vecType.getElementType().isF32())
+    return false;
+  unsigned laneSize = getVectorLaneSize(vecType);
+  return laneSize == 8 || laneSize == 16;
+}
+
+static bool isAIEv1FloatVectorInverse(arith::DivFOp divOp) {
+  return isAIEv1FloatVector(divOp.getType()) &&
+         matchPattern(divOp.getLhs(), m_OneFloat());
+}
+
+// Convert a math op on the float vectors of AIE1, which has neither bfloat16
+// nor look up tables, to a function call computing it on the floating-point
+// vector unit
+//  %0 = math.rsqrt %x : vector<8xf32>
+// to -
+//  %0 = emitc.call "getRsqrtFloat"(%x) : vector<8xf32> -> vector<8xf32>
+template <typename SrcOpTy>
+struct ComputeFloatOpAIEv1Pattern : public OpConversionPattern<SrcOpTy> {
+  using OpAdaptor = typename SrcOpTy::Adaptor;
+
+  ComputeFloatOpAIEv1Pattern(MLIRContext *context, StringRef funcName)
+      : OpConversionPattern<SrcOpTy>(context), funcName(funcName) {}
+
+  LogicalResult
+  matchAndRewrite(SrcOpTy srcOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    if (!isAIEv1FloatVector(srcOp.getType()))
+      return failure();
+
+    StringRef includeName = "vec_math.h";
+    ModuleOp moduleOp = srcOp->template getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(srcOp);
+    SmallVector<Value> operands = {adaptor.getOperand()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        srcOp, TypeRange{srcOp.getType()}, funcName, nullptr, nullptr,
+        operands);
+    return success();
+  }
+
+  std::string funcName;
+};
+
+// Convert the inverse of a float vector, as AIE1 has no vector division, to
+// a function call computing it by Newton-Raphson iterations
+//  %0 = arith.divf %cst, %x : vector<8xf32>
+// to -
+//  %0 = emitc.call "getInvFloat"(%x) : vector<8xf32> -> vector<8xf32>
+struct ComputeVectorInvOpAIEv1Pattern
+    : public OpConversionPattern<arith::DivFOp> {
+  using OpConversionPattern<arith::DivFOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(arith::DivFOp divOp, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    if (!isAIEv1FloatVectorInverse(divOp))
+      return failure();
+
+    StringRef includeName = "vec_math.h";
+    ModuleOp moduleOp = divOp->getParentOfType<mlir::ModuleOp>();
+    rewriter.setInsertionPointToStart(
+        &moduleOp.getRegion().getBlocks().front());
+    rewriter.create<emitc::IncludeOp>(moduleOp.getLoc(), includeName, false);
+
+    rewriter.setInsertionPoint(divOp);
+    SmallVector<Value> invOperands = {adaptor.getRhs()};
+    rewriter.replaceOpWithNewOp<emitc::CallOp>(
+        divOp, TypeRange{divOp.getResult().getType()}, "getInvFloat", nullptr,
+        nullptr, invOperands);
+    return success();
+  }
+};
+
 //===----------------------------------------------------------------------===//
 // Pattern collection
 //===----------------------------------------------------------------------===//
@@ -2047,8 +2602,21 @@ static void populateAIEVecV1ConversionPatterns(RewritePatternSet &patterns,
                LowerVectorMulFOpToAIEVecMulOp,
                ConvertMulAddToAIEVecFMAOpPattern,
                FoldBroadcastToFMAOp,
-               LowerVectorExtractStridedSliceOpAIEv1Pattern>(patterns.getContext());
+               LowerVectorExtractStridedSliceOpAIEv1Pattern,
+               LowerVectorShuffleOpAIEv1Pattern>(patterns.getContext());
   // clang-format on
+  MLIRContext *context = patterns.getContext();
+  patterns.add<ComputeVectorInvOpAIEv1Pattern>(context);
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::SqrtOp>>(context,
+                                                         "getSqrtFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::RsqrtOp>>(context,
+                                                          "getRsqrtFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::ExpOp>>(context, "getExpFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::TanhOp>>(context,
+                                                         "getTanhFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::ErfOp>>(context, "getErfFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::SinOp>>(context, "getSinFloat");
+  patterns.add<ComputeFloatOpAIEv1Pattern<math::CosOp>>(context, "getCosFloat");
 }
 
 static void populateAIEVecV2ConversionPatterns(RewritePatternSet &patterns,
@@ -2061,10 +2629,14 @@ static void populateAIEVecV2ConversionPatterns(RewritePatternSet &patterns,
       LowerVectorSubIOpToAIEVecSubElemOp,
       ComputeExpOpByLUTPattern,
       ComputeInvOpByLUTPattern,
+      ComputeVectorInvOpPattern,
       ComputeTanhOpByLUTPattern,
       ComputeSqrtOpPattern,
       ComputeRsqrtOpPattern,
       ComputeErfOpPattern,
+      ComputeLogOpByLUTPattern,
+      ComputeSinOpPattern,
+      ComputeCosOpPattern,
       ConvertMulIToAIEVecMulElemOpPattern,
       LowerVectorAddFOpToAIEVecAddElemOp,
       LowerVectorSubFOpToAIEVecSubElemOp,
@@ -2084,7 +2656,13 @@ static void populateAIEVecV2ConversionPatterns(RewritePatternSet &patterns,
       FoldVectorExtractAndBroadcastToAIEBroadcast,
       ConvertBroadcastToAIEBroadcast,
       ConvertMulAddToAIEVecFMAElemOpPattern,
-      LowerVectorExtractStridedSliceOpAIEMLPattern>(patterns.getContext());
+      ConvertMulAddFToAIEVecFMAElemOpPattern,
+      ConvertVectorFMAOpToAIEVecFMAElemOpPattern,
+      LowerVectorExtFOpToAIEVecUPSOp,
+      LowerVectorTruncFOpToAIEVecSRSOp,
+      LowerVectorContractionOpToAIEVecMatMulPattern,
+      LowerVectorExtractStridedSliceOpAIEMLPattern,
+      LowerVectorShuffleOpAIEMLPattern>(patterns.getContext());
   // clang-format on
 }
 
@@ -2099,6 +2677,8 @@ static void configureAIEVecCommonLegalizations(ConversionTarget &target,
                          emitc::EmitCDialect>();
   target.addIllegalOp<vector::TransferReadOp>();
   target.addIllegalOp<vector::ExtractStridedSliceOp>();
+  target.addDynamicallyLegalOp<vector::ShuffleOp>(
+      [](vector::ShuffleOp op) { return !getShuffleWindowOffset(op); });
   target.addDynamicallyLegalOp<math::ExpOp>([](math::ExpOp expOp) {
     VectorType srcType = dyn_cast<VectorType>(expOp.getOperand().getType());
     if (!srcType) {
@@ -2113,6 +2693,9 @@ static void configureAIEVecCommonLegalizations(ConversionTarget &target,
   });
 
   target.addDynamicallyLegalOp<arith::DivFOp>([](arith::DivFOp divOp) {
+    if (isBf16VectorInverse(divOp))
+      return false;
+
     Type srcType = divOp.getLhs().getType();
     if (!divOp->hasOneUse() || isa<VectorType>(srcType) ||
         !isa<FloatType>(srcType)) {
@@ -2202,6 +2785,36 @@ static void configureAIEVecCommonLegalizations(ConversionTarget &target,
     return false;
   });
 
+  target.addDynamicallyLegalOp<math::LogOp>([](math::LogOp logOp) {
+    VectorType srcType = dyn_cast<VectorType>(logOp.getOperand().getType());
+    if (!srcType || !isa<FloatType>(srcType.getElementType())) {
+      return true;
+    }
+
+    unsigned laneSize = getVectorLaneSize(srcType);
+    unsigned elWidth = srcType.getElementType().getIntOrFloatBitWidth();
+    if (elWidth != 16 || laneSize != 16) {
+      return true;
+    }
+
+    return false;
+  });
+
+  target.addDynamicallyLegalOp<math::SinOp, math::CosOp>([](Operation *op) {
+    VectorType srcType = dyn_cast<VectorType>(op->getOperand(0).getType());
+    if (!srcType || !isa<FloatType>(srcType.getElementType())) {
+      return true;
+    }
+
+    unsigned laneSize = getVectorLaneSize(srcType);
+    unsigned elWidth = srcType.getElementType().getIntOrFloatBitWidth();
+    if (elWidth != 16 || (laneSize != 16 && laneSize != 32)) {
+      return true;
+    }
+
+    return false;
+  });
+
   target.addDynamicallyLegalOp<arith::AddIOp>(
       [](arith::AddIOp op) { return !isa<VectorType>(op.getType()); });
   target.addDynamicallyLegalOp<arith::AddFOp>(
@@ -2213,7 +2826,8 @@ static void configureAIEVecCommonLegalizations(ConversionTarget &target,
 }
 
 static void configureAIEVecV1Legalizations(ConversionTarget &target,
-                                           AnalysisManager &am) {
+                                           AnalysisManager &am,
+                                           const AIEVecCostModel &costModel) {
   target.addDynamicallyLegalOp<arith::MulIOp>(
       [](arith::MulIOp op) { return !isa<VectorType>(op.getType()); });
   target.addDynamicallyLegalOp<arith::MulFOp>(
@@ -2242,19 +2856,55 @@ static void configureAIEVecV1Legalizations(ConversionTarget &target,
     }
     return true;
   });
-  target.addDynamicallyLegalOp<aievec::AddOp>([](aievec::AddOp op) {
+  target.addDynamicallyLegalOp<aievec::AddOp>([&](aievec::AddOp op) {
     auto lSrsOp = op.getLhs().getDefiningOp<aievec::SRSOp>();
     auto rSrsOp = op.getRhs().getDefiningOp<aievec::SRSOp>();
-    return (!lSrsOp || !lSrsOp.getSource().getDefiningOp<aievec::MulOp>()) &&
-           (!rSrsOp || !rSrsOp.getSource().getDefiningOp<aievec::MulOp>());
+    if (!lSrsOp || !lSrsOp.getSource().getDefiningOp<aievec::MulOp>())
+      lSrsOp = rSrsOp;
+    if (!lSrsOp || !lSrsOp.getSource().getDefiningOp<aievec::MulOp>())
+      return true;
+    // Fold the multiplication into a MAC unless it is cheaper to keep the
+    // addition, e.g. when the multiplication has other users and stays.
+    SmallVector<StringRef, 6> macOps = {
+        aievec::ConcatOp::getOperationName(), aievec::UPSOp::getOperationName(),
+        aievec::FMAOp::getOperationName(), aievec::SRSOp::getOperationName()};
+    SmallVector<StringRef, 3> mulOps = {aievec::MulOp::getOperationName(),
+                                        aievec::SRSOp::getOperationName()};
+    if (!lSrsOp->hasOneUse() || !lSrsOp.getSource().hasOneUse())
+      macOps.append(mulOps);
+    mulOps.push_back(aievec::AddOp::getOperationName());
+    return !costModel.isNotMoreExpensive(macOps, mulOps);
+  });
+  // The math ops on float vectors are computed by vec_math.h; these replace
+  // the common legality of the ops, whose bfloat16 functions AIE1 has not.
+  target.addDynamicallyLegalOp<math::SqrtOp, math::RsqrtOp, math::ExpOp,
+                               math::TanhOp, math::ErfOp, math::SinOp,
+                               math::CosOp>([](Operation *op) {
+    return !isAIEv1FloatVector(op->getResult(0).getType());
+  });
+  target.addDynamicallyLegalOp<arith::DivFOp>([](arith::DivFOp divOp) {
+    return !isAIEv1FloatVectorInverse(divOp);
   });
   target.addLegalDialect<memref::MemRefDialect>();
 }
 
 static void configureAIEVecV2Legalizations(ConversionTarget &target,
-                                           AnalysisManager &am) {
+                                           AnalysisManager &am,
+                                           const AIEVecCostModel &costModel) {
   target.addLegalOp<UnrealizedConversionCastOp>();
 
+  // A multiplication only used by an addition is left for the addition to
+  // fold it into a MAC, if a MAC is cheaper than a multiplication and an
+  // addition. The conversions to and from the accumulator are needed by
+  // both, and fold with the ones of the neighbouring ops.
+  bool foldMulIntoMAC = costModel.isNotMoreExpensive(
+      {aievec::FMAElemOp::getOperationName()},
+      {aievec::MulElemOp::getOperationName(),
+       aievec::AddElemOp::getOperationName()});
+
+  target.addDynamicallyLegalOp<vector::ContractionOp>(
+      [](vector::ContractionOp op) { return !getAIEMLMatMulShape(op); });
+
   // A set recording the vector lane size and element width supported
   llvm::SmallSet<std::pair<unsigned, unsigned>, 16> laneSizeElWidthPairSet;
   laneSizeElWidthPairSet.insert({64, 8});
@@ -2310,14 +2960,15 @@ static void configureAIEVecV2Legalizations(ConversionTarget &target,
     return laneSize != 16;
   });
 
-  target.addDynamicallyLegalOp<arith::MulIOp>([](arith::MulIOp op) {
+  target.addDynamicallyLegalOp<arith::MulIOp>([=](arith::MulIOp op) {
     auto resultType = dyn_cast<VectorType>(op.getType());
     if (!resultType) {
       return true;
     }
     auto isAddOp = [&](Operation *op) { return isa<arith::AddIOp>(op); };
     // Verify it is not a part of MAC
-    if (op->hasOneUse() && llvm::any_of(op->getUsers(), isAddOp))
+    if (foldMulIntoMAC && op->hasOneUse() &&
+        llvm::any_of(op->getUsers(), isAddOp))
       return true;
 
     auto resultElWidth = resultType.getElementType().getIntOrFloatBitWidth();
@@ -2327,14 +2978,15 @@ static void configureAIEVecV2Legalizations(ConversionTarget &target,
            ((laneSize != 16 && laneSize != 32) || resultElWidth != 32);
   });
 
-  target.addDynamicallyLegalOp<arith::MulFOp>([](arith::MulFOp op) {
+  target.addDynamicallyLegalOp<arith::MulFOp>([=](arith::MulFOp op) {
     auto resultType = dyn_cast<VectorType>(op.getType());
     if (!resultType) {
       return true;
     }
     auto isAddOp = [&](Operation *op) { return isa<arith::AddFOp>(op); };
     // Verify it is not a part of FMA
-    if (op->hasOneUse() && llvm::any_of(op->getUsers(), isAddOp))
+    if (foldMulIntoMAC && op->hasOneUse() &&
+        llvm::any_of(op->getUsers(), isAddOp))
       return true;
 
     auto resultElWidth = resultType.getElementType().getIntOrFloatBitWidth();
@@ -2343,6 +2995,35 @@ static void configureAIEVecV2Legalizations(ConversionTarget &target,
     return (laneSize != 16 || (resultElWidth != 16 && resultElWidth != 32));
   });
 
+  target.addDynamicallyLegalOp<vector::FMAOp>([](vector::FMAOp op) {
+    auto resultType = dyn_cast<VectorType>(op.getType());
+    if (!resultType || getVectorLaneSize(resultType) != 16)
+      return true;
+    Type lhsElType = getElementTypeOrSelf(getMatMulOperand(op.getLhs()));
+    Type rhsElType = getElementTypeOrSelf(getMatMulOperand(op.getRhs()));
+    return !lhsElType.isBF16() || !rhsElType.isBF16();
+  });
+
+  target.addDynamicallyLegalOp<arith::ExtFOp>([](arith::ExtFOp op) {
+    auto srcType = dyn_cast<VectorType>(op.getIn().getType());
+    if (!srcType || getVectorLaneSize(srcType) != 16 ||
+        !srcType.getElementType().isBF16() ||
+        !getElementTypeOrSelf(op.getType()).isF32())
+      return true;
+    // The multiplications and additions take the narrow operand directly.
+    return llvm::any_of(op->getUsers(), [](Operation *user) {
+      return isa<arith::AddFOp, arith::SubFOp, arith::MulFOp, vector::FMAOp,
+                 vector::ContractionOp>(user);
+    });
+  });
+
+  target.addDynamicallyLegalOp<arith::TruncFOp>([](arith::TruncFOp op) {
+    auto srcType = dyn_cast<VectorType>(op.getIn().getType());
+    return !srcType || getVectorLaneSize(srcType) != 16 ||
+           !srcType.getElementType().isF32() ||
+           !getElementTypeOrSelf(op.getType()).isBF16();
+  });
+
   target.addDynamicallyLegalOp<arith::MinSIOp>([=](arith::MinSIOp op) {
     auto resultType = dyn_cast<VectorType>(op.getType());
     if (!resultType) {
@@ -2491,6 +3172,7 @@ struct LowerVectorToAIEVec
   LowerVectorToAIEVec(const LowerVectorToAIEVecOptions &options)
       : LowerVectorToAIEVec() {
     aieTarget = options.aieTarget;
+    costModelFile = options.costModel;
   }
 
   // In case we want to register this pass as a standalone pass for test
@@ -2511,6 +3193,12 @@ struct LowerVectorToAIEVec
                      "determine the vector size and available operations."),
       llvm::cl::init("aie")};
 
+  Option<std::string> costModelFile{
+      *this, "cost-model",
+      llvm::cl::desc("JSON file overriding the latency and issue cycles of "
+                     "the AIEVec ops used to choose between lowerings"),
+      llvm::cl::init("")};
+
   void runOnOperation() override {
     auto op = getOperation();
     MLIRContext *context = &getContext();
@@ -2528,14 +3216,23 @@ struct LowerVectorToAIEVec
       }
     }
 
+    AIEVecCostModel costModel(aieVersion == AIEArch::AIE_ML ? "aieml" : "aie");
+    std::string errorMessage;
+    if (!costModelFile.empty() &&
+        failed(costModel.loadFromFile(costModelFile, errorMessage))) {
+      op->emitError() << errorMessage;
+      signalPassFailure();
+      return;
+    }
+
     AnalysisManager am = getAnalysisManager();
     configureAIEVecCommonLegalizations(target, am);
     if (aieVersion == AIEArch::AIE) {
       populateAIEVecV1ConversionPatterns(patterns, am);
-      configureAIEVecV1Legalizations(target, am);
+      configureAIEVecV1Legalizations(target, am, costModel);
     } else {
       populateAIEVecV2ConversionPatterns(patterns, am);
-      configureAIEVecV2Legalizations(target, am);
+      configureAIEVecV2Legalizations(target, am, costModel);
     }
 
     if (failed(applyPartialConversion(op, target, std::move(patterns)))) {
@@ -2605,6 +3302,119 @@ struct SimplifyUPDOpsPass
   }
 };
 
+// Return the value an index is computed from by adding a constant, and the
+// constant. The value is null if the index is a constant.
+static std::pair<Value, int64_t> decomposeIndex(Value index) {
+  if (auto cst = getConstantIntValue(index))
+    return {nullptr, *cst};
+  auto applyOp = index.getDefiningOp<AffineApplyOp>();
+  if (!applyOp || applyOp.getMapOperands().size() != 1)
+    return {index, 0};
+  auto map = applyOp.getAffineMap();
+  auto diff = simplifyAffineExpr(
+                  map.getResult(0) - getAffineDimExpr(0, index.getContext()),
+                  map.getNumDims(), map.getNumSymbols())
+                  .dyn_cast<AffineConstantExpr>();
+  if (!diff)
+    return {index, 0};
+  auto [base, cst] = decomposeIndex(applyOp.getMapOperands()[0]);
+  return {base, cst + diff.getValue()};
+}
+
+// Return true if lo and hi are plain UPD ops loading two consecutive vectors
+// of the same memref.
+static bool areAdjacentUPDOps(aievec::UPDOp lo, aievec::UPDOp hi) {
+  if (!lo || !hi || lo.getSource() != hi.getSource() || lo.getVector() ||
+      hi.getVector() || lo.getIndex() != 0 || hi.getIndex() != 0 ||
+      lo.getOffset() != 0 || hi.getOffset() != 0 ||
+      lo.getType() != hi.getType() ||
+      lo.getIndices().size() != hi.getIndices().size() ||
+      lo->getBlock() != hi->getBlock() || !lo->isBeforeInBlock(hi))
+    return false;
+  auto loIndices = lo.getIndices(), hiIndices = hi.getIndices();
+  if (loIndices.empty() ||
+      !std::equal(loIndices.begin(), loIndices.end() - 1, hiIndices.begin()))
+    return false;
+  auto [loBase, loCst] = decomposeIndex(loIndices.back());
+  auto [hiBase, hiCst] = decomposeIndex(hiIndices.back());
+  return loBase == hiBase &&
+         hiCst - loCst == cast<VectorType>(lo.getType()).getShape().back();
+}
+
+// This pass replaces the two UPD ops of consecutive vectors combined by a
+// shift or concat op, as generated for unaligned `transfer_read` ops, with a
+// single UPD op as wide as both followed by ext ops of its halves. This keeps
+// the pattern expected by the convolution folding, as long as it does not
+// load any vector twice: the pair is left split when its high vector is the
+// low vector of another pair, or the other way around, like in a stencil
+// reading unaligned vectors more than one vector apart.
+struct FuseAdjacentUPDOpsPass
+    : public PassWrapper<FuseAdjacentUPDOpsPass, OperationPass<>> {
+
+  FuseAdjacentUPDOpsPass(int64_t maxLoadSize) : maxLoadSize(maxLoadSize) {}
+
+  void runOnOperation() override {
+    SmallVector<std::pair<aievec::UPDOp, aievec::UPDOp>, 8> pairs;
+    DenseSet<Operation *> loUPDs, hiUPDs;
+    getOperation()->walk([&](Operation *op) {
+      if (!isa<aievec::ShiftOp>(op) &&
+          !(isa<aievec::ConcatOp>(op) && op->getNumOperands() == 2))
+        return;
+      auto lo = op->getOperand(0).getDefiningOp<aievec::UPDOp>();
+      auto hi = op->getOperand(1).getDefiningOp<aievec::UPDOp>();
+      if (!areAdjacentUPDOps(lo, hi))
+        return;
+      pairs.push_back({lo, hi});
+      loUPDs.insert(lo);
+      hiUPDs.insert(hi);
+    });
+
+    DenseSet<Operation *> fused;
+    for (auto [lo, hi] : pairs) {
+      if (fused.count(lo) || fused.count(hi) || hiUPDs.count(lo) ||
+          loUPDs.count(hi))
+        continue;
+      fused.insert(lo);
+      fused.insert(hi);
+
+      auto vecType = cast<VectorType>(lo.getType());
+      auto longVecType = VectorType::get(2 * vecType.getNumElements(),
+                                         vecType.getElementType());
+      int64_t longVecSize = getElementSizeInBits(vecType) * 2 *
+                            vecType.getNumElements();
+      OpBuilder builder(lo);
+      auto updOp = builder.create<aievec::UPDOp>(
+          lo.getLoc(), longVecType, lo.getSource(), lo.getIndices(), 0, 0,
+          TypedValue<VectorType>(nullptr));
+      if (longVecSize > maxLoadSize)
+        updOp = builder.create<aievec::UPDOp>(
+            lo.getLoc(), longVecType, lo.getSource(), lo.getIndices(),
+            maxLoadSize, 1, updOp.getResult());
+      auto loExtOp = builder.create<aievec::ExtOp>(
+          lo.getLoc(), vecType, updOp.getResult(), builder.getI8IntegerAttr(0));
+      auto hiExtOp = builder.create<aievec::ExtOp>(
+          hi.getLoc(), vecType, updOp.getResult(), builder.getI8IntegerAttr(1));
+      lo.getResult().replaceAllUsesWith(loExtOp.getResult());
+      hi.getResult().replaceAllUsesWith(hiExtOp.getResult());
+      lo.erase();
+      hi.erase();
+
+      // The concatenation of both halves is the wide vector itself.
+      for (Operation *user : llvm::make_early_inc_range(loExtOp->getUsers())) {
+        auto concatOp = dyn_cast<aievec::ConcatOp>(user);
+        if (concatOp && concatOp.getSources().size() == 2 &&
+            concatOp.getSources()[1] == hiExtOp.getResult() &&
+            concatOp.getType() == longVecType) {
+          concatOp.getResult().replaceAllUsesWith(updOp.getResult());
+          concatOp.erase();
+        }
+      }
+    }
+  }
+
+  int64_t maxLoadSize;
+};
+
 //============================================================================//
 //=============== Main Vector2AIEVec Pipeline Configuration ==================//
 //============================================================================//
@@ -2619,5 +3429,7 @@ void xilinx::aievec::buildLowerVectorToAIEVec(
   pm.addPass(std::make_unique<ExtendUPDOpsPass>());
   pm.addPass(createCSEPass());
   pm.addPass(std::make_unique<SimplifyUPDOpsPass>());
+  pm.addPass(std::make_unique<FuseAdjacentUPDOpsPass>(
+      options.aieTarget == "aieml" ? 1024 : 256));
   pm.addPass(createCanonicalizerPass());
 }
@@ -18,9 +18,12 @@
 #include "mlir/Dialect/Affine/Analysis/LoopAnalysis.h"
 #include "mlir/Dialect/Affine/IR/AffineOps.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Vector/Transforms/VectorRewritePatterns.h"
 #include "mlir/Dialect/Vector/Transforms/VectorTransforms.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/TypeUtilities.h"
 #include "mlir/Pass/PassManager.h"
@@ -48,9 +51,12 @@ using namespace xilinx::aievec;
 //============================================================================//
 
 // This pattern converts a `vector.transfer_read` with an unaligned access
-// into an aligned `vector.transfer_read` twice as long, followed by a
-// `vector.extract_strided_slice` selecting the subvector matching the
-// original `vector.transfer_read`.
+// into the two aligned `vector.transfer_read` of the same length covering it,
+// followed by a `vector.shuffle` selecting the subvector matching the
+// original `vector.transfer_read`. The aligned reads are the ones of the
+// aligned accesses and of the other unaligned accesses to the same vectors,
+// e.g. in a stencil, so that they are only loaded once and the unaligned
+// vectors are built in registers by shifts or selects.
 struct SplitUnalignedTransferReadPattern
     : public OpConversionPattern<vector::TransferReadOp> {
   using OpConversionPattern<vector::TransferReadOp>::OpConversionPattern;
@@ -76,9 +82,8 @@ struct SplitUnalignedTransferReadPattern
     if (offset == 0)
       return failure();
 
-    // Verify that we can load a vector 2x as long as the original
+    // Verify that the two aligned vectors fit together in a register
     auto vLen = vType.getShape().back();
-    auto longVecTy = VectorType::get(2 * vLen, vType.getElementType());
     auto longVecSize = getElementSizeInBits(vType) * 2 * vLen;
     if (longVecSize > maxVectorSize)
       return failure();
@@ -88,25 +93,36 @@ struct SplitUnalignedTransferReadPattern
     // TODO: vector length.
     auto loc = readOp.getLoc();
     Value oldInnerMostIdx = adaptor.getIndices().back();
-    auto offsetCorrectionMap =
-        AffineMap::get(1, 0, getAffineDimExpr(0, readOp.getContext()) - offset);
-    Value newInnerMostIdx =
-        rewriter
-            .create<AffineApplyOp>(readOp.getLoc(), offsetCorrectionMap,
-                                   SmallVector<Value, 1>({oldInnerMostIdx}))
-            .getResult();
-    SmallVector<Value, 8> alignedIdx;
-    alignedIdx.append(adaptor.getIndices().begin(), adaptor.getIndices().end());
-    alignedIdx[alignedIdx.size() - 1] = newInnerMostIdx;
-
-    // Create the aligned transfer read for a vector 2x as long that covers the
-    // elements of the unaligned vector.
-    auto newReadOp = rewriter.create<vector::TransferReadOp>(
-        loc, longVecTy, adaptor.getSource(), alignedIdx, adaptor.getPadding());
+    auto getAlignedIdx = [&](int64_t shift) {
+      auto offsetCorrectionMap = AffineMap::get(
+          1, 0, getAffineDimExpr(0, readOp.getContext()) + shift - offset);
+      Value newInnerMostIdx =
+          rewriter
+              .create<AffineApplyOp>(loc, offsetCorrectionMap,
+                                     SmallVector<Value, 1>({oldInnerMostIdx}))
+              .getResult();
+      SmallVector<Value, 8> alignedIdx;
+      alignedIdx.append(adaptor.getIndices().begin(),
+                        adaptor.getIndices().end());
+      alignedIdx[alignedIdx.size() - 1] = newInnerMostIdx;
+      return alignedIdx;
+    };
+
+    // Create the aligned transfer reads of the lower and higher vectors that
+    // cover the elements of the unaligned vector.
+    auto lowReadOp = rewriter.create<vector::TransferReadOp>(
+        loc, vType, adaptor.getSource(), getAlignedIdx(0),
+        adaptor.getPadding());
+    auto highReadOp = rewriter.create<vector::TransferReadOp>(
+        loc, vType, adaptor.getSource(), getAlignedIdx(vLen),
+        adaptor.getPadding());
 
-    // Create a `vector.extract_strided_slice` to extract the unaligned vector.
-    rewriter.replaceOpWithNewOp<vector::ExtractStridedSliceOp>(
-        readOp, newReadOp.getResult(), offset, vLen, 1);
+    // Create a `vector.shuffle` to extract the unaligned vector.
+    SmallVector<int64_t, 64> mask;
+    for (int64_t i = 0; i < vLen; ++i)
+      mask.push_back(offset + i);
+    rewriter.replaceOpWithNewOp<vector::ShuffleOp>(
+        readOp, lowReadOp.getResult(), highReadOp.getResult(), mask);
 
     return success();
   }
@@ -208,7 +224,7 @@ struct HoistCastOpToDataSourcePattern : public RewritePattern {
 
     // At the moment, we only accept ops we know we can swap with cast.
     if (!isa<vector::BroadcastOp, vector::ExtractOp,
-             vector::ExtractStridedSliceOp>(defOp))
+             vector::ExtractStridedSliceOp, vector::ShuffleOp>(defOp))
       return failure();
 
     Type extOpInTy = extOp.getIn().getType();
@@ -263,6 +279,54 @@ struct HoistCastOpToDataSourcePattern : public RewritePattern {
 //============ AIEML canonicalization conversion patterns ===============//
 //============================================================================//
 
+// This pattern rewrites the logistic function of bf16 vectors,
+//   %0 = arith.negf %x
+//   %1 = math.exp %0
+//   %2 = arith.addf %1, 1.0
+//   %3 = arith.divf 1.0, %2
+// as 0.5 + 0.5 * tanh(0.5 * x), as AIE-ML has no vector division and tanh is
+// computed by look up tables.
+struct ExpandSigmoidToTanhPattern : public OpRewritePattern<arith::DivFOp> {
+  using OpRewritePattern<arith::DivFOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(arith::DivFOp divOp,
+                                PatternRewriter &rewriter) const override {
+    auto vecType = dyn_cast<VectorType>(divOp.getType());
+    if (!vecType || !vecType.getElementType().isBF16() ||
+        getVectorLaneSize(vecType) != 16)
+      return failure();
+
+    if (!matchPattern(divOp.getLhs(), m_OneFloat()))
+      return failure();
+    auto addOp = divOp.getRhs().getDefiningOp<arith::AddFOp>();
+    if (!addOp)
+      return failure();
+    Value expValue = addOp.getLhs();
+    if (!matchPattern(addOp.getRhs(), m_OneFloat())) {
+      if (!matchPattern(addOp.getLhs(), m_OneFloat()))
+        return failure();
+      expValue = addOp.getRhs();
+    }
+    auto expOp = expValue.getDefiningOp<math::ExpOp>();
+    if (!expOp)
+      return failure();
+    auto negOp = expOp.getOperand().getDefiningOp<arith::NegFOp>();
+    if (!negOp)
+      return failure();
+
+    Location loc = divOp.getLoc();
+    Value half = rewriter.create<arith::ConstantOp>(
+        loc, DenseElementsAttr::get(
+                 vecType, rewriter.getFloatAttr(vecType.getElementType(), 0.5)
+                              .getValue()));
+    Value halfX = rewriter.create<arith::MulFOp>(loc, negOp.getOperand(), half);
+    Value tanh = rewriter.create<math::TanhOp>(loc, halfX);
+    Value halfTanh = rewriter.create<arith::MulFOp>(loc, tanh, half);
+    rewriter.replaceOpWithNewOp<arith::AddFOp>(divOp, halfTanh, half);
+    return success();
+  }
+};
+
 //============================================================================//
 //================ Common AIE canonicalization configuration =================//
 //============================================================================//
@@ -325,8 +389,8 @@ populateAIEMLCanonicalizeConversionPatterns(RewritePatternSet &patterns) {
 // two steps:
 //    1) Replace splat transfer reads with contiguous transfer reads followed
 //       by `extract` + `broadcast` operations.
-//    2) Split unaligned transfer reads into a wider aligned transfer read
-//       followed by a `vector.extract_strided_slice` operation.
+//    2) Split unaligned transfer reads into the two aligned transfer reads
+//       covering them followed by a `vector.shuffle` operation.
 struct CanonicalizeVectorForAIEVecPass
     : public PassWrapper<CanonicalizeVectorForAIEVecPass, OperationPass<>> {
   MLIR_DEFINE_EXPLICIT_INTERNAL_INLINE_TYPE_ID(CanonicalizeVectorForAIEVecPass)
@@ -419,6 +483,52 @@ static std::unique_ptr<::mlir::Pass> createHoistCastOpToDataSourcePass() {
   return std::make_unique<HoistCastOpToDataSourcePass>();
 }
 
+// This pass flattens the transfers of contiguous multidimensional vectors,
+// like the matrix tiles of `vector.contract` ops, into transfers of 1D vectors
+// followed or preceded by a `vector.shape_cast`, as the AIE vector registers
+// hold the elements of multidimensional vectors in row-major order.
+struct FlattenVectorTransferPass
+    : public PassWrapper<FlattenVectorTransferPass, OperationPass<>> {
+
+  void runOnOperation() override {
+    auto op = getOperation();
+    MLIRContext *context = &getContext();
+    RewritePatternSet patterns(context);
+
+    vector::populateFlattenVectorTransferPatterns(patterns);
+
+    (void)applyPatternsAndFoldGreedily(op, std::move(patterns));
+  }
+};
+
+static std::unique_ptr<::mlir::Pass> createFlattenVectorTransferPass() {
+  return std::make_unique<FlattenVectorTransferPass>();
+}
+
+// This pass rewrites the transcendental functions which have no lowering to
+// AIE-ML in terms of the ones which have.
+struct ExpandTranscendentalOpsPass
+    : public PassWrapper<ExpandTranscendentalOpsPass, OperationPass<>> {
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<math::MathDialect>();
+  }
+
+  void runOnOperation() override {
+    auto op = getOperation();
+    MLIRContext *context = &getContext();
+    RewritePatternSet patterns(context);
+
+    patterns.add<ExpandSigmoidToTanhPattern>(patterns.getContext());
+
+    (void)applyPatternsAndFoldGreedily(op, std::move(patterns));
+  }
+};
+
+static std::unique_ptr<::mlir::Pass> createExpandTranscendentalOpsPass() {
+  return std::make_unique<ExpandTranscendentalOpsPass>();
+}
+
 //============================================================================//
 //=============== Main Vector2Vector Pipeline Configuration ==================//
 //============================================================================//
@@ -430,6 +540,10 @@ void xilinx::aievec::buildCanonicalizeVectorForAIEVec(
   // TODO: Add passes to split vectors that won't fit in registers
   pm.addPass(createCopyRemovalPass());
   pm.addPass(createCanonicalizeVectorForAIEVecPass(options));
+  if (options.aieTarget == "aieml") {
+    pm.addPass(createFlattenVectorTransferPass());
+    pm.addPass(createExpandTranscendentalOpsPass());
+  }
 
   pm.addPass(createHoistCastOpToDataSourcePass());
 }
@@ -0,0 +1,132 @@
+//===- CostModel.cpp - Cost model of the AIEVec operations ----------------===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the cost model of the AIEVec operations
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/Utils/CostModel.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+using namespace mlir;
+
+namespace xilinx::aievec {
+
+namespace {
+
+struct OpCostEntry {
+  const char *name;
+  AIEVecOpCost cost;
+};
+
+} // namespace
+
+// The operations of the AIE1 vector unit go through the multiplier datapath,
+// including the additions and subtractions. The loads take the load unit,
+// the register moves of concat and ext are free.
+static const OpCostEntry aieOpCosts[] = {
+    {"aievec.upd", {7, 1}},    {"aievec.srs", {4, 1}},
+    {"aievec.ups", {4, 1}},    {"aievec.mul", {4, 1}},
+    {"aievec.mac", {4, 1}},    {"aievec.add", {4, 1}},
+    {"aievec.sub", {4, 1}},    {"aievec.select", {2, 1}},
+    {"aievec.pack", {2, 1}},   {"aievec.unpack", {2, 1}},
+    {"aievec.concat", {0, 0}}, {"aievec.ext", {0, 0}},
+};
+
+// AIE-ML has a vector ALU next to the multiplier for the element-wise
+// operations, with shorter latencies.
+static const OpCostEntry aiemlOpCosts[] = {
+    {"aievec.upd", {7, 1}},         {"aievec.srs", {4, 1}},
+    {"aievec.ups", {4, 1}},         {"aievec.cast", {1, 1}},
+    {"aievec.mul_elem", {4, 1}},    {"aievec.mac_elem", {4, 1}},
+    {"aievec.mul_conv", {4, 1}},    {"aievec.fma_conv", {4, 1}},
+    {"aievec.matmul", {4, 1}},      {"aievec.add_elem", {2, 1}},
+    {"aievec.sub_elem", {2, 1}},    {"aievec.min", {2, 1}},
+    {"aievec.max", {2, 1}},         {"aievec.cmp", {2, 1}},
+    {"aievec.sel", {2, 1}},         {"aievec.shift", {2, 1}},
+    {"aievec.shuffle", {2, 1}},     {"aievec.broadcast", {2, 1}},
+    {"aievec.ext_elem", {2, 1}},    {"aievec.broadcast_scalar", {2, 1}},
+    {"aievec.concat", {0, 0}},      {"aievec.ext", {0, 0}},
+};
+
+AIEVecCostModel::AIEVecCostModel(StringRef aieTarget) {
+  ArrayRef<OpCostEntry> entries =
+      aieTarget == "aieml" ? ArrayRef<OpCostEntry>(aiemlOpCosts)
+                           : ArrayRef<OpCostEntry>(aieOpCosts);
+  for (const auto &entry : entries)
+    opCosts[entry.name] = entry.cost;
+}
+
+LogicalResult AIEVecCostModel::loadFromFile(StringRef path,
+                                            std::string &errorMessage) {
+  auto buffer = llvm::MemoryBuffer::getFile(path);
+  if (!buffer) {
+    errorMessage = "cannot open cost model '" + path.str() +
+                   "': " + buffer.getError().message();
+    return failure();
+  }
+  auto json = llvm::json::parse((*buffer)->getBuffer());
+  if (!json) {
+    errorMessage = "cannot parse cost model '" + path.str() +
+                   "': " + llvm::toString(json.takeError());
+    return failure();
+  }
+  auto *ops = json->getAsObject();
+  if (!ops) {
+    errorMessage = "cost model '" + path.str() + "' is not a JSON object";
+    return failure();
+  }
+  for (auto &[name, value] : *ops) {
+    auto *entry = value.getAsObject();
+    auto latency = entry ? entry->getInteger("latency") : std::nullopt;
+    auto issue = entry ? entry->getInteger("issue") : std::nullopt;
+    if (!latency || !issue || *latency < 0 || *issue < 0) {
+      errorMessage = "cost of '" + name.str() + "' in cost model '" +
+                     path.str() +
+                     "' needs a non-negative \"latency\" and \"issue\"";
+      return failure();
+    }
+    opCosts[name.str()] = {static_cast<unsigned>(*latency),
+                           static_cast<unsigned>(*issue)};
+  }
+  return success();
+}
+
+AIEVecOpCost AIEVecCostModel::getOpCost(StringRef opName) const {
+  auto it = opCosts.find(opName);
+  if (it == opCosts.end())
+    return {1, 1};
+  return it->second;
+}
+
+unsigned AIEVecCostModel::getIssueCycles(ArrayRef<StringRef> opNames) const {
+  unsigned cycles = 0;
+  for (auto name : opNames)
+    cycles += getOpCost(name).issue;
+  return cycles;
+}
+
+unsigned AIEVecCostModel::getLatency(ArrayRef<StringRef> opNames) const {
+  unsigned cycles = 0;
+  for (auto name : opNames)
+    cycles += getOpCost(name).latency;
+  return cycles;
+}
+
+bool AIEVecCostModel::isNotMoreExpensive(ArrayRef<StringRef> lhs,
+                                         ArrayRef<StringRef> rhs) const {
+  unsigned lhsIssue = getIssueCycles(lhs), rhsIssue = getIssueCycles(rhs);
+  if (lhsIssue != rhsIssue)
+    return lhsIssue < rhsIssue;
+  return getLatency(lhs) <= getLatency(rhs);
+}
+
+} // namespace xilinx::aievec
@@ -0,0 +1,148 @@
+//===- RegisterPressure.cpp - Register pressure of AIEVec IR --------------===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the register pressure estimate of AIEVec IR
+//
+//===----------------------------------------------------------------------===//
+
+#include "aie/Dialect/AIEVec/Utils/RegisterPressure.h"
+#include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
+#include "mlir/Analysis/Liveness.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/TypeUtilities.h"
+
+using namespace mlir;
+
+namespace xilinx::aievec {
+
+RegisterPressure getRegisterFileSize(bool aieml) {
+  // AIE1 has four 512-bit vector registers xa-xd and four 768-bit
+  // accumulators bm0-bm3. AIE-ML has twelve 512-bit vector registers x0-x11
+  // and nine 512-bit accumulators bm0-bm8.
+  if (aieml)
+    return {12 * 512, 9 * 512};
+  return {4 * 512, 4 * 768};
+}
+
+bool isAccumulatorValue(Value value, bool aieml) {
+  if (auto arg = dyn_cast<BlockArgument>(value)) {
+    auto forOp = dyn_cast<scf::ForOp>(arg.getOwner()->getParentOp());
+    if (!forOp || arg.getArgNumber() == 0)
+      return false;
+    return isAccumulatorValue(forOp.getOpOperandForRegionIterArg(arg).get(),
+                              aieml);
+  }
+  Operation *op = value.getDefiningOp();
+  if (auto forOp = dyn_cast<scf::ForOp>(op))
+    return isAccumulatorValue(
+        forOp.getIterOperands()[cast<OpResult>(value).getResultNumber()],
+        aieml);
+  if (auto castOp = dyn_cast<CastOp>(op))
+    return castOp.getIsResAcc();
+  if (isa<UPSOp, MulElemOp, FMAElemOp, MulConvOp, FMAConvOp>(op))
+    return true;
+  // On AIE1, only the integer multiplications accumulate in the
+  // accumulators, the floating-point ones write to vector registers.
+  if (isa<MulOp, FMAOp>(op))
+    return aieml || isa<IntegerType>(getElementTypeOrSelf(value.getType()));
+  return false;
+}
+
+static unsigned getVectorBits(Value value) {
+  auto vecType = dyn_cast<VectorType>(value.getType());
+  if (!vecType || !vecType.getElementType().isIntOrFloat())
+    return 0;
+  return vecType.getNumElements() * vecType.getElementTypeBitWidth();
+}
+
+namespace {
+
+// The live range of a vector value, as the positions of the first and last
+// operations of a block it is live at.
+struct LiveRange {
+  Value value;
+  unsigned start;
+  unsigned end;
+  unsigned bits;
+  bool isAcc;
+};
+
+} // namespace
+
+// Update maxPressure with the pressure in block, where outer holds the bits
+// live across the operation owning block.
+static void estimateBlockPressure(Block &block, const Liveness &liveness,
+                                  RegisterPressure outer, bool aieml,
+                                  RegisterPressure &maxPressure) {
+  const LivenessBlockInfo *info = liveness.getLiveness(&block);
+  if (block.empty() || !info)
+    return;
+
+  DenseMap<Operation *, unsigned> positions;
+  for (auto [pos, op] : llvm::enumerate(block))
+    positions[&op] = pos;
+
+  SmallVector<LiveRange, 16> ranges;
+  auto addRange = [&](Value value, Operation *startOp) {
+    unsigned bits = getVectorBits(value);
+    if (!bits)
+      return;
+    Operation *endOp = info->getEndOperation(value, startOp);
+    ranges.push_back({value, positions[startOp], positions[endOp], bits,
+                      isAccumulatorValue(value, aieml)});
+  };
+  for (Value value : info->in())
+    addRange(value, &block.front());
+  for (BlockArgument arg : block.getArguments())
+    addRange(arg, &block.front());
+  for (Operation &op : block)
+    for (Value result : op.getResults())
+      addRange(result, &op);
+
+  SmallVector<RegisterPressure, 16> pressures(positions.size(), outer);
+  for (auto &range : ranges)
+    for (unsigned pos = range.start; pos <= range.end; ++pos)
+      (range.isAcc ? pressures[pos].accBits : pressures[pos].vectorBits) +=
+          range.bits;
+  for (auto &pressure : pressures) {
+    maxPressure.vectorBits =
+        std::max(maxPressure.vectorBits, pressure.vectorBits);
+    maxPressure.accBits = std::max(maxPressure.accBits, pressure.accBits);
+  }
+
+  // The values live across an operation with regions keep their registers
+  // in its blocks, the ones used there are live-in values of the blocks.
+  for (Operation &op : block) {
+    unsigned pos = positions[&op];
+    for (Region &region : op.getRegions())
+      for (Block &nested : region) {
+        const LivenessBlockInfo *nestedInfo = liveness.getLiveness(&nested);
+        RegisterPressure through = outer;
+        for (auto &range : ranges) {
+          if (range.start >= pos || range.end <= pos ||
+              (nestedInfo && nestedInfo->isLiveIn(range.value)))
+            continue;
+          (range.isAcc ? through.accBits : through.vectorBits) += range.bits;
+        }
+        estimateBlockPressure(nested, liveness, through, aieml, maxPressure);
+      }
+  }
+}
+
+RegisterPressure estimateRegisterPressure(Operation *op, bool aieml) {
+  Liveness liveness(op);
+  RegisterPressure maxPressure;
+  for (Region &region : op->getRegions())
+    for (Block &block : region)
+      estimateBlockPressure(block, liveness, {}, aieml, maxPressure);
+  return maxPressure;
+}
+
+} // namespace xilinx::aievec
@@ -62,6 +62,17 @@ LogicalResult xilinx::AIEX::MulticastOp::verify() {
   return success();
 }
 
+LogicalResult xilinx::AIEX::MemcpyOp::verify() {
+  if (!getSrcDimensions() && !getDstDimensions())
+    return success();
+  auto device = (*this)->getParentOfType<xilinx::AIE::DeviceOp>();
+  if (device &&
+      device.getTargetModel().getTargetArch() == xilinx::AIE::AIEArch::AIE1)
+    return emitOpError("step sizes and wraps are only supported on AIE-ML "
+                       "devices");
+  return success();
+}
+
 LogicalResult xilinx::AIEX::BroadcastPacketOp::verify() {
   Region &body = getPorts();
   assert(getOperation()->getNumRegions());
@@ -76,3 +87,45 @@ LogicalResult xilinx::AIEX::BroadcastPacketOp::verify() {
 
   return success();
 }
+
+LogicalResult xilinx::AIEX::RuntimeSequenceOp::verify() {
+  for (auto &op : getBody().front())
+    if (!isa<ShimDMATransferOp, xilinx::AIE::EndOp>(op))
+      return op.emitOpError("cannot be contained in a RuntimeSequence op");
+  return success();
+}
+
+LogicalResult xilinx::AIEX::ShimDMATransferOp::verify() {
+  auto tile = dyn_cast_or_null<xilinx::AIE::TileOp>(getTile().getDefiningOp());
+  if (!tile)
+    return emitOpError("expects an AIE.tile");
+  auto device = (*this)->getParentOfType<xilinx::AIE::DeviceOp>();
+  const auto &targetModel = device.getTargetModel();
+  if (!targetModel.isShimNOCTile(tile.colIndex(), tile.rowIndex()))
+    return emitOpError("expects a shim NOC tile");
+  if (getChannelIndex() >= 2)
+    return emitOpError("shim DMAs have channels 0 and 1 in each direction");
+
+  auto buffer = dyn_cast_or_null<xilinx::AIE::ExternalBufferOp>(
+      getBuffer().getDefiningOp());
+  if (!buffer || !buffer.hasName())
+    return emitOpError("expects an AIE.external_buffer with a sym_name");
+  int64_t size = getBuffer().getType().cast<MemRefType>().getNumElements();
+  int64_t last = getOffset() + (int64_t)(getRepeat() - 1) * getStride();
+  if (last + getLen() > size)
+    return emitOpError("accesses elements up to ")
+           << last + getLen() << " of a buffer of " << size;
+
+  // The channel is driven either by the host or by an AIE.shimDMA, whose
+  // program would be overwritten.
+  for (auto shimDMA : device.getOps<xilinx::AIE::ShimDMAOp>()) {
+    if (shimDMA.getTile() != getTile())
+      continue;
+    for (auto &block : shimDMA.getBody())
+      for (auto start : block.getOps<xilinx::AIE::DMAStartOp>())
+        if (start.getChannelDir() == getChannelDir() &&
+            start.getChannelIndex() == getChannelIndex())
+          return emitOpError("uses a channel driven by an AIE.shimDMA");
+  }
+  return success();
+}
@@ -28,18 +28,19 @@ struct Token2LockLowering : public OpConversionPattern<UseTokenOp> {
   using OpConversionPattern<UseTokenOp>::OpConversionPattern;
   DenseMap<Operation *, std::vector<std::pair<Value, int>>> &acqLocks;
   DenseMap<Operation *, std::vector<std::pair<Value, int>>> &relLocks;
-  DenseMap<std::pair<Operation *, Operation *>, std::pair<Value, int>>
-      &lockChains;
+  DenseMap<Operation *, std::vector<std::pair<Value, int>>> &chainAcqLocks;
+  DenseMap<Operation *, std::vector<std::pair<Value, int>>> &chainRelLocks;
 
   Token2LockLowering(
       MLIRContext *context,
       DenseMap<Operation *, std::vector<std::pair<Value, int>>> &acqLocks,
       DenseMap<Operation *, std::vector<std::pair<Value, int>>> &relLocks,
-      DenseMap<std::pair<Operation *, Operation *>, std::pair<Value, int>>
-          &lockChains,
+      DenseMap<Operation *, std::vector<std::pair<Value, int>>> &chainAcqLocks,
+      DenseMap<Operation *, std::vector<std::pair<Value, int>>> &chainRelLocks,
       PatternBenefit benefit = 1)
       : OpConversionPattern<UseTokenOp>(context, benefit), acqLocks(acqLocks),
-        relLocks(relLocks), lockChains(lockChains) {}
+        relLocks(relLocks), chainAcqLocks(chainAcqLocks),
+        chainRelLocks(chainRelLocks) {}
 
   LogicalResult
   matchAndRewrite(UseTokenOp op, OpAdaptor adaptor,
@@ -68,13 +69,9 @@ struct Token2LockLowering : public OpConversionPattern<UseTokenOp> {
       }
 
       // Acquire lock from chain
-      for (auto map : lockChains) {
-        Value lockFromChain = map.second.first;
-        int lockValueFromChain = map.second.second;
-        Operation *acqOp = map.first.second;
-        if (acqOp != Op)
-          continue;
-
+      for (auto chainLock : chainAcqLocks[op]) {
+        Value lockFromChain = chainLock.first;
+        int lockValueFromChain = chainLock.second;
         rewriter.create<UseLockOp>(op.getLoc(), lockFromChain,
                                    lockValueFromChain, LockAction::Acquire);
         LLVM_DEBUG(llvm::dbgs() << "Acquire from chain " << lockFromChain
@@ -93,13 +90,9 @@ struct Token2LockLowering : public OpConversionPattern<UseTokenOp> {
       }
 
       // Release lock from chain
-      for (auto map : lockChains) {
-        Value lockFromChain = map.second.first;
-        int lockValueFromChain = map.second.second;
-        Operation *relOp = map.first.first;
-        if (relOp != Op)
-          continue;
-
+      for (auto chainLock : chainRelLocks[op]) {
+        Value lockFromChain = chainLock.first;
+        int lockValueFromChain = chainLock.second;
         rewriter.create<UseLockOp>(op.getLoc(), lockFromChain,
                                    lockValueFromChain, LockAction::Release);
         LLVM_DEBUG(llvm::dbgs() << "Release from chain " << lockFromChain
@@ -138,19 +131,11 @@ struct AIECreateLocksPass : public AIECreateLocksBase<AIECreateLocksPass> {
     TokenAnalysis TA(device);
     TA.runAnalysis();
     LLVM_DEBUG(TA.print(llvm::dbgs()));
-    DenseMap<StringRef, SmallVector<Operation *, 4>> tokenAcqMap(
-        TA.getTokenAcqMap());
-    DenseMap<StringRef, SmallVector<Operation *, 4>> tokenRelMap(
-        TA.getTokenRelMap());
-    SmallVector<std::pair<Operation *, Operation *>, 4> tokenChains(
-        TA.getTokenChains());
-    SmallVector<std::pair<Operation *, Operation *>, 4> tokenPairs(
-        TA.getTokenPairs());
-    DenseMap<std::pair<int, int>, Operation *> tiles(TA.getTiles());
+    const auto &tokenChains = TA.getTokenChains();
 
     DenseMap<std::pair<Operation *, int>, int> locks;
-    DenseMap<std::pair<Operation *, Operation *>, std::pair<Value, int>>
-        lockChains;
+    DenseMap<Operation *, std::vector<std::pair<Value, int>>> chainAcqLocks;
+    DenseMap<Operation *, std::vector<std::pair<Value, int>>> chainRelLocks;
     DenseMap<Operation *, std::vector<std::pair<Value, int>>> acqLocks;
     DenseMap<Operation *, std::vector<std::pair<Value, int>>> relLocks;
 
@@ -187,6 +172,13 @@ struct AIECreateLocksPass : public AIECreateLocksBase<AIECreateLocksPass> {
       if (!tileOp && ((!IsRelUserCore && IsAcqUserCore) ||
                       (!IsAcqUserCore && IsRelUserCore)))
         continue;
+
+      // a process acquiring the token it released itself earlier in the same
+      // block is already ordered by its program order
+      if (TA.isRedundantChain(release, acquire)) {
+        LLVM_DEBUG(llvm::dbgs() << "Redundant chain, no lock needed\n");
+        continue;
+      }
       assert(tileOp &&
              "Sorry, the lock users of this chain do not have a common lock");
 
@@ -199,18 +191,13 @@ struct AIECreateLocksPass : public AIECreateLocksBase<AIECreateLocksPass> {
       LockOp lock =
           builder.create<LockOp>(builder.getUnknownLoc(), tile, lockID, 0);
 
-      lockChains[std::make_pair(release, acquire)] = std::make_pair(lock, 1);
-
-      for (auto pair : tokenPairs) {
-        Operation *acqFromPair = pair.first;
-        Operation *relFromPair = pair.second;
+      chainRelLocks[release].push_back(std::make_pair(lock, 1));
+      chainAcqLocks[acquire].push_back(std::make_pair(lock, 1));
 
-        if (relFromPair == release)
-          acqLocks[acqFromPair].push_back(std::make_pair(lock, 0));
-
-        if (acqFromPair == acquire)
-          relLocks[relFromPair].push_back(std::make_pair(lock, 0));
-      }
+      if (Operation *acqFromPair = TA.getPairedAcquire(release))
+        acqLocks[acqFromPair].push_back(std::make_pair(lock, 0));
+      if (Operation *relFromPair = TA.getPairedRelease(acquire))
+        relLocks[relFromPair].push_back(std::make_pair(lock, 0));
     }
 
     ConversionTarget target(getContext());
@@ -218,7 +205,7 @@ struct AIECreateLocksPass : public AIECreateLocksBase<AIECreateLocksPass> {
 
     RewritePatternSet patterns(&getContext());
     patterns.insert<Token2LockLowering>(device.getContext(), acqLocks, relLocks,
-                                        lockChains);
+                                        chainAcqLocks, chainRelLocks);
 
     if (failed(applyPartialConversion(device, target, std::move(patterns))))
       signalPassFailure();
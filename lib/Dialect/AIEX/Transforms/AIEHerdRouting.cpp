@@ -200,6 +200,54 @@ void buildRoute(int xSrc, int ySrc, int xDest, int yDest,
       std::make_pair(lastPort, std::make_pair(destBundle, destChannel)));
 }
 
+typedef DenseMap<std::pair<Operation *, std::pair<int, int>>,
+                 SmallVector<Connect, 8>>
+    HerdSwitchboxes;
+// The connects made by a route, relative to the switchbox of its source.
+typedef SmallVector<std::pair<std::pair<int, int>, Connect>, 8> RouteTemplate;
+
+// Route from (0, 0) to (distX, distY) in an otherwise empty herd, and record
+// the connects of the route relative to its source.
+RouteTemplate buildRouteTemplate(int distX, int distY, WireBundle sourceBundle,
+                                 int sourceChannel, WireBundle destBundle,
+                                 int destChannel, Operation *herdOp) {
+  HerdSwitchboxes scratch;
+  buildRoute(0, 0, distX, distY, sourceBundle, sourceChannel, destBundle,
+             destChannel, herdOp, scratch);
+  RouteTemplate routeTemplate;
+  for (auto &swbox : scratch)
+    for (Connect &connect : swbox.second)
+      routeTemplate.push_back(std::make_pair(swbox.first.second, connect));
+  return routeTemplate;
+}
+
+// Add the connects of a route template translated to start at (x, y).  A
+// connect which already exists is shared, but no connect may drive a
+// destination port which is already driven by another connect.  Returns
+// false, leaving the switchboxes unchanged, if the route conflicts.
+bool stampRouteTemplate(const RouteTemplate &routeTemplate, int x, int y,
+                        Operation *herdOp, HerdSwitchboxes &switchboxes) {
+  for (auto &entry : routeTemplate) {
+    auto coord = std::make_pair(x + entry.first.first, y + entry.first.second);
+    auto swbox = switchboxes.find(std::make_pair(herdOp, coord));
+    if (swbox == switchboxes.end())
+      continue;
+    for (Connect &connect : swbox->second)
+      if (connect.second == entry.second.second &&
+          connect.first != entry.second.first)
+        return false;
+  }
+  for (auto &entry : routeTemplate) {
+    auto coord = std::make_pair(x + entry.first.first, y + entry.first.second);
+    SmallVector<Connect, 8> &connects =
+        switchboxes[std::make_pair(herdOp, coord)];
+    if (std::find(connects.begin(), connects.end(), entry.second) ==
+        connects.end())
+      connects.push_back(entry.second);
+  }
+  return true;
+}
+
 struct AIEHerdRoutingPass : public AIEHerdRoutingBase<AIEHerdRoutingPass> {
   void runOnOperation() override {
 
@@ -212,9 +260,7 @@ struct AIEHerdRoutingPass : public AIEHerdRoutingBase<AIEHerdRoutingPass> {
     DenseMap<std::pair<Operation *, Operation *>, std::pair<int, int>>
         distances;
     SmallVector<std::pair<std::pair<int, int>, std::pair<int, int>>, 4> routes;
-    DenseMap<std::pair<Operation *, std::pair<int, int>>,
-             SmallVector<Connect, 8>>
-        switchboxes;
+    HerdSwitchboxes switchboxes;
 
     for (auto herd : device.getOps<HerdOp>()) {
       herds.push_back(herd);
@@ -276,6 +322,9 @@ struct AIEHerdRoutingPass : public AIEHerdRoutingBase<AIEHerdRoutingPass> {
           distances[std::make_pair(sourceHerd, destHerd)];
       int distX = distance.first;
       int distY = distance.second;
+      // in template mode, each distinct offset between source and destination
+      // is routed once and the route is translated to every other source
+      DenseMap<std::pair<int, int>, RouteTemplate> routeTemplates;
       // FIXME: this looks like it can be improved further ...
       for (int xSrc = sourceStartX; xSrc < sourceEndX; xSrc += sourceStrideX) {
         for (int ySrc = sourceStartY; ySrc < sourceEndY;
@@ -303,6 +352,21 @@ struct AIEHerdRoutingPass : public AIEHerdRoutingBase<AIEHerdRoutingPass> {
                   routes.end())
                 continue;
 
+              if (useTemplates) {
+                auto offset = route.second;
+                if (!routeTemplates.count(offset))
+                  routeTemplates[offset] = buildRouteTemplate(
+                      offset.first, offset.second, sourceBundle, sourceChannel,
+                      destBundle, destChannel, sourceHerd);
+                if (stampRouteTemplate(routeTemplates[offset], x0, y0,
+                                       sourceHerd, switchboxes)) {
+                  routes.push_back(route);
+                  continue;
+                }
+                // the translated route conflicts with an earlier one, so
+                // route this instance on its own
+              }
+
               buildRoute(x0, y0, x1 + distX, y1 + distY, sourceBundle,
                          sourceChannel, destBundle, destChannel, sourceHerd,
                          switchboxes);
@@ -20,6 +20,10 @@
 #include "mlir/Pass/Pass.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/MapVector.h"
+
+#include <algorithm>
+#include <limits>
 
 using namespace mlir;
 using namespace xilinx;
@@ -33,69 +37,108 @@ static TileOp dstTileOp(xilinx::AIEX::MemcpyOp op) {
   return llvm::dyn_cast<xilinx::AIE::TileOp>(op.getDstTile().getDefiningOp());
 }
 
-struct LowerAIEMemcpy : public OpConversionPattern<MemcpyOp> {
-  using OpConversionPattern<MemcpyOp>::OpConversionPattern;
-
-  LowerAIEMemcpy(MLIRContext *context, PatternBenefit benefit = 1)
-      : OpConversionPattern<MemcpyOp>(context, benefit) {}
-
-  void createDMABlocksAndOps(MemOp &mem, StringRef tokenName, int acquireTknVal,
-                             int releaseTknVal, Value buf, int offset, int len,
-                             DMAChannelDir dmaDir, int channelIndex,
-                             ConversionPatternRewriter &rewriter) const {
-
-    Region &r = mem.getBody();
-    Block &endBlock = r.back();
-    Block *dmaBlock = rewriter.createBlock(&endBlock);
-    Block *bdBlock = rewriter.createBlock(&endBlock);
-
-    rewriter.setInsertionPointToStart(dmaBlock);
-    rewriter.create<DMAStartOp>(rewriter.getUnknownLoc(), dmaDir, channelIndex,
-                                bdBlock, &endBlock);
-
-    // Setup bd Block
-    // It should contain locking operations (lock or token) as well as DMABD op
-    // for specifying DMA Block description (which buffer type (A/B), transfer
-    // length/address, etc.)
-    rewriter.setInsertionPointToStart(bdBlock);
-    rewriter.create<UseTokenOp>(rewriter.getUnknownLoc(), tokenName,
-                                acquireTknVal, LockAction::Acquire);
-    rewriter.create<DMABDOp>(rewriter.getUnknownLoc(), buf, offset, len,
-                             0); // A type for now
-    rewriter.create<UseTokenOp>(rewriter.getUnknownLoc(), tokenName,
-                                releaseTknVal, LockAction::Release);
-    rewriter.create<NextBDOp>(rewriter.getUnknownLoc(), &endBlock);
+// The packet IDs of a stream header.
+static const int MAX_PACKET_IDS = 32;
+// The DMA channels of a tile in each direction.
+static const int MAX_DMA_CHANNELS = 2;
+
+// Append a DMA program to a MemOp, on channel channelIndex of direction
+// dmaDir: a chain of BDs moving the source or the destination side of each
+// memcpy in turn.  The BDs of a memcpy acquire its token before they start
+// and release it after they end.  A contiguous range longer than a BD can move
+// is split across several BDs, and on the source side the BDs of a memcpy
+// sent as packets carry its packet ID.
+static LogicalResult createDMABlocksAndOps(MemOp mem, ArrayRef<MemcpyOp> ops,
+                                           bool isSrc, DMAChannelDir dmaDir,
+                                           int channelIndex,
+                                           ArrayRef<int> packetIDs,
+                                           OpBuilder &builder) {
+  const AIETargetModel &targetModel =
+      mem->getParentOfType<DeviceOp>().getTargetModel();
+  uint64_t maxWords =
+      targetModel.getMaxBDLength(mem.colIndex(), mem.rowIndex());
+
+  Region &r = mem.getBody();
+  Block &endBlock = r.back();
+  Block *dmaBlock = builder.createBlock(&endBlock);
+  // the programs of the other channels now chain to this one
+  for (DMAStartOp dmaStart : r.getOps<DMAStartOp>())
+    if (dmaStart.getChain() == &endBlock)
+      dmaStart->setSuccessor(dmaBlock, 1);
+
+  struct BD {
+    unsigned op;
+    int offset;
+    int len;
+  };
+  SmallVector<BD> bds;
+  for (unsigned i = 0; i < ops.size(); i++) {
+    MemcpyOp op = ops[i];
+    Value buf = isSrc ? op.getSrcBuf() : op.getDstBuf();
+    int offset = isSrc ? op.getSrcOffsetValue() : op.getDstOffsetValue();
+    int len = isSrc ? op.getSrcLenValue() : op.getDstLenValue();
+    bool strided =
+        (isSrc ? op.getSrcDimensionsAttr() : op.getDstDimensionsAttr()) !=
+        nullptr;
+    unsigned elemBytes =
+        std::max<unsigned>(
+            buf.getType().cast<MemRefType>().getElementTypeBitWidth(), 8) /
+        8;
+    int maxLen = std::clamp<uint64_t>(maxWords * 4 / elemBytes, 1,
+                                      std::numeric_limits<int>::max());
+    if (strided && len > maxLen)
+      return op.emitOpError("moves ")
+             << len << " elements with step sizes and wraps, more than the "
+             << maxLen << " a single BD of tile (" << mem.colIndex() << ", "
+             << mem.rowIndex() << ") can move";
+    int done = 0;
+    do {
+      bds.push_back({i, offset + done, std::min(maxLen, len - done)});
+      done += std::min(maxLen, len - done);
+    } while (done < len);
   }
-
-  LogicalResult
-  matchAndRewrite(MemcpyOp op, OpAdaptor adaptor,
-                  ConversionPatternRewriter &rewriter) const override {
-    Operation *Op = op.getOperation();
-    Value srcBuf = op.getSrcBuf();
-    Value dstBuf = op.getDstBuf();
-
-    StringRef tokenName = op.getTokenName();
-    int acquireTknVal = op.getAcquireTokenValue();
-    int releaseTknVal = op.getReleaseTokenValue();
-    int srcOffset = op.getSrcOffsetValue();
-    int dstOffset = op.getDstOffsetValue();
-    int srcLen = op.getSrcLenValue();
-    int dstLen = op.getDstLenValue();
-
-    MemOp srcMem = srcTileOp(op).getMemOp();
-    MemOp dstMem = dstTileOp(op).getMemOp();
-
-    createDMABlocksAndOps(srcMem, tokenName, acquireTknVal, releaseTknVal,
-                          srcBuf, srcOffset, srcLen, DMAChannelDir::MM2S, 0,
-                          rewriter);
-    createDMABlocksAndOps(dstMem, tokenName, acquireTknVal, releaseTknVal,
-                          dstBuf, dstOffset, dstLen, DMAChannelDir::S2MM, 0,
-                          rewriter);
-
-    rewriter.eraseOp(Op);
-    return success();
+  if (bds.size() > targetModel.getNumBDs(mem.colIndex(), mem.rowIndex()))
+    return ops.front().emitOpError("needs ")
+           << bds.size() << " BDs in tile (" << mem.colIndex() << ", "
+           << mem.rowIndex() << "), more than it has";
+
+  SmallVector<Block *> bdBlocks;
+  for (unsigned i = 0; i < bds.size(); i++)
+    bdBlocks.push_back(builder.createBlock(&endBlock));
+
+  builder.setInsertionPointToStart(dmaBlock);
+  builder.create<DMAStartOp>(builder.getUnknownLoc(), dmaDir, channelIndex,
+                             bdBlocks.front(), &endBlock);
+
+  // Setup bd Blocks
+  // Each should contain locking operations (lock or token) as well as DMABD
+  // op for specifying DMA Block description (which buffer type (A/B),
+  // transfer length/address, etc.)
+  for (unsigned i = 0; i < bds.size(); i++) {
+    MemcpyOp op = ops[bds[i].op];
+    bool first = i == 0 || bds[i - 1].op != bds[i].op;
+    bool last = i + 1 == bds.size() || bds[i + 1].op != bds[i].op;
+    builder.setInsertionPointToStart(bdBlocks[i]);
+    if (first)
+      builder.create<UseTokenOp>(builder.getUnknownLoc(), op.getTokenName(),
+                                 op.getAcquireTokenValue(),
+                                 LockAction::Acquire);
+    if (isSrc && packetIDs[bds[i].op] >= 0)
+      builder.create<DMABDPACKETOp>(builder.getUnknownLoc(), 0,
+                                    packetIDs[bds[i].op]);
+    builder.create<DMABDOp>(
+        builder.getUnknownLoc(), isSrc ? op.getSrcBuf() : op.getDstBuf(),
+        bds[i].offset, bds[i].len, 0, // A type for now
+        isSrc ? op.getSrcDimensionsAttr() : op.getDstDimensionsAttr());
+    if (last)
+      builder.create<UseTokenOp>(builder.getUnknownLoc(), op.getTokenName(),
+                                 op.getReleaseTokenValue(),
+                                 LockAction::Release);
+    builder.create<NextBDOp>(builder.getUnknownLoc(),
+                             i + 1 < bds.size() ? bdBlocks[i + 1] : &endBlock);
   }
-};
+  return success();
+}
 
 struct AIELowerMemcpyPass : public AIELowerMemcpyBase<AIELowerMemcpyPass> {
   void runOnOperation() override {
@@ -103,40 +146,85 @@ struct AIELowerMemcpyPass : public AIELowerMemcpyBase<AIELowerMemcpyPass> {
     DeviceOp device = getOperation();
     OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
 
-    // Setup FlowOps
-    // Since memcpy moves data from one memory module to another, we use
-    // WireBundle::DMA for both the source and the destination In addition, we
-    // only have two DMA ports per each direction (MM2S/S2MM), and in a
-    // circuit-switch mode, dest port/channel sharing is not possible.
-    // Therefore, we will generate error if the number of logical flows
-    // (streams) targeting the same destination (S2MM) is more than 2
+    // The memcpys between the same pair of tiles share a DMA channel on each
+    // side and a single route, with a packet ID each, and each other pair
+    // gets a circuit-switched flow.  Since memcpy moves data from one memory
+    // module to another, we use WireBundle::DMA for both the source and the
+    // destination, and a tile only has two DMA channels in each direction
+    // (MM2S/S2MM).
+    llvm::MapVector<std::pair<Value, Value>, SmallVector<MemcpyOp>> groups;
+    for (auto op : device.getOps<MemcpyOp>())
+      groups[std::make_pair(op.getSrcTile(), op.getDstTile())].push_back(op);
+
+    // the packet IDs already taken, for the memcpys sent as packets
+    std::vector<bool> usedIDs(MAX_PACKET_IDS, false);
+    for (PacketFlowOp pktFlow : device.getOps<PacketFlowOp>())
+      if (pktFlow.IDInt() < MAX_PACKET_IDS)
+        usedIDs[pktFlow.IDInt()] = true;
+
+    DenseMap<Value, int> srcChannel;
     DenseMap<Value, int> destChannel;
-    for (auto op : device.getOps<MemcpyOp>()) {
+    for (auto &group : groups) {
+      SmallVector<MemcpyOp> &ops = group.second;
+      MemcpyOp op = ops.front();
+      TileOp srcTile = srcTileOp(op);
+      TileOp dstTile = dstTileOp(op);
+      int srcIndex = srcChannel[op.getSrcTile()]++;
+      int dstIndex = destChannel[op.getDstTile()]++;
+      if (srcIndex >= MAX_DMA_CHANNELS || dstIndex >= MAX_DMA_CHANNELS) {
+        op.emitOpError("needs a third DMA channel in tile (")
+            << (srcIndex >= MAX_DMA_CHANNELS ? srcTile : dstTile).colIndex()
+            << ", "
+            << (srcIndex >= MAX_DMA_CHANNELS ? srcTile : dstTile).rowIndex()
+            << ")";
+        return signalPassFailure();
+      }
+
+      SmallVector<int> packetIDs(ops.size(), -1);
       builder.setInsertionPoint(op);
-      TileOp srcTile = dyn_cast<TileOp>(op.getSrcTile().getDefiningOp());
-      TileOp dstTile = dyn_cast<TileOp>(op.getDstTile().getDefiningOp());
-      // TODO: perhaps a better approach is to not assert here, but rather have
-      // a subsequent pass that legally relocates the ports
-      assert(destChannel[op.getDstTile()] <= 2 &&
-             "Could not allocate more than two dest. channel when creating "
-             "FlowOp");
-      builder.create<FlowOp>(builder.getUnknownLoc(), srcTile, WireBundle::DMA,
-                             0, dstTile, WireBundle::DMA,
-                             destChannel[op.getDstTile()]);
-      destChannel[op.getDstTile()]++;
+      if (ops.size() == 1) {
+        builder.create<FlowOp>(builder.getUnknownLoc(), srcTile,
+                               WireBundle::DMA, srcIndex, dstTile,
+                               WireBundle::DMA, dstIndex);
+      } else {
+        for (unsigned i = 0; i < ops.size(); i++) {
+          auto freeID = std::find(usedIDs.begin(), usedIDs.end(), false);
+          if (freeID == usedIDs.end()) {
+            ops[i].emitOpError("cannot share a route with packets: all "
+                               "packet IDs are taken");
+            return signalPassFailure();
+          }
+          *freeID = true;
+          packetIDs[i] = freeID - usedIDs.begin();
+          builder.setInsertionPoint(ops[i]);
+          PacketFlowOp pktFlow = builder.create<PacketFlowOp>(
+              builder.getUnknownLoc(), packetIDs[i]);
+          builder.createBlock(&pktFlow.getPorts());
+          builder.create<PacketSourceOp>(builder.getUnknownLoc(), srcTile,
+                                         WireBundle::DMA, srcIndex);
+          builder.create<PacketDestOp>(builder.getUnknownLoc(), dstTile,
+                                       WireBundle::DMA, dstIndex);
+          builder.create<EndOp>(builder.getUnknownLoc());
+          builder.setInsertionPointAfter(pktFlow);
+        }
+      }
+
+      for (TileOp tile : {srcTile, dstTile})
+        if (!tile.getMemOp()) {
+          op.emitOpError("needs an AIE.mem in tile (")
+              << tile.colIndex() << ", " << tile.rowIndex() << ")";
+          return signalPassFailure();
+        }
+      if (failed(createDMABlocksAndOps(srcTile.getMemOp(), ops, true,
+                                       DMAChannelDir::MM2S, srcIndex,
+                                       packetIDs, builder)) ||
+          failed(createDMABlocksAndOps(dstTile.getMemOp(), ops, false,
+                                       DMAChannelDir::S2MM, dstIndex,
+                                       packetIDs, builder)))
+        return signalPassFailure();
+      for (MemcpyOp memcpy : ops)
+        memcpy.erase();
     }
-
-    ConversionTarget target(getContext());
-    RewritePatternSet patterns(&getContext());
-    target.addLegalOp<DMAStartOp>();
-    target.addLegalOp<DMABDOp>();
-    target.addLegalOp<UseTokenOp>();
-    target.addLegalOp<NextBDOp>();
-
-    patterns.insert<LowerAIEMemcpy>(&getContext());
-
-    if (failed(applyPartialConversion(device, target, std::move(patterns))))
-      signalPassFailure();
   }
 };
 
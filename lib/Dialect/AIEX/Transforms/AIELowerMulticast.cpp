@@ -19,6 +19,8 @@
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/Twine.h"
 
+#include <algorithm>
+
 #define DEBUG_TYPE "aie-lower-multicast"
 
 using namespace mlir;
@@ -44,26 +46,75 @@ struct AIEOpRemoval : public OpConversionPattern<MyOp> {
   }
 };
 
+// The packet IDs of a stream header.
+static const int MAX_PACKET_IDS = 32;
+
 struct AIELowerMulticastPass : public AIEMulticastBase<AIELowerMulticastPass> {
   void runOnOperation() override {
 
     DeviceOp device = getOperation();
     OpBuilder builder = OpBuilder::atBlockEnd(device.getBody());
 
+    // the packet IDs already taken, for the multicasts lowered to packets
+    std::vector<bool> usedIDs(MAX_PACKET_IDS, false);
+    device.walk([&](Operation *op) {
+      int id = -1;
+      if (auto pktFlow = dyn_cast<PacketFlowOp>(op))
+        id = pktFlow.IDInt();
+      else if (auto bpid = dyn_cast<BPIDOp>(op))
+        id = bpid.IDInt();
+      if (id >= 0 && id < MAX_PACKET_IDS)
+        usedIDs[id] = true;
+    });
+
     for (auto multicast : device.getOps<MulticastOp>()) {
       Region &r = multicast.getPorts();
       Block &b = r.front();
       Port sourcePort = multicast.port();
       TileOp srcTile = dyn_cast<TileOp>(multicast.getTile().getDefiningOp());
-      for (Operation &Op : b.getOperations()) {
-        if (MultiDestOp multiDest = dyn_cast<MultiDestOp>(Op)) {
-          TileOp destTile =
-              dyn_cast<TileOp>(multiDest.getTile().getDefiningOp());
+      auto dests = b.getOps<MultiDestOp>();
+      unsigned fanout = std::distance(dests.begin(), dests.end());
+
+      // a large fanout is broadcast as packets, which share the channels of
+      // the tree with the other packet flows
+      if (maxCircuitFanout > 0 && fanout > maxCircuitFanout) {
+        auto freeID = std::find(usedIDs.begin(), usedIDs.end(), false);
+        if (freeID == usedIDs.end()) {
+          multicast.emitOpError("has a fanout of ")
+              << fanout << ", more than the " << maxCircuitFanout
+              << " of max-circuit-fanout, but all packet IDs are taken";
+          return signalPassFailure();
+        }
+        *freeID = true;
+        int flowID = freeID - usedIDs.begin();
+        builder.setInsertionPointAfter(multicast);
+        BroadcastPacketOp bp = builder.create<BroadcastPacketOp>(
+            multicast.getLoc(), multicast.getTile(), sourcePort.first,
+            sourcePort.second);
+        builder.createBlock(&bp.getPorts());
+        BPIDOp bpid = builder.create<BPIDOp>(multicast.getLoc(), flowID);
+        builder.createBlock(&bpid.getPorts());
+        for (MultiDestOp multiDest : dests) {
           Port destPort = multiDest.port();
-          builder.create<FlowOp>(builder.getUnknownLoc(), srcTile,
-                                 sourcePort.first, sourcePort.second, destTile,
-                                 destPort.first, destPort.second);
+          builder.create<BPDestOp>(multiDest.getLoc(), multiDest.getTile(),
+                                   destPort.first, destPort.second);
         }
+        builder.create<EndOp>(builder.getUnknownLoc());
+        builder.setInsertionPointAfter(bpid);
+        builder.create<EndOp>(builder.getUnknownLoc());
+        continue;
+      }
+
+      // otherwise the flows form a single fanout net, routed as a tree
+      builder.setInsertionPointToEnd(device.getBody());
+      for (MultiDestOp multiDest : dests) {
+        TileOp destTile = dyn_cast<TileOp>(multiDest.getTile().getDefiningOp());
+        Port destPort = multiDest.port();
+        FlowOp flow = builder.create<FlowOp>(
+            builder.getUnknownLoc(), srcTile, sourcePort.first,
+            sourcePort.second, destTile, destPort.first, destPort.second);
+        if (fanout > 1)
+          flow.setSteiner(true);
       }
     }
 
@@ -49,6 +49,8 @@ void xilinx::AIEX::TokenAnalysis::runAnalysis() {
         if (!visitors[tokenName].empty()) {
           Operation *Op = visitors[tokenName].pop_back_val();
           tokenPairs.push_back(std::make_pair(Op, op.getOperation()));
+          pairedAcquire[op.getOperation()] = Op;
+          pairedRelease[Op] = op.getOperation();
         }
       }
     } else if (auto op = dyn_cast<MemcpyOp>(Op)) {
@@ -59,65 +61,53 @@ void xilinx::AIEX::TokenAnalysis::runAnalysis() {
       tokenAcqMap[tokenName].push_back(Op);
       tokenRelMap[tokenName].push_back(Op);
       tokenPairs.push_back(std::make_pair(Op, Op));
+      pairedAcquire[Op] = Op;
+      pairedRelease[Op] = Op;
     }
   });
 
   // sanity check: ensure that acquiring a token is followed by releasing a
   // token
-  for (auto map : tokenAcqMap) {
-    StringRef tokenName = map.first;
+  for (auto &map : tokenAcqMap)
     for (auto Op : map.second) {
-      bool isReleased = false;
-      if (auto op = dyn_cast<MemcpyOp>(Op))
-        isReleased = true;
-
-      for (auto pair : tokenPairs) {
-        if (UseTokenOp aop = dyn_cast<UseTokenOp>(pair.first)) {
-          if (tokenName == aop.getTokenName() && Op == aop.getOperation()) {
-            isReleased = true;
-            break;
-          }
-        }
-      }
-
-      assert(isReleased && "No release found for acquire!"
-                           "This might potentially lead to deadlock");
+      (void)Op;
+      assert(pairedRelease.count(Op) && "No release found for acquire!"
+                                        "This might potentially lead to "
+                                        "deadlock");
     }
-  }
 
   // Look for a pair of UseTokenOps (or UseTokenOp and MemcpyOp) such that one
   // releases and one acquires the same token + value. They form a chain of
   // releasing and acquiring a token. From the chains of tokens collected, we
-  // can infer the dependency of the parentOps
-  for (auto map : tokenRelMap) {
+  // can infer the dependency of the parentOps. The acquires are indexed by
+  // token and value, so that each release only visits its chains.
+  DenseMap<std::pair<StringRef, int>, SmallVector<Operation *, 4>>
+      acquiresByValue;
+  for (auto &map : tokenAcqMap)
+    for (auto AOp : map.second) {
+      if (auto op = dyn_cast<UseTokenOp>(AOp))
+        acquiresByValue[{map.first, op.getTokenValue()}].push_back(AOp);
+      else if (auto op = dyn_cast<MemcpyOp>(AOp))
+        acquiresByValue[{map.first, op.getAcquireTokenValue()}].push_back(
+            AOp);
+    }
+  for (auto &map : tokenRelMap) {
     StringRef tokenName = map.first;
-    auto tokenRels = map.second;
-    auto tokenAcqs = tokenAcqMap[tokenName];
-    for (auto ROp : tokenRels) {
-      int releaseValue;
+    for (auto ROp : map.second) {
+      int releaseValue = 0;
 
       if (auto op = dyn_cast<UseTokenOp>(ROp))
         releaseValue = op.getTokenValue();
       else if (auto op = dyn_cast<MemcpyOp>(ROp))
         releaseValue = op.getReleaseTokenValue();
 
-      for (auto AOp : tokenAcqs) {
-        int acquireValue;
-
-        if (auto op = dyn_cast<UseTokenOp>(AOp))
-          acquireValue = op.getTokenValue();
-        else if (auto op = dyn_cast<MemcpyOp>(AOp))
-          acquireValue = op.getAcquireTokenValue();
-        else
-          continue;
-
-        // Release and Acquire form a chain if they set/get the token with the
-        // same value
-        if (releaseValue != acquireValue)
-          continue;
-
+      // Release and Acquire form a chain if they set/get the token with the
+      // same value
+      auto acquires = acquiresByValue.find({tokenName, releaseValue});
+      if (acquires == acquiresByValue.end())
+        continue;
+      for (auto AOp : acquires->second)
         tokenChains.push_back(std::make_pair(ROp, AOp));
-      }
     }
   }
 
@@ -128,10 +118,27 @@ void xilinx::AIEX::TokenAnalysis::runAnalysis() {
   }
 }
 
+bool xilinx::AIEX::TokenAnalysis::isRedundantChain(Operation *release,
+                                                   Operation *acquire) {
+  if (!isa<UseTokenOp>(release) || !isa<UseTokenOp>(acquire) ||
+      release->getBlock() != acquire->getBlock() ||
+      !release->isBeforeInBlock(acquire))
+    return false;
+  // the lock of the chain is also handed back from the release paired with
+  // the acquire to the acquire paired with the release, which must be done by
+  // the same process as well
+  Operation *user = getTokenUserOp(release);
+  Operation *pairedAcq = getPairedAcquire(release);
+  Operation *pairedRel = getPairedRelease(acquire);
+  return pairedAcq && pairedRel && getTokenUserOp(pairedAcq) == user &&
+         getTokenUserOp(pairedRel) == user;
+}
+
 Operation *xilinx::AIEX::TokenAnalysis::getTokenUserOp(Operation *Op) {
 
   if (UseTokenOp op = dyn_cast<UseTokenOp>(Op)) {
-    while (Operation *parentOp = op->getParentOp()) {
+    for (Operation *parentOp = op->getParentOp(); parentOp;
+         parentOp = parentOp->getParentOp()) {
       if (isa<CoreOp>(parentOp) || isa<MemOp>(parentOp) ||
           isa<ShimDMAOp>(parentOp))
         return parentOp;
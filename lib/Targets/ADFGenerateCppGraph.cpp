@@ -8,15 +8,16 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "AIETargets.h"
 #include "aie/Dialect/ADF/ADFDialect.h"
 #include "aie/Dialect/ADF/ADFOps.h"
+#include "aie/Targets/AIETargets.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/SymbolTable.h"
 #include "mlir/Pass/Pass.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
 #include <iostream>
 #include <unordered_map>
 #include <vector>
@@ -102,6 +103,73 @@ struct GraphWriter {
     return std::string("n") + std::to_string(netCnt++);
   }
 
+  // Write the depth of the FIFO on the stream connection net, if any.
+  void writeFifoDepth(const Indent &indent, const std::string &net,
+                      std::optional<int32_t> depth) {
+    if (depth && *depth > 0)
+      output << indent << "fifo_depth(" << net << ") = " << *depth << ";\n";
+  }
+
+  // Returns the depth of the FIFO on the connection to input index of
+  // kernel.
+  static std::optional<int32_t> getFifoDepth(KernelOp kernel,
+                                             unsigned index) {
+    if (auto depths = kernel.getFifoDepths())
+      return (*depths)[index];
+    return std::nullopt;
+  }
+
+  // Write the location of the buffer, or of the ping and pong buffers, of
+  // port, given as (col, row, bank) triples.
+  void writeBufferLocation(const Indent &indent, const std::string &port,
+                           Attribute attr) {
+    auto banks = attr.cast<DenseI32ArrayAttr>().asArrayRef();
+    if (banks.empty())
+      return;
+    output << indent << "location<buffer>(" << port << ") = ";
+    if (banks.size() > 3)
+      output << "{";
+    for (unsigned i = 0; i < banks.size(); i += 3) {
+      if (i)
+        output << ", ";
+      output << "bank(" << banks[i] << ", " << banks[i + 1] << ", "
+             << banks[i + 2] << ")";
+    }
+    if (banks.size() > 3)
+      output << "}";
+    output << ";\n";
+  }
+
+  // Write the constraints of kernel carried by its attributes.
+  void writeKernelConstraints(KernelOp kernel) {
+    const std::string &name = kernelOp2VarName[kernel];
+    Indent indent;
+    output << indent << "source(" << name << ") = "
+           << "\"kernels.cc\";\n";
+    double ratio = 0.1;
+    if (auto runtimeRatio = kernel.getRuntimeRatio())
+      ratio = runtimeRatio->convertToDouble();
+    output << indent << "runtime<ratio>(" << name
+           << ") = " << llvm::format("%g", ratio) << ";\n";
+    if (auto tile = kernel.getTile())
+      output << indent << "location<kernel>(" << name << ") = tile("
+             << (*tile)[0] << ", " << (*tile)[1] << ");\n";
+    if (auto stackSize = kernel.getStackSize())
+      output << indent << "stack_size(" << name << ") = " << *stackSize
+             << ";\n";
+    if (auto heapSize = kernel.getHeapSize())
+      output << indent << "heap_size(" << name << ") = " << *heapSize
+             << ";\n";
+    if (auto buffers = kernel.getInBufferLocations())
+      for (auto [i, banks] : llvm::enumerate(*buffers))
+        writeBufferLocation(indent, name + ".in[" + std::to_string(i) + "]",
+                            banks);
+    if (auto buffers = kernel.getOutBufferLocations())
+      for (auto [i, banks] : llvm::enumerate(*buffers))
+        writeBufferLocation(indent, name + ".out[" + std::to_string(i) + "]",
+                            banks);
+  }
+
   void visitOpResultUsers(GraphInputOp driverOp) {
     Indent indent;
     for (auto indexedResult : llvm::enumerate(driverOp->getResults())) {
@@ -114,10 +182,12 @@ struct GraphWriter {
               driverOp, kernel.getCalleeAttr());
           Type opType = funcOp.getFunctionType().getInput(targetIndex);
           std::string targetKernelName = kernelOp2VarName[kernel];
+          std::string net = getTempNetName();
           output << indent << "connect<" << getConnectionTypeString(opType)
                  << "> ";
-          output << getTempNetName() << " (" << driverOp.getName() << ", "
+          output << net << " (" << driverOp.getName() << ", "
                  << targetKernelName << ".in[" << targetIndex << "]);\n";
+          writeFifoDepth(indent, net, getFifoDepth(kernel, targetIndex));
         }
 
         // todo: kernel should not drive graph input, add an mlir verifier
@@ -141,19 +211,23 @@ struct GraphWriter {
               kernel, kernel.getCalleeAttr());
           Type opType = funcOp.getFunctionType().getInput(targetIndex);
           auto targetKernelName = kernelOp2VarName[kernel];
+          std::string net = getTempNetName();
           output << indent << "connect<" << getConnectionTypeString(opType)
                  << "> ";
-          output << getTempNetName() << " (" << sourceKernelName << ".out["
-                 << sourceIndex << "], " << targetKernelName << ".in["
-                 << targetIndex << "]);\n";
+          output << net << " (" << sourceKernelName << ".out[" << sourceIndex
+                 << "], " << targetKernelName << ".in[" << targetIndex
+                 << "]);\n";
+          writeFifoDepth(indent, net, getFifoDepth(kernel, targetIndex));
         } else if (auto outputOp = dyn_cast<GraphOutputOp>(userOp)) {
           auto funcOp = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
               source, source.getCalleeAttr());
           Type opType = funcOp.getFunctionType().getInput(sourceIndex);
+          std::string net = getTempNetName();
           output << indent << "connect<" << getConnectionTypeString(opType)
                  << "> ";
-          output << getTempNetName() << " (" << sourceKernelName << ".out["
-                 << sourceIndex << "], " << outputOp.getName() << ");\n";
+          output << net << " (" << sourceKernelName << ".out[" << sourceIndex
+                 << "], " << outputOp.getName() << ");\n";
+          writeFifoDepth(indent, net, outputOp.getFifoDepth());
         }
 
         // todo: kernel should not drive graph input, add an mlir verifier
@@ -247,18 +321,10 @@ struct GraphWriter {
       }
     }
 
-    {
-      Indent indent;
-      for (Region &region : graph->getRegions())
-        for (Block &block : region.getBlocks())
-          for (auto kernel : block.getOps<KernelOp>()) {
-            output << indent << "source(" << kernelOp2VarName[kernel] << ") = "
-                   << "\"kernels.cc\";\n";
-            output << indent << "runtime<ratio>(" << kernelOp2VarName[kernel]
-                   << ") = "
-                   << "0.1;\n";
-          }
-    }
+    for (Region &region : graph->getRegions())
+      for (Block &block : region.getBlocks())
+        for (auto kernel : block.getOps<KernelOp>())
+          writeKernelConstraints(kernel);
 
     output << indent << "}\n";
     output << "};\n\n";
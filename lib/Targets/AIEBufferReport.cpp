@@ -0,0 +1,194 @@
+//===- AIEBufferReport.cpp --------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Takes as input the mlir after AIEAssignBufferAddresses.
+ * Reports the layout of the data memory of each tile as JSON: the used and
+ * free bytes, how fragmented the free bytes are, the buffers of each bank and
+ * the pairs of buffers which are accessed by vector operations of the same
+ * block of a core and share a bank, which likely causes bank conflicts.
+ */
+
+#include <map>
+
+#include "mlir/Dialect/Vector/IR/VectorOps.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Location.h"
+
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+
+#include "aie/Targets/AIETargets.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+namespace {
+
+struct PlacedBuffer {
+  BufferOp buffer;
+  int64_t start, end;
+  int64_t firstBank, lastBank;
+
+  bool sharesBank(const PlacedBuffer &other) const {
+    return firstBank <= other.lastBank && other.firstBank <= lastBank;
+  }
+};
+
+} // namespace
+
+static std::string getBufferName(BufferOp buffer) {
+  return buffer.name().getValue().str();
+}
+
+/// Function that returns the sets of buffers which are accessed by vector
+/// operations of the same block of a core.
+static SmallVector<DenseSet<Operation *>, 8>
+collectVectorAccesses(DeviceOp device) {
+  SmallVector<DenseSet<Operation *>, 8> groups;
+  for (auto core : device.getOps<CoreOp>())
+    core.walk([&](Block *block) {
+      DenseSet<Operation *> accessed;
+      for (Operation &op : *block) {
+        if (!isa<vector::VectorDialect>(op.getDialect()))
+          continue;
+        for (Value operand : op.getOperands())
+          if (auto buffer = operand.getDefiningOp<BufferOp>())
+            accessed.insert(buffer);
+      }
+      if (accessed.size() > 1)
+        groups.push_back(std::move(accessed));
+    });
+  return groups;
+}
+
+static llvm::json::Object
+reportTile(TileOp tile, ArrayRef<BufferOp> buffers,
+           ArrayRef<DenseSet<Operation *>> vectorAccesses) {
+  const auto &targetModel = getTargetModel(tile);
+  int64_t size = tile.isMemTile() ? targetModel.getMemTileSize()
+                                  : targetModel.getLocalMemorySize();
+  int64_t numBanks = targetModel.getNumBanks(tile.getCol(), tile.getRow());
+  int64_t bankSize = size / numBanks;
+  int64_t stackSize = 0;
+  if (auto core = tile.getCoreOp())
+    stackSize = core.getStackSize();
+
+  std::vector<PlacedBuffer> placed;
+  llvm::json::Array unplaced;
+  for (auto buffer : buffers) {
+    if (!buffer->hasAttr("address")) {
+      unplaced.push_back(getBufferName(buffer));
+      continue;
+    }
+    int64_t start = buffer.address();
+    int64_t end = start + buffer.getAllocationSize();
+    placed.push_back({buffer, start, end, start / bankSize,
+                      std::max(start, end - 1) / bankSize});
+  }
+  std::stable_sort(placed.begin(), placed.end(),
+                   [](const PlacedBuffer &a, const PlacedBuffer &b) {
+                     return a.start < b.start;
+                   });
+
+  // the free ranges are what lies between the stack and the buffers, sorted
+  // by address
+  int64_t used = stackSize;
+  int64_t freeBytes = 0, largestFree = 0, numFreeRanges = 0;
+  int64_t top = stackSize;
+  auto addFree = [&](int64_t start, int64_t end) {
+    if (end <= start)
+      return;
+    freeBytes += end - start;
+    largestFree = std::max(largestFree, end - start);
+    numFreeRanges++;
+  };
+  for (auto &buffer : placed) {
+    addFree(top, buffer.start);
+    used += buffer.end - buffer.start;
+    top = std::max(top, buffer.end);
+  }
+  addFree(top, size);
+
+  llvm::json::Array bufferReports;
+  std::map<int64_t, llvm::json::Array> bankBuffers;
+  for (auto &buffer : placed) {
+    bufferReports.push_back(llvm::json::Object{
+        {"name", getBufferName(buffer.buffer)},
+        {"address", buffer.start},
+        {"size", buffer.end - buffer.start},
+        {"banks", llvm::json::Array{buffer.firstBank, buffer.lastBank}}});
+    for (int64_t bank = buffer.firstBank; bank <= buffer.lastBank; bank++)
+      bankBuffers[bank].push_back(getBufferName(buffer.buffer));
+  }
+  llvm::json::Array bankReports;
+  for (auto &[bank, names] : bankBuffers)
+    bankReports.push_back(
+        llvm::json::Object{{"bank", bank}, {"buffers", std::move(names)}});
+
+  llvm::json::Array conflicts;
+  for (unsigned i = 0; i < placed.size(); i++)
+    for (unsigned j = i + 1; j < placed.size(); j++) {
+      if (!placed[i].sharesBank(placed[j]))
+        continue;
+      Operation *a = placed[i].buffer, *b = placed[j].buffer;
+      if (llvm::none_of(vectorAccesses, [&](const DenseSet<Operation *> &s) {
+            return s.count(a) && s.count(b);
+          }))
+        continue;
+      conflicts.push_back(llvm::json::Object{
+          {"buffers", llvm::json::Array{getBufferName(placed[i].buffer),
+                                        getBufferName(placed[j].buffer)}},
+          {"bank", std::max(placed[i].firstBank, placed[j].firstBank)}});
+    }
+
+  double fragmentation =
+      freeBytes > 0 ? 1.0 - (double)largestFree / freeBytes : 0.0;
+  return llvm::json::Object{{"col", tile.getCol()},
+                            {"row", tile.getRow()},
+                            {"size", size},
+                            {"stack_size", stackSize},
+                            {"used_bytes", used},
+                            {"free_bytes", freeBytes},
+                            {"free_ranges", numFreeRanges},
+                            {"largest_free_range", largestFree},
+                            {"fragmentation", fragmentation},
+                            {"bank_size", bankSize},
+                            {"buffers", std::move(bufferReports)},
+                            {"unplaced_buffers", std::move(unplaced)},
+                            {"banks", std::move(bankReports)},
+                            {"bank_conflicts", std::move(conflicts)}};
+}
+
+mlir::LogicalResult xilinx::AIE::AIEBufferReport(ModuleOp module,
+                                                 raw_ostream &output) {
+  for (auto device : module.getOps<DeviceOp>()) {
+    DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
+    for (auto buffer : device.getOps<BufferOp>())
+      buffers[buffer.getTileOp()].push_back(buffer);
+    auto vectorAccesses = collectVectorAccesses(device);
+
+    llvm::json::Object deviceJSON;
+    for (auto tile : device.getOps<TileOp>()) {
+      if (tile.isShimTile())
+        continue;
+      deviceJSON[llvm::formatv("tile({0}, {1})", tile.getCol(), tile.getRow())
+                     .str()] =
+          reportTile(tile, buffers[tile.getOperation()], vectorAccesses);
+    }
+    output << llvm::formatv("{0:2}",
+                            llvm::json::Value(std::move(deviceJSON)))
+           << "\n";
+  }
+  return success();
+}
@@ -28,12 +28,13 @@
 #include "mlir/Transforms/Passes.h"
 
 #include "llvm/IR/Module.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/TargetSelect.h"
 
 #include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 
-#include "AIETargets.h"
+#include "aie/Targets/AIETargets.h"
 
 using namespace mlir;
 using namespace xilinx;
@@ -79,16 +80,34 @@ std::pair<uint32_t, uint32_t> getNextCoords(uint32_t col, uint32_t row,
   }
 }
 
+// The switchboxes a route passes through, with the directions in which it
+// leaves each of them.
+struct RouteStep {
+  TileID coords;
+  SmallVector<WireBundle, 4> dirs;
+};
+
 mlir::LogicalResult AIEFlowsToJSON(ModuleOp module, raw_ostream &output) {
-  output << "{\n";
-  if (module.getOps<DeviceOp>().empty()) {
-    module.emitOpError("expected AIE.device operation at toplevel");
-  }
+  if (module.getOps<DeviceOp>().empty())
+    return module.emitOpError("expected AIE.device operation at toplevel");
   DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
+  const AIETargetModel &targetModel = targetOp.getTargetModel();
+
+  std::map<TileID, SwitchboxOp> switchboxes;
+  for (SwitchboxOp switchboxOp : targetOp.getOps<SwitchboxOp>())
+    switchboxes[std::make_pair(switchboxOp.colIndex(),
+                               switchboxOp.rowIndex())] = switchboxOp;
+  std::map<TileID, ShimMuxOp> shimMuxes;
+  for (ShimMuxOp shimMuxOp : targetOp.getOps<ShimMuxOp>())
+    shimMuxes[std::make_pair(shimMuxOp.colIndex(), shimMuxOp.rowIndex())] =
+        shimMuxOp;
 
-  // count flow sources and destinations
+  // count flow sources and destinations, and group the flows by source port:
+  // the flows of a source port share one route, which fans out
   std::map<TileID, int> source_counts;
   std::map<TileID, int> destination_counts;
+  std::vector<std::pair<TileID, Port>> flowSources;
+  std::map<std::pair<TileID, Port>, std::vector<FlowOp>> flowsBySource;
   for (FlowOp flowOp : targetOp.getOps<FlowOp>()) {
     TileOp source = cast<TileOp>(flowOp.getSource().getDefiningOp());
     TileOp dest = cast<TileOp>(flowOp.getDest().getDefiningOp());
@@ -96,175 +115,175 @@ mlir::LogicalResult AIEFlowsToJSON(ModuleOp module, raw_ostream &output) {
     TileID dstID = std::make_pair(dest.colIndex(), dest.rowIndex());
     source_counts[srcID]++;
     destination_counts[dstID]++;
+    auto flowSource = std::make_pair(
+        srcID,
+        std::make_pair(flowOp.getSourceBundle(), flowOp.getSourceChannel()));
+    if (!flowsBySource.count(flowSource))
+      flowSources.push_back(flowSource);
+    flowsBySource[flowSource].push_back(flowOp);
   }
 
-  // for each switchbox, write name, coordinates, and routing demand info
-  for (SwitchboxOp switchboxOp : targetOp.getOps<SwitchboxOp>()) {
-    uint32_t col = switchboxOp.colIndex();
-    uint32_t row = switchboxOp.rowIndex();
-    std::string switchString = "\"switchbox" + std::to_string(col) +
-                               std::to_string(row) + "\": {\n" +
-                               "\"col\": " + std::to_string(col) + ",\n" +
-                               "\"row\": " + std::to_string(row) + ",\n";
-
-    // write source and destination info
-    switchString += "\"source_count\": " +
-                    std::to_string(source_counts[std::make_pair(col, row)]) +
-                    ",\n";
-    switchString +=
-        "\"destination_count\": " +
-        std::to_string(destination_counts[std::make_pair(col, row)]) + ",\n";
-
-    // write routing demand info
-    uint32_t connect_counts[10];
-    for (int i = 0; i < 10; i++)
-      connect_counts[i] = 0;
-    for (ConnectOp connectOp : switchboxOp.getOps<ConnectOp>())
-      connect_counts[int(connectOp.getDestBundle())]++;
-
-    switchString += "\"northbound\": " +
-                    std::to_string(connect_counts[int(WireBundle::North)]) +
-                    ",\n";
-    switchString += "\"eastbound\": " +
-                    std::to_string(connect_counts[int(WireBundle::East)]) +
-                    ",\n";
-    switchString += "\"southbound\": " +
-                    std::to_string(connect_counts[int(WireBundle::South)]) +
-                    ",\n";
-    switchString += "\"westbound\": " +
-                    std::to_string(connect_counts[int(WireBundle::West)]) +
-                    "\n";
-    switchString += "},\n";
-    output << switchString;
-  }
-
-  // for each flow, trace it through switchboxes and write the route to JSON
-  int flow_count = 0;
-  std::set<std::pair<TileOp, Port>> flowSources;
-  for (FlowOp flowOp : targetOp.getOps<FlowOp>()) {
-    // objects used to trace through the flow
-    Port curr_port =
-        std::make_pair(flowOp.getSourceBundle(), flowOp.getSourceChannel());
-    SwitchboxOp curr_switchbox;
-
-    TileOp source = cast<TileOp>(flowOp.getSource().getDefiningOp());
-    // TileOp dest = cast<TileOp>(flowOp.dest().getDefiningOp());
-
-    // track flow sources to avoid duplicate routes
-    auto flowSource = std::make_pair(source, curr_port);
-    if (flowSources.count(flowSource)) {
-      continue;
-    }
-    flowSources.insert(flowSource);
-
-    std::string routeString =
-        "\"route" + std::to_string(flow_count++) + "\": [ ";
-
-    // FIFO to handle fanouts
-    std::queue<Port> next_ports;
-    std::queue<SwitchboxOp> next_switches;
-
-    // find the starting switchbox
-    for (SwitchboxOp switchboxOp : targetOp.getOps<SwitchboxOp>()) {
-      if (switchboxOp.colIndex() == source.colIndex() &&
-          switchboxOp.rowIndex() == source.rowIndex()) {
-        curr_switchbox = switchboxOp;
-        break;
-      }
-    }
+  // trace the route of each flow source through the switchboxes
+  std::vector<std::vector<RouteStep>> routes;
+  std::map<TileID, std::vector<int>> routesThrough;
+  for (auto &flowSource : flowSources) {
+    TileID srcID = flowSource.first;
+    Port curr_port = flowSource.second;
+    std::vector<RouteStep> &route = routes.emplace_back();
+    int routeID = routes.size() - 1;
 
     // if the flow starts in a shim, handle seperately
-    for (ShimMuxOp shimMuxOp : targetOp.getOps<ShimMuxOp>()) {
-      if (shimMuxOp.colIndex() == source.colIndex() &&
-          shimMuxOp.rowIndex() == source.rowIndex()) {
-        for (ConnectOp connectOp : shimMuxOp.getOps<ConnectOp>()) {
-          if (connectOp.getSourceBundle() == curr_port.first &&
-              connectOp.getSourceChannel() == (unsigned)curr_port.second) {
-            curr_port.first = getConnectingBundle(connectOp.getDestBundle());
-            curr_port.second = connectOp.getDestChannel();
-            break;
-          }
+    if (shimMuxes.count(srcID)) {
+      for (ConnectOp connectOp : shimMuxes[srcID].getOps<ConnectOp>()) {
+        if (connectOp.getSourceBundle() == curr_port.first &&
+            connectOp.getSourceChannel() == (unsigned)curr_port.second) {
+          curr_port.first = getConnectingBundle(connectOp.getDestBundle());
+          curr_port.second = connectOp.getDestChannel();
+          break;
         }
-        break;
       }
     }
+    if (!switchboxes.count(srcID))
+      continue;
 
-    // trace through the flow and add switchbox coordinates to JSON
-    bool done = false;
-    do {
-      // get the coordinates for the next switchbox in the flow
+    // FIFO to handle fanouts
+    std::queue<std::pair<Port, SwitchboxOp>> next;
+    next.push(std::make_pair(curr_port, switchboxes[srcID]));
+    while (!next.empty()) {
+      curr_port = next.front().first;
+      SwitchboxOp curr_switchbox = next.front().second;
+      next.pop();
+
+      RouteStep step;
+      step.coords =
+          std::make_pair(curr_switchbox.colIndex(), curr_switchbox.rowIndex());
       for (ConnectOp connectOp : curr_switchbox.getOps<ConnectOp>()) {
-        // if this connectOp is the end of a flow, skip
+        if (connectOp.getSourceBundle() != curr_port.first ||
+            connectOp.getSourceChannel() != (unsigned)curr_port.second)
+          continue;
+        step.dirs.push_back(connectOp.getDestBundle());
+
+        // if this connectOp is the end of a flow, stop here
         if ((curr_switchbox.rowIndex() == 0 &&
              connectOp.getDestBundle() == WireBundle::South) ||
             connectOp.getDestBundle() == WireBundle::DMA ||
             connectOp.getDestBundle() == WireBundle::Core)
           continue;
 
-        if (connectOp.getSourceBundle() == curr_port.first &&
-            connectOp.getSourceChannel() == (unsigned)curr_port.second) {
-          next_ports.push(
+        // continue in the next switchbox
+        auto next_sb = switchboxes.find(getNextCoords(
+            step.coords.first, step.coords.second, connectOp.getDestBundle()));
+        if (next_sb != switchboxes.end())
+          next.push(std::make_pair(
               std::make_pair(getConnectingBundle(connectOp.getDestBundle()),
-                             connectOp.getDestChannel()));
+                             (int)connectOp.getDestChannel()),
+              next_sb->second));
+      }
+      if (!step.dirs.empty()) {
+        std::vector<int> &through = routesThrough[step.coords];
+        if (through.empty() || through.back() != routeID)
+          through.push_back(routeID);
+        route.push_back(step);
+      }
+    }
+  }
 
-          std::pair<uint32_t, uint32_t> next_coords = getNextCoords(
-              curr_switchbox.colIndex(), curr_switchbox.rowIndex(),
-              connectOp.getDestBundle());
+  llvm::json::OStream J(output, 2);
+  J.object([&] {
+    // for each switchbox, write name, coordinates, and routing demand info:
+    // the number of channels used in each direction, the number available
+    // and the routes passing through
+    for (auto &entry : switchboxes) {
+      uint32_t col = entry.first.first;
+      uint32_t row = entry.first.second;
+      std::map<WireBundle, std::set<int>> usedChannels;
+      for (ConnectOp connectOp : entry.second.getOps<ConnectOp>())
+        usedChannels[connectOp.getDestBundle()].insert(
+            connectOp.getDestChannel());
+      for (MasterSetOp masterSetOp : entry.second.getOps<MasterSetOp>())
+        usedChannels[masterSetOp.getDestBundle()].insert(
+            masterSetOp.getDestChannel());
 
-          // search for next switchbox to connect to
-          for (SwitchboxOp switchboxOp : targetOp.getOps<SwitchboxOp>()) {
-            if (uint32_t(switchboxOp.colIndex()) == next_coords.first &&
-                uint32_t(switchboxOp.rowIndex()) == next_coords.second) {
-              next_switches.push(switchboxOp);
-              break;
-            }
-          }
-        }
-      }
+      J.attributeObject(
+          "switchbox" + std::to_string(col) + std::to_string(row), [&] {
+            J.attribute("col", (int64_t)col);
+            J.attribute("row", (int64_t)row);
+            J.attribute("source_count", source_counts[entry.first]);
+            J.attribute("destination_count", destination_counts[entry.first]);
+            J.attribute("northbound",
+                        (int64_t)usedChannels[WireBundle::North].size());
+            J.attribute("eastbound",
+                        (int64_t)usedChannels[WireBundle::East].size());
+            J.attribute("southbound",
+                        (int64_t)usedChannels[WireBundle::South].size());
+            J.attribute("westbound",
+                        (int64_t)usedChannels[WireBundle::West].size());
+            J.attributeArray("channels", [&] {
+              for (WireBundle bundle : {WireBundle::North, WireBundle::East,
+                                        WireBundle::South, WireBundle::West}) {
+                J.object([&] {
+                  J.attribute("bundle", stringifyWireBundle(bundle));
+                  J.attribute("used", (int64_t)usedChannels[bundle].size());
+                  J.attribute("max",
+                              (int64_t)targetModel
+                                  .getNumDestSwitchboxConnections(col, row,
+                                                                  bundle));
+                });
+              }
+            });
+            J.attributeArray("routes", [&] {
+              for (int routeID : routesThrough[entry.first])
+                J.value(routeID);
+            });
+          });
+    }
 
-      // add switchbox to the routeString
-      std::string dirString =
-          std::string("[[") + std::to_string(curr_switchbox.colIndex()) + ", " +
-          std::to_string(curr_switchbox.rowIndex()) + "], [";
-      int op_count = 0, dir_count = 0;
-      for (ConnectOp connectOp : curr_switchbox.getOps<ConnectOp>()) {
-        if (connectOp.getSourceBundle() == curr_port.first &&
-            connectOp.getSourceChannel() == (unsigned)curr_port.second) {
-          if (op_count++ > 0)
-            dirString += ", ";
-          dir_count++;
-          dirString +=
-              "\"" +
-              (std::string)stringifyWireBundle(connectOp.getDestBundle()) +
-              "\"";
+    // for each route, write the switchboxes it goes through with the
+    // directions it takes out of them, and the ports it connects
+    for (size_t i = 0; i < routes.size(); i++) {
+      J.attributeArray("route" + std::to_string(i), [&] {
+        for (RouteStep &step : routes[i]) {
+          J.array([&] {
+            J.array([&] {
+              J.value((int64_t)step.coords.first);
+              J.value((int64_t)step.coords.second);
+            });
+            J.array([&] {
+              for (WireBundle dir : step.dirs)
+                J.value(stringifyWireBundle(dir));
+            });
+          });
         }
-      }
-      dirString += "]], ";
-      if (dir_count > 0)
-        routeString += dirString;
-
-      // if in the same switchbox, ignore it
-      // if(curr_switchbox == next_switches.front()) {
-      //	next_ports.pop();
-      //	next_switches.pop();
-      //}
-      if (next_ports.empty() || next_switches.empty()) {
-        done = true;
-        routeString += "[]";
-      } else {
-        curr_port = next_ports.front();
-        curr_switchbox = next_switches.front();
-        next_ports.pop();
-        next_switches.pop();
-      }
-    } while (!done);
-    // write string to JSON
-    routeString += std::string(" ],\n");
-    output << routeString;
-  }
-  output << "\"route_all\": [],\n";
-  output << "\n\"end json\": 0\n"; // dummy line to avoid errors from commas
-  output << "}";
+        J.array([] {});
+      });
+    }
+    for (size_t i = 0; i < routes.size(); i++) {
+      auto &flowSource = flowSources[i];
+      J.attributeObject("flow" + std::to_string(i), [&] {
+        J.attribute("route", (int64_t)i);
+        J.attributeObject("source", [&] {
+          J.attribute("col", (int64_t)flowSource.first.first);
+          J.attribute("row", (int64_t)flowSource.first.second);
+          J.attribute("bundle", stringifyWireBundle(flowSource.second.first));
+          J.attribute("channel", flowSource.second.second);
+        });
+        J.attributeArray("destinations", [&] {
+          for (FlowOp flowOp : flowsBySource[flowSource]) {
+            TileOp dest = cast<TileOp>(flowOp.getDest().getDefiningOp());
+            J.object([&] {
+              J.attribute("col", (int64_t)dest.colIndex());
+              J.attribute("row", (int64_t)dest.rowIndex());
+              J.attribute("bundle",
+                          stringifyWireBundle(flowOp.getDestBundle()));
+              J.attribute("channel", (int64_t)flowOp.getDestChannel());
+            });
+          }
+        });
+        J.attribute("switchboxes", (int64_t)routes[i].size());
+      });
+    }
+  });
+  output << "\n";
   return success();
 } // end AIETranslateToJSON
 } // namespace AIE
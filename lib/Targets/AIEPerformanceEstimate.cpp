@@ -0,0 +1,461 @@
+//===- AIEPerformanceEstimate.cpp -------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Takes as input the mlir before AIEObjectFifoStatefulTransform, where the
+ * depths of the objectFifos and the tiles producing and consuming them are
+ * explicit.
+ * Estimates the steady state of the dataflow of each device as JSON, without
+ * building or simulating it.  Over a run of the design, each stage of the
+ * dataflow is busy for some cycles: the cores, the streams of the
+ * objectFifos between tiles which do not share memory, and the DDR bandwidth
+ * of the shim columns and of the NOC.  The endpoints of an objectFifo
+ * without an element more than they acquire at once cannot overlap, and
+ * form a single stage.  The stages run concurrently, so the slowest one, the
+ * bottleneck, gives the cycles of a run in the steady state.  For each
+ * objectFifo whose depth makes the bottleneck, the steady state with one
+ * more element is estimated too.
+ *
+ * The cycles of a core are those of its operations, one each, times the trip
+ * counts of the loops around them.  The acquires and releases of
+ * objectFifos take the lock latency of the target model instead.  Functions
+ * and operations annotated with an aie.cycles integer attribute, such as
+ * kernels measured in isolation, take that many cycles.  The AIEVec
+ * operations take the issue cycles of the AIEVec cost model of the device,
+ * as the vector loops are software pipelined in the steady state.  The
+ * bandwidths of the streams, the DMAs, the shim tiles and the NOC also come
+ * from the target model.
+ */
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/SymbolTable.h"
+
+#include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "aie/Dialect/AIEVec/Utils/CostModel.h"
+
+#include "aie/Targets/AIETargets.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+static const char *CYCLES_ATTR_NAME = "aie.cycles";
+
+namespace {
+
+// A port of an objectFifo.
+using Port = std::pair<Operation *, int>;
+
+struct CoreEstimate {
+  double cycles = 0;
+  // The elements the core releases on each port over a run.
+  DenseMap<Port, double> released;
+  // The most elements the core holds at once on each port.
+  DenseMap<Port, int> acquired;
+  // The external functions the core calls, of unknown cycles.
+  std::set<std::string> unknownCalls;
+  bool unknownTripCounts = false;
+};
+
+struct FifoEstimate {
+  ObjectFifoCreateOp fifo;
+  double elements = 0;
+  int64_t elementBytes = 0;
+  // Whether the only consumer shares the memory of the producer, instead of
+  // receiving the elements from a stream.
+  bool shared = false;
+};
+
+struct Stage {
+  std::string name;
+  double cycles = 0;
+  // The objectFifo, and the tile of its endpoint, whose depth makes the
+  // stage, if any.
+  ObjectFifoCreateOp fifo;
+  TileOp tile;
+  int depth = 0;
+};
+
+} // namespace
+
+static std::string tileName(TileOp tile) {
+  return llvm::formatv("tile({0}, {1})", tile.getCol(), tile.getRow()).str();
+}
+
+/// Function that returns the number of iterations of forLoop, or -1 if its
+/// bounds are not constants.
+static int64_t getTripCount(scf::ForOp forLoop) {
+  auto lb = getConstantIntValue(forLoop.getLowerBound());
+  auto ub = getConstantIntValue(forLoop.getUpperBound());
+  auto step = getConstantIntValue(forLoop.getStep());
+  if (!lb || !ub || !step || *step <= 0)
+    return -1;
+  if (*ub <= *lb)
+    return 0;
+  return (*ub - *lb + *step - 1) / *step;
+}
+
+static void estimateBlock(Block &block, double trips, bool countCycles,
+                          const aievec::AIEVecCostModel &costModel,
+                          CoreEstimate &estimate,
+                          SmallPtrSetImpl<Operation *> &callStack);
+
+/// Function that adds the cycles and the objectFifo accesses of op, run
+/// trips times, to estimate.  The cycles of op and of its regions are only
+/// counted if countCycles is set, as they are already known otherwise.
+static void estimateOp(Operation &op, double trips, bool countCycles,
+                       const aievec::AIEVecCostModel &costModel,
+                       CoreEstimate &estimate,
+                       SmallPtrSetImpl<Operation *> &callStack) {
+  if (op.hasTrait<OpTrait::IsTerminator>() ||
+      op.hasTrait<OpTrait::ConstantLike>())
+    return;
+  if (auto cycles = op.getAttrOfType<IntegerAttr>(CYCLES_ATTR_NAME)) {
+    if (countCycles)
+      estimate.cycles += trips * cycles.getInt();
+    countCycles = false;
+  } else if (countCycles) {
+    OperationName name = op.getName();
+    if (isa<ObjectFifoAcquireOp, ObjectFifoReleaseOp>(op))
+      estimate.cycles += trips * getTargetModel(&op).getLockCycles();
+    else if (name.getDialectNamespace() == "aievec")
+      estimate.cycles +=
+          trips * costModel.getOpCost(name.getStringRef()).issue;
+    else
+      estimate.cycles += trips;
+  }
+
+  if (auto acquire = dyn_cast<ObjectFifoAcquireOp>(op)) {
+    int &acquired = estimate.acquired[{acquire.getObjectFifo(),
+                                       static_cast<int>(acquire.getPort())}];
+    acquired = std::max(acquired, acquire.acqNumber());
+  } else if (auto release = dyn_cast<ObjectFifoReleaseOp>(op)) {
+    estimate.released[{release.getObjectFifo(),
+                       static_cast<int>(release.getPort())}] +=
+        trips * release.relNumber();
+  } else if (auto forLoop = dyn_cast<scf::ForOp>(op)) {
+    int64_t tripCount = getTripCount(forLoop);
+    if (tripCount < 0) {
+      estimate.unknownTripCounts = true;
+      tripCount = 1;
+    }
+    estimateBlock(*forLoop.getBody(), trips * tripCount, countCycles,
+                  costModel, estimate, callStack);
+  } else if (auto call = dyn_cast<func::CallOp>(op)) {
+    auto callee = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+        call, call.getCalleeAttr());
+    if (callee)
+      if (auto cycles = callee->getAttrOfType<IntegerAttr>(CYCLES_ATTR_NAME)) {
+        if (countCycles)
+          estimate.cycles += trips * cycles.getInt();
+        return;
+      }
+    if (!callee || callee.isExternal()) {
+      if (countCycles)
+        estimate.unknownCalls.insert(call.getCallee().str());
+      return;
+    }
+    // Recursive calls are only counted once.
+    if (!callStack.insert(callee).second)
+      return;
+    for (Block &block : callee.getBody())
+      estimateBlock(block, trips, countCycles, costModel, estimate,
+                    callStack);
+    callStack.erase(callee);
+  } else {
+    for (Region &region : op.getRegions())
+      for (Block &block : region)
+        estimateBlock(block, trips, countCycles, costModel, estimate,
+                      callStack);
+  }
+}
+
+static void estimateBlock(Block &block, double trips, bool countCycles,
+                          const aievec::AIEVecCostModel &costModel,
+                          CoreEstimate &estimate,
+                          SmallPtrSetImpl<Operation *> &callStack) {
+  for (Operation &op : block)
+    estimateOp(op, trips, countCycles, costModel, estimate, callStack);
+}
+
+/// Function that returns true if the memory of a can be accessed by the core
+/// of b, or the other way around.
+static bool isSharedMemory(TileOp a, TileOp b) {
+  if (!a.getCoreOp() || !b.getCoreOp())
+    return false;
+  const auto &targetModel = getTargetModel(a);
+  return targetModel.isLegalMemAffinity(a.getCol(), a.getRow(), b.getCol(),
+                                        b.getRow()) ||
+         targetModel.isLegalMemAffinity(b.getCol(), b.getRow(), a.getCol(),
+                                        a.getRow());
+}
+
+namespace {
+
+class DeviceEstimate {
+public:
+  explicit DeviceEstimate(DeviceOp device) : device(device) {
+    aievec::AIEVecCostModel costModel(
+        device.getTargetModel().getTargetArch() == AIEArch::AIE1 ? "aie"
+                                                                 : "aieml");
+    for (auto core : device.getOps<CoreOp>()) {
+      SmallPtrSet<Operation *, 4> callStack;
+      for (Block &block : core.getBody())
+        estimateBlock(block, 1, true, costModel, cores[core.getTileOp()],
+                      callStack);
+    }
+    for (auto fifo : device.getOps<ObjectFifoCreateOp>())
+      estimateFifo(fifo);
+    propagateThroughLinks();
+  }
+
+  /// Function that returns the stages of the dataflow, where the endpoints
+  /// of fifo on tile have the given depth instead of their own if set.
+  std::vector<Stage> getStages(ObjectFifoCreateOp overridden = {},
+                               TileOp overriddenTile = {},
+                               int overriddenDepth = 0) {
+    std::vector<Stage> stages;
+    for (auto &[tile, core] : cores)
+      stages.push_back({"core " + tileName(cast<TileOp>(tile)), core.cycles});
+
+    std::map<std::pair<int, int>, double> shimBytes;
+    for (auto &[op, estimate] : fifos) {
+      auto fifo = cast<ObjectFifoCreateOp>(op);
+      TileOp producer = fifo.getProducerTileOp();
+      SmallVector<TileOp, 4> consumers;
+      for (Value consumer : fifo.getConsumerTiles())
+        consumers.push_back(cast<TileOp>(consumer.getDefiningOp()));
+
+      double bytes = estimate.elements * estimate.elementBytes;
+      if (producer.isShimTile())
+        shimBytes[{producer.getCol(), 0}] += bytes;
+      for (auto consumer : consumers)
+        if (consumer.isShimTile())
+          shimBytes[{consumer.getCol(), 1}] += bytes;
+
+      double streamCycles = 0;
+      if (!estimate.shared) {
+        // A broadcast sends each element once to all the consumers, each
+        // from its own buffer descriptor.
+        const auto &targetModel = getTargetModel(producer);
+        int col = producer.getCol(), row = producer.getRow();
+        uint32_t bytesPerCycle =
+            std::min(targetModel.getStreamBytesPerCycle(),
+                     targetModel.getDmaBytesPerCycle(col, row));
+        streamCycles =
+            estimate.elements *
+            (static_cast<double>(estimate.elementBytes) / bytesPerCycle +
+             targetModel.getDmaSetupCycles(col, row));
+        stages.push_back({"stream @" + fifo.getSymName().str(), streamCycles});
+      }
+
+      // The endpoints holding every element of their side of the
+      // objectFifo cannot overlap with the other side.
+      // The elements of an objectFifo in shared memory are a single pool,
+      // of the depth of the producer.
+      auto coupled = [&](TileOp tile, int depth, bool produces,
+                         double otherCycles, StringRef other) {
+        if (fifo == overridden && (estimate.shared || tile == overriddenTile))
+          depth = overriddenDepth;
+        auto core = cores.find(tile);
+        if (core == cores.end())
+          return false;
+        auto port = static_cast<int>(produces ? ObjectFifoPort::Produce
+                                              : ObjectFifoPort::Consume);
+        int acquired = core->second.acquired.lookup({fifo, port});
+        if (acquired == 0 || depth > acquired)
+          return false;
+        stages.push_back({"@" + fifo.getSymName().str() + " of depth " +
+                              std::to_string(depth) + " between " +
+                              tileName(tile) + " and " + other.str(),
+                          core->second.cycles + otherCycles, fifo, tile,
+                          depth});
+        return true;
+      };
+      if (estimate.shared) {
+        TileOp consumer = consumers.front();
+        if (!coupled(producer, fifo.size(), true,
+                     cores.lookup(consumer).cycles,
+                     "core " + tileName(consumer)))
+          coupled(consumer, fifo.size(), false,
+                  cores.lookup(producer).cycles, "core " + tileName(producer));
+        continue;
+      }
+      coupled(producer, fifo.size(), true, streamCycles, "its stream");
+      for (auto [i, consumer] : llvm::enumerate(consumers)) {
+        int depth = isa<ArrayAttr>(fifo.getElemNumber()) ? fifo.size(i + 1)
+                                                         : fifo.size();
+        coupled(consumer, depth, false, streamCycles, "its stream");
+      }
+    }
+
+    const auto &targetModel = device.getTargetModel();
+    double nocBytes = 0;
+    for (auto &[column, bytes] : shimBytes) {
+      stages.push_back({llvm::formatv("shim column {0} {1} DDR", column.first,
+                                      column.second ? "writes to"
+                                                    : "reads from")
+                            .str(),
+                        bytes / targetModel.getShimBytesPerCycle()});
+      nocBytes += bytes;
+    }
+    if (nocBytes > 0)
+      stages.push_back({"NOC", nocBytes / targetModel.getNocBytesPerCycle()});
+
+    std::stable_sort(stages.begin(), stages.end(),
+                     [](const Stage &a, const Stage &b) {
+                       return a.cycles > b.cycles;
+                     });
+    return stages;
+  }
+
+  llvm::json::Object report() {
+    llvm::json::Object coresJSON;
+    for (auto &[tile, core] : cores) {
+      llvm::json::Array unknownCalls;
+      for (const std::string &callee : core.unknownCalls)
+        unknownCalls.push_back(callee);
+      coresJSON[tileName(cast<TileOp>(tile))] = llvm::json::Object{
+          {"cycles", core.cycles},
+          {"unknown_calls", std::move(unknownCalls)},
+          {"unknown_trip_counts", core.unknownTripCounts}};
+    }
+
+    llvm::json::Object fifosJSON;
+    for (auto &[op, estimate] : fifos) {
+      auto fifo = cast<ObjectFifoCreateOp>(op);
+      fifosJSON[fifo.getSymName()] = llvm::json::Object{
+          {"elements", estimate.elements},
+          {"element_bytes", estimate.elementBytes},
+          {"depth", fifo.size()},
+          {"transfer", estimate.shared ? "shared memory" : "stream"}};
+    }
+
+    std::vector<Stage> stages = getStages();
+    llvm::json::Array stagesJSON;
+    for (const Stage &stage : stages)
+      stagesJSON.push_back(
+          llvm::json::Object{{"name", stage.name}, {"cycles", stage.cycles}});
+    llvm::json::Object result{{"cores", std::move(coresJSON)},
+                              {"objectFifos", std::move(fifosJSON)},
+                              {"stages", std::move(stagesJSON)}};
+    if (stages.empty())
+      return result;
+
+    // The design-space exploration of the depths: one more element for the
+    // endpoints of the objectFifos which serialize the bottleneck.
+    const Stage &bottleneck = stages.front();
+    llvm::json::Array suggestions;
+    for (const Stage &stage : stages) {
+      if (stage.cycles < bottleneck.cycles || !stage.fifo)
+        continue;
+      std::vector<Stage> deeper =
+          getStages(stage.fifo, stage.tile, stage.depth + 1);
+      suggestions.push_back(llvm::json::Object{
+          {"objectFifo", stage.fifo.getSymName()},
+          {"tile", tileName(stage.tile)},
+          {"depth", stage.depth + 1},
+          {"steady_state_cycles", deeper.front().cycles},
+          {"bottleneck", deeper.front().name}});
+    }
+    result["steady_state_cycles"] = bottleneck.cycles;
+    result["bottleneck"] = bottleneck.name;
+    result["suggestions"] = std::move(suggestions);
+    return result;
+  }
+
+private:
+  void estimateFifo(ObjectFifoCreateOp fifo) {
+    FifoEstimate &estimate = fifos[fifo];
+    estimate.fifo = fifo;
+    MemRefType elemType = fifo.getElemType()
+                              .cast<AIEObjectFifoType>()
+                              .getElementType()
+                              .cast<MemRefType>();
+    estimate.elementBytes =
+        elemType.getNumElements() * elemType.getElementTypeBitWidth() / 8;
+
+    TileOp producer = fifo.getProducerTileOp();
+    auto consumers = fifo.getConsumerTiles();
+    estimate.shared =
+        consumers.size() == 1 &&
+        isSharedMemory(producer, cast<TileOp>(consumers[0].getDefiningOp()));
+
+    // The elements produced over a run, or consumed if the producer is not
+    // a core.
+    auto produced = cores.find(producer);
+    if (produced != cores.end()) {
+      estimate.elements = produced->second.released.lookup(
+          {fifo, static_cast<int>(ObjectFifoPort::Produce)});
+      return;
+    }
+    for (Value consumer : consumers) {
+      auto consumed = cores.find(consumer.getDefiningOp());
+      if (consumed != cores.end())
+        estimate.elements = std::max(
+            estimate.elements,
+            consumed->second.released.lookup(
+                {fifo, static_cast<int>(ObjectFifoPort::Consume)}));
+    }
+  }
+
+  /// Function that gives the objectFifos linked through a memtile or a shim
+  /// tile, which no core produces or consumes, the elements of the
+  /// objectFifos they are linked to.
+  void propagateThroughLinks() {
+    auto links = llvm::to_vector(device.getOps<ObjectFifoLinkOp>());
+    // Forwards from the inputs, then backwards from the outputs.
+    for (auto link : links) {
+      double elements = 0;
+      for (auto in : link.getInputObjectFifos())
+        elements = std::max(elements, fifos[in].elements);
+      for (auto out : link.getOutputObjectFifos())
+        if (fifos[out].elements == 0)
+          fifos[out].elements = elements * out.getRepeatCount().value_or(1);
+    }
+    for (auto link : llvm::reverse(links)) {
+      double elements = 0;
+      for (auto out : link.getOutputObjectFifos())
+        elements = std::max(elements, fifos[out].elements /
+                                          out.getRepeatCount().value_or(1));
+      for (auto in : link.getInputObjectFifos())
+        if (fifos[in].elements == 0)
+          fifos[in].elements = elements;
+    }
+  }
+
+  DeviceOp device;
+  llvm::MapVector<Operation *, CoreEstimate> cores;
+  llvm::MapVector<Operation *, FifoEstimate> fifos;
+};
+
+} // namespace
+
+mlir::LogicalResult xilinx::AIE::AIEEstimatePerformance(ModuleOp module,
+                                                        raw_ostream &output) {
+  for (auto device : module.getOps<DeviceOp>()) {
+    DeviceEstimate estimate(device);
+    output << llvm::formatv("{0:2}", llvm::json::Value(estimate.report()))
+           << "\n";
+  }
+  return success();
+}
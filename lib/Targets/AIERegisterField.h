@@ -0,0 +1,47 @@
+//===- AIERegisterField.h ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// The bitfields of the configuration registers, for the targets computing
+// register values at compile time.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef AIE_TARGETS_AIEREGISTERFIELD_H
+#define AIE_TARGETS_AIEREGISTERFIELD_H
+
+#include <cstdint>
+
+namespace xilinx {
+namespace AIE {
+
+// This template can be instantiated to represent a bitfield in a register.
+template <uint8_t high_bit, uint8_t low_bit = high_bit> class Field final {
+public:
+  static_assert(high_bit >= low_bit,
+                "The high bit should be higher than the low bit");
+  static_assert(high_bit < sizeof(uint32_t) * 8u,
+                "The field must live in a 32-bit register");
+
+  static constexpr auto num_bits_used = (high_bit - low_bit) + 1u;
+  static constexpr auto unshifted_mask = (1u << num_bits_used) - 1u;
+  static_assert((low_bit != high_bit) xor (unshifted_mask == 1),
+                "1 is a valid mask iff the field is 1 bit wide");
+
+  static constexpr auto shifted_mask = unshifted_mask << low_bit;
+
+  [[nodiscard]] constexpr uint32_t operator()(uint32_t value) const {
+    return (value << low_bit) & shifted_mask;
+  }
+};
+
+} // namespace AIE
+} // namespace xilinx
+
+#endif // AIE_TARGETS_AIEREGISTERFIELD_H
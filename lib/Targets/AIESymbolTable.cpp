@@ -0,0 +1,85 @@
+//===- AIESymbolTable.cpp ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Takes as input the mlir after AIEAssignBufferAddresses and
+ * AIEAssignLockIDs.
+ * Emits the buffers and locks of each device with their tiles as JSON, so that
+ * host tools can look up the physical address of a buffer or the ID of a lock
+ * by name at load time, instead of being compiled against the textual memory
+ * map.
+ */
+
+#include "mlir/IR/Attributes.h"
+
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
+
+#include "aie/Targets/AIETargets.h"
+
+using namespace mlir;
+using namespace xilinx;
+using namespace xilinx::AIE;
+
+mlir::LogicalResult xilinx::AIE::AIESymbolTable(ModuleOp module,
+                                                raw_ostream &output) {
+  for (auto device : module.getOps<DeviceOp>()) {
+    AIEArch arch = device.getTargetModel().getTargetArch();
+    // The physical address of a tile is its column and row shifted into the
+    // upper bits of the array address space, as in the libXAIE configuration.
+    int64_t colShift = arch == AIEArch::AIE1 ? 23 : 25;
+    int64_t rowShift = arch == AIEArch::AIE1 ? 18 : 20;
+
+    llvm::json::Array buffers;
+    for (auto buffer : device.getOps<BufferOp>()) {
+      if (!buffer.hasName() || !buffer->hasAttr("address"))
+        continue;
+      TileOp tile = buffer.getTileOp();
+      int64_t offset = buffer.address();
+      int64_t address = ((int64_t)tile.getCol() << colShift) |
+                        ((int64_t)tile.getRow() << rowShift) | offset;
+      buffers.push_back(
+          llvm::json::Object{{"name", buffer.name().getValue().str()},
+                             {"col", tile.getCol()},
+                             {"row", tile.getRow()},
+                             {"offset", offset},
+                             {"size", (int64_t)buffer.getAllocationSize()},
+                             {"address", address}});
+    }
+
+    llvm::json::Array locks;
+    for (auto lock : device.getOps<LockOp>()) {
+      if (!lock.getLockID())
+        continue;
+      TileOp tile = lock.getTileOp();
+      llvm::json::Object lockJSON{{"col", tile.getCol()},
+                                  {"row", tile.getRow()},
+                                  {"id", lock.getLockIDValue()}};
+      if (lock.hasName())
+        lockJSON["name"] = lock.name().getValue().str();
+      if (auto init = lock.getInit())
+        lockJSON["init"] = *init;
+      locks.push_back(std::move(lockJSON));
+    }
+
+    llvm::json::Object deviceJSON{
+        {"arch", arch == AIEArch::AIE1 ? "AIE" : stringifyEnum(arch).str()},
+        {"col_shift", colShift},
+        {"row_shift", rowShift},
+        {"buffers", std::move(buffers)},
+        {"locks", std::move(locks)}};
+    output << llvm::formatv("{0:2}",
+                            llvm::json::Value(std::move(deviceJSON)))
+           << "\n";
+  }
+  return success();
+}
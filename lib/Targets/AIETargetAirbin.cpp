@@ -9,16 +9,21 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/None.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <ext/stdio_filebuf.h>
 #include <fcntl.h> // open
 #include <gelf.h>
 #include <iostream>
+#include <map>
+#include <queue>
 #include <sstream>
 #include <string.h>
 #include <sys/stat.h>
+#include <tuple>
 #include <unistd.h> // read
 #include <utility>  // pair
 #include <vector>
@@ -28,6 +33,8 @@
 #include "aie/Dialect/AIEX/IR/AIEXDialect.h"
 #include "libelf.h"
 
+#include "AIERegisterField.h"
+
 // Marks a particular code path as unfinished.
 #define TODO assert(false)
 
@@ -114,6 +121,15 @@ static constexpr auto TILE_ADDR_ARR_SHIFT =
 #define REG_SHIM_DMA_ADDR_LOW_BD(_idx)                                         \
   (0x1D000 + ((_idx)*REG_SHIM_DMA_BD_SIZE) + 0x0)
 
+/*
+        Tile clock control, of the core modules and of the shim tiles. The
+   clock of a tile comes from the tile below it when that one enables its
+   next tile clock.
+*/
+static constexpr auto REG_TILE_CLOCK_CTRL = 0x36040u;
+static constexpr auto TILE_CLOCK_BUFFER_ENABLE = 1u << 0;
+static constexpr auto TILE_CLOCK_NEXT_ENABLE = 1u << 1;
+
 static constexpr auto REG_SHM_MUX = 0x1f000u; // a mux?
 
 /*
@@ -156,11 +172,90 @@ static const char *sec_name_str[SEC_IDX_MAX] = {
 static size_t stridx;
 
 /*
-        Holds a sorted list of all writes made to device memory
-        All recorded writes are time/order invariant. This allows sorting to
-   compact the airbin.
+        Sections of this type hold run-length encoded data: a sequence of
+   records starting with a header word. When AIRBIN_RLE_FILL is set in the
+   header, it is followed by a single word to repeat 'count' times, and
+   otherwise by 'count' literal words, where 'count' is the rest of the
+   header. mlir_aie_write_airbin_section in the test library decodes them.
+*/
+static constexpr auto SHT_AIRBIN_RLE = SHT_LOUSER + 1u;
+static constexpr uint32_t AIRBIN_RLE_FILL = 0x80000000u;
+static constexpr uint32_t AIRBIN_RLE_MAX_COUNT = AIRBIN_RLE_FILL - 1u;
+
+// Runs shorter than this are cheaper to store as literal words.
+static constexpr auto AIRBIN_RLE_MIN_FILL = 3u;
+
+/*
+        The transaction buffer generated by aie-generate-txn starts with a
+   header of four words: TXN_MAGIC, TXN_VERSION, the number of records and
+   the total number of words. Each record then starts with its opcode and
+   the low and high words of its address, followed by:
+        TXN_OP_WRITE:       the value
+        TXN_OP_MASK_WRITE:  the mask and the value of the bits to write
+        TXN_OP_BLOCK_WRITE: the number of words and the words
+   mlir_aie_replay_txn in the test library replays them.
+*/
+static constexpr uint32_t TXN_MAGIC = 0x4E585441u; // "ATXN"
+static constexpr uint32_t TXN_VERSION = 1u;
+static constexpr uint32_t TXN_OP_WRITE = 0u;
+static constexpr uint32_t TXN_OP_MASK_WRITE = 1u;
+static constexpr uint32_t TXN_OP_BLOCK_WRITE = 2u;
+
+/*
+        The control packet stream generated by aie-generate-ctrlpkt starts
+   with a header of four words: CTRLPKT_MAGIC, CTRLPKT_VERSION, the number of
+   packets and the total number of words. Each packet then starts with its
+   number of words, followed by the words a shim DMA sends with a single
+   buffer descriptor, so that the packet ends with the last word of the
+   transfer:
+        the packet header:         the packet ID of the tile in bits 0-4
+        the control packet header: the offset of the first word in the tile
+                                   in bits 0-19, the number of words minus 1
+                                   in bits 20-21 and the operation in bits
+                                   22-23
+        the 1 to CTRLPKT_MAX_BEATS words written at consecutive addresses
+   Bit 31 of both headers is their odd parity. mlir_aie_send_ctrlpkts in the
+   test library plays them from DDR.
+*/
+static constexpr uint32_t CTRLPKT_MAGIC = 0x4B504341u; // "ACPK"
+static constexpr uint32_t CTRLPKT_VERSION = 1u;
+static constexpr uint32_t CTRLPKT_MAX_BEATS = 4u;
+static constexpr uint32_t CTRLPKT_BEATS_SHIFT = 20u;
+static constexpr uint32_t CTRLPKT_OP_SHIFT = 22u;
+static constexpr uint32_t CTRLPKT_OP_WRITE = 0u;
+static constexpr uint32_t CTRLPKT_PARITY = 0x80000000u;
+
+/*
+        A write made to device memory: either the 32-bit 'value' written at
+   'addr', or, when 'clear_length' is not 0, the zeroing of the
+   'clear_length' bytes starting at 'addr'. Only the bits of 'mask' are
+   written. 'seq' orders the writes made to the same address.
+*/
+struct MemWrite {
+  uint64_t addr;
+  uint32_t value;
+  uint32_t mask;
+  uint32_t clear_length;
+  uint32_t seq;
+};
+
+/*
+        Holds all writes made to device memory, in the order they are made
+        Only the last write to an address matters, so they are sorted by
+   address once before being grouped into sections. Cleared ranges are kept
+   as a single write instead of one per word.
 */
-static std::map<uint64_t, uint32_t> mem_writes;
+static std::vector<MemWrite> mem_writes;
+
+/*
+        The columns of the tile addresses are relative to the first column of
+   the partition of the device op, so that the airbin and the transaction
+   buffers of a design are relocatable: loaders move them to the columns the
+   design is loaded at with mlir_aie_relocate_addr in the test library. The
+   number of columns of the design is stored in e_flags of the airbin.
+*/
+static int partition_start_col = 0;
+static int design_columns = 0;
 
 /*
  * Tile address format:
@@ -233,55 +328,74 @@ public:
   size_t get_length(void) const { return data.size() * sizeof(uint32_t); }
   void add_data(uint32_t value) { data.push_back(value); }
   const uint32_t *get_data(void) const { return data.data(); }
+  bool is_encoded(void) const { return encoded; }
+  void encode(void);
 
 private:
   uint64_t address;           // start address of this section
   std::vector<uint32_t> data; // data to be written starting at 'address'
+  bool encoded = false;       // 'data' is run-length encoded
 };
 
-// This template can be instantiated to represent a bitfield in a register.
-template <uint8_t high_bit, uint8_t low_bit = high_bit> class Field final {
-public:
-  static_assert(high_bit >= low_bit,
-                "The high bit should be higher than the low bit");
-  static_assert(high_bit < sizeof(uint32_t) * 8u,
-                "The field must live in a 32-bit register");
-
-  static constexpr auto num_bits_used = (high_bit - low_bit) + 1u;
-  static constexpr auto unshifted_mask = (1u << num_bits_used) - 1u;
-  static_assert((low_bit != high_bit) xor (unshifted_mask == 1),
-                "1 is a valid mask iff the field is 1 bit wide");
-
-  static constexpr auto shifted_mask = unshifted_mask << low_bit;
+/*
+        Run-length encode the data of the section, if it makes it smaller
+*/
+void Section::encode(void) {
+  std::vector<uint32_t> records;
+  size_t literal_header = 0;
+  bool in_literal = false;
+
+  for (size_t i = 0; i < data.size();) {
+    size_t run = 1;
+    while (i + run < data.size() && data[i + run] == data[i] &&
+           run < AIRBIN_RLE_MAX_COUNT)
+      run++;
+
+    if (run >= AIRBIN_RLE_MIN_FILL) {
+      records.push_back(AIRBIN_RLE_FILL | static_cast<uint32_t>(run));
+      records.push_back(data[i]);
+      in_literal = false;
+    } else {
+      for (size_t j = 0; j < run; j++) {
+        if (!in_literal || records[literal_header] == AIRBIN_RLE_MAX_COUNT) {
+          literal_header = records.size();
+          records.push_back(0);
+          in_literal = true;
+        }
+        records[literal_header]++;
+        records.push_back(data[i + j]);
+      }
+    }
+    i += run;
+  }
 
-  [[nodiscard]] constexpr uint32_t operator()(uint32_t value) const {
-    return (value << low_bit) & shifted_mask;
+  if (records.size() < data.size()) {
+    data = std::move(records);
+    encoded = true;
   }
-};
+}
 
 /*
-        Add or replace a register value in 'mem_writes'
+        Add a register value to 'mem_writes', replacing the previous writes
+   to the same address
 */
 static void write32(Address addr, uint32_t value) {
   // printf("%s: 0x%lx < 0x%x\n", __func__, static_cast<uint64_t>(addr), value);
-  assert(addr.destTile().col() > 0);
+  assert(partition_start_col + addr.destTile().col() > 0);
 
-  auto ret = mem_writes.emplace(addr, value);
-  if (!ret.second)
-    (ret.first)->second = value;
+  mem_writes.push_back(
+      {addr, value, ~0u, 0, static_cast<uint32_t>(mem_writes.size())});
 }
 
 /*
-        Look up a value for a given address
-
-        If the address is found return the value, otherwise 0
+        Add the bits of 'mask' of a register value to 'mem_writes', keeping
+   the other bits of the register
 */
-static uint32_t read32(Address addr) {
-  auto ret = mem_writes.find(addr);
-  if (ret != mem_writes.end())
-    return ret->second;
+static void maskWrite32(Address addr, uint32_t mask, uint32_t value) {
+  assert(partition_start_col + addr.destTile().col() > 0);
 
-  return 0;
+  mem_writes.push_back({addr, value & mask, mask, 0,
+                        static_cast<uint32_t>(mem_writes.size())});
 }
 
 /*
@@ -294,8 +408,11 @@ void TileAddress::clearRange(uint32_t start, uint32_t length) {
   DBG_PRINTF("%s <%u,%u> 0x%x - 0x%x\n", __func__, column, row, start,
              start + length);
 
-  for (auto off = start; off < start + length; off += 4u)
-    write32(Address{*this, off}, 0);
+  if (length == 0)
+    return;
+  assert(partition_start_col + col() > 0);
+  mem_writes.push_back({fullAddress(start), 0, ~0u, length,
+                        static_cast<uint32_t>(mem_writes.size())});
 }
 
 // The SHIM row is always 0.
@@ -460,6 +577,35 @@ static void configure_cores(DeviceOp &targetOp) {
   }
 }
 
+/*
+        Clock the tiles of each column up to the highest one the design uses,
+   and gate the clocks of the tiles above it and of the columns of the design
+   without used tiles.
+*/
+static void configure_clocks(DeviceOp &targetOp) {
+  printf("%s\n", __func__);
+
+  std::map<int, int> highest_row;
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (tileOp.isUsed())
+      highest_row[tileOp.colIndex()] =
+          std::max(highest_row[tileOp.colIndex()], tileOp.rowIndex());
+
+  // Like the other writes, none goes to the first column of the device.
+  for (int col = partition_start_col > 0 ? 0 : 1; col < design_columns;
+       col++) {
+    auto it = highest_row.find(col);
+    if (it == highest_row.end()) {
+      write32({TileAddress(col, 0), REG_TILE_CLOCK_CTRL}, disable);
+      continue;
+    }
+    for (int row = 0; row <= it->second; row++)
+      write32({TileAddress(col, row), REG_TILE_CLOCK_CTRL},
+              TILE_CLOCK_BUFFER_ENABLE |
+                  (row < it->second ? TILE_CLOCK_NEXT_ENABLE : 0));
+  }
+}
+
 struct BDInfo {
   bool foundBdPacket = false;
   int packetType = 0;
@@ -952,10 +1098,8 @@ static void configure_switchboxes(DeviceOp &targetOp) {
 
         // We need to add to the possibly preexisting mask.
         Address addr{currentTile.value(), 0x1F004u};
-        auto currentMask = read32(addr);
-
-        write32(addr, currentMask |
-                          inputMaskFor(connectOp.getDestBundle(), shiftAmt));
+        maskWrite32(addr, 3u << shiftAmt,
+                    inputMaskFor(connectOp.getDestBundle(), shiftAmt));
 
       } else if (connectOp.getDestBundle() == WireBundle::North) {
         // mux
@@ -980,10 +1124,8 @@ static void configure_switchboxes(DeviceOp &targetOp) {
         }();
 
         Address addr{currentTile.value(), 0x1F000u};
-        auto currentMask = read32(addr);
-
-        write32(addr, currentMask |
-                          inputMaskFor(connectOp.getSourceBundle(), shiftAmt));
+        maskWrite32(addr, 3u << shiftAmt,
+                    inputMaskFor(connectOp.getSourceBundle(), shiftAmt));
       }
     }
   }
@@ -1038,25 +1180,70 @@ static uint8_t sec_addr2index(uint64_t in) {
   return 0;
 }
 
+/*
+        Resolve the value of every address written by 'mem_writes', in
+   increasing address order
+
+        The writes are sorted by address, and by order for each address. They
+   are then swept in address order: the value of each word is the one its
+   writes build up after the last range cleared around it. 'active_clears'
+   holds the order and the end of the ranges cleared around the current
+   address, the latest one first. It may hold ranges which already ended
+   behind the latest one, which are dropped once they get to the top.
+*/
+static void
+resolve_writes(llvm::function_ref<void(uint64_t, uint32_t)> add_word) {
+  std::sort(mem_writes.begin(), mem_writes.end(),
+            [](const MemWrite &a, const MemWrite &b) {
+              return std::tie(a.addr, a.seq) < std::tie(b.addr, b.seq);
+            });
+
+  std::priority_queue<std::pair<uint32_t, uint64_t>> active_clears;
+  auto write = mem_writes.begin();
+  uint64_t addr = 0;
+  while (write != mem_writes.end() || !active_clears.empty()) {
+    while (!active_clears.empty() && active_clears.top().second <= addr)
+      active_clears.pop();
+    // Skip to the next write when no cleared range covers the address.
+    if (active_clears.empty()) {
+      if (write == mem_writes.end())
+        break;
+      addr = write->addr;
+    }
+
+    auto first_write = write;
+    for (; write != mem_writes.end() && write->addr == addr; ++write)
+      if (write->clear_length)
+        active_clears.emplace(write->seq, addr + write->clear_length);
+
+    // Apply the writes made since the address was last cleared, on top of
+    // the cleared or reset value.
+    uint32_t value = 0;
+    bool cleared = !active_clears.empty();
+    uint32_t cleared_seq = cleared ? active_clears.top().first : 0;
+    for (auto it = first_write; it != write; ++it)
+      if (!it->clear_length && (!cleared || it->seq > cleared_seq))
+        value = (value & ~it->mask) | it->value;
+
+    add_word(addr, value);
+    addr += 4;
+  }
+}
+
 /*
         Group the writes into contiguous sections
 */
-static void group_sections(std::vector<Section *> &sections) {
+static void group_sections(std::vector<Section> &sections) {
   uint64_t last_addr = 0;
-  Section *section = NULL;
-
-  for (auto write : mem_writes) {
-    if (write.first != last_addr + 4) {
-      if (section)
-        sections.push_back(section);
-      section = new Section(write.first);
-      printf("Starting new section @ 0x%lx (last=0x%lx)\n", write.first,
-             last_addr);
+  resolve_writes([&](uint64_t addr, uint32_t value) {
+    if (sections.empty() || addr != last_addr + 4) {
+      DBG_PRINTF("Starting new section @ 0x%lx (last=0x%lx)\n", addr,
+                 last_addr);
+      sections.emplace_back(addr);
     }
-    section->add_data(write.second);
-    last_addr = write.first;
-  }
-  sections.push_back(section);
+    sections.back().add_data(value);
+    last_addr = addr;
+  });
 }
 
 /*
@@ -1083,35 +1270,66 @@ static size_t add_string(Elf_Scn *scn, const char *str) {
   return lastidx;
 }
 
-Elf_Data *section_add_data(Elf_Scn *scn, const Section *section) {
-  size_t size = section->get_length();
-  uint32_t *buf = (uint32_t *)malloc(size);
-  if (!buf)
-    return NULL;
-
+/*
+   Add the data of a section to its ELF section. The ELF data points to the
+   data of the section, which must outlive the ELF update.
+*/
+Elf_Data *section_add_data(Elf_Scn *scn, const Section &section) {
   // create a data object for the section
   Elf_Data *data = elf_newdata(scn);
   if (!data) {
     printf("cannot add data to section: %s\n", elf_errmsg(-1));
-    free(data);
     return NULL;
   }
 
-  data->d_buf = buf;
+  data->d_buf = const_cast<uint32_t *>(section.get_data());
   data->d_type = ELF_T_BYTE;
-  data->d_size = size;
+  data->d_size = section.get_length();
   data->d_off = 0;
   data->d_align = 1;
   data->d_version = EV_CURRENT;
 
-  // fill the data
-  memcpy(buf, section->get_data(), size);
-
   return data;
 }
 
+/*
+        Record the writes configuring the device of the module in
+   'mem_writes'
+*/
+static mlir::LogicalResult configure_device(mlir::ModuleOp module) {
+  if (module.getOps<DeviceOp>().empty())
+    return module.emitOpError("no operations found");
+
+  DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
+  const auto &target_model = targetOp.getTargetModel();
+  partition_start_col = target_model.getPartitionStartCol();
+  design_columns = target_model.columns();
+
+  // The BDs are written with the register layout of the AIE1 tile DMAs,
+  // which can neither pad nor compress.
+  auto unsupported = targetOp.walk([](DMABDOp bd) {
+    if (!bd.getPadding() && !bd.getCompression())
+      return WalkResult::advance();
+    bd.emitOpError("padding and compression are not supported by the airbin "
+                   "target");
+    return WalkResult::interrupt();
+  });
+  if (unsupported.wasInterrupted())
+    return failure();
+
+  NetlistAnalysis NL(targetOp);
+
+  mem_writes.clear();
+  configure_clocks(targetOp);
+  configure_cores(targetOp);
+  configure_switchboxes(targetOp);
+  configure_dmas(targetOp, NL);
+  return success();
+}
+
 mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
-                                         llvm::raw_ostream &output) {
+                                         llvm::raw_ostream &output,
+                                         bool compress) {
   int tmp_elf_fd;
   Elf *outelf;
   GElf_Ehdr ehdr_mem;
@@ -1120,35 +1338,23 @@ mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
   GElf_Shdr shdr_mem;
   char empty_str[] = "";
   char strtab_name[] = ".shstrtab";
-  std::vector<Section *> sections;
+  std::vector<Section> sections;
 
   assert(not output.is_displayed());
 
-  DenseMap<std::pair<int, int>, Operation *> tiles;
-  DenseMap<Operation *, CoreOp> cores;
-  DenseMap<Operation *, MemOp> mems;
-  DenseMap<std::pair<Operation *, int>, LockOp> locks;
-  DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
-  DenseMap<Operation *, SwitchboxOp> switchboxes;
-
-  if (module.getOps<DeviceOp>().empty()) {
-    module.emitOpError("no operations found");
-  }
-
-  DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
-
-  NetlistAnalysis NL(targetOp, tiles, cores, mems, locks, buffers, switchboxes);
-  NL.collectTiles(tiles);
-  NL.collectBuffers(buffers);
-
-  configure_cores(targetOp);
-  configure_switchboxes(targetOp);
-  configure_dmas(targetOp, NL);
+  if (failed(configure_device(module)))
+    return failure();
 
   group_sections(sections);
 
   printf("mem_writes: %lu in %lu sections\n", mem_writes.size(),
          sections.size());
+  mem_writes.clear();
+  mem_writes.shrink_to_fit();
+
+  if (compress)
+    for (Section &section : sections)
+      section.encode();
 
   elf_version(EV_CURRENT);
   tmp_elf_fd = open("airbin.elf", O_RDWR | O_CREAT | O_TRUNC, DEFFILEMODE);
@@ -1171,6 +1377,7 @@ mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
   ehdr->e_type = ET_NONE;
   ehdr->e_machine = EM_AMDAIR;
   ehdr->e_version = EV_CURRENT;
+  ehdr->e_flags = design_columns;
   if (gelf_update_ehdr(outelf, ehdr) == 0) {
     printf("cannot update ELF header: %s\n", elf_errmsg(-1));
     exit(1);
@@ -1223,8 +1430,8 @@ mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
   }
 
   // output the rest of the sections
-  for (const Section *section : sections) {
-    uint64_t addr = section->get_addr();
+  for (const Section &section : sections) {
+    uint64_t addr = section.get_addr();
     Elf_Scn *scn = elf_newscn(outelf);
     if (!scn) {
       printf("cannot create new %s section: %s\n",
@@ -1240,10 +1447,12 @@ mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
     }
 
     Elf_Data *data = section_add_data(scn, section);
+    if (!data)
+      break;
 
-    shdr->sh_type = SHT_PROGBITS;
+    shdr->sh_type = section.is_encoded() ? SHT_AIRBIN_RLE : SHT_PROGBITS;
     shdr->sh_flags = SHF_ALLOC;
-    shdr->sh_addr = section->get_addr();
+    shdr->sh_addr = addr;
     shdr->sh_link = SHN_UNDEF;
     shdr->sh_info = SHN_UNDEF;
     shdr->sh_addralign = 1;
@@ -1283,5 +1492,301 @@ mlir::LogicalResult AIETranslateToAirbin(mlir::ModuleOp module,
 
   return success();
 }
+/*
+        Serialize the writes of 'mem_writes' into a transaction buffer, in the
+   order they were made. The consecutive writes to consecutive addresses, and
+   the cleared ranges, are merged into block writes.
+*/
+static void emit_transactions(std::vector<uint32_t> &txn) {
+  txn = {TXN_MAGIC, TXN_VERSION, 0, 0};
+
+  const auto add_header = [&](uint32_t op, uint64_t addr) {
+    txn.push_back(op);
+    txn.push_back(static_cast<uint32_t>(addr));
+    txn.push_back(static_cast<uint32_t>(addr >> 32));
+    txn[2]++;
+  };
+
+  // The consecutive writes waiting to be merged, starting at 'block_addr'.
+  uint64_t block_addr = 0;
+  std::vector<uint32_t> block;
+  const auto flush_block = [&] {
+    if (block.size() == 1) {
+      add_header(TXN_OP_WRITE, block_addr);
+    } else if (block.size() > 1) {
+      add_header(TXN_OP_BLOCK_WRITE, block_addr);
+      txn.push_back(block.size());
+    }
+    txn.insert(txn.end(), block.begin(), block.end());
+    block.clear();
+  };
+
+  for (const MemWrite &write : mem_writes) {
+    if (write.mask == ~0u && !write.clear_length && !block.empty() &&
+        write.addr == block_addr + 4 * block.size()) {
+      block.push_back(write.value);
+      continue;
+    }
+    flush_block();
+    if (write.clear_length) {
+      add_header(TXN_OP_BLOCK_WRITE, write.addr);
+      txn.push_back(write.clear_length / 4);
+      txn.insert(txn.end(), write.clear_length / 4, 0);
+    } else if (write.mask != ~0u) {
+      add_header(TXN_OP_MASK_WRITE, write.addr);
+      txn.push_back(write.mask);
+      txn.push_back(write.value);
+    } else {
+      block_addr = write.addr;
+      block.push_back(write.value);
+    }
+  }
+  flush_block();
+  txn[3] = txn.size();
+}
+
+/*
+        Replace the writes of 'mem_writes' by the ones of the words whose
+   configured value differs from their reset value, 0, in increasing address
+   order, for a device configured right after its reset. The cleared ranges
+   and the words written back to 0 are dropped, and emit_transactions merges
+   the words at consecutive addresses into block writes.
+*/
+static void minimize_writes() {
+  std::vector<MemWrite> words;
+  resolve_writes([&](uint64_t addr, uint32_t value) {
+    if (value != 0)
+      words.push_back(
+          {addr, value, ~0u, 0, static_cast<uint32_t>(words.size())});
+  });
+  printf("minimal: %lu words for %lu writes\n", words.size(),
+         mem_writes.size());
+  mem_writes = std::move(words);
+}
+
+mlir::LogicalResult AIETranslateToTxn(mlir::ModuleOp module,
+                                      llvm::raw_ostream &output,
+                                      bool minimal) {
+  assert(not output.is_displayed());
+
+  if (failed(configure_device(module)))
+    return failure();
+  if (minimal)
+    minimize_writes();
+
+  std::vector<uint32_t> txn;
+  emit_transactions(txn);
+  printf("mem_writes: %lu in %u transactions\n", mem_writes.size(), txn[2]);
+  mem_writes.clear();
+  mem_writes.shrink_to_fit();
+
+  output.write(reinterpret_cast<const char *>(txn.data()),
+               txn.size() * sizeof(uint32_t));
+  return success();
+}
+/*
+        Record the writes turning the configuration of 'base' into the one of
+   'module' in 'mem_writes'. Only the words whose configured value differs
+   are written, in increasing address order. The words configured by one of
+   the designs only are assumed to be 0 in the other.
+*/
+static mlir::LogicalResult configure_delta(mlir::ModuleOp base,
+                                           mlir::ModuleOp module) {
+  std::vector<std::pair<uint64_t, uint32_t>> base_words;
+  if (failed(configure_device(base)))
+    return failure();
+  resolve_writes([&](uint64_t addr, uint32_t value) {
+    base_words.emplace_back(addr, value);
+  });
+
+  if (failed(configure_device(module)))
+    return failure();
+  std::vector<MemWrite> delta;
+  auto base_word = base_words.begin();
+  const auto add_delta = [&](uint64_t addr, uint32_t value) {
+    delta.push_back({addr, value, ~0u, 0, static_cast<uint32_t>(delta.size())});
+  };
+  resolve_writes([&](uint64_t addr, uint32_t value) {
+    for (; base_word != base_words.end() && base_word->first < addr;
+         ++base_word)
+      if (base_word->second != 0)
+        add_delta(base_word->first, 0);
+    if (base_word != base_words.end() && base_word->first == addr) {
+      if (base_word->second != value)
+        add_delta(addr, value);
+      ++base_word;
+    } else if (value != 0) {
+      add_delta(addr, value);
+    }
+  });
+  for (; base_word != base_words.end(); ++base_word)
+    if (base_word->second != 0)
+      add_delta(base_word->first, 0);
+
+  printf("delta: %lu of %lu words\n", delta.size(), base_words.size());
+  mem_writes = std::move(delta);
+  return success();
+}
+
+/*
+        Serialize the writes turning the configuration of 'base' into the one
+   of 'module' into a transaction buffer.
+*/
+mlir::LogicalResult AIETranslateToTxnDelta(mlir::ModuleOp base,
+                                           mlir::ModuleOp module,
+                                           llvm::raw_ostream &output) {
+  assert(not output.is_displayed());
+
+  if (failed(configure_delta(base, module)))
+    return failure();
+
+  std::vector<uint32_t> txn;
+  emit_transactions(txn);
+  mem_writes.clear();
+  mem_writes.shrink_to_fit();
+
+  output.write(reinterpret_cast<const char *>(txn.data()),
+               txn.size() * sizeof(uint32_t));
+  return success();
+}
+
+// Set bit 31 of 'word' so that it has an odd number of bits set, as the
+// packet headers and the control packet headers must.
+static uint32_t odd_parity(uint32_t word) {
+  word &= ~CTRLPKT_PARITY;
+  return __builtin_parity(word) ? word : word | CTRLPKT_PARITY;
+}
+
+/*
+        Serialize the writes of 'mem_writes' into control packets, in the
+   order they were made. The writes to consecutive addresses of a tile are
+   merged into packets of up to CTRLPKT_MAX_BEATS words. The control packets
+   have no masked write: the registers are assumed to hold their reset
+   value of 0 before their first write, as in resolve_writes, and the
+   masked writes write the whole word. The program memory of the tiles
+   loading the same ELF file is only written for the first of them, with
+   the ID of the packet flow aie-route-control-packets broadcasts to all of
+   them.
+*/
+static mlir::LogicalResult
+emit_control_packets(DeviceOp device, std::vector<uint32_t> &stream) {
+  stream = {CTRLPKT_MAGIC, CTRLPKT_VERSION, 0, 0};
+
+  // The packet ID of each tile routed by aie-route-control-packets, and the
+  // broadcast ID of the tiles sharing their ELF file, with the first tile of
+  // each broadcast.
+  std::map<uint16_t, uint32_t> packet_ids;
+  std::map<uint16_t, uint32_t> broadcast_ids;
+  std::map<uint32_t, uint16_t> broadcast_tiles;
+  for (auto tile : device.getOps<TileOp>()) {
+    if (auto id = tile->getAttrOfType<IntegerAttr>("ctrl_packet_id"))
+      packet_ids[TileAddress(tile)] = id.getInt();
+    if (auto id = tile->getAttrOfType<IntegerAttr>("ctrl_broadcast_id")) {
+      broadcast_ids[TileAddress(tile)] = id.getInt();
+      broadcast_tiles.try_emplace(id.getInt(), TileAddress(tile));
+    }
+  }
+  const auto is_program = [](uint64_t addr) {
+    uint32_t offset = addr & ((1 << TILE_ADDR_OFF_WIDTH) - 1);
+    return offset >= PROG_MEM_OFFSET &&
+           offset < PROG_MEM_OFFSET + PROG_MEM_SIZE;
+  };
+
+  // The consecutive writes waiting to be merged, starting at 'block_addr'.
+  uint64_t block_addr = 0;
+  std::vector<uint32_t> block;
+  const auto flush_block = [&]() -> mlir::LogicalResult {
+    if (block.empty())
+      return success();
+    auto tile = static_cast<uint16_t>(block_addr >> TILE_ADDR_ROW_SHIFT);
+    auto id = packet_ids.find(tile);
+    if (id == packet_ids.end())
+      return device.emitOpError("configures tile (")
+             << (tile >> TILE_ADDR_ROW_WIDTH) << ", "
+             << (tile & ((1 << TILE_ADDR_ROW_WIDTH) - 1))
+             << ") which has no control packet route, mark it with `ctrl` "
+                "and run aie-route-control-packets";
+    uint32_t packet_id = id->second;
+    auto broadcast = broadcast_ids.find(tile);
+    if (broadcast != broadcast_ids.end() && is_program(block_addr))
+      packet_id = broadcast->second;
+    uint32_t offset = block_addr & ((1 << TILE_ADDR_OFF_WIDTH) - 1);
+    stream.push_back(block.size() + 2);
+    stream.push_back(odd_parity(packet_id));
+    auto beats = static_cast<uint32_t>(block.size() - 1);
+    stream.push_back(odd_parity(offset | beats << CTRLPKT_BEATS_SHIFT |
+                                CTRLPKT_OP_WRITE << CTRLPKT_OP_SHIFT));
+    stream.insert(stream.end(), block.begin(), block.end());
+    stream[2]++;
+    block.clear();
+    return success();
+  };
+
+  std::map<uint64_t, uint32_t> values;
+  const auto add_word = [&](uint64_t addr,
+                            uint32_t value) -> mlir::LogicalResult {
+    values[addr] = value;
+    // The first tile of a broadcast writes the program memory of all.
+    auto tile = static_cast<uint16_t>(addr >> TILE_ADDR_ROW_SHIFT);
+    auto broadcast = broadcast_ids.find(tile);
+    if (broadcast != broadcast_ids.end() && is_program(addr) &&
+        broadcast_tiles[broadcast->second] != tile)
+      return success();
+    if (!block.empty() && block.size() < CTRLPKT_MAX_BEATS &&
+        addr == block_addr + 4 * block.size() &&
+        addr >> TILE_ADDR_ROW_SHIFT == block_addr >> TILE_ADDR_ROW_SHIFT &&
+        is_program(addr) == is_program(block_addr)) {
+      block.push_back(value);
+      return success();
+    }
+    if (failed(flush_block()))
+      return failure();
+    block_addr = addr;
+    block.push_back(value);
+    return success();
+  };
+
+  for (const MemWrite &write : mem_writes) {
+    if (write.clear_length) {
+      for (uint32_t i = 0; i < write.clear_length; i += 4)
+        if (failed(add_word(write.addr + i, 0)))
+          return failure();
+    } else if (failed(add_word(write.addr, (values[write.addr] & ~write.mask) |
+                                               write.value))) {
+      return failure();
+    }
+  }
+  if (failed(flush_block()))
+    return failure();
+  stream[3] = stream.size();
+  return success();
+}
+
+/*
+        Serialize the configuration of 'module', or the writes turning the
+   configuration of 'base' into it when 'base' is set, into control packets
+*/
+mlir::LogicalResult AIETranslateToCtrlPkt(mlir::ModuleOp module,
+                                          mlir::ModuleOp base,
+                                          llvm::raw_ostream &output) {
+  assert(not output.is_displayed());
+
+  if (failed(base ? configure_delta(base, module) : configure_device(module)))
+    return failure();
+
+  std::vector<uint32_t> stream;
+  DeviceOp device = *module.getOps<DeviceOp>().begin();
+  auto result = emit_control_packets(device, stream);
+  printf("mem_writes: %lu in %u control packets\n", mem_writes.size(),
+         stream[2]);
+  mem_writes.clear();
+  mem_writes.shrink_to_fit();
+  if (failed(result))
+    return failure();
+
+  output.write(reinterpret_cast<const char *>(stream.data()),
+               stream.size() * sizeof(uint32_t));
+  return success();
+}
 } // namespace AIE
 } // namespace xilinx
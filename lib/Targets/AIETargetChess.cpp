@@ -0,0 +1,203 @@
+//===- AIETargetChess.cpp ---------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * Takes as input the cores lowered to the LLVM dialect.
+ * Emits their LLVM IR, linked with the chess intrinsic wrapper, in the
+ * older dialect of LLVM IR the clang of xchesscc parses: the attributes it
+ * does not know are dropped, the arguments of the functions are named and
+ * the memory effects and poison values are printed the way it expects.
+ * The functions of the wrapper, each a chess intrinsic, are inlined into
+ * the cores, so that the locks and the streams of their loops cost one
+ * instruction rather than a call.
+ */
+
+#include "mlir/Target/LLVMIR/Export.h"
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Linker/Linker.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+
+#include "aie/Targets/AIETargets.h"
+
+using namespace mlir;
+
+namespace {
+
+// The attributes of function, return values and parameters that the clang of
+// xchesscc does not know.
+const llvm::Attribute::AttrKind unknownAttributes[] = {
+    llvm::Attribute::NoUndef,
+    llvm::Attribute::MustProgress,
+    llvm::Attribute::NoCallback,
+};
+
+// The memory effects the clang of xchesscc spells with the attributes they
+// replaced.
+const std::pair<const char *, const char *> memoryAttributes[] = {
+    {"memory(none)", "readnone"},
+    {"memory(read)", "readonly"},
+    {"memory(write)", "writeonly"},
+    {"memory(argmem: readwrite)", "argmemonly"},
+    {"memory(argmem: read)", "argmemonly readonly"},
+    {"memory(argmem: write)", "argmemonly writeonly"},
+    {"memory(inaccessiblemem: readwrite)", "inaccessiblememonly"},
+    {"memory(inaccessiblemem: read)", "inaccessiblememonly readonly"},
+    {"memory(inaccessiblemem: write)", "inaccessiblememonly writeonly"},
+    {"memory(argmem: readwrite, inaccessiblemem: readwrite)",
+     "inaccessiblemem_or_argmemonly"},
+    {"memory(argmem: read, inaccessiblemem: read)",
+     "inaccessiblemem_or_argmemonly readonly"},
+    {"memory(argmem: write, inaccessiblemem: write)",
+     "inaccessiblemem_or_argmemonly writeonly"},
+};
+
+} // namespace
+
+/// Function that removes the unknown attributes from attrs.
+static llvm::AttributeList removeUnknownAttributes(llvm::LLVMContext &context,
+                                                   llvm::AttributeList attrs) {
+  for (unsigned index = attrs.index_begin(); index != attrs.index_end();
+       index++)
+    for (auto kind : unknownAttributes)
+      attrs = attrs.removeAttributeAtIndex(context, index, kind);
+  return attrs;
+}
+
+/// Function that rewrites llvmModule in what the LLVM IR of the clang of
+/// xchesscc can represent.
+static void downgradeModule(llvm::Module &llvmModule) {
+  llvm::LLVMContext &context = llvmModule.getContext();
+  for (llvm::Function &function : llvmModule) {
+    function.setAttributes(
+        removeUnknownAttributes(context, function.getAttributes()));
+    // Numbered arguments are not printed the same way by older LLVM.
+    for (llvm::Argument &arg : function.args())
+      if (!arg.hasName())
+        arg.setName("arg" + llvm::Twine(arg.getArgNo()));
+    for (llvm::BasicBlock &block : function)
+      for (llvm::Instruction &inst : block)
+        if (auto *call = llvm::dyn_cast<llvm::CallBase>(&inst))
+          call->setAttributes(
+              removeUnknownAttributes(context, call->getAttributes()));
+  }
+}
+
+/// Function that inlines the functions of the chess intrinsic wrapper names
+/// into the calls of the cores to the intrinsics they implement, which the
+/// frontend of xchesscc would otherwise resolve to calls to the functions:
+/// it spells the '.' of the names of the intrinsics '___'.
+static void inlineIntrinsicWrapper(llvm::Module &llvmModule,
+                                   llvm::ArrayRef<std::string> names) {
+  for (const std::string &name : names) {
+    llvm::Function *wrapper = llvmModule.getFunction(name);
+    llvm::Function *intrinsic =
+        llvmModule.getFunction(llvm::join(llvm::split(name, "___"), "."));
+    if (!wrapper || !intrinsic ||
+        wrapper->getFunctionType() != intrinsic->getFunctionType())
+      continue;
+    llvm::SmallVector<llvm::CallBase *, 16> calls;
+    for (llvm::User *user : intrinsic->users())
+      if (auto *call = llvm::dyn_cast<llvm::CallBase>(user))
+        if (call->getCalledFunction() == intrinsic)
+          calls.push_back(call);
+    for (llvm::CallBase *call : calls) {
+      call->setCalledFunction(wrapper);
+      llvm::InlineFunctionInfo info;
+      if (!llvm::InlineFunction(*call, info).isSuccess())
+        call->setCalledFunction(intrinsic);
+    }
+    if (intrinsic->use_empty())
+      intrinsic->eraseFromParent();
+  }
+}
+
+/// Function that prints text, the LLVM IR of a module, with the spellings of
+/// the clang of xchesscc for memory effects and poison values.
+static void printDowngraded(llvm::StringRef text, llvm::raw_ostream &output) {
+  llvm::StringMap<const char *> memory;
+  for (auto &[effects, attributes] : memoryAttributes)
+    memory[effects] = attributes;
+  auto isIdentifier = [](char c) {
+    return llvm::isAlnum(c) || c == '_' || c == '.' || c == '$';
+  };
+
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t next = text.find_first_of("mp", pos);
+    if (next == llvm::StringRef::npos) {
+      output << text.drop_front(pos);
+      return;
+    }
+    output << text.slice(pos, next);
+    llvm::StringRef rest = text.drop_front(next);
+    bool word = next == 0 || !isIdentifier(text[next - 1]);
+    if (word && rest.startswith("memory(")) {
+      auto it = memory.find(rest.take_front(rest.find(')') + 1));
+      if (it != memory.end()) {
+        output << it->second;
+        pos = next + it->first().size();
+        continue;
+      }
+    } else if (word && rest.startswith("poison") &&
+               (rest.size() == 6 || !isIdentifier(rest[6]))) {
+      output << "undef";
+      pos = next + 6;
+      continue;
+    }
+    output << text[next];
+    pos = next + 1;
+  }
+}
+
+namespace xilinx {
+namespace AIE {
+
+mlir::LogicalResult AIETranslateToChessLLVMIR(ModuleOp module,
+                                              llvm::StringRef intrinsicWrapper,
+                                              llvm::raw_ostream &output) {
+  llvm::LLVMContext llvmContext;
+  auto llvmModule = translateModuleToLLVMIR(module, llvmContext);
+  if (!llvmModule)
+    return module.emitOpError("failed to translate to LLVM IR");
+
+  if (!intrinsicWrapper.empty()) {
+    llvm::SMDiagnostic error;
+    auto wrapper = llvm::parseIRFile(intrinsicWrapper, error, llvmContext);
+    if (!wrapper)
+      return module.emitOpError("failed to parse ")
+             << intrinsicWrapper << ": " << error.getMessage();
+    // The wrapper is compiled by xchesscc for its own target.
+    wrapper->setTargetTriple(llvmModule->getTargetTriple());
+    wrapper->setDataLayout(llvmModule->getDataLayout());
+    std::vector<std::string> names;
+    for (llvm::Function &function : *wrapper)
+      if (!function.isDeclaration())
+        names.push_back(function.getName().str());
+    if (llvm::Linker::linkModules(*llvmModule, std::move(wrapper)))
+      return module.emitOpError("failed to link with ") << intrinsicWrapper;
+    inlineIntrinsicWrapper(*llvmModule, names);
+  }
+
+  downgradeModule(*llvmModule);
+  std::string text;
+  llvm::raw_string_ostream textStream(text);
+  llvmModule->print(textStream, nullptr);
+  printDowngraded(textStream.str(), output);
+  return success();
+}
+
+} // namespace AIE
+} // namespace xilinx
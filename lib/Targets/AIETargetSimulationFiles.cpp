@@ -25,7 +25,7 @@
 #include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 
-#include "AIETargets.h"
+#include "aie/Targets/AIETargets.h"
 namespace xilinx {
 namespace AIE {
 
@@ -270,9 +270,13 @@ mlir::LogicalResult AIETranslateGraphXPE(mlir::ModuleOp module,
   }
   output << "  <AIE status=\"COMPILER_OUTPUT\">\n";
 
-  // Generate design specific info on tiles within the mlir module
-  auto module_tile_ops = targetOp.getOps<TileOp>();
-  int num_tiles = std::distance(module_tile_ops.begin(), module_tile_ops.end());
+  // Generate design specific info on tiles within the mlir module. The tiles
+  // the design does not use are clock gated, and draw no power.
+  SmallVector<TileOp> module_tile_ops;
+  for (TileOp tileOp : targetOp.getOps<TileOp>())
+    if (tileOp.isUsed())
+      module_tile_ops.push_back(tileOp);
+  int num_tiles = module_tile_ops.size();
   // TODO: clk_freq only 1150 for AIE2
   if (arch == AIEArch::AIE2) {
     output << "    <AIE_MODULE name=\"graph\" num_tiles=\""
@@ -299,6 +303,8 @@ mlir::LogicalResult AIETranslateGraphXPE(mlir::ModuleOp module,
     if (tileOp.isShimNOCorPLTile() || tileOp.isMemTile())
       continue; // Skip shim and mem tiles (handled below)
 
+    // The tiles without a core only route streams or hold memory.
+    const char *core_load = tileOp.getCoreOp() ? "1.0" : "0.0";
     if (arch == AIEArch::AIE2) {
 
       output << "      <TILE name=\"CR(" <<
@@ -311,7 +317,8 @@ mlir::LogicalResult AIETranslateGraphXPE(mlir::ModuleOp module,
              // CR coordinates ignores shim and 1 mem row, hence row-2
              // AIE2 - xcve2302
              // std::to_string(col) << "," << std::to_string(row - 2) << ")\" "
-             << "type=\"int16\" int_core_load=\"1.0\" fp_core_load=\"0\" "
+             << "type=\"int16\" int_core_load=\"" << core_load
+             << "\" fp_core_load=\"0\" "
              << "mem_banks=\"0\" mem_rw_rate=\"0.2\" stream_util=\"0.0\" "
                 "coordinates=\""
              <<
@@ -327,7 +334,8 @@ mlir::LogicalResult AIETranslateGraphXPE(mlir::ModuleOp module,
       output << "      <TILE name=\"CR(" <<
           // CR coordinates ignores shim, hence row-1
           std::to_string(col) << "," << std::to_string(row - 1) << ")\" "
-             << "type=\"int16\" int_core_load=\"1.0\" fp_core_load=\"0\" "
+             << "type=\"int16\" int_core_load=\"" << core_load
+             << "\" fp_core_load=\"0\" "
              << "mem_banks=\"0\" mem_rw_rate=\"0.2\" stream_util=\"0.0\" "
                 "coordinates=\""
              <<
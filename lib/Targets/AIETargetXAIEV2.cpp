@@ -19,15 +19,23 @@
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/Passes.h"
 
+#include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/IR/Module.h"
+#include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/TargetSelect.h"
 
 #include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "aie/Dialect/AIEX/IR/AIEXDialect.h"
 
-#include "AIETargets.h"
+#include "aie/Targets/AIETargets.h"
+
+#include "AIERegisterField.h"
+
+#include <set>
 
 using namespace mlir;
 using namespace xilinx;
@@ -58,17 +66,117 @@ const char xaie_c_file_header[] = R"code(
   } \
 } while(0)
 
-static XAie_DmaDimDesc *__mlir_aie_alloc_dim_desc(size_t ndims) {
-  XAie_DmaDimDesc *ret = NULL;
-  ret = (XAie_DmaDimDesc *)calloc(sizeof(XAie_DmaDimDesc), ndims);
-  if(NULL == ret) {
-    __mlir_aie_verbose(fprintf(stderr, "Allocating DmaDimDesc failed.\n"));
+// Write the registers of a BD of an AIE1 tile DMA from the image computed by
+// the compiler.
+static AieRC __mlir_aie_write_bd(XAie_DevInst *devInst, XAie_LocType loc,
+                                 u8 bd, const u32 *regs) {
+  u64 addr = _XAie_GetTileAddr(devInst, loc.Row, loc.Col) + 0x1D000 +
+             bd * 0x20;
+  return XAie_BlockWrite32(devInst, addr, regs, 7);
+}
+
+)code";
+
+// This string is output before the runtime sequences of the design.
+const char xaie_c_sequence_header[] = R"code(
+// Push a transfer of the shim DMA channel chNum of loc on BD bd, one of the
+// slots BDs the channel uses in turn. The channel runs its BDs in order, so
+// bd, pushed slots transfers ago, is done once fewer than slots are pending.
+static AieRC __mlir_aie_shim_transfer(XAie_DevInst *devInst, XAie_LocType loc,
+                                      u8 chNum, XAie_DmaDirection dir, u8 bd,
+                                      u64 addr, u32 bytes, u8 slots) {
+  u8 pending;
+  do {
+    AieRC ret = XAie_DmaGetPendingBdCount(devInst, loc, chNum, dir, &pending);
+    if (ret != XAIE_OK)
+      return ret;
+  } while (pending >= slots);
+  XAie_DmaDesc desc;
+  __mlir_aie_try(XAie_DmaDescInit(devInst, &desc, loc));
+  __mlir_aie_try(XAie_DmaSetAddrLen(&desc, addr, bytes));
+  __mlir_aie_try(XAie_DmaSetAxi(&desc, /* smid */ 0, /* burstlen */ 4,
+                                /* QoS */ 0, /* Cache */ 0,
+                                /* Secure */ XAIE_ENABLE));
+  __mlir_aie_try(XAie_DmaEnableBd(&desc));
+  __mlir_aie_try(XAie_DmaWriteBd(devInst, &desc, loc, bd));
+  return XAie_DmaChannelPushBdToQueue(devInst, loc, chNum, dir, bd);
+}
+
+static u64 __mlir_aie_external_addr(aie_libxaie_ctx_t *ctx, const char *name) {
+  std::lock_guard<std::recursive_mutex> guard(ctx->mutex);
+  assert(ctx->externalAddrs.count(name));
+  return ctx->externalAddrs[name];
+}
+
+)code";
+
+// This string is output before the overlay loaders of the cores.
+const char xaie_c_overlay_header[] = R"code(
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// Load the overlay of fileName, linked at base in the window of size bytes
+// of the program memory of the core of loc.  The core must wait outside of
+// the window while it is written.
+static AieRC __mlir_aie_load_overlay(XAie_DevInst *devInst, XAie_LocType loc,
+                                     const char *fileName, u32 base,
+                                     u32 size) {
+  std::ifstream file(fileName, std::ios::binary);
+  std::vector<char> code((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+  if (code.empty() || code.size() > size)
+    return XAIE_INVALID_ARGS;
+  code.resize((code.size() + 15) & ~15);
+  // The program memory is at offset 0x20000 of the tile.
+  u64 addr = _XAie_GetTileAddr(devInst, loc.Row, loc.Col) + 0x20000 + base;
+  return XAie_BlockWrite32(devInst, addr, (const u32 *)code.data(),
+                           code.size() / 4);
+}
+
+)code";
+
+// This string is output before the setters of the runtime parameters.
+const char xaie_c_rtp_header[] = R"code(
+#include <unistd.h>
+
+// Write values in the copy of an rtp block its core does not read, and make
+// it the latest version.  The core reads the copy of the version it last
+// acknowledged, so the other copy is free once the core acknowledged the
+// latest version.
+static AieRC __mlir_aie_write_rtp(XAie_DevInst *devInst, XAie_LocType loc,
+                                  u32 copy0, u32 copy1, u32 version, u32 ack,
+                                  const void *values, u32 bytes,
+                                  int timeoutUs) {
+  u32 latest, acked;
+  __mlir_aie_try(XAie_DataMemRdWord(devInst, loc, version, &latest));
+  for (int t = 0;; t++) {
+    __mlir_aie_try(XAie_DataMemRdWord(devInst, loc, ack, &acked));
+    if (acked == latest)
+      break;
+    if (t >= timeoutUs)
+      return XAIE_ERR;
+    usleep(1);
   }
-  return ret;
+  u32 next = latest + 1;
+  __mlir_aie_try(XAie_DataMemBlockWrite(devInst, loc, next & 1 ? copy1 : copy0,
+                                        values, bytes));
+  return XAie_DataMemWrWord(devInst, loc, version, next);
 }
 
 )code";
 
+// The broadcast channels on which mlir_aie_start_cores_synchronized starts
+// the cores and mlir_aie_sync_timers resets their timers.
+static const int START_BROADCAST_CHANNEL = 15;
+static const int TIMER_BROADCAST_CHANNEL = 14;
+// The channels on which mlir_aie_configure_notifications broadcasts the
+// events of the tiles to the host, downwards: channel 0 is the one of the
+// errors and channel 1 the one of the shim interrupt controllers.
+static const int NOTIFY_BROADCAST_CHANNEL = 13;
+static const int NOTIFY_LAST_BROADCAST_CHANNEL = 2;
+
 /*
 static std::string shimDMAInstStr(StringRef col, StringRef index) {
   std::string str;
@@ -85,6 +193,16 @@ static std::string tileLocStr(StringRef col, StringRef row) {
 static std::string tileLocStr(int col, int row) {
   return tileLocStr(std::to_string(col), std::to_string(row));
 }
+/// Function that emits the broadcast of event, a user event of the shim
+/// tile of col, on channel, and its generation.
+static void emitShimBroadcast(raw_ostream &output, StringRef deviceInstRef,
+                              int col, int channel, StringRef event) {
+  std::string shim = tileLocStr(col, 0);
+  output << "__mlir_aie_try(XAie_EventBroadcast(" << deviceInstRef << ", "
+         << shim << ", XAIE_PL_MOD, " << channel << ", " << event << "));\n";
+  output << "__mlir_aie_try(XAie_EventGenerate(" << deviceInstRef << ", "
+         << shim << ", XAIE_PL_MOD, " << event << "));\n";
+}
 static std::string tileDMAInstStr(StringRef col, StringRef row,
                                   StringRef bdNum) {
   std::string str;
@@ -135,6 +253,47 @@ static std::string packetStr(int id, int type) {
   return packetStr(std::to_string(id), std::to_string(type));
 }
 
+// The configuration of each column, in the order the columns first appear.
+// Column -1 holds the configuration which is not placed in a single column.
+using ColumnConfig = llvm::MapVector<int, std::string>;
+
+// Output mlir_aie_configure_<name>, running the configuration of every
+// column in turn, on top of a static mlir_aie_configure_<name>_col<c> for
+// each column and mlir_aie_configure_<name>_column(ctx, col), so that the
+// runtime can configure the columns concurrently.
+static void emitColumnConfig(raw_ostream &output, StringRef ctx_p,
+                             StringRef name, const ColumnConfig &columns,
+                             StringRef prologue = "") {
+  auto funcName = [&](int col) {
+    return "mlir_aie_configure_" + name.str() +
+           (col < 0 ? std::string("_unplaced")
+                    : "_col" + std::to_string(col));
+  };
+  for (const auto &[col, code] : columns) {
+    output << "static int " << funcName(col) << "(" << ctx_p << ") {\n";
+    output << prologue << code;
+    output << "return XAIE_OK;\n";
+    output << "} // " << funcName(col) << "\n\n";
+  }
+
+  output << "int mlir_aie_configure_" << name << "_column(" << ctx_p
+         << ", int col) {\n";
+  output << "switch (col) {\n";
+  for (const auto &column : columns)
+    if (column.first >= 0)
+      output << "case " << column.first << ": return "
+             << funcName(column.first) << "(ctx);\n";
+  output << "default: return XAIE_OK;\n";
+  output << "}\n";
+  output << "} // mlir_aie_configure_" << name << "_column\n\n";
+
+  output << "int mlir_aie_configure_" << name << "(" << ctx_p << ") {\n";
+  for (const auto &column : columns)
+    output << "__mlir_aie_try(" << funcName(column.first) << "(ctx));\n";
+  output << "return XAIE_OK;\n";
+  output << "} // mlir_aie_configure_" << name << "\n\n";
+}
+
 // FIXME: code bloat. this shouldn't really be a template, but need
 // a proper DMA-like interface
 // blockMap: A map that gives a unique bd ID assignment for every block.
@@ -168,6 +327,8 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
     StringRef AbMode = disable;
     int ndims = 0;
     ArrayRef<DimTupleAttr> dims;
+    ArrayRef<PadTupleAttr> padding;
+    bool compression = false;
     //      StringRef FifoMode = disable; // FIXME: when to enable FIFO mode?
     for (auto op : block.template getOps<DMABDOp>()) {
       foundBd = true;
@@ -206,6 +367,9 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
         dims = *op.getDimensions();
         ndims = dims.size();
       }
+      if (op.getPadding())
+        padding = *op.getPadding();
+      compression |= op.getCompression();
     }
 
     if (0 != ndims && AIEArch::AIE2 != target_model.getTargetArch()) {
@@ -263,7 +427,64 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
     }
 
     int bdNum = blockMap[&block];
-    if (foundBd) {
+    int nextBdNum = 0, enableNextBd = 0;
+    if (block.getNumSuccessors() > 0) {
+      Block *nextBlock = block.getSuccessors()[0]; // should have only one
+                                                   // successor block
+      enableNextBd = nextBlock->getOps<EndOp>().empty();
+      nextBdNum = blockMap[nextBlock];
+    }
+
+    // The BDs of the tile DMAs of AIE1 have a fixed layout, so their registers
+    // are computed here and written from a constant table, rather than built
+    // by the XAie_Dma* calls at runtime.
+    int lockID = hasAcq ? acqLockID : relLockID;
+    bool constantBd = foundBd &&
+                      AIEArch::AIE1 == target_model.getTargetArch() &&
+                      target_model.isCoreTile(col, row) && !hasB &&
+                      (lenA * bytesA) % 4 == 0 &&
+                      (!hasAcq || !hasRel || acqLockID == relLockID) &&
+                      (acqValue == 0 || acqValue == 1) &&
+                      (relValue == 0 || relValue == 1);
+    if (constantBd) {
+      Field<25, 22> lockIDField;
+      Field<21> releaseEnable;
+      Field<20> releaseValue;
+      Field<19> releaseValueEnable;
+      Field<18> acquireEnable;
+      Field<17> acquireValue;
+      Field<16> acquireValueEnable;
+      Field<12, 0> baseAddress, length;
+      Field<16, 13> nextBd;
+      Field<17> enableNext;
+      Field<14, 12> packetTypeField;
+      Field<4, 0> packetIDField;
+      Field<31> valid;
+      Field<27> enablePacket;
+
+      uint32_t regs[7] = {0, 0, 0x00ff0001u, 0xffff0100u, 0, 0, 0};
+      if (hasAcq || hasRel)
+        regs[0] |= lockIDField(lockID) | acquireEnable(hasAcq) |
+                   acquireValueEnable(1) | acquireValue(acqValue) |
+                   releaseEnable(hasRel) | releaseValueEnable(1) |
+                   releaseValue(relValue);
+      regs[0] |= baseAddress((BaseAddrA + offsetA) >> 2);
+      if (foundBdPacket) {
+        regs[4] = packetTypeField(packetType) | packetIDField(packetID);
+        regs[6] |= enablePacket(1);
+      }
+      regs[6] |= valid(1) | enableNext(enableNextBd) |
+                 nextBd(nextBdNum) | length(lenA * bytesA / 4 - 1);
+
+      std::string regsName = tileDMAInstStr(col, row, bdNum) + "_regs";
+      output << "static const u32 " << regsName << "[7] = {";
+      for (int i = 0; i < 7; i++)
+        output << (i ? ", " : "") << "0x" << llvm::utohexstr(regs[i]);
+      output << "};\n";
+      output << "__mlir_aie_try(__mlir_aie_write_bd(" << deviceInstRef << ", "
+             << tileLocStr(col, row) << ", "
+             << " /* bd */ " << bdNum << ", " << regsName << "));\n";
+    } else if (foundBd) {
       // TODO AB mode separated
 
       // TODO For now, we are going to name each dma desc with loc and bd
@@ -291,7 +512,7 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
           output << "__mlir_aie_try(XAie_DmaSetAddrLen("
                  << tileDMAInstRefStr(col, row, bdNum) << ", /* addrA */ "
                  << "mlir_aie_external_get_addr_myBuffer_" << col << row << "_"
-                 << bdNum << "(), "
+                 << bdNum << "(ctx), "
                  << " /* len */ " << lenA << " * " << bytesA << "));\n";
           output << "__mlir_aie_try(XAie_DmaSetAxi("
                  << tileDMAInstRefStr(col, row, bdNum) << ", "
@@ -307,45 +528,51 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
                  << " /* len */ " << lenA << " * " << bytesA << "));\n";
         }
       } else {
+        // The dimensions are copied into the descriptor, so they live on the
+        // stack rather than on the heap.
         std::string tensor = tileDMATensorStr(col, row, bdNum);
-        output << "XAie_DmaTensor " << tensor << " = {};\n";
-        output << tensor << ".NumDim = " << std::to_string(ndims) << ";\n";
-        output << tensor
-               << ".Dim ="
-                  "__mlir_aie_alloc_dim_desc("
-               << std::to_string(ndims) << ");\n";
-        output << "if(NULL == " << tensor << ".Dim){\n"
-               << "  return 1;\n"
-               << "}\n";
+        output << "XAie_DmaDimDesc " << tensor << "_dims["
+               << std::to_string(ndims) << "] = {};\n";
         for (int i = 0; i < ndims; i++) {
           // Pass down dimensions in reverse order; in the MLIR, this allows us
           // to specify step sizes/wraps in the same order as we would access a
           // multi-dim C array, with the highest dimension first.
           int j = ndims - i - 1;
           // Assume AIE-ML architecture; we assert this above
-          output << tensor << ".Dim[" << std::to_string(j) << "].AieMlDimDesc"
+          output << tensor << "_dims[" << std::to_string(j) << "].AieMlDimDesc"
                  << " = { /* StepSize */ "
                  << std::to_string(dims[i].getStepsize()) << ", /* Wrap */ "
                  << std::to_string(dims[i].getWrap()) << "};\n";
         }
+        output << "XAie_DmaTensor " << tensor << " = {};\n";
+        output << tensor << ".NumDim = " << std::to_string(ndims) << ";\n";
+        output << tensor << ".Dim = " << tensor << "_dims;\n";
         output << "__mlir_aie_try(XAie_DmaSetMultiDimAddr("
                << tileDMAInstRefStr(col, row, bdNum) << ", "
                << "&" << tensor << ", "
                << "0x" << llvm::utohexstr(BaseAddrA + offsetA) << ", "
                << " /* len */ " << lenA << " * " << bytesA << "));\n";
+        if (!padding.empty()) {
+          // The zeros are given from the lowest dimension, as the wraps.
+          int npads = padding.size();
+          output << "XAie_PadDesc " << tensor << "_pads[" << npads
+                 << "] = {};\n";
+          for (int i = 0; i < npads; i++)
+            output << tensor << "_pads[" << npads - i - 1 << "] = "
+                   << "{ /* Before */ " << padding[i].getBefore()
+                   << ", /* After */ " << padding[i].getAfter() << "};\n";
+          output << "XAie_DmaPadTensor " << tensor << "_pad = {};\n";
+          output << tensor << "_pad.NumDim = " << npads << ";\n";
+          output << tensor << "_pad.PadDesc = " << tensor << "_pads;\n";
+          output << "__mlir_aie_try(XAie_DmaSetPadding("
+                 << tileDMAInstRefStr(col, row, bdNum) << ", "
+                 << "&" << tensor << "_pad));\n";
+        }
         // TODO: Probably need special handling for NOC
         // TODO: Might need to adjust step sizes / wraps by -1
       }
 
       if (block.getNumSuccessors() > 0) {
-        Block *nextBlock = block.getSuccessors()[0]; // should have only one
-                                                     // successor block
-
-        int enableNextBd = 1;
-        if (!nextBlock->getOps<EndOp>().empty())
-          enableNextBd = 0;
-
-        int nextBdNum = blockMap[nextBlock];
         output << "__mlir_aie_try(XAie_DmaSetNextBd("
                << tileDMAInstRefStr(col, row, bdNum) << ", "
                << " /* nextbd */ " << nextBdNum << ", "
@@ -356,6 +583,9 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
                << tileDMAInstRefStr(col, row, bdNum) << ", "
                << packetStr(packetID, packetType) << "));\n";
       }
+      if (compression)
+        output << "__mlir_aie_try(XAie_DmaEnableCompression("
+               << tileDMAInstRefStr(col, row, bdNum) << "));\n";
       output << "__mlir_aie_try(XAie_DmaEnableBd("
              << tileDMAInstRefStr(col, row, bdNum) << "));\n";
       output << "__mlir_aie_try(XAie_DmaWriteBd(" << deviceInstRef << ", "
@@ -372,13 +602,28 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
       llvm::StringRef dmaDir = stringifyDMAChannelDir(op.getChannelDir());
       int chNum = op.getChannelIndex();
 
-      output << "__mlir_aie_try(XAie_DmaChannelPushBdToQueue(" << deviceInstRef
-             << ", " << tileLocStr(col, row) << ", "
-             << "/* ChNum */" << chNum
-             << ", "
-             // TODO hack until physical dialect changes
-             << "/* dmaDir */ DMA_" << dmaDir << ", "
-             << "/* BdNum */" << bdNum << "));\n";
+      if (auto repeatCount = op.getRepeatCount()) {
+        // The start queue of AIE-ML channels runs the chain of BDs the given
+        // number of times without the host pushing it again.
+        if (AIEArch::AIE2 != target_model.getTargetArch())
+          return op.emitOpError("repeat counts are only supported for AIE-ML "
+                                "devices.");
+        output << "__mlir_aie_try(XAie_DmaChannelSetStartQueue("
+               << deviceInstRef << ", " << tileLocStr(col, row) << ", "
+               << "/* ChNum */" << chNum << ", "
+               << "/* dmaDir */ DMA_" << dmaDir << ", "
+               << "/* BdNum */" << bdNum << ", "
+               << "/* RepeatCount */ " << *repeatCount << ", "
+               << "/* EnTokenIssue */ " << disable << "));\n";
+      } else {
+        output << "__mlir_aie_try(XAie_DmaChannelPushBdToQueue("
+               << deviceInstRef << ", " << tileLocStr(col, row) << ", "
+               << "/* ChNum */" << chNum
+               << ", "
+               // TODO hack until physical dialect changes
+               << "/* dmaDir */ DMA_" << dmaDir << ", "
+               << "/* BdNum */" << bdNum << "));\n";
+      }
       output << "__mlir_aie_try(XAie_DmaChannelEnable(" << deviceInstRef << ", "
              << tileLocStr(col, row) << ", "
              << "/* ChNum */ " << chNum
@@ -390,28 +635,20 @@ mlir::LogicalResult generateDMAConfig(OpType memOp, raw_ostream &output,
   return success();
 }
 
-mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
+mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output,
+                                         bool minimal) {
   //  StringRef ctx   = "ctx";                     // TODO
   StringRef ctx_p = "aie_libxaie_ctx_t* ctx"; // TODO
   //  StringRef deviceInst = "ctx->DevInst";       // TODO
   StringRef deviceInstRef = "&(ctx->DevInst)"; // TODO
 
-  DenseMap<std::pair<int, int>, Operation *> tiles;
-  DenseMap<Operation *, CoreOp> cores;
-  DenseMap<Operation *, MemOp> mems;
-  DenseMap<std::pair<Operation *, int>, LockOp> locks;
-  DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
-  DenseMap<Operation *, SwitchboxOp> switchboxes;
-
   if (module.getOps<DeviceOp>().empty()) {
     return module.emitOpError("expected AIE.device operation at toplevel");
   }
   DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
   const auto &target_model = targetOp.getTargetModel();
 
-  NetlistAnalysis NL(targetOp, tiles, cores, mems, locks, buffers, switchboxes);
-  NL.collectTiles(tiles);
-  NL.collectBuffers(buffers);
+  NetlistAnalysis NL(targetOp);
 
   //---------------------------------------------------------------------------
   // mlir_aie_init_libxaie
@@ -446,7 +683,15 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
   output << "  ctx->AieConfigPtr.ColShift = " << col_shift << ";\n";
   output << "  ctx->AieConfigPtr.RowShift = " << row_shift << ";\n";
   output << "  ctx->AieConfigPtr.NumRows = " << target_model.rows() << ";\n";
-  output << "  ctx->AieConfigPtr.NumCols = " << target_model.columns() << ";\n";
+  // The tiles of a partition are numbered from its first column, which
+  // libxaie adds back to each tile location, so the configuration below loads
+  // at the column given to mlir_aie_init_device_partition().
+  output << "  ctx->AieConfigPtr.NumCols = " << target_model.getDeviceColumns()
+         << ";\n";
+  if (target_model.columns() != target_model.getDeviceColumns())
+    output << "  // Partition of " << target_model.columns()
+           << " columns, compiled at column "
+           << target_model.getPartitionStartCol() << ".\n";
   output << "  ctx->AieConfigPtr.ShimRowNum = 0;\n";
   output << "  ctx->AieConfigPtr.MemTileRowStart = 1;\n";
   output << "  ctx->AieConfigPtr.MemTileNumRows = "
@@ -466,10 +711,95 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
   output << "}\n";
   output << "\n";
 
+  //---------------------------------------------------------------------------
+  // mlir_aie_init_device_used_tiles
+  //---------------------------------------------------------------------------
+  // Only the tiles the design uses are clocked, and the columns without any
+  // stay gated, instead of all the tiles of mlir_aie_init_device().
+  output << "int mlir_aie_init_device_used_tiles(" << ctx_p << ") {\n";
+  SmallVector<TileOp> usedTiles;
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (tileOp.isUsed())
+      usedTiles.push_back(tileOp);
+  if (usedTiles.empty()) {
+    output << "  return mlir_aie_init_device(ctx);\n";
+  } else {
+    output << "  XAie_LocType tiles[] = {\n";
+    for (auto tileOp : usedTiles)
+      output << "    XAie_TileLoc(" << tileOp.colIndex() << ", "
+             << tileOp.rowIndex() << "),\n";
+    output << "  };\n";
+    output << "  return mlir_aie_init_device_tiles(ctx, tiles, "
+           << usedTiles.size() << ");\n";
+  }
+  output << "}\n";
+  output << "\n";
+
   //---------------------------------------------------------------------------
   // mlir_aie_configure_cores
   //---------------------------------------------------------------------------
-  output << "int mlir_aie_configure_cores(" << ctx_p << ") {\n";
+  // The cores running the same ELF file load it from memory, read once.
+  auto getElfFile = [](CoreOp coreOp, int col, int row) {
+    if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("elf_file"))
+      return std::string(fileAttr.getValue());
+    return std::string("core_") + std::to_string(col) + "_" +
+           std::to_string(row) + ".elf";
+  };
+  llvm::StringMap<int> elfUses;
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (auto coreOp = tileOp.getCoreOp())
+      ++elfUses[getElfFile(coreOp, tileOp.colIndex(), tileOp.rowIndex())];
+  llvm::StringMap<int> sharedElfs;
+  for (auto tileOp : targetOp.getOps<TileOp>()) {
+    auto coreOp = tileOp.getCoreOp();
+    if (!coreOp)
+      continue;
+    std::string fileName =
+        getElfFile(coreOp, tileOp.colIndex(), tileOp.rowIndex());
+    if (elfUses[fileName] > 1 && !sharedElfs.count(fileName)) {
+      int id = sharedElfs.size();
+      sharedElfs[fileName] = id;
+    }
+  }
+  if (!sharedElfs.empty()) {
+    output << "#include <fstream>\n"
+           << "#include <iterator>\n"
+           << "#include <mutex>\n"
+           << "#include <vector>\n"
+           << "static AieRC __mlir_aie_load_shared_elf(XAie_DevInst *devInst, "
+              "XAie_LocType loc, std::once_flag &once, "
+              "std::vector<unsigned char> &elf, const char *fileName) {\n"
+           << "  std::call_once(once, [&]() {\n"
+           << "    std::ifstream file(fileName, std::ios::binary);\n"
+           << "    elf.assign(std::istreambuf_iterator<char>(file), "
+              "std::istreambuf_iterator<char>());\n"
+           << "  });\n"
+           << "  if (elf.empty())\n"
+           << "    return XAIE_INVALID_ELF;\n"
+           << "  return XAie_LoadElfMem(devInst, loc, elf.data());\n"
+           << "}\n";
+    for (int i = 0, e = sharedElfs.size(); i < e; ++i)
+      output << "static std::once_flag __mlir_aie_elf_once_" << i << ";\n"
+             << "static std::vector<unsigned char> __mlir_aie_elf_" << i
+             << ";\n";
+  }
+
+  // The directions in which the AIE2 cores of the cascade flows get and put
+  // their accumulators, from the west and to the east by default.
+  DenseMap<TileID, std::pair<StringRef, StringRef>> cascadeDirs;
+  if (target_model.getTargetArch() == AIEArch::AIE2) {
+    for (auto cascade : targetOp.getOps<CascadeFlowOp>()) {
+      TileID source = cascade.getSourceTileOp().getTileID();
+      TileID dest = cascade.getDestTileOp().getTileID();
+      bool east = dest.first == source.first + 1;
+      cascadeDirs.try_emplace(source, "WEST", "EAST");
+      cascadeDirs[source].second = east ? "EAST" : "SOUTH";
+      cascadeDirs.try_emplace(dest, "WEST", "EAST");
+      cascadeDirs[dest].first = east ? "WEST" : "NORTH";
+    }
+  }
+
+  ColumnConfig coreConfig;
   // Reset each core.  Load the corresponding ELF file, if necessary.
   for (auto tileOp : targetOp.getOps<TileOp>()) {
     int col = tileOp.colIndex();
@@ -477,40 +807,61 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
     if (tileOp.isShimTile() || tileOp.isMemTile()) {
       // Resets no needed with V2 kernel driver
     } else {
+      llvm::raw_string_ostream colOutput(coreConfig[col]);
       // Resets no needed with V2 kernel driver
-      output << "__mlir_aie_try(XAie_CoreReset(" << deviceInstRef << ", "
-             << tileLocStr(col, row) << "));\n";
-      output << "__mlir_aie_try(XAie_CoreDisable(" << deviceInstRef << ", "
-             << tileLocStr(col, row) << "));\n";
-      // Release locks
-      int numLocks = target_model.getNumLocks(col, row);
-      output << "for (int l = 0; l < " << numLocks << "; ++l)\n"
-             << "  __mlir_aie_try(XAie_LockRelease(" << deviceInstRef << ", "
-             << tileLocStr(col, row) << ", XAie_LockInit(l, 0x0), 0));\n";
+      colOutput << "__mlir_aie_try(XAie_CoreReset(" << deviceInstRef << ", "
+                << tileLocStr(col, row) << "));\n";
+      colOutput << "__mlir_aie_try(XAie_CoreDisable(" << deviceInstRef << ", "
+                << tileLocStr(col, row) << "));\n";
+      // Release locks, only the ones of the design in minimal mode, the
+      // others are still released from the reset of the device.
+      if (minimal) {
+        std::set<int> lockIDs;
+        for (auto lock : targetOp.getOps<LockOp>())
+          if (lock.getTileOp() == tileOp)
+            lockIDs.insert(lock.getLockIDValue());
+        for (int l : lockIDs)
+          colOutput << "__mlir_aie_try(XAie_LockRelease(" << deviceInstRef
+                    << ", " << tileLocStr(col, row) << ", XAie_LockInit(" << l
+                    << ", 0x0), 0));\n";
+      } else {
+        int numLocks = target_model.getNumLocks(col, row);
+        colOutput << "for (int l = 0; l < " << numLocks << "; ++l)\n"
+                  << "  __mlir_aie_try(XAie_LockRelease(" << deviceInstRef
+                  << ", " << tileLocStr(col, row)
+                  << ", XAie_LockInit(l, 0x0), 0));\n";
+      }
       if (auto coreOp = tileOp.getCoreOp()) {
-        std::string fileName;
-        if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("elf_file")) {
-          fileName = std::string(fileAttr.getValue());
+        std::string fileName = getElfFile(coreOp, col, row);
+        colOutput << "{\n";
+        if (sharedElfs.count(fileName)) {
+          int elf = sharedElfs[fileName];
+          colOutput << "AieRC RC = __mlir_aie_load_shared_elf("
+                    << deviceInstRef << ", " << tileLocStr(col, row)
+                    << ", __mlir_aie_elf_once_" << elf << ", __mlir_aie_elf_"
+                    << elf << ", (const char*)\"" << fileName << "\");\n";
         } else {
-          fileName = std::string("core_") + std::to_string(col) + "_" +
-                     std::to_string(row) + ".elf";
+          colOutput << "AieRC RC = XAie_LoadElf(" << deviceInstRef << ", "
+                    << tileLocStr(col, row) << ", "
+                    << "(const char*)\"" << fileName << "\",0);\n";
         }
-        output << "{\n"
-               << "AieRC RC = XAie_LoadElf(" << deviceInstRef << ", "
-               << tileLocStr(col, row) << ", "
-               << "(const char*)\"" << fileName << "\",0);\n";
-        output << "if (RC != XAIE_OK)\n"
-               << "    __mlir_aie_verbose(fprintf(stderr, \"Failed to load elf "
-                  "for Core[%d,%d], ret is %d\\n\", "
-               << std::to_string(col) << ", " << std::to_string(row)
-               << ", RC));\n"
-               << "assert(RC == XAIE_OK);\n"
-               << "}\n";
+        colOutput << "if (RC != XAIE_OK)\n"
+                  << "    __mlir_aie_verbose(fprintf(stderr, \"Failed to load "
+                     "elf for Core[%d,%d], ret is %d\\n\", "
+                  << std::to_string(col) << ", " << std::to_string(row)
+                  << ", RC));\n"
+                  << "assert(RC == XAIE_OK);\n"
+                  << "}\n";
       }
+      auto dirs = cascadeDirs.find({col, row});
+      if (dirs != cascadeDirs.end())
+        colOutput << "__mlir_aie_try(XAie_CoreConfigAccumulatorControl("
+                  << deviceInstRef << ", " << tileLocStr(col, row) << ", "
+                  << dirs->second.first << ", " << dirs->second.second
+                  << "));\n";
     }
   }
-  output << "return XAIE_OK;\n";
-  output << "} // mlir_aie_configure_cores\n\n";
+  emitColumnConfig(output, ctx_p, "cores", coreConfig);
 
   //---------------------------------------------------------------------------
   // mlir_aie_start_cores
@@ -530,10 +881,178 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
   output << "return XAIE_OK;\n";
   output << "} // mlir_aie_start_cores\n\n";
 
+  //---------------------------------------------------------------------------
+  // mlir_aie_start_cores_synchronized
+  //---------------------------------------------------------------------------
+  // Arm every core to enable itself on a broadcast event, then generate the
+  // event once in a shim tile: the cores start as the broadcast network
+  // propagates it, a few cycles apart at most and the same way on each run,
+  // instead of one register write of the host after the other.
+  output << "int mlir_aie_start_cores_synchronized(" << ctx_p << ") {\n";
+  std::vector<TileOp> cores;
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (!tileOp.isShimTile() && !tileOp.isMemTile())
+      cores.push_back(tileOp);
+  for (auto tileOp : cores) {
+    std::string loc = tileLocStr(tileOp.colIndex(), tileOp.rowIndex());
+    output << "__mlir_aie_try(XAie_CoreUnreset(" << deviceInstRef << ", "
+           << loc << "));\n";
+    output << "__mlir_aie_try(XAie_CoreConfigureEnableEvent(" << deviceInstRef
+           << ", " << loc << ", XAIE_EVENT_BROADCAST_"
+           << START_BROADCAST_CHANNEL << "_CORE));\n";
+  }
+  if (!cores.empty())
+    emitShimBroadcast(output, deviceInstRef, cores.front().colIndex(),
+                      START_BROADCAST_CHANNEL, "XAIE_EVENT_USER_EVENT_0_PL");
+  // The cores are enabled: disarm them, so that they can be stopped again.
+  for (auto tileOp : cores)
+    output << "__mlir_aie_try(XAie_CoreConfigureEnableEvent(" << deviceInstRef
+           << ", " << tileLocStr(tileOp.colIndex(), tileOp.rowIndex())
+           << ", XAIE_EVENT_NONE_CORE));\n";
+  output << "return XAIE_OK;\n";
+  output << "} // mlir_aie_start_cores_synchronized\n\n";
+
+  //---------------------------------------------------------------------------
+  // mlir_aie_sync_timers
+  //---------------------------------------------------------------------------
+  // Reset the timers of the core modules of all the cores on the same
+  // broadcast event, so that the timestamps the cores take of the same cycle
+  // are equal, up to the propagation of the broadcast.
+  output << "int mlir_aie_sync_timers(" << ctx_p << ") {\n";
+  for (auto tileOp : cores)
+    output << "__mlir_aie_try(XAie_SetTimerResetEvent(" << deviceInstRef
+           << ", " << tileLocStr(tileOp.colIndex(), tileOp.rowIndex())
+           << ", XAIE_CORE_MOD, XAIE_EVENT_BROADCAST_"
+           << TIMER_BROADCAST_CHANNEL << "_CORE, XAIE_RESETDISABLE));\n";
+  if (!cores.empty())
+    emitShimBroadcast(output, deviceInstRef, cores.front().colIndex(),
+                      TIMER_BROADCAST_CHANNEL, "XAIE_EVENT_USER_EVENT_1_PL");
+  for (auto tileOp : cores)
+    output << "__mlir_aie_try(XAie_SetTimerResetEvent(" << deviceInstRef
+           << ", " << tileLocStr(tileOp.colIndex(), tileOp.rowIndex())
+           << ", XAIE_CORE_MOD, XAIE_EVENT_NONE_CORE, XAIE_RESETDISABLE));\n";
+  output << "return XAIE_OK;\n";
+  output << "} // mlir_aie_sync_timers\n\n";
+
+  //---------------------------------------------------------------------------
+  // mlir_aie_profile_functions
+  //---------------------------------------------------------------------------
+  // The address ranges of the functions are only known once the cores are
+  // linked, which happens alongside the compilation of this file: the
+  // profile reads them from the ELF files at runtime.
+  output << "void mlir_aie_profile_functions(" << ctx_p
+         << ", FunctionProfile &profile) {\n";
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (auto coreOp = tileOp.getCoreOp()) {
+      int col = tileOp.colIndex();
+      int row = tileOp.rowIndex();
+      output << "profile.addCore(" << col << ", " << row << ", \""
+             << getElfFile(coreOp, col, row) << "\");\n";
+    }
+  output << "} // mlir_aie_profile_functions\n\n";
+
+  //---------------------------------------------------------------------------
+  // mlir_aie_profile_dataflow
+  //---------------------------------------------------------------------------
+  // Count the active cycles and the stalls of every core of the design.
+  output << "bool mlir_aie_profile_dataflow(" << ctx_p
+         << ", DataflowProfile &profile) {\n";
+  output << "bool counted = true;\n";
+  for (auto tileOp : targetOp.getOps<TileOp>())
+    if (tileOp.getCoreOp())
+      output << "counted &= profile.addCore(" << tileOp.colIndex() << ", "
+             << tileOp.rowIndex() << ");\n";
+  output << "return counted;\n";
+  output << "} // mlir_aie_profile_dataflow\n\n";
+
+  //---------------------------------------------------------------------------
+  // mlir_aie_configure_notifications
+  //---------------------------------------------------------------------------
+  // Each event of the `notify` array of a tile is broadcast on its own
+  // channel, which only the interrupt controller of the shim tile of its
+  // column forwards to the host. The events are the
+  // ones the host otherwise polls for: "core_event_<n>", raised by
+  // AIE.event(<n>) in the core, and "dma_<s2mm|mm2s>_<n>_done", the end of
+  // the buffer descriptors of a DMA channel of a tile or of a shim tile.
+  output << "int mlir_aie_configure_notifications(" << ctx_p << ") {\n";
+  int broadcastId = NOTIFY_BROADCAST_CHANNEL;
+  for (auto tileOp : targetOp.getOps<TileOp>()) {
+    auto notify = tileOp->getAttrOfType<ArrayAttr>("notify");
+    if (!notify)
+      continue;
+    int col = tileOp.colIndex();
+    int row = tileOp.rowIndex();
+    if (tileOp.isMemTile())
+      return tileOp.emitOpError("cannot notify the host of the events of ")
+             << "a memory tile";
+    // The second-level interrupt controllers are in the shim NOC tiles.
+    int nocCol = -1;
+    for (int c = 0; c < target_model.columns(); c++)
+      if (target_model.isShimNOCTile(c, 0) &&
+          (nocCol < 0 || std::abs(c - col) < std::abs(nocCol - col)))
+        nocCol = c;
+    for (auto attr : notify) {
+      auto name = dyn_cast<StringAttr>(attr);
+      StringRef event = name ? name.getValue() : "";
+      std::string module, xaieEvent;
+      unsigned channel;
+      if (StringRef coreEvent = event;
+          coreEvent.consume_front("core_event_") &&
+          !coreEvent.getAsInteger(10, channel) && channel <= 1 &&
+          tileOp.getCoreOp()) {
+        module = "XAIE_CORE_MOD";
+        xaieEvent = llvm::formatv("XAIE_EVENT_INSTR_EVENT_{0}_CORE", channel);
+      } else if (StringRef dmaEvent = event;
+                 dmaEvent.consume_front("dma_") &&
+                 dmaEvent.consume_back("_done") &&
+                 (dmaEvent.consume_front("s2mm_") ||
+                  dmaEvent.consume_front("mm2s_")) &&
+                 !dmaEvent.getAsInteger(10, channel) && channel <= 1) {
+        bool shim = tileOp.isShimTile();
+        module = shim ? "XAIE_PL_MOD" : "XAIE_MEM_MOD";
+        xaieEvent = llvm::formatv("XAIE_EVENT_DMA_{0}_{1}_FINISHED_BD_{2}",
+                                  event.substr(4, 4).upper(), channel,
+                                  shim ? "PL" : "MEM");
+      } else {
+        return tileOp.emitOpError("cannot notify the host of ") << attr;
+      }
+      if (broadcastId < NOTIFY_LAST_BROADCAST_CHANNEL)
+        return tileOp.emitOpError("notifies the host of more events than ")
+               << "there are broadcast channels";
+      output << "if (mlir_aie_notify_event(ctx, " << col << ", " << row
+             << ", " << module << ", " << xaieEvent << ", " << broadcastId--
+             << ", " << nocCol << ") != 0)\n";
+      output << "  return -1;\n";
+    }
+  }
+  output << "return 0;\n";
+  output << "} // mlir_aie_configure_notifications\n\n";
+
+  //---------------------------------------------------------------------------
+  // mlir_aie_clear_design
+  //---------------------------------------------------------------------------
+  // Clear the configuration of the tiles of the design only, so that the
+  // array is ready for the next design without going over all its tiles. The
+  // registers cleared are the ones of AIE1, the AIE2 partitions are reset.
+  output << "int mlir_aie_clear_design(" << ctx_p << ") {\n";
+  if (arch == AIEArch::AIE1) {
+    for (auto tileOp : targetOp.getOps<TileOp>()) {
+      int col = tileOp.colIndex();
+      int row = tileOp.rowIndex();
+      output << (tileOp.isShimTile() ? "mlir_aie_clear_shim_config"
+                                     : "mlir_aie_clear_config")
+             << "(ctx, " << col << ", " << row << ");\n";
+    }
+    output << "return XAIE_OK;\n";
+  } else {
+    output << "return mlir_aie_reset_partition(ctx);\n";
+  }
+  output << "} // mlir_aie_clear_design\n\n";
+
   //---------------------------------------------------------------------------
   // mlir_aie_configure_dmas
   //---------------------------------------------------------------------------
-  output << "int mlir_aie_configure_dmas(" << ctx_p << ") {\n";
+  ColumnConfig dmaConfig;
 
   // DMA configuration
   // AieRC XAie_DmaDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
@@ -578,7 +1097,9 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
         bdNum++;
       }
     }
-    auto result = generateDMAConfig(memOp, output, target_model, NL, blockMap);
+    llvm::raw_string_ostream colOutput(dmaConfig[memOp.colIndex()]);
+    auto result =
+        generateDMAConfig(memOp, colOutput, target_model, NL, blockMap);
     if (result.failed())
       return result;
   }
@@ -615,29 +1136,26 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
       else
         blockMap[&block] = evenBdNum++;
     }
-    auto result = generateDMAConfig(memOp, output, target_model, NL, blockMap);
+    llvm::raw_string_ostream colOutput(dmaConfig[memOp.colIndex()]);
+    auto result =
+        generateDMAConfig(memOp, colOutput, target_model, NL, blockMap);
     if (result.failed())
       return result;
   }
 
-  output << "return XAIE_OK;\n";
-  output << "} // mlir_aie_configure_dmas\n\n";
+  emitColumnConfig(output, ctx_p, "dmas", dmaConfig);
 
+  // The addresses of the external buffers are kept in the context, so that
+  // several contexts of the design can run their own buffers.
   for (auto op : targetOp.getOps<ExternalBufferOp>()) {
     if (op.hasName()) {
-      output << "static u64 _mlir_aie_external_" << op.name().getValue()
-             << ";\n";
-      output << "static bool _mlir_aie_external_set_" << op.name().getValue()
-             << " = false;\n";
-
       output << "void mlir_aie_external_set_addr_" << op.name().getValue()
              << "(" << ctx_p << ", u64 VA) {\n"
              << "  u64 device_address = mlir_aie_get_device_address(ctx, (void "
                 "*)VA);\n"
-             << "    _mlir_aie_external_set_" << op.name().getValue()
-             << " = true;\n"
-             << "    _mlir_aie_external_" << op.name().getValue()
-             << " = device_address;\n"
+             << "  std::lock_guard<std::recursive_mutex> guard(ctx->mutex);\n"
+             << "  ctx->externalAddrs[\"" << op.name().getValue()
+             << "\"] = device_address;\n"
              << "}\n";
     }
   }
@@ -663,11 +1181,13 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
                 op.getBuffer().getDefiningOp());
 
             output << "u64 mlir_aie_external_get_addr_myBuffer_" << col << row
-                   << "_" << bdNum << "(void) {\n"
-                   << "    assert(_mlir_aie_external_set_"
-                   << buffer.name().getValue() << ");\n"
-                   << "    return _mlir_aie_external_"
-                   << buffer.name().getValue() << " + "
+                   << "_" << bdNum << "(" << ctx_p << ") {\n"
+                   << "    std::lock_guard<std::recursive_mutex> "
+                      "guard(ctx->mutex);\n"
+                   << "    assert(ctx->externalAddrs.count(\""
+                   << buffer.name().getValue() << "\"));\n"
+                   << "    return ctx->externalAddrs[\""
+                   << buffer.name().getValue() << "\"] + 0x"
                    << llvm::utohexstr(offset) << ";\n"
                    << "}\n";
           }
@@ -686,6 +1206,129 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
     output << "} // mlir_aie_configure_shimdma\n\n";
   }
 
+  //---------------------------------------------------------------------------
+  // mlir_aie_run_sequence_<name>
+  //---------------------------------------------------------------------------
+  // The shim DMA of a tile numbers the BDs of its AIE.shimDMA from 0 above,
+  // and each channel of a runtime sequence gets a ring of the following ones,
+  // at most as many as the queue of the channel holds.
+  const int shimDMAQueueDepth = 4;
+  std::map<std::pair<int, int>, int> shimBDs;
+  for (auto op : targetOp.getOps<ShimDMAOp>())
+    for (auto &block : op.getBody())
+      if (!block.getOps<DMABDOp>().empty())
+        shimBDs[{op.colIndex(), op.rowIndex()}]++;
+
+  auto sequences = targetOp.getOps<RuntimeSequenceOp>();
+  if (!sequences.empty())
+    output << xaie_c_sequence_header;
+  for (auto seq : sequences) {
+    StringRef name = seq.getSymName();
+    using Channel = std::tuple<int, int, DMAChannelDir, int>;
+    auto channelOf = [](ShimDMATransferOp op) {
+      return Channel(op.getTileOp().colIndex(), op.getTileOp().rowIndex(),
+                     op.getChannelDir(), op.getChannelIndex());
+    };
+    auto channelStr = [](const Channel &channel) {
+      auto [col, row, dir, chNum] = channel;
+      return std::to_string(col) + std::to_string(row) + "_" +
+             stringifyDMAChannelDir(dir).str() + "_" + std::to_string(chNum);
+    };
+
+    // The first BD and the number of BDs of each channel.
+    llvm::MapVector<Channel, std::pair<int, int>, std::map<Channel, unsigned>>
+        rings;
+    std::map<std::pair<int, int>, int> tileChannels;
+    for (auto op : seq.getBody().getOps<ShimDMATransferOp>()) {
+      auto channel = channelOf(op);
+      if (rings.count(channel))
+        continue;
+      rings[channel] = {0, 0};
+      tileChannels[{std::get<0>(channel), std::get<1>(channel)}]++;
+    }
+    std::map<std::pair<int, int>, int> nextBD;
+    for (auto &[channel, ring] : rings) {
+      auto [col, row, dir, chNum] = channel;
+      int free = target_model.getNumBDs(col, row) - shimBDs[{col, row}];
+      int slots = std::min(shimDMAQueueDepth, free / tileChannels[{col, row}]);
+      if (slots < 1)
+        return seq.emitOpError("has no buffer descriptors left on the shim "
+                               "DMA of tile (")
+               << col << ", " << row << ")";
+      int &bd = nextBD.try_emplace({col, row}, shimBDs[{col, row}])
+                    .first->second;
+      ring = {bd, slots};
+      bd += slots;
+    }
+
+    output << "int mlir_aie_run_sequence_" << name << "(" << ctx_p
+           << ") {\n";
+    llvm::StringSet<> buffers;
+    for (auto op : seq.getBody().getOps<ShimDMATransferOp>()) {
+      StringRef buffer = op.getBufferOp().name().getValue();
+      if (buffers.insert(buffer).second)
+        output << "u64 addr_" << buffer << " = __mlir_aie_external_addr(ctx, \""
+               << buffer << "\");\n";
+    }
+    for (auto &[channel, ring] : rings) {
+      auto [col, row, dir, chNum] = channel;
+      output << "u8 slot_" << channelStr(channel) << " = 0;\n";
+      output << "__mlir_aie_try(XAie_DmaChannelEnable(" << deviceInstRef
+             << ", " << tileLocStr(col, row) << ", "
+             << "/* ChNum */ " << chNum << ", "
+             << "/* dmaDir */ DMA_" << stringifyDMAChannelDir(dir) << "));\n";
+    }
+    for (auto op : seq.getBody().getOps<ShimDMATransferOp>()) {
+      auto channel = channelOf(op);
+      auto [col, row, dir, chNum] = channel;
+      auto [firstBD, slots] = rings[channel];
+      std::string slot = "slot_" + channelStr(channel);
+      int bytes = op.getBuffer()
+                      .getType()
+                      .cast<MemRefType>()
+                      .getElementTypeBitWidth() /
+                  8;
+      int repeat = op.getRepeat();
+      StringRef buffer = op.getBufferOp().name().getValue();
+      output << "// " << buffer << "[" << op.getOffset() << " : "
+             << op.getOffset() + op.getLen() << "]";
+      if (repeat > 1)
+        output << " x " << repeat << ", stride " << op.getStride();
+      output << "\n";
+      if (repeat > 1)
+        output << "for (int i = 0; i < " << repeat << "; i++) {\n";
+      output << "__mlir_aie_try(__mlir_aie_shim_transfer(" << deviceInstRef
+             << ", " << tileLocStr(col, row) << ", "
+             << "/* ChNum */ " << chNum << ", "
+             << "/* dmaDir */ DMA_" << stringifyDMAChannelDir(dir) << ", "
+             << "/* BdNum */ " << firstBD << " + " << slot << ", "
+             << "addr_" << buffer << " + 0x"
+             << llvm::utohexstr(op.getOffset() * bytes);
+      if (repeat > 1)
+        output << " + i * 0x" << llvm::utohexstr(op.getStride() * bytes);
+      output << ", /* len */ " << op.getLen() << " * " << bytes << ", "
+             << "/* slots */ " << slots << "));\n";
+      output << slot << " = (" << slot << " + 1) % " << slots << ";\n";
+      if (repeat > 1)
+        output << "}\n";
+    }
+    output << "return XAIE_OK;\n";
+    output << "} // mlir_aie_run_sequence_" << name << "\n\n";
+
+    output << "int mlir_aie_wait_sequence_" << name << "(" << ctx_p
+           << ", u32 timeoutUs) {\n";
+    for (auto &[channel, ring] : rings) {
+      auto [col, row, dir, chNum] = channel;
+      output << "__mlir_aie_try(XAie_DmaWaitForDone(" << deviceInstRef << ", "
+             << tileLocStr(col, row) << ", "
+             << "/* ChNum */ " << chNum << ", "
+             << "/* dmaDir */ DMA_" << stringifyDMAChannelDir(dir)
+             << ", timeoutUs));\n";
+    }
+    output << "return XAIE_OK;\n";
+    output << "} // mlir_aie_wait_sequence_" << name << "\n\n";
+  }
+
   //---------------------------------------------------------------------------
   // mlir_aie_initialize_locks
   //---------------------------------------------------------------------------
@@ -709,8 +1352,7 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
   //---------------------------------------------------------------------------
   // mlir_aie_configure_switchboxes
   //---------------------------------------------------------------------------
-  output << "int mlir_aie_configure_switchboxes(" << ctx_p << ") {\n";
-  output << "  int x, y;\n";
+  ColumnConfig switchboxConfig;
 
   // StreamSwitch (switchbox) configuration
   for (auto switchboxOp : targetOp.getOps<SwitchboxOp>()) {
@@ -720,15 +1362,18 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
                    b.getOps<MasterSetOp>().empty() &&
                    b.getOps<PacketRulesOp>().empty();
     bool isParam = false;
+    bool isPlaced = isa<TileOp>(switchboxOp.getTile().getDefiningOp());
+    llvm::raw_string_ostream colOutput(
+        switchboxConfig[isPlaced ? switchboxOp.colIndex() : -1]);
 
-    if (isa<TileOp>(switchboxOp.getTile().getDefiningOp())) {
+    if (isPlaced) {
       int col = switchboxOp.colIndex();
       int row = switchboxOp.rowIndex();
       if (!isEmpty) {
-        output << "// Core Stream Switch column " << col << " row " << row
-               << "\n";
-        output << "x = " << col << ";\n";
-        output << "y = " << row << ";\n";
+        colOutput << "// Core Stream Switch column " << col << " row " << row
+                  << "\n";
+        colOutput << "x = " << col << ";\n";
+        colOutput << "y = " << row << ";\n";
       }
     } else if (AIEX::SelectOp sel = dyn_cast<AIEX::SelectOp>(
                    switchboxOp.getTile().getDefiningOp())) {
@@ -753,19 +1398,19 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
                          std::to_string(startYValue));
       std::string endY(sourceHerdName + "_Y + " + std::to_string(endYValue));
 
-      output << "for (x = " << startX << "; x < " << endX
-             << "; x += " << strideXValue << ") {\n";
-      output << "for (y = " << startY << "; y < " << endY
-             << "; y += " << strideYValue << ") {\n";
+      colOutput << "for (x = " << startX << "; x < " << endX
+                << "; x += " << strideXValue << ") {\n";
+      colOutput << "for (y = " << startY << "; y < " << endY
+                << "; y += " << strideYValue << ") {\n";
     }
 
     for (auto connectOp : b.getOps<ConnectOp>()) {
-      output << "__mlir_aie_try(XAie_StrmConnCctEnable(" << deviceInstRef
-             << ", " << tileLocStr("x", "y") << ", "
-             << stringifyWireBundle(connectOp.getSourceBundle()).upper() << ", "
-             << connectOp.sourceIndex() << ", "
-             << stringifyWireBundle(connectOp.getDestBundle()).upper() << ", "
-             << connectOp.destIndex() << "));\n";
+      colOutput << "__mlir_aie_try(XAie_StrmConnCctEnable(" << deviceInstRef
+                << ", " << tileLocStr("x", "y") << ", "
+                << stringifyWireBundle(connectOp.getSourceBundle()).upper()
+                << ", " << connectOp.sourceIndex() << ", "
+                << stringifyWireBundle(connectOp.getDestBundle()).upper()
+                << ", " << connectOp.destIndex() << "));\n";
     }
 
     for (auto connectOp : b.getOps<MasterSetOp>()) {
@@ -779,17 +1424,17 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
       }
       bool isdma = (connectOp.getDestBundle() == WireBundle::DMA);
 
-      output << "__mlir_aie_try(XAie_StrmPktSwMstrPortEnable(" << deviceInstRef
-             << ", " << tileLocStr("x", "y") << ", "
-             << stringifyWireBundle(connectOp.getDestBundle()).upper() << ", "
-             << connectOp.destIndex() << ", "
-             << "/* drop_header */ "
-             << (isdma ? "XAIE_SS_PKT_DROP_HEADER"
-                       : "XAIE_SS_PKT_DONOT_DROP_HEADER")
-             << ", "
-             << "/* arbiter */ " << arbiter << ", "
-             << "/* MSelEn */ "
-             << "0x" << llvm::utohexstr(mask) << "));\n";
+      colOutput << "__mlir_aie_try(XAie_StrmPktSwMstrPortEnable("
+                << deviceInstRef << ", " << tileLocStr("x", "y") << ", "
+                << stringifyWireBundle(connectOp.getDestBundle()).upper()
+                << ", " << connectOp.destIndex() << ", "
+                << "/* drop_header */ "
+                << (isdma ? "XAIE_SS_PKT_DROP_HEADER"
+                          : "XAIE_SS_PKT_DONOT_DROP_HEADER")
+                << ", "
+                << "/* arbiter */ " << arbiter << ", "
+                << "/* MSelEn */ "
+                << "0x" << llvm::utohexstr(mask) << "));\n";
     }
 
     for (auto connectOp : b.getOps<PacketRulesOp>()) {
@@ -799,54 +1444,57 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
         AMSelOp amselOp = dyn_cast<AMSelOp>(slotOp.getAmsel().getDefiningOp());
         int arbiter = amselOp.arbiterIndex();
         int msel = amselOp.getMselValue();
-        output << "__mlir_aie_try(XAie_StrmPktSwSlavePortEnable("
-               << deviceInstRef << ", " << tileLocStr("x", "y") << ", "
-               << stringifyWireBundle(connectOp.getSourceBundle()).upper()
-               << ", " << connectOp.sourceIndex() << "));\n";
+        colOutput << "__mlir_aie_try(XAie_StrmPktSwSlavePortEnable("
+                  << deviceInstRef << ", " << tileLocStr("x", "y") << ", "
+                  << stringifyWireBundle(connectOp.getSourceBundle()).upper()
+                  << ", " << connectOp.sourceIndex() << "));\n";
 
         // TODO Need to better define packet id,type used here
-        output << "__mlir_aie_try(XAie_StrmPktSwSlaveSlotEnable("
-               << deviceInstRef << ", " << tileLocStr("x", "y") << ", "
-               << stringifyWireBundle(connectOp.getSourceBundle()).upper()
-               << ", " << connectOp.sourceIndex() << ", "
-               << "/* slot */ " << slot << ", "
-               << "/* packet */ " << packetStr(slotOp.valueInt(), /*type*/ 0)
-               << ", "
-               << "/* mask */ "
-               << "0x" << llvm::utohexstr(slotOp.maskInt()) << ", "
-               << "/* msel */ " << msel << ", "
-               << "/* arbiter */ " << arbiter << "));\n";
+        colOutput << "__mlir_aie_try(XAie_StrmPktSwSlaveSlotEnable("
+                  << deviceInstRef << ", " << tileLocStr("x", "y") << ", "
+                  << stringifyWireBundle(connectOp.getSourceBundle()).upper()
+                  << ", " << connectOp.sourceIndex() << ", "
+                  << "/* slot */ " << slot << ", "
+                  << "/* packet */ " << packetStr(slotOp.valueInt(), /*type*/ 0)
+                  << ", "
+                  << "/* mask */ "
+                  << "0x" << llvm::utohexstr(slotOp.maskInt()) << ", "
+                  << "/* msel */ " << msel << ", "
+                  << "/* arbiter */ " << arbiter << "));\n";
         slot++;
       }
     }
 
     if (isParam) {
-      output << "}\n";
-      output << "}\n";
+      colOutput << "}\n";
+      colOutput << "}\n";
     }
   }
   for (auto op : targetOp.getOps<ShimMuxOp>()) {
     Region &r = op.getConnections();
     Block &b = r.front();
     bool isEmpty = b.getOps<ConnectOp>().empty();
+    bool isPlaced = isa<TileOp>(op.getTile().getDefiningOp());
+    llvm::raw_string_ostream colOutput(
+        switchboxConfig[isPlaced ? op.colIndex() : -1]);
 
-    if (isa<TileOp>(op.getTile().getDefiningOp())) {
+    if (isPlaced) {
       int col = op.colIndex();
       int row = op.rowIndex();
       if (!isEmpty) {
-        output << "// ShimMux column " << col << " row " << row << "\n";
-        output << "// NOTE ShimMux always connects from the south as "
-               << "directions are defined relative to the tile stream "
-               << "switch\n";
-        output << "x = " << col << ";\n";
-        output << "y = " << row << ";\n";
+        colOutput << "// ShimMux column " << col << " row " << row << "\n";
+        colOutput << "// NOTE ShimMux always connects from the south as "
+                  << "directions are defined relative to the tile stream "
+                  << "switch\n";
+        colOutput << "x = " << col << ";\n";
+        colOutput << "y = " << row << ";\n";
       }
     }
 
     for (auto connectOp : b.getOps<ConnectOp>()) {
       if (connectOp.getSourceBundle() == WireBundle::North) {
         // demux!
-        output
+        colOutput
             << "__mlir_aie_try(XAie_EnableAieToShimDmaStrmPort("
             << deviceInstRef << ", " << tileLocStr("x", "y")
             << ", "
@@ -855,7 +1503,7 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
             << connectOp.sourceIndex() << "));\n";
       } else if (connectOp.getDestBundle() == WireBundle::North) {
         // mux
-        output
+        colOutput
             << "__mlir_aie_try(XAie_EnableShimDmaToAieStrmPort("
             << deviceInstRef << ", " << tileLocStr("x", "y")
             << ", "
@@ -870,28 +1518,27 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
     Block &b = r.front();
     bool isEmpty = b.getOps<ConnectOp>().empty();
     int col = switchboxOp.getCol();
+    llvm::raw_string_ostream colOutput(switchboxConfig[col]);
     if (!isEmpty) {
-      output << "// Shim Switch column " << col << "\n";
+      colOutput << "// Shim Switch column " << col << "\n";
     }
     for (auto connectOp : b.getOps<ConnectOp>()) {
-      output << "__mlir_aie_try(XAie_StrmConnCctEnable(" << deviceInstRef
-             << ", " << tileLocStr(col, 0) << ", "
-             << stringifyWireBundle(connectOp.getSourceBundle()).upper() << ", "
-             << connectOp.sourceIndex() << ", "
-             << stringifyWireBundle(connectOp.getDestBundle()).upper() << ", "
-             << connectOp.destIndex() << "));\n";
+      colOutput << "__mlir_aie_try(XAie_StrmConnCctEnable(" << deviceInstRef
+                << ", " << tileLocStr(col, 0) << ", "
+                << stringifyWireBundle(connectOp.getSourceBundle()).upper()
+                << ", " << connectOp.sourceIndex() << ", "
+                << stringifyWireBundle(connectOp.getDestBundle()).upper()
+                << ", " << connectOp.destIndex() << "));\n";
     }
   }
 
-  output << "return XAIE_OK;\n";
-  output << "} // mlir_aie_configure_switchboxes\n\n";
+  emitColumnConfig(output, ctx_p, "switchboxes", switchboxConfig,
+                   "  int x, y;\n");
 
   //---------------------------------------------------------------------------
   // Output Buffer Accessors
   //---------------------------------------------------------------------------
-  for (auto tile : tiles) {
-    Operation *tileOp = tile.second;
-    std::pair<int, int> coord = NL.getCoord(tileOp);
+  for (TileID coord : NL.getIndex().getTileIDs()) {
     int col = coord.first;
     int row = coord.second;
     auto loc = tileLocStr(col, row);
@@ -899,30 +1546,53 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
     auto bufferAccessor = [&](Optional<TileID> tile, BufferOp buf) {
       // int32_t mlir_aie_read_buffer_a13(int index) {
       // void mlir_aie_write_buffer_a13(int index, int32_t value) {
+      // int mlir_aie_read_buffer_a13_block(int offset, void *data, size_t
+      // bytes) {
+      // int mlir_aie_write_buffer_a13_block(int offset, const void *data,
+      // size_t bytes) {
       std::string bufName(buf.name().getValue());
       Type t = buf.getType();
-      Type et;
-      std::string typestr;
-      if (auto memrefType = t.dyn_cast<MemRefType>()) {
-        et = memrefType.getElementType();
-        if (et.isInteger(32))
-          typestr = "int32_t";
-        else if (et.isF32())
-          typestr = "float";
-        else {
-          output << "// buffer " << bufName << " with unsupported type " << t
-                 << ";\n";
-          return; // Unsupported type
-        }
-
-      } else {
+      auto memrefType = t.dyn_cast<MemRefType>();
+      if (!memrefType || !memrefType.hasStaticShape() ||
+          memrefType.getElementTypeBitWidth() % 8 != 0) {
         output << "// buffer " << bufName << " with unsupported type " << t
                << ";\n";
         return; // Unsupported type
       }
+      Type et = memrefType.getElementType();
+      int64_t bytes =
+          memrefType.getNumElements() * memrefType.getElementTypeBitWidth() / 8;
 
       output << "const int " << bufName << "_offset = " << buf.address()
              << ";\n";
+      output << "const int " << bufName << "_size = " << bytes << ";\n";
+
+      // Block accessors, moving any number of bytes of the buffer in bursts,
+      // whatever its element type.
+      output << "int mlir_aie_read_buffer_" << bufName << "_block(" << ctx_p
+             << ", int offset, void *data, size_t bytes) {\n";
+      output << "  if (offset < 0 || offset + bytes > " << bufName
+             << "_size) return XAIE_INVALID_ARGS;\n";
+      output << "  return XAie_DataMemBlockRead(" << deviceInstRef << ", "
+             << loc << ", " << bufName << "_offset + offset, data, bytes);\n";
+      output << "}\n";
+      output << "int mlir_aie_write_buffer_" << bufName << "_block(" << ctx_p
+             << ", int offset, const void *data, size_t bytes) {\n";
+      output << "  if (offset < 0 || offset + bytes > " << bufName
+             << "_size) return XAIE_INVALID_ARGS;\n";
+      output << "  return XAie_DataMemBlockWrite(" << deviceInstRef << ", "
+             << loc << ", " << bufName << "_offset + offset, data, bytes);\n";
+      output << "}\n";
+
+      // Word accessors, for the 32-bit element types.
+      std::string typestr;
+      if (et.isInteger(32))
+        typestr = "int32_t";
+      else if (et.isF32())
+        typestr = "float";
+      else
+        return;
+
       output << typestr << " mlir_aie_read_buffer_" << bufName << "(" << ctx_p
              << ", int index) {\n";
       output << "u32 value; auto rc = XAie_DataMemRdWord(" << deviceInstRef
@@ -951,8 +1621,7 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
       output << "}\n";
     };
 
-    // if(tiles.count(tile.getValue()))
-    for (auto buf : buffers[tileOp])
+    for (auto buf : NL.getBuffers(coord))
       bufferAccessor(coord, buf);
   }
 
@@ -981,6 +1650,133 @@ mlir::LogicalResult AIETranslateToXAIEV2(ModuleOp module, raw_ostream &output) {
   for (auto lock : targetOp.getOps<LockOp>())
     lockAccessor(lock);
 
+  //---------------------------------------------------------------------------
+  // Output Overlay Loaders
+  //---------------------------------------------------------------------------
+  bool overlayHeader = false;
+  for (auto coreOp : targetOp.getOps<CoreOp>()) {
+    auto overlays = coreOp.getOverlays();
+    if (overlays.empty())
+      continue;
+    int col = coreOp.colIndex();
+    int row = coreOp.rowIndex();
+    std::string core = std::to_string(col) + "_" + std::to_string(row);
+    std::string name = "core_" + core + "_overlay";
+    BufferOp buffer;
+    LockOp request, loaded;
+    for (auto buf : targetOp.getOps<BufferOp>())
+      if (buf.hasName() && buf.name().getValue() == name)
+        buffer = buf;
+    for (auto lock : targetOp.getOps<LockOp>()) {
+      if (lock.hasName() && lock.name().getValue() == name + "_request")
+        request = lock;
+      if (lock.hasName() && lock.name().getValue() == name + "_loaded")
+        loaded = lock;
+    }
+    if (!buffer || !request || !loaded)
+      return coreOp.emitOpError("calls overlays without the ")
+             << name << " buffer and locks of aie-insert-overlay-loads";
+
+    if (!overlayHeader) {
+      output << xaie_c_overlay_header;
+      overlayHeader = true;
+    }
+    uint32_t size = coreOp.getOverlaySize();
+    uint32_t base = target_model.getProgramMemorySize() - size;
+    std::string known;
+    for (auto &overlay : overlays)
+      known += (known.empty() ? "overlay == " : " || overlay == ") +
+               std::to_string(overlay.first);
+    std::string loc = tileLocStr(col, row);
+    output << "// Serve the next overlay request of core (" << col << ", "
+           << row << "): load the overlay in its\n"
+           << "// program memory and let the core go on. Return the overlay, "
+              "or -1 if no\n"
+           << "// request came within timeoutUs or it cannot be loaded.\n";
+    output << "int mlir_aie_serve_overlay_" << core << "(" << ctx_p
+           << ", int timeoutUs) {\n";
+    output << "  if (XAie_LockAcquire(" << deviceInstRef << ", " << loc
+           << ", "
+           << tileLockStr(std::to_string(request.getLockIDValue()), "1")
+           << ", timeoutUs) != XAIE_OK)\n"
+           << "    return -1;\n";
+    output << "  u32 overlay;\n"
+           << "  if (XAie_DataMemRdWord(" << deviceInstRef << ", " << loc
+           << ", " << buffer.address() << ", &overlay) != XAIE_OK)\n"
+           << "    return -1;\n";
+    output << "  if (!(" << known << "))\n"
+           << "    return -1;\n";
+    output << "  char fileName[64];\n"
+           << "  snprintf(fileName, sizeof(fileName), \"core_" << core
+           << ".overlay%u.bin\", overlay);\n";
+    output << "  if (__mlir_aie_load_overlay(" << deviceInstRef << ", " << loc
+           << ", fileName, 0x" << llvm::utohexstr(base) << ", 0x"
+           << llvm::utohexstr(size) << ") != XAIE_OK)\n"
+           << "    return -1;\n";
+    // An AIE1 lock is released with the value it is acquired with next.
+    if (target_model.getTargetArch() == AIEArch::AIE1)
+      output << "  XAie_LockRelease(" << deviceInstRef << ", " << loc << ", "
+             << tileLockStr(std::to_string(request.getLockIDValue()), "0")
+             << ", 0);\n";
+    output << "  XAie_LockRelease(" << deviceInstRef << ", " << loc << ", "
+           << tileLockStr(std::to_string(loaded.getLockIDValue()), "1")
+           << ", 0);\n";
+    output << "  return overlay;\n";
+    output << "}\n";
+  }
+
+  //---------------------------------------------------------------------------
+  // Output Runtime Parameter Setters
+  //---------------------------------------------------------------------------
+  bool rtpHeader = false;
+  llvm::StringMap<BufferOp> namedBuffers;
+  for (auto buf : targetOp.getOps<BufferOp>())
+    if (buf.hasName())
+      namedBuffers[buf.name().getValue()] = buf;
+  for (auto rtp : targetOp.getOps<RtpOp>()) {
+    std::string name(rtp.getSymName());
+    SmallVector<BufferOp, 4> block;
+    for (const char *suffix : {"_0", "_1", "_version", "_ack"}) {
+      auto buf = namedBuffers.lookup(name + suffix);
+      if (!buf)
+        return rtp.emitOpError("has no ")
+               << name << suffix << " buffer, run aie-lower-rtps";
+      block.push_back(buf);
+    }
+
+    if (!rtpHeader) {
+      output << xaie_c_rtp_header;
+      rtpHeader = true;
+    }
+    auto type = rtp.getElemType().cast<MemRefType>();
+    int64_t bytes = type.getNumElements() * type.getElementTypeBitWidth() / 8;
+    std::string loc = tileLocStr(rtp.getTileOp().colIndex(),
+                                 rtp.getTileOp().rowIndex());
+    output << "// Set the " << bytes << " bytes of values of " << name
+           << " before the cores start.\n";
+    output << "int mlir_aie_init_rtp_" << name << "(" << ctx_p
+           << ", const void *values) {\n";
+    for (int copy = 0; copy < 2; copy++)
+      output << "  __mlir_aie_try(XAie_DataMemBlockWrite(" << deviceInstRef
+             << ", " << loc << ", " << block[copy].address() << ", values, "
+             << bytes << "));\n";
+    output << "  __mlir_aie_try(XAie_DataMemWrWord(" << deviceInstRef << ", "
+           << loc << ", " << block[2].address() << ", 0));\n";
+    output << "  return XAie_DataMemWrWord(" << deviceInstRef << ", " << loc
+           << ", " << block[3].address() << ", 0);\n";
+    output << "}\n";
+    output << "// Publish " << bytes << " bytes of new values of " << name
+           << " to the running core, once it picked up\n"
+           << "// the previous ones, waiting for it up to timeoutUs.\n";
+    output << "int mlir_aie_write_rtp_" << name << "(" << ctx_p
+           << ", const void *values, int timeoutUs) {\n";
+    output << "  return __mlir_aie_write_rtp(" << deviceInstRef << ", " << loc
+           << ", " << block[0].address() << ", " << block[1].address()
+           << ", " << block[2].address() << ", " << block[3].address()
+           << ", values, " << bytes << ", timeoutUs);\n";
+    output << "}\n";
+  }
+
   return success();
 }
 } // namespace AIE
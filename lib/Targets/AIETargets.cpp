@@ -8,7 +8,7 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "AIETargets.h"
+#include "aie/Targets/AIETargets.h"
 
 #include "mlir/Dialect/ControlFlow/IR/ControlFlow.h"
 #include "mlir/Dialect/DLTI/DLTI.h"
@@ -16,10 +16,15 @@
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/IR/Attributes.h"
+#include "mlir/IR/Diagnostics.h"
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/Location.h"
 #include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/Threading.h"
+#include "mlir/Parser/Parser.h"
 #include "mlir/Pass/Pass.h"
+#include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
+#include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Export.h"
 #include "mlir/Target/LLVMIR/Import.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
@@ -28,12 +33,15 @@
 #include "mlir/Transforms/Passes.h"
 
 #include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/JSON.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/TargetSelect.h"
 
 #include "aie/Dialect/ADF/ADFDialect.h"
 #include "aie/Dialect/AIE/AIENetlistAnalysis.h"
 #include "aie/Dialect/AIE/IR/AIEDialect.h"
+#include "aie/Dialect/AIEVec/IR/AIEVecDialect.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Vector/IR/VectorOps.h"
 
@@ -48,6 +56,70 @@ static llvm::cl::opt<int>
 static llvm::cl::opt<int>
     tileRow("tilerow", llvm::cl::desc("row coordinate of core to translate"),
             llvm::cl::init(0));
+static llvm::cl::opt<std::string>
+    outputDir("aie-output-dir",
+              llvm::cl::desc("directory aie-generate-all writes its files to"),
+              llvm::cl::init(""));
+static llvm::cl::opt<std::string> txnBase(
+    "txn-base",
+    llvm::cl::desc("design the configuration of aie-generate-txn-delta and "
+                   "aie-generate-ctrlpkt starts from"),
+    llvm::cl::init(""));
+static llvm::cl::opt<std::string> chessIntrinsicWrapper(
+    "chess-intrinsic-wrapper",
+    llvm::cl::desc("LLVM IR file aie-generate-chess-llvmir links the cores "
+                   "with"),
+    llvm::cl::init(""));
+static llvm::cl::opt<bool> airbinCompress(
+    "airbin-compress",
+    llvm::cl::desc("run-length encode the sections of the airbin output"),
+    llvm::cl::init(false));
+static llvm::cl::opt<bool> minimalWrites(
+    "aie-minimal-writes",
+    llvm::cl::desc("only configure what differs from the reset state of the "
+                   "device: aie-generate-txn writes the words that are not 0, "
+                   "as block writes, and aie-generate-xaie releases the locks "
+                   "the design uses only"),
+    llvm::cl::init(false));
+static llvm::cl::opt<int> deviceIndex(
+    "aie-device",
+    llvm::cl::desc("index of the AIE.device of the module to translate, by "
+                   "default the first one, or all of them in subdirectories "
+                   "device<N> of --aie-output-dir for aie-generate-all"),
+    llvm::cl::init(-1));
+
+// Erase the devices of module other than the one of the given index, in the
+// order of the module, so that the translations of the first device of the
+// module translate that one.
+static LogicalResult selectDevice(ModuleOp module, int index) {
+  auto devices = llvm::to_vector(module.getOps<DeviceOp>());
+  if (index >= static_cast<int>(devices.size()))
+    return module.emitOpError("has no AIE.device of index ")
+           << index << ", it has " << devices.size();
+  for (auto [i, device] : llvm::enumerate(devices))
+    if (static_cast<int>(i) != index)
+      device.erase();
+  return success();
+}
+
+// Select the device of --aie-device in the design of --txn-base, which the
+// device of the module reconfigures.
+static LogicalResult selectBaseDevice(ModuleOp base) {
+  if (deviceIndex < 0)
+    return success();
+  return selectDevice(base, deviceIndex);
+}
+
+// Wrap translate, which translates the first device of a module, into the
+// translation of the device of --aie-device.
+template <typename TranslateFn>
+static auto onSelectedDevice(TranslateFn translate) {
+  return [translate](ModuleOp module, raw_ostream &output) -> LogicalResult {
+    if (deviceIndex >= 0 && failed(selectDevice(module, deviceIndex)))
+      return failure();
+    return translate(module, output);
+  };
+}
 
 llvm::json::Value attrToJSON(Attribute &attr) {
   if (auto a = attr.dyn_cast<StringAttr>()) {
@@ -86,6 +158,7 @@ static void registerDialects(DialectRegistry &registry) {
   registry.insert<VectorDialect>();
   registry.insert<LLVM::LLVMDialect>();
   registry.insert<emitc::EmitCDialect>();
+  registry.insert<xilinx::aievec::AIEVecDialect>();
 }
 
 // Output the buffer map for the given buffer operations, with the given offset.
@@ -99,6 +172,12 @@ void writeBufferMap(raw_ostream &output, BufferOp buf, int offset,
          << "0x" << llvm::utohexstr(offset + bufferBaseAddr) << " " << numBytes
          << '\n';
 }
+// Return the name of the data memory bank in the chess storage of the kernels,
+// as printed by aievec-to-cpp for the arguments with an AIE.bank attribute.
+static std::string getBankName(int64_t bank) {
+  return std::string("DM_bank") + char('A' + bank);
+}
+
 // Output the memorymap in BCF format for the given buffer operations, with the
 // given offset. The offset is different depending on where the buffers are
 // accessed from.
@@ -109,7 +188,10 @@ void writeBCFMap(raw_ostream &output, BufferOp buf, int offset,
   int numBytes = buf.getAllocationSize();
   output << "_symbol " << bufName << " "
          << "0x" << llvm::utohexstr(offset + bufferBaseAddr) << " "
-         << "0x" << llvm::utohexstr(numBytes) << '\n';
+         << "0x" << llvm::utohexstr(numBytes);
+  if (auto bank = buf.getBank())
+    output << " // " << getBankName(*bank);
+  output << '\n';
   output << "_extern " << bufName << "\n";
   output << "_reserved DMb "
          << "0x" << llvm::utohexstr(offset + bufferBaseAddr) << " "
@@ -124,34 +206,381 @@ void writeLDScriptMap(raw_ostream &output, BufferOp buf, int offset,
   int bufferBaseAddr = NL.getBufferBaseAddress(buf);
   int numBytes = buf.getAllocationSize();
   output << ". = 0x" << llvm::utohexstr(offset + bufferBaseAddr) << ";\n";
-  output << bufName << " = .;\n";
+  output << bufName << " = .;";
+  if (auto bank = buf.getBank())
+    output << " /* " << getBankName(*bank) << " */";
+  output << "\n";
   output << ". += 0x" << llvm::utohexstr(numBytes) << ";\n";
 }
 
+// The load address of the overlays in the ELF files of the cores, which no
+// memory of a tile is mapped at.
+static const uint32_t OVERLAY_LOAD_ADDRESS = 0x100000;
+
+// Output the gnu linker script of the core of the given tile.
+static void writeLDScript(raw_ostream &output, TileOp tile,
+                          NetlistAnalysis &NL) {
+  auto srcCoord = std::make_pair(tile.colIndex(), tile.rowIndex());
+  const auto &target_model = getTargetModel(tile);
+
+  // Figure out how much memory we have left for random allocations
+  auto core = tile.getCoreOp();
+  int max = core.getStackSize();
+  for (auto buf : NL.getBuffers(srcCoord)) {
+    int bufferBaseAddr = NL.getBufferBaseAddress(buf);
+    int numBytes = buf.getAllocationSize();
+    max = std::max(max, bufferBaseAddr + numBytes);
+  }
+  int origin = target_model.getMemInternalBaseAddress(srcCoord) + max;
+  int length = target_model.getLocalMemorySize() - max;
+  // The overlays share a window at the top of program memory, below which
+  // the rest of the code of the core has to fit.
+  auto overlays = core.getOverlays();
+  uint32_t overlayBase =
+      target_model.getProgramMemorySize() - core.getOverlaySize();
+  // output << "// Tile(" << tileCol << ", " << tileRow << ")\n";
+  // output << "// Memory map: name base_address num_bytes\n";
+  output << "\nMEMORY\n{\n";
+  if (overlays.empty()) {
+    output << "   program (RX) : ORIGIN = 0, LENGTH = 0x0020000\n";
+  } else {
+    output << "   program (RX) : ORIGIN = 0, LENGTH = 0x"
+           << llvm::utohexstr(overlayBase) << "\n";
+    output << "   overlay (RX) : ORIGIN = 0x" << llvm::utohexstr(overlayBase)
+           << ", LENGTH = 0x" << llvm::utohexstr(core.getOverlaySize())
+           << "\n";
+  }
+  output << "   data (!RX) : ORIGIN = 0x" << llvm::utohexstr(origin)
+         << ", LENGTH = 0x" << llvm::utohexstr(length);
+  output << R"THESCRIPT(
+}
+ENTRY(_main_init)
+SECTIONS
+{
+  . = 0x0;
+  .text : { 
+     /* the _main_init symbol of me_basic.o, or of me_basic_minimal.o, has to
+        come at address zero. */
+     *me_basic*.o(.text)
+     . = 0x200;
+     _ctors_start = .;
+     _init_array_start = .;
+     KEEP(SORT(*.init_array))
+     _ctors_end = .;
+     _init_array_end = .;
+     _dtors_start = .;
+     _dtors_end = .;
+     *(.text)
+  } > program
+)THESCRIPT";
+  // Each overlay is linked in the window, and given a load address past the
+  // memories of the tile. aiecc.py moves the overlays out of the ELF of the
+  // core, to files the host loads them from on request.
+  if (!overlays.empty()) {
+    output << "  OVERLAY 0x" << llvm::utohexstr(overlayBase)
+           << " : AT (0x" << llvm::utohexstr(OVERLAY_LOAD_ADDRESS) << ")\n";
+    output << "  {\n";
+    for (auto &[overlay, funcs] : overlays) {
+      output << "    .overlay" << overlay << " {";
+      for (auto func : funcs)
+        output << " *(.text." << func.getSymName() << ")";
+      output << " }\n";
+    }
+    output << "  } > overlay\n";
+  }
+  output << R"THESCRIPT(  .data : { 
+     *(.data*);
+     *(.rodata*)
+  } > data
+)THESCRIPT";
+  auto doBuffer = [&](Optional<TileID> tile, int offset, std::string dir) {
+    if (tile) {
+      for (auto buf : NL.getBuffers(*tile))
+        writeLDScriptMap(output, buf, offset, NL);
+    } else {
+      output << "/* No tile with memory exists to the " << dir << ". */\n";
+      output << ". = 0x" << llvm::utohexstr(offset) << ";\n";
+      uint32_t localMemSize = target_model.getLocalMemorySize();
+      output << ". += 0x" << llvm::utohexstr(localMemSize) << ";\n";
+    }
+  };
+
+  // Stack
+  output << ". = 0x"
+         << llvm::utohexstr(target_model.getMemInternalBaseAddress(srcCoord))
+         << ";\n";
+  output << "_sp_start_value_DM_stack = .;\n";
+
+  if (auto core = tile.getCoreOp())
+    output << ". += 0x" << llvm::utohexstr(core.getStackSize())
+           << "; /* stack */\n";
+  else
+    output << "/* no stack allocated */\n";
+
+  doBuffer(target_model.getMemSouth(srcCoord),
+           target_model.getMemSouthBaseAddress(), std::string("south"));
+  doBuffer(target_model.getMemWest(srcCoord),
+           target_model.getMemWestBaseAddress(), std::string("west"));
+  doBuffer(target_model.getMemNorth(srcCoord),
+           target_model.getMemNorthBaseAddress(), std::string("north"));
+  doBuffer(target_model.getMemEast(srcCoord),
+           target_model.getMemEastBaseAddress(), std::string("east"));
+
+  output << "  .bss : { *(.bss) } > data\n";
+  output << "  .bss.DMb.4 : { *(.bss.DMb.4) } > data\n";
+  output << "}\n";
+  if (auto coreOp = tile.getCoreOp()) {
+    if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("link_with")) {
+      auto fileName = std::string(fileAttr.getValue());
+      output << "INPUT(" << fileName << ")\n";
+    }
+    output << "PROVIDE(_main = core_" << tile.getCol() << "_"
+           << tile.getRow() << ");\n";
+  }
+}
+
+// Output the BCF file of the core of the given tile.
+static void writeBCF(raw_ostream &output, TileOp tile, NetlistAnalysis &NL) {
+  const auto &target_model = getTargetModel(tile);
+
+  std::string corefunc = std::string("core_") + std::to_string(tile.getCol()) +
+                         "_" + std::to_string(tile.getRow());
+  output << "_entry_point _main_init\n";
+  output << "_symbol " << corefunc << " _after _main_init\n";
+  output << "_symbol      _main_init 0\n";
+  std::string initReserved =
+      (target_model.getTargetArch() == AIEArch::AIE2) ? "0x40000" : "0x20000";
+  output << "_reserved DMb      0x00000 " << initReserved
+         << " //Don't put data in code memory\n";
+
+  auto srcCoord = std::make_pair(tile.colIndex(), tile.rowIndex());
+  auto doBuffer = [&](Optional<TileID> tile, int offset, std::string dir) {
+    if (tile) {
+      for (auto buf : NL.getBuffers(*tile))
+        writeBCFMap(output, buf, offset, NL);
+      uint32_t localMemSize = target_model.getLocalMemorySize();
+      if (tile != srcCoord)
+        output << "_reserved DMb 0x" << llvm::utohexstr(offset) << " "
+               << "0x" << llvm::utohexstr(localMemSize) << " "
+               << " // Don't allocate variables outside of local memory.\n";
+      // TODO How to set as reserved if no buffer exists (or reserve remaining
+      // buffer)
+    } else {
+      uint32_t localMemSize = target_model.getLocalMemorySize();
+      output << "_reserved DMb 0x" << llvm::utohexstr(offset) << " "
+             << "0x" << llvm::utohexstr(localMemSize) << " "
+             << " // No tile with memory exists to the " << dir << ".\n";
+    }
+  };
+
+  doBuffer(target_model.getMemSouth(srcCoord),
+           target_model.getMemSouthBaseAddress(), std::string("south"));
+  doBuffer(target_model.getMemWest(srcCoord),
+           target_model.getMemWestBaseAddress(), std::string("west"));
+  doBuffer(target_model.getMemNorth(srcCoord),
+           target_model.getMemNorthBaseAddress(), std::string("north"));
+  doBuffer(target_model.getMemEast(srcCoord),
+           target_model.getMemEastBaseAddress(), std::string("east"));
+
+  int stacksize = 0;
+  if (auto core = tile.getCoreOp())
+    stacksize = core.getStackSize();
+  output << "_stack    DM_stack 0x"
+         << llvm::utohexstr(target_model.getMemInternalBaseAddress(srcCoord))
+         << "  0x" << llvm::utohexstr(stacksize) << " //stack for core\n";
+
+  if (target_model.getTargetArch() == AIEArch::AIE2) {
+    output << "_reserved DMb 0x80000 0x80000 // And everything else "
+              "the core can't see\n";
+  } else {
+    output << "_reserved DMb 0x40000 0xc0000 // And everything else "
+              "the core can't see\n";
+  }
+  if (auto coreOp = tile.getCoreOp()) {
+    if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("link_with")) {
+      auto fileName = std::string(fileAttr.getValue());
+      output << "_include _file " << fileName << "\n";
+    }
+  }
+  output << "_resolve _main core_" << tile.getCol() << "_" << tile.getRow()
+         << "\n";
+}
+
+// Output the python list of the cores of the device, with their ELF files.
+static void writeCoreList(raw_ostream &output, DeviceOp targetOp) {
+  output << "[";
+  for (auto tileOp : targetOp.getOps<TileOp>()) {
+    int col = tileOp.colIndex();
+    int row = tileOp.rowIndex();
+    if (auto coreOp = tileOp.getCoreOp()) {
+      std::string elf_file = "None";
+      if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("elf_file"))
+        elf_file = "\"" + std::string(fileAttr.getValue()) + "\"";
+      output << '(' << std::to_string(col) << ',' << std::to_string(row)
+             << ',' << elf_file << "),";
+    }
+  }
+  output << "]\n";
+}
+
+// Output the architecture of the first device of the module.
+static void writeTargetArch(raw_ostream &output, ModuleOp module) {
+  AIEArch arch = AIEArch::AIE1;
+  if (!module.getOps<DeviceOp>().empty()) {
+    DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
+    arch = targetOp.getTargetModel().getTargetArch();
+  }
+  if (arch == AIEArch::AIE1)
+    output << "AIE\n";
+  else
+    output << stringifyEnum(arch) << "\n";
+}
+
+// Output the shim DMA allocations of the devices of the module as JSON.
+static void writeShimDMAJSON(raw_ostream &output, ModuleOp module) {
+  for (auto d : module.getOps<DeviceOp>()) {
+    llvm::json::Object moduleJSON;
+    for (auto shimDMA_meta : d.getOps<ShimDMAAllocationOp>()) {
+      llvm::json::Object shimJSON;
+      auto channelDir = shimDMA_meta.getChannelDirAttr();
+      shimJSON["channelDir"] = attrToJSON(channelDir);
+      auto channelIndex = shimDMA_meta.getChannelIndexAttr();
+      shimJSON["channelIndex"] = attrToJSON(channelIndex);
+      auto col = shimDMA_meta.getColAttr();
+      shimJSON["col"] = attrToJSON(col);
+      moduleJSON[shimDMA_meta.getSymName()] =
+          llvm::json::Value(std::move(shimJSON));
+    }
+    llvm::json::Value topv(std::move(moduleJSON));
+    std::string ret;
+    llvm::raw_string_ostream ss(ret);
+    ss << llvm::formatv("{0:2}", topv) << "\n";
+    output << ss.str();
+  }
+}
+
+// Write the linker script and the BCF file of every core, the core list, the
+// target architecture and the shim DMA allocations of the first device of
+// module in the directory dir, from a single netlist analysis of the device,
+// shared by all the files. The paths of the files are listed in the output.
+static LogicalResult writeDeviceFiles(ModuleOp module, StringRef dir,
+                                      raw_ostream &output) {
+  if (std::error_code ec = llvm::sys::fs::create_directories(dir))
+    return module.emitOpError("cannot create '")
+           << dir << "': " << ec.message();
+  DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
+
+  NetlistAnalysis NL(targetOp);
+
+  auto writeFile = [&](const Twine &name,
+                       llvm::function_ref<void(raw_ostream &)> write)
+      -> LogicalResult {
+    SmallString<128> path(dir);
+    llvm::sys::path::append(path, name);
+    std::error_code ec;
+    llvm::raw_fd_ostream file(path, ec);
+    if (ec)
+      return module.emitOpError("cannot write '")
+             << path << "': " << ec.message();
+    write(file);
+    output << path << "\n";
+    return success();
+  };
+
+  if (failed(writeFile("corelist", [&](raw_ostream &file) {
+        writeCoreList(file, targetOp);
+      })) ||
+      failed(writeFile("target_arch", [&](raw_ostream &file) {
+        writeTargetArch(file, module);
+      })) ||
+      failed(writeFile("shim_dma.json", [&](raw_ostream &file) {
+        writeShimDMAJSON(file, module);
+      })) ||
+      failed(writeFile("symbols.json", [&](raw_ostream &file) {
+        (void)AIESymbolTable(module, file);
+      })))
+    return failure();
+
+  for (auto tile : targetOp.getOps<TileOp>()) {
+    if (!tile.getCoreOp())
+      continue;
+    std::string core = "core_" + std::to_string(tile.colIndex()) + "_" +
+                       std::to_string(tile.rowIndex());
+    if (failed(writeFile(core + ".ld.script", [&](raw_ostream &file) {
+          writeLDScript(file, tile, NL);
+        })) ||
+        failed(writeFile(core + ".bcf", [&](raw_ostream &file) {
+          writeBCF(file, tile, NL);
+        })))
+      return failure();
+  }
+  return success();
+}
+
+// Write the files of aie-generate-all in the --aie-output-dir directory, from
+// a single parse of the module. The files of the devices of a module with
+// several devices are written in parallel, in the subdirectory device<N> of
+// each one, unless --aie-device selects one of them.
+static LogicalResult AIETranslateToAll(ModuleOp module, raw_ostream &output) {
+  if (module.getOps<DeviceOp>().empty())
+    return module.emitOpError("expected AIE.device operation at toplevel");
+  if (outputDir.empty())
+    return module.emitOpError(
+        "aie-generate-all needs an output directory in --aie-output-dir");
+  size_t numDevices = llvm::range_size(module.getOps<DeviceOp>());
+  if (deviceIndex >= 0 || numDevices == 1) {
+    if (deviceIndex >= 0 && failed(selectDevice(module, deviceIndex)))
+      return failure();
+    return writeDeviceFiles(module, outputDir, output);
+  }
+
+  // The devices are independent: each one is written from a copy of the
+  // module that only holds it.
+  SmallVector<OwningOpRef<ModuleOp>> modules;
+  for (size_t i = 0; i < numDevices; i++) {
+    modules.emplace_back(module.clone());
+    if (failed(selectDevice(*modules.back(), i)))
+      return failure();
+  }
+  MLIRContext *context = module.getContext();
+  SmallVector<std::string> outputs(numDevices);
+  ParallelDiagnosticHandler handler(context);
+  LogicalResult result =
+      failableParallelForEachN(context, 0, numDevices, [&](size_t i) {
+        handler.setOrderIDForThread(i);
+        SmallString<128> dir(outputDir);
+        llvm::sys::path::append(dir, "device" + Twine(i));
+        llvm::raw_string_ostream deviceOutput(outputs[i]);
+        LogicalResult written =
+            writeDeviceFiles(*modules[i], dir, deviceOutput);
+        handler.eraseOrderIDForThread();
+        return written;
+      });
+  for (const std::string &deviceOutput : outputs)
+    output << deviceOutput;
+  return result;
+}
+
 void registerAIETranslations() {
+  TranslateFromMLIRRegistration registrationAll(
+      "aie-generate-all",
+      "Generate the linker scripts, BCF files, core list, target architecture, "
+      "shim DMA allocations and symbol table of the module in "
+      "--aie-output-dir",
+      AIETranslateToAll, registerDialects);
+
   TranslateFromMLIRRegistration registrationMMap(
       "aie-generate-mmap", "Generate AIE memory map",
-      [](ModuleOp module, raw_ostream &output) {
-        DenseMap<std::pair<int, int>, Operation *> tiles;
-        DenseMap<Operation *, CoreOp> cores;
-        DenseMap<Operation *, MemOp> mems;
-        DenseMap<std::pair<Operation *, int>, LockOp> locks;
-        DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
-        DenseMap<Operation *, SwitchboxOp> switchboxes;
-
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
         if (module.getOps<DeviceOp>().empty()) {
           module.emitOpError("expected AIE.device operation at toplevel");
         }
         DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
 
-        NetlistAnalysis NL(targetOp, tiles, cores, mems, locks, buffers,
-                           switchboxes);
-        NL.collectTiles(tiles);
-        NL.collectBuffers(buffers);
+        NetlistAnalysis NL(targetOp);
 
-        for (auto tile : tiles) {
-          Operation *srcTileOp = tile.second;
-          std::pair<int, int> srcCoord = NL.getCoord(srcTileOp);
+        const auto &target_model = targetOp.getTargetModel();
+        for (TileID srcCoord : NL.getIndex().getTileIDs()) {
           int srcCol = srcCoord.first;
           int srcRow = srcCoord.second;
 
@@ -159,13 +588,10 @@ void registerAIETranslations() {
           output << "// Memory map: name base_address num_bytes\n";
 
           auto doBuffer = [&](Optional<TileID> tile, int offset) {
-            if (tiles.count(*tile))
-              for (auto buf : buffers[tiles[*tile]])
-                writeBufferMap(output, buf, offset, NL);
+            for (auto buf : NL.getBuffers(*tile))
+              writeBufferMap(output, buf, offset, NL);
           };
 
-          const auto &target_model = xilinx::AIE::getTargetModel(srcTileOp);
-
           if (auto tile = target_model.getMemSouth(srcCoord))
             doBuffer(tile, target_model.getMemSouthBaseAddress());
           if (auto tile = target_model.getMemWest(srcCoord))
@@ -176,33 +602,33 @@ void registerAIETranslations() {
             doBuffer(tile, target_model.getMemEastBaseAddress());
         }
         return success();
-      },
+      }),
       registerDialects);
 
+  TranslateFromMLIRRegistration registrationBufferReport(
+      "aie-generate-buffer-report",
+      "Report the buffer placement, fragmentation and bank conflicts of each "
+      "tile as JSON",
+      onSelectedDevice(AIEBufferReport), registerDialects);
+
+  TranslateFromMLIRRegistration registrationPerformanceEstimate(
+      "aie-estimate-performance",
+      "Estimate the steady-state cycles of each stage of the dataflow of the "
+      "objectFifos of each device, and its bottleneck, as JSON",
+      onSelectedDevice(AIEEstimatePerformance), registerDialects);
+
+  TranslateFromMLIRRegistration registrationSymbolTable(
+      "aie-generate-symbol-table",
+      "Generate the physical addresses of the buffers and the IDs of the "
+      "locks of each device as JSON",
+      onSelectedDevice(AIESymbolTable), registerDialects);
+
   TranslateFromMLIRRegistration registrationShimDMAToJSON(
       "aie-generate-json", "Transform AIE shim DMA allocation info into JSON",
-      [](ModuleOp module, raw_ostream &output) {
-        for (auto d : module.getOps<DeviceOp>()) {
-          llvm::json::Object moduleJSON;
-          for (auto shimDMA_meta : d.getOps<ShimDMAAllocationOp>()) {
-            llvm::json::Object shimJSON;
-            auto channelDir = shimDMA_meta.getChannelDirAttr();
-            shimJSON["channelDir"] = attrToJSON(channelDir);
-            auto channelIndex = shimDMA_meta.getChannelIndexAttr();
-            shimJSON["channelIndex"] = attrToJSON(channelIndex);
-            auto col = shimDMA_meta.getColAttr();
-            shimJSON["col"] = attrToJSON(col);
-            moduleJSON[shimDMA_meta.getSymName()] =
-                llvm::json::Value(std::move(shimJSON));
-          }
-          llvm::json::Value topv(std::move(moduleJSON));
-          std::string ret;
-          llvm::raw_string_ostream ss(ret);
-          ss << llvm::formatv("{0:2}", topv) << "\n";
-          output << ss.str();
-        }
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        writeShimDMAJSON(output, module);
         return success();
-      },
+      }),
       registerDialects);
 
   ///// ld.script format:
@@ -219,7 +645,7 @@ void registerAIETranslations() {
   //   . = 0x0;
   //   .text : {
   //      // the _main_init symbol from me_basic.o has to come at address zero.
-  //      *me_basic.o(.text)
+  //      *me_basic*.o(.text)
   //      . = 0x200;
   //      __ctors_start__ = .;
   //      __init_array_start = .;
@@ -241,126 +667,19 @@ void registerAIETranslations() {
 
   TranslateFromMLIRRegistration registrationLDScript(
       "aie-generate-ldscript", "Generate AIE loader script",
-      [](ModuleOp module, raw_ostream &output) {
-        DenseMap<std::pair<int, int>, Operation *> tiles;
-        DenseMap<Operation *, CoreOp> cores;
-        DenseMap<Operation *, MemOp> mems;
-        DenseMap<std::pair<Operation *, int>, LockOp> locks;
-        DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
-        DenseMap<Operation *, SwitchboxOp> switchboxes;
-
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
         if (module.getOps<DeviceOp>().empty()) {
           module.emitOpError("expected AIE.device operation at toplevel");
         }
         DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
 
-        NetlistAnalysis NL(targetOp, tiles, cores, mems, locks, buffers,
-                           switchboxes);
-        NL.collectTiles(tiles);
-        NL.collectBuffers(buffers);
+        NetlistAnalysis NL(targetOp);
 
         for (auto tile : targetOp.getOps<TileOp>())
-          if (tile.colIndex() == tileCol && tile.rowIndex() == tileRow) {
-            auto srcCoord = std::make_pair(tile.colIndex(), tile.rowIndex());
-            const auto &target_model = getTargetModel(tile);
-
-            // Figure out how much memory we have left for random allocations
-            auto core = tile.getCoreOp();
-            int max = core.getStackSize();
-            for (auto buf : buffers[tiles[srcCoord]]) {
-              int bufferBaseAddr = NL.getBufferBaseAddress(buf);
-              int numBytes = buf.getAllocationSize();
-              max = std::max(max, bufferBaseAddr + numBytes);
-            }
-            int origin = target_model.getMemInternalBaseAddress(srcCoord) + max;
-            int length = target_model.getLocalMemorySize() - max;
-            // output << "// Tile(" << tileCol << ", " << tileRow << ")\n";
-            // output << "// Memory map: name base_address num_bytes\n";
-            output << R"THESCRIPT(
-MEMORY
-{
-   program (RX) : ORIGIN = 0, LENGTH = 0x0020000
-)THESCRIPT";
-            output << "   data (!RX) : ORIGIN = 0x" << llvm::utohexstr(origin)
-                   << ", LENGTH = 0x" << llvm::utohexstr(length);
-            output << R"THESCRIPT(
-}
-ENTRY(_main_init)
-SECTIONS
-{
-  . = 0x0;
-  .text : { 
-     /* the _main_init symbol from me_basic.o has to come at address zero. */
-     *me_basic.o(.text)
-     . = 0x200;
-     _ctors_start = .;
-     _init_array_start = .;
-     KEEP(SORT(*.init_array))
-     _ctors_end = .;
-     _init_array_end = .;
-     _dtors_start = .;
-     _dtors_end = .;
-     *(.text)
-  } > program
-  .data : { 
-     *(.data*);
-     *(.rodata*)
-  } > data
-)THESCRIPT";
-            auto doBuffer = [&](Optional<TileID> tile, int offset,
-                                std::string dir) {
-              if (tile) {
-                if (tiles.count(*tile))
-                  for (auto buf : buffers[tiles[*tile]])
-                    writeLDScriptMap(output, buf, offset, NL);
-              } else {
-                output << "/* No tile with memory exists to the " << dir
-                       << ". */\n";
-                output << ". = 0x" << llvm::utohexstr(offset) << ";\n";
-                uint32_t localMemSize = target_model.getLocalMemorySize();
-                output << ". += 0x" << llvm::utohexstr(localMemSize) << ";\n";
-              }
-            };
-
-            // Stack
-            output << ". = 0x"
-                   << llvm::utohexstr(
-                          target_model.getMemInternalBaseAddress(srcCoord))
-                   << ";\n";
-            output << "_sp_start_value_DM_stack = .;\n";
-
-            if (auto core = tile.getCoreOp())
-              output << ". += 0x" << llvm::utohexstr(core.getStackSize())
-                     << "; /* stack */\n";
-            else
-              output << "/* no stack allocated */\n";
-
-            doBuffer(target_model.getMemSouth(srcCoord),
-                     target_model.getMemSouthBaseAddress(),
-                     std::string("south"));
-            doBuffer(target_model.getMemWest(srcCoord),
-                     target_model.getMemWestBaseAddress(), std::string("west"));
-            doBuffer(target_model.getMemNorth(srcCoord),
-                     target_model.getMemNorthBaseAddress(),
-                     std::string("north"));
-            doBuffer(target_model.getMemEast(srcCoord),
-                     target_model.getMemEastBaseAddress(), std::string("east"));
-
-            output << "  .bss : { *(.bss) } > data\n";
-            output << "  .bss.DMb.4 : { *(.bss.DMb.4) } > data\n";
-            output << "}\n";
-            if (auto coreOp = tile.getCoreOp()) {
-              if (auto fileAttr =
-                      coreOp->getAttrOfType<StringAttr>("link_with")) {
-                auto fileName = std::string(fileAttr.getValue());
-                output << "INPUT(" << fileName << ")\n";
-              }
-              output << "PROVIDE(_main = core_" << tile.getCol() << "_"
-                     << tile.getRow() << ");\n";
-            }
-          }
+          if (tile.colIndex() == tileCol && tile.rowIndex() == tileRow)
+            writeLDScript(output, tile, NL);
         return success();
-      },
+      }),
       registerDialects);
 
   //   _entry_point _main_init
@@ -374,23 +693,13 @@ SECTIONS
 
   TranslateFromMLIRRegistration registrationBCF(
       "aie-generate-bcf", "Generate AIE bcf",
-      [](ModuleOp module, raw_ostream &output) {
-        DenseMap<std::pair<int, int>, Operation *> tiles;
-        DenseMap<Operation *, CoreOp> cores;
-        DenseMap<Operation *, MemOp> mems;
-        DenseMap<std::pair<Operation *, int>, LockOp> locks;
-        DenseMap<Operation *, SmallVector<BufferOp, 4>> buffers;
-        DenseMap<Operation *, SwitchboxOp> switchboxes;
-
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
         if (module.getOps<DeviceOp>().empty()) {
           module.emitOpError("expected AIE.device operation at toplevel");
         }
         DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
 
-        NetlistAnalysis NL(targetOp, tiles, cores, mems, locks, buffers,
-                           switchboxes);
-        NL.collectTiles(tiles);
-        NL.collectBuffers(buffers);
+        NetlistAnalysis NL(targetOp);
 
         // _entry_point _main_init
         // _symbol      _main _after _main_init
@@ -404,125 +713,31 @@ SECTIONS
         // // Include all symbols from rom.c
         // _include _file rom.o
         for (auto tile : targetOp.getOps<TileOp>())
-          if (tile.colIndex() == tileCol && tile.rowIndex() == tileRow) {
-            const auto &target_model = getTargetModel(tile);
-
-            std::string corefunc = std::string("core_") +
-                                   std::to_string(tile.getCol()) + "_" +
-                                   std::to_string(tile.getRow());
-            output << "_entry_point _main_init\n";
-            output << "_symbol " << corefunc << " _after _main_init\n";
-            output << "_symbol      _main_init 0\n";
-            std::string initReserved =
-                (target_model.getTargetArch() == AIEArch::AIE2) ? "0x40000"
-                                                                : "0x20000";
-            output << "_reserved DMb      0x00000 " << initReserved
-                   << " //Don't put data in code memory\n";
-
-            auto srcCoord = std::make_pair(tile.colIndex(), tile.rowIndex());
-            auto doBuffer = [&](Optional<TileID> tile, int offset,
-                                std::string dir) {
-              if (tile) {
-                if (tiles.count(*tile))
-                  for (auto buf : buffers[tiles[*tile]])
-                    writeBCFMap(output, buf, offset, NL);
-                uint32_t localMemSize = target_model.getLocalMemorySize();
-                if (tile != srcCoord)
-                  output << "_reserved DMb 0x" << llvm::utohexstr(offset) << " "
-                         << "0x" << llvm::utohexstr(localMemSize) << " "
-                         << " // Don't allocate variables outside of local "
-                            "memory.\n";
-                // TODO How to set as reserved if no buffer exists (or reserve
-                // remaining buffer)
-              } else {
-                uint32_t localMemSize = target_model.getLocalMemorySize();
-                output << "_reserved DMb 0x" << llvm::utohexstr(offset) << " "
-                       << "0x" << llvm::utohexstr(localMemSize) << " "
-                       << " // No tile with memory exists to the " << dir
-                       << ".\n";
-              }
-            };
-
-            doBuffer(target_model.getMemSouth(srcCoord),
-                     target_model.getMemSouthBaseAddress(),
-                     std::string("south"));
-            doBuffer(target_model.getMemWest(srcCoord),
-                     target_model.getMemWestBaseAddress(), std::string("west"));
-            doBuffer(target_model.getMemNorth(srcCoord),
-                     target_model.getMemNorthBaseAddress(),
-                     std::string("north"));
-            doBuffer(target_model.getMemEast(srcCoord),
-                     target_model.getMemEastBaseAddress(), std::string("east"));
-
-            int stacksize = 0;
-            if (auto core = tile.getCoreOp())
-              stacksize = core.getStackSize();
-            output << "_stack    DM_stack 0x"
-                   << llvm::utohexstr(
-                          target_model.getMemInternalBaseAddress(srcCoord))
-                   << "  0x" << llvm::utohexstr(stacksize)
-                   << " //stack for core\n";
-
-            if (target_model.getTargetArch() == AIEArch::AIE2) {
-              output << "_reserved DMb 0x80000 0x80000 // And everything else "
-                        "the core can't see\n";
-            } else {
-              output << "_reserved DMb 0x40000 0xc0000 // And everything else "
-                        "the core can't see\n";
-            }
-            if (auto coreOp = tile.getCoreOp()) {
-              if (auto fileAttr =
-                      coreOp->getAttrOfType<StringAttr>("link_with")) {
-                auto fileName = std::string(fileAttr.getValue());
-                output << "_include _file " << fileName << "\n";
-              }
-            }
-            output << "_resolve _main core_" << tile.getCol() << "_"
-                   << tile.getRow() << "\n";
-          }
+          if (tile.colIndex() == tileCol && tile.rowIndex() == tileRow)
+            writeBCF(output, tile, NL);
         return success();
-      },
+      }),
       registerDialects);
 
   TranslateFromMLIRRegistration registrationTargetArch(
       "aie-generate-target-arch", "Get the target architecture",
-      [](ModuleOp module, raw_ostream &output) {
-        AIEArch arch = AIEArch::AIE1;
-        if (!module.getOps<DeviceOp>().empty()) {
-          DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
-          arch = targetOp.getTargetModel().getTargetArch();
-        }
-        if (arch == AIEArch::AIE1)
-          output << "AIE\n";
-        else
-          output << stringifyEnum(arch) << "\n";
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        writeTargetArch(output, module);
         return success();
-      },
+      }),
       registerDialects);
 
   TranslateFromMLIRRegistration registrationCoreList(
       "aie-generate-corelist", "Generate python list of cores",
-      [](ModuleOp module, raw_ostream &output) {
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
         if (module.getOps<DeviceOp>().empty()) {
           module.emitOpError("expected AIE.device operation at toplevel");
         }
         DeviceOp targetOp = *(module.getOps<DeviceOp>().begin());
 
-        output << "[";
-        for (auto tileOp : targetOp.getOps<TileOp>()) {
-          int col = tileOp.colIndex();
-          int row = tileOp.rowIndex();
-          if (auto coreOp = tileOp.getCoreOp()) {
-            std::string elf_file = "None";
-            if (auto fileAttr = coreOp->getAttrOfType<StringAttr>("elf_file"))
-              elf_file = "\"" + std::string(fileAttr.getValue()) + "\"";
-            output << '(' << std::to_string(col) << ',' << std::to_string(row)
-                   << ',' << elf_file << "),";
-          }
-        }
-        output << "]\n";
+        writeCoreList(output, targetOp);
         return success();
-      },
+      }),
       registerDialects);
 
   TranslateFromMLIRRegistration registrationXADF(
@@ -533,9 +748,9 @@ SECTIONS
       });
   TranslateFromMLIRRegistration registrationAirbin(
       "aie-generate-airbin", "Generate configuration binary blob",
-      [](ModuleOp module, raw_ostream &output) {
-        return AIETranslateToAirbin(module, output);
-      },
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        return AIETranslateToAirbin(module, output, airbinCompress);
+      }),
       [](DialectRegistry &registry) {
         registry.insert<xilinx::AIE::AIEDialect>();
         registry.insert<func::FuncDialect>();
@@ -546,26 +761,103 @@ SECTIONS
         registry.insert<VectorDialect>();
         registry.insert<LLVM::LLVMDialect>();
       });
-  TranslateFromMLIRRegistration registrationXAIE(
-      "aie-generate-xaie", "Generate libxaie configuration",
+  TranslateFromMLIRRegistration registrationTxn(
+      "aie-generate-txn", "Generate configuration transaction buffer",
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        return AIETranslateToTxn(module, output, minimalWrites);
+      }),
+      [](DialectRegistry &registry) {
+        registry.insert<xilinx::AIE::AIEDialect>();
+        registry.insert<func::FuncDialect>();
+        registry.insert<cf::ControlFlowDialect>();
+        registry.insert<DLTIDialect>();
+        registry.insert<arith::ArithDialect>();
+        registry.insert<memref::MemRefDialect>();
+        registry.insert<VectorDialect>();
+        registry.insert<LLVM::LLVMDialect>();
+      });
+  TranslateFromMLIRRegistration registrationTxnDelta(
+      "aie-generate-txn-delta",
+      "Generate the transaction buffer reconfiguring the design of "
+      "--txn-base into this one",
+      onSelectedDevice([](ModuleOp module,
+                          raw_ostream &output) -> LogicalResult {
+        if (txnBase.empty())
+          return module.emitOpError(
+              "aie-generate-txn-delta needs the base design in --txn-base");
+        OwningOpRef<ModuleOp> base =
+            parseSourceFile<ModuleOp>(txnBase, module.getContext());
+        if (!base || failed(selectBaseDevice(*base)))
+          return failure();
+        return AIETranslateToTxnDelta(*base, module, output);
+      }),
+      [](DialectRegistry &registry) {
+        registry.insert<xilinx::AIE::AIEDialect>();
+        registry.insert<func::FuncDialect>();
+        registry.insert<cf::ControlFlowDialect>();
+        registry.insert<DLTIDialect>();
+        registry.insert<arith::ArithDialect>();
+        registry.insert<memref::MemRefDialect>();
+        registry.insert<VectorDialect>();
+        registry.insert<LLVM::LLVMDialect>();
+      });
+  TranslateFromMLIRRegistration registrationCtrlPkt(
+      "aie-generate-ctrlpkt",
+      "Generate the control packets configuring the design, or reconfiguring "
+      "the design of --txn-base into it",
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        OwningOpRef<ModuleOp> base;
+        if (!txnBase.empty()) {
+          base = parseSourceFile<ModuleOp>(txnBase, module.getContext());
+          if (!base || failed(selectBaseDevice(*base)))
+            return failure();
+        }
+        return AIETranslateToCtrlPkt(module, base.get(), output);
+      }),
+      [](DialectRegistry &registry) {
+        registry.insert<xilinx::AIE::AIEDialect>();
+        registry.insert<func::FuncDialect>();
+        registry.insert<cf::ControlFlowDialect>();
+        registry.insert<DLTIDialect>();
+        registry.insert<arith::ArithDialect>();
+        registry.insert<memref::MemRefDialect>();
+        registry.insert<VectorDialect>();
+        registry.insert<LLVM::LLVMDialect>();
+      });
+  TranslateFromMLIRRegistration registrationChessLLVMIR(
+      "aie-generate-chess-llvmir",
+      "Translate the cores lowered to the LLVM dialect to the LLVM IR of "
+      "xchesscc, linked with --chess-intrinsic-wrapper",
       [](ModuleOp module, raw_ostream &output) {
-        return AIETranslateToXAIEV2(module, output);
+        return AIETranslateToChessLLVMIR(module, chessIntrinsicWrapper,
+                                         output);
       },
+      [](DialectRegistry &registry) {
+        registry.insert<DLTIDialect>();
+        registry.insert<LLVM::LLVMDialect>();
+        registerBuiltinDialectTranslation(registry);
+        registerLLVMDialectTranslation(registry);
+      });
+  TranslateFromMLIRRegistration registrationXAIE(
+      "aie-generate-xaie", "Generate libxaie configuration",
+      onSelectedDevice([](ModuleOp module, raw_ostream &output) {
+        return AIETranslateToXAIEV2(module, output, minimalWrites);
+      }),
       registerDialects);
   TranslateFromMLIRRegistration registrationXJSON(
-      "aie-flows-to-json", "Translate AIE flows to JSON", AIEFlowsToJSON,
-      registerDialects);
+      "aie-flows-to-json", "Translate AIE flows to JSON",
+      onSelectedDevice(AIEFlowsToJSON), registerDialects);
   TranslateFromMLIRRegistration registrationXPE(
       "aie-mlir-to-xpe", "Translate AIE design to XPE file for simulation",
-      AIETranslateGraphXPE, registerDialects);
+      onSelectedDevice(AIETranslateGraphXPE), registerDialects);
   TranslateFromMLIRRegistration registrationSCSimConfig(
       "aie-mlir-to-scsim-config",
       "Translate AIE design to SCSimConfig file for simulation",
-      AIETranslateSCSimConfig, registerDialects);
+      onSelectedDevice(AIETranslateSCSimConfig), registerDialects);
   TranslateFromMLIRRegistration registrationShimSolution(
       "aie-mlir-to-shim-solution",
       "Translate AIE design to ShimSolution file for simulation",
-      AIETranslateShimSolution, registerDialects);
+      onSelectedDevice(AIETranslateShimSolution), registerDialects);
 }
 } // namespace AIE
 } // namespace xilinx
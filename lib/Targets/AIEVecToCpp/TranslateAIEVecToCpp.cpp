@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "TranslateAIEVecToCpp.h"
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "aie/Dialect/AIEVec/AIEVecUtils.h"
 #include "aie/Dialect/AIEVec/IR/AIEVecOps.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
@@ -24,9 +25,11 @@
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/Dialect.h"
 #include "mlir/IR/Operation.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
 #include "mlir/Support/IndentedOstream.h"
 #include "mlir/Support/MathExtras.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringMap.h"
@@ -36,12 +39,36 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FormatVariadic.h"
 #include <limits>
+#include <map>
+#include <tuple>
 
 #define DEBUG_TYPE "aievec-to-cpp"
 
 static llvm::cl::opt<bool> AIEML("aieml", llvm::cl::desc("AI Engine-ML"),
                                  llvm::cl::init(false));
 
+static llvm::cl::opt<bool>
+    AIEAPI("aie-api",
+           llvm::cl::desc("Emit the vector and accumulator templates of the "
+                          "AIE API instead of the intrinsics"),
+           llvm::cl::init(false));
+
+static llvm::cl::opt<bool> specializeShapes(
+    "aievec-specialize-shapes",
+    llvm::cl::desc("Emit the functions with dynamically shaped memref "
+                   "arguments as templates over the sizes of the dynamic "
+                   "dimensions, instantiated for the shapes of their "
+                   "aievec.shapes attribute and of their call sites"),
+    llvm::cl::init(false));
+
+static llvm::cl::opt<bool> postIncrement(
+    "aievec-post-increment",
+    llvm::cl::desc("Load and store the vectors of a loop through pointers "
+                   "bumped at the end of each iteration, which the address "
+                   "generators post-increment, instead of recomputing the "
+                   "linearized index of each access"),
+    llvm::cl::init(false));
+
 using namespace mlir;
 using namespace xilinx;
 using namespace xilinx::aievec;
@@ -186,6 +213,37 @@ struct CppEmitter {
   /// Returns the output stream.
   raw_indented_ostream &ostream() { return os; };
 
+  /// Mark the memref argument as possibly aliasing another argument.
+  void setMayAlias(Value arg) { aliasedArgs.insert(arg); }
+
+  /// Returns whether the memref argument may alias another argument.
+  bool mayAlias(Value arg) { return aliasedArgs.count(arg); }
+
+  /// Record the data memory bank the memref argument points to.
+  void setBank(Value arg, int64_t bank) { argBanks[arg] = bank; }
+
+  /// Returns the data memory bank the memref argument points to, if known.
+  std::optional<int64_t> getBank(Value arg) {
+    auto it = argBanks.find(arg);
+    if (it == argBanks.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  /// Record the pointer through which the vector load or store op accesses
+  /// its memref, bumped by the loop around it.
+  void setAccessPointer(Operation *op, StringRef pointer) {
+    accessPointers[op] = pointer.str();
+  }
+
+  /// Returns the pointer of the vector load or store op, if it has one.
+  StringRef getAccessPointer(Operation *op) {
+    auto it = accessPointers.find(op);
+    if (it == accessPointers.end())
+      return StringRef();
+    return it->second;
+  }
+
   /// Returns if all variables for op results and basic block arguments need to
   /// be declared at the beginning of a function.
   bool shouldDeclareVariablesAtTop() { return declareVariablesAtTop; };
@@ -217,6 +275,16 @@ private:
   std::stack<int64_t> labelInScopeCount;
 
   llvm::SmallSet<StringRef, 16> includeNames;
+
+  /// The memref arguments which are not emitted as restrict pointers.
+  DenseSet<Value> aliasedArgs;
+
+  /// The data memory banks of the memref arguments with an AIE.bank
+  /// attribute.
+  DenseMap<Value, int64_t> argBanks;
+
+  /// The pointers of the vector loads and stores of the loops.
+  DenseMap<Operation *, std::string> accessPointers;
 };
 } // namespace
 
@@ -243,7 +311,7 @@ static bool skippedOp(Operation *op, CppEmitter &emitter,
     Value source = srsOp.getSource();
     // If the underlying element types are float, then we do not really need an
     // srs op if source of srsOp has only one use.
-    if (!AIEML && eltType.isa<FloatType>() &&
+    if (!AIEML && !AIEAPI && eltType.isa<FloatType>() &&
         source.getDefiningOp()->hasOneUse()) {
       StringRef srcName = emitter.getOrCreateName(source);
       emitter.setName(srsOp->getResult(0), srcName);
@@ -258,7 +326,7 @@ static bool skippedOp(Operation *op, CppEmitter &emitter,
     Value source = upsOp.getSource();
     // If the underlying element types are float, then we do not really need a
     // ups op if the source accumulator has only one use.
-    if (!AIEML && eltType.isa<FloatType>() &&
+    if (!AIEML && !AIEAPI && eltType.isa<FloatType>() &&
         source.getDefiningOp()->hasOneUse()) {
       StringRef srcName = emitter.getOrCreateName(source);
       emitter.setName(upsOp->getResult(0), srcName);
@@ -266,6 +334,21 @@ static bool skippedOp(Operation *op, CppEmitter &emitter,
     }
   }
 
+  // skip op 4 : vector::shape_cast, as the vector registers hold the elements
+  // of multidimensional vectors in row-major order
+  else if (auto shapeCastOp = dyn_cast<vector::ShapeCastOp>(op)) {
+    StringRef srcName = emitter.getOrCreateName(shapeCastOp.getSource());
+    emitter.setName(shapeCastOp.getResult(), srcName);
+    skip = true;
+  }
+
+  // skip op 5 : memref::cast, which points to the same elements
+  else if (auto castOp = dyn_cast<memref::CastOp>(op)) {
+    StringRef srcName = emitter.getOrCreateName(castOp.getSource());
+    emitter.setName(castOp.getResult(), srcName);
+    skip = true;
+  }
+
   // Ops whose strong liveness must be determined
   checkStrongLiveness &= isa<arith::ConstantOp>(op);
 
@@ -323,6 +406,76 @@ static LogicalResult parseMemRefDynamicDims(CppEmitter &emitter,
   return success();
 }
 
+// Return the sizes of the dynamic dimensions of the memref arguments of the
+// function at the call site, if the call site casts static memrefs to them
+static std::optional<SmallVector<int64_t, 4>>
+getCallShape(func::CallOp callOp, func::FuncOp functionOp) {
+  SmallVector<int64_t, 4> shape;
+  for (auto [operand, type] :
+       llvm::zip(callOp.getOperands(), functionOp.getArgumentTypes())) {
+    auto memRefType = dyn_cast<MemRefType>(type);
+    if (!memRefType || !memRefType.getNumDynamicDims())
+      continue;
+    auto castOp = operand.getDefiningOp<memref::CastOp>();
+    if (!castOp)
+      return std::nullopt;
+    auto sourceType = cast<MemRefType>(castOp.getSource().getType());
+    for (unsigned dim = 0; dim < memRefType.getRank(); ++dim) {
+      if (!memRefType.isDynamicDim(dim))
+        continue;
+      if (sourceType.isDynamicDim(dim))
+        return std::nullopt;
+      shape.push_back(sourceType.getDimSize(dim));
+    }
+  }
+  return shape;
+}
+
+// Return the shapes the function is specialized for, as the sizes of the
+// dynamic dimensions of its memref arguments: the ones of its aievec.shapes
+// attribute, then the ones of its call sites in the module. There are none
+// without --aievec-specialize-shapes.
+static FailureOr<SmallVector<SmallVector<int64_t, 4>, 2>>
+getSpecializedShapes(func::FuncOp functionOp) {
+  SmallVector<SmallVector<int64_t, 4>, 2> shapes;
+  unsigned numDims = 0;
+  for (Type type : functionOp.getArgumentTypes())
+    if (auto memRefType = dyn_cast<MemRefType>(type))
+      numDims += memRefType.getNumDynamicDims();
+  if (!specializeShapes || numDims == 0 || functionOp.isDeclaration())
+    return shapes;
+
+  auto addShape = [&](ArrayRef<int64_t> shape) {
+    if (!llvm::is_contained(shapes, shape))
+      shapes.emplace_back(shape.begin(), shape.end());
+  };
+  if (Attribute attr = functionOp->getAttr(funcShapesAttrName)) {
+    auto shapesAttr = dyn_cast<ArrayAttr>(attr);
+    if (!shapesAttr)
+      return functionOp.emitOpError("expected '")
+             << funcShapesAttrName << "' to be an array of shapes";
+    for (Attribute shapeAttr : shapesAttr) {
+      auto shape = dyn_cast<DenseI64ArrayAttr>(shapeAttr);
+      if (!shape || shape.size() != static_cast<int64_t>(numDims) ||
+          llvm::any_of(shape.asArrayRef(), [](int64_t size) {
+            return size <= 0;
+          }))
+        return functionOp.emitOpError("expected each shape of '")
+               << funcShapesAttrName << "' to give the " << numDims
+               << " dynamic sizes of its memref arguments";
+      addShape(shape.asArrayRef());
+    }
+  }
+  if (auto module = functionOp->getParentOfType<ModuleOp>())
+    module.walk([&](func::CallOp callOp) {
+      if (callOp.getCallee() != functionOp.getSymName())
+        return;
+      if (auto shape = getCallShape(callOp, functionOp))
+        addShape(*shape);
+    });
+  return shapes;
+}
+
 // Print the memref dims, if the memref has dynamic shape
 static LogicalResult printMemRefDims(CppEmitter &emitter, BlockArgument arg) {
   raw_indented_ostream &os = emitter.ostream();
@@ -338,10 +491,13 @@ static LogicalResult printMemRefDims(CppEmitter &emitter, BlockArgument arg) {
   return success();
 }
 
-// Get the linearized access for the source memref
+// Get the linearized access for the source memref. If iv is given, its uses
+// in the indices are replaced by ivName.
 static LogicalResult createLinearizedAccess(CppEmitter &emitter, Value source,
                                             SmallVector<Value, 4> indices,
-                                            std::string &access) {
+                                            std::string &access,
+                                            Value iv = nullptr,
+                                            StringRef ivName = "") {
   MemRefType memRefType = source.getType().dyn_cast<MemRefType>();
   assert(memRefType &&
          "cannot creating linearized expression for non-memref type");
@@ -359,7 +515,8 @@ static LogicalResult createLinearizedAccess(CppEmitter &emitter, Value source,
   SmallVector<std::string, 4> accessVec;
   for (int dim = memRefType.getRank() - 1; dim >= 0; --dim) {
     // All the indices in the access expression must already be emitted
-    if (!emitter.hasValueInScope(indices[dim]))
+    bool substituted = iv && indices[dim] == iv;
+    if (!substituted && !emitter.hasValueInScope(indices[dim]))
       return failure();
 
     // Form the access string for this dimension
@@ -368,7 +525,10 @@ static LogicalResult createLinearizedAccess(CppEmitter &emitter, Value source,
       cur = paramPart + "*";
     if (numPart > 1)
       cur += std::to_string(numPart) + "*";
-    cur += emitter.getOrCreateName(indices[dim]);
+    if (substituted)
+      cur += ivName;
+    else
+      cur += emitter.getOrCreateName(indices[dim]);
     accessVec.push_back(cur);
 
     // Now update the numPart and paramPart to form the stride for the next
@@ -394,12 +554,110 @@ static LogicalResult createLinearizedAccess(CppEmitter &emitter, Value source,
 // Return true if the array accessed by this value is readonly
 static bool isReadOnly(Value read) {
   for (auto *user : read.getUsers()) {
-    if (isa<vector::TransferWriteOp>(user))
+    if (isa<vector::TransferWriteOp, memref::StoreOp, func::CallOp,
+            emitc::CallOp>(user))
       return false;
+    if (auto view = dyn_cast<ViewLikeOpInterface>(user))
+      if (view.getViewSource() == read && !isReadOnly(view->getResult(0)))
+        return false;
   }
   return true;
 }
 
+// Return the allocation or the argument the memref is a view of
+static Value getMemRefRoot(Value memref) {
+  while (Operation *def = memref.getDefiningOp()) {
+    if (auto view = dyn_cast<ViewLikeOpInterface>(def))
+      memref = view.getViewSource();
+    else if (auto expand = dyn_cast<memref::ExpandShapeOp>(def))
+      memref = expand.getSrc();
+    else if (auto collapse = dyn_cast<memref::CollapseShapeOp>(def))
+      memref = collapse.getSrc();
+    else
+      break;
+  }
+  return memref;
+}
+
+// Return true if the memrefs passed to a call may overlap, as views of the
+// same allocation or argument. The distinct arguments of the caller are
+// assumed not to overlap, as they are restrict pointers themselves.
+static bool mayAlias(Value a, Value b) {
+  return getMemRefRoot(a) == getMemRefRoot(b);
+}
+
+// Return the positions of the memref arguments of the function which may alias
+// another argument at one of its call sites in the module. They are not
+// emitted as restrict pointers. The functions without call sites are kernels,
+// whose memref arguments are assumed not to alias.
+static llvm::SmallSet<unsigned, 4> getAliasedArgs(func::FuncOp functionOp) {
+  llvm::SmallSet<unsigned, 4> aliased;
+  auto module = functionOp->getParentOfType<ModuleOp>();
+  if (!module)
+    return aliased;
+  module.walk([&](func::CallOp callOp) {
+    if (callOp.getCallee() != functionOp.getSymName())
+      return;
+    auto operands = callOp.getOperands();
+    for (unsigned i = 0; i < operands.size(); ++i) {
+      if (!isa<MemRefType>(operands[i].getType()))
+        continue;
+      for (unsigned j = i + 1; j < operands.size(); ++j) {
+        if (!isa<MemRefType>(operands[j].getType()) ||
+            !mayAlias(operands[i], operands[j]))
+          continue;
+        aliased.insert(i);
+        aliased.insert(j);
+      }
+    }
+  });
+  return aliased;
+}
+
+// Emit the chess storage of the data memory bank, so that the compiler knows
+// that the accesses to different banks can be issued in the same cycle
+static void emitStorage(CppEmitter &emitter, std::optional<int64_t> bank) {
+  if (bank)
+    emitter.ostream() << " chess_storage(DM_bank" << char('A' + *bank) << ")";
+}
+
+// Emit the chess storage of the memref argument the memref is a view of
+static void emitStorage(CppEmitter &emitter, Value memref) {
+  emitStorage(emitter, emitter.getBank(getMemRefRoot(memref)));
+}
+
+// Return the data memory bank of the memref argument of the function, given by
+// its AIE.bank attribute
+static FailureOr<std::optional<int64_t>> getArgBank(func::FuncOp functionOp,
+                                                    unsigned argIndex) {
+  auto bankAttr =
+      functionOp.getArgAttrOfType<IntegerAttr>(argIndex, AIE::bankAttrName);
+  if (!bankAttr)
+    return std::optional<int64_t>();
+  int64_t bank = bankAttr.getInt();
+  if (bank < 0 || bank >= 26) {
+    functionOp.emitOpError("argument ")
+        << argIndex << " has invalid " << AIE::bankAttrName << " " << bank;
+    return failure();
+  }
+  return std::optional<int64_t>(bank);
+}
+
+// Emit the type of the memref argument as a plain pointer if it may alias
+// another argument, as a restrict pointer otherwise, to the storage of its
+// data memory bank if it is known
+static LogicalResult emitArgType(CppEmitter &emitter, Location loc, Type type,
+                                 bool mayAlias, std::optional<int64_t> bank) {
+  auto memRefType = dyn_cast<MemRefType>(type);
+  if (!memRefType || (!mayAlias && !bank))
+    return emitter.emitType(loc, type);
+  if (failed(emitter.emitType(loc, memRefType.getElementType())))
+    return failure();
+  emitStorage(emitter, bank);
+  emitter.ostream() << (mayAlias ? " *" : " * restrict");
+  return success();
+}
+
 //===----------------------------------------------------------------------===//
 // Print non-AIE dialect ops
 //===----------------------------------------------------------------------===//
@@ -463,6 +721,44 @@ static LogicalResult printOperation(CppEmitter &emitter, T binOp) {
 // Print AIE dialect ops
 //===----------------------------------------------------------------------===//
 
+// Return the pointer through which op accesses source: the pointer bumped by
+// the loop around op, or source itself.
+static StringRef getAccessBase(CppEmitter &emitter, Operation *op,
+                               Value source) {
+  StringRef pointer = emitter.getAccessPointer(op);
+  if (!pointer.empty())
+    return pointer;
+  return emitter.getOrCreateName(source);
+}
+
+// Construct the access expression of the UPD op using the memref shape, the
+// indices and the offset
+static LogicalResult createUPDAccess(CppEmitter &emitter, aievec::UPDOp updOp,
+                                     std::string &access) {
+  // The pointer of the access of a loop already points to the indices
+  auto indices = updOp.getIndices();
+  bool hasPointer = !emitter.getAccessPointer(updOp).empty();
+  if (!hasPointer && failed(createLinearizedAccess(emitter, updOp.getSource(),
+                                                   indices, access)))
+    return failure();
+
+  // If the UPD op had an offset, add it to the access expr
+  VectorType resultType = updOp.getResult().getType().cast<VectorType>();
+  int32_t elementSizeInBits = getElementSizeInBits(resultType);
+  if (updOp.getOffset() != 0) {
+    if (std::abs(updOp.getOffset()) % elementSizeInBits)
+      return failure();
+    int32_t updOffset = updOp.getOffset() / elementSizeInBits;
+    if (access.empty())
+      access = std::to_string(updOffset);
+    else {
+      access += updOffset > 0 ? " + " : " - ";
+      access += std::to_string(std::abs(updOffset));
+    }
+  }
+  return success();
+}
+
 // Print the AIE dialect UPD op
 static LogicalResult printOperation(CppEmitter &emitter, aievec::UPDOp updOp) {
   Value source = updOp.getSource();
@@ -471,25 +767,14 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::UPDOp updOp) {
     return failure();
 
   // Construct the access expression using memref shape and indices
-  auto indices = updOp.getIndices();
   std::string access;
-  if (failed(createLinearizedAccess(emitter, source, indices, access)))
+  if (failed(createUPDAccess(emitter, updOp, access)))
     return failure();
 
   raw_indented_ostream &os = emitter.ostream();
   Value result = updOp.getResult();
   VectorType resultType = result.getType().cast<VectorType>();
   int32_t vecSizeInBits = getVectorSizeInBits(resultType);
-  int32_t elementSizeInBits = getElementSizeInBits(resultType);
-
-  // If the UPD op had an offset, add it to the access expr
-  if (updOp.getOffset() != 0) {
-    if (std::abs(updOp.getOffset()) % elementSizeInBits)
-      return failure();
-    int32_t updOffset = updOp.getOffset() / elementSizeInBits;
-    access += updOffset > 0 ? " + " : " - ";
-    access += std::to_string(std::abs(updOffset));
-  }
 
   // If the vector size to be loaded is less than or equal to 256, we
   // can just do a direct memory copy. If the translation is for AIEML,
@@ -501,9 +786,10 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::UPDOp updOp) {
     os << "*(";
     if (failed(emitter.emitType(updOp->getLoc(), resultType)))
       return failure();
+    emitStorage(emitter, source);
     os << " *)";
     os << "(";
-    os << emitter.getOrCreateName(source);
+    os << getAccessBase(emitter, updOp, source);
     if (!access.empty())
       os << " + " << access;
     os << ")";
@@ -535,13 +821,17 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::UPDOp updOp) {
 
     if (!emitter.hasValueInScope(result))
       return failure();
-    // If the source array of upd is read-only, load from restrict pointer
-    bool readOnly = isReadOnly(source);
+    // If the source array of upd is read-only, and does not alias the other
+    // arrays, load from restrict pointer
+    bool readOnly =
+        isReadOnly(source) && !emitter.mayAlias(getMemRefRoot(source));
     std::string restrictPrefix =
         readOnly ? ("r_" + emitter.getOrCreateName(result).str() + "_") : "";
     // Create a restrict pointer
     if (readOnly && !vector) {
-      if (failed(emitter.emitType(updOp->getLoc(), source.getType())))
+      if (failed(emitArgType(emitter, updOp->getLoc(), source.getType(),
+                             /*mayAlias=*/false,
+                             emitter.getBank(getMemRefRoot(source)))))
         return failure();
       os << " " << restrictPrefix << emitter.getOrCreateName(source);
       os << " = ";
@@ -561,6 +851,7 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::UPDOp updOp) {
     os << "*(";
     if (failed(emitter.emitType(updOp->getLoc(), updType)))
       return failure();
+    emitStorage(emitter, source);
     os << " *)";
     os << "(";
     os << restrictPrefix << emitter.getOrCreateName(source);
@@ -703,7 +994,7 @@ static LogicalResult printOperation(CppEmitter &emitter,
 // Generate the srs intrinsic
 static LogicalResult printOperation(CppEmitter &emitter, aievec::SRSOp srsOp) {
   Value source = srsOp.getSource();
-  int32_t shift = srsOp.getShift();
+  Value dynamicShift = srsOp.getDynamicShift();
 
   // Get the datatype of the source accumulator and result vector
   VectorType accType = srsOp.getSource().getType().cast<VectorType>();
@@ -717,8 +1008,10 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::SRSOp srsOp) {
   if (failed(emitter.emitAssignPrefix(*srsOp)))
     return failure();
 
-  // The source accumulator should have already been emitted
-  if (!emitter.hasValueInScope(source))
+  // The source accumulator, and the dynamic shift, should have already been
+  // emitted
+  if (!emitter.hasValueInScope(source) ||
+      (dynamicShift && !emitter.hasValueInScope(dynamicShift)))
     return failure();
 
   // If the underlying element types are float, then we do not really need an
@@ -765,7 +1058,10 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::SRSOp srsOp) {
   os << "(";
   os << emitter.getOrCreateName(source);
   os << ", ";
-  os << std::to_string(shift);
+  if (dynamicShift)
+    os << emitter.getOrCreateName(dynamicShift);
+  else
+    os << std::to_string(srsOp.getShift());
   os << ")";
   return success();
 }
@@ -1507,6 +1803,16 @@ static LogicalResult printOperation(CppEmitter &emitter, aievec::MaxOp maxOp) {
   return success();
 }
 
+// Return true if the result of the AddElem or SubElem op is an accumulator
+// FIXME: move the logic to the op creation and add isAcc to the op attribute
+template <typename T> static bool isAddElemOrSubElemAcc(T op) {
+  VectorType resType = cast<VectorType>(op.getResult().getType());
+  auto resElemType = resType.getElementType();
+  unsigned resBitWidth = resElemType.getIntOrFloatBitWidth();
+  unsigned resLaneSize = getVectorLaneSize(resType);
+  return isa<FloatType>(resElemType) || (resBitWidth * resLaneSize == 1024);
+}
+
 // Generate the AddElem op
 static LogicalResult printOperation(CppEmitter &emitter,
                                     aievec::AddElemOp add_elemOp) {
@@ -1520,15 +1826,7 @@ static LogicalResult printOperation(CppEmitter &emitter,
   raw_indented_ostream &os = emitter.ostream();
 
   // Generate the initialization for the result
-  // FIXME: move the logic to the op creation and add isAcc to the op attribute
-  bool isAcc = false;
-  VectorType resType = cast<VectorType>(add_elemOp.getResult().getType());
-  auto resElemType = resType.getElementType();
-  unsigned resBitWidth = resElemType.getIntOrFloatBitWidth();
-  unsigned resLaneSize = getVectorLaneSize(resType);
-  if (isa<FloatType>(resElemType) || (resBitWidth * resLaneSize == 1024))
-    isAcc = true;
-
+  bool isAcc = isAddElemOrSubElemAcc(add_elemOp);
   if (failed(emitter.emitAssignPrefix(*add_elemOp, /*isAcc=*/isAcc)))
     return failure();
 
@@ -1557,15 +1855,7 @@ static LogicalResult printOperation(CppEmitter &emitter,
   raw_indented_ostream &os = emitter.ostream();
 
   // Generate the initialization for the result
-  // FIXME: move the logic to the op creation and add isAcc to the op attribute
-  bool isAcc = false;
-  VectorType resType = cast<VectorType>(sub_elemOp.getResult().getType());
-  auto resElemType = resType.getElementType();
-  unsigned resBitWidth = resElemType.getIntOrFloatBitWidth();
-  unsigned resLaneSize = getVectorLaneSize(resType);
-  if (isa<FloatType>(resElemType) || (resBitWidth * resLaneSize == 1024))
-    isAcc = true;
-
+  bool isAcc = isAddElemOrSubElemAcc(sub_elemOp);
   if (failed(emitter.emitAssignPrefix(*sub_elemOp, /*isAcc=*/isAcc)))
     return failure();
 
@@ -1745,6 +2035,47 @@ static LogicalResult printOperation(CppEmitter &emitter,
   return success();
 }
 
+// Generate the matmul op for AIE-ML
+static LogicalResult printOperation(CppEmitter &emitter,
+                                    aievec::MatMulOp matMulOp) {
+  if (!AIEML) {
+    return failure();
+  }
+
+  auto acc = matMulOp.getAcc();
+  auto lhs = matMulOp.getLhs();
+  auto rhs = matMulOp.getRhs();
+
+  // The sources should have already been emitted
+  if (!emitter.hasValueInScope(acc) || !emitter.hasValueInScope(lhs) ||
+      !emitter.hasValueInScope(rhs))
+    return failure();
+
+  // The intrinsic is named after the shapes of the lhs and rhs matrices
+  int32_t M = matMulOp.getM();
+  int32_t K = matMulOp.getK();
+  int32_t N = matMulOp.getN();
+
+  raw_indented_ostream &os = emitter.ostream();
+
+  StringRef accName = emitter.getOrCreateName(acc);
+  os << accName;
+  os << " = ";
+  os << "mac_" << M << "x" << K << "_" << K << "x" << N;
+  os << "(";
+  os << emitter.getOrCreateName(lhs);
+  os << ", ";
+  os << emitter.getOrCreateName(rhs);
+  os << ", ";
+  os << accName;
+  os << ")";
+
+  // Finally, set the name of the result to the accumulator's name
+  emitter.setName(matMulOp->getResult(0), accName);
+
+  return success();
+}
+
 // Generate the comparison intrinsics(eq, ne, lt, le, gt, ge) for AIE-ML
 static LogicalResult printOperation(CppEmitter &emitter, aievec::CmpOp cmpOp) {
   if (!AIEML) {
@@ -1863,6 +2194,394 @@ static LogicalResult printOperation(CppEmitter &emitter,
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// Print AIE dialect ops with the AIE API
+//===----------------------------------------------------------------------===//
+
+// With -aie-api, the AIE vector ops are emitted as the vector and accumulator
+// templates of the AIE API, which select the intrinsics of the architecture
+// when the kernel is compiled. The ops without a counterpart in the AIE API,
+// like the ones selecting the lanes of their operands, are rejected.
+template <typename T>
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter, T op) {
+  return op.emitOpError("is not supported by the AIE API emission");
+}
+
+// Print the AIE API call name(lhs, rhs) of the binary op
+template <typename T>
+static LogicalResult printAIEAPICall(CppEmitter &emitter, T op, StringRef name,
+                                     bool isAcc = false) {
+  Value lhs = op.getLhs();
+  Value rhs = op.getRhs();
+
+  // The sources should have already been emitted
+  if (!emitter.hasValueInScope(lhs) || !emitter.hasValueInScope(rhs))
+    return failure();
+
+  if (failed(emitter.emitAssignPrefix(*op, isAcc)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  os << name << "(" << emitter.getOrCreateName(lhs) << ", "
+     << emitter.getOrCreateName(rhs) << ")";
+  return success();
+}
+
+// Print the AIE API multiply-accumulate acc = aie::mac(acc, lhs, rhs) of the
+// FMA op
+template <typename T>
+static LogicalResult printAIEAPIMac(CppEmitter &emitter, T fmaOp) {
+  Value acc = fmaOp.getAcc();
+  Value lhs = fmaOp.getLhs();
+  Value rhs = fmaOp.getRhs();
+
+  // The sources should have already been emitted
+  if (!emitter.hasValueInScope(acc) || !emitter.hasValueInScope(lhs) ||
+      !emitter.hasValueInScope(rhs))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+
+  StringRef accName = emitter.getOrCreateName(acc);
+  os << accName << " = " << (fmaOp.getFmsub() ? "aie::msc" : "aie::mac")
+     << "(" << accName << ", " << emitter.getOrCreateName(lhs) << ", "
+     << emitter.getOrCreateName(rhs) << ")";
+
+  // Finally, set the name of the result to the accumulator's name
+  emitter.setName(fmaOp->getResult(0), accName);
+  return success();
+}
+
+// Print the UPD op as an aie::load_v of the whole vector, or an insert of one
+// half of it
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::UPDOp updOp) {
+  Value source = updOp.getSource();
+  if (!emitter.hasValueInScope(source))
+    return failure();
+
+  std::string access;
+  if (failed(createUPDAccess(emitter, updOp, access)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  Value result = updOp.getResult();
+  VectorType resultType = result.getType().cast<VectorType>();
+  unsigned lanes = getVectorLaneSize(resultType);
+
+  auto printLoad = [&](unsigned loadLanes) {
+    os << "aie::load_v<" << loadLanes << ">(";
+    os << emitter.getOrCreateName(source);
+    if (!access.empty())
+      os << " + " << access;
+    os << ")";
+  };
+
+  if (getVectorSizeInBits(resultType) <= (AIEML ? 1024 : 256)) {
+    if (failed(emitter.emitAssignPrefix(*updOp)))
+      return failure();
+    printLoad(lanes);
+    return success();
+  }
+
+  Value vector = updOp.getVector();
+  if (!vector) {
+    if (!emitter.shouldDeclareVariablesAtTop()) {
+      if (failed(emitter.emitVariableDeclaration(updOp->getResult(0), true)))
+        return failure();
+    }
+  } else {
+    if (!emitter.hasValueInScope(vector))
+      return failure();
+    emitter.setName(result, emitter.getOrCreateName(vector));
+  }
+  os << emitter.getOrCreateName(result) << ".insert("
+     << std::to_string(updOp.getIndex()) << ", ";
+  printLoad(lanes / 2);
+  os << ")";
+  return success();
+}
+
+// Print the conversion of the vector source to an accumulator of resType
+static LogicalResult printAIEAPIToAccum(CppEmitter &emitter, Operation *op,
+                                        Value source, VectorType resType,
+                                        std::optional<int32_t> shift) {
+  if (!emitter.hasValueInScope(source))
+    return failure();
+
+  if (failed(emitter.emitAssignPrefix(*op, /*isAcc=*/true)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  if (failed(emitter.emitType(op->getLoc(), resType, true, /*isAcc=*/true)))
+    return failure();
+  os << "(" << emitter.getOrCreateName(source);
+  if (shift && !resType.getElementType().isa<FloatType>())
+    os << ", " << std::to_string(*shift);
+  os << ")";
+  return success();
+}
+
+// Print the conversion of the accumulator source to a vector of resType
+static LogicalResult printAIEAPIToVector(CppEmitter &emitter, Operation *op,
+                                         Value source, VectorType resType,
+                                         std::optional<std::string> shift) {
+  if (!emitter.hasValueInScope(source))
+    return failure();
+
+  if (failed(emitter.emitAssignPrefix(*op)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  os << emitter.getOrCreateName(source) << ".to_vector<";
+  if (failed(emitter.emitType(op->getLoc(), resType.getElementType(), false)))
+    return failure();
+  os << ">(";
+  Type srcEltType = source.getType().cast<VectorType>().getElementType();
+  if (shift && !srcEltType.isa<FloatType>())
+    os << *shift;
+  os << ")";
+  return success();
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::UPSOp upsOp) {
+  return printAIEAPIToAccum(emitter, upsOp, upsOp.getSource(),
+                            upsOp.getResult().getType().cast<VectorType>(),
+                            upsOp.getShift());
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::SRSOp srsOp) {
+  std::string shift = std::to_string(srsOp.getShift());
+  if (Value dynamicShift = srsOp.getDynamicShift()) {
+    if (!emitter.hasValueInScope(dynamicShift))
+      return failure();
+    shift = emitter.getOrCreateName(dynamicShift).str();
+  }
+  return printAIEAPIToVector(emitter, srsOp, srsOp.getSource(),
+                             srsOp.getResult().getType().cast<VectorType>(),
+                             shift);
+}
+
+// The casts between vectors and accumulators keep the values
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::CastOp castOp) {
+  VectorType resType = castOp.getResult().getType().cast<VectorType>();
+  if (castOp.getIsResAcc())
+    return printAIEAPIToAccum(emitter, castOp, castOp.getSource(), resType,
+                              std::nullopt);
+  return printAIEAPIToVector(emitter, castOp, castOp.getSource(), resType,
+                             std::nullopt);
+}
+
+// Print aie::broadcast<T, N>(value) for the broadcast ops
+static LogicalResult printAIEAPIBroadcast(CppEmitter &emitter, Operation *op,
+                                          StringRef value) {
+  VectorType resType = op->getResult(0).getType().cast<VectorType>();
+
+  if (failed(emitter.emitAssignPrefix(*op)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  os << "aie::broadcast<";
+  if (failed(emitter.emitType(op->getLoc(), resType.getElementType(), false)))
+    return failure();
+  os << ", " << getVectorLaneSize(resType) << ">(" << value << ")";
+  return success();
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::BroadcastOp broadcastOp) {
+  Value source = broadcastOp.getSource();
+  if (!emitter.hasValueInScope(source))
+    return failure();
+  std::string value = formatv("{0}.get({1})", emitter.getOrCreateName(source),
+                              std::to_string(broadcastOp.getIdx()));
+  return printAIEAPIBroadcast(emitter, broadcastOp, value);
+}
+
+static LogicalResult
+printAIEAPIOperation(CppEmitter &emitter,
+                     aievec::BroadcastScalarOp broadcastScalarOp) {
+  Value source = broadcastScalarOp.getSource();
+  if (!emitter.hasValueInScope(source))
+    return failure();
+  return printAIEAPIBroadcast(emitter, broadcastScalarOp,
+                              emitter.getOrCreateName(source));
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::ExtOp extOp) {
+  Value source = extOp.getSource();
+  if (!emitter.hasValueInScope(source))
+    return failure();
+
+  if (failed(emitter.emitAssignPrefix(*extOp)))
+    return failure();
+
+  VectorType resType = extOp.getResult().getType().cast<VectorType>();
+  raw_indented_ostream &os = emitter.ostream();
+  os << emitter.getOrCreateName(source) << ".extract<"
+     << getVectorLaneSize(resType) << ">("
+     << std::to_string(extOp.getIndex()) << ")";
+  return success();
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::ExtElemOp extElemOp) {
+  Value source = extElemOp.getSource();
+  Value index = extElemOp.getIndex();
+  if (!emitter.hasValueInScope(source) || !emitter.hasValueInScope(index))
+    return failure();
+
+  if (failed(emitter.emitAssignPrefix(*extElemOp)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  os << emitter.getOrCreateName(source) << ".get("
+     << emitter.getOrCreateName(index) << ")";
+  return success();
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::ConcatOp concatOp) {
+  if (failed(emitter.emitAssignPrefix(*concatOp)))
+    return failure();
+
+  raw_indented_ostream &os = emitter.ostream();
+  os << "aie::concat(";
+  if (failed(interleaveCommaWithError(
+          concatOp.getSources(), os, [&](Value source) -> LogicalResult {
+            if (!emitter.hasValueInScope(source))
+              return failure();
+            os << emitter.getOrCreateName(source);
+            return success();
+          })))
+    return failure();
+  os << ")";
+  return success();
+}
+
+// Return the AIE API accumulator tag of the multiplication into resType
+static std::string getAIEAPIMulName(VectorType resType) {
+  Type eltType = resType.getElementType();
+  if (eltType.isa<FloatType>())
+    return "aie::mul<accfloat>";
+  return "aie::mul<acc" + std::to_string(eltType.getIntOrFloatBitWidth()) +
+         ">";
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::MulElemOp mulElemOp) {
+  VectorType resType = mulElemOp.getResult().getType().cast<VectorType>();
+  return printAIEAPICall(emitter, mulElemOp, getAIEAPIMulName(resType),
+                         /*isAcc=*/true);
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::FMAElemOp fmaElemOp) {
+  return printAIEAPIMac(emitter, fmaElemOp);
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::AddElemOp addElemOp) {
+  return printAIEAPICall(emitter, addElemOp, "aie::add",
+                         isAddElemOrSubElemAcc(addElemOp));
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::SubElemOp subElemOp) {
+  return printAIEAPICall(emitter, subElemOp, "aie::sub",
+                         isAddElemOrSubElemAcc(subElemOp));
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::MinOp minOp) {
+  return printAIEAPICall(emitter, minOp, "aie::min");
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::MaxOp maxOp) {
+  return printAIEAPICall(emitter, maxOp, "aie::max");
+}
+
+// The AIE1 ops are only emitted for the simple scheme, without lane selection
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::MulOp mulOp) {
+  if (!mulOp.getStart(0).empty())
+    return mulOp.emitOpError(
+        "with lane selection is not supported by the AIE API emission");
+  VectorType resType = mulOp.getResult().getType().cast<VectorType>();
+  return printAIEAPICall(emitter, mulOp, getAIEAPIMulName(resType),
+                         /*isAcc=*/true);
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::FMAOp fmaOp) {
+  if (!fmaOp.getStart(0).empty())
+    return fmaOp.emitOpError(
+        "with lane selection is not supported by the AIE API emission");
+  return printAIEAPIMac(emitter, fmaOp);
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::AddOp addOp) {
+  if (!addOp.getStart(0).empty())
+    return addOp.emitOpError(
+        "with lane selection is not supported by the AIE API emission");
+  return printAIEAPICall(emitter, addOp, "aie::add");
+}
+
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::SubOp subOp) {
+  if (!subOp.getStart(0).empty())
+    return subOp.emitOpError(
+        "with lane selection is not supported by the AIE API emission");
+  return printAIEAPICall(emitter, subOp, "aie::sub");
+}
+
+// Print the MatMul op as an aie::mmul initialized with the accumulator
+static LogicalResult printAIEAPIOperation(CppEmitter &emitter,
+                                          aievec::MatMulOp matMulOp) {
+  Value acc = matMulOp.getAcc();
+  Value lhs = matMulOp.getLhs();
+  Value rhs = matMulOp.getRhs();
+
+  // The sources should have already been emitted
+  if (!emitter.hasValueInScope(acc) || !emitter.hasValueInScope(lhs) ||
+      !emitter.hasValueInScope(rhs))
+    return failure();
+
+  Location loc = matMulOp->getLoc();
+  Type accEltType = acc.getType().cast<VectorType>().getElementType();
+  raw_indented_ostream &os = emitter.ostream();
+
+  StringRef accName = emitter.getOrCreateName(acc);
+  std::string mmulName = emitter.getNewName("mmul");
+  os << "aie::mmul<" << matMulOp.getM() << ", " << matMulOp.getK() << ", "
+     << matMulOp.getN() << ", ";
+  if (failed(emitter.emitType(
+          loc, lhs.getType().cast<VectorType>().getElementType(), false)))
+    return failure();
+  os << ", ";
+  if (failed(emitter.emitType(
+          loc, rhs.getType().cast<VectorType>().getElementType(), false)))
+    return failure();
+  os << ", "
+     << (accEltType.isa<FloatType>()
+             ? std::string("accfloat")
+             : "acc" + std::to_string(accEltType.getIntOrFloatBitWidth()))
+     << "> " << mmulName << "(" << accName << ");\n";
+  os << mmulName << ".mac(" << emitter.getOrCreateName(lhs) << ", "
+     << emitter.getOrCreateName(rhs) << ");\n";
+  os << accName << " = " << mmulName << ".to_accum()";
+
+  // Finally, set the name of the result to the accumulator's name
+  emitter.setName(matMulOp->getResult(0), accName);
+  return success();
+}
+
 // Generate the transfer write op
 static LogicalResult printOperation(CppEmitter &emitter,
                                     vector::TransferWriteOp writeOp) {
@@ -1877,17 +2596,27 @@ static LogicalResult printOperation(CppEmitter &emitter,
   // Construct the access expression using memref shape and indices
   std::string access;
   auto indices = writeOp.getIndices();
-  if (failed(createLinearizedAccess(emitter, source, indices, access)))
+  if (emitter.getAccessPointer(writeOp).empty() &&
+      failed(createLinearizedAccess(emitter, source, indices, access)))
     return failure();
 
   raw_indented_ostream &os = emitter.ostream();
 
+  if (AIEAPI) {
+    os << "aie::store_v(" << getAccessBase(emitter, writeOp, source);
+    if (!access.empty())
+      os << " + " << access;
+    os << ", " << emitter.getOrCreateName(vector) << ")";
+    return success();
+  }
+
   os << "*(";
   if (failed(emitter.emitType(writeOp->getLoc(), vector.getType())))
     return failure();
+  emitStorage(emitter, source);
   os << " *)";
   os << "(";
-  os << emitter.getOrCreateName(source);
+  os << getAccessBase(emitter, writeOp, source);
   if (!access.empty())
     os << " + " << access;
   os << ")";
@@ -1914,6 +2643,7 @@ static LogicalResult printOperation(CppEmitter &emitter,
           storeOp->getLoc(),
           cast<MemRefType>(memref.getType()).getElementType())))
     return failure();
+  emitStorage(emitter, memref);
   os << " *)";
   os << emitter.getOrCreateName(memref);
   os << " = ";
@@ -2074,26 +2804,46 @@ static LogicalResult printOperation(CppEmitter &emitter, func::CallOp callOp) {
     return failure();
 
   raw_ostream &os = emitter.ostream();
-  os << callOp.getCallee() << "(";
+  os << callOp.getCallee();
+  // The variant of a specialized function for the shape of the call site
+  auto functionOp = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+      callOp, callOp.getCalleeAttr());
+  if (functionOp) {
+    auto shapes = getSpecializedShapes(functionOp);
+    if (failed(shapes))
+      return failure();
+    auto shape = getCallShape(callOp, functionOp);
+    if (!shapes->empty() && shape)
+      os << "<"
+         << llvm::join(llvm::map_range(*shape,
+                                       [](int64_t size) {
+                                         return std::to_string(size);
+                                       }),
+                       ", ")
+         << ">";
+  }
+  os << "(";
   if (failed(emitter.emitOperands(*callOp.getOperation())))
     return failure();
   os << ")";
   return success();
 }
 
+// Print the event0 or event1 intrinsic of an AIE.event op
+static LogicalResult printOperation(CppEmitter &emitter,
+                                    xilinx::AIE::EventOp eventOp) {
+  emitter.ostream() << "event" << eventOp.getVal() << "()";
+  return success();
+}
+
 static LogicalResult printOperation(CppEmitter &emitter, emitc::CallOp callOp) {
   raw_ostream &os = emitter.ostream();
   Operation &op = *callOp.getOperation();
-  if (callOp.getCallee() == "getTanhBf16" ||
-      callOp.getCallee() == "getSqrtBf16" ||
-      callOp.getCallee() == "getRsqrtBf16" ||
-      callOp.getCallee() == "getErfBf16") {
-    if (failed(emitter.emitAssignPrefix(op, /*isAcc*/ false)))
-      return failure();
-  } else {
-    if (failed(emitter.emitAssignPrefix(op, /*isAcc*/ true)))
-      return failure();
-  }
+  // Of the library functions of the lowerings, only the exponential returns
+  // an accumulator, the others return vectors or scalars.
+  bool isAcc = callOp.getCallee() == "getExpBf16";
+  if (failed(emitter.emitAssignPrefix(op, isAcc)))
+    return failure();
   os << callOp.getCallee();
 
   auto emitArgs = [&](Attribute attr) -> LogicalResult {
@@ -2162,6 +2912,161 @@ static LogicalResult printOperation(CppEmitter &emitter,
   return success();
 }
 
+// Set value to the integer attribute name of the loop, if any. Fail if the
+// attribute is not a non-negative integer
+static LogicalResult getLoopIntAttr(scf::ForOp forOp, StringRef name,
+                                    std::optional<int64_t> &value) {
+  Attribute attr = forOp->getAttr(name);
+  if (!attr)
+    return success();
+  auto intAttr = attr.dyn_cast<IntegerAttr>();
+  if (!intAttr || intAttr.getInt() < 0)
+    return forOp.emitOpError("expects '")
+           << name << "' to be a non-negative integer";
+  value = intAttr.getInt();
+  return success();
+}
+
+// Print the chess pragmas of the loop. The loop is pipelined, and its range is
+// derived from constant bounds, unless the scheduling attributes of the loop
+// say otherwise.
+static LogicalResult printLoopPragmas(CppEmitter &emitter, scf::ForOp forOp) {
+  raw_indented_ostream &os = emitter.ostream();
+
+  std::optional<int64_t> unroll, minTripCount, maxTripCount;
+  if (failed(getLoopIntAttr(forOp, loopUnrollAttrName, unroll)) ||
+      failed(getLoopIntAttr(forOp, loopMinTripCountAttrName, minTripCount)) ||
+      failed(getLoopIntAttr(forOp, loopMaxTripCountAttrName, maxTripCount)))
+    return failure();
+  if (unroll && *unroll == 0)
+    return forOp.emitOpError("expects a positive '")
+           << loopUnrollAttrName << "'";
+  if (minTripCount && maxTripCount && *minTripCount > *maxTripCount)
+    return forOp.emitOpError("expects '")
+           << loopMinTripCountAttrName << "' not to exceed '"
+           << loopMaxTripCountAttrName << "'";
+
+  bool pipeline = true;
+  if (Attribute attr = forOp->getAttr(loopPipelineAttrName)) {
+    auto boolAttr = attr.dyn_cast<BoolAttr>();
+    if (!boolAttr)
+      return forOp.emitOpError("expects '")
+             << loopPipelineAttrName << "' to be a bool";
+    pipeline = boolAttr.getValue();
+  }
+
+  if (pipeline)
+    os << "chess_prepare_for_pipelining\n";
+  if (forOp->hasAttr(loopFlattenAttrName))
+    os << "chess_flatten_loop\n";
+  if (unroll && *unroll > 1)
+    os << "chess_unroll_loop(" << std::to_string(*unroll) << ")\n";
+
+  // Try to find the upper bound and step of the for operator.
+  // If the bounds are found, print them
+  std::optional<int64_t> lb, ub;
+  auto tc = getTripCount(forOp);
+  if (tc.first) {
+    auto step = getStep(forOp);
+    if (step.first && step.second > 0) {
+      lb = floorDiv(tc.second, step.second);
+      ub = ceilDiv(tc.second, step.second);
+    } else {
+      lb = 1;
+    }
+  }
+  if (minTripCount)
+    lb = minTripCount;
+  if (maxTripCount)
+    ub = maxTripCount;
+  if (lb || ub) {
+    os << "chess_loop_range(";
+    os << std::to_string(lb.value_or(0));
+    os << ", ";
+    if (ub)
+      os << std::to_string(*ub);
+    os << ")\n";
+  }
+  return success();
+}
+
+// Declare the pointers through which the vector loads and stores of the body
+// of forOp access their memref, if the index of one dimension of the memref
+// is the induction variable and the others are invariant. The accesses of the
+// same memref, index and stride share a pointer, which starts at the lower
+// bound of the loop and is bumped at the end of each iteration, so that the
+// address generators post-increment it instead of the scalar unit
+// recomputing the linearized index of each access. Returns the bumps.
+static FailureOr<SmallVector<std::string, 4>>
+emitAccessPointers(CppEmitter &emitter, scf::ForOp forOp) {
+  SmallVector<std::string, 4> bumps;
+  if (!postIncrement || !emitter.hasValueInScope(forOp.getLowerBound()) ||
+      !emitter.hasValueInScope(forOp.getStep()))
+    return bumps;
+  Value iv = forOp.getInductionVar();
+  raw_indented_ostream &os = emitter.ostream();
+  std::map<std::tuple<void *, std::string, int64_t>, std::string> pointers;
+  for (Operation &op : forOp.getBody()->without_terminator()) {
+    Value source;
+    SmallVector<Value, 4> indices;
+    if (auto updOp = dyn_cast<aievec::UPDOp>(op)) {
+      // the wide loads are emitted as the UPD intrinsics
+      if (getVectorSizeInBits(updOp.getResult().getType().cast<VectorType>()) >
+          (AIEML ? 1024 : 256))
+        continue;
+      source = updOp.getSource();
+      indices = updOp.getIndices();
+    } else if (auto writeOp = dyn_cast<vector::TransferWriteOp>(op)) {
+      source = writeOp.getSource();
+      indices = writeOp.getIndices();
+    } else {
+      continue;
+    }
+    auto memRefType = dyn_cast<MemRefType>(source.getType());
+    if (!memRefType || !emitter.hasValueInScope(source) ||
+        llvm::count(indices, iv) != 1)
+      continue;
+    // the stride of the dimension indexed by the induction variable
+    int64_t stride = 1;
+    bool invariant = true;
+    for (int dim = memRefType.getRank() - 1; dim >= 0; --dim) {
+      if (indices[dim] == iv)
+        break;
+      invariant &= forOp.isDefinedOutsideOfLoop(indices[dim]);
+      if (memRefType.isDynamicDim(dim))
+        invariant = false;
+      else
+        stride *= memRefType.getDimSize(dim);
+    }
+    for (Value index : indices)
+      invariant &= index == iv || forOp.isDefinedOutsideOfLoop(index);
+    std::string start;
+    if (!invariant ||
+        failed(createLinearizedAccess(
+            emitter, source, indices, start, iv,
+            emitter.getOrCreateName(forOp.getLowerBound()))))
+      continue;
+
+    auto [it, inserted] = pointers.try_emplace(
+        {source.getAsOpaquePointer(), start, stride}, std::string());
+    if (inserted) {
+      it->second = emitter.getNewName("p");
+      if (failed(emitter.emitType(op.getLoc(), memRefType.getElementType())))
+        return failure();
+      emitStorage(emitter, source);
+      os << " * " << it->second << " = " << emitter.getOrCreateName(source)
+         << " + " << start << ";\n";
+      std::string bump =
+          it->second + " += " + emitter.getOrCreateName(forOp.getStep()).str();
+      if (stride > 1)
+        bump += "*" + std::to_string(stride);
+      bumps.push_back(bump + ";\n");
+    }
+    emitter.setAccessPointer(&op, it->second);
+  }
+  return bumps;
+}
+
 static LogicalResult printOperation(CppEmitter &emitter, scf::ForOp forOp) {
 
   raw_indented_ostream &os = emitter.ostream();
@@ -2186,6 +3091,10 @@ static LogicalResult printOperation(CppEmitter &emitter, scf::ForOp forOp) {
     os << "\n";
   }
 
+  auto bumps = emitAccessPointers(emitter, forOp);
+  if (failed(bumps))
+    return failure();
+
   os << "for (";
   if (failed(
           emitter.emitType(forOp.getLoc(), forOp.getInductionVar().getType())))
@@ -2203,23 +3112,8 @@ static LogicalResult printOperation(CppEmitter &emitter, scf::ForOp forOp) {
   os << " += ";
   os << emitter.getOrCreateName(forOp.getStep());
   os << ")\n";
-  os << "chess_prepare_for_pipelining\n";
-  // Try to find the upper bound and step of the for operator.
-  // If the bounds are found, print them
-  auto tc = getTripCount(forOp);
-  if (tc.first) {
-    auto step = getStep(forOp);
-    int64_t lb =
-        step.first && step.second > 0 ? floorDiv(tc.second, step.second) : 1;
-    int64_t ub =
-        step.first && step.second > 0 ? ceilDiv(tc.second, step.second) : 0;
-    os << "chess_loop_range(";
-    os << std::to_string(lb);
-    os << ", ";
-    if (step.first && step.second > 0)
-      os << std::to_string(ub);
-    os << ")\n";
-  }
+  if (failed(printLoopPragmas(emitter, forOp)))
+    return failure();
   os << "{\n";
   os.indent();
 
@@ -2244,6 +3138,8 @@ static LogicalResult printOperation(CppEmitter &emitter, scf::ForOp forOp) {
     os << emitter.getOrCreateName(iterArg) << " = "
        << emitter.getOrCreateName(operand) << ";\n";
   }
+  for (const std::string &bump : *bumps)
+    os << bump;
 
   os.unindent() << "}";
 
@@ -2353,6 +3249,9 @@ static LogicalResult printOperation(CppEmitter &emitter,
 static LogicalResult printOperation(CppEmitter &emitter, ModuleOp moduleOp) {
   CppEmitter::Scope scope(emitter);
 
+  if (AIEAPI)
+    emitter.ostream() << "#include <aie_api/aie.hpp>\n\n";
+
   for (Operation &op : moduleOp) {
     if (failed(emitter.emitOperation(op, /*trailingSemicolon=*/false)))
       return failure();
@@ -2375,17 +3274,43 @@ static LogicalResult printOperation(CppEmitter &emitter,
   if (failed(parseMemRefDynamicDims(emitter, functionOp)))
     return failure();
 
+  // A specialized function is a template over the dynamic sizes of its
+  // memref arguments, with a variant instantiating it for each shape.
+  auto shapes = getSpecializedShapes(functionOp);
+  if (failed(shapes))
+    return failure();
+  SmallVector<std::string, 4> dimParams;
+  for (BlockArgument arg : functionOp.getArguments())
+    if (auto argType = dyn_cast<MemRefType>(arg.getType()))
+      for (unsigned dim = 0; dim < argType.getRank(); ++dim)
+        if (argType.isDynamicDim(dim))
+          dimParams.push_back(emitter.getMemRefDimParam(arg, dim).str());
+
   raw_indented_ostream &os = emitter.ostream();
+  if (!shapes->empty()) {
+    os << "template <";
+    llvm::interleaveComma(dimParams, os,
+                          [&](const std::string &param) {
+                            os << "size_t " << param;
+                          });
+    os << ">\n";
+  }
   if (failed(emitter.emitTypes(functionOp.getLoc(),
                                functionOp.getFunctionType().getResults())))
     return failure();
   os << " " << functionOp.getName();
 
   os << "(";
+  auto aliasedArgs = getAliasedArgs(functionOp);
   if (functionOp.isDeclaration()) {
+    unsigned argIndex = 0;
     if (failed(interleaveCommaWithError(
             functionOp.getArgumentTypes(), os, [&](Type type) -> LogicalResult {
-              if (failed(emitter.emitType(functionOp.getLoc(), type)))
+              unsigned index = argIndex++;
+              auto bank = getArgBank(functionOp, index);
+              if (failed(bank) ||
+                  failed(emitArgType(emitter, functionOp.getLoc(), type,
+                                     aliasedArgs.count(index), *bank)))
                 return failure();
               // If it is a memref argument, we need to check if it has dynamic
               // shape. If so, the dimensions have to be printed out
@@ -2401,18 +3326,31 @@ static LogicalResult printOperation(CppEmitter &emitter,
     return success();
   }
 
-  if (failed(interleaveCommaWithError(
-          functionOp.getArguments(), os,
-          [&](BlockArgument arg) -> LogicalResult {
-            if (failed(emitter.emitType(functionOp.getLoc(), arg.getType())))
-              return failure();
-            os << " " << emitter.getOrCreateName(arg);
-            // If it is a memref argument, we need to check if it has dynamic
-            // shape. If so, the dimensions have to be printed out
-            if (failed(printMemRefDims(emitter, arg)))
-              return failure();
-            return success();
-          })))
+  // The dynamic sizes of the specialized functions are template parameters.
+  auto emitArgs = [&](bool withDims) {
+    return interleaveCommaWithError(
+        functionOp.getArguments(), os,
+        [&](BlockArgument arg) -> LogicalResult {
+          bool mayAlias = aliasedArgs.count(arg.getArgNumber());
+          if (mayAlias)
+            emitter.setMayAlias(arg);
+          auto bank = getArgBank(functionOp, arg.getArgNumber());
+          if (failed(bank))
+            return failure();
+          if (*bank && isa<MemRefType>(arg.getType()))
+            emitter.setBank(arg, **bank);
+          if (failed(emitArgType(emitter, functionOp.getLoc(), arg.getType(),
+                                 mayAlias, *bank)))
+            return failure();
+          os << " " << emitter.getOrCreateName(arg);
+          // If it is a memref argument, we need to check if it has dynamic
+          // shape. If so, the dimensions have to be printed out
+          if (withDims && failed(printMemRefDims(emitter, arg)))
+            return failure();
+          return success();
+        });
+  };
+  if (failed(emitArgs(/*withDims=*/shapes->empty())))
     return failure();
 
   os << ") {\n";
@@ -2476,6 +3414,27 @@ static LogicalResult printOperation(CppEmitter &emitter,
     }
   }
   os.unindent() << "}\n";
+
+  // The variants callable with the shapes of the specialized function
+  for (ArrayRef<int64_t> shape : *shapes) {
+    auto sizes = llvm::map_range(
+        shape, [](int64_t size) { return std::to_string(size); });
+    auto results = functionOp.getFunctionType().getResults();
+    if (failed(emitter.emitTypes(functionOp.getLoc(), results)))
+      return failure();
+    os << " " << functionOp.getName() << "_" << llvm::join(sizes, "x") << "(";
+    if (failed(emitArgs(/*withDims=*/false)))
+      return failure();
+    os << ") {\n";
+    os.indent() << (results.empty() ? "" : "return ") << functionOp.getName()
+                << "<" << llvm::join(sizes, ", ") << ">(";
+    llvm::interleaveComma(functionOp.getArguments(), os,
+                          [&](BlockArgument arg) {
+                            os << emitter.getOrCreateName(arg);
+                          });
+    os << ");\n";
+    os.unindent() << "}\n";
+  }
   return success();
 }
 
@@ -2638,6 +3597,26 @@ LogicalResult CppEmitter::emitAttribute(Location loc, Attribute attr) {
     }
   };
 
+  // Print the splat vectors with -aie-api as aie::zeros or aie::broadcast
+  if (auto dense = attr.dyn_cast<DenseElementsAttr>()) {
+    auto vType = dense.getType().dyn_cast<VectorType>();
+    if (AIEAPI && vType && dense.isSplat()) {
+      Type eltType = vType.getElementType();
+      bool isZero = eltType.isa<FloatType>()
+                        ? dense.getSplatValue<APFloat>().isZero()
+                        : dense.getSplatValue<APInt>().isZero();
+      os << (isZero ? "aie::zeros<" : "aie::broadcast<");
+      if (failed(emitType(loc, eltType, false)))
+        return failure();
+      os << ", " << getVectorLaneSize(vType) << ">(";
+      if (!isZero &&
+          failed(emitAttribute(loc, dense.getSplatValue<Attribute>())))
+        return failure();
+      os << ")";
+      return success();
+    }
+  }
+
   // Print floating point attributes.
   if (auto fAttr = attr.dyn_cast<FloatAttr>()) {
     printFloat(fAttr.getValue());
@@ -2934,6 +3913,9 @@ LogicalResult CppEmitter::emitOperation(Operation &op, bool trailingSemicolon) {
           .Case<cf::BranchOp, func::CallOp, cf::CondBranchOp, func::FuncOp,
                 ModuleOp, func::ReturnOp>(
               [&](auto op) { return printOperation(*this, op); })
+          // AIE ops.
+          .Case<xilinx::AIE::EventOp>(
+              [&](auto op) { return printOperation(*this, op); })
           // Arith ops.
           .Case<arith::ConstantOp>(
               [&](auto op) { return printOperation(*this, op); })
@@ -2956,8 +3938,12 @@ LogicalResult CppEmitter::emitOperation(Operation &op, bool trailingSemicolon) {
                 aievec::BroadcastScalarOp, aievec::MulConvOp, aievec::FMAConvOp,
                 aievec::ShiftOp, aievec::ShuffleOp, aievec::CastOp,
                 aievec::MinOp, aievec::MaxOp, aievec::CmpOp, aievec::SelOp,
-                aievec::ExtElemOp, aievec::UnpackOp>(
-              [&](auto op) { return printOperation(*this, op); })
+                aievec::ExtElemOp, aievec::UnpackOp, aievec::MatMulOp>(
+              [&](auto op) {
+                if (AIEAPI)
+                  return printAIEAPIOperation(*this, op);
+                return printOperation(*this, op);
+              })
           .Default([&](Operation *) {
             return op.emitOpError("unable to find printer for op");
           });
@@ -3043,6 +4029,30 @@ LogicalResult CppEmitter::emitType(Location loc, Type type, bool stdintType,
       return failure();
 
     unsigned dimSize = tType.getDimSize(tType.getRank() - 1);
+
+    // VectorType with -aie-api: printed as aie::vector<'eltType', 'lane'>, or
+    // aie::accum<'tag', 'lane'> for the accumulators and the 48 and 80 bit
+    // integers, which only live in the AIE1 accumulators
+    if (AIEAPI) {
+      auto iType = eltType.dyn_cast<IntegerType>();
+      if (iType && (iType.getWidth() == 48 || iType.getWidth() == 80))
+        isAcc = true;
+      if (isAcc) {
+        os << "aie::accum<";
+        if (iType)
+          os << "acc" << iType.getWidth();
+        else
+          os << "accfloat";
+        os << ", " << dimSize << ">";
+        return success();
+      }
+      os << "aie::vector<";
+      if (failed(emitType(loc, eltType, false)))
+        return failure();
+      os << ", " << dimSize << ">";
+      return success();
+    }
+
     os << "v" << std::to_string(dimSize);
 
     if (AIEML && isAcc) {
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "TranslateAIEVecToCpp.h"
+#include "aie/Dialect/AIE/IR/AIEDialect.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/ControlFlow/IR/ControlFlow.h"
 #include "mlir/Dialect/DLTI/DLTI.h"
@@ -52,6 +53,7 @@ void registerAIEVecToCppTranslation() {
                         DLTIDialect,
                         scf::SCFDialect,
                         vector::VectorDialect,
+                        xilinx::AIE::AIEDialect,
                         xilinx::aievec::AIEVecDialect>();
         // clang-format on
       });
@@ -9,10 +9,15 @@
 
 #include "aie-c/Dialects.h"
 #include "aie-c/Registration.h"
+#include "aie-c/Translation.h"
 
 namespace py = pybind11;
 using namespace mlir::python::adaptors;
 
+static void appendToString(MlirStringRef str, void *data) {
+  static_cast<std::string *>(data)->append(str.data, str.length);
+}
+
 PYBIND11_MODULE(_aieMlir, m) {
 
   ::aieRegisterAllPasses();
@@ -44,6 +49,46 @@ PYBIND11_MODULE(_aieMlir, m) {
       },
       py::arg("context"), py::arg("load") = true);
 
+  m.def(
+      "translate_mlir_to_llvmir",
+      [](MlirOperation module) {
+        std::string llvmir;
+        py::gil_scoped_release release;
+        if (mlirLogicalResultIsFailure(
+                aieTranslateModuleToLLVMIR(module, appendToString, &llvmir)))
+          throw py::value_error("Failed to translate the module to LLVM IR");
+        return llvmir;
+      },
+      "Translate a module lowered to the LLVM dialect to LLVM IR.",
+      py::arg("module"));
+
+  m.def(
+      "generate_xaie",
+      [](MlirOperation module) {
+        std::string xaie;
+        py::gil_scoped_release release;
+        if (mlirLogicalResultIsFailure(
+                aieTranslateToXAIEV2(module, appendToString, &xaie)))
+          throw py::value_error("Failed to generate the libxaie code");
+        return xaie;
+      },
+      "Generate the libxaie configuration code of a physical design.",
+      py::arg("module"));
+
+  m.def(
+      "estimate_performance",
+      [](MlirOperation module) {
+        std::string report;
+        py::gil_scoped_release release;
+        if (mlirLogicalResultIsFailure(
+                aieEstimatePerformance(module, appendToString, &report)))
+          throw py::value_error("Failed to estimate the performance");
+        return report;
+      },
+      "Estimate the steady state of the dataflow of the objectFifos of each "
+      "device, as JSON.",
+      py::arg("module"));
+
   // AIE types bindings
   mlir_type_subclass(m, "ObjectFifoType", aieTypeIsObjectFifoType)
       .def_classmethod(
@@ -54,5 +99,15 @@ PYBIND11_MODULE(_aieMlir, m) {
           "Get an instance of ObjectFifoType with given element type.",
           py::arg("self"), py::arg("type") = py::none());
 
+  mlir_type_subclass(m, "ObjectFifoSubviewType",
+                     aieTypeIsObjectFifoSubviewType)
+      .def_classmethod(
+          "get",
+          [](py::object cls, MlirType type) {
+            return cls(aieObjectFifoSubviewTypeGet(type));
+          },
+          "Get an instance of ObjectFifoSubviewType with given element type.",
+          py::arg("self"), py::arg("type") = py::none());
+
   m.attr("__version__") = "dev";
 }
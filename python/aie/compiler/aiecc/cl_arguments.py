@@ -111,6 +111,11 @@ def parse_args(args=None):
             default=False,
             action='store_const', const=True,
             help='Generate airbin configuration (default is off)')
+    parser.add_argument('--airbin-compress',
+            dest="airbin_compress",
+            default=False,
+            action='store_true',
+            help='Run-length encode the airbin configuration (default is off)')
     parser.add_argument("host_args",
             action='store',
             help='arguments for host compiler',
@@ -125,6 +130,10 @@ def parse_args(args=None):
             default=False,
             action='store_true',
             help='Profile commands to find the most expensive executions.')
+    parser.add_argument('--trace',
+            dest="trace_file",
+            default=None,
+            help='Write the timeline of the commands run, with their stage, core and peak memory, to this file in the Chrome trace event format')
     parser.add_argument('--unified',
             dest="unified",
             default=aie_unified_compile,
@@ -135,6 +144,38 @@ def parse_args(args=None):
             default=not aie_unified_compile,
             action='store_false',
             help='Compile cores independently in separate processes')
+    parser.add_argument('--infer-stack-size',
+            dest="infer_stack_size",
+            default=False,
+            action='store_true',
+            help='Size the stack of each core from its compiled code and assign buffer addresses again')
+    parser.add_argument('--stack-size-margin',
+            dest="stack_size_margin",
+            default=256,
+            type=int,
+            help='Bytes added to inferred stack sizes for library functions (default is 256)')
+    parser.add_argument('--dedup-cores',
+            dest="dedup_cores",
+            default=False,
+            action='store_true',
+            help='Build the cores with identical lowered code and memory maps once, and load their ELF file from memory. With --unified, lower the cores with the same code but for their buffers to one shared function instead')
+    parser.add_argument('--cache-dir',
+            dest="cache_dir",
+            default=os.environ.get('AIECC_CACHE_DIR'),
+            help='Reuse the object and ELF files of the cores compiled before with the same code, memory map, tools and options from this directory (default is $AIECC_CACHE_DIR, or no cache)')
+    parser.add_argument('--remote-hosts',
+            dest="remote_hosts",
+            default=None,
+            help='Run the chess compilations of the cores on these comma-separated hosts, each given as host or host:jobs for several jobs at once. The hosts need the same tools at the same paths as this one')
+    parser.add_argument('--remote-shell',
+            dest="remote_shell",
+            default='ssh',
+            help='Command reaching a remote host, followed by the host and the shell command to run there (default is ssh)')
+    parser.add_argument('--in-process',
+            dest="in_process",
+            default=False,
+            action='store_true',
+            help='Run the aie-opt passes and the aie-translate translations of the flow through the Python bindings, without starting a process for each')
     parser.add_argument('-n',
             dest="execute",
             default=True,
@@ -18,9 +18,17 @@ import time
 import subprocess
 import shutil
 import asyncio
+import contextlib
+import contextvars
+import glob
+import hashlib
+import io
+import json
+import shlex
+import tempfile
 
 from aie.mlir.passmanager import PassManager
-from aie.mlir.ir import Module, Context, Location
+from aie.mlir.ir import Module, Context, Location, IntegerAttr, IntegerType, StringAttr
 from aie.dialects import aie as aiedialect
 
 import aie.compiler.aiecc.cl_arguments
@@ -32,6 +40,7 @@ import re
 aie_opt_passes = ['--aie-normalize-address-spaces',
                   '--canonicalize',
                   '--cse',
+                  '--convert-aievec-to-llvm',
                   '--convert-vector-to-llvm',
                   '--expand-strided-metadata',
                   '--lower-affine',
@@ -40,18 +49,107 @@ aie_opt_passes = ['--aie-normalize-address-spaces',
                   '--convert-memref-to-llvm',
                   '--convert-func-to-llvm=use-bare-ptr-memref-call-conv',
                   '--convert-cf-to-llvm',
+                  '--reconcile-unrealized-casts',
                   '--canonicalize',
                   '--cse']
 
+# The passes of aie_opt_passes as a textual pipeline, for the core-pipeline of
+# aie-standard-lowering.
+aie_opt_pipeline = ','.join(
+    name + ('{' + options + '}' if options else '')
+    for name, _, options in (p[2:].partition('=') for p in aie_opt_passes))
+
+# The stage of the flow and the core the commands of the current task belong
+# to, for the timeline of the build.
+current_stage = contextvars.ContextVar('current_stage', default='setup')
+current_core = contextvars.ContextVar('current_core', default=None)
+
+# Run a command to completion, and return its exit code and its peak resident
+# set size in kilobytes.
+def run_with_rusage(command):
+  proc = subprocess.Popen(command)
+  if(not hasattr(os, 'wait4')):
+    return proc.wait(), None
+  _, status, rusage = os.wait4(proc.pid, 0)
+  proc.returncode = os.waitstatus_to_exitcode(status)
+  return proc.returncode, rusage.ru_maxrss
+
+# Return module as MLIR bytecode, which the flow passes between the Python
+# bindings, aie-opt and aie-translate instead of the text of the module: it
+# is much faster to write and to parse again for large designs.
+def module_bytecode(module):
+  f = io.BytesIO()
+  module.operation.write_bytecode(f)
+  return f.getvalue()
+
+# Return the text of the contents of an MLIR file, which the tools may have
+# written as bytecode.
+def module_text(contents):
+  if(not contents.startswith(b'ML\xefR')):
+    return contents.decode()
+  with Context() as ctx, Location.unknown():
+    aiedialect.register_dialect(ctx)
+    return str(Module.parse(contents))
+
 class flow_runner:
-  def __init__(self, mlir_module_str, opts, tmpdirname):
-      self.mlir_module_str = mlir_module_str
+  # mlir_module is the MLIR bytecode or text of the design.  The runner of
+  # a device of a design with several devices shares the workers, the
+  # progress bar and the timeline of the runner of the design, its parent.
+  def __init__(self, mlir_module, opts, tmpdirname, parent=None):
+      self.mlir_module = mlir_module
       self.opts = opts
       self.tmpdirname = tmpdirname
-      self.runtimes = dict()
-      self.progress_bar = None
       self.maxtasks = 5
       self.stopall = False
+      # The directory of the ELF files of the cores, relative to the one the
+      # host code runs in.
+      self.elfdir = ''
+      self.compile_host = True
+      if parent:
+        self.runtimes = parent.runtimes
+        self.progress_bar = parent.progress_bar
+        self.start_time = parent.start_time
+        self.events = parent.events
+        self.lanes = parent.lanes
+        self.limit = parent.limit
+        self.remote_slots = parent.remote_slots
+        return
+      self.runtimes = dict()
+      self.progress_bar = None
+      self.start_time = time.time()
+      # The commands run and the waits for a worker, as Chrome trace events.
+      self.events = []
+      self.lanes = {'commands': [], 'waits': []}
+
+  # Return the first free lane of the timeline, in which the events do not
+  # overlap, and mark it as busy.
+  def take_lane(self, kind):
+      lanes = self.lanes[kind]
+      lane = lanes.index(False) if False in lanes else len(lanes)
+      if(lane == len(lanes)):
+        lanes.append(True)
+      lanes[lane] = True
+      return lane
+
+  def record_event(self, kind, lane, name, start, end, args):
+      self.lanes[kind][lane] = False
+      args['stage'] = current_stage.get()
+      core = current_core.get()
+      if(core is not None):
+        args['core'] = '(%d, %d)' % core[0:2]
+      self.events.append({'name': name, 'cat': args['stage'], 'ph': 'X',
+                          'pid': 1 if kind == 'commands' else 2, 'tid': lane,
+                          'ts': int((start - self.start_time) * 1e6),
+                          'dur': int((end - start) * 1e6), 'args': args})
+
+  # Wait for a free worker, and record how long the task waited for it.
+  @contextlib.asynccontextmanager
+  async def worker(self):
+      lane = self.take_lane('waits')
+      start = time.time()
+      async with self.limit:
+        self.record_event('waits', lane, 'wait for worker', start, time.time(), dict())
+        yield
 
   async def do_call(self, task, command, force=False):
       if(self.stopall):
@@ -60,29 +158,119 @@ class flow_runner:
       commandstr = " ".join(command)
       if(task):
         self.progress_bar.update(task, advance=0, command=commandstr[0:30])
+      lane = self.take_lane('commands')
       start = time.time()
       if(self.opts.verbose):
           print(commandstr)
-      if(self.opts.execute or force):
+      maxrss = None
+      if((self.opts.execute or force) and (self.opts.trace_file or self.opts.profiling)):
+        loop = asyncio.get_running_loop()
+        ret, maxrss = await loop.run_in_executor(None, run_with_rusage, command)
+      elif(self.opts.execute or force):
         proc = await asyncio.create_subprocess_exec(*command)
         await proc.wait()
         ret = proc.returncode
       else:
         ret = 0
+      args = {'command': commandstr}
+      if(maxrss is not None):
+        args['max_rss_kb'] = maxrss
+      self.finish_call(task, command, lane, start, args, ret != 0)
+
+  # Run command on a free remote host with --remote-hosts, or here without.
+  # The inputs are copied to the remote host under a directory with the path
+  # of the current one, where command runs with the same tools at the same
+  # paths, and the outputs are copied back, all through a single connection.
+  async def do_remote_call(self, task, command, inputs, outputs):
+      if(self.remote_slots is None):
+        await self.do_call(task, command)
+        return
+      host = await self.remote_slots.get()
+      try:
+        cwd = shlex.quote(os.getcwd())
+        remote = 'export PATH=%s AIETOOLS=%s && mkdir -p %s && cd %s && tar -xPf - && %s && tar -cPf - %s' % (
+          shlex.quote(os.environ['PATH']), shlex.quote(os.environ.get('AIETOOLS', '')),
+          cwd, cwd, shlex.join(command), shlex.join(outputs))
+        pipeline = 'tar -cPf - %s | %s %s %s | tar -xPf -' % (
+          shlex.join(inputs), self.opts.remote_shell, shlex.quote(host), shlex.quote(remote))
+        await self.do_call(task, ['sh', '-c', pipeline])
+      finally:
+        self.remote_slots.put_nowait(host)
+
+  # Run function(*args) in a thread instead of command, so that the event
+  # loop keeps starting other commands, and report it like do_call.
+  async def do_in_process(self, task, command, function, *args):
+      if(self.stopall):
+        return
+
+      commandstr = " ".join(command)
+      if(task):
+        self.progress_bar.update(task, advance=0, command=commandstr[0:30])
+      lane = self.take_lane('commands')
+      start = time.time()
+      if(self.opts.verbose):
+          print(commandstr + " (in process)")
+      error = None
+      if(self.opts.execute):
+        loop = asyncio.get_running_loop()
+        try:
+          await loop.run_in_executor(None, function, *args)
+        except Exception as e:
+          error = e
+          print(e)
+      self.finish_call(task, command, lane, start, {'command': commandstr, 'in_process': True}, error is not None)
+
+  def finish_call(self, task, command, lane, start, args, failed):
+      commandstr = args['command']
       end = time.time()
       if(self.opts.verbose):
           print("Done in %.3f sec: %s" % (end-start, commandstr))
       self.runtimes[commandstr] = end-start
+      self.record_event('commands', lane, os.path.basename(command[0]), start, end, args)
       if(task):
         self.progress_bar.update(task, advance=1, command="")
         self.maxtasks = max(self.progress_bar._tasks[task].completed, self.maxtasks)
         self.progress_bar._tasks[task].total = self.maxtasks
 
-      if(ret != 0):
-          self.progress_bar._tasks[task].description = "[red] Error"
+      if(failed):
+          if(task):
+            self.progress_bar._tasks[task].description = "[red] Error"
           print("Error encountered while running: " + commandstr)
           sys.exit(1)
 
+  # Parse input_file, run pass_pipeline on it and write the result as
+  # bytecode, or its translation by translate, to output_file.
+  def transform(self, pass_pipeline, input_file, output_file, translate=None):
+      with Context() as ctx, Location.unknown():
+        aiedialect.register_dialect(ctx)
+        with open(input_file, 'rb') as f:
+          module = Module.parse(f.read())
+        if pass_pipeline:
+          PassManager.parse(pass_pipeline).run(module)
+        if output_file and translate:
+          with open(output_file, 'w') as f:
+            f.write(translate(module.operation))
+        elif output_file:
+          with open(output_file, 'wb') as f:
+            f.write(module_bytecode(module))
+
+  # Run aie-opt with options on input_file, or with --in-process, the
+  # equivalent pass_pipeline in this process.
+  async def aie_opt(self, task, options, pass_pipeline, input_file, output_file):
+      command = ['aie-opt', *options, '--emit-bytecode', input_file, '-o', output_file or os.devnull]
+      if(self.opts.in_process):
+        await self.do_in_process(task, command, self.transform, pass_pipeline, input_file, output_file)
+      else:
+        await self.do_call(task, command)
+
+  async def translate_to_llvmir(self, task, input_file, output_file):
+      command = ['aie-translate', '--opaque-pointers=0', '--mlir-to-llvmir', input_file, '-o', output_file]
+      if(self.opts.in_process):
+        await self.do_in_process(task, command, self.transform, None, input_file, output_file,
+                                 aiedialect.translate_mlir_to_llvmir)
+      else:
+        await self.do_call(task, command)
+
   def do_run(self, command):
       if(self.opts.verbose):
           print(" ".join(command))
@@ -90,18 +278,232 @@ class flow_runner:
       ret = subprocess.run(command, stdout=m, stderr=m, universal_newlines=True)
       return ret
 
-  def run_passes(self, pass_pipeline, mlir_module_str, outputfile=None):
+  # Run pass_pipeline on mlir_module and return the result as bytecode.  If
+  # given, inspect is called on the resulting module before it is written.
+  def run_passes(self, pass_pipeline, mlir_module, outputfile=None, inspect=None):
       if self.opts.verbose:
         print("Running:", pass_pipeline)
+      lane = self.take_lane('commands')
+      start = time.time()
       with Context() as ctx, Location.unknown():
         aiedialect.register_dialect(ctx)
-        module = Module.parse(mlir_module_str)
+        module = Module.parse(mlir_module)
         PassManager.parse(pass_pipeline).run(module)
-        mlir_module_str = str(module)
+        if inspect:
+          inspect(module)
+        mlir_module = module_bytecode(module)
         if outputfile:
-          with open(outputfile, 'w') as g:
-            g.write(mlir_module_str)
-      return mlir_module_str
+          with open(outputfile, 'wb') as g:
+            g.write(mlir_module)
+      self.record_event('commands', lane, 'aiecc passes', start, time.time(), {'command': pass_pipeline})
+      return mlir_module
+
+  # Read the cores of the first device of module, as (col, row, elf_file)
+  # tuples in the order of their tiles, and the architecture of the device,
+  # like aie-translate --aie-generate-corelist and --aie-generate-target-arch.
+  def inspect_design(self, module):
+      self.cores = []
+      self.aie_target = 'AIE'
+      devices = [op.operation for op in module.body.operations if op.operation.name == 'AIE.device']
+      self.num_devices = len(devices)
+      if not devices:
+        return
+      # AIEDevice::xcvc1902 is the only AIE1 device.
+      if IntegerAttr(devices[0].attributes['device']).value != 1:
+        self.aie_target = 'AIE2'
+      tiles = []
+      elf_files = dict()
+      for op in devices[0].regions[0].blocks[0].operations:
+        if op.operation.name == 'AIE.tile':
+          tiles.append((IntegerAttr(op.operation.attributes['col']).value,
+                        IntegerAttr(op.operation.attributes['row']).value))
+        elif op.operation.name == 'AIE.core':
+          tile = op.operation.operands[0].owner
+          key = (IntegerAttr(tile.attributes['col']).value,
+                 IntegerAttr(tile.attributes['row']).value)
+          elf_file = None
+          if 'elf_file' in op.operation.attributes:
+            elf_file = StringAttr(op.operation.attributes['elf_file']).value
+          elf_files[key] = elf_file
+      self.cores = [(*key, elf_files[key]) for key in tiles if key in elf_files]
+
+  # Return a copy of mlir_module, as bytecode, where the cores in
+  # stack_sizes, keyed by the coordinates of their tile, have the given
+  # stackSize.
+  def set_stack_sizes(self, mlir_module, stack_sizes):
+      with Context() as ctx, Location.unknown():
+        aiedialect.register_dialect(ctx)
+        module = Module.parse(mlir_module)
+        ops = list(module.body.operations)
+        for op in ops:
+          if op.operation.name == 'AIE.device':
+            ops += list(op.operation.regions[0].blocks[0].operations)
+          elif op.operation.name == 'AIE.core':
+            tile = op.operation.operands[0].owner
+            key = (IntegerAttr(tile.attributes['col']).value,
+                   IntegerAttr(tile.attributes['row']).value)
+            if key in stack_sizes:
+              op.operation.attributes['stackSize'] = IntegerAttr.get(
+                  IntegerType.get_signless(32), stack_sizes[key])
+        return module_bytecode(module)
+
+  # Compile a core on its own with LLVM's stack size section, and return the
+  # sum of the frames of its functions, which bounds any call chain without
+  # recursion.  Library functions linked in later are covered by a margin.
+  async def infer_stack_size(self, core):
+    async with self.worker():
+      current_stage.set('stack size')
+      current_core.set(core)
+      file_opt_core = self.corefile(self.stackdir, core, "mlir")
+      file_core_llvmir = self.tmpcorefile(core, "stack.ll")
+      await self.translate_to_llvmir(None, file_opt_core, file_core_llvmir)
+      file_core_llvmir_opt = self.tmpcorefile(core, "stack.opt.ll")
+      await self.do_call(None, ['opt', '--passes=default<O2>,strip', '-S', file_core_llvmir, '-o', file_core_llvmir_opt])
+      file_core_obj = self.tmpcorefile(core, "stack.o")
+      await self.do_call(None, ['llc', file_core_llvmir_opt, '-O2', '--march=%s' % self.aie_target.lower(), '--function-sections', '--stack-size-section', '--filetype=obj', '-o', file_core_obj])
+      command = ['llvm-readobj', '--stack-sizes', file_core_obj]
+      if(not self.opts.execute):
+        if(self.opts.verbose):
+          print(" ".join(command))
+        return None
+      t = self.do_run(command)
+      if(t.returncode != 0):
+        return None
+      frames = sum(int(size) for size in re.findall(r'Size: (\d+)', t.stdout))
+      stack_size = frames + self.opts.stack_size_margin
+      # keep the stack aligned for vector spills
+      return (stack_size + 31) // 32 * 32
+
+  # Set the stack size of each core to the size inferred from its code, and
+  # redo the assignment of buffer addresses with it.
+  async def infer_stack_sizes(self, cores, pass_pipeline):
+      if(opts.xchesscc or opts.unified):
+        print("Stack size inference requires separate compilation with peano, ignoring --infer-stack-size")
+        return
+      self.stackdir = os.path.join(self.tmpdirname, 'stack')
+      await self.lower_cores(None, self.stackdir)
+      sizes = await asyncio.gather(*[self.infer_stack_size(core) for core in cores])
+      stack_sizes = dict()
+      for core, size in zip(cores, sizes):
+        if size is not None:
+          stack_sizes[core[0:2]] = size
+          if(self.opts.verbose):
+            print("Inferred a stack of %d bytes for core (%d, %d)" % (size, *core[0:2]))
+      if not stack_sizes:
+        return
+      self.mlir_module = self.set_stack_sizes(self.mlir_module, stack_sizes)
+      self.run_passes('builtin.module('+pass_pipeline+')', self.mlir_module, self.file_with_addresses)
+
+  # Return a copy of mlir_module for each of its devices, as bytecode, which
+  # only holds that device, like aie-translate --aie-device.
+  def split_devices(self, mlir_module):
+      with Context() as ctx, Location.unknown():
+        aiedialect.register_dialect(ctx)
+        modules = []
+        for index in range(self.num_devices):
+          module = Module.parse(mlir_module)
+          devices = [op.operation for op in module.body.operations if op.operation.name == 'AIE.device']
+          for (i, device) in enumerate(devices):
+            if i != index:
+              device.erase()
+          modules.append(module_bytecode(module))
+        return modules
+
+  # Return a copy of mlir_module, as bytecode, where the cores in elf_files,
+  # keyed by the coordinates of their tile, run the given ELF file.
+  def set_elf_files(self, mlir_module, elf_files):
+      with Context() as ctx, Location.unknown():
+        aiedialect.register_dialect(ctx)
+        module = Module.parse(mlir_module)
+        ops = list(module.body.operations)
+        for op in ops:
+          if op.operation.name == 'AIE.device':
+            ops += list(op.operation.regions[0].blocks[0].operations)
+          elif op.operation.name == 'AIE.core':
+            tile = op.operation.operands[0].owner
+            key = (IntegerAttr(tile.attributes['col']).value,
+                   IntegerAttr(tile.attributes['row']).value)
+            if key in elf_files:
+              op.operation.attributes['elf_file'] = StringAttr.get(elf_files[key])
+        return module_bytecode(module)
+
+  # Lower all the cores in one aie-opt run, into one module per core in
+  # dirname, parsing the input once and lowering the cores in parallel.
+  async def lower_cores(self, task, dirname):
+      current_stage.set('core lowering')
+      await self.aie_opt(task, ['--aie-localize-locks',
+                                '--aie-standard-lowering=output-dir=%s core-pipeline=%s emit-bytecode' % (dirname, aie_opt_pipeline)],
+                         'builtin.module(AIE.device(aie-localize-locks),'
+                         'aie-standard-lowering{output-dir=%s core-pipeline={%s} emit-bytecode})' % (dirname, aie_opt_pipeline),
+                         self.file_with_addresses, None)
+
+  # Return a hash of the lowered code of a core and of its memory map, in
+  # which the name of the core and of the buffers it can access are replaced
+  # by their addresses.  Cores with the same hash build the same ELF file.
+  async def hash_core(self, core):
+    async with self.worker():
+      (corecol, corerow, _) = core
+      file_opt_core = self.corefile(self.coredir, core, "mlir")
+      if(self.opts.xbridge):
+        file_core_map = self.tmpcorefile(core, "bcf")
+        symbol = re.compile(r'^_symbol (\w+) (0x[0-9A-F]+) 0x[0-9A-F]+(?: // \w+)?$', re.M)
+      else:
+        file_core_map = self.tmpcorefile(core, "ld.script")
+        symbol = re.compile(r'^\. = (0x[0-9A-F]+);\n(\w+) = \.;(?: /\* \w+ \*/)?$', re.M)
+      if(not self.opts.execute):
+        return None
+      with open(file_opt_core, 'rb') as f:
+        code = module_text(f.read())
+      with open(file_core_map) as f:
+        memory_map = f.read()
+      addresses = dict()
+      for m in symbol.finditer(memory_map):
+        (name, address) = m.groups() if self.opts.xbridge else reversed(m.groups())
+        addresses[name] = address
+      # Both files only use the names as whole words.
+      names = [re.escape(name) for name in addresses]
+      names.append('core_%d_%d' % (corecol, corerow))
+      word = re.compile(r'\b(%s)\b' % '|'.join(names))
+      rename = lambda m: addresses.get(m.group(1), 'core')
+      contents = word.sub(rename, code) + word.sub(rename, memory_map)
+      return hashlib.sha256(contents.encode()).hexdigest()
+
+  # Build the cores with the same code and memory map once, and make the
+  # others run the ELF file of the first one.  Return the cores to build.
+  async def dedup_cores(self, cores):
+      # The unified compilation shares the code of identical cores when
+      # they are lowered instead.
+      if(opts.unified):
+        return cores
+      keys = await asyncio.gather(*[self.hash_core(core) for core in cores])
+      first = dict()
+      elf_files = dict()
+      unique = []
+      for core, key in zip(cores, keys):
+        (corecol, corerow, elf_file) = core
+        # Cores with an explicit ELF file are built as they are.
+        if key is None or elf_file:
+          unique.append(core)
+        elif key in first:
+          elf_files[core[0:2]] = 'core_%d_%d.elf' % first[key][0:2]
+          if(self.opts.verbose):
+            print("Core (%d, %d) runs the ELF file of core (%d, %d)" % (*core[0:2], *first[key][0:2]))
+        else:
+          first[key] = core
+          unique.append(core)
+      if elf_files:
+        with open(self.file_with_addresses, 'rb') as f:
+          mlir_module = f.read()
+        with open(self.file_with_addresses, 'wb') as f:
+          f.write(self.set_elf_files(mlir_module, elf_files))
+      return unique
+
+  # Generate the linker scripts and BCF files of all the cores in one
+  # aie-translate run.
+  async def generate_memory_maps(self):
+      current_stage.set('memory maps')
+      await self.do_call(None, ['aie-translate', '--aie-generate-all', '--aie-output-dir=' + self.tmpdirname,
+                                self.file_with_addresses, '-o', os.path.join(self.tmpdirname, 'generated_files')])
 
   def corefile(self, dirname, core, ext):
       (corecol, corerow, _) = core
@@ -118,6 +520,38 @@ class flow_runner:
         result += ['-D__AIEARCH__=10']
       return result
 
+  # Return the overlays the gnu linker script of a core links in the overlay
+  # window of its program memory.
+  def core_overlays(self, file_core_ldscript):
+      with open(file_core_ldscript) as f:
+        return re.findall(r'^    \.overlay(\d+) \{', f.read(), re.M)
+
+  # Move the overlays of a core out of its ELF file, to the
+  # core_<col>_<row>.overlay<N>.bin files the host code loads them from.
+  async def extract_overlays(self, task, core, overlays, file_core_elf):
+      for overlay in overlays:
+        await self.do_call(task, ['llvm-objcopy', '-O', 'binary', '--only-section=.overlay' + overlay,
+                                  file_core_elf, self.corefile(self.elfdir, core, "overlay%s.bin" % overlay)])
+      await self.do_call(task, ['llvm-objcopy', *['--remove-section=.overlay' + o for o in overlays], file_core_elf])
+
+  # The startup object the core is linked with: me_basic_minimal.o, which
+  # calls the core function straight away, unless the objects of the core
+  # have static constructors, which me_basic.o runs first.  The gnu linker
+  # script places either at address zero.
+  def core_startup(self, runtime_lib_path, file_core_obj, file_core_ldscript):
+      me_basic_o = os.path.join(runtime_lib_path, 'me_basic.o')
+      me_basic_minimal_o = os.path.join(runtime_lib_path, 'me_basic_minimal.o')
+      if(not os.path.isfile(me_basic_minimal_o)):
+        return me_basic_o
+      with open(file_core_ldscript) as f:
+        objects = [file_core_obj] + re.findall(r'^INPUT\((\S+)\)$', f.read(), re.M)
+      if(not all(os.path.isfile(o) for o in objects)):
+        return me_basic_o
+      sections = self.do_run(['llvm-readelf', '--sections', *objects])
+      if(sections.returncode != 0 or re.search(r'\.(init_array|ctors)\b', sections.stdout)):
+        return me_basic_o
+      return me_basic_minimal_o
+
   # Extract included files from the given Chess linker script.
   # We rely on gnu linker scripts to stuff object files into a compile.  However, the Chess compiler doesn't 
   # do this, so we have to explicitly specify included files on the link line.
@@ -125,37 +559,15 @@ class flow_runner:
       t = self.do_run(['awk', '/_include _file/ {print($3)}', file_core_bcf])
       return ' '.join(t.stdout.split())
 
-  # In order to run xchesscc on modern ll code, we need a bunch of hacks.
-  async def chesshack(self, task, llvmir):
-      llvmir_chesshack = llvmir + "chesshack.ll"
-      await self.do_call(task, ['cp', llvmir, llvmir_chesshack])
-      await self.do_call(task, ['sed', '-i', 's/noundef//', llvmir_chesshack])
-      await self.do_call(task, ['sed', '-i', 's/noalias_sidechannel[^,],//', llvmir_chesshack])
-      llvmir_chesslinked = llvmir + "chesslinked.ll"
-      # Note that chess-clang comes from a time before opaque pointers
-      #await self.do_call(task, ['clang', "-Xclang -no-opaque-pointers", llvmir_chesshack, self.chess_intrinsic_wrapper, '-S', '-emit-llvm', '-o', llvmir_chesslinked])
-      await self.do_call(task, ['llvm-link', '--opaque-pointers=0', llvmir_chesshack, self.chess_intrinsic_wrapper, '-S', '-o', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', 's/noundef//', llvmir_chesslinked])
-      # Formal function argument names not used in older LLVM
-      await self.do_call(task, ['sed', '-i', '-E', '/define .*@/ s/%[0-9]*//g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/mustprogress//g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/poison/undef/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/nocallback//g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(none\)/readnone/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(read\)/readonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(write\)/writeonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: readwrite\)/argmemonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: read\)/argmemonly readonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: write\)/argmemonly writeonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(inaccessiblemem: readwrite\)/inaccessiblememonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(inaccessiblemem: read\)/inaccessiblememonly readonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(inaccessiblemem: write\)/inaccessiblememonly writeonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: readwrite, inaccessiblemem: readwrite\)/inaccessiblemem_or_argmemonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: read, inaccessiblemem: read\)/inaccessiblemem_or_argmemonly readonly/g', llvmir_chesslinked])
-      await self.do_call(task, ['sed', '-i', '-E', 's/memory\(argmem: write, inaccessiblemem: write\)/inaccessiblemem_or_argmemonly writeonly/g', llvmir_chesslinked])
-      return llvmir_chesslinked
+  # xchesscc parses the LLVM IR of an older LLVM: translate the cores to the
+  # LLVM IR it parses, linked with the chess intrinsic wrapper, in one step.
+  async def translate_to_chess_llvmir(self, task, input_file, output_file):
+      await self.do_call(task, ['aie-translate', '--opaque-pointers=0', '--aie-generate-chess-llvmir',
+                                '--chess-intrinsic-wrapper=' + self.chess_intrinsic_wrapper,
+                                input_file, '-o', output_file])
 
   async def prepare_for_chesshack(self, task):
+      current_stage.set('chess setup')
       if(opts.compile and opts.xchesscc):
         install_path = aie.compiler.aiecc.configure.install_path()
         runtime_lib_path = os.path.join(install_path, 'aie_runtime_lib')
@@ -169,10 +581,79 @@ class flow_runner:
         await self.do_call(task, ['sed', '-i', 's/nocallback[^,]*,//', self.chess_intrinsic_wrapper])
 
 
+  # Identify the tools by their path, size and modification time, so that the
+  # cached cores are built again once the tools are updated.
+  def toolchain_key(self):
+      tools = []
+      for tool in ['aie-opt', 'aie-translate', 'opt', 'llc', 'clang', 'xchesscc_wrapper']:
+        path = shutil.which(tool)
+        if path:
+          st = os.stat(path)
+          tools.append('%s %d %d' % (path, st.st_size, st.st_mtime_ns))
+      return '\n'.join(tools)
+
+  # Return the key of a core in the compilation cache, hashing its lowered
+  # code, its memory map and the files it links with, the tools and the
+  # options the ELF file depends on.  Return None if the cache is not used.
+  def core_cache_key(self, file_opt_core, file_core_map, link_files):
+      if(not self.opts.cache_dir or self.opts.unified or not self.opts.execute or not self.opts.compile):
+        return None
+      key = hashlib.sha256()
+      def add_file(path):
+        key.update(path.encode())
+        if(os.path.isfile(path)):
+          with open(path, 'rb') as f:
+            key.update(hashlib.sha256(f.read()).digest())
+      add_file(file_opt_core)
+      if(self.opts.link):
+        add_file(file_core_map)
+        with open(file_core_map) as f:
+          memory_map = f.read()
+        if(self.opts.xbridge):
+          inputs = re.findall(r'^_include _file (\S+)$', memory_map, re.M)
+        else:
+          inputs = re.findall(r'^INPUT\((\S+)\)$', memory_map, re.M)
+        for path in inputs + [p for p in link_files if os.path.isfile(p)]:
+          add_file(path)
+      # The commands are given by this script.
+      add_file(os.path.abspath(__file__))
+      key.update(self.toolchain.encode())
+      key.update(repr((self.aie_target, self.opts.xchesscc, self.opts.xbridge, self.opts.link)).encode())
+      return key.hexdigest()
+
+  # Copy the files of a core from its entry in the compilation cache, and
+  # return whether it has them all.
+  def restore_core(self, key, files):
+      entry = os.path.join(self.opts.cache_dir, key)
+      cached = {ext: os.path.join(entry, 'core.' + ext) for ext in files}
+      if(not all(os.path.isfile(path) for path in cached.values())):
+        return False
+      for ext, path in files.items():
+        shutil.copyfile(cached[ext], path)
+      return True
+
+  # Store the files of a core in the compilation cache.  The entry is renamed
+  # into place once complete, so that concurrent builds never see a partial
+  # one.
+  def store_core(self, key, files):
+      if(not all(os.path.isfile(path) for path in files.values())):
+        return
+      os.makedirs(self.opts.cache_dir, exist_ok=True)
+      staging = tempfile.mkdtemp(dir=self.opts.cache_dir)
+      for ext, path in files.items():
+        shutil.copyfile(path, os.path.join(staging, 'core.' + ext))
+      try:
+        os.rename(staging, os.path.join(self.opts.cache_dir, key))
+      except OSError:
+        # Another build stored the same core first.
+        shutil.rmtree(staging, ignore_errors=True)
+
   async def process_core(self, core):
-    async with self.limit:
+    async with self.worker():
       if(self.stopall):
         return
+      current_stage.set('core compilation')
+      current_core.set(core)
 
       install_path = aie.compiler.aiecc.configure.install_path()
       runtime_lib_path = os.path.join(install_path, 'aie_runtime_lib', self.aie_target.upper())
@@ -180,7 +661,6 @@ class flow_runner:
       # The build path for libc can be very different from where it's installed.
       llvmlibc_build_lib_path = os.path.join(clang_path, '..', 'runtimes', 'runtimes-' + self.aie_target.lower() + '-none-unknown-elf-bins', 'libc', 'lib', 'libc.a')
       llvmlibc_install_lib_path = os.path.join(clang_path, '..', 'lib', self.aie_target.lower() + '-none-unknown-elf', 'libc.a')
-      me_basic_o = os.path.join(runtime_lib_path, 'me_basic.o')
       libc = os.path.join(runtime_lib_path, 'libc.a')
       libm = os.path.join(runtime_lib_path, 'libm.a')
       libsoftfloat = os.path.join(runtime_lib_path, 'libsoftfloat.a')
@@ -189,7 +669,8 @@ class flow_runner:
       else:
         libc = llvmlibc_install_lib_path
 
-      clang_link_args = [me_basic_o, libc, '-Wl,--gc-sections']
+      # The startup object is chosen once the core is compiled.
+      clang_link_args = [libc, '-Wl,--gc-sections']
 
       if(opts.progress):
         task = self.progress_bar.add_task("[yellow] Core (%d, %d)" % core[0:2], total=self.maxtasks, command="starting")
@@ -197,67 +678,85 @@ class flow_runner:
         task = None
 
       (corecol, corerow, elf_file) = core
-      if(not opts.unified):
-        file_core = self.tmpcorefile(core, "mlir")
-        await self.do_call(task, ['aie-opt', '--aie-localize-locks',
-                            '--aie-standard-lowering=tilecol=%d tilerow=%d' % core[0:2],
-                            self.file_with_addresses, '-o', file_core])
-        file_opt_core = self.tmpcorefile(core, "opt.mlir")
-        await self.do_call(task, ['aie-opt', *aie_opt_passes, file_core, '-o', file_opt_core])
-      if(self.opts.xbridge):
-        file_core_bcf = self.tmpcorefile(core, "bcf")
-        await self.do_call(task, ['aie-translate', self.file_with_addresses, '--aie-generate-bcf', '--tilecol=%d' % corecol, '--tilerow=%d' % corerow, '-o', file_core_bcf])
-      else:
-        file_core_ldscript = self.tmpcorefile(core, "ld.script")
-        await self.do_call(task, ['aie-translate', self.file_with_addresses, '--aie-generate-ldscript', '--tilecol=%d' % corecol, '--tilerow=%d' % corerow, '-o', file_core_ldscript])
-      if(not self.opts.unified):
-        file_core_llvmir = self.tmpcorefile(core, "ll")
-        await self.do_call(task, ['aie-translate', '--opaque-pointers=0', '--mlir-to-llvmir', file_opt_core, '-o', file_core_llvmir])
-        file_core_obj = self.tmpcorefile(core, "o")
-
-      file_core_elf = elf_file if elf_file else self.corefile(".", core, "elf")
-
-      if(opts.compile and opts.xchesscc):
-        if(not opts.unified):
-          file_core_llvmir_chesslinked = await self.chesshack(task, file_core_llvmir)
-          if(self.opts.link and self.opts.xbridge):
-            link_with_obj = self.extract_input_files(file_core_bcf)
-            await self.do_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-d', '-f', '+P', '4', file_core_llvmir_chesslinked, link_with_obj, '+l', file_core_bcf, '-o', file_core_elf])
-          elif(self.opts.link):
-            await self.do_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-c', '-d', '-f', '+P', '4', file_core_llvmir_chesslinked, '-o', file_core_obj])
-            await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj, *clang_link_args,
-                                      '-Wl,-T,'+file_core_ldscript, '-o', file_core_elf])
-        else:
-          file_core_obj = self.file_obj
+      # The cores are lowered by lower_cores.
+      file_opt_core = self.corefile(self.coredir, core, "mlir")
+      # The memory maps of the cores are generated by generate_memory_maps.
+      file_core_bcf = self.tmpcorefile(core, "bcf")
+      file_core_ldscript = self.tmpcorefile(core, "ld.script")
+      file_core_elf = elf_file if elf_file else self.corefile(self.elfdir, core, "elf")
+
+      file_core_map = file_core_bcf if(self.opts.xbridge) else file_core_ldscript
+      cached_files = {'elf': file_core_elf} if(self.opts.link) else {'o': self.tmpcorefile(core, "o")}
+      overlays = self.core_overlays(file_core_ldscript) if(self.opts.link) else []
+      if(overlays and self.opts.xbridge):
+        sys.exit("The overlays of core (%d, %d) need the gnu linker script, use --no-xbridge" % core[0:2])
+      for overlay in overlays:
+        cached_files['overlay%s.bin' % overlay] = self.corefile(self.elfdir, core, "overlay%s.bin" % overlay)
+      startup_objects = [os.path.join(runtime_lib_path, o) for o in ('me_basic.o', 'me_basic_minimal.o')]
+      cache_key = self.core_cache_key(file_opt_core, file_core_map, startup_objects + clang_link_args)
+      cached = cache_key is not None and self.restore_core(cache_key, cached_files)
+      if(cached and self.opts.verbose):
+        print("Core (%d, %d) is in the compilation cache" % core[0:2])
+      if(not cached):
+        if(not self.opts.unified):
+          file_core_llvmir = self.tmpcorefile(core, "ll")
+          if(opts.compile and opts.xchesscc):
+            await self.translate_to_chess_llvmir(task, file_opt_core, file_core_llvmir)
+          else:
+            await self.translate_to_llvmir(task, file_opt_core, file_core_llvmir)
+          file_core_obj = self.tmpcorefile(core, "o")
+
+        if(opts.compile and opts.xchesscc):
+          if(not opts.unified):
+            if(self.opts.link and self.opts.xbridge):
+              link_with_obj = self.extract_input_files(file_core_bcf)
+              await self.do_remote_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-d', '-f', '+P', '4', file_core_llvmir, link_with_obj, '+l', file_core_bcf, '-o', file_core_elf],
+                                        [file_core_llvmir, *link_with_obj.split(), file_core_bcf], [file_core_elf])
+            elif(self.opts.link):
+              await self.do_remote_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-c', '-d', '-f', '+P', '4', file_core_llvmir, '-o', file_core_obj],
+                                        [file_core_llvmir], [file_core_obj])
+              await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj,
+                                        self.core_startup(runtime_lib_path, file_core_obj, file_core_ldscript), *clang_link_args,
+                                        '-Wl,-T,'+file_core_ldscript, '-o', file_core_elf])
+          else:
+            file_core_obj = self.file_obj
+            if(opts.link and opts.xbridge):
+              link_with_obj = self.extract_input_files(file_core_bcf)
+              await self.do_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-d', '-f', file_core_obj, link_with_obj, '+l', file_core_bcf, '-o', file_core_elf])
+            elif(opts.link):
+              await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj,
+                                        self.core_startup(runtime_lib_path, file_core_obj, file_core_ldscript), *clang_link_args,
+                                        '-Wl,-T,'+file_core_ldscript, '-o', file_core_elf])
+
+        elif(opts.compile):
+          if(not opts.unified):
+            file_core_llvmir_stripped = self.tmpcorefile(core, "stripped.ll")
+            await self.do_call(task, ['opt', '--passes=default<O2>,strip', '-S', file_core_llvmir, '-o', file_core_llvmir_stripped])
+            await self.do_call(task, ['llc', file_core_llvmir_stripped, '-O2', '--march=%s' % self.aie_target.lower(), '--function-sections', '--filetype=obj', '-o', file_core_obj])
+          else:
+            file_core_obj = self.file_obj
           if(opts.link and opts.xbridge):
             link_with_obj = self.extract_input_files(file_core_bcf)
             await self.do_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-d', '-f', file_core_obj, link_with_obj, '+l', file_core_bcf, '-o', file_core_elf])
           elif(opts.link):
-            await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj, *clang_link_args,
+            await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj,
+                                      self.core_startup(runtime_lib_path, file_core_obj, file_core_ldscript), *clang_link_args,
                                       '-Wl,-T,'+file_core_ldscript, '-o', file_core_elf])
-
-      elif(opts.compile):
-        if(not opts.unified):
-          file_core_llvmir_stripped = self.tmpcorefile(core, "stripped.ll")
-          await self.do_call(task, ['opt', '--passes=default<O2>,strip', '-S', file_core_llvmir, '-o', file_core_llvmir_stripped])
-          await self.do_call(task, ['llc', file_core_llvmir_stripped, '-O2', '--march=%s' % self.aie_target.lower(), '--function-sections', '--filetype=obj', '-o', file_core_obj])
-        else:
-          file_core_obj = self.file_obj
-        if(opts.link and opts.xbridge):
-          link_with_obj = self.extract_input_files(file_core_bcf)
-          await self.do_call(task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-d', '-f', file_core_obj, link_with_obj, '+l', file_core_bcf, '-o', file_core_elf])
-        elif(opts.link):
-          await self.do_call(task, ['clang', '-O2', '--target=' + self.aie_peano_target, file_core_obj, *clang_link_args,
-                                    '-Wl,-T,'+file_core_ldscript, '-o', file_core_elf])
+        if(overlays):
+          await self.extract_overlays(task, core, overlays, file_core_elf)
+        if(cache_key is not None):
+          self.store_core(cache_key, cached_files)
 
       self.progress_bar.update(self.progress_bar.task_completed,advance=1)
       if(task):
         self.progress_bar.update(task,advance=0,visible=False)
 
   async def process_host_cgen(self):
-    async with self.limit:
+    async with self.worker():
       if(self.stopall):
+        self.physical_ready.set()
         return
+      current_stage.set('routing')
 
       if(opts.progress):
         task = self.progress_bar.add_task("[yellow] Host compilation ", total=10, command="starting")
@@ -266,13 +765,23 @@ class flow_runner:
 
       # Generate the included host interface
       file_physical = os.path.join(self.tmpdirname, 'input_physical.mlir')
-      await self.do_call(task, ['aie-opt', '--aie-create-pathfinder-flows', '--aie-lower-broadcast-packet', '--aie-create-packet-flows', '--aie-lower-multicast', self.file_with_addresses, '-o', file_physical]);
+      physical_passes = ['aie-lower-multicast', 'aie-create-pathfinder-flows', 'aie-lower-broadcast-packet', 'aie-create-packet-flows']
+      await self.aie_opt(task, ['--' + p for p in physical_passes],
+                         'builtin.module(AIE.device(%s))' % ','.join(physical_passes),
+                         self.file_with_addresses, file_physical)
+      current_stage.set('host code')
       if(opts.airbin):
         file_airbin = os.path.join(self.tmpdirname, 'air.bin')
-        await self.do_call(task, ['aie-translate', '--aie-generate-airbin', file_physical, '-o', file_airbin])
+        await self.do_call(task, ['aie-translate', '--aie-generate-airbin'] + (['--airbin-compress'] if opts.airbin_compress else []) + [file_physical, '-o', file_airbin])
       else:
         file_inc_cpp = os.path.join(self.tmpdirname, 'aie_inc.cpp')
-        await self.do_call(task, ['aie-translate', '--aie-generate-xaie', file_physical, '-o', file_inc_cpp])
+        command = ['aie-translate', '--aie-generate-xaie', file_physical, '-o', file_inc_cpp]
+        if(opts.in_process):
+          await self.do_in_process(task, command, self.transform, None, file_physical, file_inc_cpp,
+                                   aiedialect.generate_xaie)
+        else:
+          await self.do_call(task, command)
+      self.physical_ready.set()
 
       cmd = ['clang++','-std=c++11']
       if(opts.host_target):
@@ -305,25 +814,62 @@ class flow_runner:
       cmd += ['-L%s' % xaiengine_lib_path]
 
       cmd += ['-I%s' % self.tmpdirname]
-      cmd += ['-fuse-ld=lld','-lm','-lxaiengine']
+      # The scheduler of the test library runs its jobs on threads.
+      cmd += ['-fuse-ld=lld','-lm','-lxaiengine','-pthread']
 
       cmd += self.aie_target_defines()
 
-      if(len(opts.host_args) > 0):
+      if(len(opts.host_args) > 0 and self.compile_host):
         await self.do_call(task, cmd + opts.host_args)
 
       self.progress_bar.update(self.progress_bar.task_completed,advance=1)
       if(task):
         self.progress_bar.update(task,advance=0,visible=False)
 
+  # Run command to make output, unless the manifest records that output was
+  # made by the same command from inputs with the same contents.
+  async def do_sim_call(self, task, manifest, command, output, inputs):
+      if(not self.opts.execute):
+        return await self.do_call(task, command)
+      key = hashlib.sha256(repr(command).encode())
+      # A new build of the tool makes the output again.
+      tool = shutil.which(command[0])
+      if(tool):
+        info = os.stat(tool)
+        key.update(repr((tool, info.st_size, info.st_mtime_ns)).encode())
+      for path in inputs:
+        key.update(path.encode())
+        if(os.path.isfile(path)):
+          with open(path, 'rb') as f:
+            key.update(hashlib.sha256(f.read()).digest())
+      key = key.hexdigest()
+      if(os.path.isfile(output) and manifest.get(output) == key):
+        return
+      manifest.pop(output, None)
+      await self.do_call(task, command)
+      if(not self.stopall and os.path.isfile(output)):
+        manifest[output] = key
+
   async def gen_sim(self, task):
+      # The simulation is built from the physical design and the host
+      # interface generated by process_host_cgen.
+      await self.physical_ready.wait()
+      current_stage.set('simulation')
       # For simulation, we need to additionally parse the 'remaining' options to avoid things
       # which conflict with the options below (e.g. -o)
       print(opts.host_args)
       host_opts = aie.compiler.aiecc.cl_arguments.strip_host_args_for_aiesim(opts.host_args)
 
+      # The simulation directory is kept from one run to the next, and only
+      # the products whose inputs changed are made again: the ELF files of
+      # the cores, most often the only change, are loaded by the simulator.
       sim_dir = os.path.join(self.tmpdirname, 'sim')
-      shutil.rmtree(sim_dir, ignore_errors=True)
+      manifest_file = os.path.join(sim_dir, '.manifest.json')
+      try:
+        with open(manifest_file) as f:
+          manifest = json.load(f)
+      except (OSError, ValueError):
+        manifest = dict()
       subdirs = ['arch', 'reports', 'config', 'ps']
       def make_sim_dir(x):
         dir = os.path.join(sim_dir, x)
@@ -373,29 +919,56 @@ class flow_runner:
                        '-Wl,--as-needed', '-lxioutils', '-lxaiengine',
                        '-ladf_api', '-lsystemc', '-lxtlm', "-flto"
                        ]
+      file_inc_cpp = os.path.join(self.tmpdirname, 'aie_inc.cpp')
+      file_xpe = os.path.join(sim_reports_dir, 'graph.xpe')
+      file_shim_solution = os.path.join(sim_arch_dir, 'aieshim_solution.aiesol')
+      file_scsim_config = os.path.join(sim_config_dir, 'scsim_config.json')
+      file_flows = os.path.join(sim_dir, 'flows_physical.mlir')
+      file_flows_json = os.path.join(sim_dir, 'flows_physical.json')
+      file_ps = os.path.join(sim_ps_dir, 'ps.so')
+      ps_command = ['clang++', '-O2', '-fuse-ld=lld', '-shared',
+                    '-o', file_ps, sim_genwrapper,
+                    *self.aie_target_defines(),
+                    *host_opts, *sim_cc_args, *sim_link_args]
+      # The wrapper includes aie_inc.cpp and the host code, which includes
+      # the headers of the test library.
+      ps_inputs = [sim_genwrapper, file_inc_cpp, memory_allocator,
+                   *[a for a in host_opts if os.path.isfile(a)],
+                   *sorted(glob.glob(os.path.join(runtime_testlib_include_path, '*.h')))]
       processes = []
-      processes.append(self.do_call(task, ['aie-translate', '--aie-mlir-to-xpe',
-                                file_physical, '-o', os.path.join(sim_reports_dir, 'graph.xpe')]))
-      processes.append(self.do_call(task, ['aie-translate', '--aie-mlir-to-shim-solution',
-                                file_physical,
-                                '-o', os.path.join(sim_arch_dir, 'aieshim_solution.aiesol')]))
-      processes.append(self.do_call(task, ['aie-translate', '--aie-mlir-to-scsim-config',
-                                file_physical,
-                                '-o', os.path.join(sim_config_dir, 'scsim_config.json')]))
-      processes.append(self.do_call(task, ['aie-opt', '--aie-find-flows',
-                                file_physical,
-                                '-o', os.path.join(sim_dir, 'flows_physical.mlir')]))
-      processes.append(self.do_call(task, ['cp', sim_makefile, sim_dir]))
-      processes.append(self.do_call(task, ['cp', sim_genwrapper, sim_ps_dir]))
-      processes.append(self.do_call(task, ['clang++', '-O2', '-fuse-ld=lld', '-shared',
-                                '-o', os.path.join(sim_ps_dir, 'ps.so'),
-                                os.path.join(runtime_simlib_path, 'genwrapper_for_ps.cpp'),
-                                *self.aie_target_defines(),
-                                *host_opts, *sim_cc_args, *sim_link_args]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['aie-translate', '--aie-mlir-to-xpe',
+                                 file_physical, '-o', file_xpe],
+                                file_xpe, [file_physical]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['aie-translate', '--aie-mlir-to-shim-solution',
+                                 file_physical, '-o', file_shim_solution],
+                                file_shim_solution, [file_physical]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['aie-translate', '--aie-mlir-to-scsim-config',
+                                 file_physical, '-o', file_scsim_config],
+                                file_scsim_config, [file_physical]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['aie-opt', '--aie-find-flows',
+                                 file_physical, '-o', file_flows],
+                                file_flows, [file_physical]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['cp', sim_makefile, sim_dir],
+                                os.path.join(sim_dir, 'Makefile'), [sim_makefile]))
+      processes.append(self.do_sim_call(task, manifest,
+                                ['cp', sim_genwrapper, sim_ps_dir],
+                                os.path.join(sim_ps_dir, 'genwrapper_for_ps.cpp'),
+                                [sim_genwrapper]))
+      processes.append(self.do_sim_call(task, manifest, ps_command, file_ps,
+                                        ps_inputs))
       await asyncio.gather(*processes)
-      await self.do_call(task, ['aie-translate', '--aie-flows-to-json',
-                                os.path.join(sim_dir, 'flows_physical.mlir'),
-                                '-o', os.path.join(sim_dir, 'flows_physical.json')])
+      await self.do_sim_call(task, manifest,
+                             ['aie-translate', '--aie-flows-to-json',
+                              file_flows, '-o', file_flows_json],
+                             file_flows_json, [file_flows])
+      if(self.opts.execute):
+        with open(manifest_file, 'wt') as f:
+          json.dump(manifest, f, indent=1, sort_keys=True)
 
       sim_script = os.path.join(self.tmpdirname, 'aiesim.sh')
       sim_script_template = \
@@ -423,10 +996,22 @@ aiesimulator --pkg-dir=${prj_name}/sim --dump-vcd ${vcd_filename}
       print("To run simulation: " + sim_script)
 
   async def run_flow(self):
+      current_stage.set('passes')
       nworkers = int(opts.nthreads)
       if(nworkers == 0):
         nworkers = os.cpu_count()
 
+      # Each job of a remote host is a slot, and takes a worker to prepare
+      # its inputs here.
+      self.remote_slots = None
+      if(opts.remote_hosts):
+        self.remote_slots = asyncio.Queue()
+        for host in opts.remote_hosts.split(','):
+          (name, _, jobs) = host.partition(':')
+          for i in range(int(jobs) if jobs else 1):
+            self.remote_slots.put_nowait(name)
+        nworkers += self.remote_slots.qsize()
+
       self.limit = asyncio.Semaphore(nworkers)
       with progress.Progress(
         *progress.Progress.get_default_columns(),
@@ -437,63 +1022,140 @@ aiesimulator --pkg-dir=${prj_name}/sim --dump-vcd ${vcd_filename}
         redirect_stderr = False) as progress_bar:
         self.progress_bar = progress_bar
         progress_bar.task = progress_bar.add_task("[green] MLIR compilation:", total=1, command="1 Worker")
+        # The devices of the design add their cores and host code to it.
+        progress_bar.task_completed = progress_bar.add_task("[green] AIE Compilation:", total=0,
+                                                            command="%d Workers" % nworkers, visible=False)
 
         self.file_with_addresses = os.path.join(self.tmpdirname, 'input_with_addresses.mlir')
         pass_pipeline = ','.join(['lower-affine',
                                   'aie-canonicalize-device',
                                   'AIE.device('+
+                                    'aie-assign-shim-tiles',
+                                    'aie-insert-overlay-loads',
                                     'aie-assign-lock-ids',
                                     'aie-register-objectFifos',
                                     'aie-objectFifo-stateful-transform',
+                                    'aie-lower-stream-fifos',
+                                    'aie-lower-rtps',
+                                    'aie-coalesce-locks',
+                                    'aie-eliminate-dead-resources',
+                                    'aie-route-trace',
+                                    'aie-route-control-packets',
+                                    'aie-lower-multicast',
                                     'aie-lower-broadcast-packet',
                                     'aie-create-packet-flows',
-                                    'aie-lower-multicast',
                                     'aie-assign-buffer-addresses)',
                                   'convert-scf-to-cf'])
-        self.run_passes('builtin.module('+pass_pipeline+')', self.mlir_module_str, self.file_with_addresses)
-
-        t = self.do_run(['aie-translate', '--aie-generate-corelist', self.file_with_addresses])
-        cores = eval(t.stdout)
-        t = self.do_run(['aie-translate', '--aie-generate-target-arch', self.file_with_addresses])
-        self.aie_target = t.stdout.strip()
-        if(not re.fullmatch('AIE.?', self.aie_target)):
-          print("Unexpected target " + self.aie_target + ". Exiting...")
-          exit(-3)
-        self.aie_peano_target = self.aie_target.lower() + "-none-elf"
-
-        await self.prepare_for_chesshack(progress_bar.task)
-
-        if(opts.unified):
-          self.file_opt_with_addresses = os.path.join(self.tmpdirname, 'input_opt_with_addresses.mlir')
-          await self.do_call(progress_bar.task, ['aie-opt', '--aie-localize-locks',
-                              '--aie-standard-lowering',
-                              *aie_opt_passes,
-                              self.file_with_addresses, '-o', self.file_opt_with_addresses])
-
-          self.file_llvmir = os.path.join(self.tmpdirname, 'input.ll')
-          await self.do_call(progress_bar.task, ['aie-translate', '--opaque-pointers=0', '--mlir-to-llvmir', self.file_opt_with_addresses, '-o', self.file_llvmir])
-
-          self.file_obj = os.path.join(self.tmpdirname, 'input.o')
-          if(opts.compile and opts.xchesscc):
-            file_llvmir_hacked = await self.chesshack(progress_bar.task, self.file_llvmir)
-            await self.do_call(progress_bar.task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-c', '-d', '-f', '+P', '4', file_llvmir_hacked, '-o', self.file_obj])
-          elif(opts.compile):
-            self.file_llvmir_opt= os.path.join(self.tmpdirname, 'input.opt.ll')
-            await self.do_call(progress_bar.task, ['opt', '--opaque-pointers=0', '--passes=default<O2>', '-inline-threshold=10', '-S', self.file_llvmir, '-o', self.file_llvmir_opt])
-
-            await self.do_call(progress_bar.task, ['llc', self.file_llvmir_opt, '-O2', '--march=%s' % self.aie_target.lower(), '--function-sections', '--filetype=obj', '-o', self.file_obj])
-
-        progress_bar.update(progress_bar.task,advance=0,visible=False)
-        progress_bar.task_completed = progress_bar.add_task("[green] AIE Compilation:", total=len(cores)+1, command="%d Workers" % nworkers)
-
-        processes = [self.process_host_cgen()]
-        await asyncio.gather(*processes) # ensure that process_host_cgen finishes before running gen_sim
-        processes = []
-        if(opts.aiesim):
-          processes.append(self.gen_sim(progress_bar.task))
-        for core in cores:
-          processes.append(self.process_core(core))
-        await asyncio.gather(*processes)
+        # The devices are isolated from each other, so the pass manager runs
+        # the AIE.device pipeline on all of them in parallel.
+        mlir_module = self.run_passes('builtin.module('+pass_pipeline+')', self.mlir_module,
+                                      self.file_with_addresses, inspect=self.inspect_design)
+        if(self.num_devices > 1):
+          await self.compile_devices(mlir_module, pass_pipeline)
+        else:
+          await self.compile_device(pass_pipeline)
+
+  # Compile each device of a design with several devices in the device<N>
+  # subdirectory of the project, from mlir_module, the design through the
+  # passes, at the same time as the others.
+  async def compile_devices(self, mlir_module, pass_pipeline):
+      if(opts.aiesim):
+        sys.exit("AIE Simulation (--aiesim) supports a single AIE.device, the design has %d" % self.num_devices)
+      if(len(opts.host_args) > 0):
+        print("The design has %d devices, compile the host code against the aie_inc.cpp of one of them in %s" %
+              (self.num_devices, os.path.join(self.tmpdirname, 'device<N>')))
+      inputs = self.split_devices(self.mlir_module)
+      outputs = self.split_devices(mlir_module)
+      runners = []
+      for (index, (device_input, device_output)) in enumerate(zip(inputs, outputs)):
+        runner = flow_runner(device_input, self.opts, os.path.join(self.tmpdirname, 'device%d' % index), parent=self)
+        os.makedirs(runner.tmpdirname, exist_ok=True)
+        # The host code of each device runs in its own directory.
+        runner.elfdir = 'device%d' % index
+        runner.compile_host = False
+        runner.file_with_addresses = os.path.join(runner.tmpdirname, 'input_with_addresses.mlir')
+        with open(runner.file_with_addresses, 'wb') as f:
+          f.write(device_output)
+        with Context() as ctx, Location.unknown():
+          aiedialect.register_dialect(ctx)
+          runner.inspect_design(Module.parse(device_output))
+        runners.append(runner)
+      await asyncio.gather(*[runner.compile_device(pass_pipeline) for runner in runners])
+
+  # Compile the cores, the host code and the simulation of the first device
+  # of the design in self.file_with_addresses.
+  async def compile_device(self, pass_pipeline):
+      progress_bar = self.progress_bar
+      cores = self.cores
+      if(not re.fullmatch('AIE.?', self.aie_target)):
+        print("Unexpected target " + self.aie_target + ". Exiting...")
+        exit(-3)
+      self.aie_peano_target = self.aie_target.lower() + "-none-elf"
+      self.toolchain = self.toolchain_key()
+
+      if(opts.infer_stack_size and opts.compile):
+        await self.infer_stack_sizes(cores, pass_pipeline)
+
+      completed = progress_bar._tasks[progress_bar.task_completed]
+      progress_bar.update(progress_bar.task_completed, total=completed.total+len(cores)+1, visible=True)
+
+      # From here on, the host code, the simulation and the cores only
+      # depend on each other through the files they read: the host code
+      # and the simulation need the physical design, the cores need their
+      # lowered MLIR, the memory maps and the chess setup.  Start each of
+      # them as soon as its inputs are ready instead of one stage at a time.
+      self.physical_ready = asyncio.Event()
+      chess_setup = asyncio.create_task(self.prepare_for_chesshack(progress_bar.task))
+      # The deduplication of the cores rewrites the design with the ELF
+      # files the cores share, which the host code needs.
+      dedup = opts.dedup_cores and opts.compile and not opts.unified
+      host = None
+      if(not dedup):
+        host = asyncio.create_task(self.process_host_cgen())
+
+      self.coredir = os.path.join(self.tmpdirname, 'cores')
+      processes = [self.generate_memory_maps()]
+      if(not opts.unified):
+        processes.append(self.lower_cores(progress_bar.task, self.coredir))
+      await asyncio.gather(*processes)
+      if(opts.dedup_cores and opts.compile):
+        cores = await self.dedup_cores(cores)
+      if(host is None):
+        host = asyncio.create_task(self.process_host_cgen())
+
+      await chess_setup
+
+      if(opts.unified):
+        current_stage.set('unified compilation')
+        self.file_opt_with_addresses = os.path.join(self.tmpdirname, 'input_opt_with_addresses.mlir')
+        await self.do_call(progress_bar.task, ['aie-opt', '--aie-localize-locks',
+                            '--aie-standard-lowering=share-cores' if opts.dedup_cores else '--aie-standard-lowering',
+                            *aie_opt_passes, '--emit-bytecode',
+                            self.file_with_addresses, '-o', self.file_opt_with_addresses])
+
+        self.file_llvmir = os.path.join(self.tmpdirname, 'input.ll')
+        if(opts.compile and opts.xchesscc):
+          await self.translate_to_chess_llvmir(progress_bar.task, self.file_opt_with_addresses, self.file_llvmir)
+        else:
+          await self.translate_to_llvmir(progress_bar.task, self.file_opt_with_addresses, self.file_llvmir)
+
+        self.file_obj = os.path.join(self.tmpdirname, 'input.o')
+        if(opts.compile and opts.xchesscc):
+          await self.do_call(progress_bar.task, ['xchesscc_wrapper', self.aie_target.lower(), '+w', os.path.join(self.tmpdirname, 'work'), '-c', '-d', '-f', '+P', '4', self.file_llvmir, '-o', self.file_obj])
+        elif(opts.compile):
+          self.file_llvmir_opt= os.path.join(self.tmpdirname, 'input.opt.ll')
+          await self.do_call(progress_bar.task, ['opt', '--opaque-pointers=0', '--passes=default<O2>', '-inline-threshold=10', '-S', self.file_llvmir, '-o', self.file_llvmir_opt])
+
+          await self.do_call(progress_bar.task, ['llc', self.file_llvmir_opt, '-O2', '--march=%s' % self.aie_target.lower(), '--function-sections', '--filetype=obj', '-o', self.file_obj])
+
+      progress_bar.update(progress_bar.task,advance=0,visible=False)
+
+      processes = [host]
+      if(opts.aiesim):
+        processes.append(self.gen_sim(progress_bar.task))
+      for core in cores:
+        processes.append(self.process_core(core))
+      await asyncio.gather(*processes)
 
   def dumpprofile(self):
       sortedruntimes = sorted(self.runtimes.items(), key=lambda item: item[1], reverse=True)
@@ -501,8 +1163,47 @@ aiesimulator --pkg-dir=${prj_name}/sim --dump-vcd ${vcd_filename}
         if(i < len(sortedruntimes)):
           print("%.4f sec: %s" % (sortedruntimes[i][1], sortedruntimes[i][0]))
 
+      commands = [e for e in self.events if e['pid'] == 1]
+      waits = [e for e in self.events if e['pid'] == 2]
+      def total(events):
+        return sum(e['dur'] for e in events) / 1e6
+      print("\nCumulative time per tool:")
+      for tool in sorted(set(e['name'] for e in commands), key=lambda t: -total(e for e in commands if e['name'] == t)):
+        print("%.4f sec: %s" % (total(e for e in commands if e['name'] == tool), tool))
+      # The stages run one after the other, except the cores, the host code
+      # and the simulation, which run in parallel.  The wall time of a stage
+      # spans from its first command to the end of its last one.
+      print("\nWall time per stage:")
+      for stage in dict.fromkeys(e['cat'] for e in commands):
+        events = [e for e in commands if e['cat'] == stage]
+        span = (max(e['ts'] + e['dur'] for e in events) - min(e['ts'] for e in events)) / 1e6
+        print("%.4f sec: %s (%.4f sec of commands)" % (span, stage, total(events)))
+      cores = dict()
+      for e in commands:
+        if 'core' in e['args'] and e['cat'] == 'core compilation':
+          cores[e['args']['core']] = cores.get(e['args']['core'], 0) + e['dur'] / 1e6
+      if cores:
+        slowest = max(cores, key=cores.get)
+        print("\nThe slowest core, on the critical path of the core compilation, is %s with %.4f sec of commands" % (slowest, cores[slowest]))
+      print("Time waiting for a worker: %.4f sec" % total(waits))
+      peaks = [e for e in commands if 'max_rss_kb' in e['args']]
+      if peaks:
+        peak = max(peaks, key=lambda e: e['args']['max_rss_kb'])
+        print("Peak memory: %d MB in %s" % (peak['args']['max_rss_kb'] // 1024, peak['args']['command']))
+
+  # Write the timeline of the build in the Chrome trace event format, which
+  # chrome://tracing and Perfetto display.
+  def dumptrace(self, filename):
+      metadata = [{'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'commands'}},
+                  {'name': 'process_name', 'ph': 'M', 'pid': 2, 'args': {'name': 'waits for a worker'}}]
+      with open(filename, 'w') as f:
+        json.dump({'traceEvents': metadata + self.events, 'displayTimeUnit': 'ms'}, f, indent=1)
+
+# Compile mlir_module, a Module or its MLIR bytecode or text.
 def run(mlir_module, args=None):
     global opts
+    if isinstance(mlir_module, Module):
+      mlir_module = module_bytecode(mlir_module)
     if args is not None:
       opts = aie.compiler.aiecc.cl_arguments.parse_args(args)
 
@@ -567,6 +1268,8 @@ def run(mlir_module, args=None):
 
     if(opts.profiling):
       runner.dumpprofile()
+    if(opts.trace_file):
+      runner.dumptrace(opts.trace_file)
 
 def main():
   global opts
@@ -575,10 +1278,10 @@ def main():
   try:
     with Context() as ctx, Location.unknown():
       aiedialect.register_dialect(ctx)
-      with open(opts.filename, 'r') as f:
+      with open(opts.filename, 'rb') as f:
         module = Module.parse(f.read())
-      module_str = str(module)
+      mlir_module = module_bytecode(module)
   except Exception as e:
     print(e)
     sys.exit(1)
-  run(module_str)
+  run(mlir_module)
@@ -0,0 +1,197 @@
+# ./python/aie/design.py -*- Python -*-
+
+# Copyright (C) 2023, Advanced Micro Devices, Inc.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Array-level constructs to script AIE designs.
+
+A Design builds the AIE.device of a module with the op builders of the
+aie dialect: grids of tiles, objectFifos broadcast to many consumers,
+scattered to or gathered from them through a shared tile, pipelines of
+objectFifos between consecutive cores, and cores calling external kernels.
+
+    with Context() as ctx, Location.unknown():
+        register_dialect(ctx)
+        design = Design("xcvc1902")
+        cores = design.grid(cols=range(1, 5), rows=[2])
+        buf = MemRefType.get((256,), IntegerType.get_signless(32))
+        fifos = design.pipeline("stage", cores, depth=2, elem_type=buf)
+        ...
+        print(design.module)
+"""
+
+import contextlib
+
+from .dialects.aie import *
+from .mlir.dialects import arith, func, scf
+from .mlir.ir import *
+
+DEVICES = {"xcvc1902": 1, "xcve2302": 2, "xcve2802": 3}
+WIRE_BUNDLES = {
+    "Core": 0, "DMA": 1, "FIFO": 2, "South": 3, "West": 4, "North": 5,
+    "East": 6, "PLIO": 7, "NOC": 8, "Trace": 9, "Ctrl": 10
+}
+OBJECT_FIFO_PORTS = {"Produce": 0, "Consume": 1}
+
+
+def _i32(value):
+    return IntegerAttr.get(IntegerType.get_signless(32), value)
+
+
+def _index(value):
+    return arith.ConstantOp(IndexType.get(),
+                            IntegerAttr.get(IndexType.get(), value)).result
+
+
+class ObjectFifo:
+    """An AIE.objectFifo, acquired and released by name in the cores."""
+
+    def __init__(self, op, name, elem_type):
+        self.op = op
+        self.name = name
+        self.elem_type = elem_type
+
+    def acquire(self, port, num=1):
+        """Acquire num elements on port, "Produce" or "Consume", of the
+        current core, and return their memrefs."""
+        subview = ObjectFifoAcquireOp(
+            ObjectFifoSubviewType.get(self.elem_type),
+            _i32(OBJECT_FIFO_PORTS[port]), FlatSymbolRefAttr.get(self.name),
+            _i32(num)).result
+        return [
+            ObjectFifoSubviewAccessOp(self.elem_type, subview, _i32(i)).result
+            for i in range(num)
+        ]
+
+    def release(self, port, num=1):
+        """Release num elements on port of the current core."""
+        ObjectFifoReleaseOp(_i32(OBJECT_FIFO_PORTS[port]),
+                            FlatSymbolRefAttr.get(self.name), _i32(num))
+
+
+class Design:
+    """The AIE.device of a new module, built within the current context and
+    location."""
+
+    def __init__(self, device="xcvc1902"):
+        self.module = Module.create()
+        self._tiles = {}
+        with InsertionPoint(self.module.body):
+            self.device = DeviceOp(_i32(DEVICES[device]))
+        block = Block.create_at_start(self.device.bodyRegion)
+        with InsertionPoint(block):
+            end = EndOp()
+        self._ip = InsertionPoint(end)
+
+    def tile(self, col, row):
+        """Return the tile at (col, row), declared on first use."""
+        if (col, row) not in self._tiles:
+            with self._ip:
+                self._tiles[(col, row)] = TileOp(IndexType.get(), _i32(col),
+                                                 _i32(row))
+        return self._tiles[(col, row)]
+
+    def grid(self, cols, rows):
+        """Return the tiles of the given columns and rows, row by row."""
+        return [self.tile(col, row) for row in rows for col in cols]
+
+    def object_fifo(self, name, producer, consumers, depth, elem_type):
+        """Create an objectFifo of depth elements of elem_type from the
+        producer tile to the consumer tile or tiles."""
+        if not isinstance(consumers, (list, tuple)):
+            consumers = [consumers]
+        with self._ip:
+            op = ObjectFifoCreateOp(name, producer, consumers, _i32(depth),
+                                    TypeAttr.get(ObjectFifoType.get(elem_type)))
+        return ObjectFifo(op, name, elem_type)
+
+    def broadcast(self, name, producer, consumers, depth, elem_type):
+        """Create one objectFifo sending each element to all the consumers."""
+        return self.object_fifo(name, producer, list(consumers), depth,
+                                elem_type)
+
+    def _link(self, fifo_ins, fifo_outs):
+        with self._ip:
+            ObjectFifoLinkOp(
+                ArrayAttr.get([FlatSymbolRefAttr.get(f.name)
+                               for f in fifo_ins]),
+                ArrayAttr.get([FlatSymbolRefAttr.get(f.name)
+                               for f in fifo_outs]))
+
+    def scatter(self, name, producer, via, consumers, depth, elem_type):
+        """Send elements of len(consumers) blocks of elem_type from the
+        producer to the via tile, which gives each consumer its own block.
+        Return the objectFifos to the consumers, named <name>_<i>."""
+        shape = [len(consumers) * elem_type.shape[0]] + elem_type.shape[1:]
+        whole = self.object_fifo(name, producer, via, depth,
+                                 MemRefType.get(shape, elem_type.element_type))
+        parts = [
+            self.object_fifo("%s_%d" % (name, i), via, c, depth, elem_type)
+            for i, c in enumerate(consumers)
+        ]
+        self._link([whole], parts)
+        return parts
+
+    def gather(self, name, producers, via, consumer, depth, elem_type):
+        """Join the blocks of elem_type of the producers on the via tile into
+        elements sent to the consumer. Return the objectFifos of the
+        producers, named <name>_<i>."""
+        parts = [
+            self.object_fifo("%s_%d" % (name, i), p, via, depth, elem_type)
+            for i, p in enumerate(producers)
+        ]
+        shape = [len(producers) * elem_type.shape[0]] + elem_type.shape[1:]
+        whole = self.object_fifo(name, via, consumer, depth,
+                                 MemRefType.get(shape, elem_type.element_type))
+        self._link(parts, [whole])
+        return parts
+
+    def pipeline(self, name, tiles, depth, elem_type):
+        """Create the objectFifos from each tile to the next one, named
+        <name>_<i>, and return them."""
+        return [
+            self.object_fifo("%s_%d" % (name, i), tiles[i], tiles[i + 1],
+                             depth, elem_type) for i in range(len(tiles) - 1)
+        ]
+
+    def flow(self, source, source_bundle, source_channel, dest, dest_bundle,
+             dest_channel):
+        """Create a circuit-switched flow between two tile ports."""
+        with self._ip:
+            FlowOp(source, _i32(WIRE_BUNDLES[source_bundle]),
+                   _i32(source_channel), dest,
+                   _i32(WIRE_BUNDLES[dest_bundle]), _i32(dest_channel))
+
+    def external_func(self, name, inputs):
+        """Declare an external kernel taking arguments of the inputs types,
+        and return it to be called from the cores."""
+        with self._ip:
+            kernel = func.FuncOp(name, FunctionType.get(inputs, []),
+                                 visibility="private")
+        return kernel
+
+    @contextlib.contextmanager
+    def core(self, tile, stack_size=None):
+        """Build the body of the core of tile within the with statement."""
+        with self._ip:
+            op = CoreOp(IndexType.get(), tile,
+                        stackSize=None if stack_size is None else
+                        _i32(stack_size))
+        block = Block.create_at_start(op.body)
+        with InsertionPoint(block):
+            yield op
+            EndOp()
+
+    @contextlib.contextmanager
+    def for_range(self, start, stop, step=1):
+        """Build an scf.for loop within the with statement, and yield its
+        induction variable."""
+        loop = scf.ForOp(_index(start), _index(stop), _index(step))
+        with InsertionPoint(loop.body):
+            yield loop.induction_variable
+            scf.YieldOp([])
+
+    def call(self, kernel, args):
+        """Call an external kernel from the current core."""
+        func.CallOp(kernel, args)
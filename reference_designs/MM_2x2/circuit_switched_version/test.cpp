@@ -104,6 +104,16 @@ int main(int argc, char *argv[]) {
   mlir_aie_release_Out_tile0_lock(_xaie, 1, 0);
   mlir_aie_release_Out_tile1_lock(_xaie, 1, 0);
 
+  // The four 32x32 matrix multiplications, timed by their cores because
+  // the test sleeps while they run.
+  DataflowProfile profile(_xaie);
+  profile.addCore(6, 3, "mm_6_3");
+  profile.addCore(6, 4, "mm_6_4");
+  profile.addCore(7, 3, "mm_7_3");
+  profile.addCore(7, 4, "mm_7_4");
+  profile.timeByCores();
+  profile.start();
+
   mlir_aie_start_cores(_xaie);
 
   usleep(sleep_u);
@@ -143,6 +153,11 @@ int main(int argc, char *argv[]) {
   mlir_aie_acquire_Out_tile1_lock(_xaie, 0, 0);
   mlir_aie_sync_mem_cpu(_xaie, 6); // only used in libaiev2
   mlir_aie_sync_mem_cpu(_xaie, 7); // only used in libaiev2
+  profile.stop();
+  profile.report(stdout, "mm_2x2", 4 * 2.0 * 32 * 32 * 32,
+                 8 * DMA_COUNT * sizeof(int));
+  profile.writeJSON(stdout, "mm_2x2", 4 * 2.0 * 32 * 32 * 32,
+                    8 * DMA_COUNT * sizeof(int));
 
   for (int idx0 = 0; idx0 < 1024; ++idx0) {
     if (mem_ptr6[idx0] != 352) {
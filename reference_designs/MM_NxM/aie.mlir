@@ -0,0 +1,256 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// Note:
+// this matrix multiply is generated by
+//   python3 code_gen.py --rows 2 --cols 4 --m-tiles 8 --depth 2 --device xcvc1902
+// which gives the sizes of the array and of the matrices.
+
+// REQUIRES: valid_xchess_license
+// RUN: xchesscc_wrapper aie -c %S/../MM_2x2/kernel.cc
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include %extraAieCcFlags% -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @MM_2x4 {
+  AIE.device(xcvc1902) {
+    %tile2_0 = AIE.tile(2, 0)
+    %tile3_0 = AIE.tile(3, 0)
+    %tile6_0 = AIE.tile(6, 0)
+    %tile6_1 = AIE.tile(6, 1)
+    %tile6_2 = AIE.tile(6, 2)
+    %tile7_0 = AIE.tile(7, 0)
+    %tile7_1 = AIE.tile(7, 1)
+    %tile7_2 = AIE.tile(7, 2)
+    %tile8_1 = AIE.tile(8, 1)
+    %tile8_2 = AIE.tile(8, 2)
+    %tile9_1 = AIE.tile(9, 1)
+    %tile9_2 = AIE.tile(9, 2)
+    %tile10_0 = AIE.tile(10, 0)
+
+    AIE.objectFifo @A_0 (%tile2_0, {%tile6_1, %tile7_1, %tile8_1, %tile9_1}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @A_1 (%tile2_0, {%tile6_2, %tile7_2, %tile8_2, %tile9_2}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_0_0 (%tile3_0, {%tile6_1}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_0_1 (%tile3_0, {%tile7_1}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_0_2 (%tile6_0, {%tile8_1}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_0_3 (%tile6_0, {%tile9_1}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_1_0 (%tile7_0, {%tile6_2}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_1_1 (%tile7_0, {%tile7_2}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_1_2 (%tile10_0, {%tile8_2}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @B_1_3 (%tile10_0, {%tile9_2}, 1 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @C_0 (%tile6_2, {%tile2_0}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @C_1 (%tile7_2, {%tile2_0}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @C_2 (%tile8_2, {%tile3_0}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @C_3 (%tile9_2, {%tile3_0}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @acc_0_0 (%tile6_1, {%tile6_2}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @acc_0_1 (%tile7_1, {%tile7_2}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @acc_0_2 (%tile8_1, {%tile8_2}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @acc_0_3 (%tile9_1, {%tile9_2}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+
+    %A_0_ddr = AIE.external_buffer {sym_name = "A_0_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @A_0 (%tile2_0, {%A_0_ddr}) : (memref<8192xi32>)
+    %A_1_ddr = AIE.external_buffer {sym_name = "A_1_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @A_1 (%tile2_0, {%A_1_ddr}) : (memref<8192xi32>)
+    %B_0_0_ddr = AIE.external_buffer {sym_name = "B_0_0_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_0_0 (%tile3_0, {%B_0_0_ddr}) : (memref<1024xi32>)
+    %B_0_1_ddr = AIE.external_buffer {sym_name = "B_0_1_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_0_1 (%tile3_0, {%B_0_1_ddr}) : (memref<1024xi32>)
+    %B_0_2_ddr = AIE.external_buffer {sym_name = "B_0_2_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_0_2 (%tile6_0, {%B_0_2_ddr}) : (memref<1024xi32>)
+    %B_0_3_ddr = AIE.external_buffer {sym_name = "B_0_3_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_0_3 (%tile6_0, {%B_0_3_ddr}) : (memref<1024xi32>)
+    %B_1_0_ddr = AIE.external_buffer {sym_name = "B_1_0_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_1_0 (%tile7_0, {%B_1_0_ddr}) : (memref<1024xi32>)
+    %B_1_1_ddr = AIE.external_buffer {sym_name = "B_1_1_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_1_1 (%tile7_0, {%B_1_1_ddr}) : (memref<1024xi32>)
+    %B_1_2_ddr = AIE.external_buffer {sym_name = "B_1_2_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_1_2 (%tile10_0, {%B_1_2_ddr}) : (memref<1024xi32>)
+    %B_1_3_ddr = AIE.external_buffer {sym_name = "B_1_3_ddr"} : memref<1024xi32>
+    AIE.objectFifo.registerExternalBuffers @B_1_3 (%tile10_0, {%B_1_3_ddr}) : (memref<1024xi32>)
+    %C_0_ddr = AIE.external_buffer {sym_name = "C_0_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @C_0 (%tile2_0, {%C_0_ddr}) : (memref<8192xi32>)
+    %C_1_ddr = AIE.external_buffer {sym_name = "C_1_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @C_1 (%tile2_0, {%C_1_ddr}) : (memref<8192xi32>)
+    %C_2_ddr = AIE.external_buffer {sym_name = "C_2_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @C_2 (%tile3_0, {%C_2_ddr}) : (memref<8192xi32>)
+    %C_3_ddr = AIE.external_buffer {sym_name = "C_3_ddr"} : memref<8192xi32>
+    AIE.objectFifo.registerExternalBuffers @C_3 (%tile3_0, {%C_3_ddr}) : (memref<8192xi32>)
+
+    func.func private @extern_kernel(%A: memref<1024xi32>, %B: memref<1024xi32>, %acc: memref<1024xi32>, %C: memref<1024xi32>) -> ()
+
+    %zero6_1 = AIE.buffer(%tile6_1) {sym_name = "zero6_1"} : memref<1024xi32>
+    %core6_1 = AIE.core(%tile6_1) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_0_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @acc_0_0 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %zero6_1, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_0 (Consume, 1)
+        AIE.objectFifo.release @acc_0_0 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_0_0 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %core6_2 = AIE.core(%tile6_2) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_1_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %accInSubview = AIE.objectFifo.acquire @acc_0_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %accIn = AIE.objectFifo.subview.access %accInSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @C_0 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %accIn, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_1 (Consume, 1)
+        AIE.objectFifo.release @acc_0_0 (Consume, 1)
+        AIE.objectFifo.release @C_0 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_1_0 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %zero7_1 = AIE.buffer(%tile7_1) {sym_name = "zero7_1"} : memref<1024xi32>
+    %core7_1 = AIE.core(%tile7_1) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_0_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @acc_0_1 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %zero7_1, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_0 (Consume, 1)
+        AIE.objectFifo.release @acc_0_1 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_0_1 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %core7_2 = AIE.core(%tile7_2) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_1_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %accInSubview = AIE.objectFifo.acquire @acc_0_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %accIn = AIE.objectFifo.subview.access %accInSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @C_1 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %accIn, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_1 (Consume, 1)
+        AIE.objectFifo.release @acc_0_1 (Consume, 1)
+        AIE.objectFifo.release @C_1 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_1_1 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %zero8_1 = AIE.buffer(%tile8_1) {sym_name = "zero8_1"} : memref<1024xi32>
+    %core8_1 = AIE.core(%tile8_1) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_0_2 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @acc_0_2 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %zero8_1, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_0 (Consume, 1)
+        AIE.objectFifo.release @acc_0_2 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_0_2 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %core8_2 = AIE.core(%tile8_2) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_1_2 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %accInSubview = AIE.objectFifo.acquire @acc_0_2 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %accIn = AIE.objectFifo.subview.access %accInSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @C_2 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %accIn, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_1 (Consume, 1)
+        AIE.objectFifo.release @acc_0_2 (Consume, 1)
+        AIE.objectFifo.release @C_2 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_1_2 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %zero9_1 = AIE.buffer(%tile9_1) {sym_name = "zero9_1"} : memref<1024xi32>
+    %core9_1 = AIE.core(%tile9_1) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_0_3 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_0 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @acc_0_3 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %zero9_1, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_0 (Consume, 1)
+        AIE.objectFifo.release @acc_0_3 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_0_3 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+    %core9_2 = AIE.core(%tile9_2) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %ctiles = arith.constant 8 : index
+      %BSubview = AIE.objectFifo.acquire @B_1_3 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+      %B = AIE.objectFifo.subview.access %BSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+      scf.for %t = %c0 to %ctiles step %c1 {
+        %ASubview = AIE.objectFifo.acquire @A_1 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %A = AIE.objectFifo.subview.access %ASubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %accInSubview = AIE.objectFifo.acquire @acc_0_3 (Consume, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %accIn = AIE.objectFifo.subview.access %accInSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        %outSubview = AIE.objectFifo.acquire @C_3 (Produce, 1) : !AIE.objectFifoSubview<memref<1024xi32>>
+        %out = AIE.objectFifo.subview.access %outSubview[0] : !AIE.objectFifoSubview<memref<1024xi32>> -> memref<1024xi32>
+        func.call @extern_kernel(%A, %B, %accIn, %out) : (memref<1024xi32>, memref<1024xi32>, memref<1024xi32>, memref<1024xi32>) -> ()
+        AIE.objectFifo.release @A_1 (Consume, 1)
+        AIE.objectFifo.release @acc_0_3 (Consume, 1)
+        AIE.objectFifo.release @C_3 (Produce, 1)
+      }
+      AIE.objectFifo.release @B_1_3 (Consume, 1)
+      AIE.end
+    } { link_with="kernel.o" }
+
+  }
+}
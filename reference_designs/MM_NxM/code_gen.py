@@ -0,0 +1,443 @@
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# Copyright (C) 2023, Advanced Micro Devices, Inc.
+
+# Generates a matrix multiply C = A * B on an array of rows x cols cores, as
+# aie.mlir, and the description of its external buffers for test.cpp, as
+# mm_buffers.h.  The matrices are made of 32x32 int32 blocks, stored column
+# by column as the kernel expects them:
+#
+# - A is m_tiles x rows blocks, B is rows x cols blocks and C is
+#   m_tiles x cols blocks, so that K is tiled over the rows of the array and
+#   N over its columns.
+# - The core in row k and column n keeps block (k, n) of B, and multiplies
+#   the row blocks (t, k) of A by it for each t.  It adds its product to
+#   the partial sum of the core below it, and passes the sum on to the core
+#   above it, so the core in the last row gives block (t, n) of C.
+# - Row k of A is broadcast to the cores of row k.  The blocks of A, the
+#   partial sums and C go through objectFifos of the given depth, 2 by
+#   default, so that a core works on a block while the next one arrives.
+# - On xcvc1902 every objectFifo goes to the shim DMAs.  On AIE2 devices the
+#   blocks are staged in the memtiles: the whole rows of A are distributed
+#   to the rows of the array from one memtile, the columns of B to the cores
+#   of each column from the memtile of the column, and the blocks of a row
+#   of C are joined in one memtile before going to the shim.
+
+import argparse
+import os
+
+BLOCK = 32
+BLOCK_TYPE = "memref<%dxi32>" % (BLOCK * BLOCK)
+DEVICES = {
+    # the shim NOC columns, the first row of cores and the number of rows of
+    # cores, and the int32 MACs of a core per cycle
+    "xcvc1902": {
+        "shims": [2, 3, 6, 7, 10, 11, 18, 19, 26, 27, 34, 35, 42, 43, 46, 47],
+        "first_row": 1, "core_rows": 8, "columns": 50, "memtile": False,
+        "macs": 8, "kernel": "../MM_2x2/kernel.cc"
+    },
+    "xcve2802": {
+        "shims": [2, 3, 6, 7, 14, 15, 22, 23, 30, 31, 34, 35],
+        "first_row": 3, "core_rows": 8, "columns": 38, "memtile": True,
+        "macs": 8, "kernel": "kernel_aie2.cc"
+    },
+}
+# the channels of a shim DMA in each direction
+SHIM_CHANNELS = 2
+# the channels of a memtile DMA in each direction
+MEMTILE_CHANNELS = 6
+
+
+class Design:
+
+    def __init__(self, args):
+        self.args = args
+        self.device = DEVICES[args.device]
+        self.lines = []
+        # the external buffers: symbol, matrix, the blocks they hold in
+        # order, their shim column, and the objectFifo they feed or drain
+        self.buffers = []
+        self.mm2s = []
+        self.s2mm = []
+
+    def emit(self, line=""):
+        self.lines.append(line)
+
+    def core(self, k, n):
+        return (self.args.start_col + n, self.device["first_row"] + k)
+
+    def tile(self, col, row):
+        return "%%tile%d_%d" % (col, row)
+
+    def shim(self, channels):
+        """Return the column of a shim with a free DMA channel in one
+        direction."""
+        index = len(channels) // SHIM_CHANNELS
+        if index >= len(self.device["shims"]):
+            raise SystemExit("not enough shim DMA channels; use fewer cores")
+        channels.append(index)
+        return self.device["shims"][index]
+
+    def fifo(self, name, producer, consumers, depth, type=BLOCK_TYPE):
+        self.emit("    AIE.objectFifo @%s (%s, {%s}, %d : i32) : "
+                  "!AIE.objectFifo<%s>" %
+                  (name, self.tile(*producer),
+                   ", ".join(self.tile(*c) for c in consumers), depth, type))
+
+    def external(self, name, fifo, shim_col, matrix, blocks, output):
+        size = len(blocks) * BLOCK * BLOCK
+        self.emit("    %%%s = AIE.external_buffer {sym_name = \"%s\"} : "
+                  "memref<%dxi32>" % (name, name, size))
+        self.emit("    AIE.objectFifo.registerExternalBuffers @%s (%s, {%%%s}) "
+                  ": (memref<%dxi32>)" %
+                  (fifo, self.tile(shim_col, 0), name, size))
+        self.buffers.append({
+            "name": name, "fifo": fifo, "shim": shim_col, "matrix": matrix,
+            "blocks": blocks, "output": output
+        })
+
+    def generate(self):
+        args, rows, cols, tiles = self.args, self.args.rows, self.args.cols, \
+            self.args.m_tiles
+        if rows > self.device["core_rows"]:
+            raise SystemExit("%s has %d rows of cores" %
+                             (args.device, self.device["core_rows"]))
+        if args.start_col + cols > self.device["columns"]:
+            raise SystemExit("%s has %d columns" %
+                             (args.device, self.device["columns"]))
+        memtile = self.device["memtile"]
+        # the memtile of the first column sends the rows of A and the blocks
+        # of B of its column, the memtile of the last column receives the
+        # blocks of C and the column of B
+        single = 1 if cols == 1 else 0
+        if memtile and (2 * rows + single > MEMTILE_CHANNELS or
+                        cols + 1 + single > MEMTILE_CHANNELS):
+            raise SystemExit("the memtiles have %d DMA channels each way" %
+                             MEMTILE_CHANNELS)
+
+        self.emit("module @MM_%dx%d {" % (rows, cols))
+        self.emit("  AIE.device(%s) {" % args.device)
+        tiles_used = set()
+        for k in range(rows):
+            for n in range(cols):
+                tiles_used.add(self.core(k, n))
+        # reserve the shim channels first to declare their tiles
+        inputs, outputs = [], []
+        if memtile:
+            inputs.append(("A", self.shim(self.mm2s)))
+            for n in range(cols):
+                inputs.append(("B_%d" % n, self.shim(self.mm2s)))
+            outputs.append(("C", self.shim(self.s2mm)))
+            for n in range(cols):
+                tiles_used.add((args.start_col + n, 1))
+        else:
+            for k in range(rows):
+                inputs.append(("A_%d" % k, self.shim(self.mm2s)))
+            for k in range(rows):
+                for n in range(cols):
+                    inputs.append(("B_%d_%d" % (k, n), self.shim(self.mm2s)))
+            for n in range(cols):
+                outputs.append(("C_%d" % n, self.shim(self.s2mm)))
+        for _, col in inputs + outputs:
+            tiles_used.add((col, 0))
+        for col, row in sorted(tiles_used):
+            self.emit("    %s = AIE.tile(%d, %d)" %
+                      (self.tile(col, row), col, row))
+        self.emit()
+
+        shim_of = dict(inputs + outputs)
+        depth = args.depth
+        row_cores = lambda k: [self.core(k, n) for n in range(cols)]
+        if memtile:
+            # A goes through the memtile of the first column, B through the
+            # memtile of each column, and C is joined in the memtile of the
+            # last column
+            mem_a = (args.start_col, 1)
+            mem_c = (args.start_col + cols - 1, 1)
+            self.fifo("A", (shim_of["A"], 0), [mem_a], depth,
+                      "memref<%dxi32>" % (rows * BLOCK * BLOCK))
+            for k in range(rows):
+                self.fifo("A_%d" % k, mem_a, row_cores(k), depth)
+            self.emit("    AIE.objectFifo.link [@A] -> [%s] ()" %
+                      ", ".join("@A_%d" % k for k in range(rows)))
+            for n in range(cols):
+                mem_b = (args.start_col + n, 1)
+                self.fifo("B_%d" % n, (shim_of["B_%d" % n], 0), [mem_b], 1,
+                          "memref<%dxi32>" % (rows * BLOCK * BLOCK))
+                for k in range(rows):
+                    self.fifo("B_%d_%d" % (k, n), mem_b, [self.core(k, n)], 1)
+                self.emit("    AIE.objectFifo.link [@B_%d] -> [%s] ()" %
+                          (n, ", ".join("@B_%d_%d" % (k, n)
+                                        for k in range(rows))))
+            for n in range(cols):
+                self.fifo("C_%d" % n, self.core(rows - 1, n), [mem_c], depth)
+            self.fifo("C", mem_c, [(shim_of["C"], 0)], depth,
+                      "memref<%dxi32>" % (cols * BLOCK * BLOCK))
+            self.emit("    AIE.objectFifo.link [%s] -> [@C] ()" %
+                      ", ".join("@C_%d" % n for n in range(cols)))
+        else:
+            for k in range(rows):
+                self.fifo("A_%d" % k, (shim_of["A_%d" % k], 0), row_cores(k),
+                          depth)
+            for k in range(rows):
+                for n in range(cols):
+                    name = "B_%d_%d" % (k, n)
+                    self.fifo(name, (shim_of[name], 0), [self.core(k, n)], 1)
+            for n in range(cols):
+                self.fifo("C_%d" % n, self.core(rows - 1, n),
+                          [(shim_of["C_%d" % n], 0)], depth)
+        for k in range(rows - 1):
+            for n in range(cols):
+                self.fifo("acc_%d_%d" % (k, n), self.core(k, n),
+                          [self.core(k + 1, n)], depth)
+        self.emit()
+
+        # the external buffers, with the blocks of their matrix in the order
+        # the shim DMAs move them
+        if memtile:
+            self.external("A_ddr", "A", shim_of["A"], "MM_A",
+                          [(t, k) for t in range(tiles) for k in range(rows)],
+                          False)
+            for n in range(cols):
+                self.external("B_%d_ddr" % n, "B_%d" % n, shim_of["B_%d" % n],
+                              "MM_B", [(k, n) for k in range(rows)], False)
+            self.external("C_ddr", "C", shim_of["C"], "MM_C",
+                          [(t, n) for t in range(tiles) for n in range(cols)],
+                          True)
+        else:
+            for k in range(rows):
+                self.external("A_%d_ddr" % k, "A_%d" % k, shim_of["A_%d" % k],
+                              "MM_A", [(t, k) for t in range(tiles)], False)
+            for k in range(rows):
+                for n in range(cols):
+                    name = "B_%d_%d" % (k, n)
+                    self.external(name + "_ddr", name, shim_of[name], "MM_B",
+                                  [(k, n)], False)
+            for n in range(cols):
+                self.external("C_%d_ddr" % n, "C_%d" % n, shim_of["C_%d" % n],
+                              "MM_C", [(t, n) for t in range(tiles)], True)
+        self.emit()
+
+        self.emit("    func.func private @extern_kernel(%%A: %s, %%B: %s, "
+                  "%%acc: %s, %%C: %s) -> ()" % ((BLOCK_TYPE,) * 4))
+        self.emit()
+        for n in range(cols):
+            for k in range(rows):
+                self.generate_core(k, n)
+        self.emit("  }")
+        self.emit("}")
+
+    def acquire(self, value, fifo, port):
+        subview = "!AIE.objectFifoSubview<%s>" % BLOCK_TYPE
+        self.emit("        %%%sSubview = AIE.objectFifo.acquire @%s (%s, 1) : %s"
+                  % (value, fifo, port, subview))
+        self.emit("        %%%s = AIE.objectFifo.subview.access %%%sSubview[0] "
+                  ": %s -> %s" % (value, value, subview, BLOCK_TYPE))
+
+    def generate_core(self, k, n):
+        rows = self.args.rows
+        col, row = self.core(k, n)
+        tile = self.tile(col, row)
+        if k == 0:
+            # the first partial sum is this zeroed buffer
+            self.emit("    %%zero%d_%d = AIE.buffer(%s) {sym_name = "
+                      "\"zero%d_%d\"} : %s" % (col, row, tile, col, row,
+                                               BLOCK_TYPE))
+        self.emit("    %%core%d_%d = AIE.core(%s) {" % (col, row, tile))
+        self.emit("      %c0 = arith.constant 0 : index")
+        self.emit("      %c1 = arith.constant 1 : index")
+        self.emit("      %%ctiles = arith.constant %d : index" %
+                  self.args.m_tiles)
+        self.emit("      %%BSubview = AIE.objectFifo.acquire @B_%d_%d "
+                  "(Consume, 1) : !AIE.objectFifoSubview<%s>" %
+                  (k, n, BLOCK_TYPE))
+        self.emit("      %%B = AIE.objectFifo.subview.access %%BSubview[0] : "
+                  "!AIE.objectFifoSubview<%s> -> %s" % (BLOCK_TYPE, BLOCK_TYPE))
+        self.emit("      scf.for %t = %c0 to %ctiles step %c1 {")
+        self.acquire("A", "A_%d" % k, "Consume")
+        if k > 0:
+            self.acquire("accIn", "acc_%d_%d" % (k - 1, n), "Consume")
+            acc_in = "%accIn"
+        else:
+            acc_in = "%%zero%d_%d" % (col, row)
+        out = "C_%d" % n if k == rows - 1 else "acc_%d_%d" % (k, n)
+        self.acquire("out", out, "Produce")
+        self.emit("        func.call @extern_kernel(%%A, %%B, %s, %%out) : "
+                  "(%s, %s, %s, %s) -> ()" % ((acc_in,) + (BLOCK_TYPE,) * 4))
+        self.emit("        AIE.objectFifo.release @A_%d (Consume, 1)" % k)
+        if k > 0:
+            self.emit("        AIE.objectFifo.release @acc_%d_%d (Consume, 1)" %
+                      (k - 1, n))
+        self.emit("        AIE.objectFifo.release @%s (Produce, 1)" % out)
+        self.emit("      }")
+        self.emit("      AIE.objectFifo.release @B_%d_%d (Consume, 1)" % (k, n))
+        self.emit("      AIE.end")
+        self.emit("    } { link_with=\"kernel.o\" }")
+        self.emit()
+
+    def mlir(self):
+        args = self.args
+        return """//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+//
+// Note:
+// this matrix multiply is generated by
+//   python3 code_gen.py --rows %d --cols %d --m-tiles %d --depth %d --device %s
+// which gives the sizes of the array and of the matrices.
+
+// REQUIRES: valid_xchess_license
+// RUN: xchesscc_wrapper %s -c %%S/%s
+// RUN: aiecc.py %%VitisSysrootFlag%% --host-target=%%aieHostTargetTriplet%% %%s -I%%host_runtime_lib%%/test_lib/include %%extraAieCcFlags%% -L%%host_runtime_lib%%/test_lib/lib -ltest_lib %%S/test.cpp -o test.elf
+// RUN: %%run_on_board ./test.elf
+
+""" % (args.rows, args.cols, args.m_tiles, args.depth, args.device,
+       "aie2" if self.device["memtile"] else "aie", self.device["kernel"]) \
+            + "\n".join(self.lines) + "\n"
+
+    def header(self):
+        args = self.args
+        aie2 = self.device["memtile"]
+        out = []
+        out.append("""//===- mm_buffers.h ---------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Generated with aie.mlir by code_gen.py: the sizes of the design and its
+// external buffers, for test.cpp.
+
+#ifndef MM_BUFFERS_H
+#define MM_BUFFERS_H
+
+#define MM_ROWS %d
+#define MM_COLS %d
+#define MM_M_TILES %d
+#define MM_BLOCK %d
+#define MM_MACS_PER_CYCLE %d
+
+enum mm_matrix { MM_A, MM_B, MM_C };
+
+// An external buffer holds count blocks of its matrix, given from first in
+// mm_blocks as (row block, column block), in the order the DMAs move them.
+struct mm_buffer {
+  const char *name;
+  enum mm_matrix matrix;
+  int first, count;
+};
+""" % (args.rows, args.cols, args.m_tiles, BLOCK, self.device["macs"]))
+        blocks, entries = [], []
+        for b in self.buffers:
+            entries.append("  {\"%s\", %s, %d, %d}," %
+                           (b["name"], b["matrix"], len(blocks),
+                            len(b["blocks"])))
+            blocks += b["blocks"]
+        out.append("#define MM_NUM_BUFFERS %d" % len(self.buffers))
+        out.append("static const struct mm_buffer mm_buffers[] = {")
+        out += entries
+        out.append("};")
+        out.append("static const int mm_blocks[][2] = {")
+        for i in range(0, len(blocks), 6):
+            out.append("  " + " ".join("{%d, %d}," % b
+                                      for b in blocks[i:i + 6]))
+        out.append("};")
+        out.append("")
+        out.append("// The cores, as X(col, row).")
+        out.append("#define MM_FOR_EACH_CORE(X) \\")
+        for n in range(args.cols):
+            for k in range(args.rows):
+                out.append("  X(%d, %d) \\" % self.core(k, n))
+        out.append("")
+        out.append("static inline void mm_set_addresses(aie_libxaie_ctx_t *ctx,"
+                   " u64 *addrs) {")
+        for i, b in enumerate(self.buffers):
+            out.append("  mlir_aie_external_set_addr_%s(ctx, addrs[%d]);" %
+                       (b["name"], i))
+        out.append("}")
+        out.append("")
+        out.append("static inline void mm_configure_shims(aie_libxaie_ctx_t "
+                   "*ctx) {")
+        for col in sorted(set(b["shim"] for b in self.buffers)):
+            out.append("  mlir_aie_configure_shimdma_%d0(ctx);" % col)
+        out.append("}")
+        out.append("")
+        # the shim side of an objectFifo is symbolized <fifo> on its producer
+        # and <fifo>_cons on its consumers, with one lock per buffer on AIE1
+        # and a pair of semaphores on AIE2
+        out.append("// Let the shim DMAs send the inputs.")
+        out.append("static inline void mm_start_inputs(aie_libxaie_ctx_t "
+                   "*ctx) {")
+        for b in self.buffers:
+            if not b["output"]:
+                lock = b["fifo"] + ("_cons_lock" if aie2 else "_lock_0")
+                out.append("  mlir_aie_release_%s(ctx, 1, 0);" % lock)
+        out.append("}")
+        out.append("")
+        out.append("// Wait for the shim DMAs to receive the outputs, and return "
+                   "the number\n// of those which timed out.")
+        out.append("static inline int mm_wait_outputs(aie_libxaie_ctx_t *ctx, "
+                   "int timeout) {")
+        out.append("  int errors = 0;")
+        for b in self.buffers:
+            if b["output"]:
+                lock = b["fifo"] + ("_cons_cons_lock" if aie2 else
+                                    "_cons_lock_0")
+                out.append("  if (mlir_aie_acquire_%s(ctx, 1, timeout) != "
+                           "XAIE_OK)" % lock)
+                out.append("    errors++;")
+        out.append("  return errors;")
+        out.append("}")
+        out.append("")
+        out.append("#endif")
+        return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate a matrix multiply on an array of cores")
+    parser.add_argument("--rows", type=int, default=2,
+                        help="Rows of cores, tiling K in blocks of %d" % BLOCK)
+    parser.add_argument("--cols", type=int, default=4,
+                        help="Columns of cores, tiling N in blocks of %d" %
+                        BLOCK)
+    parser.add_argument("--m-tiles", type=int, default=8,
+                        help="Blocks of %d rows of A streamed through the "
+                        "array" % BLOCK)
+    parser.add_argument("--depth", type=int, default=2,
+                        help="Depth of the objectFifos of A, C and the "
+                        "partial sums")
+    parser.add_argument("--device", choices=sorted(DEVICES),
+                        default="xcvc1902")
+    parser.add_argument("--start-col", type=int, default=6,
+                        help="Column of the first column of cores")
+    parser.add_argument("-o", "--output", default=".",
+                        help="Directory to write aie.mlir and mm_buffers.h to")
+    args = parser.parse_args()
+
+    design = Design(args)
+    design.generate()
+    with open(os.path.join(args.output, "aie.mlir"), "w") as f:
+        f.write(design.mlir())
+    with open(os.path.join(args.output, "mm_buffers.h"), "w") as f:
+        f.write(design.header())
+    print("Generated %d cores: (%d x %d) * (%d x %d)" %
+          (args.rows * args.cols, args.m_tiles * BLOCK, args.rows * BLOCK,
+           args.rows * BLOCK, args.cols * BLOCK))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,31 @@
+//===- kernel_aie2.cc -------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// The kernel of ../MM_2x2/kernel.cc for AIE2 devices, in plain C: C = A * B +
+// acc on 32x32 int32 blocks stored column by column.
+
+#define NOCPP
+
+#include <stdint.h>
+
+#define N 32
+
+extern "C" {
+void extern_kernel(int32_t *restrict A, int32_t *restrict B,
+                   int32_t *restrict acc, int32_t *restrict C) {
+  for (unsigned j = 0; j < N; j++)
+    for (unsigned i = 0; i < N; i++) {
+      int32_t sum = acc[j * N + i];
+      for (unsigned k = 0; k < N; k++)
+        chess_prepare_for_pipelining sum += A[k * N + i] * B[j * N + k];
+      C[j * N + i] = sum;
+    }
+}
+}
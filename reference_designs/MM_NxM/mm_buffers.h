@@ -0,0 +1,128 @@
+//===- mm_buffers.h ---------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Generated with aie.mlir by code_gen.py: the sizes of the design and its
+// external buffers, for test.cpp.
+
+#ifndef MM_BUFFERS_H
+#define MM_BUFFERS_H
+
+#define MM_ROWS 2
+#define MM_COLS 4
+#define MM_M_TILES 8
+#define MM_BLOCK 32
+#define MM_MACS_PER_CYCLE 8
+
+enum mm_matrix { MM_A, MM_B, MM_C };
+
+// An external buffer holds count blocks of its matrix, given from first in
+// mm_blocks as (row block, column block), in the order the DMAs move them.
+struct mm_buffer {
+  const char *name;
+  enum mm_matrix matrix;
+  int first, count;
+};
+
+#define MM_NUM_BUFFERS 14
+static const struct mm_buffer mm_buffers[] = {
+  {"A_0_ddr", MM_A, 0, 8},
+  {"A_1_ddr", MM_A, 8, 8},
+  {"B_0_0_ddr", MM_B, 16, 1},
+  {"B_0_1_ddr", MM_B, 17, 1},
+  {"B_0_2_ddr", MM_B, 18, 1},
+  {"B_0_3_ddr", MM_B, 19, 1},
+  {"B_1_0_ddr", MM_B, 20, 1},
+  {"B_1_1_ddr", MM_B, 21, 1},
+  {"B_1_2_ddr", MM_B, 22, 1},
+  {"B_1_3_ddr", MM_B, 23, 1},
+  {"C_0_ddr", MM_C, 24, 8},
+  {"C_1_ddr", MM_C, 32, 8},
+  {"C_2_ddr", MM_C, 40, 8},
+  {"C_3_ddr", MM_C, 48, 8},
+};
+static const int mm_blocks[][2] = {
+  {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0},
+  {6, 0}, {7, 0}, {0, 1}, {1, 1}, {2, 1}, {3, 1},
+  {4, 1}, {5, 1}, {6, 1}, {7, 1}, {0, 0}, {0, 1},
+  {0, 2}, {0, 3}, {1, 0}, {1, 1}, {1, 2}, {1, 3},
+  {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0},
+  {6, 0}, {7, 0}, {0, 1}, {1, 1}, {2, 1}, {3, 1},
+  {4, 1}, {5, 1}, {6, 1}, {7, 1}, {0, 2}, {1, 2},
+  {2, 2}, {3, 2}, {4, 2}, {5, 2}, {6, 2}, {7, 2},
+  {0, 3}, {1, 3}, {2, 3}, {3, 3}, {4, 3}, {5, 3},
+  {6, 3}, {7, 3},
+};
+
+// The cores, as X(col, row).
+#define MM_FOR_EACH_CORE(X) \
+  X(6, 1) \
+  X(6, 2) \
+  X(7, 1) \
+  X(7, 2) \
+  X(8, 1) \
+  X(8, 2) \
+  X(9, 1) \
+  X(9, 2) \
+
+static inline void mm_set_addresses(aie_libxaie_ctx_t *ctx, u64 *addrs) {
+  mlir_aie_external_set_addr_A_0_ddr(ctx, addrs[0]);
+  mlir_aie_external_set_addr_A_1_ddr(ctx, addrs[1]);
+  mlir_aie_external_set_addr_B_0_0_ddr(ctx, addrs[2]);
+  mlir_aie_external_set_addr_B_0_1_ddr(ctx, addrs[3]);
+  mlir_aie_external_set_addr_B_0_2_ddr(ctx, addrs[4]);
+  mlir_aie_external_set_addr_B_0_3_ddr(ctx, addrs[5]);
+  mlir_aie_external_set_addr_B_1_0_ddr(ctx, addrs[6]);
+  mlir_aie_external_set_addr_B_1_1_ddr(ctx, addrs[7]);
+  mlir_aie_external_set_addr_B_1_2_ddr(ctx, addrs[8]);
+  mlir_aie_external_set_addr_B_1_3_ddr(ctx, addrs[9]);
+  mlir_aie_external_set_addr_C_0_ddr(ctx, addrs[10]);
+  mlir_aie_external_set_addr_C_1_ddr(ctx, addrs[11]);
+  mlir_aie_external_set_addr_C_2_ddr(ctx, addrs[12]);
+  mlir_aie_external_set_addr_C_3_ddr(ctx, addrs[13]);
+}
+
+static inline void mm_configure_shims(aie_libxaie_ctx_t *ctx) {
+  mlir_aie_configure_shimdma_20(ctx);
+  mlir_aie_configure_shimdma_30(ctx);
+  mlir_aie_configure_shimdma_60(ctx);
+  mlir_aie_configure_shimdma_70(ctx);
+  mlir_aie_configure_shimdma_100(ctx);
+}
+
+// Let the shim DMAs send the inputs.
+static inline void mm_start_inputs(aie_libxaie_ctx_t *ctx) {
+  mlir_aie_release_A_0_lock_0(ctx, 1, 0);
+  mlir_aie_release_A_1_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_0_0_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_0_1_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_0_2_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_0_3_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_1_0_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_1_1_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_1_2_lock_0(ctx, 1, 0);
+  mlir_aie_release_B_1_3_lock_0(ctx, 1, 0);
+}
+
+// Wait for the shim DMAs to receive the outputs, and return the number
+// of those which timed out.
+static inline int mm_wait_outputs(aie_libxaie_ctx_t *ctx, int timeout) {
+  int errors = 0;
+  if (mlir_aie_acquire_C_0_cons_lock_0(ctx, 1, timeout) != XAIE_OK)
+    errors++;
+  if (mlir_aie_acquire_C_1_cons_lock_0(ctx, 1, timeout) != XAIE_OK)
+    errors++;
+  if (mlir_aie_acquire_C_2_cons_lock_0(ctx, 1, timeout) != XAIE_OK)
+    errors++;
+  if (mlir_aie_acquire_C_3_cons_lock_0(ctx, 1, timeout) != XAIE_OK)
+    errors++;
+  return errors;
+}
+
+#endif
@@ -0,0 +1,147 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <vector>
+#include <xaiengine.h>
+
+#include "memory_allocator.h"
+#include "test_library.h"
+
+#include "aie_inc.cpp"
+
+#include "mm_buffers.h"
+
+#define M (MM_M_TILES * MM_BLOCK)
+#define K (MM_ROWS * MM_BLOCK)
+#define N (MM_COLS * MM_BLOCK)
+#define BLOCK_SIZE (MM_BLOCK * MM_BLOCK)
+
+// The offset of element (i, j) of a matrix in the external buffer b, or -1 if
+// b does not hold it. The blocks are stored column by column.
+static int offset(const mm_buffer &b, int i, int j) {
+  for (int n = 0; n < b.count; n++) {
+    const int *block = mm_blocks[b.first + n];
+    if (block[0] == i / MM_BLOCK && block[1] == j / MM_BLOCK)
+      return n * BLOCK_SIZE + (j % MM_BLOCK) * MM_BLOCK + i % MM_BLOCK;
+  }
+  return -1;
+}
+
+int main(int argc, char *argv[]) {
+  // The clock of the cores in MHz, to compare with the peak throughput.
+  double clockMHz = argc > 1 ? atof(argv[1]) : 1000.0;
+  printf("test start.\n");
+
+  aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+  mlir_aie_init_device(_xaie);
+
+#define CLEAR(col, row) mlir_aie_clear_tile_memory(_xaie, col, row);
+  MM_FOR_EACH_CORE(CLEAR)
+  mlir_aie_configure_cores(_xaie);
+  mlir_aie_configure_switchboxes(_xaie);
+  mlir_aie_initialize_locks(_xaie);
+  mlir_aie_configure_dmas(_xaie);
+
+  // Small values keep the sums exact in int32 for any K.
+  std::vector<int> A(M * K), B(K * N), C(M * N, 0);
+  srand(0);
+  for (int &a : A)
+    a = rand() % 8 - 4;
+  for (int &b : B)
+    b = rand() % 8 - 4;
+  for (int i = 0; i < M; i++)
+    for (int j = 0; j < N; j++)
+      for (int k = 0; k < K; k++)
+        C[i * N + j] += A[i * K + k] * B[k * N + j];
+
+  ext_mem_model_t handles[MM_NUM_BUFFERS];
+  int *ptrs[MM_NUM_BUFFERS];
+  u64 addrs[MM_NUM_BUFFERS];
+  const int rowsOf[] = {M, K, M}, colsOf[] = {K, N, N};
+  const std::vector<int> *matrices[] = {&A, &B, nullptr};
+  for (int b = 0; b < MM_NUM_BUFFERS; b++) {
+    const mm_buffer &buffer = mm_buffers[b];
+    int size = buffer.count * BLOCK_SIZE;
+    ptrs[b] = mlir_aie_mem_alloc(_xaie, handles[b], size);
+    const std::vector<int> *matrix = matrices[buffer.matrix];
+    int cols = colsOf[buffer.matrix];
+    for (int i = 0; i < rowsOf[buffer.matrix]; i++)
+      for (int j = 0; j < cols; j++) {
+        int o = offset(buffer, i, j);
+        if (o >= 0)
+          ptrs[b][o] = matrix ? (*matrix)[i * cols + j] : 0;
+      }
+    mlir_aie_sync_mem_dev(handles[b]);
+    addrs[b] = (u64)ptrs[b];
+  }
+  mm_set_addresses(_xaie, addrs);
+  mm_configure_shims(_xaie);
+
+  DataflowProfile profile(_xaie, clockMHz);
+#define PROFILE(col, row) profile.addCore(col, row);
+  MM_FOR_EACH_CORE(PROFILE)
+  profile.start();
+  mlir_aie_start_cores(_xaie);
+  mm_start_inputs(_xaie);
+
+  int errors = 0;
+  if (mm_wait_outputs(_xaie, 1000000)) {
+    printf("ERROR: timeout hit!\n");
+    errors++;
+  }
+  profile.stop();
+
+  for (int b = 0; b < MM_NUM_BUFFERS; b++) {
+    const mm_buffer &buffer = mm_buffers[b];
+    if (buffer.matrix != MM_C)
+      continue;
+    mlir_aie_sync_mem_cpu(handles[b]);
+    for (int i = 0; i < M; i++)
+      for (int j = 0; j < N; j++) {
+        int o = offset(buffer, i, j);
+        if (o >= 0 && ptrs[b][o] != C[i * N + j]) {
+          if (errors < 10)
+            printf("C[%d][%d] = %d, expected %d\n", i, j, ptrs[b][o],
+                   C[i * N + j]);
+          errors++;
+        }
+      }
+  }
+
+  // Two operations per MAC, against MM_MACS_PER_CYCLE MACs of each core.
+  double ops = 2.0 * M * N * K;
+  int cores = MM_ROWS * MM_COLS;
+  double peak = 2.0 * MM_MACS_PER_CYCLE * cores * clockMHz * 1e6;
+  profile.report(stdout, "matmul", ops, (double)(M * K + K * N + M * N) * 4);
+  profile.writeJSON(stdout, "matmul", ops, (double)(M * K + K * N + M * N) * 4);
+  printf("%dx%dx%d on %d cores: %.3f GOPS, %.1f%% of the peak %.3f GOPS\n", M,
+         K, N, cores, ops / profile.seconds() / 1e9,
+         100.0 * ops / profile.seconds() / peak, peak / 1e9);
+
+  for (int b = 0; b < MM_NUM_BUFFERS; b++)
+    mlir_aie_mem_free(_xaie, handles[b]);
+
+  int res = 0;
+  if (!errors) {
+    printf("PASS!\n");
+    res = 0;
+  } else {
+    printf("Fail!\n");
+    res = -1;
+  }
+  mlir_aie_deinit_libxaie(_xaie);
+
+  printf("test done.\n");
+
+  return res;
+}
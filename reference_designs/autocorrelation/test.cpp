@@ -45,6 +45,12 @@ int main(int argc, char *argv[]) {
   mlir_aie_external_set_addr_output((u64)output);
 
   mlir_aie_configure_shimdma_70(_xaie);
+
+  // The four cores of column 0 each compute a quarter of the lags.
+  DataflowProfile profile(_xaie);
+  for (int row = 1; row <= 4; row++)
+    profile.addCore(0, row);
+  profile.start();
   mlir_aie_start_cores(_xaie);
 
   for (int i = 0; i < 64; i++) {
@@ -60,6 +66,9 @@ int main(int argc, char *argv[]) {
   if (mlir_aie_acquire_output_lock(_xaie, 1, 100000)) {
     printf("ERROR: timeout hit!\n");
   }
+  profile.stop();
+  profile.report(stdout, "autocorrelation", 0, 2 * 64 * sizeof(int));
+  profile.writeJSON(stdout, "autocorrelation", 0, 2 * 64 * sizeof(int));
 
   mlir_aie_sync_mem_dev(_xaie, 0); // only used in libaiev2
   mlir_aie_sync_mem_dev(_xaie, 1); // only used in libaiev2
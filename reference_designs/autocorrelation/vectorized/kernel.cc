@@ -0,0 +1 @@
+#include "gen_aie.cc"
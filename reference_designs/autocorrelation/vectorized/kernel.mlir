@@ -0,0 +1,74 @@
+//===- kernel.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// The autocorrelation of ../aie.mlir for the 64 lags on a single core,
+// vectorized from affine code by aie-vectorize rather than written by hand.
+// The lags are the vectorized dimension, and the 8 samples of an iteration of
+// the outer loop give a chain of 8 FMA ops, interleaved over 2 accumulators
+// by num-accumulators=2.
+//
+// The testbench runs the kernel on the ISS and fails if it takes more than
+// MAX_CYCLES cycles. The kernel does 1024 x 64 MACs, that is 8192 cycles for
+// the 8 lanes of an int32 MAC, so the limit leaves room for the loads, stores
+// and the additions of the accumulators but not for a loss of the FMA
+// scheduling.
+
+// REQUIRES: valid_xchess_license
+// RUN: mkdir -p %t && cd %t
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --aie-vectorize="shift=0 num-accumulators=2" -unaligned-loads-check=false -lower-affine -canonicalize | aie-translate -aievec-to-cpp -o gen_aie.cc
+// RUN: xchesscc_wrapper aie -f -g +s +w work +o work -I%S -I. -DMAX_CYCLES=16384 %S/testbench.cc %S/kernel.cc
+// RUN: xca_udm_dbg -qf -T -P %aietools/data/versal_prod/lib -t "%S/../../../test/Integration/Dialect/AIEVec/profiling.tcl ./work/a.out" | FileCheck %s
+
+// CHECK: Cycle count: [[CC:[0-9]+]]
+// CHECK: PASSED
+
+// out[l] += in[i + l] * in[i] over the 1024 samples, of which in holds 64
+// more zeroes for the last lags: out must be zero on entry.
+func.func @autocorrelate(%in: memref<1088xi32>, %out: memref<64xi32>) {
+  affine.for %i = 0 to 1024 step 8 {
+    affine.for %l = 0 to 64 {
+      %c = affine.load %out[%l] : memref<64xi32>
+      %a0 = affine.load %in[%i + %l] : memref<1088xi32>
+      %b0 = affine.load %in[%i] : memref<1088xi32>
+      %p0 = arith.muli %a0, %b0 : i32
+      %s0 = arith.addi %c, %p0 : i32
+      %a1 = affine.load %in[%i + %l + 1] : memref<1088xi32>
+      %b1 = affine.load %in[%i + 1] : memref<1088xi32>
+      %p1 = arith.muli %a1, %b1 : i32
+      %s1 = arith.addi %s0, %p1 : i32
+      %a2 = affine.load %in[%i + %l + 2] : memref<1088xi32>
+      %b2 = affine.load %in[%i + 2] : memref<1088xi32>
+      %p2 = arith.muli %a2, %b2 : i32
+      %s2 = arith.addi %s1, %p2 : i32
+      %a3 = affine.load %in[%i + %l + 3] : memref<1088xi32>
+      %b3 = affine.load %in[%i + 3] : memref<1088xi32>
+      %p3 = arith.muli %a3, %b3 : i32
+      %s3 = arith.addi %s2, %p3 : i32
+      %a4 = affine.load %in[%i + %l + 4] : memref<1088xi32>
+      %b4 = affine.load %in[%i + 4] : memref<1088xi32>
+      %p4 = arith.muli %a4, %b4 : i32
+      %s4 = arith.addi %s3, %p4 : i32
+      %a5 = affine.load %in[%i + %l + 5] : memref<1088xi32>
+      %b5 = affine.load %in[%i + 5] : memref<1088xi32>
+      %p5 = arith.muli %a5, %b5 : i32
+      %s5 = arith.addi %s4, %p5 : i32
+      %a6 = affine.load %in[%i + %l + 6] : memref<1088xi32>
+      %b6 = affine.load %in[%i + 6] : memref<1088xi32>
+      %p6 = arith.muli %a6, %b6 : i32
+      %s6 = arith.addi %s5, %p6 : i32
+      %a7 = affine.load %in[%i + %l + 7] : memref<1088xi32>
+      %b7 = affine.load %in[%i + 7] : memref<1088xi32>
+      %p7 = arith.muli %a7, %b7 : i32
+      %s7 = arith.addi %s6, %p7 : i32
+      affine.store %s7, %out[%l] : memref<64xi32>
+    }
+  }
+  return
+}
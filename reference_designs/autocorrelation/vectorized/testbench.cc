@@ -0,0 +1,66 @@
+//===- testbench.cc ---------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "testbench.h"
+
+#define SAMPLES 1024
+#define LAGS 64
+
+// The cycles above which the kernel regressed, given by the RUN line of
+// kernel.mlir.
+#ifndef MAX_CYCLES
+#define MAX_CYCLES 16384
+#endif
+
+alignas(32) int32_t in[SAMPLES + LAGS];
+alignas(32) int32_t out[LAGS];
+int32_t ref[LAGS];
+
+#ifndef __chess__
+int chess_cycle_count() { return 0; }
+#endif
+
+int main() {
+  srand(10);
+  for (int i = 0; i < SAMPLES + LAGS; i++)
+    in[i] = i < SAMPLES ? rand() & 0xFF : 0;
+  for (int l = 0; l < LAGS; l++) {
+    out[l] = 0;
+    ref[l] = 0;
+    for (int i = 0; i < SAMPLES; i++)
+      ref[l] += in[i + l] * in[i];
+  }
+
+  printf("Running autocorrelation...\n");
+  auto cyclesBegin = chess_cycle_count();
+  autocorrelate(in, out);
+  auto cyclesEnd = chess_cycle_count();
+  int cycles = (int)(cyclesEnd - cyclesBegin);
+  printf("Cycle count: %d\n", cycles);
+
+  int errors = 0;
+  for (int l = 0; l < LAGS; l++)
+    if (out[l] != ref[l]) {
+      if (errors < 10)
+        printf("lag %d: got %d expected %d\n", l, out[l], ref[l]);
+      errors++;
+    }
+  if (cycles > MAX_CYCLES) {
+    printf("REGRESSION: %d cycles, more than the %d allowed\n", cycles,
+           MAX_CYCLES);
+    errors++;
+  }
+
+  if (errors == 0)
+    printf("PASSED\n");
+  else
+    printf("FAILED with %d errors\n", errors);
+  return errors ? 1 : 0;
+}
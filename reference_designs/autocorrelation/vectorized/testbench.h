@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void autocorrelate(int32_t *__restrict in, int32_t *__restrict out);
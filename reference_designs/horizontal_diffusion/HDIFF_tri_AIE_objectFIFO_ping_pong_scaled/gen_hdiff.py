@@ -0,0 +1,422 @@
+# (c) 2023 SAFARI Research Group at ETH Zurich, Gagandeep Singh, D-ITET
+
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Generates the tri-AIE horizontal diffusion scaled over the array, as
+# aie_<blocks>.mlir, and the description of its blocks for test.cpp, as
+# hdiff_<blocks>.h:
+#
+# - A block computes 4 rows of output with the lap, flux1 and flux2 stages
+#   of each row in three neighbouring columns, so it takes 3 x 4 cores.
+#   The 9 input rows the block needs are broadcast from a shim DMA to its
+#   lap and flux1 cores, and the flux2 core of its second row gathers the 4
+#   output rows and sends them back to the shim.
+# - Two blocks are stacked in each group of three columns, to fill the 8
+#   rows of cores, and the two blocks of a group share a shim NOC tile,
+#   which has two DMA channels each way.
+# - The groups go from --start-col to the right, and each gets the shim NOC
+#   tile which keeps the total distance of the groups to their shims the
+#   smallest, so the design is bounded both by the columns of the array and
+#   by its shim NOC tiles.
+
+import argparse
+import os
+
+# the shim NOC columns of xcvc1902, and its columns and rows of cores
+NOC_COLUMNS = [2, 3, 6, 7, 10, 11, 18, 19, 26, 27, 34, 35, 42, 43, 46, 47]
+COLUMNS = 50
+ROWS = 8
+# the stages of a row, one per column of a block
+STAGES = ["lap", "flux1", "flux2"]
+# the rows of output of a block, and the input rows they need
+BLOCK_DEPTH = 4
+INPUT_ROWS = BLOCK_DEPTH + 5
+BLOCKS_PER_GROUP = ROWS // BLOCK_DEPTH
+# the number of rows each core computes
+ITERATIONS = 2
+ROW_TYPE = "memref<256xi32>"
+FLUX_TYPE = "memref<512xi32>"
+ROW_SIZE = 256
+DDR_IN = ROW_SIZE * INPUT_ROWS
+DDR_OUT = ROW_SIZE * ITERATIONS * BLOCK_DEPTH
+
+
+def place_shims(groups, start_col):
+    """Return the shim NOC column of each group of three columns, matching
+    the groups to the shims from left to right with the smallest total
+    distance."""
+    shims = NOC_COLUMNS
+    if groups > len(shims):
+        raise SystemExit("xcvc1902 has %d shim NOC tiles for %d groups of "
+                         "blocks" % (len(shims), groups))
+    center = lambda g: start_col + 3 * g + 1
+    # cost[g][s]: the distance of groups g.. placed on shims s..
+    inf = float("inf")
+    cost = [[inf] * (len(shims) + 1) for _ in range(groups + 1)]
+    for s in range(len(shims) + 1):
+        cost[groups][s] = 0
+    for g in reversed(range(groups)):
+        for s in reversed(range(len(shims))):
+            cost[g][s] = min(cost[g][s + 1],
+                             abs(center(g) - shims[s]) + cost[g + 1][s + 1])
+    placed, s = [], 0
+    for g in range(groups):
+        while cost[g][s] == cost[g][s + 1]:
+            s += 1
+        placed.append(shims[s])
+        s += 1
+    return placed
+
+
+class Block:
+
+    def __init__(self, index, start_col, shim):
+        self.index = index
+        self.col = start_col + 3 * (index // BLOCKS_PER_GROUP)
+        self.row = 1 + BLOCK_DEPTH * (index % BLOCKS_PER_GROUP)
+        self.shim = shim
+        # the row of the flux2 core which gathers the output of the block
+        self.gather = self.row + 1
+
+    def core(self, stage, r):
+        return (self.col + stage, self.row + r)
+
+    def cores(self):
+        return [self.core(s, r) for s in range(len(STAGES))
+                for r in range(BLOCK_DEPTH)]
+
+    def fifo(self, name):
+        return "block_%d_%s" % (self.index, name)
+
+    def input(self):
+        return self.fifo("in_shim_%d" % self.shim)
+
+    def output(self):
+        return self.fifo("out_shim_%d" % self.shim)
+
+
+def place(blocks, start_col):
+    """Return the blocks of the design, with their cores and shims."""
+    groups = (blocks + BLOCKS_PER_GROUP - 1) // BLOCKS_PER_GROUP
+    if blocks < 1 or start_col + 3 * groups > COLUMNS:
+        raise SystemExit("xcvc1902 has room for %d blocks from column %d" %
+                         ((COLUMNS - start_col) // 3 * BLOCKS_PER_GROUP,
+                          start_col))
+    shims = place_shims(groups, start_col)
+    return [Block(b, start_col, shims[b // BLOCKS_PER_GROUP])
+            for b in range(blocks)]
+
+
+class Design:
+
+    def __init__(self, args):
+        self.args = args
+        self.blocks = place(args.blocks, args.start_col)
+        self.lines = []
+
+    def emit(self, line=""):
+        self.lines.append(line)
+
+    def tile(self, col, row):
+        return "%%tile%d_%d" % (col, row)
+
+    def fifo(self, name, producer, consumers, depth, type=ROW_TYPE):
+        self.emit("  AIE.objectFifo @%s (%s, {%s}, %d : i32) : "
+                  "!AIE.objectFifo<%s>" %
+                  (name, self.tile(*producer),
+                   ", ".join(self.tile(*c) for c in consumers), depth, type))
+
+    def acquire(self, value, fifo, port, count, type=ROW_TYPE):
+        self.emit("      %%%s = AIE.objectFifo.acquire @%s (%s, %d) : "
+                  "!AIE.objectFifoSubview<%s>" % (value, fifo, port, count,
+                                                  type))
+
+    def access(self, value, subview, index, type=ROW_TYPE):
+        self.emit("      %%%s = AIE.objectFifo.subview.access %%%s[%d] : "
+                  "!AIE.objectFifoSubview<%s> -> %s" %
+                  (value, subview, index, type, type))
+
+    def call(self, func, operands, types):
+        self.emit("      func.call @%s(%s) : (%s) -> ()" %
+                  (func, ", ".join("%" + o for o in operands),
+                   ", ".join(types)))
+
+    def release(self, fifo, port, count, indent=6):
+        self.emit("%sAIE.objectFifo.release @%s (%s, %d)" %
+                  (" " * indent, fifo, port, count))
+
+    def generate(self):
+        self.emit("module @hdiff_bundle_%d {" % len(self.blocks))
+        tiles = set()
+        for b in self.blocks:
+            tiles.update(b.cores())
+            tiles.add((b.shim, 0))
+        for col, row in sorted(tiles):
+            self.emit("  %s = AIE.tile(%d, %d)" % (self.tile(col, row), col,
+                                                  row))
+        self.emit()
+
+        for b in self.blocks:
+            self.emit("  // block %d: columns %d to %d, rows %d to %d, "
+                      "shim %d" % (b.index, b.col, b.col + 2, b.row,
+                                   b.row + BLOCK_DEPTH - 1, b.shim))
+            readers = [b.core(s, r) for r in range(BLOCK_DEPTH)
+                       for s in range(2)]
+            self.fifo(b.input(), (b.shim, 0), readers, INPUT_ROWS)
+            for r in range(BLOCK_DEPTH):
+                self.fifo(b.fifo("row_%d_inter_lap" % r), b.core(0, r),
+                          [b.core(1, r)], 5)
+                self.fifo(b.fifo("row_%d_inter_flx1" % r), b.core(1, r),
+                          [b.core(2, r)], 6, FLUX_TYPE)
+                if b.row + r == b.gather:
+                    self.fifo(b.output(), b.core(2, r), [(b.shim, 0)], 5)
+                else:
+                    self.fifo(b.fifo("row_%d_out_flx2" % r), b.core(2, r),
+                              [(b.col + 2, b.gather)], 2)
+            self.emit()
+
+        for b in self.blocks:
+            self.emit("  %%ext_buffer_in_%d = AIE.external_buffer {sym_name = "
+                      "\"ddr_buffer_in_%d\"} : memref<%dxi32>" %
+                      (b.index, b.index, DDR_IN))
+            self.emit("  %%ext_buffer_out_%d = AIE.external_buffer {sym_name "
+                      "= \"ddr_buffer_out_%d\"} : memref<%dxi32>" %
+                      (b.index, b.index, DDR_OUT))
+            self.emit("  AIE.objectFifo.registerExternalBuffers @%s (%s, "
+                      "{%%ext_buffer_in_%d}) : (memref<%dxi32>)" %
+                      (b.input(), self.tile(b.shim, 0), b.index, DDR_IN))
+            self.emit("  AIE.objectFifo.registerExternalBuffers @%s (%s, "
+                      "{%%ext_buffer_out_%d}) : (memref<%dxi32>)" %
+                      (b.output(), self.tile(b.shim, 0), b.index, DDR_OUT))
+        self.emit()
+
+        self.emit("  func.func private @hdiff_lap(%s) -> ()" %
+                  ", ".join(["%%in%d: %s" % (i, ROW_TYPE) for i in range(5)] +
+                            ["%%lap%d: %s" % (i, ROW_TYPE) for i in range(4)]))
+        self.emit("  func.func private @hdiff_flux1(%s) -> ()" %
+                  ", ".join(["%%in%d: %s" % (i, ROW_TYPE) for i in range(3)] +
+                            ["%%lap%d: %s" % (i, ROW_TYPE) for i in range(4)] +
+                            ["%%flux%d: %s" % (i, FLUX_TYPE)
+                             for i in range(5)]))
+        self.emit("  func.func private @hdiff_flux2(%s, %%out: %s) -> ()" %
+                  (", ".join("%%flux%d: %s" % (i, FLUX_TYPE)
+                             for i in range(5)), ROW_TYPE))
+        self.emit()
+
+        for b in self.blocks:
+            for r in range(BLOCK_DEPTH):
+                self.generate_lap(b, r)
+                self.generate_flux1(b, r)
+                self.generate_flux2(b, r)
+        self.emit("}")
+
+    def begin_core(self, b, stage, r):
+        col, row = b.core(stage, r)
+        self.emit("  %%block_%d_core%d_%d = AIE.core(%s) {" %
+                  (b.index, col, row, self.tile(col, row)))
+        self.emit("    %lb = arith.constant 0 : index")
+        self.emit("    %%ub = arith.constant %d : index" % ITERATIONS)
+        self.emit("    %step = arith.constant 1 : index")
+        self.emit("    scf.for %iv = %lb to %ub step %step {")
+
+    def end_core(self, b, stage):
+        self.emit("    AIE.end")
+        self.emit("  } { link_with=\"hdiff_%s.o\" }" % STAGES[stage])
+        self.emit()
+
+    def generate_lap(self, b, r):
+        self.begin_core(b, 0, r)
+        # the rows r to r + 4 of the input for each row of output, with the
+        # next row of output of the block in the next iteration
+        self.acquire("in", b.input(), "Consume", INPUT_ROWS - 1)
+        for i in range(5):
+            self.access("row%d" % i, "in", r + i)
+        self.acquire("lap", b.fifo("row_%d_inter_lap" % r), "Produce", 4)
+        for i in range(4):
+            self.access("lap%d" % i, "lap", i)
+        self.call("hdiff_lap", ["row%d" % i for i in range(5)] +
+                  ["lap%d" % i for i in range(4)], [ROW_TYPE] * 9)
+        self.release(b.input(), "Consume", 1)
+        self.release(b.fifo("row_%d_inter_lap" % r), "Produce", 4)
+        self.emit("    }")
+        # the last iteration keeps all but one of the rows it acquired
+        self.release(b.input(), "Consume", INPUT_ROWS - 2, 4)
+        self.end_core(b, 0)
+
+    def generate_flux1(self, b, r):
+        self.begin_core(b, 1, r)
+        self.acquire("in", b.input(), "Consume", INPUT_ROWS - 1)
+        for i in range(1, 4):
+            self.access("row%d" % i, "in", r + i)
+        self.acquire("lap", b.fifo("row_%d_inter_lap" % r), "Consume", 4)
+        for i in range(4):
+            self.access("lap%d" % i, "lap", i)
+        self.acquire("flux", b.fifo("row_%d_inter_flx1" % r), "Produce", 5,
+                     FLUX_TYPE)
+        for i in range(5):
+            self.access("flux%d" % i, "flux", i, FLUX_TYPE)
+        self.call("hdiff_flux1", ["row%d" % i for i in range(1, 4)] +
+                  ["lap%d" % i for i in range(4)] +
+                  ["flux%d" % i for i in range(5)],
+                  [ROW_TYPE] * 7 + [FLUX_TYPE] * 5)
+        self.release(b.fifo("row_%d_inter_lap" % r), "Consume", 4)
+        self.release(b.fifo("row_%d_inter_flx1" % r), "Produce", 5)
+        self.release(b.input(), "Consume", 1)
+        self.emit("    }")
+        self.release(b.input(), "Consume", INPUT_ROWS - 2, 4)
+        self.end_core(b, 1)
+
+    def generate_flux2(self, b, r):
+        gather = b.row + r == b.gather
+        if gather:
+            self.emit("  // gathers the output of block %d" % b.index)
+        self.begin_core(b, 2, r)
+        self.acquire("flux", b.fifo("row_%d_inter_flx1" % r), "Consume", 5,
+                     FLUX_TYPE)
+        for i in range(5):
+            self.access("flux%d" % i, "flux", i, FLUX_TYPE)
+        others = [o for o in range(BLOCK_DEPTH) if o != r]
+        if gather:
+            # the output of the block, in the order of its rows
+            self.acquire("out", b.output(), "Produce", BLOCK_DEPTH)
+            for i in range(BLOCK_DEPTH):
+                self.access("out%d" % i, "out", i)
+            for o in others:
+                self.acquire("from%d" % o, b.fifo("row_%d_out_flx2" % o),
+                             "Consume", 1)
+                self.access("row%d" % o, "from%d" % o, 0)
+                self.emit("      memref.copy %%row%d, %%out%d : %s to %s" %
+                          (o, o, ROW_TYPE, ROW_TYPE))
+            result = "out%d" % r
+        else:
+            self.acquire("out", b.fifo("row_%d_out_flx2" % r), "Produce", 1)
+            self.access("out0", "out", 0)
+            result = "out0"
+        self.call("hdiff_flux2", ["flux%d" % i for i in range(5)] + [result],
+                  [FLUX_TYPE] * 5 + [ROW_TYPE])
+        self.release(b.fifo("row_%d_inter_flx1" % r), "Consume", 5)
+        if gather:
+            for o in others:
+                self.release(b.fifo("row_%d_out_flx2" % o), "Consume", 1)
+            self.release(b.output(), "Produce", BLOCK_DEPTH)
+        else:
+            self.release(b.fifo("row_%d_out_flx2" % r), "Produce", 1)
+        self.emit("    }")
+        self.end_core(b, 2)
+
+    def mlir(self):
+        return """// (c) 2023 SAFARI Research Group at ETH Zurich, Gagandeep Singh, D-ITET
+
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Generated by
+//   python3 gen_hdiff.py --blocks %d --start-col %d
+// for %d blocks of %d cores.
+
+""" % (self.args.blocks, self.args.start_col, len(self.blocks),
+       len(STAGES) * BLOCK_DEPTH) + "\n".join(self.lines) + "\n"
+
+    def header(self):
+        blocks = self.blocks
+        shims = sorted(set(b.shim for b in blocks))
+        out = ["""// (c) 2023 SAFARI Research Group at ETH Zurich, Gagandeep Singh, D-ITET
+
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Generated with aie_%d.mlir by gen_hdiff.py: the blocks of the design and
+// their external buffers, for test.cpp.
+
+#ifndef HDIFF_DESIGN_H
+#define HDIFF_DESIGN_H
+
+#define HDIFF_BLOCKS %d
+#define HDIFF_BLOCK_DEPTH %d
+#define HDIFF_SHIMS %d
+// the int32 elements of the input and the output of a block
+#define HDIFF_DMA_COUNT_IN %d
+#define HDIFF_DMA_COUNT_OUT %d
+""" % (len(blocks), len(blocks), BLOCK_DEPTH, len(shims), DDR_IN, DDR_OUT)]
+        out.append("// The cores, as X(block, stage, col, row), with the "
+                   "stages\n// %s." % ", ".join(STAGES))
+        out.append("#define HDIFF_FOR_EACH_CORE(X) \\")
+        for b in blocks:
+            for s in range(len(STAGES)):
+                for r in range(BLOCK_DEPTH):
+                    out.append("  X(%d, %d, %d, %d) \\" %
+                               ((b.index, s) + b.core(s, r)))
+        out.append("")
+        out.append("static inline void hdiff_set_addresses(aie_libxaie_ctx_t "
+                   "*ctx, u64 *in,")
+        out.append("                                       u64 *out) {")
+        for b in blocks:
+            out.append("  mlir_aie_external_set_addr_ddr_buffer_in_%d(ctx, "
+                       "in[%d]);" % (b.index, b.index))
+            out.append("  mlir_aie_external_set_addr_ddr_buffer_out_%d(ctx, "
+                       "out[%d]);" % (b.index, b.index))
+        out.append("}")
+        out.append("")
+        out.append("static inline void hdiff_configure_shims(aie_libxaie_ctx_t "
+                   "*ctx) {")
+        for col in shims:
+            out.append("  mlir_aie_configure_shimdma_%d0(ctx);" % col)
+        out.append("}")
+        out.append("")
+        # the shim side of an objectFifo is symbolized <fifo> on its producer
+        # and <fifo>_cons on its consumers, with one lock per buffer
+        out.append("// Let the shim DMAs send the inputs and receive the "
+                   "outputs.")
+        out.append("static inline void hdiff_start(aie_libxaie_ctx_t *ctx) {")
+        for b in blocks:
+            out.append("  mlir_aie_release_%s_cons_lock_0(ctx, 0, 0);" %
+                       b.output())
+            out.append("  mlir_aie_release_%s_lock_0(ctx, 1, 0);" % b.input())
+        out.append("}")
+        out.append("")
+        out.append("// Wait for the shim DMAs to receive the outputs, and "
+                   "return the number\n// of those which timed out.")
+        out.append("static inline int hdiff_wait(aie_libxaie_ctx_t *ctx, "
+                   "int timeout) {")
+        out.append("  int errors = 0;")
+        for b in blocks:
+            out.append("  if (mlir_aie_acquire_%s_cons_lock_0(ctx, 1, "
+                       "timeout) !=\n      XAIE_OK)" % b.output())
+            out.append("    errors++;")
+        out.append("  return errors;")
+        out.append("}")
+        out.append("")
+        out.append("#endif")
+        return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the scaled tri-AIE horizontal diffusion.")
+    parser.add_argument("-b", "--blocks", type=int, default=32,
+                        help="the number of blocks of 12 cores")
+    parser.add_argument("--start-col", type=int, default=0,
+                        help="the first column of the blocks")
+    parser.add_argument("-o", "--output-dir", default=".",
+                        help="the directory of the generated files")
+    args = parser.parse_args()
+
+    design = Design(args)
+    design.generate()
+    with open(os.path.join(args.output_dir, "aie_%d.mlir" % args.blocks),
+              "w") as f:
+        f.write(design.mlir())
+    with open(os.path.join(args.output_dir, "hdiff_%d.h" % args.blocks),
+              "w") as f:
+        f.write(design.header())
+    print("%d blocks on %d cores, %d shim NOC tiles" %
+          (args.blocks, args.blocks * len(STAGES) * BLOCK_DEPTH,
+           len(set(b.shim for b in design.blocks))))
+
+
+if __name__ == "__main__":
+    main()
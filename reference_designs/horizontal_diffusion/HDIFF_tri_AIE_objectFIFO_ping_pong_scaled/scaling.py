@@ -0,0 +1,65 @@
+# (c) 2023 SAFARI Research Group at ETH Zurich, Gagandeep Singh, D-ITET
+
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Compares the runs of test.cpp for the different numbers of blocks, from
+# the logs of the runs: the throughput of each size, its scaling efficiency,
+# i.e. its throughput per core over the one of the smallest size, and the
+# share of the shim NOC tile streams it uses.
+
+import argparse
+import json
+import sys
+
+
+def runs(files):
+    found = {}
+    for f in files:
+        for line in f:
+            line = line.strip()
+            if not line.startswith("{") or "hdiff_scaling" not in line:
+                continue
+            run = json.loads(line)
+            # keep the best run of each size
+            best = found.get(run["blocks"])
+            if not best or run["points_per_s"] > best["points_per_s"]:
+                found[run["blocks"]] = run
+    return [found[b] for b in sorted(found)]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Report the scaling of the horizontal diffusion.")
+    parser.add_argument("logs", nargs="*", type=argparse.FileType("r"),
+                        help="the logs of the runs, or the standard input")
+    parser.add_argument("--threshold", type=float, default=0.9,
+                        help="the efficiency under which the design stops "
+                        "scaling")
+    args = parser.parse_args()
+
+    found = runs(args.logs or [sys.stdin])
+    if not found:
+        raise SystemExit("no hdiff_scaling line in the logs")
+    base = found[0]
+    per_core = base["points_per_s"] / base["cores"]
+    print("%6s %6s %5s %12s %10s %10s" % ("blocks", "cores", "shims",
+                                            "Mpoints/s", "efficiency",
+                                            "shim use"))
+    limit = None
+    for run in found:
+        efficiency = run["points_per_s"] / (per_core * run["cores"])
+        print("%6d %6d %5d %12.3f %9.1f%% %9.1f%%" %
+              (run["blocks"], run["cores"], run["shims"],
+               run["points_per_s"] / 1e6, 100 * efficiency,
+               100 * run["shim_share"]))
+        if limit is None and efficiency < args.threshold:
+            limit = run
+    if limit:
+        print("stops scaling at %d blocks, with %.1f%% of the shim streams "
+              "used" % (limit["blocks"], 100 * limit["shim_share"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+// (c) 2023 SAFARI Research Group at ETH Zurich, Gagandeep Singh, D-ITET
+
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "memory_allocator.h"
+#include "test_library.h"
+
+#include "aie_inc.cpp"
+
+// The description of the design generated with its aie_<blocks>.mlir, given
+// by the Makefile as -DHDIFF_DESIGN='"hdiff_<blocks>.h"'.
+#ifndef HDIFF_DESIGN
+#define HDIFF_DESIGN "hdiff_32.h"
+#endif
+#include HDIFF_DESIGN
+
+// The bytes a shim DMA channel moves per cycle, and the channels of a shim
+// NOC tile in both directions.
+#define SHIM_CHANNEL_BYTES 4
+#define SHIM_CHANNELS 4
+
+int main(int argc, char *argv[]) {
+  // The clock of the cores and the stream switches in MHz.
+  double clockMHz = argc > 1 ? atof(argv[1]) : 1000.0;
+  printf("test start.\n");
+
+  aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+  mlir_aie_init_device(_xaie);
+
+#define CLEAR(block, stage, col, row)                                          \
+  mlir_aie_clear_tile_memory(_xaie, col, row);
+  HDIFF_FOR_EACH_CORE(CLEAR)
+  mlir_aie_configure_cores(_xaie);
+  mlir_aie_configure_switchboxes(_xaie);
+  mlir_aie_initialize_locks(_xaie);
+  mlir_aie_configure_dmas(_xaie);
+
+  // Every block gets the same input, so they must all give the same output.
+  ext_mem_model_t in[HDIFF_BLOCKS], out[HDIFF_BLOCKS];
+  int *ddr_in[HDIFF_BLOCKS], *ddr_out[HDIFF_BLOCKS];
+  u64 in_addrs[HDIFF_BLOCKS], out_addrs[HDIFF_BLOCKS];
+  for (int b = 0; b < HDIFF_BLOCKS; b++) {
+    ddr_in[b] = mlir_aie_mem_alloc(_xaie, in[b], HDIFF_DMA_COUNT_IN);
+    ddr_out[b] = mlir_aie_mem_alloc(_xaie, out[b], HDIFF_DMA_COUNT_OUT);
+    for (int i = 0; i < HDIFF_DMA_COUNT_IN; i++)
+      ddr_in[b][i] = i;
+    memset(ddr_out[b], 0, HDIFF_DMA_COUNT_OUT * sizeof(int));
+    mlir_aie_sync_mem_dev(in[b]);
+    mlir_aie_sync_mem_dev(out[b]);
+    in_addrs[b] = (u64)ddr_in[b];
+    out_addrs[b] = (u64)ddr_out[b];
+  }
+  hdiff_set_addresses(_xaie, in_addrs, out_addrs);
+  hdiff_configure_shims(_xaie);
+
+  DataflowProfile profile(_xaie, clockMHz);
+  const char *stages[] = {"lap", "flux1", "flux2"};
+  char name[32];
+#define PROFILE(block, stage, col, row)                                        \
+  snprintf(name, sizeof(name), "b%d_%s_%d", block, stages[stage], row);       \
+  profile.addCore(col, row, name);
+  HDIFF_FOR_EACH_CORE(PROFILE)
+  profile.start();
+  mlir_aie_start_cores(_xaie);
+  hdiff_start(_xaie);
+
+  int errors = 0;
+  if (hdiff_wait(_xaie, 1000000)) {
+    printf("ERROR: timeout hit!\n");
+    errors++;
+  }
+  profile.stop();
+
+  int nonzero = 0;
+  for (int b = 0; b < HDIFF_BLOCKS; b++) {
+    mlir_aie_sync_mem_cpu(out[b]);
+    for (int i = 0; i < HDIFF_DMA_COUNT_OUT; i++) {
+      if (b == 0) {
+        nonzero += ddr_out[0][i] != 0;
+      } else if (ddr_out[b][i] != ddr_out[0][i]) {
+        if (errors < 10)
+          printf("block %d: out[%d] = %d, block 0 gave %d\n", b, i,
+                 ddr_out[b][i], ddr_out[0][i]);
+        errors++;
+      }
+    }
+  }
+  if (!nonzero) {
+    printf("ERROR: no output\n");
+    errors++;
+  }
+
+  // The output points computed, and the bytes the shims moved.
+  double points = (double)HDIFF_BLOCKS * HDIFF_DMA_COUNT_OUT;
+  double bytes = (double)HDIFF_BLOCKS *
+                 (HDIFF_DMA_COUNT_IN + HDIFF_DMA_COUNT_OUT) * sizeof(int);
+  double time = profile.seconds();
+  double shimBytesPerS = time ? bytes / time / HDIFF_SHIMS : 0;
+  double shimPeak = SHIM_CHANNELS * SHIM_CHANNEL_BYTES * clockMHz * 1e6;
+  profile.report(stdout, "hdiff", points, bytes);
+  profile.writeJSON(stdout, "hdiff", points, bytes);
+  printf("%d blocks on %d cores, %d shim NOC tiles: %.3f Mpoints/s, "
+         "%.3f GB/s per shim NOC tile, %.1f%% of its streams\n",
+         HDIFF_BLOCKS, HDIFF_BLOCKS * 3 * HDIFF_BLOCK_DEPTH, HDIFF_SHIMS,
+         time ? points / time / 1e6 : 0, shimBytesPerS / 1e9,
+         100.0 * shimBytesPerS / shimPeak);
+  // For scaling.py, which compares the runs of the different sizes.
+  printf("{\"name\": \"hdiff_scaling\", \"blocks\": %d, \"cores\": %d, "
+         "\"shims\": %d, \"points_per_s\": %g, \"shim_bytes_per_s\": %g, "
+         "\"shim_share\": %g}\n",
+         HDIFF_BLOCKS, HDIFF_BLOCKS * 3 * HDIFF_BLOCK_DEPTH, HDIFF_SHIMS,
+         time ? points / time : 0, shimBytesPerS, shimBytesPerS / shimPeak);
+
+  int res = 0;
+  if (!errors) {
+    printf("PASS!\n");
+    res = 0;
+  } else {
+    printf("Fail!\n");
+    res = -1;
+  }
+
+  for (int b = 0; b < HDIFF_BLOCKS; b++) {
+    mlir_aie_mem_free(_xaie, in[b]);
+    mlir_aie_mem_free(_xaie, out[b]);
+  }
+  mlir_aie_deinit_libxaie(_xaie);
+
+  printf("test done.\n");
+
+  return res;
+}
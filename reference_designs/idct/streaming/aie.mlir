@@ -0,0 +1,98 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: valid_xchess_license
+// RUN: xchesscc -p me -P %aietools/data/cervino/lib -c %S/../dequant.cc %S/../idct_horizontal.cc %S/../idct_vertical.cc
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include %extraAieCcFlags% -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf %S/../image.txt
+
+// The IDCT of the parent directory streaming frames back to back: a frame
+// of 8 blocks of 8x8 coefficients goes through the dequant, horizontal and
+// vertical stages, with ping-pong objectFifos between the stages so that
+// each stage works on a block while the next one arrives.
+// Both directions of the shim DMA have two external buffers, so the chain
+// of two BDs loops over them: the host fills one input frame and reads one
+// output frame while the DMAs move the other. The cores run for all the
+// 1024 frames of the test.
+
+module @idct_streaming {
+  AIE.device(xcvc1902) {
+    %t75 = AIE.tile(7, 5)
+    %t74 = AIE.tile(7, 4)
+    %t73 = AIE.tile(7, 3)
+    %t70 = AIE.tile(7, 0)
+
+    AIE.objectFifo @of_in (%t70, {%t73}, 2 : i32) : !AIE.objectFifo<memref<64xi16>>
+    AIE.objectFifo @of_dequant_horizontal (%t73, {%t74}, 2 : i32) : !AIE.objectFifo<memref<64xi16>>
+    AIE.objectFifo @of_horizontal_vertical (%t74, {%t75}, 2 : i32) : !AIE.objectFifo<memref<64xi16>>
+    AIE.objectFifo @of_out (%t75, {%t70}, 2 : i32) : !AIE.objectFifo<memref<64xi16>>
+
+    // The input and output frames, in ping-pong.
+    %in_ping = AIE.external_buffer { sym_name = "frame_in_ping" } : memref<512xi16>
+    %in_pong = AIE.external_buffer { sym_name = "frame_in_pong" } : memref<512xi16>
+    %out_ping = AIE.external_buffer { sym_name = "frame_out_ping" } : memref<512xi16>
+    %out_pong = AIE.external_buffer { sym_name = "frame_out_pong" } : memref<512xi16>
+
+    AIE.objectFifo.registerExternalBuffers @of_in (%t70, {%in_ping, %in_pong}) : (memref<512xi16>, memref<512xi16>)
+    AIE.objectFifo.registerExternalBuffers @of_out (%t70, {%out_ping, %out_pong}) : (memref<512xi16>, memref<512xi16>)
+
+    func.func private @dequant_8x8(%A: memref<64xi16>, %B: memref<64xi16>) -> ()
+    func.func private @idct_8x8_mmult_h(%A: memref<64xi16>, %B: memref<64xi16>) -> ()
+    func.func private @idct_8x8_mmult_v(%A: memref<64xi16>, %B: memref<64xi16>) -> ()
+
+    %c73 = AIE.core(%t73) {
+      %lb = arith.constant 0 : index
+      %ub = arith.constant 8192 : index // 1024 frames of 8 blocks
+      %step = arith.constant 1 : index
+      scf.for %iv = %lb to %ub step %step {
+        %inputSubview = AIE.objectFifo.acquire @of_in (Consume, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %input = AIE.objectFifo.subview.access %inputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        %outputSubview = AIE.objectFifo.acquire @of_dequant_horizontal (Produce, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %output = AIE.objectFifo.subview.access %outputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        func.call @dequant_8x8(%input, %output) : (memref<64xi16>, memref<64xi16>) -> ()
+        AIE.objectFifo.release @of_in (Consume, 1)
+        AIE.objectFifo.release @of_dequant_horizontal (Produce, 1)
+      }
+      AIE.end
+    } { link_with="dequant.o" }
+
+    %c74 = AIE.core(%t74) {
+      %lb = arith.constant 0 : index
+      %ub = arith.constant 8192 : index
+      %step = arith.constant 1 : index
+      scf.for %iv = %lb to %ub step %step {
+        %inputSubview = AIE.objectFifo.acquire @of_dequant_horizontal (Consume, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %input = AIE.objectFifo.subview.access %inputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        %outputSubview = AIE.objectFifo.acquire @of_horizontal_vertical (Produce, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %output = AIE.objectFifo.subview.access %outputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        func.call @idct_8x8_mmult_h(%input, %output) : (memref<64xi16>, memref<64xi16>) -> ()
+        AIE.objectFifo.release @of_dequant_horizontal (Consume, 1)
+        AIE.objectFifo.release @of_horizontal_vertical (Produce, 1)
+      }
+      AIE.end
+    } { link_with="idct_horizontal.o" }
+
+    %c75 = AIE.core(%t75) {
+      %lb = arith.constant 0 : index
+      %ub = arith.constant 8192 : index
+      %step = arith.constant 1 : index
+      scf.for %iv = %lb to %ub step %step {
+        %inputSubview = AIE.objectFifo.acquire @of_horizontal_vertical (Consume, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %input = AIE.objectFifo.subview.access %inputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        %outputSubview = AIE.objectFifo.acquire @of_out (Produce, 1) : !AIE.objectFifoSubview<memref<64xi16>>
+        %output = AIE.objectFifo.subview.access %outputSubview[0] : !AIE.objectFifoSubview<memref<64xi16>> -> memref<64xi16>
+        func.call @idct_8x8_mmult_v(%input, %output) : (memref<64xi16>, memref<64xi16>) -> ()
+        AIE.objectFifo.release @of_horizontal_vertical (Consume, 1)
+        AIE.objectFifo.release @of_out (Produce, 1)
+      }
+      AIE.end
+    } { link_with="idct_vertical.o" }
+  }
+}
@@ -0,0 +1,178 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "memory_allocator.h"
+#include "test_library.h"
+
+#include "aie_inc.cpp"
+
+// The frames the cores of aie.mlir run for, of 8 blocks of 8x8.
+#define FRAMES 1024
+#define BLOCKS 8
+#define BLOCK_SIZE 64
+#define FRAME_SIZE (BLOCKS * BLOCK_SIZE)
+#define TIMEOUT 100000
+
+// Frame f holds the blocks of the image rotated by f, so that each frame is
+// different, and since the blocks are independent, block b of its output is
+// block (b + f) % BLOCKS of the output of frame 0.
+static void fill(int16_t *frame, const int16_t *image, int f) {
+  for (int b = 0; b < BLOCKS; b++)
+    memcpy(frame + b * BLOCK_SIZE, image + (b + f) % BLOCKS * BLOCK_SIZE,
+           BLOCK_SIZE * sizeof(int16_t));
+}
+
+// Give the input buffer p of the shim DMA a new frame, once it sent the
+// previous one.
+static void send(aie_libxaie_ctx_t *ctx, int p, ext_mem_model_t &handle) {
+  mlir_aie_sync_mem_dev(handle);
+  if (p)
+    mlir_aie_release_of_in_lock_1(ctx, 1, 0);
+  else
+    mlir_aie_release_of_in_lock_0(ctx, 1, 0);
+}
+
+int main(int argc, char *argv[]) {
+  const char *path = argc > 1 ? argv[1] : "image.txt";
+  // The clock of the cores in MHz.
+  double clockMHz = argc > 2 ? atof(argv[2]) : 1000.0;
+  printf("test start.\n");
+
+  int16_t image[FRAME_SIZE];
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    perror("Error opening file: ");
+    return 1;
+  }
+  int num, n = 0;
+  while (n < FRAME_SIZE && fscanf(file, "%d\n", &num) > 0)
+    image[n++] = num;
+  fclose(file);
+  if (n < FRAME_SIZE) {
+    printf("ERROR: %s has %d of the %d coefficients of a frame\n", path, n,
+           FRAME_SIZE);
+    return 1;
+  }
+
+  aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+  mlir_aie_init_device(_xaie);
+
+  mlir_aie_clear_tile_memory(_xaie, 7, 3);
+  mlir_aie_clear_tile_memory(_xaie, 7, 4);
+  mlir_aie_clear_tile_memory(_xaie, 7, 5);
+  mlir_aie_configure_cores(_xaie);
+  mlir_aie_configure_switchboxes(_xaie);
+  mlir_aie_initialize_locks(_xaie);
+  mlir_aie_configure_dmas(_xaie);
+
+  ext_mem_model_t in[2], out[2];
+  int16_t *in_ptr[2], *out_ptr[2];
+  for (int p = 0; p < 2; p++) {
+    in_ptr[p] = (int16_t *)mlir_aie_mem_alloc(_xaie, in[p], FRAME_SIZE / 2);
+    out_ptr[p] = (int16_t *)mlir_aie_mem_alloc(_xaie, out[p], FRAME_SIZE / 2);
+    memset(out_ptr[p], 0, FRAME_SIZE * sizeof(int16_t));
+    mlir_aie_sync_mem_dev(out[p]);
+  }
+  mlir_aie_external_set_addr_frame_in_ping(_xaie, (u64)in_ptr[0]);
+  mlir_aie_external_set_addr_frame_in_pong(_xaie, (u64)in_ptr[1]);
+  mlir_aie_external_set_addr_frame_out_ping(_xaie, (u64)out_ptr[0]);
+  mlir_aie_external_set_addr_frame_out_pong(_xaie, (u64)out_ptr[1]);
+  mlir_aie_configure_shimdma_70(_xaie);
+
+  int errors = 0;
+  DataflowProfile profile(_xaie, clockMHz);
+  profile.addCore(7, 3, "dequant");
+  profile.addCore(7, 4, "idct_horizontal");
+  profile.addCore(7, 5, "idct_vertical");
+
+  // The first two frames fill both input buffers before the cores start.
+  for (int p = 0; p < 2; p++) {
+    fill(in_ptr[p], image, p);
+    send(_xaie, p, in[p]);
+  }
+  profile.start();
+  mlir_aie_start_cores(_xaie);
+
+  // Frame f is in the buffers f % 2: read its output, give the output
+  // buffer back to the shim DMA, and refill its input buffer with frame
+  // f + 2, while the DMAs and the cores stream frame f + 1.
+  int16_t first[FRAME_SIZE];
+  int frames = 0;
+  for (int f = 0; f < FRAMES; f++) {
+    int p = f % 2;
+    int acquired = p ? mlir_aie_acquire_of_out_cons_lock_1(_xaie, 1, TIMEOUT)
+                     : mlir_aie_acquire_of_out_cons_lock_0(_xaie, 1, TIMEOUT);
+    if (acquired != XAIE_OK) {
+      printf("ERROR: timeout hit on frame %d\n", f);
+      errors++;
+      break;
+    }
+    mlir_aie_sync_mem_cpu(out[p]);
+    if (f == 0)
+      memcpy(first, out_ptr[p], sizeof(first));
+    for (int b = 0; b < BLOCKS; b++)
+      if (memcmp(out_ptr[p] + b * BLOCK_SIZE,
+                 first + (b + f) % BLOCKS * BLOCK_SIZE,
+                 BLOCK_SIZE * sizeof(int16_t))) {
+        if (errors < 10)
+          printf("frame %d: block %d differs from block %d of frame 0\n", f,
+                 b, (b + f) % BLOCKS);
+        errors++;
+      }
+    if (p)
+      mlir_aie_release_of_out_cons_lock_1(_xaie, 0, 0);
+    else
+      mlir_aie_release_of_out_cons_lock_0(_xaie, 0, 0);
+    frames++;
+
+    if (f + 2 >= FRAMES)
+      continue;
+    acquired = p ? mlir_aie_acquire_of_in_lock_1(_xaie, 0, TIMEOUT)
+                 : mlir_aie_acquire_of_in_lock_0(_xaie, 0, TIMEOUT);
+    if (acquired != XAIE_OK) {
+      printf("ERROR: input buffer %d not sent for frame %d\n", p, f);
+      errors++;
+      break;
+    }
+    fill(in_ptr[p], image, f + 2);
+    send(_xaie, p, in[p]);
+  }
+  profile.stop();
+
+  double time = profile.seconds();
+  double bytes = 2.0 * frames * FRAME_SIZE * sizeof(int16_t);
+  profile.report(stdout, "idct_streaming", 0, bytes);
+  profile.writeJSON(stdout, "idct_streaming", 0, bytes);
+  printf("%d frames in %.3f ms: %.1f frames/s\n", frames, time * 1e3,
+         time ? frames / time : 0);
+
+  int res = 0;
+  if (!errors && frames == FRAMES) {
+    printf("PASS!\n");
+    res = 0;
+  } else {
+    printf("Fail!\n");
+    res = -1;
+  }
+
+  for (int p = 0; p < 2; p++) {
+    mlir_aie_mem_free(_xaie, in[p]);
+    mlir_aie_mem_free(_xaie, out[p]);
+  }
+  mlir_aie_deinit_libxaie(_xaie);
+  printf("test done.\n");
+  return res;
+}
@@ -137,6 +137,15 @@ int main(int argc, char *argv[]) {
   mlir_aie_release_buffer_in_lock(_xaie, 1, 0);
   mlir_aie_release_buffer_out_lock(_xaie, 1, 0);
 
+  // The stages of the pipeline, timed by their cores because the test
+  // sleeps while they run.
+  DataflowProfile profile(_xaie);
+  profile.addCore(7, 3, "dequant");
+  profile.addCore(7, 4, "idct_horizontal");
+  profile.addCore(7, 5, "idct_vertical");
+  profile.timeByCores();
+  profile.start();
+
   printf("Start cores\n");
   mlir_aie_start_cores(_xaie);
 
@@ -220,6 +229,9 @@ int main(int argc, char *argv[]) {
 
   mlir_aie_acquire_buffer_out_lock(_xaie, 0, 0);
   mlir_aie_sync_mem_cpu(_xaie, 1); // only used in libaiev2
+  profile.stop();
+  profile.report(stdout, "idct", 0, 2 * DMA_COUNT * sizeof(int16_t));
+  profile.writeJSON(stdout, "idct", 0, 2 * DMA_COUNT * sizeof(int16_t));
 
   for (int i = 0; i < DMA_COUNT; i++)
     mlir_aie_check("DDR out", ddr_ptr_out[i], image[i], errors);
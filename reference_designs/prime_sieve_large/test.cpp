@@ -34,6 +34,13 @@ int main(int argc, char *argv[]) {
   mlir_aie_configure_switchboxes(_xaie);
   mlir_aie_initialize_locks(_xaie);
   mlir_aie_configure_dmas(_xaie);
+
+  // Each core of the 50 columns of 8 rows is a stage of the sieve.
+  DataflowProfile profile(_xaie);
+  for (int col = 0; col < 50; col++)
+    for (int row = 1; row <= 8; row++)
+      profile.addCore(col, row);
+  profile.start();
   mlir_aie_start_cores(_xaie);
 
   int errors = 0;
@@ -42,6 +49,9 @@ int main(int argc, char *argv[]) {
   if (mlir_aie_acquire_prime_output_lock(_xaie, 1, 100000) != XAIE_OK) {
     printf("ERROR: timeout hit!\n");
   }
+  profile.stop();
+  profile.report(stdout, "prime_sieve", 0, 0);
+  profile.writeJSON(stdout, "prime_sieve", 0, 0);
 
   int count = mlir_aie_read_buffer_prime_output(_xaie, 0);
   printf("Found %d primes\n", count);
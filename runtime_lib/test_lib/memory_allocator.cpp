@@ -12,7 +12,13 @@
 #include "memory_allocator.h"
 #include "xioutils.h"
 #include <assert.h>
+#include <atomic>
 #include <iostream>
+#include <sys/mman.h>
+
+// The next free DDR physical address of the simulation, 128-bit aligned. The
+// simulated DDR is shared by all the contexts of the host.
+static std::atomic<uint64_t> nextAlignedAddr(0);
 
 int *mlir_aie_mem_alloc(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle,
                         int size) {
@@ -20,18 +26,15 @@ int *mlir_aie_mem_alloc(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle,
   handle.virtualAddr = std::malloc(size_bytes);
   if (handle.virtualAddr) {
     handle.size = size_bytes;
-    // assign physical space in SystemC DDR memory controller
-    handle.physicalAddr = nextAlignedAddr;
-    // adjust nextAlignedAddr to the next 128-bit aligned address
-    nextAlignedAddr = nextAlignedAddr + size_bytes;
-    uint64_t gapToAligned = nextAlignedAddr % 16; // 16byte (128bit)
-    if (gapToAligned > 0)
-      nextAlignedAddr += (16 - gapToAligned);
+    // assign physical space in SystemC DDR memory controller, up to the next
+    // 16byte (128bit) aligned address
+    handle.physicalAddr = nextAlignedAddr.fetch_add((size_bytes + 15) & ~15);
   } else {
     printf("ExtMemModel: Failed to allocate %d memory.\n", size_bytes);
   }
 
-  _xaie->allocations.push_back(handle);
+  std::lock_guard<std::recursive_mutex> guard(_xaie->mutex);
+  _xaie->allocations[(uintptr_t)handle.virtualAddr] = handle;
 
   std::cout << "ExtMemModel constructor: " << _xaie << " virtual address "
             << std::hex << handle.virtualAddr << ", physical address "
@@ -40,6 +43,58 @@ int *mlir_aie_mem_alloc(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle,
   return (int *)handle.virtualAddr;
 }
 
+// The host buffers of the simulation are always cached, and kept apart from
+// the simulated memory.
+int *mlir_aie_mem_alloc_cached(aie_libxaie_ctx_t *_xaie,
+                               ext_mem_model_t &handle, int size) {
+  return mlir_aie_mem_alloc(_xaie, handle, size);
+}
+
+void mlir_aie_mem_free(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle) {
+  std::unique_lock<std::recursive_mutex> guard(_xaie->mutex);
+  _xaie->allocations.erase((uintptr_t)handle.virtualAddr);
+  guard.unlock();
+  std::free(handle.virtualAddr);
+  handle.virtualAddr = nullptr;
+  handle.size = 0;
+}
+
+// The simulator cannot share host memory: the imported dma-bufs are mirrored
+// in the simulated DDR, as the allocations are, and synced by copies.
+int *mlir_aie_mem_import_dmabuf(aie_libxaie_ctx_t *_xaie,
+                                ext_mem_model_t &handle, int fd, size_t size,
+                                bool cacheable) {
+  void *VAddr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (VAddr == MAP_FAILED) {
+    printf("ExtMemModel: Failed to mmap dmabuf.\n");
+    return nullptr;
+  }
+  handle.virtualAddr = VAddr;
+  handle.size = size;
+  handle.fd = fd;
+  handle.cacheable = cacheable;
+  handle.physicalAddr = nextAlignedAddr.fetch_add((size + 15) & ~15);
+  std::lock_guard<std::recursive_mutex> guard(_xaie->mutex);
+  _xaie->allocations[(uintptr_t)handle.virtualAddr] = handle;
+  return (int *)VAddr;
+}
+
+int *mlir_aie_mem_import_physical(aie_libxaie_ctx_t *_xaie,
+                                  ext_mem_model_t &handle, u64 physicalAddr,
+                                  size_t size) {
+  printf("ExtMemModel: Physical memory cannot be imported in simulation.\n");
+  return nullptr;
+}
+
+void mlir_aie_mem_unimport(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle) {
+  std::unique_lock<std::recursive_mutex> guard(_xaie->mutex);
+  _xaie->allocations.erase((uintptr_t)handle.virtualAddr);
+  guard.unlock();
+  munmap(handle.virtualAddr, handle.size);
+  handle.virtualAddr = nullptr;
+  handle.size = 0;
+}
+
 void mlir_aie_sync_mem_cpu(ext_mem_model_t &handle) {
   aiesim_ReadGM(handle.physicalAddr, handle.virtualAddr, handle.size);
 }
@@ -48,18 +103,29 @@ void mlir_aie_sync_mem_dev(ext_mem_model_t &handle) {
   aiesim_WriteGM(handle.physicalAddr, handle.virtualAddr, handle.size);
 }
 
-u64 mlir_aie_get_device_address(aie_libxaie_ctx_t *_xaie, void *VA) {
-  std::cout << "get_device_address: " << _xaie << " VA " << std::hex << VA
-            << std::dec << "\n";
-  for (auto i : _xaie->allocations) {
-    std::cout << "get_device_address: virtual address " << std::hex
-              << i.virtualAddr << ", physical address " << i.physicalAddr
-              << ", size " << std::dec << i.size << std::endl;
+void mlir_aie_sync_mem_cpu_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length) {
+  aiesim_ReadGM(handle.physicalAddr + offset,
+                (char *)handle.virtualAddr + offset, length);
+}
 
-    if (i.virtualAddr == VA)
-      return i.physicalAddr;
+void mlir_aie_sync_mem_dev_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length) {
+  aiesim_WriteGM(handle.physicalAddr + offset,
+                 (char *)handle.virtualAddr + offset, length);
+}
+
+u64 mlir_aie_get_device_address(aie_libxaie_ctx_t *_xaie, void *VA) {
+  // The allocation holding VA is the last one starting at or before it.
+  std::lock_guard<std::recursive_mutex> guard(_xaie->mutex);
+  auto i = _xaie->allocations.upper_bound((uintptr_t)VA);
+  if (i != _xaie->allocations.begin()) {
+    --i;
+    uintptr_t offset = (uintptr_t)VA - i->first;
+    if (offset < i->second.size)
+      return i->second.physicalAddr + offset;
   }
   printf("ERROR: cannot get device address for allocation!\n");
   assert(false);
   return 0;
-}
\ No newline at end of file
+}
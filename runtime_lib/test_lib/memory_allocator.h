@@ -37,9 +37,6 @@ extern "C" {
 /// combinations are also possible, largely representing different tradeoffs
 /// between efficiency of host data access vs. efficiency of accelerator access.
 
-// static variable for tracking current DDR physical addr during AIESIM
-static uint16_t nextAlignedAddr;
-
 /// @brief Allocate a buffer in device memory
 /// @param bufIdx The index of the buffer to allocate.
 /// @param size The number of 32-bit words to allocate
@@ -48,6 +45,41 @@ static uint16_t nextAlignedAddr;
 int *mlir_aie_mem_alloc(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle,
                         int size);
 
+/// @brief Allocate a buffer in device memory which the host accesses through
+/// its caches. The host must then synchronize the buffer, or the ranges of it
+/// the device accesses, around each access of the device.
+/// @param size The number of 32-bit words to allocate
+/// @return A host-side pointer that can write into the given buffer.
+int *mlir_aie_mem_alloc_cached(aie_libxaie_ctx_t *_xaie,
+                               ext_mem_model_t &handle, int size);
+
+/// @brief Release a buffer allocated by mlir_aie_mem_alloc.
+/// @param handle The handle filled by mlir_aie_mem_alloc.
+void mlir_aie_mem_free(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle);
+
+/// @brief Use an existing dma-buf as a buffer of the device, without copying
+/// it, e.g. to stream the frames of a camera or the packets of a NIC
+/// through the shim DMAs. The caller keeps the file descriptor open while
+/// the buffer is in use.
+/// @param fd The file descriptor of the dma-buf
+/// @param size The size of the dma-buf in bytes
+/// @param cacheable Whether the host accesses it through its caches
+/// @return A host-side pointer to the buffer, or NULL on failure.
+int *mlir_aie_mem_import_dmabuf(aie_libxaie_ctx_t *_xaie,
+                                ext_mem_model_t &handle, int fd, size_t size,
+                                bool cacheable);
+
+/// @brief Use a range of physical memory as a buffer of the device, without
+/// copying it. The host accesses it uncached.
+/// @return A host-side pointer to the buffer, or NULL on failure.
+int *mlir_aie_mem_import_physical(aie_libxaie_ctx_t *_xaie,
+                                  ext_mem_model_t &handle, u64 physicalAddr,
+                                  size_t size);
+
+/// @brief Stop using a buffer imported by mlir_aie_mem_import_dmabuf or
+/// mlir_aie_mem_import_physical.
+void mlir_aie_mem_unimport(aie_libxaie_ctx_t *_xaie, ext_mem_model_t &handle);
+
 /// @brief Synchronize the buffer from the device to the host CPU.
 /// This is expected to be called after the device writes data into
 /// device memory, so that the data can be read by the CPU.  In
@@ -64,6 +96,16 @@ void mlir_aie_sync_mem_cpu(ext_mem_model_t &handle);
 /// @param bufIdx The buffer index.
 void mlir_aie_sync_mem_dev(ext_mem_model_t &handle);
 
+/// @brief Synchronize length bytes of the buffer, from offset, from the device
+/// to the host CPU, like mlir_aie_sync_mem_cpu.
+void mlir_aie_sync_mem_cpu_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length);
+
+/// @brief Synchronize length bytes of the buffer, from offset, from the host
+/// CPU to the device, like mlir_aie_sync_mem_dev.
+void mlir_aie_sync_mem_dev_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length);
+
 /// @brief Return a device address corresponding to the given host address.
 /// @param host_address A host-side pointer returned from mlir_aie_mem_alloc
 u64 mlir_aie_get_device_address(aie_libxaie_ctx_t *_xaie, void *host_address);
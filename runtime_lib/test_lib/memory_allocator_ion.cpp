@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <map>
 #include <linux/dma-buf.h>
 #include <pthread.h>
 #include <stdint.h>
@@ -32,25 +33,37 @@
 #include "memory_allocator.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIE_128BIT_ALIGN_MASK 0xFF
+#define XAIE_128BIT_ALIGN_MASK 0xF
 
+// The default size of the regions of device memory reserved from ION, which
+// the buffers are carved from. The MLIR_AIE_ION_REGION_SIZE environment
+// variable overrides it.
+#define MLIR_AIE_ION_REGION_SIZE (64 << 20)
+
+/*****************************************************************************/
 /**
- * This is the memory function to allocate a memory
  *
- * @param	handle: Device Instance
- * @param	size: Size of the memory
+ * This is the function to reserve a region of contiguous memory from ION and
+ * attach it to the device.
+ *
+ * @param	ctx: libXAIE context
+ * @param	size: Size of the region in bytes
+ * @param	Cacheable: Whether the host caches the region
+ *
+ * @return	Pointer to the region, NULL on failure.
+ *
+ * @note		Internal only.
  *
- * @return	Pointer to the allocated memory instance.
  *******************************************************************************/
-int *mlir_aie_mem_alloc(struct aie_libxaie_ctx_t *ctx, ext_mem_model_t &handle,
-                        int size) {
-  int RC;
+static ext_mem_region_t *mlir_aie_reserve_region(struct aie_libxaie_ctx_t *ctx,
+                                                 size_t size, bool Cacheable) {
   int Fd, Ret;
   uint32_t HeapNum;
   void *VAddr;
   struct ion_allocation_data AllocArgs;
   struct ion_heap_query Query;
   struct ion_heap_data *Heaps;
+  ext_mem_region_t Region;
   u64 DevAddr = 0;
 
   Fd = open("/dev/ion", O_RDONLY);
@@ -100,45 +113,338 @@ int *mlir_aie_mem_alloc(struct aie_libxaie_ctx_t *ctx, ext_mem_model_t &handle,
   AllocArgs.len = size;
   AllocArgs.heap_id_mask = 1 << Heaps[HeapNum].heap_id;
   free(Heaps);
-  // if(Cache == XAIE_MEM_CACHEABLE) {
-  // 	AllocArgs.flags = ION_FLAG_CACHED;
-  // }
+  if (Cacheable)
+    AllocArgs.flags = ION_FLAG_CACHED;
 
   Ret = ioctl(Fd, ION_IOC_ALLOC, &AllocArgs);
   if (Ret != 0) {
-    XAIE_ERROR("Failed to allocate memory of %lu bytes\n");
+    XAIE_ERROR("Failed to allocate memory of %zu bytes\n", size);
     goto error_ion;
   }
 
   VAddr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, AllocArgs.fd, 0);
-  if (VAddr == NULL) {
+  if (VAddr == MAP_FAILED) {
     XAIE_ERROR("Failed to mmap\n");
     goto error_alloc_fd;
   }
 
-  handle.fd = AllocArgs.fd;
-  handle.virtualAddr = VAddr;
-  handle.size = size;
+  Region.virtualAddr = VAddr;
+  Region.size = size;
+  Region.fd = AllocArgs.fd;
+  Region.cacheable = Cacheable;
 
   // Map the memory
-  if (XAie_MemAttach(&(ctx->DevInst), &(handle.MemInst), DevAddr, (u64)VAddr,
-                     size, XAIE_MEM_NONCACHEABLE, handle.fd) != XAIE_OK) {
+  if (XAie_MemAttach(&(ctx->DevInst), &(Region.MemInst), DevAddr, (u64)VAddr,
+                     size,
+                     Cacheable ? XAIE_MEM_CACHEABLE : XAIE_MEM_NONCACHEABLE,
+                     Region.fd) != XAIE_OK) {
     XAIE_ERROR("dmabuf map failed\n");
     goto error_map;
   }
 
   close(Fd);
-  return (int *)VAddr;
+  Region.freeByOffset[0] = size;
+  Region.freeBySize.insert({size, 0});
+  return &(ctx->regions[(uintptr_t)VAddr] = Region);
 
 error_map:
   munmap(VAddr, size);
 error_alloc_fd:
-  close(handle.fd);
+  close(AllocArgs.fd);
 error_ion:
   close(Fd);
   return NULL;
 }
 
+/*****************************************************************************/
+/**
+ *
+ * This is the function to carve a range of memory from the free ranges of a
+ * region, taking the smallest free range large enough.
+ *
+ * @param	Region: Region to allocate from
+ * @param	size: Size of the range, a multiple of 128 bits
+ * @param	Offset: Offset of the range in the region
+ *
+ * @return	true on success, false if no free range is large enough.
+ *
+ * @note		Internal only.
+ *
+ *******************************************************************************/
+static bool mlir_aie_carve_range(ext_mem_region_t &Region, size_t size,
+                                 size_t &Offset) {
+  auto Free = Region.freeBySize.lower_bound(size);
+  if (Free == Region.freeBySize.end())
+    return false;
+  size_t FreeSize = Free->first;
+  Offset = Free->second;
+  Region.freeBySize.erase(Free);
+  Region.freeByOffset.erase(Offset);
+  if (FreeSize > size) {
+    Region.freeByOffset[Offset + size] = FreeSize - size;
+    Region.freeBySize.insert({FreeSize - size, Offset + size});
+  }
+  return true;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the function to remove a free range from the free ranges of a
+ * region.
+ *
+ * @note		Internal only.
+ *
+ *******************************************************************************/
+static void
+mlir_aie_remove_free_range(ext_mem_region_t &Region,
+                           std::map<size_t, size_t>::iterator Free) {
+  auto BySize = Region.freeBySize.equal_range(Free->second);
+  for (auto It = BySize.first; It != BySize.second; ++It)
+    if (It->second == Free->first) {
+      Region.freeBySize.erase(It);
+      break;
+    }
+  Region.freeByOffset.erase(Free);
+}
+
+/**
+ * This is the memory function to allocate a memory
+ *
+ * The buffers are carved from regions of contiguous memory reserved from ION
+ * and attached to the device once, so that most allocations need no system
+ * call. The regions are never released. Cacheable and non-cacheable buffers
+ * come from different regions.
+ *
+ * @param	handle: Device Instance
+ * @param	size: Size of the memory
+ * @param	Cacheable: Whether the host caches the memory
+ *
+ * @return	Pointer to the allocated memory instance.
+ *
+ * @note		Internal only.
+ *
+ *******************************************************************************/
+static int *mlir_aie_mem_alloc_mode(struct aie_libxaie_ctx_t *ctx,
+                                    ext_mem_model_t &handle, int size,
+                                    bool Cacheable) {
+  size_t AlignedSize =
+      ((size_t)size + XAIE_128BIT_ALIGN_MASK) & ~(size_t)XAIE_128BIT_ALIGN_MASK;
+  ext_mem_region_t *Region = NULL;
+  size_t Offset = 0;
+  std::lock_guard<std::recursive_mutex> Guard(ctx->mutex);
+
+  for (auto &R : ctx->regions)
+    if (R.second.cacheable == Cacheable &&
+        mlir_aie_carve_range(R.second, AlignedSize, Offset)) {
+      Region = &R.second;
+      break;
+    }
+
+  if (Region == NULL) {
+    size_t RegionSize = MLIR_AIE_ION_REGION_SIZE;
+    if (const char *Env = getenv("MLIR_AIE_ION_REGION_SIZE"))
+      RegionSize = strtoull(Env, NULL, 0);
+    if (RegionSize < AlignedSize)
+      RegionSize = AlignedSize;
+    Region = mlir_aie_reserve_region(ctx, RegionSize, Cacheable);
+    if (Region == NULL || !mlir_aie_carve_range(*Region, AlignedSize, Offset))
+      return NULL;
+  }
+
+  void *VAddr = (char *)Region->virtualAddr + Offset;
+  handle.fd = Region->fd;
+  handle.virtualAddr = VAddr;
+  handle.physicalAddr = (u64)VAddr;
+  handle.size = AlignedSize;
+  handle.MemInst = Region->MemInst;
+  handle.cacheable = Cacheable;
+  return (int *)VAddr;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to allocate a non-cacheable memory
+ *
+ * @param	handle: Device Instance
+ * @param	size: Size of the memory
+ *
+ * @return	Pointer to the allocated memory instance.
+ *
+ *******************************************************************************/
+int *mlir_aie_mem_alloc(struct aie_libxaie_ctx_t *ctx, ext_mem_model_t &handle,
+                        int size) {
+  return mlir_aie_mem_alloc_mode(ctx, handle, size, false);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to allocate a cacheable memory
+ *
+ * @param	handle: Device Instance
+ * @param	size: Size of the memory
+ *
+ * @return	Pointer to the allocated memory instance.
+ *
+ *******************************************************************************/
+int *mlir_aie_mem_alloc_cached(struct aie_libxaie_ctx_t *ctx,
+                               ext_mem_model_t &handle, int size) {
+  return mlir_aie_mem_alloc_mode(ctx, handle, size, true);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to free a memory allocated by
+ * mlir_aie_mem_alloc, returning its range to the free ranges of its region.
+ *
+ * @param	handle: Handle filled by mlir_aie_mem_alloc
+ *
+ *******************************************************************************/
+void mlir_aie_mem_free(struct aie_libxaie_ctx_t *ctx, ext_mem_model_t &handle) {
+  std::lock_guard<std::recursive_mutex> Guard(ctx->mutex);
+  auto R = ctx->regions.upper_bound((uintptr_t)handle.virtualAddr);
+  if (R == ctx->regions.begin()) {
+    XAIE_ERROR("Failed to find the region of %p\n", handle.virtualAddr);
+    return;
+  }
+  ext_mem_region_t &Region = (--R)->second;
+  size_t Offset = (uintptr_t)handle.virtualAddr - R->first;
+  size_t Size = handle.size;
+  if (Offset + Size > Region.size) {
+    XAIE_ERROR("Failed to find the region of %p\n", handle.virtualAddr);
+    return;
+  }
+
+  // Merge the range with the free ranges right after and right before it.
+  auto Next = Region.freeByOffset.lower_bound(Offset);
+  if (Next != Region.freeByOffset.end() && Next->first == Offset + Size) {
+    Size += Next->second;
+    mlir_aie_remove_free_range(Region, Next);
+  }
+  auto Prev = Region.freeByOffset.lower_bound(Offset);
+  if (Prev != Region.freeByOffset.begin() &&
+      (--Prev)->first + Prev->second == Offset) {
+    Offset = Prev->first;
+    Size += Prev->second;
+    mlir_aie_remove_free_range(Region, Prev);
+  }
+  Region.freeByOffset[Offset] = Size;
+  Region.freeBySize.insert({Size, Offset});
+  handle.virtualAddr = NULL;
+  handle.size = 0;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to use an existing dma-buf, e.g. exported by a
+ * camera, a NIC or a PL accelerator, as a buffer of the device, without
+ * copying it. The dma-buf is mapped and attached to the device, the caller
+ * keeps its file descriptor.
+ *
+ * @param	handle: Handle to fill
+ * @param	fd: File descriptor of the dma-buf
+ * @param	size: Size of the dma-buf in bytes
+ * @param	Cacheable: Whether the host caches the memory
+ *
+ * @return	Pointer to the mapped memory, NULL on failure.
+ *
+ *******************************************************************************/
+int *mlir_aie_mem_import_dmabuf(struct aie_libxaie_ctx_t *ctx,
+                                ext_mem_model_t &handle, int fd, size_t size,
+                                bool Cacheable) {
+  void *VAddr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (VAddr == MAP_FAILED) {
+    XAIE_ERROR("Failed to mmap dmabuf\n");
+    return NULL;
+  }
+
+  std::lock_guard<std::recursive_mutex> Guard(ctx->mutex);
+  if (XAie_MemAttach(&(ctx->DevInst), &(handle.MemInst), 0, (u64)VAddr, size,
+                     Cacheable ? XAIE_MEM_CACHEABLE : XAIE_MEM_NONCACHEABLE,
+                     fd) != XAIE_OK) {
+    XAIE_ERROR("dmabuf map failed\n");
+    munmap(VAddr, size);
+    return NULL;
+  }
+
+  handle.fd = fd;
+  handle.virtualAddr = VAddr;
+  handle.physicalAddr = (u64)VAddr;
+  handle.size = size;
+  handle.cacheable = Cacheable;
+  ctx->allocations[(uintptr_t)VAddr] = handle;
+  return (int *)VAddr;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to use a range of physical memory, e.g. the
+ * reserved memory of a PL accelerator, as a buffer of the device, without
+ * copying it. The range is mapped uncached, and the shim DMAs access it at
+ * its physical address.
+ *
+ * @param	handle: Handle to fill
+ * @param	PhysAddr: Physical address of the range
+ * @param	size: Size of the range in bytes
+ *
+ * @return	Pointer to the mapped memory, NULL on failure.
+ *
+ *******************************************************************************/
+int *mlir_aie_mem_import_physical(struct aie_libxaie_ctx_t *ctx,
+                                  ext_mem_model_t &handle, u64 PhysAddr,
+                                  size_t size) {
+  int Fd = open("/dev/mem", O_RDWR | O_SYNC);
+  if (Fd < 0) {
+    XAIE_ERROR("Failed to open /dev/mem.\n");
+    return NULL;
+  }
+  void *VAddr =
+      mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, PhysAddr);
+  close(Fd);
+  if (VAddr == MAP_FAILED) {
+    XAIE_ERROR("Failed to mmap 0x%llx\n", (unsigned long long)PhysAddr);
+    return NULL;
+  }
+
+  handle.fd = -1;
+  handle.virtualAddr = VAddr;
+  handle.physicalAddr = PhysAddr;
+  handle.size = size;
+  handle.cacheable = false;
+  std::lock_guard<std::recursive_mutex> Guard(ctx->mutex);
+  ctx->allocations[(uintptr_t)VAddr] = handle;
+  return (int *)VAddr;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This is the memory function to stop using a memory imported by
+ * mlir_aie_mem_import_dmabuf or mlir_aie_mem_import_physical. The dma-buf
+ * is detached from the device, but stays open.
+ *
+ * @param	handle: Handle filled by the import
+ *
+ *******************************************************************************/
+void mlir_aie_mem_unimport(struct aie_libxaie_ctx_t *ctx,
+                           ext_mem_model_t &handle) {
+  std::lock_guard<std::recursive_mutex> Guard(ctx->mutex);
+  if (!ctx->allocations.erase((uintptr_t)handle.virtualAddr)) {
+    XAIE_ERROR("%p was not imported\n", handle.virtualAddr);
+    return;
+  }
+  if (handle.fd >= 0)
+    XAie_MemDetach(&(handle.MemInst));
+  munmap(handle.virtualAddr, handle.size);
+  handle.virtualAddr = NULL;
+  handle.size = 0;
+}
+
 /*****************************************************************************/
 /**
  *
@@ -214,6 +520,13 @@ void mlir_aie_sync_mem_cpu(ext_mem_model_t &handle) {
   struct dma_buf_sync Sync;
   int Ret;
 
+  // Physical ranges are mapped uncached, only the order of the accesses
+  // matters.
+  if (handle.fd < 0) {
+    __sync_synchronize();
+    return;
+  }
+
   memset(&Sync, 0, sizeof(Sync));
   Sync.flags = DMA_BUF_SYNC_RW | DMA_BUF_SYNC_START;
   Ret = ioctl(handle.fd, DMA_BUF_IOCTL_SYNC, &Sync);
@@ -241,6 +554,13 @@ void mlir_aie_sync_mem_dev(ext_mem_model_t &handle) {
   struct dma_buf_sync Sync;
   int Ret;
 
+  // Physical ranges are mapped uncached, only the order of the accesses
+  // matters.
+  if (handle.fd < 0) {
+    __sync_synchronize();
+    return;
+  }
+
   memset(&Sync, 0, sizeof(Sync));
   Sync.flags = DMA_BUF_SYNC_RW | DMA_BUF_SYNC_END;
   Ret = ioctl(handle.fd, DMA_BUF_IOCTL_SYNC, &Sync);
@@ -253,7 +573,83 @@ void mlir_aie_sync_mem_dev(ext_mem_model_t &handle) {
   //	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+ *
+ * This is the function to clean and invalidate the data cache lines holding
+ * a range of memory, so that the device sees what the host wrote and the
+ * host reads what the device wrote.
+ *
+ * @param	VAddr: Start of the range
+ * @param	length: Length of the range in bytes
+ *
+ * @return	true on success, false if the host cannot flush its caches from
+ *		user space.
+ *
+ * @note		Internal only.
+ *
+ *******************************************************************************/
+static bool mlir_aie_flush_cache_range(void *VAddr, size_t length) {
+#if defined(__aarch64__)
+  uint64_t Ctr;
+  asm volatile("mrs %0, ctr_el0" : "=r"(Ctr));
+  // CTR_EL0.DminLine is the log2 of the number of words of the smallest
+  // data cache line.
+  uintptr_t Line = 4 << ((Ctr >> 16) & 0xF);
+  uintptr_t Addr = (uintptr_t)VAddr & ~(Line - 1);
+  uintptr_t End = (uintptr_t)VAddr + length;
+  for (; Addr < End; Addr += Line)
+    asm volatile("dc civac, %0" : : "r"(Addr) : "memory");
+  asm volatile("dsb sy" : : : "memory");
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ *
+ * These are the memory functions to sync a range of the memory for CPU and
+ * for Device. Only the cache lines of the range of cacheable memories are
+ * maintained, where the host can do it from user space. Otherwise the whole
+ * memory is synced.
+ *
+ * @param	handle: Memory handle
+ * @param	offset: Offset of the range in bytes
+ * @param	length: Length of the range in bytes
+ *
+ *******************************************************************************/
+void mlir_aie_sync_mem_cpu_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length) {
+  if (!handle.cacheable) {
+    __sync_synchronize();
+    return;
+  }
+  if (!mlir_aie_flush_cache_range((char *)handle.virtualAddr + offset, length))
+    mlir_aie_sync_mem_cpu(handle);
+}
+
+void mlir_aie_sync_mem_dev_range(ext_mem_model_t &handle, size_t offset,
+                                 size_t length) {
+  if (!handle.cacheable) {
+    __sync_synchronize();
+    return;
+  }
+  if (!mlir_aie_flush_cache_range((char *)handle.virtualAddr + offset, length))
+    mlir_aie_sync_mem_dev(handle);
+}
+
 u64 mlir_aie_get_device_address(struct aie_libxaie_ctx_t *_xaie, void *VA) {
+  // The imported physical ranges are accessed at their physical address.
+  std::lock_guard<std::recursive_mutex> Guard(_xaie->mutex);
+  auto I = _xaie->allocations.upper_bound((uintptr_t)VA);
+  if (I != _xaie->allocations.begin()) {
+    --I;
+    uintptr_t Offset = (uintptr_t)VA - I->first;
+    if (Offset < I->second.size)
+      return I->second.physicalAddr + Offset;
+  }
   return (u64)VA; // LibXAIE will take care of converting this for us.
 }
 
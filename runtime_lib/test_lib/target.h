@@ -12,6 +12,9 @@
 #define AIE_TARGET_H
 
 #include <list>
+#include <map>
+#include <mutex>
+#include <string>
 #include <xaiengine.h>
 
 struct ext_mem_model_t {
@@ -20,13 +23,46 @@ struct ext_mem_model_t {
   size_t size;
   int fd;               // The file descriptor used during allocation
   XAie_MemInst MemInst; // LibXAIE handle if necessary.  This should go away.
+  bool cacheable;       // Whether the host accesses it through its caches
 };
 
+// A contiguous region of device memory reserved at once, which device memory
+// allocators can carve buffers from.
+struct ext_mem_region_t {
+  void *virtualAddr;
+  size_t size;
+  int fd;
+  XAie_MemInst MemInst;
+  bool cacheable;
+  // The free ranges of the region, as offset to size and size to offset.
+  std::map<size_t, size_t> freeByOffset;
+  std::multimap<size_t, size_t> freeBySize;
+};
+
+// The events the interrupt controller of a shim tile forwards to the host.
+struct notify_column_t {
+  int nocCol;       // The column of the second-level interrupt controller
+  u32 channels = 0; // The broadcast channels of the events of the tiles
+  u8 irqEvents = 0; // The IRQ events of the shim tile used so far
+};
+
+// The state of a design, or of a partition running one. Each context is
+// independent of the others, and the host threads sharing a context take its
+// mutex around the uses of its device instance and allocations.
 struct aie_libxaie_ctx_t {
   XAie_Config AieConfigPtr;
   XAie_DevInst DevInst;
-  // Some device memory allocators need this to keep track of VA->PA mappings
-  std::list<ext_mem_model_t> allocations;
+  std::recursive_mutex mutex;
+  // The device addresses of the named external buffers of the design.
+  std::map<std::string, u64> externalAddrs;
+  // Some device memory allocators need this to keep track of VA->PA mappings,
+  // keyed by the virtual address of the allocations.
+  std::map<uintptr_t, ext_mem_model_t> allocations;
+  // Device memory allocators can reserve regions of memory, keyed by their
+  // virtual address, instead of allocating each buffer on its own.
+  std::map<uintptr_t, ext_mem_region_t> regions;
+  // The shim columns forwarding events of the tiles to the host.
+  std::map<int, notify_column_t> notifyColumns;
 };
 
 #endif
\ No newline at end of file
@@ -15,11 +15,21 @@
 /// complex.
 
 #include "test_library.h"
+#include "memory_allocator.h"
 #include "math.h"
+#include <algorithm>
 #include <assert.h>
+#include <elf.h>
 #include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <poll.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/mman.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
 
 // extern "C" {
 // extern aie_libxaie_ctx_t *ctx /* = nullptr*/;
@@ -28,6 +38,10 @@
 // namespace aie_device {
 //}
 
+// The lock of a context, taken around the uses of its device instance so that
+// many host threads can share it.
+using ctx_guard = std::lock_guard<std::recursive_mutex>;
+
 /// @brief  Release access to the libXAIE context.
 /// @param ctx The context
 void mlir_aie_deinit_libxaie(aie_libxaie_ctx_t *ctx) {
@@ -35,13 +49,15 @@ void mlir_aie_deinit_libxaie(aie_libxaie_ctx_t *ctx) {
   if (RC != XAIE_OK) {
     printf("Failed to finish tiles.\n");
   }
-  free(ctx);
+  delete ctx;
 }
 
-/// @brief Initialize the device represented by the context.
-/// @param ctx The context
-/// @return Zero on success
-int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
+/// Initialize the device instance of the context, over the whole device
+/// unless a partition was set up in it. Only the numTiles tiles are clocked
+/// if there are any, and otherwise all the tiles are.
+static int mlir_aie_init_dev_inst(aie_libxaie_ctx_t *ctx,
+                                  XAie_LocType *tiles = NULL,
+                                  u32 numTiles = 0) {
   AieRC RC = XAIE_OK;
 
   RC = XAie_CfgInitialize(&(ctx->DevInst), &(ctx->AieConfigPtr));
@@ -54,7 +70,7 @@ int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
   // FATAL::[ xtlm::907 ] b_transport_cb is not registered with the utils
   const XAie_Backend *Backend = ctx->DevInst.Backend;
   if (Backend->Type != XAIE_IO_BACKEND_SIM) {
-    RC = XAie_PmRequestTiles(&(ctx->DevInst), NULL, 0);
+    RC = XAie_PmRequestTiles(&(ctx->DevInst), tiles, numTiles);
     if (RC != XAIE_OK) {
       printf("Failed to request tiles.\n");
       return -1;
@@ -71,7 +87,7 @@ int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
       printf("Driver initialization failed.\n");
       return -1;
     }
-    RC = XAie_PmRequestTiles(&(ctx->DevInst), NULL, 0);
+    RC = XAie_PmRequestTiles(&(ctx->DevInst), tiles, numTiles);
     if (RC != XAIE_OK) {
       printf("Failed to request tiles.\n");
       return -1;
@@ -86,6 +102,51 @@ int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
   return 0;
 }
 
+/// @brief Initialize the device represented by the context.
+/// @param ctx The context
+/// @return Zero on success
+int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
+  ctx_guard guard(ctx->mutex);
+  return mlir_aie_init_dev_inst(ctx);
+}
+
+/// @brief Initialize the device represented by the context, clocking only
+/// the given tiles. The clocks of the other tiles, and of the columns without
+/// any of them, stay gated.
+/// @param ctx The context
+/// @param tiles The tiles to clock
+/// @param numTiles The number of tiles
+/// @return Zero on success
+int mlir_aie_init_device_tiles(aie_libxaie_ctx_t *ctx, XAie_LocType *tiles,
+                               u32 numTiles) {
+  ctx_guard guard(ctx->mutex);
+  return mlir_aie_init_dev_inst(ctx, tiles, numTiles);
+}
+
+/// @brief Initialize the context over a partition of the device, so that
+/// independent designs can run in disjoint partitions, each from its own
+/// context.
+/// @param ctx The context
+/// @param startCol The first column of the partition
+/// @param numCols The number of columns of the partition
+/// @return Zero on success
+int mlir_aie_init_device_partition(aie_libxaie_ctx_t *ctx, u32 startCol,
+                                   u32 numCols) {
+  ctx_guard guard(ctx->mutex);
+  if (XAie_SetupPartitionConfig(&(ctx->DevInst), 0, startCol, numCols) !=
+      XAIE_OK) {
+    printf("Failed to set up partition.\n");
+    return -1;
+  }
+  return mlir_aie_init_dev_inst(ctx);
+}
+
+static u64 mlir_aie_time_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
 /// @brief Acquire a physical lock
 /// @param ctx The context
 /// @param col The column of the lock
@@ -96,8 +157,23 @@ int mlir_aie_init_device(aie_libxaie_ctx_t *ctx) {
 /// @return Return non-zero on success, i.e. the operation did not timeout.
 int mlir_aie_acquire_lock(aie_libxaie_ctx_t *ctx, int col, int row, int lockid,
                           int lockval, int timeout) {
-  return (XAie_LockAcquire(&(ctx->DevInst), XAie_TileLoc(col, row),
-                           XAie_LockInit(lockid, lockval), timeout) == XAIE_OK);
+  // Try the lock once at a time, so that the other threads of the context
+  // can use it while this one waits.
+  u64 start = mlir_aie_time_us();
+  useconds_t backoff = 1;
+  while (true) {
+    {
+      ctx_guard guard(ctx->mutex);
+      if (XAie_LockAcquire(&(ctx->DevInst), XAie_TileLoc(col, row),
+                           XAie_LockInit(lockid, lockval), 0) == XAIE_OK)
+        return 1;
+    }
+    if (mlir_aie_time_us() - start >= (u64)timeout)
+      return 0;
+    usleep(backoff);
+    if (backoff < 64)
+      backoff *= 2;
+  }
 }
 
 /// @brief Release a physical lock
@@ -110,12 +186,195 @@ int mlir_aie_acquire_lock(aie_libxaie_ctx_t *ctx, int col, int row, int lockid,
 /// @return Return non-zero on success, i.e. the operation did not timeout.
 int mlir_aie_release_lock(aie_libxaie_ctx_t *ctx, int col, int row, int lockid,
                           int lockval, int timeout) {
+  ctx_guard guard(ctx->mutex);
   return (XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(col, row),
                            XAie_LockInit(lockid, lockval), timeout) == XAIE_OK);
 }
 
+mlir_aie_completion_queue_t *
+mlir_aie_create_completion_queue(aie_libxaie_ctx_t *ctx) {
+  mlir_aie_completion_queue_t *queue = new mlir_aie_completion_queue_t;
+  queue->ctx = ctx;
+  return queue;
+}
+
+void mlir_aie_destroy_completion_queue(mlir_aie_completion_queue_t *queue) {
+  delete queue;
+}
+
+void mlir_aie_queue_lock_acquire(mlir_aie_completion_queue_t *queue, int col,
+                                 int row, int lockid, int lockval, void *tag) {
+  queue->pending.push_back(
+      {mlir_aie_completion_t::Lock, col, row, lockid, lockval, tag});
+}
+
+void mlir_aie_queue_dma_done(mlir_aie_completion_queue_t *queue, int col,
+                             int row, XAie_DmaDirection dir, int channel,
+                             void *tag) {
+  queue->pending.push_back(
+      {mlir_aie_completion_t::Dma, col, row, channel, (int)dir, tag});
+}
+
+// The broadcast channel the first-level interrupt controllers of the shim
+// tiles send the events to the second-level ones on, and the NPI interrupt
+// the second-level ones raise, which the UIO device is bound to.
+#define MLIR_AIE_NOTIFY_L2_CHANNEL 1
+#define MLIR_AIE_NOTIFY_NPI_IRQ 1
+// The inputs of a first-level interrupt controller are the 16 broadcast
+// channels from the tile above, then its own IRQ events.
+#define MLIR_AIE_L1_IRQ_EVENT_INPUT 16
+#define MLIR_AIE_L1_IRQ_EVENTS 4
+
+int mlir_aie_notify_event(aie_libxaie_ctx_t *ctx, int col, int row,
+                          XAie_ModuleType module, XAie_Events event,
+                          u8 broadcastId, int nocCol) {
+  ctx_guard guard(ctx->mutex);
+  XAie_LocType shim = XAie_TileLoc(col, 0);
+  XAie_LocType noc = XAie_TileLoc(nocCol, 0);
+  notify_column_t &column = ctx->notifyColumns[col];
+  column.nocCol = nocCol;
+  AieRC rc;
+  if (row == 0) {
+    // The events of the shim tile itself are IRQ events of its controller.
+    if (column.irqEvents == MLIR_AIE_L1_IRQ_EVENTS) {
+      printf("The shim tile %d has no IRQ event left.\n", col);
+      return -1;
+    }
+    u8 irqEvent = column.irqEvents++;
+    rc = XAie_IntrCtrlL1Event(&(ctx->DevInst), shim, XAIE_EVENT_SWITCH_A,
+                              irqEvent, event);
+    if (rc == XAIE_OK)
+      rc = XAie_IntrCtrlL1Enable(&(ctx->DevInst), shim, XAIE_EVENT_SWITCH_A,
+                                 MLIR_AIE_L1_IRQ_EVENT_INPUT + irqEvent);
+  } else {
+    rc = XAie_EventBroadcast(&(ctx->DevInst), XAie_TileLoc(col, row), module,
+                             broadcastId, event);
+    if (rc == XAIE_OK)
+      rc = XAie_IntrCtrlL1Enable(&(ctx->DevInst), shim, XAIE_EVENT_SWITCH_A,
+                                 broadcastId);
+  }
+  if (rc == XAIE_OK)
+    rc = XAie_IntrCtrlL1IrqSet(&(ctx->DevInst), shim, XAIE_EVENT_SWITCH_A,
+                               MLIR_AIE_NOTIFY_L2_CHANNEL);
+  if (rc == XAIE_OK)
+    rc = XAie_IntrCtrlL2Enable(&(ctx->DevInst), noc,
+                               1u << MLIR_AIE_NOTIFY_L2_CHANNEL);
+  if (rc == XAIE_OK)
+    rc = XAie_IntrCtrlL2IrqSet(&(ctx->DevInst), noc, MLIR_AIE_NOTIFY_NPI_IRQ);
+  if (rc != XAIE_OK) {
+    printf("Failed to notify the host of the events of tile (%d, %d).\n", col,
+           row);
+    return -1;
+  }
+  if (row != 0)
+    column.channels |= 1u << broadcastId;
+  return 0;
+}
+
+int mlir_aie_open_notifications(aie_libxaie_ctx_t *ctx, const char *device) {
+  int fd = open(device, O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+    printf("Failed to open %s.\n", device);
+    return -1;
+  }
+  // Writing 1 to a UIO device enables its interrupt.
+  u32 enable = 1;
+  if (write(fd, &enable, sizeof(enable)) != sizeof(enable)) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int mlir_aie_wait_notifications(aie_libxaie_ctx_t *ctx, int fd, int timeout) {
+  struct pollfd pfd = {fd, POLLIN, 0};
+  int ready = poll(&pfd, 1, timeout < 0 ? -1 : (timeout + 999) / 1000);
+  if (ready <= 0)
+    return ready;
+  // The number of interrupts so far, which only the read clears.
+  u32 count;
+  if (read(fd, &count, sizeof(count)) != sizeof(count))
+    return -1;
+  {
+    ctx_guard guard(ctx->mutex);
+    for (auto &[col, column] : ctx->notifyColumns) {
+      u32 irqEvents = ((1u << column.irqEvents) - 1)
+                      << MLIR_AIE_L1_IRQ_EVENT_INPUT;
+      XAie_IntrCtrlL1Ack(&(ctx->DevInst), XAie_TileLoc(col, 0),
+                         XAIE_EVENT_SWITCH_A, column.channels | irqEvents);
+      XAie_IntrCtrlL2Ack(&(ctx->DevInst), XAie_TileLoc(column.nocCol, 0),
+                         1u << MLIR_AIE_NOTIFY_L2_CHANNEL);
+    }
+  }
+  u32 enable = 1;
+  if (write(fd, &enable, sizeof(enable)) != sizeof(enable))
+    return -1;
+  return 1;
+}
+
+void mlir_aie_queue_notifications(mlir_aie_completion_queue_t *queue,
+                                  int fd) {
+  queue->notifyFd = fd;
+}
+
+/// Return true if the condition completed, trying to acquire the lock once
+/// or reading the number of pending buffer descriptors of the DMA channel.
+static bool mlir_aie_poll_completion(aie_libxaie_ctx_t *ctx,
+                                     const mlir_aie_completion_t &c) {
+  ctx_guard guard(ctx->mutex);
+  XAie_LocType loc = XAie_TileLoc(c.col, c.row);
+  if (c.kind == mlir_aie_completion_t::Lock)
+    return XAie_LockAcquire(&(ctx->DevInst), loc, XAie_LockInit(c.id, c.value),
+                            0) == XAIE_OK;
+  u8 pendingBDs = 0;
+  if (XAie_DmaGetPendingBdCount(&(ctx->DevInst), loc, c.id,
+                                (XAie_DmaDirection)c.value,
+                                &pendingBDs) != XAIE_OK)
+    return false;
+  return pendingBDs == 0;
+}
+
+/// A single thread polls all the conditions of the queue in turn. Between
+/// the sweeps which complete nothing, it waits for the tiles to notify the
+/// host if the queue has notifications, and otherwise sleeps longer and
+/// longer. The events acknowledged were raised before the next sweep, which
+/// sees the conditions they completed.
+int mlir_aie_wait_completions(mlir_aie_completion_queue_t *queue, void **tags,
+                              int maxTags, int timeout) {
+  u64 start = mlir_aie_time_us();
+  useconds_t backoff = 1;
+  while (!queue->pending.empty()) {
+    int completed = 0;
+    auto &pending = queue->pending;
+    for (size_t i = 0; i < pending.size() && completed < maxTags;) {
+      if (mlir_aie_poll_completion(queue->ctx, pending[i])) {
+        tags[completed++] = pending[i].tag;
+        pending.erase(pending.begin() + i);
+      } else {
+        i++;
+      }
+    }
+    if (completed)
+      return completed;
+    u64 elapsed = mlir_aie_time_us() - start;
+    if (timeout >= 0 && elapsed >= (u64)timeout)
+      return 0;
+    if (queue->notifyFd < 0) {
+      usleep(backoff);
+      if (backoff < 64)
+        backoff *= 2;
+    } else if (mlir_aie_wait_notifications(
+                   queue->ctx, queue->notifyFd,
+                   timeout < 0 ? -1 : (int)(timeout - elapsed)) < 0) {
+      return 0;
+    }
+  }
+  return 0;
+}
+
 /// @brief Read the AIE configuration memory at the given physical address.
 u32 mlir_aie_read32(aie_libxaie_ctx_t *ctx, u64 addr) {
+  ctx_guard guard(ctx->mutex);
   u32 val;
   XAie_Read32(&(ctx->DevInst), addr, &val);
   return val;
@@ -125,14 +384,129 @@ u32 mlir_aie_read32(aie_libxaie_ctx_t *ctx, u64 addr) {
 /// It's almost always better to use some more indirect method of accessing
 /// configuration registers, but this is provided as a last resort.
 void mlir_aie_write32(aie_libxaie_ctx_t *ctx, u64 addr, u32 val) {
+  ctx_guard guard(ctx->mutex);
   XAie_Write32(&(ctx->DevInst), addr, val);
 }
 
+// The header word of a run-length encoded airbin record. It is followed by
+// a single word to repeat when AIRBIN_RLE_FILL is set, and otherwise by the
+// given count of literal words.
+#define AIRBIN_RLE_FILL 0x80000000u
+#define AIRBIN_RLE_COUNT_MASK 0x7FFFFFFFu
+
+/// @brief Write the data of an airbin section to the AIE configuration
+/// memory, decoding it when it is run-length encoded.
+/// @param addr The address of the section in the array.
+/// @param data The data of the section.
+/// @param words The number of words of data.
+/// @param encoded The section has the type SHT_AIRBIN_RLE.
+/// @return 0 on success, -1 if the encoded data is truncated.
+int mlir_aie_write_airbin_section(aie_libxaie_ctx_t *ctx, u64 addr,
+                                  const u32 *data, size_t words, bool encoded) {
+  ctx_guard guard(ctx->mutex);
+  if (!encoded) {
+    for (size_t i = 0; i < words; i++)
+      XAie_Write32(&(ctx->DevInst), addr + 4 * i, data[i]);
+    return 0;
+  }
+
+  size_t i = 0;
+  while (i < words) {
+    u32 header = data[i++];
+    u32 count = header & AIRBIN_RLE_COUNT_MASK;
+    if (header & AIRBIN_RLE_FILL) {
+      if (i == words)
+        return -1;
+      u32 value = data[i++];
+      for (u32 j = 0; j < count; j++, addr += 4)
+        XAie_Write32(&(ctx->DevInst), addr, value);
+    } else {
+      if (count > words - i)
+        return -1;
+      for (u32 j = 0; j < count; j++, addr += 4)
+        XAie_Write32(&(ctx->DevInst), addr, data[i++]);
+    }
+  }
+  return 0;
+}
+
+// The header and the record opcodes of the transaction buffers generated by
+// aie-translate --aie-generate-txn.
+#define TXN_MAGIC 0x4E585441u
+#define TXN_VERSION 1u
+#define TXN_OP_WRITE 0u
+#define TXN_OP_MASK_WRITE 1u
+#define TXN_OP_BLOCK_WRITE 2u
+
+/// @brief Move an address of the configuration of a design, whose tiles are
+/// numbered from column 0, to the columns starting at colOffset.
+/// @param addr The address in the array of a register or memory of a tile.
+/// @param colOffset The column of the array the design is loaded at.
+/// @return The address in the columns of the design.
+u64 mlir_aie_relocate_addr(aie_libxaie_ctx_t *ctx, u64 addr, int colOffset) {
+  return addr + ((u64)colOffset << ctx->AieConfigPtr.ColShift);
+}
+
+/// @brief Replay the writes of a transaction buffer, in order.
+/// @param txn The transaction buffer.
+/// @param words The number of words of the buffer.
+/// @return 0 on success, -1 if the buffer is not well formed.
+int mlir_aie_replay_txn(aie_libxaie_ctx_t *ctx, const u32 *txn, size_t words) {
+  return mlir_aie_replay_txn_at(ctx, txn, words, 0);
+}
+
+/// @brief Replay the writes of a transaction buffer, in order, moved to the
+/// columns starting at colOffset.
+/// @param txn The transaction buffer.
+/// @param words The number of words of the buffer.
+/// @param colOffset The column of the array the design is loaded at.
+/// @return 0 on success, -1 if the buffer is not well formed.
+int mlir_aie_replay_txn_at(aie_libxaie_ctx_t *ctx, const u32 *txn,
+                           size_t words, int colOffset) {
+  ctx_guard guard(ctx->mutex);
+  if (words < 4 || txn[0] != TXN_MAGIC || txn[1] != TXN_VERSION ||
+      txn[3] > words)
+    return -1;
+
+  size_t i = 4;
+  for (u32 record = 0; record < txn[2]; record++) {
+    if (words - i < 4)
+      return -1;
+    u32 op = txn[i];
+    u64 addr = mlir_aie_relocate_addr(
+        ctx, ((u64)txn[i + 2] << 32) | txn[i + 1], colOffset);
+    i += 3;
+    switch (op) {
+    case TXN_OP_WRITE:
+      XAie_Write32(&(ctx->DevInst), addr, txn[i++]);
+      break;
+    case TXN_OP_MASK_WRITE:
+      if (words - i < 2)
+        return -1;
+      XAie_MaskWrite32(&(ctx->DevInst), addr, txn[i], txn[i + 1]);
+      i += 2;
+      break;
+    case TXN_OP_BLOCK_WRITE: {
+      u32 count = txn[i++];
+      if (count > words - i)
+        return -1;
+      XAie_BlockWrite32(&(ctx->DevInst), addr, &txn[i], count);
+      i += count;
+      break;
+    }
+    default:
+      return -1;
+    }
+  }
+  return 0;
+}
+
 /// @brief Read a value from the data memory of a particular tile memory
 /// @param addr The address in the given tile.
 /// @return The data
 u32 mlir_aie_data_mem_rd_word(aie_libxaie_ctx_t *ctx, int col, int row,
                               u64 addr) {
+  ctx_guard guard(ctx->mutex);
   u32 data;
   XAie_DataMemRdWord(&(ctx->DevInst), XAie_TileLoc(col, row), addr, &data);
   return data;
@@ -143,9 +517,62 @@ u32 mlir_aie_data_mem_rd_word(aie_libxaie_ctx_t *ctx, int col, int row,
 /// @param data The data
 void mlir_aie_data_mem_wr_word(aie_libxaie_ctx_t *ctx, int col, int row,
                                u64 addr, u32 data) {
+  ctx_guard guard(ctx->mutex);
   XAie_DataMemWrWord(&(ctx->DevInst), XAie_TileLoc(col, row), addr, data);
 }
 
+/// @brief Read a block of the data memory of a particular tile at once.
+/// @param addr The address in the given tile.
+/// @param data The destination of the data
+/// @param bytes The number of bytes to read
+/// @return Zero on success
+int mlir_aie_data_mem_read_block(aie_libxaie_ctx_t *ctx, int col, int row,
+                                 u64 addr, void *data, u32 bytes) {
+  ctx_guard guard(ctx->mutex);
+  return XAie_DataMemBlockRead(&(ctx->DevInst), XAie_TileLoc(col, row), addr,
+                               data, bytes) == XAIE_OK
+             ? 0
+             : -1;
+}
+
+/// @brief Write a block of the data memory of a particular tile at once.
+/// @param addr The address in the given tile.
+/// @param data The source of the data
+/// @param bytes The number of bytes to write
+/// @return Zero on success
+int mlir_aie_data_mem_write_block(aie_libxaie_ctx_t *ctx, int col, int row,
+                                  u64 addr, const void *data, u32 bytes) {
+  ctx_guard guard(ctx->mutex);
+  return XAie_DataMemBlockWrite(&(ctx->DevInst), XAie_TileLoc(col, row), addr,
+                                data, bytes) == XAIE_OK
+             ? 0
+             : -1;
+}
+
+// The number of words of the chunks the block helpers go through.
+#define MLIR_AIE_BLOCK_CHUNK_WORDS 256
+
+/// @brief Fill a block of the data memory of a particular tile with a value,
+/// in writes of a chunk of words at a time.
+/// @param addr The address in the given tile, 32-bit aligned.
+/// @param value The value of each word
+/// @param words The number of words to fill
+/// @return Zero on success
+int mlir_aie_data_mem_memset(aie_libxaie_ctx_t *ctx, int col, int row,
+                             u64 addr, u32 value, u32 words) {
+  u32 chunk[MLIR_AIE_BLOCK_CHUNK_WORDS];
+  for (u32 i = 0; i < MLIR_AIE_BLOCK_CHUNK_WORDS; i++)
+    chunk[i] = value;
+  ctx_guard guard(ctx->mutex);
+  for (u32 i = 0; i < words; i += MLIR_AIE_BLOCK_CHUNK_WORDS) {
+    u32 count = std::min<u32>(words - i, MLIR_AIE_BLOCK_CHUNK_WORDS);
+    if (mlir_aie_data_mem_write_block(ctx, col, row, addr + 4 * i, chunk,
+                                      4 * count))
+      return -1;
+  }
+  return 0;
+}
+
 /// @brief Return the base address of the given tile.
 /// The configuration address space of most tiles is very similar,
 /// relative to this base address.
@@ -156,21 +583,22 @@ u64 mlir_aie_get_tile_addr(aie_libxaie_ctx_t *ctx, int col, int row) {
 /// @brief Dump the tile memory of the given tile
 /// Values that are zero are not shown
 void mlir_aie_dump_tile_memory(aie_libxaie_ctx_t *ctx, int col, int row) {
-  for (int i = 0; i < 0x2000; i++) {
-    uint32_t d;
-    AieRC rc = XAie_DataMemRdWord(&(ctx->DevInst), XAie_TileLoc(col, row),
-                                  (i * 4), &d);
-    if (rc == XAIE_OK && d != 0)
-      printf("Tile[%d][%d]: mem[%d] = %d\n", col, row, i, d);
+  ctx_guard guard(ctx->mutex);
+  u32 chunk[MLIR_AIE_BLOCK_CHUNK_WORDS];
+  for (int i = 0; i < 0x2000; i += MLIR_AIE_BLOCK_CHUNK_WORDS) {
+    if (mlir_aie_data_mem_read_block(ctx, col, row, (i * 4), chunk,
+                                     sizeof(chunk)))
+      continue;
+    for (int j = 0; j < MLIR_AIE_BLOCK_CHUNK_WORDS; j++)
+      if (chunk[j] != 0)
+        printf("Tile[%d][%d]: mem[%d] = %d\n", col, row, i + j, chunk[j]);
   }
 }
 
 /// @brief Fill the tile memory of the given tile with zeros.
 /// Values that are zero are not shown
 void mlir_aie_clear_tile_memory(aie_libxaie_ctx_t *ctx, int col, int row) {
-  for (int i = 0; i < 0x2000; i++) {
-    XAie_DataMemWrWord(&(ctx->DevInst), XAie_TileLoc(col, row), (i * 4), 0);
-  }
+  mlir_aie_data_mem_memset(ctx, col, row, 0, 0, 0x2000);
 }
 
 static void print_aie1_dmachannel_status(aie_libxaie_ctx_t *ctx, int col,
@@ -298,6 +726,7 @@ static void print_bd(int bd, int bd_valid, u32 nextBd, u32 useNextBd,
 
 /// @brief Print a summary of the status of the given Tile DMA.
 void mlir_aie_print_dma_status(aie_libxaie_ctx_t *ctx, int col, int row) {
+  ctx_guard guard(ctx->mutex);
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
   auto TileType = ctx->DevInst.DevOps->GetTTypefromLoc(&(ctx->DevInst),
                                                        XAie_TileLoc(col, row));
@@ -489,6 +918,7 @@ void mlir_aie_print_dma_status(aie_libxaie_ctx_t *ctx, int col, int row) {
 
 void print_aie2_lock_status(aie_libxaie_ctx_t *ctx, int col, int row,
                             const char *type, int lockOffset, int locks) {
+  ctx_guard guard(ctx->mutex);
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
   printf("%s [%d, %d] AIE2 locks are: ", type, col, row);
   int lockAddr = tileAddr + lockOffset;
@@ -504,6 +934,7 @@ void print_aie2_lock_status(aie_libxaie_ctx_t *ctx, int col, int row,
 /// @brief Print a summary of the status of the given MemTile DMA.
 void mlir_aie_print_memtiledma_status(aie_libxaie_ctx_t *ctx, int col,
                                       int row) {
+  ctx_guard guard(ctx->mutex);
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
   auto TileType = ctx->DevInst.DevOps->GetTTypefromLoc(&(ctx->DevInst),
                                                        XAie_TileLoc(col, row));
@@ -565,6 +996,7 @@ void mlir_aie_print_memtiledma_status(aie_libxaie_ctx_t *ctx, int col,
 
 /// @brief Print a summary of the status of the given Shim DMA.
 void mlir_aie_print_shimdma_status(aie_libxaie_ctx_t *ctx, int col, int row) {
+  ctx_guard guard(ctx->mutex);
   // int col = loc.Col;
   // int row = loc.Row;
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
@@ -735,6 +1167,7 @@ void mlir_aie_print_shimdma_status(aie_libxaie_ctx_t *ctx, int col, int row) {
 /// @brief Print the status of a core represented by the given tile, at the
 /// given coordinates.
 void mlir_aie_print_tile_status(aie_libxaie_ctx_t *ctx, int col, int row) {
+  ctx_guard guard(ctx->mutex);
   // int col = loc.Col;
   // int row = loc.Row;
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
@@ -820,22 +1253,17 @@ void mlir_aie_print_tile_status(aie_libxaie_ctx_t *ctx, int col, int row) {
   printf("\n");
 }
 
+/// Clear the registers from low to high, included, in one block write.
 static void clear_range(XAie_DevInst *devInst, u64 tileAddr, u64 low,
                         u64 high) {
-  for (int i = low; i <= high; i += 4) {
-    XAie_Write32(devInst, tileAddr + i, 0);
-    // int x = XAie_Read32(ctx->DevInst,tileAddr+i);
-    // if(x != 0) {
-    //   printf("@%x = %x\n", i, x);
-    //   XAie_Write32(ctx->DevInst,tileAddr+i, 0);
-    // }
-  }
+  XAie_BlockSet32(devInst, tileAddr + low, 0, (high - low) / 4 + 1);
 }
 
 /// @brief Clear the configuration of the given (non-shim) tile.
 /// This includes: clearing the program memory, data memory,
 /// DMA descriptors, and stream switch configuration.
 void mlir_aie_clear_config(aie_libxaie_ctx_t *ctx, int col, int row) {
+  ctx_guard guard(ctx->mutex);
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
 
   // Put the core in reset first, otherwise bus collisions
@@ -866,6 +1294,7 @@ void mlir_aie_clear_config(aie_libxaie_ctx_t *ctx, int col, int row) {
 /// This includes: clearing the program memory, data memory,
 /// DMA descriptors, and stream switch configuration.
 void mlir_aie_clear_shim_config(aie_libxaie_ctx_t *ctx, int col, int row) {
+  ctx_guard guard(ctx->mutex);
   u64 tileAddr = _XAie_GetTileAddr(&(ctx->DevInst), row, col);
 
   // ShimDMA
@@ -883,33 +1312,962 @@ void mlir_aie_clear_shim_config(aie_libxaie_ctx_t *ctx, int col, int row) {
   clear_range(&(ctx->DevInst), tileAddr, 0x3F200, 0x3F37C);
 }
 
+/// @brief Reset the whole partition of the context at once, instead of
+/// clearing its tiles one at a time: the columns are reset, which resets the
+/// cores, DMAs, locks and stream switches, and the memories are cleared.
+/// @return Zero on success
+int mlir_aie_reset_partition(aie_libxaie_ctx_t *ctx) {
+  ctx_guard guard(ctx->mutex);
+  if (XAie_ResetPartition(&(ctx->DevInst)) != XAIE_OK) {
+    printf("Failed to reset partition.\n");
+    return -1;
+  }
+  if (XAie_ClearPartitionMems(&(ctx->DevInst)) != XAIE_OK) {
+    printf("Failed to clear partition memories.\n");
+    return -1;
+  }
+  return 0;
+}
+
+mlir_aie_scheduler_t *
+mlir_aie_create_scheduler(aie_libxaie_ctx_t *(*initContext)(), int startCol,
+                          int numCols) {
+  auto *scheduler = new mlir_aie_scheduler_t;
+  scheduler->initContext = initContext;
+  scheduler->startCol = startCol;
+  scheduler->numCols = numCols;
+  scheduler->startTime = mlir_aie_time_us();
+  return scheduler;
+}
+
+void mlir_aie_destroy_scheduler(mlir_aie_scheduler_t *scheduler) {
+  for (auto &partition : scheduler->partitions)
+    if (partition.ctx)
+      mlir_aie_deinit_libxaie(partition.ctx);
+  delete scheduler;
+}
+
+int mlir_aie_scheduler_add_design(mlir_aie_scheduler_t *scheduler,
+                                  const u32 *txn, size_t words, int numCols) {
+  if (words < 4 || txn[0] != TXN_MAGIC || txn[1] != TXN_VERSION ||
+      numCols < 1 || numCols > scheduler->numCols)
+    return -1;
+  std::lock_guard<std::mutex> guard(scheduler->mutex);
+  scheduler->designs.push_back({txn, words, numCols});
+  return scheduler->designs.size() - 1;
+}
+
+int mlir_aie_scheduler_submit(mlir_aie_scheduler_t *scheduler, int design,
+                              mlir_aie_job_callback_t run, void *user) {
+  std::lock_guard<std::mutex> guard(scheduler->mutex);
+  if (design < 0 || design >= (int)scheduler->designs.size())
+    return -1;
+  scheduler->jobs.push_back({design, run, user});
+  scheduler->changed.notify_all();
+  return 0;
+}
+
+/// Return the index of the partition the job can run in, creating it in free
+/// columns if no idle partition has its design loaded, or -1 if it does not
+/// fit in the free columns. The idle partitions overlapping the new one are
+/// removed. Called with the mutex of the scheduler taken.
+static int
+mlir_aie_scheduler_place(mlir_aie_scheduler_t *scheduler,
+                         const mlir_aie_scheduler_t::Job &job) {
+  auto &partitions = scheduler->partitions;
+  for (size_t i = 0; i < partitions.size(); i++)
+    if (!partitions[i].busy && partitions[i].design == job.design)
+      return i;
+
+  int numCols = scheduler->designs[job.design].numCols;
+  int best = -1, bestEvictions = 0;
+  for (int start = scheduler->startCol;
+       start + numCols <= scheduler->startCol + scheduler->numCols; start++) {
+    int evictions = 0;
+    bool free = true;
+    for (auto &partition : partitions) {
+      if (partition.startCol >= start + numCols ||
+          start >= partition.startCol + partition.numCols)
+        continue;
+      free &= !partition.busy;
+      evictions++;
+    }
+    if (free && (best < 0 || evictions < bestEvictions)) {
+      best = start;
+      bestEvictions = evictions;
+    }
+  }
+  if (best < 0)
+    return -1;
+
+  for (size_t i = 0; i < partitions.size();) {
+    if (partitions[i].startCol < best + numCols &&
+        best < partitions[i].startCol + partitions[i].numCols) {
+      if (partitions[i].ctx)
+        mlir_aie_deinit_libxaie(partitions[i].ctx);
+      partitions.erase(partitions.begin() + i);
+    } else {
+      i++;
+    }
+  }
+  // The design is loaded by the worker once the partition is busy.
+  partitions.push_back({nullptr, best, numCols, -1, false});
+  return partitions.size() - 1;
+}
+
+/// Load the design in the partition, initializing it first if it is new.
+static int mlir_aie_scheduler_load(mlir_aie_scheduler_t *scheduler,
+                                   mlir_aie_scheduler_t::Partition &partition,
+                                   const mlir_aie_design_t &design) {
+  if (!partition.ctx) {
+    partition.ctx = scheduler->initContext();
+    if (!partition.ctx ||
+        mlir_aie_init_device_partition(partition.ctx, partition.startCol,
+                                       partition.numCols))
+      return -1;
+  } else if (mlir_aie_reset_partition(partition.ctx)) {
+    return -1;
+  }
+  return mlir_aie_replay_txn_at(partition.ctx, design.txn, design.words,
+                                partition.startCol);
+}
+
+/// The partitions only change with the mutex of the scheduler taken, and a
+/// busy one is left alone by the other workers, so that a worker uses its
+/// partition without the mutex.
+static void mlir_aie_scheduler_work(mlir_aie_scheduler_t *scheduler) {
+  std::unique_lock<std::mutex> lock(scheduler->mutex);
+  while (!scheduler->jobs.empty() || scheduler->running) {
+    auto &jobs = scheduler->jobs;
+    int index = -1;
+    auto it = jobs.begin();
+    for (; it != jobs.end(); ++it)
+      if ((index = mlir_aie_scheduler_place(scheduler, *it)) >= 0)
+        break;
+    if (index < 0) {
+      // The jobs running free their columns, or queue more jobs, once done.
+      scheduler->changed.wait(lock);
+      continue;
+    }
+    mlir_aie_scheduler_t::Job job = *it;
+    jobs.erase(it);
+    scheduler->running++;
+    auto &partitions = scheduler->partitions;
+    partitions[index].busy = true;
+    // The partition stays in place while it is busy, but the vector can grow.
+    mlir_aie_scheduler_t::Partition partition = partitions[index];
+    const mlir_aie_design_t design = scheduler->designs[job.design];
+    lock.unlock();
+
+    bool loaded = partition.design == job.design;
+    int result = 0;
+    if (!loaded) {
+      result = mlir_aie_scheduler_load(scheduler, partition, design);
+      partition.design = result ? -1 : job.design;
+    }
+    u64 start = mlir_aie_time_us();
+    if (!result)
+      result = job.run(partition.ctx, job.user);
+    u64 elapsed = mlir_aie_time_us() - start;
+
+    lock.lock();
+    for (auto &p : partitions)
+      if (p.busy && p.startCol == partition.startCol) {
+        p = partition;
+        p.busy = false;
+      }
+    scheduler->running--;
+    scheduler->jobsRun++;
+    scheduler->jobsFailed += result != 0;
+    scheduler->loads += !loaded;
+    scheduler->busyColumnTime += elapsed * partition.numCols;
+    scheduler->changed.notify_all();
+  }
+  scheduler->changed.notify_all();
+}
+
+int mlir_aie_scheduler_run(mlir_aie_scheduler_t *scheduler, int numThreads) {
+  u64 failed;
+  {
+    std::lock_guard<std::mutex> guard(scheduler->mutex);
+    failed = scheduler->jobsFailed;
+  }
+  std::vector<std::thread> workers;
+  for (int i = 1; i < numThreads; i++)
+    workers.emplace_back(mlir_aie_scheduler_work, scheduler);
+  mlir_aie_scheduler_work(scheduler);
+  for (auto &worker : workers)
+    worker.join();
+  return scheduler->jobsFailed - failed;
+}
+
+void mlir_aie_scheduler_get_stats(mlir_aie_scheduler_t *scheduler,
+                                  mlir_aie_scheduler_stats_t *stats) {
+  std::lock_guard<std::mutex> guard(scheduler->mutex);
+  stats->jobsRun = scheduler->jobsRun;
+  stats->jobsFailed = scheduler->jobsFailed;
+  stats->loads = scheduler->loads;
+  stats->hits = scheduler->jobsRun - scheduler->loads;
+  stats->elapsedTime = mlir_aie_time_us() - scheduler->startTime;
+  stats->busyColumnTime = scheduler->busyColumnTime;
+  stats->utilization =
+      stats->elapsedTime ? (double)stats->busyColumnTime /
+                               (stats->elapsedTime * scheduler->numCols)
+                         : 0;
+}
+
+// The number of events a trace unit traces.
+#define MLIR_AIE_TRACE_SLOTS 8
+
+int mlir_aie_trace_tile(aie_libxaie_ctx_t *ctx, int col, int row,
+                        XAie_ModuleType module, u8 packetID,
+                        const XAie_Events *events, int numEvents,
+                        XAie_Events startE, XAie_Events stopE) {
+  if (numEvents > MLIR_AIE_TRACE_SLOTS)
+    return -1;
+  ctx_guard guard(ctx->mutex);
+  XAie_LocType loc = XAie_TileLoc(col, row);
+  // The packet type tells the modules apart in the trace: 0 for the cores, 1
+  // for the memories and 2 for the shims.
+  u8 packetType = module == XAIE_CORE_MOD ? 0 : module == XAIE_MEM_MOD ? 1 : 2;
+  if (XAie_TracePktConfig(&(ctx->DevInst), loc, module,
+                          XAie_PacketInit(packetID, packetType)) != XAIE_OK)
+    return -1;
+  for (int slot = 0; slot < numEvents; slot++)
+    if (XAie_TraceEvent(&(ctx->DevInst), loc, module, events[slot], slot) !=
+        XAIE_OK)
+      return -1;
+  if (XAie_TraceControlConfig(&(ctx->DevInst), loc, module, startE, stopE,
+                              XAIE_TRACE_EVENT_TIME) != XAIE_OK)
+    return -1;
+  return 0;
+}
+
+int mlir_aie_trace_shim_dma(aie_libxaie_ctx_t *ctx, int col, int channel,
+                            u8 bd, u64 addr, u32 bytes) {
+  ctx_guard guard(ctx->mutex);
+  XAie_LocType loc = XAie_TileLoc(col, 0);
+  XAie_DmaDesc desc;
+  if (XAie_DmaDescInit(&(ctx->DevInst), &desc, loc) != XAIE_OK ||
+      XAie_DmaSetAddrLen(&desc, addr, bytes) != XAIE_OK ||
+      XAie_DmaSetAxi(&desc, 0, 16, 0, 0, 0) != XAIE_OK ||
+      XAie_DmaEnableBd(&desc) != XAIE_OK ||
+      XAie_DmaWriteBd(&(ctx->DevInst), &desc, loc, bd) != XAIE_OK ||
+      XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), loc, channel, DMA_S2MM,
+                                   bd) != XAIE_OK ||
+      XAie_DmaChannelEnable(&(ctx->DevInst), loc, channel, DMA_S2MM) !=
+          XAIE_OK) {
+    printf("Failed to configure the trace shim DMA.\n");
+    return -1;
+  }
+  return 0;
+}
+
+// The header of the control packet streams generated by aie-translate
+// --aie-generate-ctrlpkt.
+#define CTRLPKT_MAGIC 0x4B504341u
+#define CTRLPKT_VERSION 1u
+
+// The buffer descriptors mlir_aie_send_ctrlpkts cycles through, as many as
+// the queue of a shim DMA channel holds.
+#define CTRLPKT_BDS 4
+
+/// Each packet is sent by its own buffer descriptor, so that the DMA ends it
+/// with the last word of the transfer. A descriptor is reused once the queue
+/// of the channel has room again, as the descriptor queued CTRLPKT_BDS
+/// packets earlier is then done.
+int mlir_aie_send_ctrlpkts(aie_libxaie_ctx_t *ctx, int col, int channel,
+                           u8 bd, u64 addr, const u32 *stream, size_t words,
+                           int timeout) {
+  if (words < 4 || stream[0] != CTRLPKT_MAGIC ||
+      stream[1] != CTRLPKT_VERSION || stream[3] > words)
+    return -1;
+
+  XAie_LocType loc = XAie_TileLoc(col, 0);
+  {
+    ctx_guard guard(ctx->mutex);
+    if (XAie_DmaChannelEnable(&(ctx->DevInst), loc, channel, DMA_MM2S) !=
+        XAIE_OK)
+      return -1;
+  }
+  size_t i = 4;
+  for (u32 packet = 0; packet < stream[2]; packet++) {
+    if (i >= words || stream[i] > words - i - 1)
+      return -1;
+    u32 count = stream[i++];
+
+    u64 start = mlir_aie_time_us();
+    useconds_t backoff = 1;
+    while (true) {
+      u8 pendingBDs = CTRLPKT_BDS;
+      {
+        ctx_guard guard(ctx->mutex);
+        XAie_DmaGetPendingBdCount(&(ctx->DevInst), loc, channel, DMA_MM2S,
+                                  &pendingBDs);
+      }
+      if (pendingBDs < CTRLPKT_BDS)
+        break;
+      if (mlir_aie_time_us() - start >= (u64)timeout)
+        return -1;
+      usleep(backoff);
+      if (backoff < 64)
+        backoff *= 2;
+    }
+
+    ctx_guard guard(ctx->mutex);
+    u8 packetBD = bd + packet % CTRLPKT_BDS;
+    XAie_DmaDesc desc;
+    if (XAie_DmaDescInit(&(ctx->DevInst), &desc, loc) != XAIE_OK ||
+        XAie_DmaSetAddrLen(&desc, addr + i * sizeof(u32),
+                           count * sizeof(u32)) != XAIE_OK ||
+        XAie_DmaSetAxi(&desc, 0, 16, 0, 0, 0) != XAIE_OK ||
+        XAie_DmaEnableBd(&desc) != XAIE_OK ||
+        XAie_DmaWriteBd(&(ctx->DevInst), &desc, loc, packetBD) != XAIE_OK ||
+        XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), loc, channel, DMA_MM2S,
+                                     packetBD) != XAIE_OK) {
+      printf("Failed to send control packet %u.\n", packet);
+      return -1;
+    }
+    i += count;
+  }
+  return 0;
+}
+
+// The depth of the queue of a shim DMA channel, which bounds the buffers of a
+// stream in flight.
+#define STREAM_MAX_BUFFERS 4
+
+/// Queue the buffer of the next transfer of the stream, or its first bytes
+/// bytes, to its channel.
+static int mlir_aie_stream_queue(mlir_aie_stream_t *stream, size_t bytes) {
+  aie_libxaie_ctx_t *ctx = stream->ctx;
+  size_t index = stream->submitted % stream->buffers.size();
+  ext_mem_model_t *buffer = stream->buffers[index];
+  u64 addr = mlir_aie_get_device_address(ctx, buffer->virtualAddr);
+  u8 bd = stream->firstBD + index;
+
+  ctx_guard guard(ctx->mutex);
+  XAie_LocType loc = XAie_TileLoc(stream->col, 0);
+  XAie_DmaDesc desc;
+  if (XAie_DmaDescInit(&(ctx->DevInst), &desc, loc) != XAIE_OK ||
+      XAie_DmaSetAddrLen(&desc, addr, bytes) != XAIE_OK ||
+      XAie_DmaSetAxi(&desc, 0, 16, 0, 0, 0) != XAIE_OK ||
+      XAie_DmaEnableBd(&desc) != XAIE_OK ||
+      XAie_DmaWriteBd(&(ctx->DevInst), &desc, loc, bd) != XAIE_OK ||
+      XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), loc, stream->channel,
+                                   stream->dir, bd) != XAIE_OK) {
+    printf("Failed to queue buffer %zu of the stream.\n", index);
+    return -1;
+  }
+  stream->submitted++;
+  return 0;
+}
+
+/// Wait up to timeout microseconds, or forever if -1, for the channel of the
+/// stream to be done with more than done buffers. The channel completes its
+/// buffer descriptors in order, so the ones no longer pending are the oldest.
+static bool mlir_aie_stream_wait(mlir_aie_stream_t *stream, u64 done,
+                                 int timeout) {
+  aie_libxaie_ctx_t *ctx = stream->ctx;
+  XAie_LocType loc = XAie_TileLoc(stream->col, 0);
+  u64 start = mlir_aie_time_us();
+  useconds_t backoff = 1;
+  while (stream->completed <= done) {
+    u8 pendingBDs = STREAM_MAX_BUFFERS;
+    {
+      ctx_guard guard(ctx->mutex);
+      if (XAie_DmaGetPendingBdCount(&(ctx->DevInst), loc, stream->channel,
+                                    stream->dir, &pendingBDs) != XAIE_OK)
+        return false;
+    }
+    stream->completed = stream->submitted - pendingBDs;
+    if (stream->completed > done)
+      break;
+    if (timeout >= 0 && mlir_aie_time_us() - start >= (u64)timeout)
+      return false;
+    usleep(backoff);
+    if (backoff < 64)
+      backoff *= 2;
+  }
+  return true;
+}
+
+mlir_aie_stream_t *mlir_aie_create_stream(aie_libxaie_ctx_t *ctx, int col,
+                                          int channel, XAie_DmaDirection dir,
+                                          u8 firstBD, ext_mem_model_t *buffers,
+                                          int numBuffers, size_t bytes) {
+  if (numBuffers < 1 || numBuffers > STREAM_MAX_BUFFERS)
+    return nullptr;
+  for (int i = 0; i < numBuffers; i++)
+    if (buffers[i].size < bytes)
+      return nullptr;
+
+  auto *stream = new mlir_aie_stream_t;
+  stream->ctx = ctx;
+  stream->col = col;
+  stream->channel = channel;
+  stream->dir = dir;
+  stream->firstBD = firstBD;
+  stream->bytes = bytes;
+  for (int i = 0; i < numBuffers; i++)
+    stream->buffers.push_back(&buffers[i]);
+
+  if (dir == DMA_S2MM) {
+    for (int i = 0; i < numBuffers; i++) {
+      mlir_aie_sync_mem_dev(buffers[i]);
+      if (mlir_aie_stream_queue(stream, bytes)) {
+        delete stream;
+        return nullptr;
+      }
+    }
+  }
+  ctx_guard guard(ctx->mutex);
+  if (XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(col, 0), channel,
+                            dir) != XAIE_OK) {
+    printf("Failed to enable the channel of the stream.\n");
+    delete stream;
+    return nullptr;
+  }
+  return stream;
+}
+
+void mlir_aie_destroy_stream(mlir_aie_stream_t *stream) { delete stream; }
+
+/// A buffer of an MM2S stream is free once the channel is done with the
+/// transfer of the same buffer, numBuffers transfers earlier.
+void *mlir_aie_stream_acquire(mlir_aie_stream_t *stream, int timeout) {
+  size_t numBuffers = stream->buffers.size();
+  if (stream->dir != DMA_MM2S ||
+      (stream->taken >= numBuffers &&
+       !mlir_aie_stream_wait(stream, stream->taken - numBuffers, timeout)))
+    return nullptr;
+  return stream->buffers[stream->taken++ % numBuffers]->virtualAddr;
+}
+
+int mlir_aie_stream_submit(mlir_aie_stream_t *stream, size_t bytes) {
+  if (stream->dir != DMA_MM2S || stream->submitted >= stream->taken ||
+      bytes > stream->bytes)
+    return -1;
+  ext_mem_model_t *buffer =
+      stream->buffers[stream->submitted % stream->buffers.size()];
+  mlir_aie_sync_mem_dev_range(*buffer, 0, bytes);
+  return mlir_aie_stream_queue(stream, bytes);
+}
+
+void *mlir_aie_stream_receive(mlir_aie_stream_t *stream, int timeout) {
+  if (stream->dir != DMA_S2MM || stream->taken >= stream->submitted ||
+      !mlir_aie_stream_wait(stream, stream->taken, timeout))
+    return nullptr;
+  ext_mem_model_t *buffer =
+      stream->buffers[stream->taken++ % stream->buffers.size()];
+  mlir_aie_sync_mem_cpu_range(*buffer, 0, stream->bytes);
+  return buffer->virtualAddr;
+}
+
+/// The released buffers are queued again in the order they were received,
+/// which is the one of their transfers.
+int mlir_aie_stream_release(mlir_aie_stream_t *stream) {
+  if (stream->dir != DMA_S2MM ||
+      stream->submitted - stream->buffers.size() >= stream->taken)
+    return -1;
+  return mlir_aie_stream_queue(stream, stream->bytes);
+}
+
+int mlir_aie_stream_pump(mlir_aie_stream_t *stream,
+                         mlir_aie_stream_callback_t callback, void *user,
+                         int timeout) {
+  int count = 0;
+  while (true) {
+    void *buffer = stream->dir == DMA_MM2S
+                       ? mlir_aie_stream_acquire(stream, timeout)
+                       : mlir_aie_stream_receive(stream, timeout);
+    if (!buffer)
+      return count;
+    size_t bytes = callback(buffer, stream->bytes, user);
+    // The buffer left unfilled is free again.
+    if (stream->dir == DMA_MM2S && !bytes)
+      stream->taken--;
+    if (stream->dir == DMA_S2MM) {
+      if (mlir_aie_stream_release(stream))
+        return -1;
+    } else if (bytes && mlir_aie_stream_submit(stream, bytes)) {
+      return -1;
+    }
+    if (!bytes)
+      return count;
+    count++;
+  }
+}
+
 /*
  ******************************************************************************
  * COMMON
  ******************************************************************************
  */
 
-/// @brief Given an array of values, compute and print statistics about those
-/// values.
-/// @param performance_counter An array of values
-/// @param n The number of values
-void computeStats(u32 performance_counter[], int n) {
-  u32 total_0 = 0;
+// The most performance counters of a module, AIE2 memory tiles having 4.
+#define MLIR_AIE_MAX_PERF_COUNTERS 4
+
+static const char *mlir_aie_module_name(XAie_ModuleType module) {
+  switch (module) {
+  case XAIE_CORE_MOD:
+    return "core";
+  case XAIE_MEM_MOD:
+    return "memory";
+  default:
+    return "shim";
+  }
+}
+
+PerfCounterSet::~PerfCounterSet() {
+  ctx_guard guard(ctx->mutex);
+  for (auto &c : counters)
+    XAie_PerfCounterControlReset(&(ctx->DevInst), XAie_TileLoc(c.col, c.row),
+                                 c.module, c.id);
+}
+
+/// The counters of the modules are not tracked by libXAIE: a counter is free
+/// if no counter of the set uses it, and the module has it if its control can
+/// be set.
+int PerfCounterSet::add(u32 col, u32 row, XAie_ModuleType module,
+                        XAie_Events startE, XAie_Events endE,
+                        const char *name) {
+  ctx_guard guard(ctx->mutex);
+  for (u8 id = 0; id < MLIR_AIE_MAX_PERF_COUNTERS; id++) {
+    bool used = false;
+    for (auto &c : counters)
+      used |= c.col == col && c.row == row && c.module == module && c.id == id;
+    if (used)
+      continue;
+    if (XAie_PerfCounterControlSet(&(ctx->DevInst), XAie_TileLoc(col, row),
+                                   module, id, startE, endE) != XAIE_OK)
+      return -1;
+    counters.push_back({col, row, module, id, name, 0, 0});
+    return counters.size() - 1;
+  }
+  return -1;
+}
+
+void PerfCounterSet::start() {
+  ctx_guard guard(ctx->mutex);
+  for (auto &c : counters) {
+    XAie_PerfCounterGet(&(ctx->DevInst), XAie_TileLoc(c.col, c.row), c.module,
+                        c.id, &c.last);
+    c.value = 0;
+  }
+}
+
+void PerfCounterSet::sample() {
+  ctx_guard guard(ctx->mutex);
+  for (auto &c : counters) {
+    u32 current;
+    XAie_PerfCounterGet(&(ctx->DevInst), XAie_TileLoc(c.col, c.row), c.module,
+                        c.id, &current);
+    // Modulo 2^32, the difference counts through a wrap of the counter.
+    c.value += (u32)(current - c.last);
+    c.last = current;
+  }
+}
+
+void PerfCounterSet::writeCSV(FILE *file) const {
+  fprintf(file, "name,col,row,module,counter,value\n");
+  for (auto &c : counters)
+    fprintf(file, "%s,%u,%u,%s,%u,%llu\n", c.name.c_str(), c.col, c.row,
+            mlir_aie_module_name(c.module), c.id, (unsigned long long)c.value);
+}
+
+void PerfCounterSet::writeJSON(FILE *file) const {
+  fprintf(file, "[");
+  for (size_t i = 0; i < counters.size(); i++) {
+    const Counter &c = counters[i];
+    fprintf(file,
+            "%s\n  {\"name\": \"%s\", \"col\": %u, \"row\": %u, "
+            "\"module\": \"%s\", \"counter\": %u, \"value\": %llu}",
+            i ? "," : "", c.name.c_str(), c.col, c.row,
+            mlir_aie_module_name(c.module), c.id, (unsigned long long)c.value);
+  }
+  fprintf(file, "\n]\n");
+}
+
+/// The events of the stalls of the cores, in the order of
+/// DataflowProfile::Stall, and their names in the reports.
+static const XAie_Events mlir_aie_stall_events[] = {
+    XAIE_EVENT_LOCK_STALL_CORE, XAIE_EVENT_STREAM_STALL_CORE,
+    XAIE_EVENT_MEMORY_STALL_CORE};
+static const char *mlir_aie_stall_names[] = {"lock", "stream", "memory"};
+
+bool DataflowProfile::addCore(u32 col, u32 row, const char *name) {
+  std::string coreName =
+      name ? name
+           : "core(" + std::to_string(col) + ", " + std::to_string(row) + ")";
+  Core core;
+  core.name = coreName;
+  core.col = col;
+  core.row = row;
+  core.cycles = counters.add(col, row, XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+                             XAIE_EVENT_DISABLED_CORE, coreName.c_str());
+  if (core.cycles < 0)
+    return false;
+  // A counter started and stopped by the same event counts its cycles.
+  bool counted = true;
+  for (int stall = 0; stall < NumStalls; stall++) {
+    core.stalls[stall] = counters.add(
+        col, row, XAIE_CORE_MOD, mlir_aie_stall_events[stall],
+        mlir_aie_stall_events[stall],
+        (coreName + " " + mlir_aie_stall_names[stall] + " stalls").c_str());
+    counted &= core.stalls[stall] >= 0;
+  }
+  cores.push_back(core);
+  return counted;
+}
+
+void DataflowProfile::start() {
+  counters.start();
+  startUs = mlir_aie_time_us();
+}
+
+void DataflowProfile::stop() {
+  stopUs = mlir_aie_time_us();
+  counters.stop();
+}
+
+double DataflowProfile::seconds() const {
+  if (!byCores)
+    return (stopUs - startUs) / 1e6;
+  u64 cycles = 0;
+  for (const Core &core : cores)
+    cycles = std::max(cycles, counters.value(core.cycles));
+  return cycles / (clockMHz * 1e6);
+}
+
+double DataflowProfile::stallShare(const Core &core, int stall) const {
+  if (core.stalls[stall] < 0 || !counters.value(core.cycles))
+    return -1;
+  return (double)counters.value(core.stalls[stall]) /
+         counters.value(core.cycles);
+}
+
+double DataflowProfile::utilization(const Core &core) const {
+  double stalled = 0;
+  for (int stall = 0; stall < NumStalls; stall++) {
+    double share = stallShare(core, stall);
+    if (share < 0)
+      return -1;
+    stalled += share;
+  }
+  // The stalls of a cycle may overlap.
+  return std::max(0.0, 1.0 - stalled);
+}
+
+/// Print a share of cycles as a percentage, or a dash if unknown.
+static void mlir_aie_print_share(FILE *file, double share) {
+  if (share < 0)
+    fprintf(file, " %8s", "-");
+  else
+    fprintf(file, " %7.1f%%", share * 100);
+}
+
+void DataflowProfile::report(FILE *file, const char *name, double ops,
+                             double bytes) const {
+  double time = seconds();
+  fprintf(file, "%s: %.3f ms", name, time * 1e3);
+  if (ops && time)
+    fprintf(file, ", %.3f Gops/s", ops / time / 1e9);
+  if (bytes && time)
+    fprintf(file, ", %.3f GB/s", bytes / time / 1e9);
+  fprintf(file, "\n");
+  if (cores.empty())
+    return;
+  fprintf(file, "  %-16s %12s %8s %8s %8s %8s  %s\n", "core", "cycles",
+          "busy", "lock", "stream", "memory", "bound by");
+  for (const Core &core : cores) {
+    fprintf(file, "  %-16s %12llu", core.name.c_str(),
+            (unsigned long long)counters.value(core.cycles));
+    double busy = utilization(core);
+    mlir_aie_print_share(file, busy);
+    // The stage is bound by its largest stall, or compute-bound if it
+    // stalls less than it computes.
+    const char *bound = busy < 0 ? "-" : "compute";
+    double largest = busy;
+    for (int stall = 0; stall < NumStalls; stall++) {
+      double share = stallShare(core, stall);
+      mlir_aie_print_share(file, share);
+      if (busy >= 0 && share > largest) {
+        largest = share;
+        bound = mlir_aie_stall_names[stall];
+      }
+    }
+    fprintf(file, "  %s\n", bound);
+  }
+}
+
+void DataflowProfile::writeJSON(FILE *file, const char *name, double ops,
+                                double bytes) const {
+  double time = seconds();
+  fprintf(file, "{\"name\": \"%s\", \"seconds\": %g, \"ops_per_s\": %g, "
+                "\"bytes_per_s\": %g, \"cores\": [",
+          name, time, time ? ops / time : 0, time ? bytes / time : 0);
+  for (size_t i = 0; i < cores.size(); i++) {
+    const Core &core = cores[i];
+    fprintf(file, "%s{\"name\": \"%s\", \"col\": %u, \"row\": %u, "
+                  "\"cycles\": %llu, \"utilization\": %g",
+            i ? ", " : "", core.name.c_str(), core.col, core.row,
+            (unsigned long long)counters.value(core.cycles),
+            utilization(core));
+    for (int stall = 0; stall < NumStalls; stall++)
+      fprintf(file, ", \"%s_stall\": %g", mlir_aie_stall_names[stall],
+              stallShare(core, stall));
+    fprintf(file, "}");
+  }
+  fprintf(file, "]}\n");
+}
+
+std::vector<mlir_aie_function_range_t>
+mlir_aie_elf_functions(const char *elfPath) {
+  std::vector<mlir_aie_function_range_t> functions;
+  std::ifstream file(elfPath, std::ios::binary);
+  std::vector<char> elf((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+  // The AIE ELF files are 32-bit little-endian, like the host reads them.
+  if (elf.size() < sizeof(Elf32_Ehdr) || memcmp(elf.data(), ELFMAG, SELFMAG) ||
+      elf[EI_CLASS] != ELFCLASS32 || elf[EI_DATA] != ELFDATA2LSB)
+    return functions;
+  auto inFile = [&](u64 offset, u64 size) {
+    return offset + size <= elf.size();
+  };
+  Elf32_Ehdr header;
+  memcpy(&header, elf.data(), sizeof(header));
+  if (!inFile(header.e_shoff, (u64)header.e_shnum * sizeof(Elf32_Shdr)))
+    return functions;
+  auto section = [&](u32 index) {
+    Elf32_Shdr shdr;
+    memcpy(&shdr, elf.data() + header.e_shoff + index * sizeof(Elf32_Shdr),
+           sizeof(shdr));
+    return shdr;
+  };
 
-  for (int i = 0; i < n; i++) {
-    total_0 += performance_counter[i];
+  for (u32 i = 0; i < header.e_shnum; i++) {
+    Elf32_Shdr symtab = section(i);
+    if (symtab.sh_type != SHT_SYMTAB || symtab.sh_link >= header.e_shnum)
+      continue;
+    Elf32_Shdr strtab = section(symtab.sh_link);
+    if (!inFile(symtab.sh_offset, symtab.sh_size) ||
+        !inFile(strtab.sh_offset, strtab.sh_size))
+      continue;
+    for (u32 s = 0; s + sizeof(Elf32_Sym) <= symtab.sh_size;
+         s += sizeof(Elf32_Sym)) {
+      Elf32_Sym sym;
+      memcpy(&sym, elf.data() + symtab.sh_offset + s, sizeof(sym));
+      if (ELF32_ST_TYPE(sym.st_info) != STT_FUNC || !sym.st_size ||
+          sym.st_name >= strtab.sh_size)
+        continue;
+      const char *name = elf.data() + strtab.sh_offset + sym.st_name;
+      functions.push_back(
+          {std::string(name, strnlen(name, strtab.sh_size - sym.st_name)),
+           sym.st_value, sym.st_value + sym.st_size});
+    }
   }
+  std::stable_sort(functions.begin(), functions.end(),
+                   [](const mlir_aie_function_range_t &a,
+                      const mlir_aie_function_range_t &b) {
+                     return a.end - a.start > b.end - b.start;
+                   });
+  return functions;
+}
 
-  float mean_0 = (float)total_0 / n;
+/// The number of address ranges a core checks its program counter against.
+#define MLIR_AIE_MAX_PC_RANGES 2
 
-  float sdev_0 = 0;
+bool FunctionProfile::addCore(u32 col, u32 row, const char *elfPath,
+                              const std::vector<std::string> &functions) {
+  std::vector<mlir_aie_function_range_t> all = mlir_aie_elf_functions(elfPath);
+  std::vector<mlir_aie_function_range_t> profiled;
+  if (functions.empty()) {
+    for (size_t i = 0; i < all.size() && i < MLIR_AIE_MAX_PC_RANGES; i++)
+      profiled.push_back(all[i]);
+  }
+  for (const std::string &name : functions) {
+    auto it = std::find_if(
+        all.begin(), all.end(),
+        [&](const mlir_aie_function_range_t &f) { return f.name == name; });
+    if (it == all.end())
+      return false;
+    profiled.push_back(*it);
+  }
+  if (profiled.empty() || profiled.size() > MLIR_AIE_MAX_PC_RANGES)
+    return false;
+
+  std::string coreName =
+      "core(" + std::to_string(col) + ", " + std::to_string(row) + ")";
+  Core core = {coreName,
+               counters.add(col, row, XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+                            XAIE_EVENT_DISABLED_CORE, coreName.c_str()),
+               {}};
+  if (core.cycles < 0)
+    return false;
+  static const XAie_Events rangeEvents[MLIR_AIE_MAX_PC_RANGES] = {
+      XAIE_EVENT_PC_RANGE_0_1_CORE, XAIE_EVENT_PC_RANGE_2_3_CORE};
+  for (size_t i = 0; i < profiled.size(); i++) {
+    const mlir_aie_function_range_t &range = profiled[i];
+    {
+      ctx_guard guard(ctx->mutex);
+      // Range i is raised while the program counter is between the
+      // addresses of the program counter events 2i and 2i + 1.
+      XAie_EventPCEnable(&(ctx->DevInst), XAie_TileLoc(col, row), 2 * i,
+                         range.start);
+      XAie_EventPCEnable(&(ctx->DevInst), XAie_TileLoc(col, row), 2 * i + 1,
+                         range.end);
+    }
+    int cycles = counters.add(col, row, XAIE_CORE_MOD, rangeEvents[i],
+                              rangeEvents[i],
+                              (coreName + " " + range.name).c_str());
+    if (cycles < 0)
+      return false;
+    core.functions.push_back({range, cycles});
+  }
+  cores.push_back(core);
+  return true;
+}
 
-  for (int i = 0; i < n; i++) {
-    float x = (float)performance_counter[i] - mean_0;
-    sdev_0 += x * x;
+void FunctionProfile::report(FILE *file, const char *name) const {
+  fprintf(file, "%s:\n", name);
+  for (const Core &core : cores) {
+    u64 total = counters.value(core.cycles);
+    fprintf(file, "  %s: %llu cycles\n", core.name.c_str(),
+            (unsigned long long)total);
+    for (const Function &f : core.functions) {
+      u64 cycles = counters.value(f.cycles);
+      fprintf(file, "    %s [0x%x, 0x%x): %llu cycles", f.range.name.c_str(),
+              f.range.start, f.range.end, (unsigned long long)cycles);
+      if (total)
+        fprintf(file, ", %.1f%%", 100.0 * cycles / total);
+      fprintf(file, "\n");
+    }
   }
+}
 
-  sdev_0 = sqrtf(sdev_0 / n);
+void FunctionProfile::writeJSON(FILE *file, const char *name) const {
+  fprintf(file, "{\"name\": \"%s\", \"cores\": [", name);
+  for (size_t i = 0; i < cores.size(); i++) {
+    const Core &core = cores[i];
+    fprintf(file, "%s{\"name\": \"%s\", \"cycles\": %llu, \"functions\": [",
+            i ? ", " : "", core.name.c_str(),
+            (unsigned long long)counters.value(core.cycles));
+    for (size_t j = 0; j < core.functions.size(); j++) {
+      const Function &f = core.functions[j];
+      fprintf(file, "%s{\"name\": \"%s\", \"start\": %u, \"end\": %u, "
+                    "\"cycles\": %llu}",
+              j ? ", " : "", f.range.name.c_str(), f.range.start, f.range.end,
+              (unsigned long long)counters.value(f.cycles));
+    }
+    fprintf(file, "]}");
+  }
+  fprintf(file, "]}\n");
+}
 
-  printf("Mean and Standard Devation: %f, %f \n", mean_0, sdev_0);
+/// The value of rank percentile of the sorted values, by the nearest rank.
+static u64 mlir_aie_percentile(const std::vector<u64> &sorted,
+                               int percentile) {
+  size_t rank = (sorted.size() * percentile + 99) / 100;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+int mlir_aie_compute_stats(const u64 *values, int n, double outlierSigma,
+                           mlir_aie_stats_t *stats) {
+  std::vector<u64> kept(values, values + n);
+  // The sums are taken in double, which holds the counts of long runs.
+  auto meanAndSdev = [&](double &mean, double &sdev) {
+    double total = 0, squares = 0;
+    for (u64 v : kept)
+      total += v;
+    mean = total / kept.size();
+    for (u64 v : kept)
+      squares += (v - mean) * (v - mean);
+    sdev = sqrt(squares / kept.size());
+  };
+  if (kept.empty())
+    return -1;
+  double mean, sdev;
+  meanAndSdev(mean, sdev);
+  if (outlierSigma > 0) {
+    kept.erase(std::remove_if(kept.begin(), kept.end(),
+                              [&](u64 v) {
+                                return fabs(v - mean) > outlierSigma * sdev;
+                              }),
+               kept.end());
+    if (kept.empty())
+      return -1;
+    meanAndSdev(mean, sdev);
+  }
+  std::sort(kept.begin(), kept.end());
+  stats->n = kept.size();
+  stats->outliers = n - kept.size();
+  stats->min = kept.front();
+  stats->max = kept.back();
+  stats->mean = mean;
+  stats->sdev = sdev;
+  stats->p50 = mlir_aie_percentile(kept, 50);
+  stats->p90 = mlir_aie_percentile(kept, 90);
+  stats->p99 = mlir_aie_percentile(kept, 99);
+  return 0;
+}
+
+void mlir_aie_print_histogram(const u64 *values, int n, int bins) {
+  if (n <= 0 || bins <= 0)
+    return;
+  u64 min = *std::min_element(values, values + n);
+  u64 max = *std::max_element(values, values + n);
+  u64 width = (max - min) / bins + 1;
+  std::vector<int> counts(bins);
+  for (int i = 0; i < n; i++)
+    counts[(values[i] - min) / width]++;
+  int most = *std::max_element(counts.begin(), counts.end());
+  for (int b = 0; b < bins; b++) {
+    printf("[%llu, %llu) %6d ", (unsigned long long)(min + b * width),
+           (unsigned long long)(min + (b + 1) * width), counts[b]);
+    for (int i = 0, e = counts[b] * 50 / most; i < e; i++)
+      printf("#");
+    printf("\n");
+  }
+}
+
+void mlir_aie_write_stats_json(FILE *file, const char *name,
+                               const mlir_aie_stats_t *stats) {
+  fprintf(file,
+          "{\"name\": \"%s\", \"n\": %d, \"outliers\": %d, "
+          "\"min\": %llu, \"max\": %llu, \"mean\": %f, \"sdev\": %f, "
+          "\"p50\": %llu, \"p90\": %llu, \"p99\": %llu}\n",
+          name, stats->n, stats->outliers, (unsigned long long)stats->min,
+          (unsigned long long)stats->max, stats->mean, stats->sdev,
+          (unsigned long long)stats->p50, (unsigned long long)stats->p90,
+          (unsigned long long)stats->p99);
+}
+
+void mlir_aie_write_stats_csv_header(FILE *file) {
+  fprintf(file, "name,n,outliers,min,max,mean,sdev,p50,p90,p99\n");
+}
+
+void mlir_aie_write_stats_csv(FILE *file, const char *name,
+                              const mlir_aie_stats_t *stats) {
+  fprintf(file, "%s,%d,%d,%llu,%llu,%f,%f,%llu,%llu,%llu\n", name, stats->n,
+          stats->outliers, (unsigned long long)stats->min,
+          (unsigned long long)stats->max, stats->mean, stats->sdev,
+          (unsigned long long)stats->p50, (unsigned long long)stats->p90,
+          (unsigned long long)stats->p99);
+}
+
+/// @brief Given an array of values, compute and print statistics about those
+/// values.
+/// @param performance_counter An array of values
+/// @param n The number of values
+void computeStats(u32 performance_counter[], int n) {
+  std::vector<u64> values(performance_counter, performance_counter + n);
+  mlir_aie_stats_t stats;
+  if (mlir_aie_compute_stats(values.data(), n, 0, &stats))
+    return;
+  printf("Mean and Standard Devation: %f, %f \n", stats.mean, stats.sdev);
+  printf("Min, p50, p90, p99 and Max: %llu, %llu, %llu, %llu, %llu \n",
+         (unsigned long long)stats.min, (unsigned long long)stats.p50,
+         (unsigned long long)stats.p90, (unsigned long long)stats.p99,
+         (unsigned long long)stats.max);
 }
@@ -11,8 +11,12 @@
 #define AIE_TEST_LIBRARY_H
 
 #include "target.h"
+#include <condition_variable>
+#include <deque>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
+#include <vector>
 
 extern "C" {
 
@@ -87,12 +91,9 @@ public:
     // } else {
     //   end = XAieTileMem_PerfCounterGet(tilePtr, pfc);
     // }
-    if (end < start) {
-      printf("WARNING: EventMonitor: performance counter wrapped!\n");
-      return 0; // TODO: fix this
-    } else {
-      return end - start;
-    }
+    // The difference modulo 2^32 is right across one wrap of the counter,
+    // longer intervals need a PerfCounterSet sampling them.
+    return end - start;
   }
 
 private:
@@ -103,6 +104,155 @@ private:
   XAie_DevInst *devInst;
 };
 
+/// A set of performance counters over the core, memory and shim modules of
+/// many tiles, read together and extended to 64 bits. The hardware counters
+/// are 32-bit: sample() must run at least once per wrap of the fastest one,
+/// i.e. every 2^32 cycles when counting cycles, for the values to stay exact.
+class PerfCounterSet {
+public:
+  PerfCounterSet(aie_libxaie_ctx_t *ctx) : ctx(ctx) {}
+  ~PerfCounterSet();
+
+  /// Allocate a free counter of the module of the tile, counting from
+  /// startE to endE, named name in the exports. Return the index of the
+  /// counter in the set, or -1 if the module has no counter left.
+  int add(u32 col, u32 row, XAie_ModuleType module, XAie_Events startE,
+          XAie_Events endE, const char *name);
+
+  /// Take the snapshot the values are counted from, on all the counters.
+  void start();
+  /// Read all the counters and account for their wraps since the previous
+  /// read.
+  void sample();
+  /// Take the last snapshot of all the counters.
+  void stop() { sample(); }
+
+  /// Return the 64-bit count of the counter of the given index.
+  u64 value(int index) const { return counters[index].value; }
+
+  /// Write the counts, one counter per line or object.
+  void writeCSV(FILE *file) const;
+  void writeJSON(FILE *file) const;
+
+private:
+  struct Counter {
+    u32 col, row;
+    XAie_ModuleType module;
+    u8 id;
+    std::string name;
+    u32 last;
+    u64 value;
+  };
+  aie_libxaie_ctx_t *ctx;
+  std::vector<Counter> counters;
+};
+
+/// The profile of a whole dataflow: the wall time the host waits for it and,
+/// for each core taking part, the cycles it ran and the cycles it stalled on
+/// locks, on streams and on memory. The utilization of a core is the fraction
+/// of its cycles it did not stall, i.e. of the cycles of its stage that did
+/// useful work, and its largest stall tells what the stage waits for: the
+/// objectFifos around it, its stream switches or the accesses to its memory.
+class DataflowProfile {
+public:
+  DataflowProfile(aie_libxaie_ctx_t *ctx, double clockMHz = 1000.0)
+      : counters(ctx), clockMHz(clockMHz) {}
+
+  /// Profile the core of the tile, named name in the reports. Return false
+  /// if its core module has not all its four counters left.
+  bool addCore(u32 col, u32 row, const char *name = nullptr);
+
+  /// Start the host timer and the core counters, before the cores start.
+  void start();
+  /// Stop them, once the host saw the end of the dataflow.
+  void stop();
+  /// Time the dataflow by the longest run of its cores instead of the host
+  /// timer, for the tests which sleep rather than wait for their results.
+  void timeByCores() { byCores = true; }
+
+  /// The duration of the dataflow in seconds.
+  double seconds() const;
+
+  /// Print the throughput of ops operations and bytes moved in the dataflow,
+  /// leaving out the ones that are zero, and a table of the utilization and
+  /// the stalls of each core.
+  void report(FILE *file, const char *name, double ops, double bytes) const;
+  /// Write the same as a single line of JSON.
+  void writeJSON(FILE *file, const char *name, double ops,
+                 double bytes) const;
+
+private:
+  /// The stalls counted on each core.
+  enum Stall { LockStall, StreamStall, MemoryStall, NumStalls };
+  struct Core {
+    std::string name;
+    u32 col, row;
+    int cycles, stalls[NumStalls];
+  };
+  /// The fraction of the cycles of core in stall, or -1 if unknown.
+  double stallShare(const Core &core, int stall) const;
+  /// The fraction of the cycles of core it did not stall, or -1 if unknown.
+  double utilization(const Core &core) const;
+
+  PerfCounterSet counters;
+  std::vector<Core> cores;
+  double clockMHz;
+  u64 startUs = 0, stopUs = 0;
+  bool byCores = false;
+};
+
+/// A function of the ELF file of a core: its name and the range [start, end)
+/// of the program addresses of its code.
+struct mlir_aie_function_range_t {
+  std::string name;
+  u32 start, end;
+};
+
+/// Read the functions of the symbol table of the ELF file of a core, the
+/// largest first. Return an empty list if the file cannot be read.
+std::vector<mlir_aie_function_range_t>
+mlir_aie_elf_functions(const char *elfPath);
+
+/// The profile of the functions the cores run: for each function, the cycles
+/// its core ran with the program counter in the code of the function, i.e.
+/// in the function itself and not in the functions it calls. A core has four
+/// program counter events and a range takes two of them, so at most two
+/// functions of each core are profiled in a run.
+class FunctionProfile {
+public:
+  FunctionProfile(aie_libxaie_ctx_t *ctx) : ctx(ctx), counters(ctx) {}
+
+  /// Profile the named functions of the ELF file elfPath the core of the
+  /// tile runs, or its two largest functions if none are named. Return false
+  /// if a function is not in the file or the core cannot count them all.
+  bool addCore(u32 col, u32 row, const char *elfPath,
+               const std::vector<std::string> &functions = {});
+
+  /// Start the counters, before the cores start.
+  void start() { counters.start(); }
+  /// Stop them, once the cores are done.
+  void stop() { counters.stop(); }
+
+  /// Print the cycles of each core and the share of them in its functions.
+  void report(FILE *file, const char *name) const;
+  /// Write the same as a single line of JSON.
+  void writeJSON(FILE *file, const char *name) const;
+
+private:
+  struct Function {
+    mlir_aie_function_range_t range;
+    int cycles;
+  };
+  struct Core {
+    std::string name;
+    int cycles;
+    std::vector<Function> functions;
+  };
+  aie_libxaie_ctx_t *ctx;
+  PerfCounterSet counters;
+  std::vector<Core> cores;
+};
+
 /*
  ******************************************************************************
  * Common functions
@@ -115,11 +265,88 @@ aie_libxaie_ctx_t *mlir_aie_init_libxaie();
 void mlir_aie_deinit_libxaie(aie_libxaie_ctx_t *);
 
 int mlir_aie_init_device(aie_libxaie_ctx_t *ctx);
+int mlir_aie_init_device_tiles(aie_libxaie_ctx_t *ctx, XAie_LocType *tiles,
+                               u32 numTiles);
+int mlir_aie_init_device_partition(aie_libxaie_ctx_t *ctx, u32 startCol,
+                                   u32 numCols);
 
 int mlir_aie_acquire_lock(aie_libxaie_ctx_t *ctx, int col, int row, int lockid,
                           int lockval, int timeout);
 int mlir_aie_release_lock(aie_libxaie_ctx_t *ctx, int col, int row, int lockid,
                           int lockval, int timeout);
+/// A condition the host waits for in a completion queue: a lock to acquire
+/// with a value, or a DMA channel to finish its buffer descriptors.
+struct mlir_aie_completion_t {
+  enum { Lock, Dma } kind;
+  int col, row;
+  int id;    // The ID of the lock, or the channel of the DMA
+  int value; // The value to acquire the lock with, or the XAie_DmaDirection
+  void *tag; // Returned by mlir_aie_wait_completions once it completes
+};
+
+/// A set of conditions waited for together by a single host thread, which
+/// can then drive many independent tiles at once.
+struct mlir_aie_completion_queue_t {
+  aie_libxaie_ctx_t *ctx;
+  std::vector<mlir_aie_completion_t> pending;
+  // The file descriptor of mlir_aie_open_notifications the queue waits on
+  // between its polls, or -1 to poll on its own.
+  int notifyFd = -1;
+};
+
+/// @brief Create an empty completion queue for the given context.
+mlir_aie_completion_queue_t *
+mlir_aie_create_completion_queue(aie_libxaie_ctx_t *ctx);
+void mlir_aie_destroy_completion_queue(mlir_aie_completion_queue_t *queue);
+
+/// @brief Wait, in the queue, for a lock to be acquired with lockval. The lock
+/// is acquired when the wait completes.
+void mlir_aie_queue_lock_acquire(mlir_aie_completion_queue_t *queue, int col,
+                                 int row, int lockid, int lockval, void *tag);
+
+/// @brief Wait, in the queue, for a DMA channel to finish all its pending
+/// buffer descriptors.
+void mlir_aie_queue_dma_done(mlir_aie_completion_queue_t *queue, int col,
+                             int row, XAie_DmaDirection dir, int channel,
+                             void *tag);
+
+/// @brief Wait for at least one of the conditions of the queue to complete,
+/// and remove the completed ones from the queue.
+/// @param tags Filled with the tags of up to maxTags completed conditions.
+/// @param timeout The number of microseconds to wait, or -1 to wait forever.
+/// @return The number of tags filled, zero on timeout or if the queue is empty.
+int mlir_aie_wait_completions(mlir_aie_completion_queue_t *queue, void **tags,
+                              int maxTags, int timeout);
+
+/// @brief Broadcast an event of a module of a tile on the given broadcast
+/// channel to the interrupt controller of the shim tile of its column, which
+/// forwards it to the second-level interrupt controller of the shim NOC tile
+/// of column nocCol and the host. The mlir_aie_configure_notifications of
+/// aie_inc.cpp calls it for the events of the `notify` attributes of the
+/// tiles of the design. Return 0 on success.
+int mlir_aie_notify_event(aie_libxaie_ctx_t *ctx, int col, int row,
+                          XAie_ModuleType module, XAie_Events event,
+                          u8 broadcastId, int nocCol);
+
+/// @brief Open the UIO device the interrupt of the array is delivered to,
+/// e.g. "/dev/uio0", and enable it. The file descriptor is readable once a
+/// tile notified the host of an event, and can be waited on with poll or
+/// epoll along with the other ones of the host.
+/// @return The file descriptor, or -1 on failure.
+int mlir_aie_open_notifications(aie_libxaie_ctx_t *ctx, const char *device);
+
+/// @brief Wait up to timeout microseconds, or forever if -1, for a tile to
+/// notify the host on fd, then acknowledge the events and enable the
+/// interrupt again.
+/// @return 1 if notified, 0 on timeout and -1 on failure.
+int mlir_aie_wait_notifications(aie_libxaie_ctx_t *ctx, int fd, int timeout);
+
+/// @brief Make the queue wait on the fd of mlir_aie_open_notifications
+/// between its polls instead of sleeping. Every condition of the queue must
+/// then come with an event notifying the host, or those without rely on the
+/// timeout of mlir_aie_wait_completions.
+void mlir_aie_queue_notifications(mlir_aie_completion_queue_t *queue, int fd);
+
 u32 mlir_aie_read32(aie_libxaie_ctx_t *ctx, u64 addr);
 void mlir_aie_write32(aie_libxaie_ctx_t *ctx, u64 addr, u32 val);
 u32 mlir_aie_data_mem_rd_word(aie_libxaie_ctx_t *ctx, int col, int row,
@@ -127,8 +354,40 @@ u32 mlir_aie_data_mem_rd_word(aie_libxaie_ctx_t *ctx, int col, int row,
 void mlir_aie_data_mem_wr_word(aie_libxaie_ctx_t *ctx, int col, int row,
                                u64 addr, u32 data);
 
+/// Read or write a block of bytes of the data memory of a tile in one call,
+/// or fill words of it with a value, instead of a word at a time. Return 0
+/// on success.
+int mlir_aie_data_mem_read_block(aie_libxaie_ctx_t *ctx, int col, int row,
+                                 u64 addr, void *data, u32 bytes);
+int mlir_aie_data_mem_write_block(aie_libxaie_ctx_t *ctx, int col, int row,
+                                  u64 addr, const void *data, u32 bytes);
+int mlir_aie_data_mem_memset(aie_libxaie_ctx_t *ctx, int col, int row,
+                             u64 addr, u32 value, u32 words);
+
 u64 mlir_aie_get_tile_addr(aie_libxaie_ctx_t *ctx, int col, int row);
 
+/// Write the data of a section of an airbin configuration to the array,
+/// starting at the address of the section. The data of run-length encoded
+/// sections, generated with aie-translate --airbin-compress, is decoded.
+/// Return 0 on success, or -1 if the data is not well formed.
+int mlir_aie_write_airbin_section(aie_libxaie_ctx_t *ctx, u64 addr,
+                                  const u32 *data, size_t words, bool encoded);
+
+/// Move an address of an airbin section or a transaction buffer to the
+/// columns starting at colOffset. Their tiles are numbered from column 0, so
+/// that a design can be loaded at any column offset without recompiling it,
+/// as long as its columns are of the same kinds there.
+u64 mlir_aie_relocate_addr(aie_libxaie_ctx_t *ctx, u64 addr, int colOffset);
+
+/// Replay a transaction buffer generated by aie-translate --aie-generate-txn,
+/// issuing its writes in order. Return 0 on success, or -1 if the buffer is
+/// not well formed.
+int mlir_aie_replay_txn(aie_libxaie_ctx_t *ctx, const u32 *txn, size_t words);
+
+/// Replay a transaction buffer at the columns starting at colOffset.
+int mlir_aie_replay_txn_at(aie_libxaie_ctx_t *ctx, const u32 *txn,
+                           size_t words, int colOffset);
+
 /// Dump the contents of the memory associated with the given tile.
 void mlir_aie_dump_tile_memory(aie_libxaie_ctx_t *ctx, int col, int row);
 
@@ -147,12 +406,230 @@ void mlir_aie_print_shimdma_status(aie_libxaie_ctx_t *ctx, int col, int row);
 /// Print the status of a core represented by the given tile.
 void mlir_aie_print_tile_status(aie_libxaie_ctx_t *ctx, int col, int row);
 
+/// Configure the trace unit of a module of a tile to trace up to 8 events,
+/// e.g. the lock, stream and memory stalls of a core or the starts and ends
+/// of the buffer descriptors of a DMA, from startE to stopE, in packets of
+/// the given ID. The trace port of the module must be routed, e.g. by
+/// aie-opt --aie-route-trace, which picks the packet IDs. Return 0 on
+/// success.
+int mlir_aie_trace_tile(aie_libxaie_ctx_t *ctx, int col, int row,
+                        XAie_ModuleType module, u8 packetID,
+                        const XAie_Events *events, int numEvents,
+                        XAie_Events startE, XAie_Events stopE);
+
+/// Configure the S2MM channel of the shim DMA of column col to write the
+/// trace it receives to bytes bytes at the device address addr, with the
+/// buffer descriptor bd. aie-trace-decode.py turns the buffer into a
+/// timeline. Return 0 on success.
+int mlir_aie_trace_shim_dma(aie_libxaie_ctx_t *ctx, int col, int channel,
+                            u8 bd, u64 addr, u32 bytes);
+
+/// Play the control packet stream generated by aie-translate
+/// --aie-generate-ctrlpkt into the array from the MM2S channel of the shim
+/// DMA of column col, as routed by aie-route-control-packets. stream is the
+/// host copy of the words words of the stream, which the DMA reads at the
+/// device address addr, and the buffer descriptors bd to bd + 3 are used.
+/// Return 0 once all packets are queued, or -1 if the stream is not well
+/// formed or the queue of the channel stays full for timeout microseconds.
+/// mlir_aie_queue_dma_done waits for the last packets to be sent.
+int mlir_aie_send_ctrlpkts(aie_libxaie_ctx_t *ctx, int col, int channel,
+                           u8 bd, u64 addr, const u32 *stream, size_t words,
+                           int timeout);
+
+/// A stream of buffers between the host and a shim DMA channel, which
+/// rotates through several buffers of the device memory so that the host
+/// fills or reads some of them while the DMA moves the others. The buffer
+/// of the k-th transfer is buffers[k % buffers.size()], and the DMA moves
+/// the buffers in the order they are submitted.
+struct mlir_aie_stream_t {
+  aie_libxaie_ctx_t *ctx;
+  int col, channel;
+  XAie_DmaDirection dir;
+  u8 firstBD; // The buffer k is transferred by the buffer descriptor
+              // firstBD + k
+  size_t bytes;
+  std::vector<ext_mem_model_t *> buffers;
+  u64 submitted = 0; // The number of buffers queued to the channel
+  u64 completed = 0; // The number of them the channel is done with
+  u64 taken = 0;     // The number of buffers handed out to the host
+};
+
+/// @brief Create a stream over the S2MM or MM2S channel of the shim DMA of
+/// column col, which a flow of the design routes but whose buffer
+/// descriptors the design leaves to the host. The stream transfers bytes
+/// bytes of each of the buffers, allocated with mlir_aie_mem_alloc, with the
+/// buffer descriptors firstBD to firstBD + numBuffers - 1. The handles of the
+/// buffers must outlive the stream. As many buffers as the queue of the
+/// channel holds, 4, can be in flight. The buffers of an S2MM stream are
+/// queued at once.
+/// @return The stream, or NULL if its channel cannot be configured.
+mlir_aie_stream_t *mlir_aie_create_stream(aie_libxaie_ctx_t *ctx, int col,
+                                          int channel, XAie_DmaDirection dir,
+                                          u8 firstBD, ext_mem_model_t *buffers,
+                                          int numBuffers, size_t bytes);
+void mlir_aie_destroy_stream(mlir_aie_stream_t *stream);
+
+/// @brief Wait up to timeout microseconds, or forever if -1, for a buffer of
+/// an MM2S stream the DMA is done with, and hand it out to the host to fill.
+/// @return The host pointer of the buffer, or NULL on timeout.
+void *mlir_aie_stream_acquire(mlir_aie_stream_t *stream, int timeout);
+
+/// @brief Synchronize the first bytes bytes of the oldest buffer acquired
+/// from an MM2S stream to the device and queue them to the channel.
+/// Return 0 on success.
+int mlir_aie_stream_submit(mlir_aie_stream_t *stream, size_t bytes);
+
+/// @brief Wait up to timeout microseconds, or forever if -1, for the oldest
+/// buffer queued to an S2MM stream to be filled, and synchronize it to the
+/// host.
+/// @return The host pointer of the buffer, or NULL on timeout.
+void *mlir_aie_stream_receive(mlir_aie_stream_t *stream, int timeout);
+
+/// @brief Queue the oldest buffer received from an S2MM stream to the
+/// channel again. Return 0 on success.
+int mlir_aie_stream_release(mlir_aie_stream_t *stream);
+
+/// Called by mlir_aie_stream_pump with each buffer of a stream, of bytes
+/// bytes. It returns the number of bytes it filled in the buffer of an MM2S
+/// stream, or any number but 0 once it consumed the buffer of an S2MM
+/// stream, and 0 to stop the pump.
+typedef size_t (*mlir_aie_stream_callback_t)(void *buffer, size_t bytes,
+                                            void *user);
+
+/// @brief Hand the buffers of the stream to callback in turn, submitting or
+/// releasing each once callback returns, until callback returns 0 or no
+/// buffer comes within timeout microseconds, or forever if -1.
+/// @return The number of buffers callback filled or consumed before it
+/// returned 0 or the timeout, or -1 on failure.
+int mlir_aie_stream_pump(mlir_aie_stream_t *stream,
+                         mlir_aie_stream_callback_t callback, void *user,
+                         int timeout);
+
 /// Zero out the program and configuration memory of the tile.
 void mlir_aie_clear_config(aie_libxaie_ctx_t *ctx, int col, int row);
 
 /// Zero out the configuration memory of the shim tile.
 void mlir_aie_clear_shim_config(aie_libxaie_ctx_t *ctx, int col, int row);
 
+/// Reset all the tiles of the partition of the context and clear their
+/// memories. Return 0 on success.
+int mlir_aie_reset_partition(aie_libxaie_ctx_t *ctx);
+
+/// A design run by a scheduler, loaded from a transaction buffer generated by
+/// aie-translate --aie-generate-txn for a partition of numCols columns.
+struct mlir_aie_design_t {
+  const u32 *txn;
+  size_t words;
+  int numCols;
+};
+
+/// Called by a scheduler to run a job on the partition its design is loaded
+/// in. The tiles of ctx are numbered from the first column of the partition.
+/// It returns 0 on success.
+typedef int (*mlir_aie_job_callback_t)(aie_libxaie_ctx_t *ctx, void *user);
+
+/// A queue of jobs, each running a design on some input, which a scheduler
+/// runs at once on disjoint partitions of a range of columns. The partitions
+/// keep their design loaded once their jobs are done, so that the next jobs
+/// of the design skip its configuration.
+struct mlir_aie_scheduler_t {
+  struct Partition {
+    aie_libxaie_ctx_t *ctx;
+    int startCol, numCols;
+    int design;
+    bool busy;
+  };
+  struct Job {
+    int design;
+    mlir_aie_job_callback_t run;
+    void *user;
+  };
+  // Returns a new context for the device, e.g. the mlir_aie_init_libxaie of
+  // aie_inc.cpp.
+  aie_libxaie_ctx_t *(*initContext)();
+  int startCol, numCols;
+  std::vector<mlir_aie_design_t> designs;
+  std::vector<Partition> partitions;
+  std::deque<Job> jobs;
+  std::mutex mutex;
+  // Notified when a job is queued or done, so that the workers waiting for
+  // free columns try again.
+  std::condition_variable changed;
+  int running = 0;
+  // The utilization of the columns, since the scheduler was created.
+  u64 startTime;
+  u64 busyColumnTime = 0; // The sum of the microseconds each column ran a job
+  u64 jobsRun = 0, jobsFailed = 0;
+  u64 loads = 0; // The number of jobs which had to load their design
+};
+
+/// The utilization of the columns of a scheduler.
+struct mlir_aie_scheduler_stats_t {
+  u64 jobsRun, jobsFailed;
+  u64 loads, hits; // The jobs which loaded their design, or found it loaded
+  u64 elapsedTime, busyColumnTime;
+  double utilization; // The fraction of the column time spent running jobs
+};
+
+/// @brief Create a scheduler of the numCols columns from startCol, whose
+/// partitions are initialized from the contexts initContext returns.
+mlir_aie_scheduler_t *
+mlir_aie_create_scheduler(aie_libxaie_ctx_t *(*initContext)(), int startCol,
+                          int numCols);
+void mlir_aie_destroy_scheduler(mlir_aie_scheduler_t *scheduler);
+
+/// @brief Add a design to the scheduler. The transaction buffer must outlive
+/// the scheduler.
+/// @return The ID of the design, or -1 if it is not well formed or does not
+/// fit in the columns of the scheduler.
+int mlir_aie_scheduler_add_design(mlir_aie_scheduler_t *scheduler,
+                                  const u32 *txn, size_t words, int numCols);
+
+/// @brief Queue a job running the design with callback. It can be called
+/// from the callbacks of the jobs running. Return 0 on success, or -1 if the
+/// design is unknown.
+int mlir_aie_scheduler_submit(mlir_aie_scheduler_t *scheduler, int design,
+                              mlir_aie_job_callback_t run, void *user);
+
+/// @brief Run the jobs of the queue on numThreads threads, each job in the
+/// partition of an idle one of its design if any, and otherwise in the free
+/// columns whose partitions are idle the fewest of, whose designs are then
+/// unloaded. The first job of the queue which fits runs first.
+/// @return Once the queue is empty, the number of jobs which failed.
+int mlir_aie_scheduler_run(mlir_aie_scheduler_t *scheduler, int numThreads);
+
+/// @brief Get the utilization of the columns of the scheduler so far.
+void mlir_aie_scheduler_get_stats(mlir_aie_scheduler_t *scheduler,
+                                  mlir_aie_scheduler_stats_t *stats);
+
+/// Statistics of repeated measurements, e.g. the cycle counts of the
+/// iterations of a benchmark.
+struct mlir_aie_stats_t {
+  int n;        // The number of values kept
+  int outliers; // The number of values rejected as outliers
+  u64 min, max;
+  double mean, sdev;
+  u64 p50, p90, p99;
+};
+
+/// Compute the statistics of n values. If outlierSigma is positive, the
+/// values farther than outlierSigma standard deviations from the mean are
+/// rejected first. Return 0 on success, or -1 if no value is left.
+int mlir_aie_compute_stats(const u64 *values, int n, double outlierSigma,
+                           mlir_aie_stats_t *stats);
+
+/// Print a histogram of the n values over the given number of bins.
+void mlir_aie_print_histogram(const u64 *values, int n, int bins);
+
+/// Write the statistics as a JSON object named name, or as a CSV line under
+/// the header written by mlir_aie_write_stats_csv_header.
+void mlir_aie_write_stats_json(FILE *file, const char *name,
+                               const mlir_aie_stats_t *stats);
+void mlir_aie_write_stats_csv_header(FILE *file);
+void mlir_aie_write_stats_csv(FILE *file, const char *name,
+                              const mlir_aie_stats_t *stats);
+
+/// Print the mean and standard deviation of the n values.
 void computeStats(u32 performance_counter[], int n);
 
 } // extern "C"
@@ -0,0 +1,44 @@
+// RUN: aie-opt %s --convert-aievec-to-llvm | FileCheck %s
+module {
+  func.func @test(%v16i32 : vector<16xi32>, %v32i16 : vector<32xi16>,
+                  %v16i64 : vector<16xi64>, %v32bf16 : vector<32xbf16>,
+                  %v16f32 : vector<16xf32>, %i : i32) {
+    %0 = aievec.min %v16i32, %v16i32 : vector<16xi32>
+    %1 = aievec.max %v16i32, %v16i32 : vector<16xi32>
+    %2 = aievec.cmp %v16i32, %v16i32 {pred = "slt"} : vector<16xi32>, vector<16xi32>, ui32
+    %3 = aievec.sel %v16i32, %v16i32, %2 : vector<16xi32>, vector<16xi32>, ui32, vector<16xi32>
+    %4 = aievec.shift %v16i32, %v16i32, %i {isAcc = false} : vector<16xi32>, vector<16xi32>, i32, vector<16xi32>
+    %5 = aievec.shuffle %v16i32 {mode = 2 : i32} : vector<16xi32>, vector<16xi32>
+    %6 = aievec.mul_conv %v32i16, %v32i16 {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+    %7 = aievec.fma_conv %v32i16, %v32i16, %v16i64 {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+    %8 = aievec.mac_elem %v32bf16, %v32bf16, %v16f32 : vector<32xbf16>, vector<32xbf16>, vector<16xf32>
+    %9 = aievec.ext_elem %v16i32, %i : vector<16xi32>, i32, i32
+    %10 = aievec.cast %8 {isResAcc = false} : vector<16xf32>, vector<16xf32>
+    %11 = aievec.add_elem %10, %v16f32 : vector<16xf32>
+    return
+  }
+}
+
+// CHECK-LABEL: llvm.func @llvm.aie2.add.elem.v16f(vector<16xf32>, vector<16xf32>) -> vector<16xf32>
+// CHECK: llvm.func @llvm.aie2.vextract.elem.v16i32(vector<16xi32>, i32) -> i32
+// CHECK: llvm.func @llvm.aie2.mac.elem.v32f.v16float(vector<32xbf16>, vector<32xbf16>, vector<16xf32>) -> vector<16xf32>
+// CHECK: llvm.func @llvm.aie2.mac.conv.16x4.v32i16(vector<32xi16>, vector<32xi16>, vector<16xi64>) -> vector<16xi64>
+// CHECK: llvm.func @llvm.aie2.mul.conv.16x4.v32i16(vector<32xi16>, vector<32xi16>) -> vector<16xi64>
+// CHECK: llvm.func @llvm.aie2.vshuffle.v16i32(vector<16xi32>, i32) -> vector<16xi32>
+// CHECK: llvm.func @llvm.aie2.vshift.v16i32(vector<16xi32>, vector<16xi32>, i32) -> vector<16xi32>
+// CHECK: llvm.func @llvm.aie2.vsel.v16i32(vector<16xi32>, vector<16xi32>, i32) -> vector<16xi32>
+// CHECK: llvm.func @llvm.aie2.vslt.v16i32(vector<16xi32>, vector<16xi32>) -> i32
+// CHECK: llvm.func @llvm.aie2.vmax.v16i32(vector<16xi32>, vector<16xi32>) -> vector<16xi32>
+// CHECK: llvm.func @llvm.aie2.vmin.v16i32(vector<16xi32>, vector<16xi32>) -> vector<16xi32>
+// CHECK: %[[MIN:.*]] = llvm.call @llvm.aie2.vmin.v16i32(%{{.*}}, %{{.*}})
+// CHECK: %[[MAX:.*]] = llvm.call @llvm.aie2.vmax.v16i32(%{{.*}}, %{{.*}})
+// CHECK: %[[CMP:.*]] = llvm.call @llvm.aie2.vslt.v16i32(%{{.*}}, %{{.*}}) : (vector<16xi32>, vector<16xi32>) -> i32
+// CHECK: llvm.call @llvm.aie2.vsel.v16i32(%{{.*}}, %{{.*}}, %[[CMP]])
+// CHECK: llvm.call @llvm.aie2.vshift.v16i32
+// CHECK: %[[MODE:.*]] = llvm.mlir.constant(2 : i32) : i32
+// CHECK: llvm.call @llvm.aie2.vshuffle.v16i32(%{{.*}}, %[[MODE]])
+// CHECK: llvm.call @llvm.aie2.mul.conv.16x4.v32i16
+// CHECK: llvm.call @llvm.aie2.mac.conv.16x4.v32i16
+// CHECK: %[[MAC:.*]] = llvm.call @llvm.aie2.mac.elem.v32f.v16float
+// CHECK: llvm.call @llvm.aie2.vextract.elem.v16i32
+// CHECK: llvm.call @llvm.aie2.add.elem.v16f(%[[MAC]], %{{.*}})
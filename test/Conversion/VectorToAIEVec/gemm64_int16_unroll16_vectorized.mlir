@@ -46,9 +46,10 @@ func.func @matmul(%arg0: memref<?x64xi16>, %arg1: memref<?x64xi16>, %arg2: memre
       // CHECK: %[[ACC0:.*]] = aievec.upd %[[MC]][%[[I]], %[[J]]]
       // CHECK-SAME:                    {index = 0 : i8, offset = 0 : si32}
       // CHECK-SAME:                    : memref<?x64xi16>, vector<16xi16>
+      // CHECK: %[[ACCI:.*]] = aievec.ups %[[ACC0]] {shift = 0 : i8} : vector<16xi16>, vector<16xi48>
       %0 = vector.transfer_read %arg2[%arg3, %arg4], %c0_i16 : memref<?x64xi16>, vector<16xi16>
       // CHECK: %[[ACCn:.*]] = scf.for %[[K:.*]] = %[[C0]] to %[[C64]] step %[[C16]]
-      // CHECK-SAME:                   iter_args(%[[ACCk:.*]] = %[[ACC0]]) -> (vector<16xi16>) {
+      // CHECK-SAME:                   iter_args(%[[ACCk:.*]] = %[[ACCI]]) -> (vector<16xi48>) {
       %1 = affine.for %arg5 = 0 to 64 step 16 iter_args(%arg6 = %0) -> (vector<16xi16>) {
         // CHECK: %[[VA:.*]] = aievec.upd %[[MA]][%[[I]], %[[K]]]
         // CHECK-SAME:                  {index = 0 : i8, offset = 0 : si32}
@@ -56,7 +57,6 @@ func.func @matmul(%arg0: memref<?x64xi16>, %arg1: memref<?x64xi16>, %arg2: memre
         // CHECK: %[[VB0:.*]] = aievec.upd %[[MB]][%[[K]], %[[J]]]
         // CHECK-SAME:                  {index = 0 : i8, offset = 0 : si32}
         // CHECK-SAME:                  : memref<?x64xi16>, vector<16xi16>
-        // CHECK: %[[VC:.*]] = aievec.ups %[[ACCk]] {shift = 0 : i8} : vector<16xi16>, vector<16xi48>
         %2 = vector.transfer_read %arg0[%arg3, %arg5], %c0_i16 {permutation_map = #map} : memref<?x64xi16>, vector<16xi16>
         %3 = vector.transfer_read %arg1[%arg5, %arg4], %c0_i16 : memref<?x64xi16>, vector<16xi16>
         %4 = arith.muli %2, %3 : vector<16xi16>
@@ -66,7 +66,7 @@ func.func @matmul(%arg0: memref<?x64xi16>, %arg1: memref<?x64xi16>, %arg2: memre
         // CHECK-SAME:                  {index = 0 : i8, offset = 0 : si32}
         // CHECK-SAME:                  : memref<?x64xi16>, vector<16xi16>
         // CHECK: %[[VB01:.*]] = aievec.concat %[[VB0]], %[[VB1]] : vector<16xi16>, vector<32xi16>
-        // CHECK: %[[ACCk0:.*]] = aievec.mac %[[VB01]], %[[VA]], %[[VC]]
+        // CHECK: %[[ACCk0:.*]] = aievec.mac %[[VB01]], %[[VA]], %[[ACCk]]
         // CHECK-SAME:                       {xoffsets = "0x73727170", xoffsets_hi = "0x77767574", xsquare = "0x3120",
         // CHECK-SAME:                        xstart = "0", zoffsets = "0", zoffsets_hi = "0", zstart = "0", zstep = "1"}
         // CHECK-SAME:                       : vector<32xi16>, vector<16xi16>, vector<16xi48>
@@ -224,16 +224,16 @@ func.func @matmul(%arg0: memref<?x64xi16>, %arg1: memref<?x64xi16>, %arg2: memre
         // CHECK: %[[ACCk14:.*]] = aievec.mac %[[VBef]], %[[VA]], %[[ACCk12]]
         // CHECK-SAME:                       {xoffsets = "0x73727170", xoffsets_hi = "0x77767574", xsquare = "0x3120",
         // CHECK-SAME:                        xstart = "0", zoffsets = "0", zoffsets_hi = "0", zstart = "14", zstep = "1"}
-        // CHECK: %[[ACC:.*]] = aievec.srs %[[ACCk14]] {shift = 0 : i8} : vector<16xi48>, vector<16xi16>
         %76 = affine.apply #map15(%arg5)
         %77 = vector.transfer_read %arg0[%arg3, %76], %c0_i16 {permutation_map = #map} : memref<?x64xi16>, vector<16xi16>
         %78 = vector.transfer_read %arg1[%76, %arg4], %c0_i16 : memref<?x64xi16>, vector<16xi16>
         %79 = arith.muli %77, %78 : vector<16xi16>
         %80 = arith.addi %75, %79 : vector<16xi16>
-        // CHECK: scf.yield %[[ACC]] : vector<16xi16>
+        // CHECK: scf.yield %[[ACCk14]] : vector<16xi48>
         affine.yield %80 : vector<16xi16>
       }
-      // CHECK: vector.transfer_write %[[ACCn]], %[[MC]][%[[I]], %[[J]]] {in_bounds = [true]} : vector<16xi16>, memref<?x64xi16>
+      // CHECK: %[[ACC:.*]] = aievec.srs %[[ACCn]] {shift = 0 : i8} : vector<16xi48>, vector<16xi16>
+      // CHECK: vector.transfer_write %[[ACC]], %[[MC]][%[[I]], %[[J]]] {in_bounds = [true]} : vector<16xi16>, memref<?x64xi16>
       vector.transfer_write %1, %arg2[%arg3, %arg4] : vector<16xi16>, memref<?x64xi16>
     }
   }
@@ -0,0 +1,33 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | FileCheck %s
+
+// A block of an int8 convolution over 8 input channels and 8 filters, for 4
+// output positions: the input window is laid out as 1x4x8 (batch, position,
+// channel) and the filter taps as 8x8 (channel, filter).
+#map_in = affine_map<(n, w, f, c) -> (n, w, c)>
+#map_fil = affine_map<(n, w, f, c) -> (c, f)>
+#map_out = affine_map<(n, w, f, c) -> (n, w, f)>
+
+// CHECK-LABEL: func @conv_i8
+// CHECK: %[[IN:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<32xi8>, vector<32xi8>
+// CHECK: %[[FIL:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<64xi8>, vector<64xi8>
+// CHECK: %[[OUT:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<32xi32>, vector<32xi32>
+// CHECK: %[[ACC:.*]] = aievec.cast %[[OUT]] {isResAcc = true} : vector<32xi32>, vector<32xi32>
+// CHECK: %[[MM:.*]] = aievec.matmul %[[IN]], %[[FIL]], %[[ACC]] {K = 8 : i32, M = 4 : i32, N = 8 : i32} : vector<32xi8>, vector<64xi8> into vector<32xi32>
+// CHECK: %[[RES:.*]] = aievec.cast %[[MM]] {isResAcc = false} : vector<32xi32>, vector<32xi32>
+// CHECK: vector.transfer_write %[[RES]]
+func.func @conv_i8(%in : memref<1x4x8xi8>, %fil : memref<8x8xi8>, %out : memref<1x4x8xi32>) {
+  %c0 = arith.constant 0 : index
+  %c0_i8 = arith.constant 0 : i8
+  %c0_i32 = arith.constant 0 : i32
+  %0 = vector.transfer_read %in[%c0, %c0, %c0], %c0_i8 {in_bounds = [true, true, true]} : memref<1x4x8xi8>, vector<1x4x8xi8>
+  %1 = vector.transfer_read %fil[%c0, %c0], %c0_i8 {in_bounds = [true, true]} : memref<8x8xi8>, vector<8x8xi8>
+  %2 = vector.transfer_read %out[%c0, %c0, %c0], %c0_i32 {in_bounds = [true, true, true]} : memref<1x4x8xi32>, vector<1x4x8xi32>
+  %3 = arith.extsi %0 : vector<1x4x8xi8> to vector<1x4x8xi32>
+  %4 = arith.extsi %1 : vector<8x8xi8> to vector<8x8xi32>
+  %5 = vector.contract {indexing_maps = [#map_in, #map_fil, #map_out],
+                        iterator_types = ["parallel", "parallel", "parallel", "reduction"],
+                        kind = #vector.kind<add>} %3, %4, %2
+                        : vector<1x4x8xi32>, vector<8x8xi32> into vector<1x4x8xi32>
+  vector.transfer_write %5, %out[%c0, %c0, %c0] {in_bounds = [true, true, true]} : vector<1x4x8xi32>, memref<1x4x8xi32>
+  return
+}
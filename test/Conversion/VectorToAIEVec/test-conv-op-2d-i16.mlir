@@ -0,0 +1,81 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml shift=10" | FileCheck %s
+
+// A 2x5 filter: each row is split into a 4-tap convolution and a 1-tap
+// remainder whose other taps are zeroed.
+func.func @conv2d_2x5(%arg0: memref<18x288xi16>, %arg1: memref<16xi16>, %arg2: memref<16x256xi16>) {
+  %c0 = arith.constant 0 : index
+  %c2_i32 = arith.constant 2 : i32
+  %c4_i32 = arith.constant 4 : i32
+  %c6_i32 = arith.constant 6 : i32
+  %c8_i32 = arith.constant 8 : i32
+  affine.for %arg3 = 0 to 16 {
+    affine.for %arg4 = 0 to 256 step 16 {
+      %f = aievec.upd %arg1[%c0] {index = 0 : i8, offset = 0 : si32} : memref<16xi16>, vector<16xi16>
+      %row1 = affine.apply affine_map<(d0) -> (d0 + 1)>(%arg3)
+      %s0 = aievec.upd %arg0[%arg3, %arg4] {index = 0 : i8, offset = 0 : si32} : memref<18x288xi16>, vector<32xi16>
+      %s0b = aievec.ext %s0 {index = 0 : i8} : vector<32xi16>, vector<16xi16>
+      %s0t = aievec.ext %s0 {index = 1 : i8} : vector<32xi16>, vector<16xi16>
+      %b00 = aievec.broadcast %f {idx = 0 : i8} : vector<16xi16>, vector<16xi16>
+      %m00 = arith.muli %s0b, %b00 : vector<16xi16>
+      %x01 = aievec.shift %s0b, %s0t, %c2_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b01 = aievec.broadcast %f {idx = 1 : i8} : vector<16xi16>, vector<16xi16>
+      %m01 = arith.muli %x01, %b01 : vector<16xi16>
+      %a01 = arith.addi %m00, %m01 : vector<16xi16>
+      %x02 = aievec.shift %s0b, %s0t, %c4_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b02 = aievec.broadcast %f {idx = 2 : i8} : vector<16xi16>, vector<16xi16>
+      %m02 = arith.muli %x02, %b02 : vector<16xi16>
+      %a02 = arith.addi %a01, %m02 : vector<16xi16>
+      %x03 = aievec.shift %s0b, %s0t, %c6_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b03 = aievec.broadcast %f {idx = 3 : i8} : vector<16xi16>, vector<16xi16>
+      %m03 = arith.muli %x03, %b03 : vector<16xi16>
+      %a03 = arith.addi %a02, %m03 : vector<16xi16>
+      %x04 = aievec.shift %s0b, %s0t, %c8_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b04 = aievec.broadcast %f {idx = 4 : i8} : vector<16xi16>, vector<16xi16>
+      %m04 = arith.muli %x04, %b04 : vector<16xi16>
+      %a04 = arith.addi %a03, %m04 : vector<16xi16>
+      %s1 = aievec.upd %arg0[%row1, %arg4] {index = 0 : i8, offset = 0 : si32} : memref<18x288xi16>, vector<32xi16>
+      %s1b = aievec.ext %s1 {index = 0 : i8} : vector<32xi16>, vector<16xi16>
+      %s1t = aievec.ext %s1 {index = 1 : i8} : vector<32xi16>, vector<16xi16>
+      %b10 = aievec.broadcast %f {idx = 5 : i8} : vector<16xi16>, vector<16xi16>
+      %m10 = arith.muli %s1b, %b10 : vector<16xi16>
+      %a10 = arith.addi %a04, %m10 : vector<16xi16>
+      %x11 = aievec.shift %s1b, %s1t, %c2_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b11 = aievec.broadcast %f {idx = 6 : i8} : vector<16xi16>, vector<16xi16>
+      %m11 = arith.muli %x11, %b11 : vector<16xi16>
+      %a11 = arith.addi %a10, %m11 : vector<16xi16>
+      %x12 = aievec.shift %s1b, %s1t, %c4_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b12 = aievec.broadcast %f {idx = 7 : i8} : vector<16xi16>, vector<16xi16>
+      %m12 = arith.muli %x12, %b12 : vector<16xi16>
+      %a12 = arith.addi %a11, %m12 : vector<16xi16>
+      %x13 = aievec.shift %s1b, %s1t, %c6_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b13 = aievec.broadcast %f {idx = 8 : i8} : vector<16xi16>, vector<16xi16>
+      %m13 = arith.muli %x13, %b13 : vector<16xi16>
+      %a13 = arith.addi %a12, %m13 : vector<16xi16>
+      %x14 = aievec.shift %s1b, %s1t, %c8_i32 {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+      %b14 = aievec.broadcast %f {idx = 9 : i8} : vector<16xi16>, vector<16xi16>
+      %m14 = arith.muli %x14, %b14 : vector<16xi16>
+      %a14 = arith.addi %a13, %m14 : vector<16xi16>
+      vector.transfer_write %a14, %arg2[%arg3, %arg4] {in_bounds = [true]} : vector<16xi16>, memref<16x256xi16>
+    }
+  }
+  return
+}
+
+// CHECK-LABEL: func @conv2d_2x5
+//   CHECK-DAG:    %[[ZERO:.*]] = arith.constant dense<0> : vector<32xi16>
+//   CHECK-DAG:    %[[C2:.*]] = arith.constant 2 : i32
+//   CHECK-DAG:    %[[C62:.*]] = arith.constant 62 : i32
+//       CHECK:    %[[F:.*]] = aievec.concat %{{.*}}, %{{.*}} : vector<16xi16>, vector<32xi16>
+//       CHECK:    %[[F4:.*]] = aievec.shift %[[F]], %[[F]], %{{.*}} {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
+//       CHECK:    %[[Z4:.*]] = aievec.shift %[[ZERO]], %[[F4]], %[[C2]] {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
+//       CHECK:    %[[T4:.*]] = aievec.shift %[[Z4]], %[[ZERO]], %[[C62]] {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
+//       CHECK:    affine.for
+//       CHECK:      affine.for
+//       CHECK:        %[[S0:.*]] = aievec.upd %arg0[%{{.*}}, %{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<18x288xi16>, vector<32xi16>
+//       CHECK:        %[[ACC0:.*]] = aievec.mul_conv %[[S0]], %[[F]] {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+//       CHECK:        %[[S04:.*]] = aievec.shift %[[S0]], %[[S0]], %{{.*}} {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
+//       CHECK:        %[[ACC1:.*]] = aievec.fma_conv %[[S04]], %[[T4]], %[[ACC0]] {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+//       CHECK:        %[[ACC2:.*]] = aievec.fma_conv %{{.*}}, %{{.*}}, %[[ACC1]] {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+//       CHECK:        %[[ACC3:.*]] = aievec.fma_conv %{{.*}}, %{{.*}}, %[[ACC2]] {M = 16 : i32, N = 4 : i32} : vector<32xi16>, vector<32xi16>, vector<16xi64>
+//       CHECK:        %[[RES:.*]] = aievec.srs %[[ACC3]] {shift = 10 : i8} : vector<16xi64>, vector<16xi16>
+//       CHECK:        vector.transfer_write %[[RES]]
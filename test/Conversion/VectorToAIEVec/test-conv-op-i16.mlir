@@ -30,9 +30,14 @@ func.func @conv2d(%arg0: memref<18x288xi16>, %arg1: memref<9xi16>, %arg2: memref
 //  CHECK-SAME: %[[A0:[A-Za-z0-9]+]]: memref<18x288xi16>
 //  CHECK-SAME: %[[A1:[A-Za-z0-9]+]]: memref<9xi16>
 //  CHECK-SAME: %[[A2:[A-Za-z0-9]+]]: memref<16x256xi16>
-//       CHECK:    %[[C0:.*]] = arith.constant 0 : index
+//   CHECK-DAG:    %[[C0:.*]] = arith.constant 0 : index
+//   CHECK-DAG:    %[[ZERO:.*]] = arith.constant dense<0> : vector<32xi16>
+//   CHECK-DAG:    %[[C6:.*]] = arith.constant 6 : i32
+//   CHECK-DAG:    %[[C58:.*]] = arith.constant 58 : i32
 //       CHECK:    %[[T0:.*]] = aievec.upd %[[A1]][%[[C0]]] {index = 0 : i8, offset = 0 : si32} : memref<9xi16>, vector<16xi16>
-//       CHECK:    %[[T1:.*]] = aievec.concat %[[T0]], %[[T0]] : vector<16xi16>, vector<32xi16>
+//       CHECK:    %[[C:.*]] = aievec.concat %[[T0]], %[[T0]] : vector<16xi16>, vector<32xi16>
+//       CHECK:    %[[S:.*]] = aievec.shift %[[ZERO]], %[[C]], %[[C6]] {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
+//       CHECK:    %[[T1:.*]] = aievec.shift %[[S]], %[[ZERO]], %[[C58]] {isAcc = false} : vector<32xi16>, vector<32xi16>, i32, vector<32xi16>
 //       CHECK:    affine.for %[[A3:.*]] = 0 to 16 {
 //       CHECK:      affine.for %[[A4:.*]] = 0 to 256 step 16 {
 //       CHECK:        %[[T2:.*]] = aievec.upd %[[A0]][%[[A3]], %[[A4]]] {index = 0 : i8, offset = 0 : si32} : memref<18x288xi16>, vector<32xi16>
@@ -32,10 +32,15 @@ func.func @conv2d(%arg0: memref<18x288xi8>, %arg1: memref<48xi8>, %arg2: memref<
 //  CHECK-SAME: %[[A0:[A-Za-z0-9]+]]: memref<18x288xi8>
 //  CHECK-SAME: %[[A1:[A-Za-z0-9]+]]: memref<48xi8>
 //  CHECK-SAME: %[[A2:[A-Za-z0-9]+]]: memref<16x256xi8>
-//       CHECK:    %[[C0:.*]] = arith.constant 0 : index
+//   CHECK-DAG:    %[[C0:.*]] = arith.constant 0 : index
+//   CHECK-DAG:    %[[ZERO:.*]] = arith.constant dense<0> : vector<64xi8>
+//   CHECK-DAG:    %[[C3:.*]] = arith.constant 3 : i32
+//   CHECK-DAG:    %[[C61:.*]] = arith.constant 61 : i32
 //       CHECK:    %[[T0:.*]] = aievec.upd %[[A1]][%[[C0]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<32xi8>
 //       CHECK:    %[[T1:.*]] = aievec.concat %[[T0]], %[[T0]] : vector<32xi8>, vector<64xi8>
-//       CHECK:    %[[T2:.*]] = aievec.shuffle %[[T1]] {mode = 0 : i32} : vector<64xi8>, vector<64xi8>
+//       CHECK:    %[[P:.*]] = aievec.shuffle %[[T1]] {mode = 0 : i32} : vector<64xi8>, vector<64xi8>
+//       CHECK:    %[[S:.*]] = aievec.shift %[[ZERO]], %[[P]], %[[C3]] {isAcc = false} : vector<64xi8>, vector<64xi8>, i32, vector<64xi8>
+//       CHECK:    %[[T2:.*]] = aievec.shift %[[S]], %[[ZERO]], %[[C61]] {isAcc = false} : vector<64xi8>, vector<64xi8>, i32, vector<64xi8>
 //       CHECK:    affine.for %[[I:.*]] = 0 to 16 {
 //       CHECK:      affine.for %[[J:.*]] = 0 to 256 step 32 {
 //       CHECK:        %[[T3:.*]] = aievec.upd %[[A2]][%[[I]], %[[J]]] {index = 0 : i8, offset = 0 : si32} : memref<16x256xi8>, vector<32xi8>
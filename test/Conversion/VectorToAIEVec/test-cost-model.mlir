@@ -0,0 +1,32 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | FileCheck %s
+// RUN: echo '{"aievec.mac_elem": {"latency": 4, "issue": 3}}' > %t.json
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml cost-model=%t.json" | FileCheck %s --check-prefix=CHECK-SPLIT
+// RUN: echo '{"aievec.mac_elem": {"latency": 4}}' > %t.bad.json
+// RUN: not aie-opt %s --convert-vector-to-aievec="aie-target=aieml cost-model=%t.bad.json" 2>&1 | FileCheck %s --check-prefix=CHECK-ERR
+
+// CHECK-ERR: cost of 'aievec.mac_elem' in cost model '{{.*}}' needs a non-negative "latency" and "issue"
+
+// CHECK-LABEL: func @muladd
+// CHECK-SAME: %[[A:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK-SAME: %[[B:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK-SAME: %[[C:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK: %[[UPS:.*]] = aievec.ups %[[C]] {shift = 0 : i8} : vector<16xi32>, vector<16xi64>
+// CHECK: %[[ME:.*]] = aievec.mac_elem %[[A]], %[[B]], %[[UPS]] : vector<16xi32>, vector<16xi32>, vector<16xi64>
+// CHECK: %[[RES:.*]] = aievec.srs %[[ME]] {shift = 0 : i8} : vector<16xi64>, vector<16xi32>
+// CHECK: return %[[RES]] : vector<16xi32>
+
+// CHECK-SPLIT-LABEL: func @muladd
+// CHECK-SPLIT-SAME: %[[A:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK-SPLIT-SAME: %[[B:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK-SPLIT-SAME: %[[C:[A-Za-z0-9]+]]: vector<16xi32>
+// CHECK-SPLIT-NOT: aievec.mac_elem
+// CHECK-SPLIT: %[[ME:.*]] = aievec.mul_elem %[[A]], %[[B]] : vector<16xi32>, vector<16xi32>, vector<16xi64>
+// CHECK-SPLIT: %[[SRS:.*]] = aievec.srs %[[ME]] {shift = 0 : i8} : vector<16xi64>, vector<16xi32>
+// CHECK-SPLIT: %[[RES:.*]] = aievec.add_elem %[[SRS]], %[[C]] : vector<16xi32>
+// CHECK-SPLIT: return %[[RES]] : vector<16xi32>
+func.func @muladd(%a : vector<16xi32>, %b : vector<16xi32>,
+                  %c : vector<16xi32>) -> vector<16xi32> {
+  %0 = arith.muli %a, %b : vector<16xi32>
+  %1 = arith.addi %0, %c : vector<16xi32>
+  return %1 : vector<16xi32>
+}
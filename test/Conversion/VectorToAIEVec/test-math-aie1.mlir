@@ -0,0 +1,85 @@
+// RUN: aie-opt %s --convert-vector-to-aievec | FileCheck %s
+
+// CHECK: emitc.include "vec_math.h"
+
+// CHECK-LABEL: func @vecrsqrt_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vecrsqrt_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getRsqrtFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = math.rsqrt %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// CHECK-LABEL: func @vecsqrt_f32
+// CHECK-SAME: %[[A:.*]]: vector<16xf32>
+func.func @vecsqrt_f32(%arg0: vector<16xf32>) -> vector<16xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getSqrtFloat"(%[[A]]) : (vector<16xf32>) -> vector<16xf32>
+  %0 = math.sqrt %arg0 : vector<16xf32>
+  // CHECK: return %[[RES]] : vector<16xf32>
+  return %0 : vector<16xf32>
+}
+
+// CHECK-LABEL: func @vecexp_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vecexp_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getExpFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = math.exp %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// CHECK-LABEL: func @vectanh_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vectanh_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getTanhFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = math.tanh %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// CHECK-LABEL: func @vecerf_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vecerf_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getErfFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = math.erf %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// CHECK-LABEL: func @vecsin_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vecsin_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getSinFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = math.sin %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// CHECK-LABEL: func @veccos_f32
+// CHECK-SAME: %[[A:.*]]: vector<16xf32>
+func.func @veccos_f32(%arg0: vector<16xf32>) -> vector<16xf32> {
+  // CHECK: %[[RES:.*]] = emitc.call "getCosFloat"(%[[A]]) : (vector<16xf32>) -> vector<16xf32>
+  %0 = math.cos %arg0 : vector<16xf32>
+  // CHECK: return %[[RES]] : vector<16xf32>
+  return %0 : vector<16xf32>
+}
+
+// CHECK-LABEL: func @vecinv_f32
+// CHECK-SAME: %[[A:.*]]: vector<8xf32>
+func.func @vecinv_f32(%arg0: vector<8xf32>) -> vector<8xf32> {
+  %cst = arith.constant dense<1.000000e+00> : vector<8xf32>
+  // CHECK: %[[RES:.*]] = emitc.call "getInvFloat"(%[[A]]) : (vector<8xf32>) -> vector<8xf32>
+  %0 = arith.divf %cst, %arg0 : vector<8xf32>
+  // CHECK: return %[[RES]] : vector<8xf32>
+  return %0 : vector<8xf32>
+}
+
+// The vector unit of AIE1 has no f64, the math ops on them are left as they
+// are.
+// CHECK-LABEL: func @vecexp_f64
+func.func @vecexp_f64(%arg0: vector<4xf64>) -> vector<4xf64> {
+  // CHECK: math.exp %{{.*}} : vector<4xf64>
+  %0 = math.exp %arg0 : vector<4xf64>
+  return %0 : vector<4xf64>
+}
@@ -0,0 +1,69 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | FileCheck %s
+
+// CHECK-DAG: emitc.include "lut_based_ops.h"
+// CHECK-DAG: emitc.include "vec_math.h"
+
+// CHECK-LABEL: func @veclog_bf16
+// CHECK-SAME: %[[A:.*]]: vector<16xbf16>
+func.func @veclog_bf16(%arg0: vector<16xbf16>) -> vector<16xbf16> {
+  // CHECK: %[[RES:.*]] = emitc.call "getLogBf16"(%[[A]]) : (vector<16xbf16>) -> vector<16xbf16>
+  %0 = math.log %arg0 : vector<16xbf16>
+  // CHECK: return %[[RES]] : vector<16xbf16>
+  return %0 : vector<16xbf16>
+}
+
+// CHECK-LABEL: func @vecsin_bf16
+// CHECK-SAME: %[[A:.*]]: vector<32xbf16>
+func.func @vecsin_bf16(%arg0: vector<32xbf16>) -> vector<32xbf16> {
+  // CHECK: %[[RES:.*]] = emitc.call "getSinBf16"(%[[A]]) : (vector<32xbf16>) -> vector<32xbf16>
+  %0 = math.sin %arg0 : vector<32xbf16>
+  // CHECK: return %[[RES]] : vector<32xbf16>
+  return %0 : vector<32xbf16>
+}
+
+// CHECK-LABEL: func @veccos_bf16
+// CHECK-SAME: %[[A:.*]]: vector<16xbf16>
+func.func @veccos_bf16(%arg0: vector<16xbf16>) -> vector<16xbf16> {
+  // CHECK: %[[RES:.*]] = emitc.call "getCosBf16"(%[[A]]) : (vector<16xbf16>) -> vector<16xbf16>
+  %0 = math.cos %arg0 : vector<16xbf16>
+  // CHECK: return %[[RES]] : vector<16xbf16>
+  return %0 : vector<16xbf16>
+}
+
+// CHECK-LABEL: func @veclog_f32
+func.func @veclog_f32(%arg0: vector<16xf32>) -> vector<16xf32> {
+  // CHECK: math.log %{{.*}} : vector<16xf32>
+  %0 = math.log %arg0 : vector<16xf32>
+  return %0 : vector<16xf32>
+}
+
+// CHECK-LABEL: func @vecsigmoid_bf16
+func.func @vecsigmoid_bf16(%arg0: vector<16xbf16>) -> vector<16xbf16> {
+  // CHECK-NOT: math.exp
+  // CHECK-NOT: arith.divf
+  // CHECK: emitc.call "getTanhBf16"
+  // CHECK-NOT: arith.divf
+  %cst = arith.constant dense<1.000000e+00> : vector<16xbf16>
+  %0 = arith.negf %arg0 : vector<16xbf16>
+  %1 = math.exp %0 : vector<16xbf16>
+  %2 = arith.addf %1, %cst : vector<16xbf16>
+  %3 = arith.divf %cst, %2 : vector<16xbf16>
+  return %3 : vector<16xbf16>
+}
+
+// CHECK-LABEL: func @vecinv_bf16
+// CHECK-SAME: %[[A:.*]]: vector<32xbf16>
+func.func @vecinv_bf16(%arg0: vector<32xbf16>) -> vector<32xbf16> {
+  // CHECK: %[[RES:.*]] = emitc.call "getInvBf16"(%[[A]]) : (vector<32xbf16>) -> vector<32xbf16>
+  %cst = arith.constant dense<1.000000e+00> : vector<32xbf16>
+  %0 = arith.divf %cst, %arg0 : vector<32xbf16>
+  // CHECK: return %[[RES]] : vector<32xbf16>
+  return %0 : vector<32xbf16>
+}
+
+// CHECK-LABEL: func @vecdiv_bf16
+func.func @vecdiv_bf16(%arg0: vector<16xbf16>, %arg1: vector<16xbf16>) -> vector<16xbf16> {
+  // CHECK: arith.divf
+  %0 = arith.divf %arg0, %arg1 : vector<16xbf16>
+  return %0 : vector<16xbf16>
+}
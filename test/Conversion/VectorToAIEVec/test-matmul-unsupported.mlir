@@ -0,0 +1,29 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | FileCheck %s
+
+// Only row-major operands with the shape of an MMUL instruction are lowered.
+
+// CHECK-LABEL: func @matmul_i16_transposed
+// CHECK-NOT: aievec.matmul
+// CHECK: vector.contract
+func.func @matmul_i16_transposed(%a : vector<4x4xi16>, %b : vector<4x4xi16>, %c : vector<4x4xi64>) -> vector<4x4xi64> {
+  %0 = vector.contract {indexing_maps = [affine_map<(m, n, k) -> (m, k)>,
+                                         affine_map<(m, n, k) -> (n, k)>,
+                                         affine_map<(m, n, k) -> (m, n)>],
+                        iterator_types = ["parallel", "parallel", "reduction"],
+                        kind = #vector.kind<add>} %a, %b, %c
+                        : vector<4x4xi16>, vector<4x4xi16> into vector<4x4xi64>
+  return %0 : vector<4x4xi64>
+}
+
+// CHECK-LABEL: func @matmul_i8_8x8x8
+// CHECK-NOT: aievec.matmul
+// CHECK: vector.contract
+func.func @matmul_i8_8x8x8(%a : vector<8x8xi8>, %b : vector<8x8xi8>, %c : vector<8x8xi32>) -> vector<8x8xi32> {
+  %0 = vector.contract {indexing_maps = [affine_map<(m, n, k) -> (m, k)>,
+                                         affine_map<(m, n, k) -> (k, n)>,
+                                         affine_map<(m, n, k) -> (m, n)>],
+                        iterator_types = ["parallel", "parallel", "reduction"],
+                        kind = #vector.kind<add>} %a, %b, %c
+                        : vector<8x8xi8>, vector<8x8xi8> into vector<8x8xi32>
+  return %0 : vector<8x8xi32>
+}
@@ -0,0 +1,53 @@
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | FileCheck %s
+// RUN: aie-opt %s --convert-vector-to-aievec="aie-target=aieml" | aie-translate -aieml=true --aievec-to-cpp | FileCheck %s --check-prefix=CPP
+
+#map_a = affine_map<(m, n, k) -> (m, k)>
+#map_b = affine_map<(m, n, k) -> (k, n)>
+#map_c = affine_map<(m, n, k) -> (m, n)>
+
+// CHECK-LABEL: func @matmul_i8
+// CHECK: %[[A:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<32xi8>, vector<32xi8>
+// CHECK: %[[B:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<64xi8>, vector<64xi8>
+// CHECK: %[[C:.*]] = aievec.upd %{{.*}}[%{{.*}}] {index = 0 : i8, offset = 0 : si32} : memref<32xi32>, vector<32xi32>
+// CHECK: %[[ACC:.*]] = aievec.cast %[[C]] {isResAcc = true} : vector<32xi32>, vector<32xi32>
+// CHECK: %[[MM:.*]] = aievec.matmul %[[A]], %[[B]], %[[ACC]] {K = 8 : i32, M = 4 : i32, N = 8 : i32} : vector<32xi8>, vector<64xi8> into vector<32xi32>
+// CHECK: %[[RES:.*]] = aievec.cast %[[MM]] {isResAcc = false} : vector<32xi32>, vector<32xi32>
+// CHECK: vector.transfer_write %[[RES]]
+// CPP-LABEL: void matmul_i8
+// CPP: v32acc32 [[ACC:[a-z0-9_]+]] = v32acc32(
+// CPP: [[ACC]] = mac_4x8_8x8({{.*}}, {{.*}}, [[ACC]]);
+func.func @matmul_i8(%a : memref<4x8xi8>, %b : memref<8x8xi8>, %c : memref<4x8xi32>) {
+  %c0 = arith.constant 0 : index
+  %c0_i8 = arith.constant 0 : i8
+  %c0_i32 = arith.constant 0 : i32
+  %0 = vector.transfer_read %a[%c0, %c0], %c0_i8 {in_bounds = [true, true]} : memref<4x8xi8>, vector<4x8xi8>
+  %1 = vector.transfer_read %b[%c0, %c0], %c0_i8 {in_bounds = [true, true]} : memref<8x8xi8>, vector<8x8xi8>
+  %2 = vector.transfer_read %c[%c0, %c0], %c0_i32 {in_bounds = [true, true]} : memref<4x8xi32>, vector<4x8xi32>
+  %3 = arith.extsi %0 : vector<4x8xi8> to vector<4x8xi32>
+  %4 = arith.extsi %1 : vector<8x8xi8> to vector<8x8xi32>
+  %5 = vector.contract {indexing_maps = [#map_a, #map_b, #map_c],
+                        iterator_types = ["parallel", "parallel", "reduction"],
+                        kind = #vector.kind<add>} %3, %4, %2
+                        : vector<4x8xi32>, vector<8x8xi32> into vector<4x8xi32>
+  vector.transfer_write %5, %c[%c0, %c0] {in_bounds = [true, true]} : vector<4x8xi32>, memref<4x8xi32>
+  return
+}
+
+// CHECK-LABEL: func @matmul_bf16
+// CHECK: aievec.matmul %{{.*}}, %{{.*}}, %{{.*}} {K = 8 : i32, M = 4 : i32, N = 4 : i32} : vector<32xbf16>, vector<32xbf16> into vector<16xf32>
+// CPP-LABEL: void matmul_bf16
+// CPP: = mac_4x8_8x4(
+func.func @matmul_bf16(%a : memref<4x8xbf16>, %b : memref<8x4xbf16>, %c : memref<4x4xf32>) {
+  %c0 = arith.constant 0 : index
+  %cst = arith.constant 0.0 : bf16
+  %cst_f32 = arith.constant 0.0 : f32
+  %0 = vector.transfer_read %a[%c0, %c0], %cst {in_bounds = [true, true]} : memref<4x8xbf16>, vector<4x8xbf16>
+  %1 = vector.transfer_read %b[%c0, %c0], %cst {in_bounds = [true, true]} : memref<8x4xbf16>, vector<8x4xbf16>
+  %2 = vector.transfer_read %c[%c0, %c0], %cst_f32 {in_bounds = [true, true]} : memref<4x4xf32>, vector<4x4xf32>
+  %3 = vector.contract {indexing_maps = [#map_a, #map_b, #map_c],
+                        iterator_types = ["parallel", "parallel", "reduction"],
+                        kind = #vector.kind<add>} %0, %1, %2
+                        : vector<4x8xbf16>, vector<8x4xbf16> into vector<4x4xf32>
+  vector.transfer_write %3, %c[%c0, %c0] {in_bounds = [true, true]} : vector<4x4xf32>, memref<4x4xf32>
+  return
+}
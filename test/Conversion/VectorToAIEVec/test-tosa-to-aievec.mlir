@@ -0,0 +1,18 @@
+// RUN: aie-opt %s --tosa-to-aievec="aie-target=aieml vector-size=16" | FileCheck %s
+
+// The add, and the sub of the broadcast scalar, are fused in a single loop
+// which reads the inputs and writes the output once.
+
+// CHECK-LABEL: func.func @dut
+// CHECK-NOT:     memref.alloc
+// CHECK:         scf.for
+// CHECK:           aievec.add_elem
+// CHECK-NOT:       vector.transfer_write
+// CHECK:           aievec.sub_elem
+// CHECK:           vector.transfer_write
+// CHECK-NOT:     scf.for
+func.func @dut(%arg0: tensor<1024xi32>, %arg1: tensor<1024xi32>, %arg2: tensor<1xi32>) -> (tensor<1024xi32>) {
+  %0 = "tosa.add"(%arg0, %arg1) : (tensor<1024xi32>, tensor<1024xi32>) -> (tensor<1024xi32>)
+  %1 = "tosa.sub"(%0, %arg2) : (tensor<1024xi32>, tensor<1xi32>) -> (tensor<1024xi32>)
+  return %1 : tensor<1024xi32>
+}
@@ -31,3 +31,53 @@ func.func @test_mac_elem_inv(%a : vector<16xi32>,
     // CHECK: return %[[RES:.*]] : vector<16xi32>
     return %1 : vector<16xi32>
 }
+
+// CHECK-LABEL: func @test_mac_elem_bf16
+// CHECK-SAME: %[[A:[A-Za-z0-9]+]]: vector<16xbf16>
+// CHECK-SAME: %[[B:[A-Za-z0-9]+]]: vector<16xbf16>
+// CHECK-SAME: %[[C:[A-Za-z0-9]+]]: vector<16xbf16>
+func.func @test_mac_elem_bf16(%a : vector<16xbf16>,
+                              %b : vector<16xbf16>,
+                              %c : vector<16xbf16>) -> vector<16xbf16> {
+    // CHECK-DAG: %[[CA:.*]] = aievec.concat %[[A]], %[[Z:.*]] : vector<16xbf16>, vector<32xbf16>
+    // CHECK-DAG: %[[CB:.*]] = aievec.concat %[[B]], %[[Z]] : vector<16xbf16>, vector<32xbf16>
+    // CHECK-DAG: %[[UPS:.*]] = aievec.ups %[[C]] {shift = 0 : i8} : vector<16xbf16>, vector<16xf32>
+    // CHECK: %[[ME:.*]] = aievec.mac_elem %[[CA]], %[[CB]], %[[UPS]] : vector<32xbf16>, vector<32xbf16>, vector<16xf32>
+    // CHECK: %[[RES:.*]] = aievec.srs %[[ME]] {shift = 0 : i8} : vector<16xf32>, vector<16xbf16>
+    %0 = arith.mulf %a, %b : vector<16xbf16>
+    %1 = arith.addf %c, %0 : vector<16xbf16>
+    // CHECK: return %[[RES]] : vector<16xbf16>
+    return %1 : vector<16xbf16>
+}
+
+// CHECK-LABEL: func @test_mac_elem_bf16_f32
+// CHECK-SAME: %[[A:[A-Za-z0-9]+]]: vector<16xbf16>
+// CHECK-SAME: %[[B:[A-Za-z0-9]+]]: vector<16xbf16>
+// CHECK-SAME: %[[C:[A-Za-z0-9]+]]: vector<16xf32>
+func.func @test_mac_elem_bf16_f32(%a : vector<16xbf16>,
+                                  %b : vector<16xbf16>,
+                                  %c : vector<16xf32>) -> vector<16xf32> {
+    // CHECK-DAG: %[[CA:.*]] = aievec.concat %[[A]], %[[Z:.*]] : vector<16xbf16>, vector<32xbf16>
+    // CHECK-DAG: %[[CB:.*]] = aievec.concat %[[B]], %[[Z]] : vector<16xbf16>, vector<32xbf16>
+    // CHECK-DAG: %[[ACC:.*]] = aievec.cast %[[C]] {isResAcc = true} : vector<16xf32>, vector<16xf32>
+    // CHECK: %[[ME:.*]] = aievec.mac_elem %[[CA]], %[[CB]], %[[ACC]] : vector<32xbf16>, vector<32xbf16>, vector<16xf32>
+    // CHECK: %[[RES:.*]] = aievec.cast %[[ME]] {isResAcc = false} : vector<16xf32>, vector<16xf32>
+    %0 = arith.extf %a : vector<16xbf16> to vector<16xf32>
+    %1 = arith.extf %b : vector<16xbf16> to vector<16xf32>
+    %2 = vector.fma %0, %1, %c : vector<16xf32>
+    // CHECK: return %[[RES]] : vector<16xf32>
+    return %2 : vector<16xf32>
+}
+
+// CHECK-LABEL: func @test_bf16_f32_conversions
+// CHECK-SAME: %[[A:[A-Za-z0-9]+]]: vector<16xbf16>
+func.func @test_bf16_f32_conversions(%a : vector<16xbf16>) -> vector<16xbf16> {
+    // CHECK: %[[UPS:.*]] = aievec.ups %[[A]] {shift = 0 : i8} : vector<16xbf16>, vector<16xf32>
+    // CHECK: %[[EXT:.*]] = aievec.cast %[[UPS]] {isResAcc = false} : vector<16xf32>, vector<16xf32>
+    // CHECK: %[[ACC:.*]] = aievec.cast %[[EXT]] {isResAcc = true} : vector<16xf32>, vector<16xf32>
+    // CHECK: %[[RES:.*]] = aievec.srs %[[ACC]] {shift = 0 : i8} : vector<16xf32>, vector<16xbf16>
+    %0 = arith.extf %a : vector<16xbf16> to vector<16xf32>
+    %1 = arith.truncf %0 : vector<16xf32> to vector<16xbf16>
+    // CHECK: return %[[RES]] : vector<16xbf16>
+    return %1 : vector<16xbf16>
+}
@@ -8,17 +8,44 @@ func.func @unaligned_read(%a: memref<48xi8>) -> (vector<32xi8>, vector<32xi8>) {
    return %0, %1 : vector<32xi8>, vector<32xi8>
 }
 
+// The three vectors covering both reads are loaded once, the one in the middle
+// is shared by both shifts.
 // CHECK-LABEL: func @unaligned_read
 //   CHECK-DAG:    %[[C2i32:.*]] = arith.constant 2 : i32
+//   CHECK-DAG:    %[[C64:.*]] = arith.constant 64 : index
 //   CHECK-DAG:    %[[C32:.*]] = arith.constant 32 : index
 //   CHECK-DAG:    %[[C16i32:.*]] = arith.constant 16 : i32
 //   CHECK-DAG:    %[[C0:.*]] = arith.constant 0 : index
-//       CHECK:    %[[T0:.*]] = aievec.upd {{.*}}[%[[C0:.*]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<64xi8>
-//       CHECK:    %[[T0E0:.*]] = aievec.ext %[[T0]] {index = 0 : i8} : vector<64xi8>, vector<32xi8>
-//       CHECK:    %[[T0E1:.*]] = aievec.ext %[[T0]] {index = 1 : i8} : vector<64xi8>, vector<32xi8>
-//       CHECK:    %[[R0:.*]] = aievec.shift %[[T0E0]], %[[T0E1]], %[[C16i32]] {isAcc = false} : vector<32xi8>, vector<32xi8>, i32, vector<32xi8>
-//       CHECK:    %[[T1:.*]] = aievec.upd {{.*}}[%[[C32:.*]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<64xi8>
-//       CHECK:    %[[T1E0:.*]] = aievec.ext %[[T1]] {index = 0 : i8} : vector<64xi8>, vector<32xi8>
-//       CHECK:    %[[T1E1:.*]] = aievec.ext %[[T1]] {index = 1 : i8} : vector<64xi8>, vector<32xi8>
-//       CHECK:    %[[R1:.*]] = aievec.shift %[[T1E0]], %[[T1E1]], %[[C2i32]] {isAcc = false} : vector<32xi8>, vector<32xi8>, i32, vector<32xi8>
-//       CHECK:    return %[[R0:.*]], %[[R1:.*]] : vector<32xi8>, vector<32xi8>
+//       CHECK:    %[[T0:.*]] = aievec.upd {{.*}}[%[[C0]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<32xi8>
+//       CHECK:    %[[T1:.*]] = aievec.upd {{.*}}[%[[C32]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<32xi8>
+//       CHECK:    %[[R0:.*]] = aievec.shift %[[T0]], %[[T1]], %[[C16i32]] {isAcc = false} : vector<32xi8>, vector<32xi8>, i32, vector<32xi8>
+//       CHECK:    %[[T2:.*]] = aievec.upd {{.*}}[%[[C64]]] {index = 0 : i8, offset = 0 : si32} : memref<48xi8>, vector<32xi8>
+//       CHECK:    %[[R1:.*]] = aievec.shift %[[T1]], %[[T2]], %[[C2i32]] {isAcc = false} : vector<32xi8>, vector<32xi8>, i32, vector<32xi8>
+//   CHECK-NOT:    aievec.upd
+//       CHECK:    return %[[R0]], %[[R1]] : vector<32xi8>, vector<32xi8>
+
+// -----
+
+func.func @unaligned_stencil(%a: memref<64xi16>) -> (vector<16xi16>, vector<16xi16>, vector<16xi16>) {
+   %c0_i16 = arith.constant 0 : i16
+   %c16 = arith.constant 16 : index
+   %c17 = arith.constant 17 : index
+   %c18 = arith.constant 18 : index
+   %0 = vector.transfer_read %a[%c16], %c0_i16 : memref<64xi16>, vector<16xi16>
+   %1 = vector.transfer_read %a[%c17], %c0_i16 : memref<64xi16>, vector<16xi16>
+   %2 = vector.transfer_read %a[%c18], %c0_i16 : memref<64xi16>, vector<16xi16>
+   return %0, %1, %2 : vector<16xi16>, vector<16xi16>, vector<16xi16>
+}
+
+// The aligned read and the two unaligned ones share a single wide load.
+// CHECK-LABEL: func @unaligned_stencil
+//   CHECK-DAG:    %[[C4i32:.*]] = arith.constant 4 : i32
+//   CHECK-DAG:    %[[C2i32:.*]] = arith.constant 2 : i32
+//   CHECK-DAG:    %[[C16:.*]] = arith.constant 16 : index
+//       CHECK:    %[[T:.*]] = aievec.upd {{.*}}[%[[C16]]] {index = 0 : i8, offset = 0 : si32} : memref<64xi16>, vector<32xi16>
+//       CHECK:    %[[TE0:.*]] = aievec.ext %[[T]] {index = 0 : i8} : vector<32xi16>, vector<16xi16>
+//       CHECK:    %[[TE1:.*]] = aievec.ext %[[T]] {index = 1 : i8} : vector<32xi16>, vector<16xi16>
+//       CHECK:    %[[R1:.*]] = aievec.shift %[[TE0]], %[[TE1]], %[[C2i32]] {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+//       CHECK:    %[[R2:.*]] = aievec.shift %[[TE0]], %[[TE1]], %[[C4i32]] {isAcc = false} : vector<16xi16>, vector<16xi16>, i32, vector<16xi16>
+//   CHECK-NOT:    aievec.upd
+//       CHECK:    return %[[TE0]], %[[R1]], %[[R2]] : vector<16xi16>, vector<16xi16>, vector<16xi16>
@@ -0,0 +1,44 @@
+//===- adf_constraints.mlir ------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --adf-generate-cpp-graph %s | FileCheck %s
+
+// CHECK:       class constrained : public graph {
+// CHECK:         constrained() {
+// CHECK:           k1 = kernel::create(kfunc1);
+// CHECK:           k2 = kernel::create(kfunc2);
+// CHECK:           connect<stream> n0 (gin, k1.in[0]);
+// CHECK-NEXT:      fifo_depth(n0) = 32;
+// CHECK-NEXT:      connect<window<128> > n1 (k1.out[0], k2.in[0]);
+// CHECK-NEXT:      connect<window<128> > n2 (k2.out[0], gout);
+// CHECK-NEXT:      source(k1) = "kernels.cc";
+// CHECK-NEXT:      runtime<ratio>(k1) = 0.6;
+// CHECK-NEXT:      location<kernel>(k1) = tile(1, 2);
+// CHECK-NEXT:      stack_size(k1) = 2048;
+// CHECK-NEXT:      heap_size(k1) = 512;
+// CHECK-NEXT:      location<buffer>(k1.out[0]) = {bank(1, 2, 0), bank(1, 2, 1)};
+// CHECK-NEXT:      source(k2) = "kernels.cc";
+// CHECK-NEXT:      runtime<ratio>(k2) = 0.1;
+// CHECK-NEXT:      location<buffer>(k2.in[0]) = bank(2, 2, 3);
+// CHECK-NEXT:    }
+
+module {
+    func.func private @kfunc1(%in1 : !ADF.stream<!ADF.int32>)
+                             ->(!ADF.window<!ADF.int32, 128, 0>)
+    func.func private @kfunc2(%in1 : !ADF.window<!ADF.int32, 128, 0>)
+                             ->(!ADF.window<!ADF.int32, 128, 0>)
+
+    ADF.graph("constrained") {
+        %gi = ADF.input_port("gin")  [1:i1, -1:i32] -> !ADF.interface<!ADF.int32>
+        %1 = ADF.kernel @kfunc1(%gi) {tile = array<i32: 1, 2>, runtime_ratio = 0.6, stack_size = 2048 : i32, heap_size = 512 : i32, out_buffer_locations = [array<i32: 1, 2, 0, 1, 2, 1>], fifo_depths = array<i32: 32>} : (!ADF.interface<!ADF.int32>) -> !ADF.interface<!ADF.int32>
+        %2 = ADF.kernel @kfunc2(%1) {in_buffer_locations = [array<i32: 2, 2, 3>]} : (!ADF.interface<!ADF.int32>) -> !ADF.interface<!ADF.int32>
+        %go = ADF.output_port("gout") %2 : (!ADF.interface<!ADF.int32>) -> !ADF.interface<!ADF.int32>
+    }
+}
@@ -0,0 +1,60 @@
+//===- buffer_report.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-buffer-report %s | FileCheck %s
+
+// CHECK: "tile(3, 3)": {
+// CHECK:   "bank_conflicts": [
+// CHECK:       "bank": 0,
+// CHECK:       "buffers": [
+// CHECK-NEXT:    "a",
+// CHECK-NEXT:    "b"
+// CHECK:   "bank_size": 4096,
+// CHECK:   "banks": [
+// CHECK:       "bank": 0,
+// CHECK:       "buffers": [
+// CHECK-NEXT:    "a",
+// CHECK-NEXT:    "b"
+// CHECK:       "bank": 2,
+// CHECK:       "buffers": [
+// CHECK-NEXT:    "c"
+// CHECK:   "buffers": [
+// CHECK:       "address": 1024,
+// CHECK:       "name": "a",
+// CHECK:       "address": 2048,
+// CHECK:       "name": "b",
+// CHECK:       "address": 8192,
+// CHECK:       "name": "c",
+// CHECK:   "fragmentation": 0.178
+// CHECK:   "free_bytes": 28672,
+// CHECK:   "free_ranges": 2,
+// CHECK:   "largest_free_range": 23552,
+// CHECK:   "size": 32768,
+// CHECK:   "stack_size": 1024,
+// CHECK:   "unplaced_buffers": [],
+// CHECK:   "used_bytes": 4096
+
+module @buffer_report {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %a = AIE.buffer(%t33) {sym_name = "a", address = 1024 : i32} : memref<256xi32>
+  %b = AIE.buffer(%t33) {sym_name = "b", address = 2048 : i32} : memref<256xi32>
+  %c = AIE.buffer(%t33) {sym_name = "c", address = 8192 : i32} : memref<256xi32>
+
+  %c33 = AIE.core(%t33) {
+    %i0 = arith.constant 0 : index
+    %va = vector.load %a[%i0] : memref<256xi32>, vector<8xi32>
+    %vb = vector.load %b[%i0] : memref<256xi32>, vector<8xi32>
+    %vc = arith.addi %va, %vb : vector<8xi32>
+    vector.store %vc, %c[%i0] : memref<256xi32>, vector<8xi32>
+    AIE.end
+  }
+ }
+}
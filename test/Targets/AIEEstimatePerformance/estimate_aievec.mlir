@@ -0,0 +1,44 @@
+//===- estimate_aievec.mlir ------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-estimate-performance %s | FileCheck %s
+
+// The AIEVec operations take their issue cycles on AIE1: one for the loads,
+// the multiplication and the shift-round-saturate, none for the register move
+// of the concat.  The loop runs 16 iterations of 5 cycles, plus one for
+// itself.
+
+// CHECK:      "bottleneck": "core tile(1, 3)",
+// CHECK:      "tile(1, 3)": {
+// CHECK-NEXT:   "cycles": 81,
+// CHECK:      "steady_state_cycles": 81,
+
+module @estimate_aievec {
+  AIE.device(xcvc1902) {
+    %tile13 = AIE.tile(1, 3)
+    %A = AIE.buffer(%tile13) : memref<256xi16>
+    %B = AIE.buffer(%tile13) : memref<16xi16>
+    %C = AIE.buffer(%tile13) : memref<256xi16>
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c16 = arith.constant 16 : index
+      %c256 = arith.constant 256 : index
+      scf.for %i = %c0 to %c256 step %c16 {
+        %a = aievec.upd %A[%i] {index = 0 : i8, offset = 0 : si32} : memref<256xi16>, vector<16xi16>
+        %b = aievec.upd %B[%c0] {index = 0 : i8, offset = 0 : si32} : memref<16xi16>, vector<16xi16>
+        %ab = aievec.concat %a, %a : vector<16xi16>, vector<32xi16>
+        %m = aievec.mul %ab, %b {xoffsets= "0x03020100", xoffsets_hi = "0x07060504", xsquare = "0x0000", xstart = "0", xstep = "0", zoffsets = "0x00000000", zoffsets_hi = "0x00000000", zsquare = "0x0000", zstart = "0", zstep = "1"} : vector<32xi16>, vector<16xi16>, vector<16xi48>
+        %s = aievec.srs %m {shift = 0 : i8} : vector<16xi48>, vector<16xi16>
+        vector.transfer_write %s, %C[%i] {in_bounds = [true]} : vector<16xi16>, memref<256xi16>
+      }
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,113 @@
+//===- estimate_performance.mlir -------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-estimate-performance %s | FileCheck %s
+
+// Each core runs 10 iterations of 7 operations, one of which calls a kernel
+// of known cycles and four of which take the 5 cycles of a lock, and its
+// loop: 10 * (2 + 20 + 1001) + 1 and 10 * (2 + 20 + 501) + 1 cycles, and one
+// for the call to @log, of unknown cycles.  @mid has a single element in
+// shared memory, so both cores run one after the other, which is the
+// bottleneck until @mid gets a second element.  The elements of @in and @out
+// take 1024 / 4 + 18 cycles on their stream, and the 20 KB they move take
+// 20480 / 6 cycles on the NOC of the xcve2302.
+
+// CHECK:      "bottleneck": "@mid of depth 1 between tile(1, 2) and core tile(1, 3)",
+// CHECK:      "tile(1, 2)": {
+// CHECK-NEXT:   "cycles": 10231,
+// CHECK-NEXT:   "unknown_calls": [],
+// CHECK-NEXT:   "unknown_trip_counts": false
+// CHECK:      "tile(1, 3)": {
+// CHECK-NEXT:   "cycles": 5232,
+// CHECK-NEXT:   "unknown_calls": [
+// CHECK-NEXT:     "log"
+// CHECK-NEXT:   ],
+// CHECK:      "objectFifos": {
+// CHECK-NEXT:   "in": {
+// CHECK-NEXT:     "depth": 2,
+// CHECK-NEXT:     "element_bytes": 1024,
+// CHECK-NEXT:     "elements": 10,
+// CHECK-NEXT:     "transfer": "stream"
+// CHECK:        "mid": {
+// CHECK-NEXT:     "depth": 1,
+// CHECK-NEXT:     "element_bytes": 1024,
+// CHECK-NEXT:     "elements": 10,
+// CHECK-NEXT:     "transfer": "shared memory"
+// CHECK:      "stages": [
+// CHECK-NEXT:   {
+// CHECK-NEXT:     "cycles": 15463,
+// CHECK-NEXT:     "name": "@mid of depth 1 between tile(1, 2) and core tile(1, 3)"
+// CHECK:          "cycles": 10231,
+// CHECK-NEXT:     "name": "core tile(1, 2)"
+// CHECK:          "cycles": 5232,
+// CHECK-NEXT:     "name": "core tile(1, 3)"
+// CHECK:          "cycles": 3413.3{{[0-9]*}},
+// CHECK-NEXT:     "name": "NOC"
+// CHECK:          "cycles": 2740,
+// CHECK-NEXT:     "name": "stream @in"
+// CHECK:          "cycles": 2740,
+// CHECK-NEXT:     "name": "stream @out"
+// CHECK:          "cycles": 1280,
+// CHECK-NEXT:     "name": "shim column 1 reads from DDR"
+// CHECK:          "cycles": 1280,
+// CHECK-NEXT:     "name": "shim column 1 writes to DDR"
+// CHECK:      "steady_state_cycles": 15463,
+// CHECK-NEXT: "suggestions": [
+// CHECK-NEXT:   {
+// CHECK-NEXT:     "bottleneck": "core tile(1, 2)",
+// CHECK-NEXT:     "depth": 2,
+// CHECK-NEXT:     "objectFifo": "mid",
+// CHECK-NEXT:     "steady_state_cycles": 10231,
+// CHECK-NEXT:     "tile": "tile(1, 2)"
+
+module @estimate_performance {
+  AIE.device(xcve2302) {
+    %tile10 = AIE.tile(1, 0)
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    AIE.objectFifo @in (%tile10, {%tile12}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+    AIE.objectFifo @mid (%tile12, {%tile13}, 1 : i32) : !AIE.objectFifo<memref<256xi32>>
+    AIE.objectFifo @out (%tile13, {%tile10}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+    func.func private @kernel_a(memref<256xi32>, memref<256xi32>) attributes {aie.cycles = 1000 : i64}
+    func.func private @kernel_b(memref<256xi32>, memref<256xi32>) attributes {aie.cycles = 500 : i64}
+    func.func private @log()
+    %core12 = AIE.core(%tile12) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c10 = arith.constant 10 : index
+      scf.for %i = %c0 to %c10 step %c1 {
+        %subIn = AIE.objectFifo.acquire @in (Consume, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+        %subMid = AIE.objectFifo.acquire @mid (Produce, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+        %in = AIE.objectFifo.subview.access %subIn[0] : !AIE.objectFifoSubview<memref<256xi32>> -> memref<256xi32>
+        %mid = AIE.objectFifo.subview.access %subMid[0] : !AIE.objectFifoSubview<memref<256xi32>> -> memref<256xi32>
+        func.call @kernel_a(%in, %mid) : (memref<256xi32>, memref<256xi32>) -> ()
+        AIE.objectFifo.release @in (Consume, 1)
+        AIE.objectFifo.release @mid (Produce, 1)
+      }
+      AIE.end
+    }
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c10 = arith.constant 10 : index
+      scf.for %i = %c0 to %c10 step %c1 {
+        %subMid = AIE.objectFifo.acquire @mid (Consume, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+        %subOut = AIE.objectFifo.acquire @out (Produce, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+        %mid = AIE.objectFifo.subview.access %subMid[0] : !AIE.objectFifoSubview<memref<256xi32>> -> memref<256xi32>
+        %out = AIE.objectFifo.subview.access %subOut[0] : !AIE.objectFifoSubview<memref<256xi32>> -> memref<256xi32>
+        func.call @kernel_b(%mid, %out) : (memref<256xi32>, memref<256xi32>) -> ()
+        AIE.objectFifo.release @mid (Consume, 1)
+        AIE.objectFifo.release @out (Produce, 1)
+      }
+      func.call @log() : () -> ()
+      AIE.end
+    }
+  }
+}
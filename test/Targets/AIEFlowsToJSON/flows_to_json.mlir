@@ -0,0 +1,106 @@
+//===- flows_to_json.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-flows-to-json %s | FileCheck %s
+
+// CHECK:      "switchbox72": {
+// CHECK-NEXT:   "col": 7,
+// CHECK-NEXT:   "row": 2,
+// CHECK-NEXT:   "source_count": 1,
+// CHECK-NEXT:   "destination_count": 0,
+// CHECK-NEXT:   "northbound": 1,
+// CHECK-NEXT:   "eastbound": 1,
+// CHECK-NEXT:   "southbound": 0,
+// CHECK-NEXT:   "westbound": 0,
+// CHECK-NEXT:   "channels": [
+// CHECK-NEXT:     {
+// CHECK-NEXT:       "bundle": "North",
+// CHECK-NEXT:       "used": 1,
+// CHECK-NEXT:       "max": 6
+// CHECK:            "bundle": "East",
+// CHECK-NEXT:       "used": 1,
+// CHECK-NEXT:       "max": 4
+// CHECK:        "routes": [
+// CHECK-NEXT:     0
+// CHECK-NEXT:   ]
+// CHECK:      "switchbox73": {
+// CHECK:        "destination_count": 1,
+// CHECK:        "routes": [
+// CHECK-NEXT:     0
+// CHECK-NEXT:   ]
+// CHECK:      "switchbox82": {
+// CHECK:        "destination_count": 1,
+// CHECK:      "route0": [
+// CHECK-NEXT:   [
+// CHECK-NEXT:     [
+// CHECK-NEXT:       7,
+// CHECK-NEXT:       2
+// CHECK-NEXT:     ],
+// CHECK-NEXT:     [
+// CHECK-NEXT:       "North",
+// CHECK-NEXT:       "East"
+// CHECK-NEXT:     ]
+// CHECK-NEXT:   ],
+// CHECK:            7,
+// CHECK-NEXT:       3
+// CHECK-NEXT:     ],
+// CHECK-NEXT:     [
+// CHECK-NEXT:       "DMA"
+// CHECK:            8,
+// CHECK-NEXT:       2
+// CHECK-NEXT:     ],
+// CHECK-NEXT:     [
+// CHECK-NEXT:       "DMA"
+// CHECK:          []
+// CHECK-NEXT: ],
+// CHECK-NEXT: "flow0": {
+// CHECK-NEXT:   "route": 0,
+// CHECK-NEXT:   "source": {
+// CHECK-NEXT:     "col": 7,
+// CHECK-NEXT:     "row": 2,
+// CHECK-NEXT:     "bundle": "DMA",
+// CHECK-NEXT:     "channel": 0
+// CHECK-NEXT:   },
+// CHECK-NEXT:   "destinations": [
+// CHECK-NEXT:     {
+// CHECK-NEXT:       "col": 7,
+// CHECK-NEXT:       "row": 3,
+// CHECK-NEXT:       "bundle": "DMA",
+// CHECK-NEXT:       "channel": 1
+// CHECK-NEXT:     },
+// CHECK-NEXT:     {
+// CHECK-NEXT:       "col": 8,
+// CHECK-NEXT:       "row": 2,
+// CHECK-NEXT:       "bundle": "DMA",
+// CHECK-NEXT:       "channel": 0
+// CHECK-NEXT:     }
+// CHECK-NEXT:   ],
+// CHECK-NEXT:   "switchboxes": 3
+// CHECK-NEXT: }
+
+module {
+  AIE.device(xcvc1902) {
+    %t72 = AIE.tile(7, 2)
+    %t73 = AIE.tile(7, 3)
+    %t82 = AIE.tile(8, 2)
+    %sb72 = AIE.switchbox(%t72) {
+      AIE.connect<DMA : 0, North : 0>
+      AIE.connect<DMA : 0, East : 3>
+    }
+    %sb73 = AIE.switchbox(%t73) {
+      AIE.connect<South : 0, DMA : 1>
+    }
+    %sb82 = AIE.switchbox(%t82) {
+      AIE.connect<West : 3, DMA : 0>
+    }
+    AIE.flow(%t72, DMA : 0, %t73, DMA : 1)
+    AIE.flow(%t72, DMA : 0, %t82, DMA : 0)
+  }
+}
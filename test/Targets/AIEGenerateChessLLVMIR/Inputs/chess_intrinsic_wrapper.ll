@@ -0,0 +1,14 @@
+; The chess intrinsic wrapper, as xchesscc compiles it.
+
+define void @llvm___aie___lock___acquire___reg(i32 %id, i32 %val) {
+  call void @acquire(i32 %id, i32 %val)
+  ret void
+}
+
+define void @llvm___aie___lock___release___reg(i32 %id, i32 %val) {
+  call void @release(i32 %id, i32 %val)
+  ret void
+}
+
+declare void @acquire(i32, i32)
+declare void @release(i32, i32)
@@ -0,0 +1,28 @@
+//===- chess_llvmir.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-chess-llvmir %s | FileCheck %s
+
+// CHECK-NOT: noundef
+// CHECK-NOT: poison
+// CHECK-NOT: memory(
+// CHECK: declare void @load(ptr) #[[ATTRS:.*]]
+// CHECK: define i32 @core_2_3(i32 %arg0) {
+// CHECK:   add i32 %arg0, undef
+// CHECK: attributes #[[ATTRS]] = { readonly }
+
+module {
+  llvm.func @load(!llvm.ptr) attributes {memory = #llvm.memory_effects<other = read, argMem = read, inaccessibleMem = read>}
+  llvm.func @core_2_3(%arg0: i32 {llvm.noundef}) -> i32 {
+    %0 = llvm.mlir.poison : i32
+    %1 = llvm.add %arg0, %0 : i32
+    llvm.return %1 : i32
+  }
+}
@@ -0,0 +1,41 @@
+//===- inline_intrinsic_wrapper.mlir ---------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-chess-llvmir --chess-intrinsic-wrapper=%S/Inputs/chess_intrinsic_wrapper.ll %s | FileCheck %s
+
+// The locks of the loop are the chess intrinsics, not calls to the wrapper.
+
+// CHECK-NOT: declare void @llvm.aie.lock
+// CHECK-LABEL: define void @core_2_3(
+// CHECK-NOT: call void @llvm
+// CHECK: call void @acquire(i32 3, i32 1)
+// CHECK-NOT: call void @llvm
+// CHECK: call void @release(i32 3, i32 0)
+// CHECK-NOT: call void @llvm
+// CHECK: ret void
+
+module {
+  llvm.func @llvm.aie.lock.acquire.reg(i32, i32)
+  llvm.func @llvm.aie.lock.release.reg(i32, i32)
+  llvm.func @core_2_3(%n: i32) {
+    %c0 = llvm.mlir.constant(0 : i32) : i32
+    %c1 = llvm.mlir.constant(1 : i32) : i32
+    %c3 = llvm.mlir.constant(3 : i32) : i32
+    llvm.br ^loop(%c0 : i32)
+  ^loop(%i: i32):
+    llvm.call @llvm.aie.lock.acquire.reg(%c3, %c1) : (i32, i32) -> ()
+    llvm.call @llvm.aie.lock.release.reg(%c3, %c0) : (i32, i32) -> ()
+    %next = llvm.add %i, %c1 : i32
+    %done = llvm.icmp "eq" %next, %n : i32
+    llvm.cond_br %done, ^exit, ^loop(%next : i32)
+  ^exit:
+    llvm.return
+  }
+}
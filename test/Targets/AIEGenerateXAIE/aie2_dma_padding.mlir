@@ -0,0 +1,62 @@
+//===- aie2_dma_padding.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// CHECK: __mlir_aie_try(XAie_DmaSetMultiDimAddr(&(dma_tile21_bd0), &dma_tile_2_1_bd_0_tensor, 0x80000,  /* len */ 288 * 4));
+// CHECK: XAie_PadDesc dma_tile_2_1_bd_0_tensor_pads[2] = {};
+// CHECK: dma_tile_2_1_bd_0_tensor_pads[1] = { /* Before */ 2, /* After */ 0};
+// CHECK: dma_tile_2_1_bd_0_tensor_pads[0] = { /* Before */ 1, /* After */ 3};
+// CHECK: XAie_DmaPadTensor dma_tile_2_1_bd_0_tensor_pad = {};
+// CHECK: dma_tile_2_1_bd_0_tensor_pad.NumDim = 2;
+// CHECK: dma_tile_2_1_bd_0_tensor_pad.PadDesc = dma_tile_2_1_bd_0_tensor_pads;
+// CHECK: __mlir_aie_try(XAie_DmaSetPadding(&(dma_tile21_bd0), &dma_tile_2_1_bd_0_tensor_pad));
+// CHECK-NOT: XAie_DmaEnableCompression(&(dma_tile21_bd0))
+// CHECK: __mlir_aie_try(XAie_DmaEnableBd(&(dma_tile21_bd0)));
+
+// CHECK: XAie_DmaDesc [[bd:dma_tile23_bd0]];
+// CHECK-NOT: XAie_DmaSetPadding
+// CHECK: __mlir_aie_try(XAie_DmaEnableCompression(&([[bd]])));
+// CHECK: __mlir_aie_try(XAie_DmaEnableBd(&([[bd]])));
+
+module @aie2_dma_padding {
+ AIE.device(xcve2302) {
+  %t21 = AIE.tile(2, 1)
+  %t23 = AIE.tile(2, 3)
+  %in = AIE.buffer(%t21) { address = 0 : i32, sym_name = "in" } : memref<256xi32>
+  %weights = AIE.buffer(%t23) { address = 1024 : i32, sym_name = "weights" } : memref<256xi32>
+  %l21_0 = AIE.lock(%t21, 0) { init = 1 : i32 }
+  %l21_1 = AIE.lock(%t21, 1)
+  %l23_0 = AIE.lock(%t23, 0) { init = 1 : i32 }
+  %l23_1 = AIE.lock(%t23, 1)
+
+  AIE.memTileDMA(%t21) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.useLock(%l21_1, "AcquireGreaterEqual", 1)
+    AIE.dmaBd(<%in : memref<256xi32>, 0, 288>, 0, [<16, 14>, <1, 14>] pad [<1, 3>, <2, 0>])
+    AIE.useLock(%l21_0, "Release", 1)
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+
+  AIE.mem(%t23) {
+    AIE.dmaStart(S2MM, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.useLock(%l23_0, "AcquireGreaterEqual", 1)
+    AIE.dmaBd(<%weights : memref<256xi32>, 0, 256>, 0) { compression }
+    AIE.useLock(%l23_1, "Release", 1)
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+ }
+}
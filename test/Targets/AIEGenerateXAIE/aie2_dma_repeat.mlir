@@ -0,0 +1,51 @@
+//===- aie2_dma_repeat.mlir ------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd0:.*]]),  /* nextbd */ 1,  /* enableNextBd */ 1));
+// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd1:.*]]),  /* nextbd */ 0,  /* enableNextBd */ 1));
+// CHECK: __mlir_aie_try(XAie_DmaChannelSetStartQueue(&(ctx->DevInst), XAie_TileLoc(7,3), /* ChNum */0, /* dmaDir */ DMA_MM2S, /* BdNum */0, /* RepeatCount */ 16, /* EnTokenIssue */ XAIE_DISABLE));
+// CHECK: __mlir_aie_try(XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(7,3), /* ChNum */ 0, /* dmaDir */ DMA_MM2S));
+// CHECK: __mlir_aie_try(XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), XAie_TileLoc(7,3), /* ChNum */0, /* dmaDir */ DMA_S2MM, /* BdNum */2));
+
+module @aie_module  {
+  AIE.device(xcve2802) {
+    %t73 = AIE.tile(7, 3)
+
+    %buf_ping = AIE.buffer(%t73) {address = 1024 : i32, sym_name = "ping" } : memref<256xi32>
+    %buf_pong = AIE.buffer(%t73) {address = 2048 : i32, sym_name = "pong" } : memref<256xi32>
+    %buf_in = AIE.buffer(%t73) {address = 3072 : i32, sym_name = "in" } : memref<256xi32>
+
+    %lock_ping = AIE.lock(%t73, 0) { init = 1 : i32 }
+    %lock_pong = AIE.lock(%t73, 1) { init = 1 : i32 }
+
+    %m73 = AIE.mem(%t73) {
+        %srcDma = AIE.dmaStart("MM2S", 0, ^bd0, ^dma1) { repeatCount = 16 : i32 }
+      ^bd0:
+        AIE.useLock(%lock_ping, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%buf_ping : memref<256xi32>, 0, 256>, 0)
+        AIE.useLock(%lock_ping, Release, 1)
+        AIE.nextBd ^bd1
+      ^bd1:
+        AIE.useLock(%lock_pong, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%buf_pong : memref<256xi32>, 0, 256>, 0)
+        AIE.useLock(%lock_pong, Release, 1)
+        AIE.nextBd ^bd0
+      ^dma1:
+        %dstDma = AIE.dmaStart("S2MM", 0, ^bd2, ^end)
+      ^bd2:
+        AIE.dmaBd(<%buf_in : memref<256xi32>, 0, 256>, 0)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+ }
+}
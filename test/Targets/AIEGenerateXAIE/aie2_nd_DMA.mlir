@@ -10,15 +10,14 @@
 
 // RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
 
+// CHECK-NOT: calloc
+// CHECK: XAie_DmaDimDesc dma_tile_2_1_bd_0_tensor_dims[4] = {};
+// CHECK: dma_tile_2_1_bd_0_tensor_dims[3].AieMlDimDesc = { /* StepSize */ 1, /* Wrap */ 2};
+// CHECK: dma_tile_2_1_bd_0_tensor_dims[2].AieMlDimDesc = { /* StepSize */ 2, /* Wrap */ 3};
+// CHECK: dma_tile_2_1_bd_0_tensor_dims[1].AieMlDimDesc = { /* StepSize */ 4, /* Wrap */ 2};
+// CHECK: dma_tile_2_1_bd_0_tensor_dims[0].AieMlDimDesc = { /* StepSize */ 1, /* Wrap */ 1};
 // CHECK: dma_tile_2_1_bd_0_tensor.NumDim = 4;
-// CHECK: dma_tile_2_1_bd_0_tensor.Dim =__mlir_aie_alloc_dim_desc(4);
-// CHECK: if(NULL == dma_tile_2_1_bd_0_tensor.Dim){
-// CHECK:   return 1;
-// CHECK: }
-// CHECK: dma_tile_2_1_bd_0_tensor.Dim[3].AieMlDimDesc = { /* StepSize */ 1, /* Wrap */ 2};
-// CHECK: dma_tile_2_1_bd_0_tensor.Dim[2].AieMlDimDesc = { /* StepSize */ 2, /* Wrap */ 3};
-// CHECK: dma_tile_2_1_bd_0_tensor.Dim[1].AieMlDimDesc = { /* StepSize */ 4, /* Wrap */ 2};
-// CHECK: dma_tile_2_1_bd_0_tensor.Dim[0].AieMlDimDesc = { /* StepSize */ 1, /* Wrap */ 1};
+// CHECK: dma_tile_2_1_bd_0_tensor.Dim = dma_tile_2_1_bd_0_tensor_dims;
 // CHECK: __mlir_aie_try(XAie_DmaSetMultiDimAddr(&(dma_tile21_bd0), &dma_tile_2_1_bd_0_tensor, 0x82000,  /* len */ 128 * 4));
 
 module @aie_module  {
@@ -0,0 +1,44 @@
+//===- broadcast_events.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// CHECK-LABEL: int mlir_aie_start_cores_synchronized(aie_libxaie_ctx_t* ctx) {
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreUnreset(&(ctx->DevInst), XAie_TileLoc(3,3)));
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreConfigureEnableEvent(&(ctx->DevInst), XAie_TileLoc(3,3), XAIE_EVENT_BROADCAST_15_CORE));
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreUnreset(&(ctx->DevInst), XAie_TileLoc(4,4)));
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreConfigureEnableEvent(&(ctx->DevInst), XAie_TileLoc(4,4), XAIE_EVENT_BROADCAST_15_CORE));
+// CHECK-NEXT: __mlir_aie_try(XAie_EventBroadcast(&(ctx->DevInst), XAie_TileLoc(3,0), XAIE_PL_MOD, 15, XAIE_EVENT_USER_EVENT_0_PL));
+// CHECK-NEXT: __mlir_aie_try(XAie_EventGenerate(&(ctx->DevInst), XAie_TileLoc(3,0), XAIE_PL_MOD, XAIE_EVENT_USER_EVENT_0_PL));
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreConfigureEnableEvent(&(ctx->DevInst), XAie_TileLoc(3,3), XAIE_EVENT_NONE_CORE));
+// CHECK-NEXT: __mlir_aie_try(XAie_CoreConfigureEnableEvent(&(ctx->DevInst), XAie_TileLoc(4,4), XAIE_EVENT_NONE_CORE));
+// CHECK-NEXT: return XAIE_OK;
+
+// CHECK-LABEL: int mlir_aie_sync_timers(aie_libxaie_ctx_t* ctx) {
+// CHECK-NEXT: __mlir_aie_try(XAie_SetTimerResetEvent(&(ctx->DevInst), XAie_TileLoc(3,3), XAIE_CORE_MOD, XAIE_EVENT_BROADCAST_14_CORE, XAIE_RESETDISABLE));
+// CHECK-NEXT: __mlir_aie_try(XAie_SetTimerResetEvent(&(ctx->DevInst), XAie_TileLoc(4,4), XAIE_CORE_MOD, XAIE_EVENT_BROADCAST_14_CORE, XAIE_RESETDISABLE));
+// CHECK-NEXT: __mlir_aie_try(XAie_EventBroadcast(&(ctx->DevInst), XAie_TileLoc(3,0), XAIE_PL_MOD, 14, XAIE_EVENT_USER_EVENT_1_PL));
+// CHECK-NEXT: __mlir_aie_try(XAie_EventGenerate(&(ctx->DevInst), XAie_TileLoc(3,0), XAIE_PL_MOD, XAIE_EVENT_USER_EVENT_1_PL));
+// CHECK-NEXT: __mlir_aie_try(XAie_SetTimerResetEvent(&(ctx->DevInst), XAie_TileLoc(3,3), XAIE_CORE_MOD, XAIE_EVENT_NONE_CORE, XAIE_RESETDISABLE));
+// CHECK-NEXT: __mlir_aie_try(XAie_SetTimerResetEvent(&(ctx->DevInst), XAie_TileLoc(4,4), XAIE_CORE_MOD, XAIE_EVENT_NONE_CORE, XAIE_RESETDISABLE));
+// CHECK-NEXT: return XAIE_OK;
+
+module @test_broadcast_events {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %t44 = AIE.tile(4, 4)
+  AIE.core(%t33) {
+    AIE.end
+  }
+  AIE.core(%t44) {
+    AIE.end
+  }
+ }
+}
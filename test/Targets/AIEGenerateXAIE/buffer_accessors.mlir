@@ -0,0 +1,43 @@
+//===- buffer_accessors.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// Every buffer gets block accessors, the 32-bit ones also get word accessors.
+
+// CHECK: const int a_offset = 4096;
+// CHECK: const int a_size = 1024;
+// CHECK: int mlir_aie_read_buffer_a_block(aie_libxaie_ctx_t* ctx, int offset, void *data, size_t bytes) {
+// CHECK:   if (offset < 0 || offset + bytes > a_size) return XAIE_INVALID_ARGS;
+// CHECK:   return XAie_DataMemBlockRead(&(ctx->DevInst), XAie_TileLoc(3,3), a_offset + offset, data, bytes);
+// CHECK: int mlir_aie_write_buffer_a_block(aie_libxaie_ctx_t* ctx, int offset, const void *data, size_t bytes) {
+// CHECK:   return XAie_DataMemBlockWrite(&(ctx->DevInst), XAie_TileLoc(3,3), a_offset + offset, data, bytes);
+// CHECK: int32_t mlir_aie_read_buffer_a(aie_libxaie_ctx_t* ctx, int index) {
+// CHECK: int mlir_aie_write_buffer_a(aie_libxaie_ctx_t* ctx, int index, int32_t value) {
+
+// CHECK: const int b_offset = 5120;
+// CHECK: const int b_size = 512;
+// CHECK: int mlir_aie_read_buffer_b_block(
+// CHECK: int mlir_aie_write_buffer_b_block(
+// CHECK-NOT: mlir_aie_read_buffer_b(
+
+// CHECK: const int c_offset = 6144;
+// CHECK: const int c_size = 64;
+// CHECK: int mlir_aie_write_buffer_c_block(
+// CHECK-NOT: mlir_aie_write_buffer_c(
+
+module @buffer_accessors {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %a = AIE.buffer(%t33) {address = 4096 : i32, sym_name = "a"} : memref<256xi32>
+  %b = AIE.buffer(%t33) {address = 5120 : i32, sym_name = "b"} : memref<16x16xbf16>
+  %c = AIE.buffer(%t33) {address = 6144 : i32, sym_name = "c"} : memref<64xi8>
+ }
+}
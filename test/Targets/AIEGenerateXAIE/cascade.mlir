@@ -0,0 +1,32 @@
+//===- cascade.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// The cores of the cascade flows are configured to get their accumulator
+// from the core before them and to put it to the core after them.
+
+// CHECK-LABEL: static int mlir_aie_configure_cores_col1(aie_libxaie_ctx_t* ctx) {
+// CHECK: __mlir_aie_try(XAie_CoreConfigAccumulatorControl(&(ctx->DevInst), XAie_TileLoc(1,4), WEST, EAST));
+// CHECK-LABEL: static int mlir_aie_configure_cores_col2(aie_libxaie_ctx_t* ctx) {
+// CHECK: __mlir_aie_try(XAie_CoreConfigAccumulatorControl(&(ctx->DevInst), XAie_TileLoc(2,4), WEST, SOUTH));
+// CHECK: __mlir_aie_try(XAie_CoreConfigAccumulatorControl(&(ctx->DevInst), XAie_TileLoc(2,3), NORTH, EAST));
+// CHECK-NOT: XAie_CoreConfigAccumulatorControl
+
+module @cascade {
+ AIE.device(xcve2802) {
+  %t14 = AIE.tile(1, 4)
+  %t24 = AIE.tile(2, 4)
+  %t23 = AIE.tile(2, 3)
+  %t15 = AIE.tile(1, 5)
+  AIE.cascadeFlow(%t14, %t24)
+  AIE.cascadeFlow(%t24, %t23)
+ }
+}
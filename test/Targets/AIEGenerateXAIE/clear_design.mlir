@@ -0,0 +1,31 @@
+//===- clear_design.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// Only the tiles of the design are cleared.
+
+// CHECK-LABEL: int mlir_aie_clear_design(aie_libxaie_ctx_t* ctx) {
+// CHECK-NEXT: mlir_aie_clear_shim_config(ctx, 2, 0);
+// CHECK-NEXT: mlir_aie_clear_config(ctx, 2, 3);
+// CHECK-NEXT: mlir_aie_clear_config(ctx, 3, 3);
+// CHECK-NEXT: return XAIE_OK;
+// CHECK-NEXT: } // mlir_aie_clear_design
+
+module @clear_design {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t23 = AIE.tile(2, 3)
+  %t33 = AIE.tile(3, 3)
+  %c23 = AIE.core(%t23) {
+    AIE.end
+  }
+ }
+}
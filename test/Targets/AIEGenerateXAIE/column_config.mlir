@@ -0,0 +1,67 @@
+//===- column_config.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// The configuration is emitted per column, and the ELF file shared by the
+// cores of both columns is read once.
+
+// CHECK: static AieRC __mlir_aie_load_shared_elf(
+// CHECK: static std::once_flag __mlir_aie_elf_once_0;
+// CHECK: static std::vector<unsigned char> __mlir_aie_elf_0;
+// CHECK-NOT: __mlir_aie_elf_once_1
+
+// CHECK-LABEL: static int mlir_aie_configure_cores_col3(aie_libxaie_ctx_t* ctx) {
+// CHECK: XAie_CoreReset(&(ctx->DevInst), XAie_TileLoc(3,3))
+// CHECK: AieRC RC = __mlir_aie_load_shared_elf(&(ctx->DevInst), XAie_TileLoc(3,3), __mlir_aie_elf_once_0, __mlir_aie_elf_0, (const char*)"kernel.elf");
+// CHECK: XAie_CoreReset(&(ctx->DevInst), XAie_TileLoc(3,4))
+// CHECK: AieRC RC = XAie_LoadElf(&(ctx->DevInst), XAie_TileLoc(3,4), (const char*)"core_3_4.elf",0);
+// CHECK: } // mlir_aie_configure_cores_col3
+// CHECK-LABEL: static int mlir_aie_configure_cores_col4(aie_libxaie_ctx_t* ctx) {
+// CHECK: AieRC RC = __mlir_aie_load_shared_elf(&(ctx->DevInst), XAie_TileLoc(4,3), __mlir_aie_elf_once_0, __mlir_aie_elf_0, (const char*)"kernel.elf");
+// CHECK-LABEL: int mlir_aie_configure_cores_column(aie_libxaie_ctx_t* ctx, int col) {
+// CHECK: case 3: return mlir_aie_configure_cores_col3(ctx);
+// CHECK: case 4: return mlir_aie_configure_cores_col4(ctx);
+// CHECK-LABEL: int mlir_aie_configure_cores(aie_libxaie_ctx_t* ctx) {
+// CHECK: __mlir_aie_try(mlir_aie_configure_cores_col3(ctx));
+// CHECK: __mlir_aie_try(mlir_aie_configure_cores_col4(ctx));
+
+// CHECK-LABEL: static int mlir_aie_configure_switchboxes_col3(aie_libxaie_ctx_t* ctx) {
+// CHECK: int x, y;
+// CHECK: x = 3;
+// CHECK: y = 3;
+// CHECK: XAie_StrmConnCctEnable(&(ctx->DevInst), XAie_TileLoc(x,y), CORE, 0, EAST, 0)
+// CHECK-LABEL: static int mlir_aie_configure_switchboxes_col4(aie_libxaie_ctx_t* ctx) {
+// CHECK: x = 4;
+// CHECK: XAie_StrmConnCctEnable(&(ctx->DevInst), XAie_TileLoc(x,y), WEST, 0, CORE, 0)
+// CHECK-LABEL: int mlir_aie_configure_switchboxes(aie_libxaie_ctx_t* ctx) {
+
+module @column_config {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %t34 = AIE.tile(3, 4)
+  %t43 = AIE.tile(4, 3)
+  %c33 = AIE.core(%t33) {
+    AIE.end
+  } { elf_file = "kernel.elf" }
+  %c34 = AIE.core(%t34) {
+    AIE.end
+  }
+  %c43 = AIE.core(%t43) {
+    AIE.end
+  } { elf_file = "kernel.elf" }
+  %s33 = AIE.switchbox(%t33) {
+    AIE.connect<Core : 0, East : 0>
+  }
+  %s43 = AIE.switchbox(%t43) {
+    AIE.connect<West : 0, Core : 0>
+  }
+ }
+}
@@ -0,0 +1,39 @@
+//===- minimal_locks.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+// RUN: aie-translate --aie-generate-xaie --aie-minimal-writes %s | FileCheck %s --check-prefix=MINIMAL
+
+// By default all the locks of the core tiles are released, in minimal mode
+// only the ones of the design.
+
+// CHECK-LABEL: static int mlir_aie_configure_cores_col3(
+// CHECK:       for (int l = 0; l < 16; ++l)
+// CHECK-NEXT:    __mlir_aie_try(XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(3,3), XAie_LockInit(l, 0x0), 0));
+
+// MINIMAL-LABEL: static int mlir_aie_configure_cores_col3(
+// MINIMAL-NOT:   for (int l = 0;
+// MINIMAL:       __mlir_aie_try(XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(3,3), XAie_LockInit(2, 0x0), 0));
+// MINIMAL-NEXT:  __mlir_aie_try(XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(3,3), XAie_LockInit(5, 0x0), 0));
+// MINIMAL-NOT:   XAie_LockRelease
+// MINIMAL:       } // mlir_aie_configure_cores_col3
+
+module @minimal_locks {
+  AIE.device(xcvc1902) {
+    %t33 = AIE.tile(3, 3)
+    %lock5 = AIE.lock(%t33, 5)
+    %lock2 = AIE.lock(%t33, 2)
+    %core33 = AIE.core(%t33) {
+      AIE.useLock(%lock2, Acquire, 0)
+      AIE.useLock(%lock5, Release, 1)
+      AIE.end
+    }
+  }
+}
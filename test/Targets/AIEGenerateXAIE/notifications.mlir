@@ -0,0 +1,38 @@
+//===- notifications.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// Each event is broadcast on its own channel, and the shim tile of column 4
+// forwards its events to the shim NOC tile of column 3.
+
+// CHECK-LABEL: int mlir_aie_configure_notifications(aie_libxaie_ctx_t* ctx) {
+// CHECK-NEXT: if (mlir_aie_notify_event(ctx, 2, 0, XAIE_PL_MOD, XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_PL, 13, 2) != 0)
+// CHECK-NEXT:   return -1;
+// CHECK-NEXT: if (mlir_aie_notify_event(ctx, 2, 3, XAIE_CORE_MOD, XAIE_EVENT_INSTR_EVENT_1_CORE, 12, 2) != 0)
+// CHECK-NEXT:   return -1;
+// CHECK-NEXT: if (mlir_aie_notify_event(ctx, 2, 3, XAIE_MEM_MOD, XAIE_EVENT_DMA_MM2S_1_FINISHED_BD_MEM, 11, 2) != 0)
+// CHECK-NEXT:   return -1;
+// CHECK-NEXT: if (mlir_aie_notify_event(ctx, 4, 2, XAIE_MEM_MOD, XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_MEM, 10, 3) != 0)
+// CHECK-NEXT:   return -1;
+// CHECK-NEXT: return 0;
+// CHECK-NEXT: } // mlir_aie_configure_notifications
+
+module @notifications {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0) {notify = ["dma_s2mm_0_done"]}
+  %t23 = AIE.tile(2, 3) {notify = ["core_event_1", "dma_mm2s_1_done"]}
+  %t42 = AIE.tile(4, 2) {notify = ["dma_s2mm_0_done"]}
+  %c23 = AIE.core(%t23) {
+    AIE.event(1)
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,24 @@
+//===- partition.mlir ------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// The configuration describes the whole device and the tiles relative to the
+// partition, libxaie relocates them to the partition it is loaded in.
+// CHECK: ctx->AieConfigPtr.NumCols = 38;
+// CHECK: // Partition of 4 columns, compiled at column 6.
+// CHECK: XAie_LockSetValue(&(ctx->DevInst), XAie_TileLoc(1,3), XAie_LockInit(0, 1))
+
+module @aie_module  {
+  AIE.device(xcve2802) partition(6, 4) {
+    %t13 = AIE.tile(1, 3)
+    %lock = AIE.lock(%t13, 0) { init = 1 : i32 }
+  }
+}
@@ -0,0 +1,35 @@
+//===- profile_dataflow.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// The stalls of every core are counted, the tiles without cores are left out.
+
+// CHECK-LABEL: bool mlir_aie_profile_dataflow(aie_libxaie_ctx_t* ctx, DataflowProfile &profile) {
+// CHECK-NEXT: bool counted = true;
+// CHECK-NEXT: counted &= profile.addCore(2, 3);
+// CHECK-NEXT: counted &= profile.addCore(3, 3);
+// CHECK-NEXT: return counted;
+// CHECK-NEXT: } // mlir_aie_profile_dataflow
+
+module @profile_dataflow {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t23 = AIE.tile(2, 3)
+  %t33 = AIE.tile(3, 3)
+  %t43 = AIE.tile(4, 3)
+  %c23 = AIE.core(%t23) {
+    AIE.end
+  }
+  %c33 = AIE.core(%t33) {
+    AIE.end
+  }
+ }
+}
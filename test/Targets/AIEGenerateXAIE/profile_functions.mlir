@@ -0,0 +1,33 @@
+//===- profile_functions.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// Every core is profiled from the ELF file it runs.
+
+// CHECK-LABEL: void mlir_aie_profile_functions(aie_libxaie_ctx_t* ctx, FunctionProfile &profile) {
+// CHECK-NEXT: profile.addCore(2, 3, "core_2_3.elf");
+// CHECK-NEXT: profile.addCore(3, 3, "kernel.elf");
+// CHECK-NEXT: } // mlir_aie_profile_functions
+
+module @profile_functions {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t23 = AIE.tile(2, 3)
+  %t33 = AIE.tile(3, 3)
+  %t43 = AIE.tile(4, 3)
+  %c23 = AIE.core(%t23) {
+    AIE.end
+  }
+  %c33 = AIE.core(%t33) {
+    AIE.end
+  } { elf_file = "kernel.elf" }
+ }
+}
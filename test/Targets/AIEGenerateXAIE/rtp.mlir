@@ -0,0 +1,33 @@
+//===- rtp.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// CHECK: static AieRC __mlir_aie_write_rtp(
+// CHECK: int mlir_aie_init_rtp_params(aie_libxaie_ctx_t* ctx, const void *values) {
+// CHECK-NEXT:   __mlir_aie_try(XAie_DataMemBlockWrite(&(ctx->DevInst), XAie_TileLoc(1,3), 4096, values, 16));
+// CHECK-NEXT:   __mlir_aie_try(XAie_DataMemBlockWrite(&(ctx->DevInst), XAie_TileLoc(1,3), 4112, values, 16));
+// CHECK-NEXT:   __mlir_aie_try(XAie_DataMemWrWord(&(ctx->DevInst), XAie_TileLoc(1,3), 4128, 0));
+// CHECK-NEXT:   return XAie_DataMemWrWord(&(ctx->DevInst), XAie_TileLoc(1,3), 4132, 0);
+// CHECK-NEXT: }
+// CHECK: int mlir_aie_write_rtp_params(aie_libxaie_ctx_t* ctx, const void *values, int timeoutUs) {
+// CHECK-NEXT:   return __mlir_aie_write_rtp(&(ctx->DevInst), XAie_TileLoc(1,3), 4096, 4112, 4128, 4132, values, 16, timeoutUs);
+// CHECK-NEXT: }
+
+module {
+  AIE.device(xcvc1902) {
+    %t13 = AIE.tile(1, 3)
+    %params_0 = AIE.buffer(%t13) {address = 4096 : i32, sym_name = "params_0"} : memref<4xi32>
+    %params_1 = AIE.buffer(%t13) {address = 4112 : i32, sym_name = "params_1"} : memref<4xi32>
+    %params_version = AIE.buffer(%t13) {address = 4128 : i32, sym_name = "params_version"} : memref<1xi32>
+    %params_ack = AIE.buffer(%t13) {address = 4132 : i32, sym_name = "params_ack"} : memref<1xi32>
+    AIE.rtp @params (%t13) : memref<4xi32>
+  }
+}
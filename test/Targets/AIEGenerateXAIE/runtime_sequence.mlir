@@ -0,0 +1,61 @@
+//===- runtime_sequence.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// The AIE.shimDMA of tile (2, 0) uses BD 0, so the channels of the sequence
+// get rings of BDs from 1: 4 for MM2S 0, and 4 for S2MM 0.
+
+// CHECK: static AieRC __mlir_aie_shim_transfer(
+// CHECK: int mlir_aie_run_sequence_frames(aie_libxaie_ctx_t* ctx) {
+// CHECK: u64 addr_in = __mlir_aie_external_addr(ctx, "in");
+// CHECK: u64 addr_out = __mlir_aie_external_addr(ctx, "out");
+// CHECK: u8 slot_20_MM2S_0 = 0;
+// CHECK: __mlir_aie_try(XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_MM2S));
+// CHECK: u8 slot_20_S2MM_0 = 0;
+// CHECK: __mlir_aie_try(XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_S2MM));
+// CHECK: // in[0 : 256] x 16, stride 256
+// CHECK: for (int i = 0; i < 16; i++) {
+// CHECK: __mlir_aie_try(__mlir_aie_shim_transfer(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_MM2S, /* BdNum */ 1 + slot_20_MM2S_0, addr_in + 0x0 + i * 0x400, /* len */ 256 * 4, /* slots */ 4));
+// CHECK: slot_20_MM2S_0 = (slot_20_MM2S_0 + 1) % 4;
+// CHECK: }
+// CHECK: // out[1024 : 4096]
+// CHECK-NOT: for
+// CHECK: __mlir_aie_try(__mlir_aie_shim_transfer(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_S2MM, /* BdNum */ 5 + slot_20_S2MM_0, addr_out + 0x1000, /* len */ 3072 * 4, /* slots */ 4));
+// CHECK: return XAIE_OK;
+// CHECK: } // mlir_aie_run_sequence_frames
+// CHECK: int mlir_aie_wait_sequence_frames(aie_libxaie_ctx_t* ctx, u32 timeoutUs) {
+// CHECK: __mlir_aie_try(XAie_DmaWaitForDone(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_MM2S, timeoutUs));
+// CHECK: __mlir_aie_try(XAie_DmaWaitForDone(&(ctx->DevInst), XAie_TileLoc(2,0), /* ChNum */ 0, /* dmaDir */ DMA_S2MM, timeoutUs));
+// CHECK: } // mlir_aie_wait_sequence_frames
+
+module @runtime_sequence {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %in = AIE.external_buffer { sym_name = "in" } : memref<4096xi32>
+  %out = AIE.external_buffer { sym_name = "out" } : memref<4096xi32>
+  %lut = AIE.external_buffer { sym_name = "lut" } : memref<64xi32>
+  %lock = AIE.lock(%t20, 0)
+  AIE.shimDMA(%t20) {
+    AIE.dmaStart(MM2S, 1, ^bd0, ^end)
+  ^bd0:
+    AIE.useLock(%lock, Acquire, 1)
+    AIE.dmaBd(<%lut : memref<64xi32>, 0, 64>, 0)
+    AIE.useLock(%lock, Release, 0)
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+  AIEX.runtime_sequence @frames {
+    AIEX.shim_dma_transfer(%t20, MM2S : 0, <%in : memref<4096xi32>, 0, 256>) { repeat = 16 : i32, stride = 256 : i32 }
+    AIEX.shim_dma_transfer(%t20, S2MM : 0, <%out : memref<4096xi32>, 1024, 3072>)
+  }
+ }
+}
@@ -0,0 +1,27 @@
+//===- test_error_dma_repeat.mlir ------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: (aie-translate --aie-generate-xaie %s 2>&1 || true) | FileCheck %s
+// CHECK: repeat counts are only supported for AIE-ML devices.
+
+module @test_error_dma_repeat {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %buf = AIE.buffer(%t33) { address = 0 : i32, sym_name = "buf" } : memref<256xi32>
+  AIE.mem(%t33) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end) { repeatCount = 4 : i32 }
+  ^bd0:
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0)
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+ }
+}
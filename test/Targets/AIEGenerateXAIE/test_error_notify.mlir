@@ -0,0 +1,19 @@
+//===- test_error_notify.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: (aie-translate --aie-generate-xaie %s 2>&1 || true) | FileCheck %s
+// CHECK: error: 'AIE.tile' op cannot notify the host of "core_event_0"
+
+// The tile has no core to raise the event.
+module @test_error_notify {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3) {notify = ["core_event_0"]}
+ }
+}
@@ -10,13 +10,8 @@
 
 // RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
 
-// CHECK: XAie_DmaDesc dma_tile33_bd0;
-// CHECK: __mlir_aie_try(XAie_DmaDescInit(&(ctx->DevInst), &(dma_tile33_bd0), XAie_TileLoc(3,3)));
-// CHECK: __mlir_aie_try(XAie_DmaSetLock(&(dma_tile33_bd0), XAie_LockInit(0,0),XAie_LockInit(0,1)));
-// CHECK: __mlir_aie_try(XAie_DmaSetAddrLen(&(dma_tile33_bd0), {{.*}} 0x1400, {{.*}} 256 * 4));
-// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&(dma_tile33_bd0), {{.*}} 0, {{.*}} 0));
-// CHECK: __mlir_aie_try(XAie_DmaEnableBd(&(dma_tile33_bd0)));
-// CHECK: __mlir_aie_try(XAie_DmaWriteBd(&(ctx->DevInst), &(dma_tile33_bd0), XAie_TileLoc(3,3), {{.*}} 0));
+// CHECK: static const u32 dma_tile33_bd0_regs[7] = {0x3D0500, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x800000FF};
+// CHECK: __mlir_aie_try(__mlir_aie_write_bd(&(ctx->DevInst), XAie_TileLoc(3,3),  /* bd */ 0, dma_tile33_bd0_regs));
 // CHECK: __mlir_aie_try(XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), XAie_TileLoc(3,3), {{.*}}0, {{.*}} DMA_MM2S, {{.*}}0));
 // CHECK: __mlir_aie_try(XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(3,3), {{.*}} 0, /* dmaDir */ DMA_MM2S));
 
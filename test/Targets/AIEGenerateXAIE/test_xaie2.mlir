@@ -11,20 +11,10 @@
 // RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
 
 // Test S2MM, BD chaining.
-// CHECK: XAie_DmaDesc [[bd0:.*]];
-// CHECK: __mlir_aie_try(XAie_DmaDescInit(&(ctx->DevInst), &([[bd0]]), XAie_TileLoc(3,3)));
-// CHECK: __mlir_aie_try(XAie_DmaSetLock(&([[bd0]]), XAie_LockInit(0,0),XAie_LockInit(0,1)));
-// CHECK: __mlir_aie_try(XAie_DmaSetAddrLen(&([[bd0]]), {{.*}}0x1000, {{.*}}256 * 4));
-// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd0]]), {{.*}}1, {{.*}}1));
-// CHECK: __mlir_aie_try(XAie_DmaEnableBd(&([[bd0]])));
-// CHECK: __mlir_aie_try(XAie_DmaWriteBd(&(ctx->DevInst), &([[bd0]]), XAie_TileLoc(3,3), {{.*}}0));
-// CHECK: XAie_DmaDesc [[bd1:.*]];
-// CHECK: __mlir_aie_try(XAie_DmaDescInit(&(ctx->DevInst), &([[bd1]]), XAie_TileLoc(3,3)));
-// CHECK: __mlir_aie_try(XAie_DmaSetLock(&([[bd1]]), XAie_LockInit(0,0),XAie_LockInit(0,1)));
-// CHECK: __mlir_aie_try(XAie_DmaSetAddrLen(&([[bd1]]), {{.*}}0x1400, {{.*}}4 * 4));
-// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd1]]), {{.*}}0, {{.*}}1));
-// CHECK: __mlir_aie_try(XAie_DmaEnableBd(&([[bd1]])));
-// CHECK: __mlir_aie_try(XAie_DmaWriteBd(&(ctx->DevInst), &([[bd1]]), XAie_TileLoc(3,3), {{.*}}1));
+// CHECK: static const u32 dma_tile33_bd0_regs[7] = {0x3D0400, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x800220FF};
+// CHECK: __mlir_aie_try(__mlir_aie_write_bd(&(ctx->DevInst), XAie_TileLoc(3,3),  /* bd */ 0, dma_tile33_bd0_regs));
+// CHECK: static const u32 dma_tile33_bd1_regs[7] = {0x3D0500, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x80020003};
+// CHECK: __mlir_aie_try(__mlir_aie_write_bd(&(ctx->DevInst), XAie_TileLoc(3,3),  /* bd */ 1, dma_tile33_bd1_regs));
 // CHECK: __mlir_aie_try(XAie_DmaChannelPushBdToQueue(&(ctx->DevInst), XAie_TileLoc(3,3), {{.*}}0, {{.*}}DMA_S2MM, {{.*}}0));
 // CHECK: __mlir_aie_try(XAie_DmaChannelEnable(&(ctx->DevInst), XAie_TileLoc(3,3), {{.*}}0, {{.*}}DMA_S2MM));
 
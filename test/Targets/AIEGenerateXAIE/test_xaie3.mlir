@@ -11,8 +11,7 @@
 // RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
 
 // Test acquire with '1'.   Single BD.
-// CHECK: XAie_DmaDesc [[bd0:.*]];
-// CHECK: __mlir_aie_try(XAie_DmaSetLock(&([[bd0]]), XAie_LockInit(0,1),XAie_LockInit(0,0)));
+// CHECK: static const u32 dma_tile33_bd0_regs[7] = {0x2F0000, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x800000FF};
 
 module @test_xaie3 {
  AIE.device(xcvc1902) {
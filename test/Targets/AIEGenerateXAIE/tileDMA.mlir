@@ -12,15 +12,10 @@
 
 // AIE.end is not the last block.
 
-// CHECK: XAie_DmaDesc [[bd0:.*]];
-// CHECK: __mlir_aie_try(XAie_DmaDescInit(&(ctx->DevInst), &([[bd0]]), XAie_TileLoc(8,3)));
-// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd0]]), {{.*}} 0, {{.*}} 1));
-// CHECK: __mlir_aie_try(XAie_DmaWriteBd(&(ctx->DevInst), &([[bd0]]), XAie_TileLoc(8,3), {{.*}} 0));
-
-// CHECK: XAie_DmaDesc [[bd1:.*]];
-// CHECK: __mlir_aie_try(XAie_DmaDescInit(&(ctx->DevInst), &([[bd1]]), XAie_TileLoc(8,3)));
-// CHECK: __mlir_aie_try(XAie_DmaSetNextBd(&([[bd1]]), {{.*}} 1, {{.*}} 1));
-// CHECK: __mlir_aie_try(XAie_DmaWriteBd(&(ctx->DevInst), &([[bd1]]), XAie_TileLoc(8,3), {{.*}} 1));
+// CHECK: static const u32 dma_tile83_bd0_regs[7] = {0x3D0400, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x8002003F};
+// CHECK: __mlir_aie_try(__mlir_aie_write_bd(&(ctx->DevInst), XAie_TileLoc(8,3),  /* bd */ 0, dma_tile83_bd0_regs));
+// CHECK: static const u32 dma_tile83_bd1_regs[7] = {0x6F0440, 0x0, 0xFF0001, 0xFFFF0100, 0x0, 0x0, 0x8002203F};
+// CHECK: __mlir_aie_try(__mlir_aie_write_bd(&(ctx->DevInst), XAie_TileLoc(8,3),  /* bd */ 1, dma_tile83_bd1_regs));
 
 
 module @aie_module  {
@@ -0,0 +1,33 @@
+//===- used_tiles.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck %s
+
+// Only the tiles the design uses are clocked, not the tile (4, 4).
+
+// CHECK-LABEL: int mlir_aie_init_device_used_tiles(aie_libxaie_ctx_t* ctx) {
+// CHECK-NEXT:   XAie_LocType tiles[] = {
+// CHECK-NEXT:     XAie_TileLoc(2, 0),
+// CHECK-NEXT:     XAie_TileLoc(2, 3),
+// CHECK-NEXT:   };
+// CHECK-NEXT:   return mlir_aie_init_device_tiles(ctx, tiles, 2);
+// CHECK-NEXT: }
+
+module @used_tiles {
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t23 = AIE.tile(2, 3)
+  %t44 = AIE.tile(4, 4)
+  %l20 = AIE.lock(%t20, 0)
+  %c23 = AIE.core(%t23) {
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,50 @@
+//===- symbol_table.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --aie-generate-symbol-table %s | FileCheck %s
+
+// CHECK: "arch": "AIE",
+// CHECK: "buffers": [
+// CHECK:     "address": 25694208,
+// CHECK:     "col": 3,
+// CHECK:     "name": "a",
+// CHECK:     "offset": 4096,
+// CHECK:     "row": 2,
+// CHECK:     "size": 64
+// CHECK:     "address": 25698304,
+// CHECK:     "col": 3,
+// CHECK:     "name": "b",
+// CHECK:     "offset": 8192,
+// CHECK:     "row": 2,
+// CHECK:     "size": 16
+// CHECK-NOT: "name": "c"
+// CHECK: "col_shift": 23,
+// CHECK: "locks": [
+// CHECK:     "col": 3,
+// CHECK:     "id": 0,
+// CHECK:     "init": 1,
+// CHECK:     "name": "lock_a",
+// CHECK:     "row": 2
+// CHECK:     "col": 3,
+// CHECK:     "id": 5,
+// CHECK-NOT: "name"
+// CHECK:     "row": 2
+// CHECK: "row_shift": 18
+
+module @symbol_table {
+ AIE.device(xcvc1902) {
+  %t32 = AIE.tile(3, 2)
+  %a = AIE.buffer(%t32) { sym_name = "a", address = 0x1000 } : memref<16xi32>
+  %b = AIE.buffer(%t32) { sym_name = "b", address = 0x2000 } : memref<4xi32>
+  %c = AIE.buffer(%t32) { address = 0x3000 } : memref<4xi32>
+  %l0 = AIE.lock(%t32, 0) { sym_name = "lock_a", init = 1 : i32 }
+  %l5 = AIE.lock(%t32, 5)
+ }
+}
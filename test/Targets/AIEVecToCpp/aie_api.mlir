@@ -0,0 +1,51 @@
+// RUN: aie-translate %s -aieml=true -aie-api -aievec-to-cpp | FileCheck %s
+
+// CHECK: #include <aie_api/aie.hpp>
+
+// CHECK-LABEL: void matmul_i8(int8_t * restrict [[PA:v[0-9]+]], int8_t * restrict [[PB:v[0-9]+]], int32_t * restrict [[PC:v[0-9]+]])
+// CHECK: aie::vector<int8, 32> [[A:v[0-9]+]] = aie::load_v<32>([[PA]]{{.*}});
+// CHECK: aie::vector<int8, 64> [[B:v[0-9]+]] = aie::load_v<64>([[PB]]{{.*}});
+// CHECK: aie::vector<int32, 32> [[C:v[0-9]+]] = aie::load_v<32>([[PC]]{{.*}});
+// CHECK: aie::accum<acc32, 32> [[ACC:v[0-9]+]] = aie::accum<acc32, 32>([[C]]);
+// CHECK: aie::mmul<4, 8, 8, int8, int8, acc32> [[MM:mmul[0-9]+]]([[ACC]]);
+// CHECK: [[MM]].mac([[A]], [[B]]);
+// CHECK: [[ACC]] = [[MM]].to_accum();
+// CHECK: aie::vector<int32, 32> [[RES:v[0-9]+]] = [[ACC]].to_vector<int32>();
+// CHECK: aie::store_v([[PC]]{{.*}}, [[RES]]);
+func.func @matmul_i8(%a : memref<32xi8>, %b : memref<64xi8>, %c : memref<32xi32>) {
+  %c0 = arith.constant 0 : index
+  %0 = aievec.upd %a[%c0] {index = 0 : i8, offset = 0 : si32} : memref<32xi8>, vector<32xi8>
+  %1 = aievec.upd %b[%c0] {index = 0 : i8, offset = 0 : si32} : memref<64xi8>, vector<64xi8>
+  %2 = aievec.upd %c[%c0] {index = 0 : i8, offset = 0 : si32} : memref<32xi32>, vector<32xi32>
+  %3 = aievec.cast %2 {isResAcc = true} : vector<32xi32>, vector<32xi32>
+  %4 = aievec.matmul %0, %1, %3 {K = 8 : i32, M = 4 : i32, N = 8 : i32} : vector<32xi8>, vector<64xi8> into vector<32xi32>
+  %5 = aievec.cast %4 {isResAcc = false} : vector<32xi32>, vector<32xi32>
+  vector.transfer_write %5, %c[%c0] {in_bounds = [true]} : vector<32xi32>, memref<32xi32>
+  return
+}
+
+// CHECK-LABEL: void mul_elem_i16(int16_t * restrict [[PX:v[0-9]+]], int16_t * restrict [[PY:v[0-9]+]], int16_t * restrict [[PZ:v[0-9]+]])
+// CHECK: aie::vector<int16, 32> [[T:v[0-9]+]] = aie::broadcast<int16, 32>(3);
+// CHECK: aie::vector<int16, 32> [[X:v[0-9]+]] = aie::load_v<32>([[PX]]{{.*}});
+// CHECK: aie::vector<int16, 32> [[Y:v[0-9]+]] = aie::load_v<32>([[PY]]{{.*}});
+// CHECK: aie::accum<acc32, 32> [[M:v[0-9]+]] = aie::mul<acc32>([[X]], [[Y]]);
+// CHECK: [[M]] = aie::mac([[M]], [[X]], [[Y]]);
+// CHECK: aie::vector<int16, 32> [[S:v[0-9]+]] = [[M]].to_vector<int16>(4);
+// CHECK: aie::vector<int16, 32> [[U:v[0-9]+]] = aie::max([[S]], [[T]]);
+// CHECK: aie::vector<int16, 16> [[L:v[0-9]+]] = [[U]].extract<16>(1);
+// CHECK: aie::vector<int16, 32> [[V:v[0-9]+]] = aie::concat([[L]], [[L]]);
+// CHECK: aie::store_v([[PZ]]{{.*}}, [[V]]);
+func.func @mul_elem_i16(%x : memref<32xi16>, %y : memref<32xi16>, %z : memref<32xi16>) {
+  %c0 = arith.constant 0 : index
+  %cst = arith.constant dense<3> : vector<32xi16>
+  %0 = aievec.upd %x[%c0] {index = 0 : i8, offset = 0 : si32} : memref<32xi16>, vector<32xi16>
+  %1 = aievec.upd %y[%c0] {index = 0 : i8, offset = 0 : si32} : memref<32xi16>, vector<32xi16>
+  %2 = aievec.mul_elem %0, %1 : vector<32xi16>, vector<32xi16>, vector<32xi32>
+  %3 = aievec.mac_elem %0, %1, %2 : vector<32xi16>, vector<32xi16>, vector<32xi32>
+  %4 = aievec.srs %3 {shift = 4 : i8} : vector<32xi32>, vector<32xi16>
+  %5 = aievec.max %4, %cst : vector<32xi16>
+  %6 = aievec.ext %5 {index = 1 : i8} : vector<32xi16>, vector<16xi16>
+  %7 = aievec.concat %6, %6 : vector<16xi16>, vector<32xi16>
+  vector.transfer_write %7, %z[%c0] {in_bounds = [true]} : vector<32xi16>, memref<32xi16>
+  return
+}
@@ -0,0 +1,7 @@
+// RUN: (aie-translate %s -aie-api -aievec-to-cpp 2>&1 || true) | FileCheck %s
+
+// CHECK: error: 'aievec.mul' op with lane selection is not supported by the AIE API emission
+func.func @mul_lanes(%a : vector<32xi16>, %b : vector<16xi16>) -> vector<16xi48> {
+  %m = aievec.mul %a, %b {xoffsets= "0x03020100", xoffsets_hi = "0x07060504", xsquare = "0x0000", xstart = "0", xstep = "0", zoffsets = "0x00000000", zoffsets_hi = "0x00000000", zsquare = "0x0000", zstart = "0", zstep = "1"} : vector<32xi16>, vector<16xi16>, vector<16xi48>
+  return %m : vector<16xi48>
+}
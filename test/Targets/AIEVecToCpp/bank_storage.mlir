@@ -0,0 +1,19 @@
+// RUN: aie-translate %s -aievec-to-cpp | FileCheck %s
+
+// CHECK: void external(int32_t chess_storage(DM_bankD) * restrict, int32_t * restrict);
+func.func private @external(memref<64xi32> {AIE.bank = 3 : i32}, memref<64xi32>)
+
+// CHECK-LABEL: void kernel
+// CHECK-SAME: (int32_t chess_storage(DM_bankA) * restrict [[A:v[0-9]+]], int32_t chess_storage(DM_bankB) * restrict [[B:v[0-9]+]], int32_t * restrict [[C:v[0-9]+]])
+// CHECK: = *(v8int32 chess_storage(DM_bankA) *)([[A]]{{.*}});
+// CHECK: = *(v8int32 chess_storage(DM_bankB) *)([[B]]{{.*}});
+// CHECK: *(v8int32 *)([[C]]{{.*}}) =
+func.func @kernel(%a : memref<64xi32> {AIE.bank = 0 : i32}, %b : memref<64xi32> {AIE.bank = 1 : i32}, %c : memref<64xi32>) {
+  %c0 = arith.constant 0 : index
+  %0 = aievec.upd %a[%c0] {index = 0 : i8, offset = 0 : si32} : memref<64xi32>, vector<8xi32>
+  %1 = aievec.upd %b[%c0] {index = 0 : i8, offset = 0 : si32} : memref<64xi32>, vector<8xi32>
+  %c8 = arith.constant 8 : index
+  vector.transfer_write %0, %c[%c0] {in_bounds = [true]} : vector<8xi32>, memref<64xi32>
+  vector.transfer_write %1, %c[%c8] {in_bounds = [true]} : vector<8xi32>, memref<64xi32>
+  return
+}
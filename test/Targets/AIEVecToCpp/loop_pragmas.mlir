@@ -0,0 +1,61 @@
+// RUN: aie-translate %s -aievec-to-cpp | FileCheck %s
+
+// CHECK-LABEL: void default_pragmas
+// CHECK: for (size_t [[I:.*]] = {{.*}}; [[I]] < {{.*}}; [[I]] += {{.*}})
+// CHECK-NEXT: chess_prepare_for_pipelining
+// CHECK-NEXT: chess_loop_range(16, 16)
+// CHECK-NEXT: {
+func.func @default_pragmas(%m : memref<64xi32>, %v : i32) {
+  %c0 = arith.constant 0 : index
+  %c4 = arith.constant 4 : index
+  %c64 = arith.constant 64 : index
+  scf.for %i = %c0 to %c64 step %c4 {
+    memref.store %v, %m[%i] : memref<64xi32>
+  }
+  return
+}
+
+// CHECK-LABEL: void unroll_flatten
+// CHECK: for (size_t [[I:.*]] = {{.*}}; [[I]] < {{.*}}; [[I]] += {{.*}})
+// CHECK-NEXT: chess_prepare_for_pipelining
+// CHECK-NEXT: chess_flatten_loop
+// CHECK-NEXT: chess_unroll_loop(2)
+// CHECK-NEXT: chess_loop_range(16, 16)
+// CHECK-NEXT: {
+func.func @unroll_flatten(%m : memref<64xi32>, %v : i32) {
+  %c0 = arith.constant 0 : index
+  %c4 = arith.constant 4 : index
+  %c64 = arith.constant 64 : index
+  scf.for %i = %c0 to %c64 step %c4 {
+    memref.store %v, %m[%i] : memref<64xi32>
+  } {aievec.flatten, aievec.unroll = 2 : i64}
+  return
+}
+
+// CHECK-LABEL: void no_pipelining
+// CHECK: for (size_t [[I:.*]] = {{.*}}; [[I]] < {{.*}}; [[I]] += {{.*}})
+// CHECK-NEXT: chess_loop_range(8, 32)
+// CHECK-NEXT: {
+func.func @no_pipelining(%m : memref<?xi32>, %n : index, %v : i32) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  scf.for %i = %c0 to %n step %c1 {
+    memref.store %v, %m[%i] : memref<?xi32>
+  } {aievec.pipeline = false, aievec.min_trip_count = 8 : i64,
+     aievec.max_trip_count = 32 : i64}
+  return
+}
+
+// CHECK-LABEL: void max_trip_count
+// CHECK: for (size_t [[I:.*]] = {{.*}}; [[I]] < {{.*}}; [[I]] += {{.*}})
+// CHECK-NEXT: chess_prepare_for_pipelining
+// CHECK-NEXT: chess_loop_range(0, 64)
+// CHECK-NEXT: {
+func.func @max_trip_count(%m : memref<?xi32>, %n : index, %v : i32) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  scf.for %i = %c0 to %n step %c1 {
+    memref.store %v, %m[%i] : memref<?xi32>
+  } {aievec.max_trip_count = 64 : i64}
+  return
+}
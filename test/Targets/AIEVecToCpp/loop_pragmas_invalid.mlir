@@ -0,0 +1,12 @@
+// RUN: (aie-translate %s -aievec-to-cpp 2>&1 || true) | FileCheck %s
+
+// CHECK: error: 'scf.for' op expects 'aievec.min_trip_count' not to exceed 'aievec.max_trip_count'
+func.func @invalid_range(%m : memref<64xi32>, %v : i32) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c64 = arith.constant 64 : index
+  scf.for %i = %c0 to %c64 step %c1 {
+    memref.store %v, %m[%i] : memref<64xi32>
+  } {aievec.min_trip_count = 32 : i64, aievec.max_trip_count = 16 : i64}
+  return
+}
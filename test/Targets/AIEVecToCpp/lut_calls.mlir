@@ -0,0 +1,14 @@
+// RUN: aie-translate %s -aieml=true -aievec-to-cpp | FileCheck %s
+
+// Only the exponential returns an accumulator.
+
+// CHECK-LABEL: v16bfloat16 lut_calls(v16bfloat16
+// CHECK: v16accfloat {{.*}} = getExpBf16(
+// CHECK: v16bfloat16 {{.*}} = getLogBf16(
+// CHECK: v16bfloat16 {{.*}} = getInvBf16(
+func.func @lut_calls(%arg0: vector<16xbf16>) -> vector<16xbf16> {
+  %0 = emitc.call "getExpBf16"(%arg0) : (vector<16xbf16>) -> vector<16xf32>
+  %1 = emitc.call "getLogBf16"(%arg0) : (vector<16xbf16>) -> vector<16xbf16>
+  %2 = emitc.call "getInvBf16"(%1) : (vector<16xbf16>) -> vector<16xbf16>
+  return %2 : vector<16xbf16>
+}
@@ -0,0 +1,31 @@
+// RUN: aie-translate %s -aievec-to-cpp -aievec-post-increment | FileCheck %s
+
+// The loads and the store of the inner loop go through pointers to the row
+// of the outer loop, bumped by the step of the inner loop. The two loads of
+// a share their pointer.
+// CHECK-LABEL: void copy(
+// CHECK: for ({{.*}} [[I:v[0-9]+]] = {{.*}})
+// CHECK: int32_t * [[PA:p[0-9]+]] = [[A:v[0-9]+]] + 64*[[I]]+[[LB:v[0-9]+]];
+// CHECK-NEXT: int32_t * [[PB:p[0-9]+]] = [[B:v[0-9]+]] + 64*[[I]]+[[LB]];
+// CHECK-NEXT: for ({{.*}} [[J:v[0-9]+]] = [[LB]]; [[J]] < {{.*}}; [[J]] += [[STEP:v[0-9]+]])
+// CHECK: = *(v8int32 *)([[PA]]);
+// CHECK: = *(v8int32 *)([[PA]] + 8);
+// CHECK: *(v8int32 *)([[PB]]) =
+// CHECK: [[PA]] += [[STEP]];
+// CHECK-NEXT: [[PB]] += [[STEP]];
+// CHECK-NEXT: }
+func.func @copy(%a : memref<4x64xi32>, %b : memref<4x64xi32>) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  %c8 = arith.constant 8 : index
+  %c56 = arith.constant 56 : index
+  scf.for %i = %c0 to %c4 step %c1 {
+    scf.for %j = %c0 to %c56 step %c8 {
+      %x = aievec.upd %a[%i, %j] {index = 0 : i8, offset = 0 : si32} : memref<4x64xi32>, vector<8xi32>
+      %y = aievec.upd %a[%i, %j] {index = 0 : i8, offset = 256 : si32} : memref<4x64xi32>, vector<8xi32>
+      vector.transfer_write %y, %b[%i, %j] {in_bounds = [true]} : vector<8xi32>, memref<4x64xi32>
+    }
+  }
+  return
+}
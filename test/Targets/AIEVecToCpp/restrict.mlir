@@ -0,0 +1,27 @@
+// RUN: aie-translate %s -aievec-to-cpp | FileCheck %s
+
+// The first two arguments of @in_place are the same memref at a call site.
+// CHECK: void in_place(int32_t * v{{[0-9]+}}, int32_t * v{{[0-9]+}}, int32_t * restrict v{{[0-9]+}})
+func.func @in_place(%a : memref<64xi32>, %b : memref<64xi32>, %c : memref<64xi32>, %v : i32) {
+  %c0 = arith.constant 0 : index
+  memref.store %v, %b[%c0] : memref<64xi32>
+  memref.store %v, %c[%c0] : memref<64xi32>
+  return
+}
+
+// The first and last arguments of @external are views of the same memref.
+// CHECK: void external(int32_t *, int32_t * restrict, int32_t *);
+func.func private @external(memref<64xi32>, memref<64xi32>, memref<8x8xi32>)
+
+// CHECK: void distinct(int32_t * restrict v{{[0-9]+}}, int32_t * restrict v{{[0-9]+}})
+func.func @distinct(%a : memref<64xi32>, %b : memref<64xi32>) {
+  return
+}
+
+func.func @caller(%x : memref<64xi32>, %y : memref<64xi32>, %v : i32) {
+  func.call @in_place(%x, %x, %y, %v) : (memref<64xi32>, memref<64xi32>, memref<64xi32>, i32) -> ()
+  func.call @distinct(%x, %y) : (memref<64xi32>, memref<64xi32>) -> ()
+  %e = memref.expand_shape %x [[0, 1]] : memref<64xi32> into memref<8x8xi32>
+  func.call @external(%x, %y, %e) : (memref<64xi32>, memref<64xi32>, memref<8x8xi32>) -> ()
+  return
+}
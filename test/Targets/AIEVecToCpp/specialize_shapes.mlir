@@ -0,0 +1,32 @@
+// RUN: aie-translate %s -aievec-to-cpp -aievec-specialize-shapes | FileCheck %s
+
+// @scale is a template over the size of its memref, instantiated for the
+// shape of its attribute and for the one of its call site.
+// CHECK-LABEL: template <size_t m0>
+// CHECK-NEXT: void scale(int32_t *{{( restrict)?}} [[A:v[0-9]+]], int32_t [[V:v[0-9]+]]) {
+// CHECK: for ({{.*}} < m0;
+// CHECK: void scale_64(int32_t *{{( restrict)?}} [[A0:v[0-9]+]], int32_t [[V0:v[0-9]+]]) {
+// CHECK-NEXT: scale<64>([[A0]], [[V0]]);
+// CHECK-NEXT: }
+// CHECK: void scale_128(int32_t *{{( restrict)?}} [[A1:v[0-9]+]], int32_t [[V1:v[0-9]+]]) {
+// CHECK-NEXT: scale<128>([[A1]], [[V1]]);
+// CHECK-NEXT: }
+func.func @scale(%a : memref<?xi32>, %v : i32) attributes {aievec.shapes = [array<i64: 64>]} {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %n = memref.dim %a, %c0 : memref<?xi32>
+  scf.for %i = %c0 to %n step %c1 {
+    %x = memref.load %a[%i] : memref<?xi32>
+    %y = arith.muli %x, %v : i32
+    memref.store %y, %a[%i] : memref<?xi32>
+  }
+  return
+}
+
+// CHECK-LABEL: void caller(
+// CHECK: scale<128>(
+func.func @caller(%b : memref<128xi32>, %v : i32) {
+  %c = memref.cast %b : memref<128xi32> to memref<?xi32>
+  func.call @scale(%c, %v) : (memref<?xi32>, i32) -> ()
+  return
+}
@@ -0,0 +1,36 @@
+//===- sweep.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// A benchmark whose run prints its size parameter as the median, swept over
+// two sizes, then compared with a run where the median is always 9.
+// RUN: rm -rf %t && mkdir -p %t/bench
+// RUN: printf '{"name": "fake", "params": {"size": [8, 16]}}' > %t/bench/bench.json
+// RUN: printf 'module { // size {size}\n}\n' > %t/bench/aie.mlir.in
+// RUN: aie-bench.py %t/bench --workdir %t/work --compile 'cat {mlir}' --run 'echo "{\"name\": \"s2mm\", \"p50\": {size}}"' -o %t/base.json --csv %t/base.csv | FileCheck %s --check-prefix=SWEEP
+// RUN: FileCheck %s --check-prefix=CSV < %t/base.csv
+// RUN: FileCheck %s --check-prefix=MLIR < %t/work/fake-1/aie.mlir
+// RUN: FileCheck %s --check-prefix=PARAMS < %t/work/fake-1/bench_params.h
+// RUN: not aie-bench.py %t/bench --workdir %t/work --param size=8,32 --compile true --run 'echo "{\"name\": \"s2mm\", \"p50\": 9}"' --baseline %t/base.json --tolerance 10 | FileCheck %s --check-prefix=BASELINE
+
+// SWEEP: fake size=8 s2mm: p50=8
+// SWEEP: fake size=16 s2mm: p50=16
+
+// CSV: benchmark,size,name,n,outliers,min,max,mean,sdev,p50,p90,p99
+// CSV: fake,8,s2mm,,,,,,,8,,
+// CSV: fake,16,s2mm,,,,,,,16,,
+
+// MLIR: // size 16
+
+// PARAMS: #define SIZE 16
+
+// BASELINE: fake size=8 s2mm: p50=9
+// BASELINE: fake size=32 s2mm: p50=9
+// BASELINE: REGRESSION fake size=8 s2mm: p50 8 -> 9
+// BASELINE-NOT: REGRESSION
@@ -0,0 +1,46 @@
+//===- designs.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-compile-bench.py --emit 2x2 | FileCheck %s --check-prefix=DESIGN
+// RUN: aie-compile-bench.py --emit 4x2 | aie-opt --aie-create-pathfinder-flows --aie-objectFifo-stateful-transform --aie-create-packet-flows --aie-assign-buffer-addresses | FileCheck %s --check-prefix=LOWERED
+// RUN: rm -rf %t && aie-compile-bench.py --sizes 2x2,4x2 --workdir %t -o %t/results.json | FileCheck %s --check-prefix=TIMES
+// RUN: FileCheck %s --check-prefix=JSON < %t/results.json
+// RUN: printf '[{"design": "2x2", "pipeline": "fake", "seconds": 0.001, "peak_rss_kb": 1}]' > %t/baseline.json
+// RUN: not aie-compile-bench.py --sizes 2x2 --workdir %t --pipelines fake --pipeline fake=true --baseline %t/baseline.json | FileCheck %s --check-prefix=BASELINE
+
+// DESIGN: // 2x2 cores, 4 flows, 2 objectFifos, 2 packet flows
+// DESIGN: AIE.device(xcvc1902)
+// DESIGN-COUNT-4: AIE.tile
+// DESIGN: AIE.buffer(%t1_1) : memref<64xi32>
+// DESIGN: AIE.flow(%t1_1, DMA : 0, %t2_1, DMA : 0)
+// DESIGN: AIE.packet_flow(0) {
+// DESIGN-NEXT: AIE.packet_source<%t1_1, Core : 0>
+// DESIGN-NEXT: AIE.packet_dest<%t1_2, Core : 0>
+// DESIGN: AIE.objectFifo @of0 (%t1_1, {%t1_2}, 1 : i32)
+// DESIGN: AIE.objectFifo @of1 (%t2_1, {%t2_2}, 2 : i32)
+// DESIGN: AIE.core(%t1_1) {
+// DESIGN: AIE.objectFifo.acquire @of0 (Produce, 1)
+
+// LOWERED: AIE.switchbox
+// LOWERED: AIE.core
+
+// TIMES: 2x2 pathfinder:
+// TIMES: 2x2 objectfifo:
+// TIMES: 2x2 packet:
+// TIMES: 2x2 buffers:
+// TIMES: 4x2 buffers:
+// TIMES: pathfinder: time grows as cores^
+
+// JSON: "design": "2x2",
+// JSON-NEXT: "pipeline": "pathfinder",
+// JSON: "peak_rss_kb":
+// JSON: "passes": {
+
+// BASELINE: REGRESSION 2x2 fake: peak_rss_kb 1 ->
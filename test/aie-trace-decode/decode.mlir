@@ -0,0 +1,27 @@
+//===- decode.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// A packet of ID 1 from the core of tile (2, 3): a start frame at cycle 100,
+// single frames of events 1 and 2, a multiple frame of both, repeated twice,
+// and a single frame of event 0. The empty word after it is not a header.
+// RUN: printf '80430001\nf0000000\n00000064\n15912ce0\n63fc0204\nffffffff\nffffffff\nffffffff\n00000000\n' > %t.hex
+// RUN: aie-trace-decode.py %t.hex --clock-mhz 1 --events 1=active,lock_stall,stream_stall | FileCheck %s
+
+// CHECK: {"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "tile(2, 3) core"}}
+// CHECK: {"name": "thread_name", "ph": "M", "pid": 1, "tid": 0, "args": {"name": "active"}}
+// CHECK: {"name": "lock_stall", "ph": "B", "ts": 105.0, "pid": 1, "tid": 1}
+// CHECK: {"name": "lock_stall", "ph": "E", "ts": 405.0, "pid": 1, "tid": 1}
+// CHECK: {"name": "stream_stall", "ph": "B", "ts": 405.0, "pid": 1, "tid": 2}
+// CHECK: {"name": "lock_stall", "ph": "B", "ts": 408.0, "pid": 1, "tid": 1}
+// CHECK: {"name": "lock_stall", "ph": "E", "ts": 418.0, "pid": 1, "tid": 1}
+// CHECK: {"name": "stream_stall", "ph": "E", "ts": 418.0, "pid": 1, "tid": 2}
+// CHECK: {"name": "active", "ph": "B", "ts": 418.0, "pid": 1, "tid": 0}
+// CHECK: {"name": "active", "ph": "E", "ts": 418.0, "pid": 1, "tid": 0}
+// CHECK-NOT: "pid": 0
@@ -0,0 +1,30 @@
+//===- bytecode.mlir -------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --unified --no-compile --no-link -nv --tmpdir=%t.prj --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+// RUN: aie-opt %t.prj/input_with_addresses.mlir | FileCheck %s --check-prefix=DESIGN
+
+// The design moves between the tools of the flow as MLIR bytecode.
+
+// CHECK-DAG: aie-opt --aie-create-pathfinder-flows {{.*}} --emit-bytecode {{.*}}input_with_addresses.mlir -o {{.*}}input_physical.mlir
+// CHECK-DAG: aie-opt --aie-localize-locks --aie-standard-lowering {{.*}} --emit-bytecode {{.*}}input_with_addresses.mlir -o {{.*}}input_opt_with_addresses.mlir
+
+// DESIGN: AIE.buffer({{.*}}) {address = {{.*}} : i32, sym_name = "a"} : memref<256xi32>
+
+module {
+  %13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+}
@@ -0,0 +1,44 @@
+//===- dedup_cores.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc --dedup-cores -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+// RUN: aiecc.py --unified --compile --no-link --no-xchesscc --dedup-cores -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck --check-prefix=UNIFIED %s
+
+// The memory maps of the cores are generated at once, and the cores are
+// lowered at once before the host code, which loads the ELF files of
+// identical cores once.
+
+// CHECK: --aie-generate-all
+// CHECK: aie-standard-lowering=output-dir={{.*}}cores core-pipeline=
+// CHECK-NOT: tilecol=
+// CHECK: --aie-generate-xaie
+
+// The unified compilation shares the code of identical cores instead.
+
+// UNIFIED: --aie-standard-lowering=share-cores
+
+module {
+  %13 = AIE.tile(1, 3)
+  %14 = AIE.tile(1, 4)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %buf14 = AIE.buffer(%14) { sym_name = "b" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+  %c14 = AIE.core(%14)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf14[%1] : memref<256xi32>
+    AIE.end
+  }
+}
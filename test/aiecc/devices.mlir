@@ -0,0 +1,46 @@
+//===- devices.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+
+// The passes run on both devices at once, then each device is compiled in
+// its own directory of the project, without the host code.
+
+// CHECK: The design has 2 devices
+// CHECK-DAG: --aie-generate-all --aie-output-dir={{.*}}device0 {{.*}}device0{{/|\\}}input_with_addresses.mlir
+// CHECK-DAG: --aie-generate-all --aie-output-dir={{.*}}device1 {{.*}}device1{{/|\\}}input_with_addresses.mlir
+// CHECK-DAG: --aie-generate-xaie {{.*}}device0{{/|\\}}input_physical.mlir
+// CHECK-DAG: --aie-generate-xaie {{.*}}device1{{/|\\}}input_physical.mlir
+// CHECK-DAG: {{^llc}} {{.*}}device0{{/|\\}}core_1_3.stripped.ll
+// CHECK-DAG: {{^llc}} {{.*}}device1{{/|\\}}core_2_3.stripped.ll
+// CHECK-NOT: {{^clang\+\+}}
+
+module {
+  AIE.device(xcvc1902) {
+    %13 = AIE.tile(1, 3)
+    %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+    %c13 = AIE.core(%13) {
+      %0 = arith.constant 0 : i32
+      %1 = arith.constant 0 : index
+      memref.store %0, %buf13[%1] : memref<256xi32>
+      AIE.end
+    }
+  }
+  AIE.device(xcvc1902) {
+    %23 = AIE.tile(2, 3)
+    %buf23 = AIE.buffer(%23) { sym_name = "b" } : memref<256xi32>
+    %c23 = AIE.core(%23) {
+      %0 = arith.constant 1 : i32
+      %1 = arith.constant 0 : index
+      memref.store %0, %buf23[%1] : memref<256xi32>
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,31 @@
+//===- in_process.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc --in-process -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+
+// The aie-opt passes and the aie-translate translations run through the
+// Python bindings, opt and llc still run as processes.
+
+// CHECK-DAG: aie-opt --aie-create-pathfinder-flows {{.*}} (in process)
+// CHECK-DAG: aie-translate --aie-generate-xaie {{.*}} (in process)
+// CHECK-DAG: aie-standard-lowering=output-dir={{.*}} (in process)
+// CHECK-DAG: aie-translate --opaque-pointers=0 --mlir-to-llvmir {{.*}} (in process)
+// CHECK-DAG: {{^llc}}
+
+module {
+  %13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+}
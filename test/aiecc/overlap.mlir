@@ -0,0 +1,31 @@
+//===- overlap.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+
+// The cores and the architecture are read from the module after the passes,
+// and the host code is generated without waiting for the cores.
+
+// CHECK-NOT: --aie-generate-corelist
+// CHECK-NOT: --aie-generate-target-arch
+// CHECK: --aie-create-pathfinder-flows
+// CHECK: aie-standard-lowering=output-dir=
+// CHECK: {{^llc}}
+
+module {
+  %13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+}
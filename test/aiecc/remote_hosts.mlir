@@ -0,0 +1,28 @@
+//===- remote_hosts.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --link --xchesscc --no-xbridge --remote-hosts=farm1:2,farm2 -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+
+// The chess compilations of the cores run on the remote hosts, which get the
+// LLVM IR of the core and send back its object file.
+
+// CHECK: tar -cPf - {{.*}}core_1_3.llchesslinked.ll | ssh farm{{[12]}} {{.*}}xchesscc_wrapper {{.*}}tar -cPf - {{.*}}core_1_3.o' | tar -xPf -
+// CHECK: {{^clang}} {{.*}}core_1_3.elf
+
+module {
+  %13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+}
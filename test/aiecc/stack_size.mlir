@@ -0,0 +1,28 @@
+//===- stack_size.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc --infer-stack-size -nv --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf | FileCheck %s
+
+// CHECK: {{^llc}}
+// CHECK-SAME: --stack-size-section
+// CHECK: llvm-readobj --stack-sizes
+// CHECK: {{^llc}}
+// CHECK-NOT: --stack-size-section
+
+module {
+  %12 = AIE.tile(1, 2)
+  %buf = AIE.buffer(%12) : memref<256xi32>
+  %4 = AIE.core(%12)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf[%1] : memref<256xi32>
+    AIE.end
+  }
+}
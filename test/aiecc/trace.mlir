@@ -0,0 +1,32 @@
+//===- trace.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aiecc.py --no-unified --compile --no-link --no-xchesscc -n --trace=%t.json --sysroot=%VITIS_SYSROOT% --host-target=aarch64-linux-gnu %s -I%host_runtime_lib% %host_runtime_lib%/test_library.cpp %S/test.cpp -o test.elf
+// RUN: FileCheck %s < %t.json
+
+// CHECK: "traceEvents"
+// CHECK-DAG: "name": "aiecc passes"
+// CHECK-DAG: "cat": "core lowering"
+// CHECK-DAG: "cat": "routing"
+// CHECK-DAG: "name": "llc"
+// CHECK-DAG: "cat": "core compilation"
+// CHECK-DAG: "core": "(1, 3)"
+// CHECK-DAG: "name": "wait for worker"
+
+module {
+  %13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%13) { sym_name = "a" } : memref<256xi32>
+  %c13 = AIE.core(%13)  {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %buf13[%1] : memref<256xi32>
+    AIE.end
+  }
+}
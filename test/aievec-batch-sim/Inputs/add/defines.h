@@ -0,0 +1,4 @@
+#pragma once
+constexpr unsigned const IN0_SIZE = 16;
+// The cycles fake_sim.py reports for the kernel.
+constexpr int CYCLES = 100;
@@ -0,0 +1,8 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#define TO_STR_(x) #x
+#define TO_STR(x) TO_STR_(x)
+#ifndef DATA_DIR
+#define DATA_DIR data
+#endif
@@ -0,0 +1,29 @@
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+# Stands in for xca_udm_dbg: prints what the kernels of the batch.cc of the
+# current directory print when they run, with the CYCLES of their defines.h
+# and --extra cycles more.
+
+import argparse
+import re
+
+parser = argparse.ArgumentParser()
+parser.add_argument('--extra', type=int, default=0)
+args = parser.parse_args()
+
+source = open('batch.cc').read()
+cycles = {}
+for namespace, body in re.findall(r'namespace (\w+) \{(.*?)\} // namespace',
+                                  source, re.S):
+    header = re.search(r'#include "(\S+defines.h)"', body).group(1)
+    cycles[namespace] = int(re.search(r'CYCLES = (\d+)',
+                                      open(header).read()).group(1))
+for name, namespace in re.findall(
+        r'printf\("KERNEL (\S+)\\n"\);\s+failed \+= (\w+)::run', source):
+    print('KERNEL ' + name)
+    print('Cycle count: %d' % (cycles[namespace] + args.extra))
+    print('TEST PASSED')
@@ -0,0 +1,13 @@
+#include "../common/testbench.h"
+#include "defines.h"
+#include <cstdint>
+void dut(int *in0, int *out0);
+
+int main(int argc, char *argv[]) {
+  std::string dataDir(TO_STR(DATA_DIR));
+  int in0[IN0_SIZE] = {0}, out0[IN0_SIZE];
+  dut(in0, out0);
+  printf("Cycle count: %d\n", CYCLES);
+  printf("TEST PASSED\n");
+  return 0;
+}
@@ -0,0 +1,42 @@
+//===- batch.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// The compiler and the simulator commands stand in for xchesscc_wrapper and
+// xca_udm_dbg: fake_sim.py runs the kernels of the batch and reports the
+// cycles of their defines.h, and 10 more with --extra 10.
+// RUN: rm -rf %t.work %t.json
+// RUN: aievec-batch-sim.py %S/Inputs --work-dir %t.work --compiler 'test -s {source}' --simulator 'python3 %S/Inputs/fake_sim.py' --baseline %t.json --update-baseline | FileCheck %s
+// RUN: FileCheck --check-prefix=BATCH %s < %t.work/batches/0/batch.cc
+// RUN: FileCheck --check-prefix=JSON %s < %t.json
+// RUN: not aievec-batch-sim.py %S/Inputs --work-dir %t.work --compiler 'test -s {source}' --simulator 'python3 %S/Inputs/fake_sim.py --extra 10' --baseline %t.json --tolerance 5 | FileCheck --check-prefix=REGRESSION %s
+
+// CHECK: add/add: PASSED, 100 cycles
+// CHECK: mul/mul: PASSED, 200 cycles
+
+// BATCH: #include "{{.*}}Inputs/common/testbench.h"
+// BATCH: #include <cstdint>
+// BATCH: #define main run
+// BATCH: #define DATA_DIR data_0
+// BATCH: namespace aievec_batch_0_add_add {
+// BATCH: #include "{{.*}}Inputs/add/defines.h"
+// BATCH: void dut(int *in0, int *out0) {}
+// BATCH: } // namespace aievec_batch_0_add_add
+// BATCH: #define DATA_DIR data_1
+// BATCH: namespace aievec_batch_1_mul_mul {
+// BATCH: #undef main
+// BATCH: failed += aievec_batch_0_add_add::run(argc, argv) != 0;
+// BATCH: failed += aievec_batch_1_mul_mul::run(argc, argv) != 0;
+
+// JSON: "add/add": 100,
+// JSON: "mul/mul": 200
+
+// REGRESSION: add/add: PASSED, 110 cycles (baseline 100, +10.0%) REGRESSION
+// REGRESSION-NOT: REGRESSION
+// REGRESSION: mul/mul: PASSED, 210 cycles (baseline 200, +5.0%)
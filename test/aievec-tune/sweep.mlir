@@ -0,0 +1,44 @@
+//===- sweep.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// The measure command stands in for a simulation: it checks that the kernel
+// was generated and reports fewer cycles for larger shifts.
+// RUN: rm -f %t.json
+// RUN: aievec-tune.py %s --shift 0,10 --dup-factor 1,2 --cache %t.json -o %t.cc --measure 'test -s {cpp} && echo "cycles: $(( 100 - {shift} + {dup_factor} ))"' | FileCheck %s
+// RUN: FileCheck --check-prefix=CPP %s < %t.cc
+// RUN: aievec-tune.py %s --shift 0,10 --dup-factor 1,2 --cache %t.json --measure false | FileCheck --check-prefix=CACHED %s
+
+// CHECK: vector_size=16 shift=0 zero_offset=0 dup_factor=1: 101 cycles
+// CHECK: vector_size=16 shift=10 zero_offset=0 dup_factor=2: 92 cycles
+// CHECK: best: vector_size=16 shift=10 zero_offset=0 dup_factor=1, 91 cycles
+// CHECK: aie-opt --aievec-raise-to-affine -affine-super-vectorize="virtual-vector-size=16" --aie-vectorize="shift=10 zero-offset=0 dup-factor=1"
+
+// CPP: void conv1d(
+
+// CACHED: cached
+// CACHED: best: vector_size=16 shift=10 zero_offset=0 dup_factor=1, 91 cycles
+
+func.func @conv1d(%A: memref<272xi16>, %B: memref<16xi16>, %C: memref<256xi16>) {
+  affine.for %i = 0 to 256 {
+    %a0 = affine.load %A[%i] : memref<272xi16>
+    %b0 = affine.load %B[0] : memref<16xi16>
+    %p0 = arith.muli %a0, %b0 : i16
+    %a1 = affine.load %A[%i + 1] : memref<272xi16>
+    %b1 = affine.load %B[1] : memref<16xi16>
+    %p1 = arith.muli %a1, %b1 : i16
+    %c1 = arith.addi %p0, %p1 : i16
+    %a2 = affine.load %A[%i + 2] : memref<272xi16>
+    %b2 = affine.load %B[2] : memref<16xi16>
+    %p2 = arith.muli %a2, %b2 : i16
+    %c2 = arith.addi %c1, %p2 : i16
+    affine.store %c2, %C[%i] : memref<256xi16>
+  }
+  return
+}
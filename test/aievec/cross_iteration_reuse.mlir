@@ -0,0 +1,33 @@
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=16" --aie-vectorize="shift=0 zero-offset=4 cross-iteration-reuse=true" -unaligned-loads-check=false | FileCheck %s
+
+// The upper half of the window of an iteration is the lower half of the
+// window of the next one: only the upper half is loaded in the loop.
+
+//CHECK-LABEL: func.func @conv1d
+func.func @conv1d(%A: memref<2048xi16>, %B: memref<4xi16>, %C: memref<2046xi16>) {
+    affine.for %arg4 = 0 to 2046 {
+        %ci = affine.load %C[%arg4] : memref<2046xi16>
+        %a1 = affine.load %A[%arg4] : memref<2048xi16>
+        %b1 = affine.load %B[0] : memref<4xi16>
+        %p1 = arith.muli %a1, %b1 : i16
+        %c1 = arith.addi %ci, %p1 : i16
+        %a2 = affine.load %A[%arg4+1] : memref<2048xi16>
+        %b2 = affine.load %B[1] : memref<4xi16>
+        %p2 = arith.muli %a2, %b2 : i16
+        %c2 = arith.addi %c1, %p2 : i16
+        %a3 = affine.load %A[%arg4+2] : memref<2048xi16>
+        %b3 = affine.load %B[2] : memref<4xi16>
+        %p3 = arith.muli %a3, %b3 : i16
+        %c3 = arith.addi %c2, %p3 : i16
+        affine.store %c3, %C[%arg4] : memref<2046xi16>
+    }
+    return
+}
+
+//CHECK: %[[INIT:.*]] = aievec.upd %arg0[%{{.*}}] {index = 1 : i8, offset = 0 : si32} : memref<2048xi16>, vector<32xi16>
+//CHECK: scf.for %[[IV:.*]] = %{{.*}} to %{{.*}} step %{{.*}} iter_args(%[[WIN:.*]] = %[[INIT]]) -> (vector<32xi16>) {
+//CHECK-NOT: aievec.upd %arg0[%[[IV]]] {index = 0
+//CHECK: %[[UP:.*]] = aievec.ext %[[WIN]] {index = 1 : i8} : vector<32xi16>, vector<16xi16>
+//CHECK: %[[CAT:.*]] = aievec.concat %[[UP]], %[[UP]] : vector<16xi16>, vector<32xi16>
+//CHECK: %[[NEXT:.*]] = aievec.upd %arg0[%[[IV]]], %[[CAT]] {index = 1 : i8, offset = 256 : si32} : memref<2048xi16>, vector<32xi16>
+//CHECK: scf.yield %[[NEXT]] : vector<32xi16>
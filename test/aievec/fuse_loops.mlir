@@ -0,0 +1,99 @@
+// RUN: aie-opt %s --aievec-fuse-loops -split-input-file | FileCheck %s
+
+// The exp loop of a softmax and the sum of its results run in one loop,
+// which sums the exponentials without loading them back. The scaling by the
+// inverse of the sum needs the whole sum and stays in its own loop.
+
+// CHECK-LABEL: func.func @softmax
+// CHECK:         %[[SUM:.*]] = affine.for %[[I:.*]] = 0 to 1024 step 16 iter_args(%[[ACC:.*]] = %{{.*}}) -> (vector<16xf32>) {
+// CHECK:           %[[X:.*]] = vector.transfer_read %arg0[%[[I]]]
+// CHECK:           %[[E:.*]] = math.exp %[[X]] : vector<16xbf16>
+// CHECK:           vector.transfer_write %[[E]], %arg0[%[[I]]]
+// CHECK-NOT:       vector.transfer_read
+// CHECK:           %[[EXT:.*]] = arith.extf %[[E]] : vector<16xbf16> to vector<16xf32>
+// CHECK:           %[[ADD:.*]] = arith.addf %[[ACC]], %[[EXT]] : vector<16xf32>
+// CHECK:           affine.yield %[[ADD]] : vector<16xf32>
+// CHECK:         }
+// CHECK:         vector.reduction <add>, %[[SUM]]
+// CHECK:         affine.for
+// CHECK:           vector.transfer_read %arg0
+// CHECK:           arith.mulf
+func.func @softmax(%arg0: memref<1024xbf16>, %arg1: memref<1024xbf16>) {
+  %cst = arith.constant 1.000000e+00 : f32
+  %zero = arith.constant dense<0.000000e+00> : vector<16xf32>
+  %pad = arith.constant 0.000000e+00 : bf16
+  affine.for %i = 0 to 1024 step 16 {
+    %x = vector.transfer_read %arg0[%i], %pad {in_bounds = [true]} : memref<1024xbf16>, vector<16xbf16>
+    %e = math.exp %x : vector<16xbf16>
+    vector.transfer_write %e, %arg0[%i] {in_bounds = [true]} : vector<16xbf16>, memref<1024xbf16>
+  }
+  %sum = affine.for %i = 0 to 1024 step 16 iter_args(%acc = %zero) -> (vector<16xf32>) {
+    %e = vector.transfer_read %arg0[%i], %pad {in_bounds = [true]} : memref<1024xbf16>, vector<16xbf16>
+    %ext = arith.extf %e : vector<16xbf16> to vector<16xf32>
+    %add = arith.addf %acc, %ext : vector<16xf32>
+    affine.yield %add : vector<16xf32>
+  }
+  %s = vector.reduction <add>, %sum : vector<16xf32> into f32
+  %inv = arith.divf %cst, %s : f32
+  %invbf = arith.truncf %inv : f32 to bf16
+  %scale = vector.broadcast %invbf : bf16 to vector<16xbf16>
+  affine.for %i = 0 to 1024 step 16 {
+    %e = vector.transfer_read %arg0[%i], %pad {in_bounds = [true]} : memref<1024xbf16>, vector<16xbf16>
+    %m = arith.mulf %e, %scale : vector<16xbf16>
+    vector.transfer_write %m, %arg1[%i] {in_bounds = [true]} : vector<16xbf16>, memref<1024xbf16>
+  }
+  return
+}
+
+// -----
+
+// The sum and the sum of squares of a layernorm read the input once.
+
+// CHECK-LABEL: func.func @sum_and_squares
+// CHECK:         %[[R:.*]]:2 = affine.for %[[I:.*]] = 0 to 256 step 16 iter_args(%[[S:.*]] = %{{.*}}, %[[SQ:.*]] = %{{.*}}) -> (vector<16xf32>, vector<16xf32>) {
+// CHECK-COUNT-2:   vector.transfer_read %arg0[%[[I]]]
+// CHECK:           affine.yield %{{.*}}, %{{.*}} : vector<16xf32>, vector<16xf32>
+// CHECK:         }
+// CHECK:         return %[[R]]#0, %[[R]]#1
+func.func @sum_and_squares(%arg0: memref<256xf32>) -> (vector<16xf32>, vector<16xf32>) {
+  %zero = arith.constant dense<0.000000e+00> : vector<16xf32>
+  %pad = arith.constant 0.000000e+00 : f32
+  %sum = affine.for %i = 0 to 256 step 16 iter_args(%acc = %zero) -> (vector<16xf32>) {
+    %x = vector.transfer_read %arg0[%i], %pad {in_bounds = [true]} : memref<256xf32>, vector<16xf32>
+    %add = arith.addf %acc, %x : vector<16xf32>
+    affine.yield %add : vector<16xf32>
+  }
+  %squares = affine.for %i = 0 to 256 step 16 iter_args(%acc = %zero) -> (vector<16xf32>) {
+    %x = vector.transfer_read %arg0[%i], %pad {in_bounds = [true]} : memref<256xf32>, vector<16xf32>
+    %sq = arith.mulf %x, %x : vector<16xf32>
+    %add = arith.addf %acc, %sq : vector<16xf32>
+    affine.yield %add : vector<16xf32>
+  }
+  return %sum, %squares : vector<16xf32>, vector<16xf32>
+}
+
+// -----
+
+// The second loop reads what the next iteration of the first loop writes:
+// the loops are not fused.
+
+// CHECK-LABEL: func.func @shifted
+// CHECK:         affine.for
+// CHECK:           vector.transfer_write
+// CHECK:         }
+// CHECK:         affine.for
+// CHECK:           vector.transfer_read %arg0[%{{.*}}]
+// CHECK:         }
+func.func @shifted(%arg0: memref<272xf32>, %arg1: memref<256xf32>) {
+  %pad = arith.constant 0.000000e+00 : f32
+  %one = arith.constant dense<1.000000e+00> : vector<16xf32>
+  affine.for %i = 0 to 256 step 16 {
+    vector.transfer_write %one, %arg0[%i] {in_bounds = [true]} : vector<16xf32>, memref<272xf32>
+  }
+  affine.for %i = 0 to 256 step 16 {
+    %j = affine.apply affine_map<(d0) -> (d0 + 16)>(%i)
+    %x = vector.transfer_read %arg0[%j], %pad {in_bounds = [true]} : memref<272xf32>, vector<16xf32>
+    vector.transfer_write %x, %arg1[%i] {in_bounds = [true]} : vector<16xf32>, memref<256xf32>
+  }
+  return
+}
@@ -0,0 +1,56 @@
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=16" --aie-vectorize -split-input-file | FileCheck %s
+
+// The shift of each output channel, and the ReLU, are folded in the srs
+// moving the accumulator to a vector.
+
+// CHECK-LABEL: func.func @requant_per_channel
+// CHECK-SAME: memref<16x256xi16>, %[[S:[A-Za-z0-9]+]]: memref<16xi16>)
+func.func @requant_per_channel(%A: memref<16x256xi16>, %B: memref<16xi16>, %C: memref<16x256xi16>, %S: memref<16xi16>) {
+  %zero = arith.constant 0 : i16
+  // CHECK: scf.for %[[CH:.*]] =
+  affine.for %arg3 = 0 to 16 {
+    // CHECK: %[[SHIFT:.*]] = memref.load %[[S]][%[[CH]]] : memref<16xi16>
+    %s = affine.load %S[%arg3] : memref<16xi16>
+    // CHECK: scf.for
+    affine.for %arg4 = 0 to 256 {
+      %ci = affine.load %C[%arg3, %arg4] : memref<16x256xi16>
+      %a = affine.load %A[%arg3, %arg4] : memref<16x256xi16>
+      %b = affine.load %B[%arg3] : memref<16xi16>
+      %p = arith.muli %a, %b : i16
+      // CHECK: %[[ACC:.*]] = aievec.mac
+      %c = arith.addi %ci, %p : i16
+      // CHECK-NOT: arith.shrsi
+      // CHECK: %[[SRS:.*]] = aievec.srs %[[ACC]], %[[SHIFT]] {shift = 0 : i8} : vector<16xi48>, i16, vector<16xi16>
+      %r = arith.shrsi %c, %s : i16
+      // CHECK-NOT: arith.maxsi
+      // CHECK: %[[RELU:.*]] = aievec.max %[[SRS]], %{{.*}} : vector<16xi16>
+      %z = arith.maxsi %r, %zero : i16
+      // CHECK: vector.transfer_write %[[RELU]]
+      affine.store %z, %C[%arg3, %arg4] : memref<16x256xi16>
+    }
+  }
+  return
+}
+
+// -----
+
+// A constant shift is folded in the shift of the srs.
+
+// CHECK-LABEL: func.func @requant_constant
+func.func @requant_constant(%A: memref<256xi16>, %B: memref<16xi16>, %C: memref<256xi16>) {
+  %shift = arith.constant 6 : i16
+  affine.for %arg3 = 0 to 256 {
+    %ci = affine.load %C[%arg3] : memref<256xi16>
+    %a = affine.load %A[%arg3] : memref<256xi16>
+    %b = affine.load %B[0] : memref<16xi16>
+    %p = arith.muli %a, %b : i16
+    // CHECK: %[[ACC:.*]] = aievec.mac
+    %c = arith.addi %ci, %p : i16
+    // CHECK-NOT: arith.shrsi
+    // CHECK: %[[SRS:.*]] = aievec.srs %[[ACC]] {shift = 6 : i8} : vector<16xi48>, vector<16xi16>
+    %r = arith.shrsi %c, %shift : i16
+    // CHECK: vector.transfer_write %[[SRS]]
+    affine.store %r, %C[%arg3] : memref<256xi16>
+  }
+  return
+}
@@ -0,0 +1,66 @@
+// RUN: aie-opt %s --aievec-interchange-loops -split-input-file | FileCheck %s
+
+// The j loop of a matmul is parallel and contiguous in B and C, it moves
+// innermost. The k loop carries the sums of C and is not vectorized.
+
+// CHECK-LABEL: func.func @matmul
+// CHECK:         affine.for %[[I:.*]] = 0 to 16 {
+// CHECK-NEXT:      affine.for %[[K:.*]] = 0 to 32 {
+// CHECK-NEXT:        affine.for %[[J:.*]] = 0 to 64 {
+// CHECK-NEXT:          affine.load %arg0[%[[I]], %[[K]]]
+// CHECK-NEXT:          affine.load %arg1[%[[K]], %[[J]]]
+// CHECK-NEXT:          affine.load %arg2[%[[I]], %[[J]]]
+func.func @matmul(%A: memref<16x32xi32>, %B: memref<32x64xi32>, %C: memref<16x64xi32>) {
+  affine.for %i = 0 to 16 {
+    affine.for %j = 0 to 64 {
+      affine.for %k = 0 to 32 {
+        %a = affine.load %A[%i, %k] : memref<16x32xi32>
+        %b = affine.load %B[%k, %j] : memref<32x64xi32>
+        %c = affine.load %C[%i, %j] : memref<16x64xi32>
+        %p = arith.muli %a, %b : i32
+        %s = arith.addi %c, %p : i32
+        affine.store %s, %C[%i, %j] : memref<16x64xi32>
+      }
+    }
+  }
+  return
+}
+
+// -----
+
+// The loop over the columns of a 2-D sweep is moved innermost, while the
+// loop over the rows carries the dependence and moves out.
+
+// CHECK-LABEL: func.func @column_sweep
+// CHECK:         affine.for %[[I:.*]] = 1 to 16 {
+// CHECK-NEXT:      affine.for %[[J:.*]] = 0 to 64 {
+// CHECK-NEXT:        affine.load %arg0[%[[I]] - 1, %[[J]]]
+func.func @column_sweep(%A: memref<16x64xf32>, %B: memref<16x64xf32>) {
+  affine.for %j = 0 to 64 {
+    affine.for %i = 1 to 16 {
+      %a = affine.load %A[%i - 1, %j] : memref<16x64xf32>
+      %b = affine.load %B[%i, %j] : memref<16x64xf32>
+      %s = arith.addf %a, %b : f32
+      affine.store %s, %A[%i, %j] : memref<16x64xf32>
+    }
+  }
+  return
+}
+
+// -----
+
+// A nest which already runs along its contiguous dimension is left alone.
+
+// CHECK-LABEL: func.func @copy
+// CHECK:         affine.for %[[I:.*]] = 0 to 16 {
+// CHECK-NEXT:      affine.for %[[J:.*]] = 0 to 64 {
+// CHECK-NEXT:        affine.load %arg0[%[[I]], %[[J]]]
+func.func @copy(%A: memref<16x64xi16>, %B: memref<16x64xi16>) {
+  affine.for %i = 0 to 16 {
+    affine.for %j = 0 to 64 {
+      %a = affine.load %A[%i, %j] : memref<16x64xi16>
+      affine.store %a, %B[%i, %j] : memref<16x64xi16>
+    }
+  }
+  return
+}
@@ -0,0 +1,45 @@
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --aie-vectorize="shift=0 num-accumulators=2" -unaligned-loads-check=false | FileCheck %s
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --aie-vectorize="shift=0" -unaligned-loads-check=false | FileCheck %s --check-prefix=SERIAL
+
+// A 4-tap correlation: the taps alternate between two accumulators, added
+// together before the store.
+
+// CHECK-LABEL: func.func @corr
+// CHECK: %[[M0:.*]] = aievec.mul
+// CHECK: %[[M1:.*]] = aievec.mul
+// CHECK: %[[F0:.*]] = aievec.mac %{{.*}}, %{{.*}}, %[[M0]]
+// CHECK: %[[S0:.*]] = aievec.srs %[[F0]]
+// CHECK: %[[F1:.*]] = aievec.mac %{{.*}}, %{{.*}}, %[[M1]]
+// CHECK: %[[S1:.*]] = aievec.srs %[[F1]]
+// CHECK: %[[SUM:.*]] = aievec.add %[[S0]], %[[S1]]
+// CHECK: vector.transfer_write %[[SUM]]
+
+// SERIAL-LABEL: func.func @corr
+// SERIAL: %[[M0:.*]] = aievec.mul
+// SERIAL: %[[F0:.*]] = aievec.mac %{{.*}}, %{{.*}}, %[[M0]]
+// SERIAL: %[[F1:.*]] = aievec.mac %{{.*}}, %{{.*}}, %[[F0]]
+// SERIAL: %[[F2:.*]] = aievec.mac %{{.*}}, %{{.*}}, %[[F1]]
+// SERIAL: %[[S:.*]] = aievec.srs %[[F2]]
+// SERIAL-NOT: aievec.add
+// SERIAL: vector.transfer_write %[[S]]
+func.func @corr(%A: memref<1032xi32>, %B: memref<8xi32>, %C: memref<1024xi32>) {
+  affine.for %i = 0 to 1024 {
+    %a0 = affine.load %A[%i] : memref<1032xi32>
+    %b0 = affine.load %B[0] : memref<8xi32>
+    %p0 = arith.muli %a0, %b0 : i32
+    %a1 = affine.load %A[%i + 1] : memref<1032xi32>
+    %b1 = affine.load %B[1] : memref<8xi32>
+    %p1 = arith.muli %a1, %b1 : i32
+    %s1 = arith.addi %p0, %p1 : i32
+    %a2 = affine.load %A[%i + 2] : memref<1032xi32>
+    %b2 = affine.load %B[2] : memref<8xi32>
+    %p2 = arith.muli %a2, %b2 : i32
+    %s2 = arith.addi %s1, %p2 : i32
+    %a3 = affine.load %A[%i + 3] : memref<1032xi32>
+    %b3 = affine.load %B[3] : memref<8xi32>
+    %p3 = arith.muli %a3, %b3 : i32
+    %s3 = arith.addi %s2, %p3 : i32
+    affine.store %s3, %C[%i] : memref<1024xi32>
+  }
+  return
+}
@@ -0,0 +1,49 @@
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=16" --aie-vectorize="shift=10 peel-remainder=true" -split-input-file | FileCheck %s
+
+// The last 2 iterations run in a scalar epilogue.
+
+// CHECK-LABEL: func.func @pointwise_mult
+func.func @pointwise_mult(%A: memref<2050xi16>, %B: memref<2050xi16>, %C: memref<2050xi16>) {
+    affine.for %arg0 = 0 to 2050 {
+       %a = affine.load %A[%arg0] : memref<2050xi16>
+       %b = affine.load %B[%arg0] : memref<2050xi16>
+       %c = arith.muli %a, %b : i16
+       affine.store %c, %C[%arg0] : memref<2050xi16>
+    }
+    return
+}
+
+//CHECK-DAG: %[[C16:.*]] = arith.constant 16 : index
+//CHECK-DAG: %[[C2048:.*]] = arith.constant 2048 : index
+//CHECK-DAG: %[[C2050:.*]] = arith.constant 2050 : index
+//CHECK: scf.for %[[IV:.*]] = %{{.*}} to %[[C2048]] step %[[C16]] {
+//CHECK: %[[MUL:.*]] = aievec.mul %{{.*}}, %{{.*}} : vector<16xi16>, vector<16xi16>, vector<16xi48>
+//CHECK: %[[SRS:.*]] = aievec.srs %[[MUL]]
+//CHECK: vector.transfer_write %[[SRS]], %arg2[%[[IV]]]
+//CHECK: scf.for %[[SIV:.*]] = %[[C2048]] to %[[C2050]] step %{{.*}} {
+//CHECK: %[[A:.*]] = memref.load %arg0[%[[SIV]]] : memref<2050xi16>
+//CHECK: %[[B:.*]] = memref.load %arg1[%[[SIV]]] : memref<2050xi16>
+//CHECK: %[[P:.*]] = arith.muli %[[A]], %[[B]] : i16
+//CHECK: memref.store %[[P]], %arg2[%[[SIV]]] : memref<2050xi16>
+
+// -----
+
+// A loop shorter than the vector size only runs the scalar loop.
+
+// CHECK-LABEL: func.func @add_splat
+func.func @add_splat(%A: memref<10xi16>, %B: memref<1xi16>, %C: memref<10xi16>) {
+    affine.for %arg0 = 0 to 10 {
+      %a = affine.load %A[%arg0] : memref<10xi16>
+      %b = affine.load %B[0] : memref<1xi16>
+      %c = arith.addi %a, %b : i16
+      affine.store %c, %C[%arg0] : memref<10xi16>
+    }
+    return
+}
+
+//CHECK-NOT: vector<16xi16>
+//CHECK: scf.for %[[SIV:.*]] = %{{.*}} to %{{.*}} step %{{.*}} {
+//CHECK: %[[A:.*]] = memref.load %arg0[%[[SIV]]] : memref<10xi16>
+//CHECK: %[[B:.*]] = memref.load %arg1[%{{.*}}] : memref<1xi16>
+//CHECK: %[[S:.*]] = arith.addi %[[A]], %[[B]] : i16
+//CHECK: memref.store %[[S]], %arg2[%[[SIV]]] : memref<10xi16>
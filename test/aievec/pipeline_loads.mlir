@@ -0,0 +1,55 @@
+// RUN: aie-opt %s --aievec-pipeline-loads -split-input-file | FileCheck %s
+
+// The loads of the first iteration are issued before the loop, the loop
+// loads the data of the next iteration while computing the current one, and
+// the last iteration is computed after the loop.
+
+// CHECK-LABEL: func.func @pipeline
+// CHECK:         %[[A0:.*]] = aievec.upd %arg0[%c0] {{.*}} : memref<256xi16>, vector<32xi16>
+// CHECK:         %[[B0:.*]] = aievec.upd %arg1[%c0] {{.*}} : memref<16xi16>, vector<16xi16>
+// CHECK:         %[[R:.*]]:2 = scf.for %[[I:.*]] = %c0 to %c240 step %c16 iter_args(%[[A:.*]] = %[[A0]], %[[B:.*]] = %[[B0]])
+// CHECK-DAG:       %[[M:.*]] = aievec.mul %[[A]], %[[B]]
+// CHECK-DAG:       aievec.upd %arg0
+// CHECK-DAG:       aievec.upd %arg1
+// CHECK:           aievec.srs %[[M]]
+// CHECK:           vector.transfer_write {{.*}} %arg2[%[[I]]]
+// CHECK:           scf.yield
+// CHECK:         }
+// CHECK:         %[[ML:.*]] = aievec.mul %[[R]]#0, %[[R]]#1
+// CHECK:         aievec.srs %[[ML]]
+// CHECK:         vector.transfer_write
+func.func @pipeline(%A: memref<256xi16>, %B: memref<16xi16>, %C: memref<256xi16>) {
+  %c0 = arith.constant 0 : index
+  %c16 = arith.constant 16 : index
+  %c256 = arith.constant 256 : index
+  scf.for %i = %c0 to %c256 step %c16 {
+    %a = aievec.upd %A[%i] {index = 0 : i8, offset = 0 : si32} : memref<256xi16>, vector<32xi16>
+    %b = aievec.upd %B[%c0] {index = 0 : i8, offset = 0 : si32} : memref<16xi16>, vector<16xi16>
+    %m = aievec.mul %a, %b {xoffsets= "0x03020100", xoffsets_hi = "0x07060504", xsquare = "0x0000", xstart = "0", xstep = "0", zoffsets = "0x00000000", zoffsets_hi = "0x00000000", zsquare = "0x0000", zstart = "0", zstep = "1"} : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %s = aievec.srs %m {shift = 0 : i8} : vector<16xi48>, vector<16xi16>
+    vector.transfer_write %s, %C[%i] {in_bounds = [true]} : vector<16xi16>, memref<256xi16>
+  }
+  return
+}
+
+// -----
+
+// The loop updates in place the data it loads: the loads cannot move ahead
+// of the stores.
+
+// CHECK-LABEL: func.func @inplace
+// CHECK:         scf.for
+// CHECK-NEXT:      aievec.upd %arg0
+func.func @inplace(%A: memref<256xi16>, %B: memref<16xi16>) {
+  %c0 = arith.constant 0 : index
+  %c16 = arith.constant 16 : index
+  %c256 = arith.constant 256 : index
+  scf.for %i = %c0 to %c256 step %c16 {
+    %a = aievec.upd %A[%i] {index = 0 : i8, offset = 0 : si32} : memref<256xi16>, vector<32xi16>
+    %b = aievec.upd %B[%c0] {index = 0 : i8, offset = 0 : si32} : memref<16xi16>, vector<16xi16>
+    %m = aievec.mul %a, %b {xoffsets= "0x03020100", xoffsets_hi = "0x07060504", xsquare = "0x0000", xstart = "0", xstep = "0", zoffsets = "0x00000000", zoffsets_hi = "0x00000000", zsquare = "0x0000", zstart = "0", zstep = "1"} : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %s = aievec.srs %m {shift = 0 : i8} : vector<16xi48>, vector<16xi16>
+    vector.transfer_write %s, %A[%i] {in_bounds = [true]} : vector<16xi16>, memref<256xi16>
+  }
+  return
+}
@@ -0,0 +1,77 @@
+// RUN: aie-opt %s --aievec-raise-to-affine -split-input-file | FileCheck %s
+
+// The scf loops of a frontend and their index arithmetic are raised to
+// affine loops and accesses, which the affine super-vectorizer vectorizes.
+
+// CHECK-LABEL: func.func @conv1d
+// CHECK-NOT:     arith.addi %{{.*}} : index
+// CHECK:         affine.for %[[I:.*]] = 0 to 254 {
+// CHECK-NEXT:      %[[A0:.*]] = affine.load %arg0[%[[I]]] : memref<256xi32>
+// CHECK-NEXT:      %[[A1:.*]] = affine.load %arg0[%[[I]] + 1] : memref<256xi32>
+// CHECK-NEXT:      %[[A2:.*]] = affine.load %arg0[%[[I]] + 2] : memref<256xi32>
+// CHECK:           affine.store %{{.*}}, %arg1[%[[I]]] : memref<254xi32>
+// CHECK-NEXT:    }
+func.func @conv1d(%A: memref<256xi32>, %B: memref<254xi32>) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c2 = arith.constant 2 : index
+  %c254 = arith.constant 254 : index
+  scf.for %i = %c0 to %c254 step %c1 {
+    %i1 = arith.addi %i, %c1 : index
+    %i2 = arith.addi %i, %c2 : index
+    %a0 = memref.load %A[%i] : memref<256xi32>
+    %a1 = memref.load %A[%i1] : memref<256xi32>
+    %a2 = memref.load %A[%i2] : memref<256xi32>
+    %s0 = arith.addi %a0, %a1 : i32
+    %s1 = arith.addi %s0, %a2 : i32
+    memref.store %s1, %B[%i] : memref<254xi32>
+  }
+  return
+}
+
+// -----
+
+// The linearized indices of a nest become the affine maps of the accesses,
+// and the bounds of the inner loop may depend on the outer one.
+
+// CHECK-LABEL: func.func @linearized
+// CHECK:         affine.for %[[I:.*]] = 0 to 16 {
+// CHECK-NEXT:      affine.for %[[J:.*]] = %[[I]] to 64 {
+// CHECK-NEXT:        affine.load %arg0[%[[I]] * 64 + %[[J]]] : memref<1024xi16>
+// CHECK:             affine.store %{{.*}}, %arg1[%[[I]], %[[J]]] : memref<16x64xi16>
+func.func @linearized(%A: memref<1024xi16>, %B: memref<16x64xi16>) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c16 = arith.constant 16 : index
+  %c64 = arith.constant 64 : index
+  scf.for %i = %c0 to %c16 step %c1 {
+    scf.for %j = %i to %c64 step %c1 {
+      %row = arith.muli %i, %c64 : index
+      %idx = arith.addi %row, %j : index
+      %a = memref.load %A[%idx] : memref<1024xi16>
+      %b = arith.addi %a, %a : i16
+      memref.store %b, %B[%i, %j] : memref<16x64xi16>
+    }
+  }
+  return
+}
+
+// -----
+
+// A loop with a step only known at runtime stays an scf loop, and so do its
+// accesses.
+
+// CHECK-LABEL: func.func @dynamic_step
+// CHECK:         scf.for
+// CHECK:           memref.load
+// CHECK:           memref.store
+func.func @dynamic_step(%A: memref<256xi32>, %step: index) {
+  %c0 = arith.constant 0 : index
+  %c256 = arith.constant 256 : index
+  scf.for %i = %c0 to %c256 step %step {
+    %a = memref.load %A[%i] : memref<256xi32>
+    %b = arith.addi %a, %a : i32
+    memref.store %b, %A[%i] : memref<256xi32>
+  }
+  return
+}
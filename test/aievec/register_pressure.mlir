@@ -0,0 +1,44 @@
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --aie-vectorize 2>&1 | FileCheck %s
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --aie-vectorize="limit-register-pressure=true" 2>&1 | FileCheck %s
+
+// All ten loaded vectors are live at the first add: they do not fit in the
+// vector registers.
+
+// CHECK: register_pressure.mlir:[[@LINE+1]]:1: remark: kernel will likely spill
+func.func @spill(%A: memref<256xi32>, %B: memref<256xi32>, %C: memref<256xi32>, %D: memref<256xi32>, %E: memref<256xi32>, %F: memref<256xi32>, %G: memref<256xi32>, %H: memref<256xi32>, %I: memref<256xi32>, %J: memref<256xi32>, %S: memref<256xi32>) {
+    affine.for %arg0 = 0 to 256 {
+      %a = affine.load %A[%arg0] : memref<256xi32>
+      %b = affine.load %B[%arg0] : memref<256xi32>
+      %c = affine.load %C[%arg0] : memref<256xi32>
+      %d = affine.load %D[%arg0] : memref<256xi32>
+      %e = affine.load %E[%arg0] : memref<256xi32>
+      %f = affine.load %F[%arg0] : memref<256xi32>
+      %g = affine.load %G[%arg0] : memref<256xi32>
+      %h = affine.load %H[%arg0] : memref<256xi32>
+      %i = affine.load %I[%arg0] : memref<256xi32>
+      %j = affine.load %J[%arg0] : memref<256xi32>
+      %s0 = arith.addi %a, %b : i32
+      %s1 = arith.addi %s0, %c : i32
+      %s2 = arith.addi %s1, %d : i32
+      %s3 = arith.addi %s2, %e : i32
+      %s4 = arith.addi %s3, %f : i32
+      %s5 = arith.addi %s4, %g : i32
+      %s6 = arith.addi %s5, %h : i32
+      %s7 = arith.addi %s6, %i : i32
+      %s8 = arith.addi %s7, %j : i32
+      affine.store %s8, %S[%arg0] : memref<256xi32>
+    }
+    return
+}
+
+// CHECK-NOT: remark
+// CHECK-LABEL: func.func @nospill
+func.func @nospill(%A: memref<256xi32>, %B: memref<256xi32>, %S: memref<256xi32>) {
+    affine.for %arg0 = 0 to 256 {
+      %a = affine.load %A[%arg0] : memref<256xi32>
+      %b = affine.load %B[%arg0] : memref<256xi32>
+      %s = arith.addi %a, %b : i32
+      affine.store %s, %S[%arg0] : memref<256xi32>
+    }
+    return
+}
@@ -0,0 +1,38 @@
+//===- banks.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// a and b are loaded in the same loop, so b goes to another bank than a.  c is
+// not accessed with them and fills the gap left below b.
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "a"} : memref<256xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 4096 : i32, sym_name = "b"} : memref<256xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 2048 : i32, sym_name = "c"} : memref<256xi32>
+
+module @test {
+ AIE.device(xcvc1902) {
+  %0 = AIE.tile(3, 3)
+  %a = AIE.buffer(%0) { sym_name = "a" } : memref<256xi32>
+  %b = AIE.buffer(%0) { sym_name = "b" } : memref<256xi32>
+  %c = AIE.buffer(%0) { sym_name = "c" } : memref<256xi32>
+  AIE.core(%0) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c256 = arith.constant 256 : index
+    scf.for %i = %c0 to %c256 step %c1 {
+      %x = memref.load %a[%i] : memref<256xi32>
+      %y = memref.load %b[%i] : memref<256xi32>
+      %s = arith.addi %x, %y : i32
+      memref.store %s, %a[%i] : memref<256xi32>
+    }
+    AIE.end
+  }
+ }
+}
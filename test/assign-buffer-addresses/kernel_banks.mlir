@@ -0,0 +1,32 @@
+//===- kernel_banks.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// The first argument of @kernel is always passed a buffer of bank 1.  The
+// second one is passed buffers of banks 2 and 4, and the third one a buffer
+// crossing from bank 2 to bank 3, so they are not annotated.
+// CHECK: func.func private @kernel(memref<256xi32> {AIE.bank = 1 : i32}, memref<256xi32>, memref<256xi32>)
+
+module @test {
+ AIE.device(xcvc1902) {
+  %0 = AIE.tile(3, 3)
+  %a = AIE.buffer(%0) { sym_name = "a", address = 0x1000 } : memref<256xi32>
+  %b = AIE.buffer(%0) { sym_name = "b", address = 0x2000 } : memref<256xi32>
+  %c = AIE.buffer(%0) { sym_name = "c", address = 0x2E00 } : memref<256xi32>
+  %d = AIE.buffer(%0) { sym_name = "d", address = 0x4000 } : memref<256xi32>
+  func.func private @kernel(memref<256xi32>, memref<256xi32>, memref<256xi32>)
+  AIE.core(%0) {
+    func.call @kernel(%a, %b, %c) : (memref<256xi32>, memref<256xi32>, memref<256xi32>) -> ()
+    func.call @kernel(%a, %d, %c) : (memref<256xi32>, memref<256xi32>, memref<256xi32>) -> ()
+    AIE.end
+  }
+ }
+}
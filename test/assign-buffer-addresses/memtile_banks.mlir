@@ -0,0 +1,42 @@
+//===- memtile_banks.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// a and c are streamed by channel 0 and b by channel 1, so b goes to another
+// bank than a and c.
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 0 : i32, sym_name = "a"} : memref<4096xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 32768 : i32, sym_name = "b"} : memref<4096xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 16384 : i32, sym_name = "c"} : memref<4096xi32>
+
+module @test {
+ AIE.device(xcve2302) {
+  %t21 = AIE.tile(2, 1)
+  %a = AIE.buffer(%t21) { sym_name = "a" } : memref<4096xi32>
+  %b = AIE.buffer(%t21) { sym_name = "b" } : memref<4096xi32>
+  %c = AIE.buffer(%t21) { sym_name = "c" } : memref<4096xi32>
+  AIE.memTileDMA(%t21) {
+    %s0 = AIE.dmaStart(MM2S, 0, ^bd0, ^next)
+  ^bd0:
+    AIE.dmaBd(<%a : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd1
+  ^bd1:
+    AIE.dmaBd(<%c : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd0
+  ^next:
+    %s1 = AIE.dmaStart(MM2S, 1, ^bd2, ^end)
+  ^bd2:
+    AIE.dmaBd(<%b : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd2
+  ^end:
+    AIE.end
+  }
+ }
+}
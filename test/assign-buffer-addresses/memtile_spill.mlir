@@ -0,0 +1,40 @@
+//===- memtile_spill.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// b does not fit next to a, and goes to the memtile east of the DMA streaming
+// it.
+// CHECK:   %[[T21:.*]] = AIE.tile(2, 1)
+// CHECK:   %[[T31:.*]] = AIE.tile(3, 1)
+// CHECK:   AIE.buffer(%[[T21]]) {address = 0 : i32, sym_name = "a"} : memref<120000xi32>
+// CHECK:   AIE.buffer(%[[T31]]) {address = 0 : i32, sym_name = "b"} : memref<16384xi32>
+
+module @test {
+ AIE.device(xcve2302) {
+  %t21 = AIE.tile(2, 1)
+  %t31 = AIE.tile(3, 1)
+  %a = AIE.buffer(%t21) { sym_name = "a" } : memref<120000xi32>
+  %b = AIE.buffer(%t21) { sym_name = "b" } : memref<16384xi32>
+  AIE.memTileDMA(%t21) {
+    %s0 = AIE.dmaStart(MM2S, 0, ^bd0, ^next)
+  ^bd0:
+    AIE.dmaBd(<%a : memref<120000xi32>, 0, 120000>, 0)
+    AIE.nextBd ^bd0
+  ^next:
+    %s1 = AIE.dmaStart(MM2S, 1, ^bd1, ^end)
+  ^bd1:
+    AIE.dmaBd(<%b : memref<16384xi32>, 0, 16384>, 0)
+    AIE.nextBd ^bd1
+  ^end:
+    AIE.end
+  }
+ }
+}
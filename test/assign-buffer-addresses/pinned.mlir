@@ -0,0 +1,26 @@
+//===- pinned.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// a keeps its address, and b is aligned after it.
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "a"} : memref<6xi8>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 1056 : i32, sym_name = "b"} : memref<8xi32>
+
+module @test {
+ AIE.device(xcvc1902) {
+  %0 = AIE.tile(3, 3)
+  %a = AIE.buffer(%0) { address = 1024 : i32, sym_name = "a" } : memref<6xi8>
+  %b = AIE.buffer(%0) { sym_name = "b" } : memref<8xi32>
+  AIE.core(%0) {
+    AIE.end
+  }
+ }
+}
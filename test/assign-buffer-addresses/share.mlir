@@ -0,0 +1,61 @@
+//===- share.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses="share-buffers=true" %s | FileCheck %s
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s --check-prefix=NOSHARE
+
+// a is only used in the first loop and b in the second one, so they share
+// their memory.  c is used in both loops, and d by the DMA.
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "a"} : memref<256xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "b"} : memref<128xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 4096 : i32, sym_name = "c"} : memref<64xi32>
+// CHECK:   {{.*}} AIE.buffer({{.*}}) {address = 2048 : i32, sym_name = "d"} : memref<64xi32>
+
+// NOSHARE:   {{.*}} AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "a"} : memref<256xi32>
+// NOSHARE:   {{.*}} AIE.buffer({{.*}}) {address = 2048 : i32, sym_name = "b"} : memref<128xi32>
+
+module @test {
+ AIE.device(xcvc1902) {
+  %0 = AIE.tile(3, 3)
+  %a = AIE.buffer(%0) { sym_name = "a" } : memref<256xi32>
+  %b = AIE.buffer(%0) { sym_name = "b" } : memref<128xi32>
+  %c = AIE.buffer(%0) { sym_name = "c" } : memref<64xi32>
+  %d = AIE.buffer(%0) { sym_name = "d" } : memref<64xi32>
+  %l = AIE.lock(%0, 0)
+  AIE.core(%0) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c64 = arith.constant 64 : index
+    scf.for %i = %c0 to %c64 step %c1 {
+      %x = memref.load %a[%i] : memref<256xi32>
+      memref.store %x, %c[%i] : memref<64xi32>
+    }
+    scf.for %i = %c0 to %c64 step %c1 {
+      %x = memref.load %c[%i] : memref<64xi32>
+      memref.store %x, %b[%i] : memref<128xi32>
+    }
+    AIE.useLock(%l, Acquire, 0)
+    %x = memref.load %c[%c0] : memref<64xi32>
+    memref.store %x, %d[%c0] : memref<64xi32>
+    AIE.useLock(%l, Release, 1)
+    AIE.end
+  }
+  AIE.mem(%0) {
+    %dma = AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.useLock(%l, Acquire, 1)
+    AIE.dmaBd(<%d : memref<64xi32>, 0, 64>, 0)
+    AIE.useLock(%l, Release, 0)
+    AIE.nextBd ^end
+  ^end:
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,46 @@
+//===- spill.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-buffer-addresses %s | FileCheck %s
+
+// b does not fit next to a, and goes to the memory of the tile north of the
+// core using it.  c is used by a DMA and stays in the memory of its tile.
+// CHECK:   %[[T33:.*]] = AIE.tile(3, 3)
+// CHECK:   %[[T34:.*]] = AIE.tile(3, 4)
+// CHECK:   AIE.buffer(%[[T33]]) {address = 1024 : i32, sym_name = "a"} : memref<6144xi32>
+// CHECK:   AIE.buffer(%[[T34]]) {address = 0 : i32, sym_name = "b"} : memref<2048xi32>
+// CHECK:   AIE.buffer(%[[T33]]) {address = 25600 : i32, sym_name = "c"} : memref<1024xi32>
+
+module @test {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %t34 = AIE.tile(3, 4)
+  %a = AIE.buffer(%t33) { sym_name = "a" } : memref<6144xi32>
+  %b = AIE.buffer(%t33) { sym_name = "b" } : memref<2048xi32>
+  %c = AIE.buffer(%t33) { sym_name = "c" } : memref<1024xi32>
+  %l = AIE.lock(%t33, 0)
+  AIE.core(%t33) {
+    %c0 = arith.constant 0 : index
+    %x = memref.load %a[%c0] : memref<6144xi32>
+    memref.store %x, %b[%c0] : memref<2048xi32>
+    AIE.end
+  }
+  AIE.mem(%t33) {
+    %dma = AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.useLock(%l, Acquire, 1)
+    AIE.dmaBd(<%c : memref<1024xi32>, 0, 1024>, 0)
+    AIE.useLock(%l, Release, 0)
+    AIE.nextBd ^end
+  ^end:
+    AIE.end
+  }
+ }
+}
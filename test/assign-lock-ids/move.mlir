@@ -0,0 +1,46 @@
+//===- move.mlir -----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-lock-ids %s | FileCheck %s
+
+// All the locks of tile (2, 2) are taken, so the lock used by its core goes to
+// the tile north of it.
+// CHECK: %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK: AIE.lock(%[[T23]], 0)
+
+module @test_move_lock {
+ AIE.device(xcve2302) {
+  %t22 = AIE.tile(2, 2)
+  %t23 = AIE.tile(2, 3)
+
+  %l0 = AIE.lock(%t22, 0)
+  %l1 = AIE.lock(%t22, 1)
+  %l2 = AIE.lock(%t22, 2)
+  %l3 = AIE.lock(%t22, 3)
+  %l4 = AIE.lock(%t22, 4)
+  %l5 = AIE.lock(%t22, 5)
+  %l6 = AIE.lock(%t22, 6)
+  %l7 = AIE.lock(%t22, 7)
+  %l8 = AIE.lock(%t22, 8)
+  %l9 = AIE.lock(%t22, 9)
+  %l10 = AIE.lock(%t22, 10)
+  %l11 = AIE.lock(%t22, 11)
+  %l12 = AIE.lock(%t22, 12)
+  %l13 = AIE.lock(%t22, 13)
+  %l14 = AIE.lock(%t22, 14)
+  %l15 = AIE.lock(%t22, 15)
+  %l = AIE.lock(%t22)
+
+  AIE.core(%t22) {
+    AIE.useLock(%l, AcquireGreaterEqual, 1)
+    AIE.end
+  }
+ }
+}
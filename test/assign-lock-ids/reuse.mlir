@@ -0,0 +1,50 @@
+//===- reuse.mlir ----------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-lock-ids %s | FileCheck %s
+
+// %a and %b are only used by the core, one after the other, and share a
+// lockID.  %c is also used by the DMA, and %d is left with another value.
+// CHECK: %[[A:.*]] = AIE.lock(%{{.*}}, 0)
+// CHECK: %[[B:.*]] = AIE.lock(%{{.*}}, 0)
+// CHECK: %[[C:.*]] = AIE.lock(%{{.*}}, 1)
+// CHECK: %[[D:.*]] = AIE.lock(%{{.*}}, 2)
+
+module @test_reuse_lockIDs {
+ AIE.device(xcve2302) {
+  %t22 = AIE.tile(2, 2)
+  %buf = AIE.buffer(%t22) : memref<16xi32>
+
+  %a = AIE.lock(%t22)
+  %b = AIE.lock(%t22)
+  %c = AIE.lock(%t22)
+  %d = AIE.lock(%t22)
+
+  AIE.core(%t22) {
+    AIE.useLock(%a, Release, 1)
+    AIE.useLock(%a, AcquireGreaterEqual, 1)
+    AIE.useLock(%c, AcquireGreaterEqual, 1)
+    AIE.useLock(%b, Release, 1)
+    AIE.useLock(%b, AcquireGreaterEqual, 1)
+    AIE.useLock(%d, Release, 1)
+    AIE.end
+  }
+
+  AIE.mem(%t22) {
+    %dma = AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.dmaBd(<%buf : memref<16xi32>, 0, 16>, 0)
+    AIE.useLock(%c, Release, 1)
+    AIE.nextBd ^end
+  ^end:
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,53 @@
+//===- assign_shim_tiles.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-shim-tiles %s | FileCheck %s
+
+// Each objectFifo moves 10 elements of 1024 bytes.  @inA0 gets the closest
+// shim NOC tile, in column 2.  Column 3 then moves the DDR traffic of @inA1
+// in half the cycles column 2 would take, for one more switch hop.  @outA
+// goes the other way, on the free S2MM channels of column 2, and the
+// external buffers of @inA1 follow it to column 3.
+
+// CHECK-LABEL: module @assign_shim_tiles {
+// CHECK:   %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:   %[[S20:.*]] = AIE.tile(2, 0)
+// CHECK:   %[[S30:.*]] = AIE.tile(3, 0)
+// CHECK-NOT: unplaced
+// CHECK:   AIE.objectFifo @inA0(%[[S20]], {%[[T23]]}, 2 : i32)
+// CHECK:   AIE.objectFifo @inA1(%[[S30]], {%[[T23]]}, 2 : i32)
+// CHECK:   AIE.objectFifo @outA(%[[T23]], {%[[S20]]}, 2 : i32)
+// CHECK:   AIE.objectFifo.registerExternalBuffers @inA1(%[[S30]], {%{{.*}}})
+
+module @assign_shim_tiles {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3)
+  %shim = AIE.tile(2, 0) {unplaced}
+  AIE.objectFifo @inA0 (%shim, {%t23}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+  AIE.objectFifo @inA1 (%shim, {%t23}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+  AIE.objectFifo @outA (%t23, {%shim}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+  %ext = AIE.external_buffer : memref<2560xi32>
+  AIE.objectFifo.registerExternalBuffers @inA1 (%shim, {%ext}) : (memref<2560xi32>)
+  %core23 = AIE.core(%t23) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c10 = arith.constant 10 : index
+    scf.for %i = %c0 to %c10 step %c1 {
+      %sub0 = AIE.objectFifo.acquire @inA0 (Consume, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+      %sub1 = AIE.objectFifo.acquire @inA1 (Consume, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+      %subOut = AIE.objectFifo.acquire @outA (Produce, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+      AIE.objectFifo.release @inA0 (Consume, 1)
+      AIE.objectFifo.release @inA1 (Consume, 1)
+      AIE.objectFifo.release @outA (Produce, 1)
+    }
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,21 @@
+//===- bad_assign_shim_tiles.mlir ------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-assign-shim-tiles --verify-diagnostics %s
+
+module @bad_assign_shim_tiles {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3)
+  // expected-error@+1 {{'AIE.tile' op is an unplaced shim tile used by AIE.flow, only objectFifos can use one}}
+  %shim = AIE.tile(2, 0) {unplaced}
+  AIE.objectFifo @in (%shim, {%t23}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+  AIE.flow(%shim, DMA : 1, %t23, DMA : 1)
+ }
+}
@@ -27,6 +27,9 @@ int main(int argc, char *argv[]) {
   int n = 1;
   u32 pc0_times[n];
   u32 pc1_times[n];
+  // With "sync", start the cores with a broadcast event instead of one
+  // register write after the other.
+  bool sync = argc > 1 && !strcmp(argv[1], "sync");
 
   printf("05_Core_Startup test start.\n");
   printf("Running %d times ...\n", n);
@@ -56,7 +59,10 @@ int main(int argc, char *argv[]) {
                      XAIE_EVENT_NONE_CORE, XAIE_CORE_MOD);
     pc1.set();
 
-    mlir_aie_start_cores(_xaie);
+    if (sync)
+      mlir_aie_start_cores_synchronized(_xaie);
+    else
+      mlir_aie_start_cores(_xaie);
     usleep(1000);
 
     pc0_times[iters] = pc0.diff();
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+# Prints a design moving size words from the local memory of tile (1, 3) to
+# the local memory of the tile distance rows above it, for aie-bench.
+
+import argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('--size', type=int, default=1024)
+parser.add_argument('--distance', type=int, default=1)
+args = parser.parse_args()
+
+src, dst = 3, 3 + args.distance
+ty = f'memref<{args.size}xi32>'
+print(f'''module @test15_fill_rate_sweep {{
+  %src = AIE.tile(1, {src})
+  %dst = AIE.tile(1, {dst})
+
+  %src_buf = AIE.buffer(%src) {{ sym_name = "src_buf" }} : {ty}
+  %dst_buf = AIE.buffer(%dst) {{ sym_name = "dst_buf" }} : {ty}
+  %src_lock = AIE.lock(%src, 0) {{ sym_name = "src_lock" }}
+  %dst_lock = AIE.lock(%dst, 1) {{ sym_name = "dst_lock" }}
+
+  AIE.flow(%src, DMA : 0, %dst, DMA : 0)
+
+  %src_mem = AIE.mem(%src) {{
+    %dma = AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+    ^bd0:
+      AIE.useLock(%src_lock, "Acquire", 1)
+      AIE.dmaBd(<%src_buf : {ty}, 0, {args.size}>, 0)
+      AIE.useLock(%src_lock, "Release", 0)
+      AIE.nextBd ^end
+    ^end:
+      AIE.end
+  }}
+
+  %dst_mem = AIE.mem(%dst) {{
+    %dma = AIE.dmaStart(S2MM, 0, ^bd0, ^end)
+    ^bd0:
+      AIE.useLock(%dst_lock, "Acquire", 0)
+      AIE.dmaBd(<%dst_buf : {ty}, 0, {args.size}>, 0)
+      AIE.useLock(%dst_lock, "Release", 1)
+      AIE.nextBd ^end
+    ^end:
+      AIE.end
+  }}
+}}''')
@@ -0,0 +1,72 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "bench_params.h"
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 times[n];
+  int errors = 0;
+
+  printf("15_Fill_Rate_Sweep test start, %d words over %d rows.\n", SIZE,
+         DISTANCE);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    for (int i = 0; i < SIZE; i++) {
+      mlir_aie_write_buffer_src_buf(_xaie, i, i + 1);
+      mlir_aie_write_buffer_dst_buf(_xaie, i, 0xdeadbeef);
+    }
+
+    // From the start of the S2MM transfer to the release of its lock.
+    EventMonitor pc0(_xaie, 1, 3 + DISTANCE, 0,
+                     XAIE_EVENT_DMA_S2MM_0_START_BD_MEM,
+                     XAIE_EVENT_LOCK_1_REL_MEM, XAIE_EVENT_NONE_MEM,
+                     XAIE_MEM_MOD);
+    pc0.set();
+
+    mlir_aie_release_src_lock(_xaie, 1, 0);
+    if (!mlir_aie_acquire_dst_lock(_xaie, 1, 1000))
+      errors++;
+    times[iters] = pc0.diff();
+
+    for (int i = 0; i < SIZE; i++)
+      if (mlir_aie_read_buffer_dst_buf(_xaie, i) != (u32)(i + 1)) {
+        errors++;
+        break;
+      }
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("Fill rate: %llu cycles, %.2f words per cycle\n",
+         (unsigned long long)stats.p50, (double)SIZE / stats.p50);
+  mlir_aie_write_stats_json(stdout, "s2mm", &stats);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
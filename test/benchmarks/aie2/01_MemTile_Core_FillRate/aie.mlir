@@ -0,0 +1,66 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the fill rate of the stream between a memtile and the local memory
+// of a core tile, in both directions: 4096 words from the memtile to the tile,
+// then back from the tile to the memtile.
+
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @benchmark01_memtile_core_fill_rate {
+  AIE.device(xcve2802) {
+    %t71 = AIE.tile(7, 1)
+    %t73 = AIE.tile(7, 3)
+
+    %mt_buf = AIE.buffer(%t71) { sym_name = "mt_buf" } : memref<4096xi32>
+    %mt_ret = AIE.buffer(%t71) { sym_name = "mt_ret" } : memref<4096xi32>
+    %core_buf = AIE.buffer(%t73) { sym_name = "core_buf" } : memref<4096xi32>
+
+    %mt_ready = AIE.lock(%t71, 0) { init = 0 : i32, sym_name = "mt_ready" }
+    %mt_done = AIE.lock(%t71, 1) { init = 0 : i32, sym_name = "mt_done" }
+    %core_full = AIE.lock(%t73, 0) { init = 0 : i32, sym_name = "core_full" }
+
+    AIE.flow(%t71, DMA : 0, %t73, DMA : 0)
+    AIE.flow(%t73, DMA : 0, %t71, DMA : 0)
+
+    %mt_dma = AIE.memTileDMA(%t71) {
+        %src = AIE.dmaStart(MM2S, 0, ^bd0, ^dma1)
+      ^dma1:
+        %dst = AIE.dmaStart(S2MM, 0, ^bd1, ^end)
+      ^bd0:
+        AIE.useLock(%mt_ready, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%mt_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.dmaBd(<%mt_ret : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%mt_done, Release, 1)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+
+    %core_dma = AIE.mem(%t73) {
+        %dst = AIE.dmaStart(S2MM, 0, ^bd0, ^dma1)
+      ^dma1:
+        %src = AIE.dmaStart(MM2S, 0, ^bd1, ^end)
+      ^bd0:
+        AIE.dmaBd(<%core_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%core_full, Release, 1)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.useLock(%core_full, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%core_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+  }
+}
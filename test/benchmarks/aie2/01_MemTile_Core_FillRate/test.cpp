@@ -0,0 +1,86 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+#define DMA_COUNT 4096
+
+static void report(const char *name, const u64 *times, int n) {
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("%s: median %llu cycles, %.2f words per cycle\n", name,
+         (unsigned long long)stats.p50, (double)DMA_COUNT / stats.p50);
+  mlir_aie_write_stats_json(stdout, name, &stats);
+}
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 toCore[n], toMemTile[n];
+  int errors = 0;
+
+  printf("AIE2 01_MemTile_Core_FillRate test start.\n");
+  printf("Running %d times ...\n", n);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    for (int i = 0; i < DMA_COUNT; i++) {
+      mlir_aie_write_buffer_mt_buf(_xaie, i, i + 1);
+      mlir_aie_write_buffer_mt_ret(_xaie, i, 0xdeadbeef);
+    }
+
+    // The receiving DMA of each direction, from the start of its task to
+    // its end.
+    PerfCounterSet counters(_xaie);
+    int core = counters.add(7, 3, XAIE_MEM_MOD,
+                            XAIE_EVENT_DMA_S2MM_0_START_TASK_MEM,
+                            XAIE_EVENT_DMA_S2MM_0_FINISHED_TASK_MEM, "to_core");
+    int memTile = counters.add(7, 1, XAIE_MEM_MOD,
+                               XAIE_EVENT_DMA_S2MM_SEL0_START_TASK_MEM_TILE,
+                               XAIE_EVENT_DMA_S2MM_SEL0_FINISHED_TASK_MEM_TILE,
+                               "to_memtile");
+    counters.start();
+
+    mlir_aie_release_mt_ready(_xaie, 1, 0);
+    if (!mlir_aie_acquire_mt_done(_xaie, -1, 1000))
+      errors++;
+
+    counters.stop();
+    toCore[iters] = counters.value(core);
+    toMemTile[iters] = counters.value(memTile);
+
+    for (int i = 0; i < DMA_COUNT; i++)
+      if (mlir_aie_read_buffer_mt_ret(_xaie, i) != (u32)(i + 1)) {
+        errors++;
+        break;
+      }
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  report("memtile_to_core", toCore, n);
+  report("core_to_memtile", toMemTile, n);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
@@ -0,0 +1,64 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the fill rate between the DDR and a memtile through a shim DMA, in
+// both directions: 4096 words are read from the DDR into the memtile by the
+// shim MM2S channel, then written back to the DDR by the shim S2MM channel.
+
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @benchmark02_shim_memtile_fill_rate {
+  AIE.device(xcve2802) {
+    %t70 = AIE.tile(7, 0)
+    %t71 = AIE.tile(7, 1)
+
+    %ddr_in = AIE.external_buffer { sym_name = "ddr_in" } : memref<4096xi32>
+    %ddr_out = AIE.external_buffer { sym_name = "ddr_out" } : memref<4096xi32>
+    %mt_buf = AIE.buffer(%t71) { sym_name = "mt_buf" } : memref<4096xi32>
+
+    %out_done = AIE.lock(%t70, 1) { init = 0 : i32, sym_name = "out_done" }
+    %mt_full = AIE.lock(%t71, 0) { init = 0 : i32, sym_name = "mt_full" }
+
+    AIE.flow(%t70, DMA : 0, %t71, DMA : 0)
+    AIE.flow(%t71, DMA : 0, %t70, DMA : 0)
+
+    %shim_dma = AIE.shimDMA(%t70) {
+        AIE.dmaStart(MM2S, 0, ^bd0, ^dma1)
+      ^dma1:
+        AIE.dmaStart(S2MM, 0, ^bd1, ^end)
+      ^bd0:
+        AIE.dmaBd(<%ddr_in : memref<4096xi32>, 0, 4096>, 0)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.dmaBd(<%ddr_out : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%out_done, Release, 1)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+
+    %mt_dma = AIE.memTileDMA(%t71) {
+        %dst = AIE.dmaStart(S2MM, 0, ^bd0, ^dma1)
+      ^dma1:
+        %src = AIE.dmaStart(MM2S, 0, ^bd1, ^end)
+      ^bd0:
+        AIE.dmaBd(<%mt_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%mt_full, Release, 1)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.useLock(%mt_full, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%mt_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+  }
+}
@@ -0,0 +1,99 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "memory_allocator.h"
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+#define DMA_COUNT 4096
+
+static void report(const char *name, const u64 *times, int n) {
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("%s: median %llu cycles, %.2f words per cycle\n", name,
+         (unsigned long long)stats.p50, (double)DMA_COUNT / stats.p50);
+  mlir_aie_write_stats_json(stdout, name, &stats);
+}
+
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 fromDDR[n], toDDR[n];
+  int errors = 0;
+
+  printf("AIE2 02_Shim_MemTile_FillRate test start.\n");
+  printf("Running %d times ...\n", n);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    ext_mem_model_t in, out;
+    int *ddr_in = mlir_aie_mem_alloc(_xaie, in, DMA_COUNT);
+    int *ddr_out = mlir_aie_mem_alloc(_xaie, out, DMA_COUNT);
+    for (int i = 0; i < DMA_COUNT; i++) {
+      ddr_in[i] = i + 1;
+      ddr_out[i] = 0xdeadbeef;
+    }
+    mlir_aie_sync_mem_dev(in);
+    mlir_aie_sync_mem_dev(out);
+    mlir_aie_external_set_addr_ddr_in(_xaie, (u64)ddr_in);
+    mlir_aie_external_set_addr_ddr_out(_xaie, (u64)ddr_out);
+
+    // The memtile DMA receiving from and sending to the shim, from the
+    // start of its task to its end.
+    PerfCounterSet counters(_xaie);
+    int from = counters.add(7, 1, XAIE_MEM_MOD,
+                            XAIE_EVENT_DMA_S2MM_SEL0_START_TASK_MEM_TILE,
+                            XAIE_EVENT_DMA_S2MM_SEL0_FINISHED_TASK_MEM_TILE,
+                            "ddr_to_memtile");
+    int to = counters.add(7, 1, XAIE_MEM_MOD,
+                          XAIE_EVENT_DMA_MM2S_SEL0_START_TASK_MEM_TILE,
+                          XAIE_EVENT_DMA_MM2S_SEL0_FINISHED_TASK_MEM_TILE,
+                          "memtile_to_ddr");
+    counters.start();
+
+    mlir_aie_configure_shimdma_70(_xaie);
+    if (!mlir_aie_acquire_out_done(_xaie, -1, 1000))
+      errors++;
+
+    counters.stop();
+    fromDDR[iters] = counters.value(from);
+    toDDR[iters] = counters.value(to);
+
+    mlir_aie_sync_mem_cpu(out);
+    for (int i = 0; i < DMA_COUNT; i++)
+      if (ddr_out[i] != i + 1) {
+        errors++;
+        break;
+      }
+    mlir_aie_mem_free(_xaie, in);
+    mlir_aie_mem_free(_xaie, out);
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  report("ddr_to_memtile", fromDDR, n);
+  report("memtile_to_ddr", toDDR, n);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
@@ -0,0 +1,67 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the throughput of the multi-dimensional buffer descriptors of a
+// memtile: the same 64x64 words are sent to a core tile first linearly, on
+// channel 0, then transposed by a 2-D buffer descriptor, on channel 1.
+
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @benchmark03_nd_bd_throughput {
+  AIE.device(xcve2802) {
+    %t71 = AIE.tile(7, 1)
+    %t73 = AIE.tile(7, 3)
+
+    %mt_buf = AIE.buffer(%t71) { sym_name = "mt_buf" } : memref<4096xi32>
+    %linear_buf = AIE.buffer(%t73) { sym_name = "linear_buf" } : memref<4096xi32>
+    %nd_buf = AIE.buffer(%t73) { sym_name = "nd_buf" } : memref<4096xi32>
+
+    %linear_ready = AIE.lock(%t71, 0) { init = 0 : i32, sym_name = "linear_ready" }
+    %nd_ready = AIE.lock(%t71, 1) { init = 0 : i32, sym_name = "nd_ready" }
+    %linear_full = AIE.lock(%t73, 0) { init = 0 : i32, sym_name = "linear_full" }
+    %nd_full = AIE.lock(%t73, 1) { init = 0 : i32, sym_name = "nd_full" }
+
+    AIE.flow(%t71, DMA : 0, %t73, DMA : 0)
+    AIE.flow(%t71, DMA : 1, %t73, DMA : 1)
+
+    %mt_dma = AIE.memTileDMA(%t71) {
+        %linear = AIE.dmaStart(MM2S, 0, ^bd0, ^dma1)
+      ^dma1:
+        %nd = AIE.dmaStart(MM2S, 1, ^bd1, ^end)
+      ^bd0:
+        AIE.useLock(%linear_ready, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%mt_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.useLock(%nd_ready, AcquireGreaterEqual, 1)
+        AIE.dmaBd(<%mt_buf : memref<4096xi32>, 0, 4096>, 0, [<1, 64>, <64, 64>])
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+
+    %core_dma = AIE.mem(%t73) {
+        %linear = AIE.dmaStart(S2MM, 0, ^bd0, ^dma1)
+      ^dma1:
+        %nd = AIE.dmaStart(S2MM, 1, ^bd1, ^end)
+      ^bd0:
+        AIE.dmaBd(<%linear_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%linear_full, Release, 1)
+        AIE.nextBd ^end
+      ^bd1:
+        AIE.dmaBd(<%nd_buf : memref<4096xi32>, 0, 4096>, 0)
+        AIE.useLock(%nd_full, Release, 1)
+        AIE.nextBd ^end
+      ^end:
+        AIE.end
+    }
+  }
+}
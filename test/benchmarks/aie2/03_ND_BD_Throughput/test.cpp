@@ -0,0 +1,90 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+#define DMA_COUNT 4096
+
+static void report(const char *name, const u64 *times, int n) {
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("%s: median %llu cycles, %.2f words per cycle\n", name,
+         (unsigned long long)stats.p50, (double)DMA_COUNT / stats.p50);
+  mlir_aie_write_stats_json(stdout, name, &stats);
+}
+
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 linear[n], nd[n];
+  int errors = 0;
+
+  printf("AIE2 03_ND_BD_Throughput test start.\n");
+  printf("Running %d times ...\n", n);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    for (int i = 0; i < DMA_COUNT; i++)
+      mlir_aie_write_buffer_mt_buf(_xaie, i, i);
+
+    // The receiving DMA channels of the core tile, from the start of their
+    // task to its end. The two transfers run one after the other.
+    PerfCounterSet counters(_xaie);
+    int l = counters.add(7, 3, XAIE_MEM_MOD,
+                         XAIE_EVENT_DMA_S2MM_0_START_TASK_MEM,
+                         XAIE_EVENT_DMA_S2MM_0_FINISHED_TASK_MEM, "linear");
+    int t = counters.add(7, 3, XAIE_MEM_MOD,
+                         XAIE_EVENT_DMA_S2MM_1_START_TASK_MEM,
+                         XAIE_EVENT_DMA_S2MM_1_FINISHED_TASK_MEM, "transposed");
+    counters.start();
+
+    mlir_aie_release_linear_ready(_xaie, 1, 0);
+    if (!mlir_aie_acquire_linear_full(_xaie, -1, 1000))
+      errors++;
+    mlir_aie_release_nd_ready(_xaie, 1, 0);
+    if (!mlir_aie_acquire_nd_full(_xaie, -1, 1000))
+      errors++;
+
+    counters.stop();
+    linear[iters] = counters.value(l);
+    nd[iters] = counters.value(t);
+
+    for (int i = 0; i < DMA_COUNT; i++) {
+      u32 transposed = (i % 64) * 64 + i / 64;
+      if (mlir_aie_read_buffer_linear_buf(_xaie, i) != (u32)i ||
+          mlir_aie_read_buffer_nd_buf(_xaie, i) != transposed) {
+        errors++;
+        break;
+      }
+    }
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  report("linear", linear, n);
+  report("transposed", nd, n);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
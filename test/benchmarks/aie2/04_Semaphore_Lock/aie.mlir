@@ -0,0 +1,37 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the cost of the AIE2 semaphore locks: the core acquires and
+// releases a lock 1000 times, without ever waiting for it. The cycles of the
+// core include its startup and the overhead of the loop.
+
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @benchmark04_semaphore_lock {
+  AIE.device(xcve2802) {
+    %t73 = AIE.tile(7, 3)
+
+    %sem = AIE.lock(%t73, 0) { init = 1 : i32, sym_name = "sem" }
+    %done = AIE.lock(%t73, 1) { init = 0 : i32, sym_name = "done" }
+
+    %core73 = AIE.core(%t73) {
+      %lb = arith.constant 0 : index
+      %ub = arith.constant 1000 : index
+      %step = arith.constant 1 : index
+      scf.for %iv = %lb to %ub step %step {
+        AIE.useLock(%sem, AcquireGreaterEqual, 1)
+        AIE.useLock(%sem, Release, 1)
+      }
+      AIE.useLock(%done, Release, 1)
+      AIE.end
+    }
+  }
+}
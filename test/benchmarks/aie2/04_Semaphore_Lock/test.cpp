@@ -0,0 +1,62 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+#define LOCK_PAIRS 1000
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 times[n];
+  int errors = 0;
+
+  printf("AIE2 04_Semaphore_Lock test start.\n");
+  printf("Running %d times ...\n", n);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    PerfCounterSet counters(_xaie);
+    int core = counters.add(7, 3, XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+                            XAIE_EVENT_DISABLED_CORE, "lock_pairs");
+    counters.start();
+
+    mlir_aie_start_cores(_xaie);
+    if (!mlir_aie_acquire_done(_xaie, -1, 1000))
+      errors++;
+
+    counters.stop();
+    times[iters] = counters.value(core);
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("Acquire and release: %.2f cycles per pair\n",
+         (double)stats.p50 / LOCK_PAIRS);
+  mlir_aie_write_stats_json(stdout, "lock_pairs", &stats);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
@@ -0,0 +1,43 @@
+//===- aie.mlir ------------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the bandwidth of the cascade stream between two neighboring cores:
+// the core of tile (1, 3) sends 1024 vectors of 512 bits to the core of tile
+// (2, 3), which receives them and stores their sum.
+
+// RUN: clang --target=aie2 -c %S/kernel.cc
+// RUN: aiecc.py %VitisSysrootFlag% --host-target=%aieHostTargetTriplet% %s -I%host_runtime_lib%/test_lib/include -L%host_runtime_lib%/test_lib/lib -ltest_lib %S/test.cpp -o test.elf
+// RUN: %run_on_board ./test.elf
+
+module @benchmark05_cascade_stream {
+  AIE.device(xcve2802) {
+    %t13 = AIE.tile(1, 3)
+    %t23 = AIE.tile(2, 3)
+
+    %sum = AIE.buffer(%t23) { sym_name = "sum" } : memref<16xi32>
+    %done = AIE.lock(%t23, 0) { init = 0 : i32, sym_name = "done" }
+
+    func.func private @send(%n: i32) -> ()
+    func.func private @receive(%out: memref<16xi32>, %n: i32) -> ()
+
+    %core13 = AIE.core(%t13) {
+      %n = arith.constant 1024 : i32
+      func.call @send(%n) : (i32) -> ()
+      AIE.end
+    } { link_with = "kernel.o" }
+
+    %core23 = AIE.core(%t23) {
+      %n = arith.constant 1024 : i32
+      func.call @receive(%sum, %n) : (memref<16xi32>, i32) -> ()
+      AIE.useLock(%done, Release, 1)
+      AIE.end
+    } { link_with = "kernel.o" }
+  }
+}
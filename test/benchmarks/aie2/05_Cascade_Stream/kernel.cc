@@ -0,0 +1,26 @@
+//===- kernel.cc ------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdint.h>
+
+// Send n vectors of 32 x 16 bits on the cascade stream.
+extern "C" void send(int32_t n) {
+  v32int16 v = broadcast_to_v32int16((short)1);
+  for (int i = 0; i < n; i++)
+    put_mcd(v);
+}
+
+// Receive n vectors from the cascade stream and store their sum in out.
+extern "C" void receive(int32_t *out, int32_t n) {
+  v32int16 sum = broadcast_zero_to_v32int16();
+  for (int i = 0; i < n; i++)
+    sum = add(sum, get_scd_v32int16());
+  *(v32int16 *)out = sum;
+}
@@ -0,0 +1,78 @@
+//===- test.cpp -------------------------------------------------*- C++ -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+#include "test_library.h"
+#include <cstdio>
+#include <unistd.h>
+#include <xaiengine.h>
+
+#include "aie_inc.cpp"
+
+#define VECTORS 1024
+#define VECTOR_BYTES 64
+
+int main(int argc, char *argv[]) {
+  const int n = 100;
+  u64 times[n];
+  int errors = 0;
+
+  printf("AIE2 05_Cascade_Stream test start.\n");
+  printf("Running %d times ...\n", n);
+
+  for (int iters = 0; iters < n; iters++) {
+    aie_libxaie_ctx_t *_xaie = mlir_aie_init_libxaie();
+    mlir_aie_init_device(_xaie);
+    mlir_aie_configure_cores(_xaie);
+    mlir_aie_configure_switchboxes(_xaie);
+    mlir_aie_initialize_locks(_xaie);
+    mlir_aie_configure_dmas(_xaie);
+
+    // FIXME: model in MLIR
+    XAie_CoreConfigAccumulatorControl(&(_xaie->DevInst), XAie_TileLoc(1, 3),
+                                      WEST, EAST);
+    XAie_CoreConfigAccumulatorControl(&(_xaie->DevInst), XAie_TileLoc(2, 3),
+                                      WEST, EAST);
+
+    // The receiving core, which stalls on the stream until the sender
+    // starts and finishes with it.
+    PerfCounterSet counters(_xaie);
+    int core = counters.add(2, 3, XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+                            XAIE_EVENT_DISABLED_CORE, "cascade");
+    counters.start();
+
+    mlir_aie_start_cores(_xaie);
+    if (!mlir_aie_acquire_done(_xaie, -1, 1000))
+      errors++;
+
+    counters.stop();
+    times[iters] = counters.value(core);
+
+    // Each 32-bit word of the sum holds two lanes of VECTORS.
+    for (int i = 0; i < 16; i++)
+      if (mlir_aie_read_buffer_sum(_xaie, i) != (VECTORS << 16 | VECTORS)) {
+        errors++;
+        break;
+      }
+    mlir_aie_deinit_libxaie(_xaie);
+  }
+
+  mlir_aie_stats_t stats;
+  mlir_aie_compute_stats(times, n, 3.0, &stats);
+  printf("Cascade: %.2f bytes per cycle\n",
+         (double)VECTORS * VECTOR_BYTES / stats.p50);
+  mlir_aie_write_stats_json(stdout, "cascade", &stats);
+
+  if (errors) {
+    printf("Fail! %d errors\n", errors);
+    return 1;
+  }
+  printf("PASS!\n");
+  return 0;
+}
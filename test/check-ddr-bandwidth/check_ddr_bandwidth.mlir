@@ -0,0 +1,62 @@
+//===- check_ddr_bandwidth.mlir --------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-check-ddr-bandwidth="run-cycles=2048" --split-input-file --verify-diagnostics %s
+
+// @in moves 10 elements of 1024 bytes in 2048 cycles, 5 bytes per cycle, more
+// than a shim DMA channel.  With the 2.5 bytes per cycle of @in2 and the 25%
+// of a stream of the flow, column 2 sends more than a shim tile can move.
+
+module @check_ddr_bandwidth {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3)
+  // expected-warning@+1 {{shim column 2 needs 8.50 bytes per cycle from the DDR, more than the 8 bytes per cycle it can move, the design is I/O-bound}}
+  %t20 = AIE.tile(2, 0)
+  // expected-warning@+1 {{needs 5.00 bytes per cycle from the DDR, more than the 4 bytes per cycle of a shim DMA channel}}
+  AIE.objectFifo @in (%t20, {%t23}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+  AIE.objectFifo @in2 (%t20, {%t23}, 2 : i32) : !AIE.objectFifo<memref<128xi32>>
+  AIE.flow(%t20, DMA : 1, %t23, DMA : 1) {bandwidth = 25 : i32}
+  %core23 = AIE.core(%t23) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c10 = arith.constant 10 : index
+    scf.for %i = %c0 to %c10 step %c1 {
+      %sub = AIE.objectFifo.acquire @in (Consume, 1) : !AIE.objectFifoSubview<memref<256xi32>>
+      %sub2 = AIE.objectFifo.acquire @in2 (Consume, 1) : !AIE.objectFifoSubview<memref<128xi32>>
+      AIE.objectFifo.release @in (Consume, 1)
+      AIE.objectFifo.release @in2 (Consume, 1)
+    }
+    AIE.end
+  }
+ }
+}
+
+// -----
+
+// Each column only sends 6 bytes per cycle, but the three columns together
+// send more than the NOC can move.
+
+module @check_noc_bandwidth {
+ // expected-warning@+1 {{the shim tiles need 18.00 bytes per cycle of DDR traffic, more than the 16 bytes per cycle of the NOC, the design is I/O-bound}}
+ AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t30 = AIE.tile(3, 0)
+  %t60 = AIE.tile(6, 0)
+  %t23 = AIE.tile(2, 3)
+  %t33 = AIE.tile(3, 3)
+  %t63 = AIE.tile(6, 3)
+  AIE.flow(%t20, DMA : 0, %t23, DMA : 0) {bandwidth = 75 : i32}
+  AIE.flow(%t20, DMA : 1, %t23, DMA : 1) {bandwidth = 75 : i32}
+  AIE.flow(%t30, DMA : 0, %t33, DMA : 0) {bandwidth = 75 : i32}
+  AIE.flow(%t30, DMA : 1, %t33, DMA : 1) {bandwidth = 75 : i32}
+  AIE.flow(%t60, DMA : 0, %t63, DMA : 0) {bandwidth = 75 : i32}
+  AIE.flow(%t60, DMA : 1, %t63, DMA : 1) {bandwidth = 75 : i32}
+ }
+}
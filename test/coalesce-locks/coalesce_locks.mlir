@@ -0,0 +1,73 @@
+//===- coalesce_locks.mlir -------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-coalesce-locks %s | FileCheck %s
+
+// CHECK-LABEL: module @coalesce_locks {
+// CHECK:         %[[L0:.*]] = AIE.lock(%{{.*}}, 0)
+// CHECK:         %[[L1:.*]] = AIE.lock(%{{.*}}, 1)
+// CHECK:         %[[L2:.*]] = AIE.lock(%{{.*}}, 2)
+// CHECK:         %[[L3:.*]] = AIE.lock(%{{.*}}, 3)
+// CHECK:         %[[L4:.*]] = AIE.lock(%{{.*}}, 4)
+// CHECK:         AIE.core
+// CHECK-NEXT:      AIE.useLock(%[[L0]], AcquireGreaterEqual, 2)
+// CHECK-NEXT:      AIE.useLock(%[[L1]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:      arith.constant
+// CHECK-NEXT:      AIE.useLock(%[[L2]], Release, 3)
+// CHECK-NEXT:      memref.store
+// CHECK-NEXT:      AIE.useLock(%[[L2]], Release, 1)
+// CHECK-NEXT:      AIE.useLock(%[[L1]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:      AIE.useLock(%[[L2]], Release, 1)
+// CHECK-NEXT:      AIE.useLock(%[[L3]], Release, 1)
+// CHECK-NEXT:      AIE.useLock(%[[L4]], Release, 1)
+// CHECK-NEXT:      AIE.useLock(%[[L4]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:      AIE.end
+
+module @coalesce_locks {
+  AIE.device(xcve2302) {
+    %t22 = AIE.tile(2, 2)
+    %t23 = AIE.tile(2, 3)
+    %buf = AIE.buffer(%t22) : memref<16xi32>
+    %l0 = AIE.lock(%t22, 0)
+    %l1 = AIE.lock(%t22, 1)
+    %l2 = AIE.lock(%t22, 2)
+    %l3 = AIE.lock(%t22, 3)
+    %l4 = AIE.lock(%t22, 4)
+
+    %core22 = AIE.core(%t22) {
+      // merged over the acquire of another lock and a constant
+      AIE.useLock(%l0, AcquireGreaterEqual, 1)
+      AIE.useLock(%l1, AcquireGreaterEqual, 1)
+      AIE.useLock(%l0, AcquireGreaterEqual, 1)
+      %c0 = arith.constant 0 : index
+      AIE.useLock(%l2, Release, 1)
+      AIE.useLock(%l2, Release, 2)
+      %v = arith.constant 7 : i32
+      memref.store %v, %buf[%c0] : memref<16xi32>
+      // not merged over an acquire of another lock
+      AIE.useLock(%l2, Release, 1)
+      AIE.useLock(%l1, AcquireGreaterEqual, 1)
+      AIE.useLock(%l2, Release, 1)
+      // %l3 is only acquired by this core, the acquire takes back part of
+      // the release
+      AIE.useLock(%l3, Release, 2)
+      AIE.useLock(%l3, AcquireGreaterEqual, 1)
+      // %l4 is also acquired by another core
+      AIE.useLock(%l4, Release, 1)
+      AIE.useLock(%l4, AcquireGreaterEqual, 1)
+      AIE.end
+    }
+
+    %core23 = AIE.core(%t23) {
+      AIE.useLock(%l4, AcquireGreaterEqual, 1)
+      AIE.end
+    }
+  }
+}
@@ -9,22 +9,19 @@
 //===----------------------------------------------------------------------===//
 
 // RUN: aie-opt --aie-create-cores --aie-lower-memcpy %s | FileCheck %s
-// XFAIL: *
-
-// FIXCore : DMA ops have issues here: reuse of DMAs is bad, also should chain from one DMA op to the next.
 
 // CHECK-LABEL: module @test_dma1 {
 // CHECK:         %[[VAL_0:.*]] = AIE.tile(1, 1)
 // CHECK:         %[[VAL_1:.*]] = AIE.buffer(%[[VAL_0]]) : memref<256xi32>
 // CHECK:         %[[VAL_2:.*]] = AIE.mem(%[[VAL_0]]) {
-// CHECK:           %[[VAL_3:.*]] = AIE.dmaStart(MM2S, 0, ^bb1, ^bb4)
+// CHECK:           %[[VAL_3:.*]] = AIE.dmaStart(MM2S, 0, ^bb1, ^bb2)
 // CHECK:         ^bb1:
 // CHECK:           AIEX.useToken @token0(Acquire, 1)
 // CHECK:           AIE.dmaBd(<%[[VAL_1]] : memref<256xi32>, 0, 256>, 0)
 // CHECK:           AIEX.useToken @token0(Release, 2)
 // CHECK:           AIE.nextBd ^bb4
 // CHECK:         ^bb2:
-// CHECK:           %[[VAL_4:.*]] = AIE.dmaStart(MM2S, 0, ^bb3, ^bb4)
+// CHECK:           %[[VAL_4:.*]] = AIE.dmaStart(MM2S, 1, ^bb3, ^bb4)
 // CHECK:         ^bb3:
 // CHECK:           AIEX.useToken @token1(Acquire, 1)
 // CHECK:           AIE.dmaBd(<%[[VAL_1]] : memref<256xi32>, 0, 256>, 0)
@@ -70,7 +67,7 @@
 // CHECK:           AIE.end
 // CHECK:         }
 // CHECK:         AIE.flow(%[[VAL_0]], DMA : 0, %[[VAL_5]], DMA : 0)
-// CHECK:         AIE.flow(%[[VAL_0]], DMA : 0, %[[VAL_9]], DMA : 0)
+// CHECK:         AIE.flow(%[[VAL_0]], DMA : 1, %[[VAL_9]], DMA : 0)
 // CHECK:         %[[VAL_17:.*]] = AIE.core(%[[VAL_5]]) {
 // CHECK:           AIEX.useToken @token0(Acquire, 2)
 // CHECK:           AIEX.useToken @token0(Release, 3)
@@ -0,0 +1,55 @@
+//===- broadcast_steiner.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+
+// RUN: aie-opt --aie-create-pathfinder-flows="steiner=true" --aie-find-flows %s | FileCheck %s
+// RUN: aie-opt --aie-create-pathfinder-flows="steiner=true threads=4" --aie-find-flows %s | FileCheck %s
+// CHECK: %[[T02:.*]] = AIE.tile(0, 2)
+// CHECK: %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK: %[[T20:.*]] = AIE.tile(2, 0)
+// CHECK: %[[T22:.*]] = AIE.tile(2, 2)
+// CHECK: %[[T31:.*]] = AIE.tile(3, 1)
+// CHECK: %[[T60:.*]] = AIE.tile(6, 0)
+// CHECK: %[[T71:.*]] = AIE.tile(7, 1)
+// CHECK: %[[T82:.*]] = AIE.tile(8, 2)
+// CHECK: %[[T83:.*]] = AIE.tile(8, 3)
+//
+// CHECK-DAG: AIE.flow(%[[T20]], DMA : 0, %[[T71]], DMA : 0)
+// CHECK-DAG: AIE.flow(%[[T20]], DMA : 0, %[[T82]], DMA : 0)
+// CHECK-DAG: AIE.flow(%[[T20]], DMA : 0, %[[T31]], DMA : 0)
+// CHECK-DAG: AIE.flow(%[[T20]], DMA : 0, %[[T13]], DMA : 0)
+// CHECK-DAG: AIE.flow(%[[T60]], DMA : 0, %[[T83]], DMA : 1)
+// CHECK-DAG: AIE.flow(%[[T60]], DMA : 0, %[[T22]], DMA : 1)
+// CHECK-DAG: AIE.flow(%[[T60]], DMA : 0, %[[T31]], DMA : 1)
+// CHECK-DAG: AIE.flow(%[[T60]], DMA : 0, %[[T02]], DMA : 1)
+
+module {
+    AIE.device(xcvc1902) {
+        %t02 = AIE.tile(0, 2)
+        %t13 = AIE.tile(1, 3)
+        %t20 = AIE.tile(2, 0)
+        %t22 = AIE.tile(2, 2)
+        %t31 = AIE.tile(3, 1)
+        %t60 = AIE.tile(6, 0)
+        %t71 = AIE.tile(7, 1)
+        %t82 = AIE.tile(8, 2)
+        %t83 = AIE.tile(8, 3)
+
+        AIE.flow(%t20, DMA : 0, %t13, DMA : 0)
+        AIE.flow(%t20, DMA : 0, %t31, DMA : 0)
+        AIE.flow(%t20, DMA : 0, %t71, DMA : 0)
+        AIE.flow(%t20, DMA : 0, %t82, DMA : 0)
+
+        AIE.flow(%t60, DMA : 0, %t02, DMA : 1)
+        AIE.flow(%t60, DMA : 0, %t83, DMA : 1)
+        AIE.flow(%t60, DMA : 0, %t22, DMA : 1)
+        AIE.flow(%t60, DMA : 0, %t31, DMA : 1)
+    }
+}
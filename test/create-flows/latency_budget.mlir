@@ -0,0 +1,26 @@
+//===- latency_budget.mlir -------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-pathfinder-flows="report-hops=true" --verify-diagnostics %s
+
+module {
+  AIE.device(xcvc1902) {
+    %t22 = AIE.tile(2, 2)
+    %t23 = AIE.tile(2, 3)
+    %t32 = AIE.tile(3, 2)
+    %t33 = AIE.tile(3, 3)
+    // expected-remark @+1 {{flow routed with 1 hops}}
+    AIE.flow(%t22, DMA : 0, %t23, DMA : 0) {latencyBudget = 1 : i32}
+    // expected-warning @+1 {{flow takes 2 hops, exceeding its latency budget of 1 hops}}
+    AIE.flow(%t22, DMA : 1, %t33, DMA : 0) {latencyBudget = 1 : i32}
+    // expected-remark @+1 {{flow routed with 2 hops}}
+    AIE.flow(%t23, Core : 0, %t32, Core : 0)
+  }
+}
@@ -0,0 +1,34 @@
+//===- routing_cache.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: rm -rf %t.cache
+// RUN: aie-opt --aie-create-pathfinder-flows="cache-dir=%t.cache" %s -o %t.routed.mlir
+// RUN: ls %t.cache | FileCheck --check-prefix=CACHE %s
+// RUN: aie-opt --aie-create-pathfinder-flows="cache-dir=%t.cache" %s -o %t.cached.mlir
+// RUN: diff %t.routed.mlir %t.cached.mlir
+// RUN: aie-opt --aie-find-flows %t.cached.mlir | FileCheck %s
+
+// CACHE: pathfinder-{{[0-9a-f]+}}.route
+
+// CHECK: %[[T20:.*]] = AIE.tile(2, 0)
+// CHECK: %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK: %[[T32:.*]] = AIE.tile(3, 2)
+// CHECK: AIE.flow(%[[T20]], DMA : 0, %[[T32]], DMA : 1)
+// CHECK: AIE.flow(%[[T23]], Core : 1, %[[T32]], DMA : 0)
+
+module {
+  AIE.device(xcvc1902) {
+    %t20 = AIE.tile(2, 0)
+    %t23 = AIE.tile(2, 3)
+    %t32 = AIE.tile(3, 2)
+    AIE.flow(%t23, Core : 1, %t32, DMA : 0)
+    AIE.flow(%t20, DMA : 0, %t32, DMA : 1)
+  }
+}
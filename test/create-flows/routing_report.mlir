@@ -0,0 +1,43 @@
+//===- routing_report.mlir -------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-pathfinder-flows="report-file=%t.json" %s -o /dev/null
+// RUN: FileCheck %s < %t.json
+
+// CHECK: "legal": true,
+// CHECK: "iterations": 1,
+// CHECK: "flows": 2,
+// CHECK: "wirelength": 3,
+// CHECK: "max_fanout": 2,
+// CHECK: "hottest_channels": [
+// CHECK-NEXT: {
+// CHECK-NEXT: "col": 2,
+// CHECK-NEXT: "row": 2,
+// CHECK-NEXT: "bundle": "North",
+// CHECK-NEXT: "used": 2,
+// CHECK-NEXT: "fixed": 0,
+// CHECK-NEXT: "max": 6,
+// CHECK: "switchbox22": {
+// CHECK-NEXT: "col": 2,
+// CHECK-NEXT: "row": 2,
+// CHECK-NEXT: "source_count": 3,
+// CHECK-NEXT: "destination_count": 0,
+// CHECK-NEXT: "northbound": 2,
+
+module {
+  AIE.device(xcvc1902) {
+    %t22 = AIE.tile(2, 2)
+    %t23 = AIE.tile(2, 3)
+    %t24 = AIE.tile(2, 4)
+    AIE.flow(%t22, DMA : 0, %t23, DMA : 0)
+    AIE.flow(%t22, DMA : 0, %t24, DMA : 0)
+    AIE.flow(%t22, DMA : 1, %t23, DMA : 1)
+  }
+}
@@ -0,0 +1,58 @@
+//===- test_lock_redundant.mlir --------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-locks %s | FileCheck %s
+
+// CHECK-LABEL: module @test_lock_redundant {
+// CHECK:  %0 = AIE.tile(3, 3)
+// CHECK:  %1 = AIE.tile(2, 3)
+// CHECK:  %2 = AIE.lock(%1, 0)
+// CHECK-NOT:  AIE.lock
+// CHECK:  AIE.core(%0) {
+// CHECK-NEXT:    AIE.useLock(%2, Acquire, 0)
+// CHECK-NEXT:    AIE.useLock(%2, Release, 1)
+// CHECK-NEXT:    AIE.end
+// CHECK:  AIE.core(%1) {
+// CHECK-NEXT:    AIE.useLock(%2, Acquire, 1)
+// CHECK-NEXT:    AIE.useLock(%2, Release, 0)
+// CHECK-NEXT:    AIE.end
+
+// The core of tile (3, 3) acquires the token value it released itself
+// earlier in the same block: this chain needs no lock.
+module @test_lock_redundant {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %t23 = AIE.tile(2, 3)
+
+  AIEX.token(0) {sym_name = "token0"}
+
+  %m33 = AIE.mem(%t33) {
+      AIE.end
+  }
+
+  %m23 = AIE.mem(%t23) {
+      AIE.end
+  }
+
+  %c33 = AIE.core(%t33) {
+    AIEX.useToken @token0(Acquire, 0)
+    AIEX.useToken @token0(Release, 1)
+    AIEX.useToken @token0(Acquire, 1)
+    AIEX.useToken @token0(Release, 2)
+    AIE.end
+  }
+
+  %c23 = AIE.core(%t23) {
+    AIEX.useToken @token0(Acquire, 2)
+    AIEX.useToken @token0(Release, 3)
+    AIE.end
+  }
+ }
+}
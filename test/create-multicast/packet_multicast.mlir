@@ -0,0 +1,59 @@
+// RUN: aie-opt --aie-lower-multicast="max-circuit-fanout=3" %s | FileCheck %s
+// RUN: aie-opt --aie-lower-multicast="max-circuit-fanout=3" --aie-lower-broadcast-packet %s | FileCheck %s --check-prefix=PACKET
+// RUN: aie-opt --aie-lower-multicast="max-circuit-fanout=4" %s | FileCheck %s --check-prefix=CIRCUIT
+
+// The multicast from (7, 0) has 4 destinations, more than the 3 allowed for
+// circuit-switched flows, so it becomes a broadcast packet with the first ID
+// not used by the packet flow of the device.  The one from (6, 0) stays a
+// circuit-switched fanout.
+
+// CHECK-LABEL: module @packet_multicast {
+// CHECK:         AIE.packet_flow(0) {
+// CHECK:         AIEX.broadcast_packet(%{{.*}}, DMA : 0) {
+// CHECK-NEXT:      AIEX.bp_id(1) {
+// CHECK-NEXT:        AIEX.bp_dest<%{{.*}}, DMA : 0>
+// CHECK-NEXT:        AIEX.bp_dest<%{{.*}}, DMA : 0>
+// CHECK-NEXT:        AIEX.bp_dest<%{{.*}}, DMA : 0>
+// CHECK-NEXT:        AIEX.bp_dest<%{{.*}}, DMA : 0>
+// CHECK-NEXT:      }
+// CHECK-NEXT:    }
+// CHECK-NOT:     AIEX.multicast
+// CHECK:         AIE.flow(%{{.*}}, DMA : 1, %{{.*}}, DMA : 1) {steiner}
+// CHECK-NEXT:    AIE.flow(%{{.*}}, DMA : 1, %{{.*}}, DMA : 1) {steiner}
+
+// PACKET:      AIE.packet_flow(1) {
+// PACKET-NEXT:   AIE.packet_source<%{{.*}}, DMA : 0>
+// PACKET-NEXT:   AIE.packet_dest<%{{.*}}, DMA : 0>
+// PACKET-NEXT:   AIE.packet_dest<%{{.*}}, DMA : 0>
+// PACKET-NEXT:   AIE.packet_dest<%{{.*}}, DMA : 0>
+// PACKET-NEXT:   AIE.packet_dest<%{{.*}}, DMA : 0>
+// PACKET-NEXT: }
+// PACKET-NOT:  AIEX.broadcast_packet
+
+// CIRCUIT-NOT: AIEX.broadcast_packet
+// CIRCUIT-COUNT-6: AIE.flow({{.*}}) {steiner}
+
+module @packet_multicast {
+ AIE.device(xcvc1902) {
+  %70 = AIE.tile(7, 0)
+  %60 = AIE.tile(6, 0)
+  %73 = AIE.tile(7, 3)
+  %74 = AIE.tile(7, 4)
+  %63 = AIE.tile(6, 3)
+  %64 = AIE.tile(6, 4)
+  AIE.packet_flow(0) {
+    AIE.packet_source<%60, DMA : 0>
+    AIE.packet_dest<%63, DMA : 1>
+  }
+  AIEX.multicast(%70, "DMA" : 0){
+    AIEX.multi_dest<%73, "DMA" : 0>
+    AIEX.multi_dest<%74, "DMA" : 0>
+    AIEX.multi_dest<%63, "DMA" : 0>
+    AIEX.multi_dest<%64, "DMA" : 0>
+  }
+  AIEX.multicast(%60, "DMA" : 1){
+    AIEX.multi_dest<%73, "DMA" : 1>
+    AIEX.multi_dest<%74, "DMA" : 1>
+  }
+ }
+}
@@ -6,10 +6,10 @@
 // CHECK-NEXT:    %2 = AIE.tile(7, 4)
 // CHECK-NEXT:    %3 = AIE.tile(6, 3)
 // CHECK-NEXT:    %4 = AIE.tile(6, 4)
-// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %1, DMA : 0)
-// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %2, DMA : 0)
-// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %3, DMA : 0)
-// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %4, DMA : 0)
+// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %1, DMA : 0) {steiner}
+// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %2, DMA : 0) {steiner}
+// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %3, DMA : 0) {steiner}
+// CHECK-NEXT:    AIE.flow(%0, DMA : 0, %4, DMA : 0) {steiner}
 // CHECK-NEXT:  }
 
 module @test_multicast {
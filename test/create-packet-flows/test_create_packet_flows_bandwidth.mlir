@@ -0,0 +1,41 @@
+//===- test_create_packet_flows_bandwidth.mlir -----------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-packet-flows %s | FileCheck %s
+// RUN: aie-opt --aie-create-packet-flows="congestion-aware=true" %s | FileCheck %s
+
+// two packet flows whose total bandwidth exceeds a channel do not share one
+module @test_create_packet_flows_bandwidth {
+ AIE.device(xcvc1902) {
+// CHECK-LABEL: module @test_create_packet_flows_bandwidth {
+// CHECK:         %[[T22:.*]] = AIE.tile(2, 2)
+// CHECK:         AIE.switchbox(%[[T22]]) {
+// CHECK-DAG:       AIE.masterset(North : 0, %{{.*}})
+// CHECK-DAG:       AIE.masterset(North : 1, %{{.*}})
+// CHECK:         }
+// CHECK:         %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:         AIE.switchbox(%[[T23]]) {
+// CHECK-DAG:       AIE.packetrules(South : 0) {
+// CHECK-DAG:       AIE.packetrules(South : 1) {
+// CHECK:         }
+  %t22 = AIE.tile(2, 2)
+  %t23 = AIE.tile(2, 3)
+
+  AIE.packet_flow(0x1) {
+    AIE.packet_source<%t22, DMA : 0>
+    AIE.packet_dest<%t23, DMA : 0>
+  } {bandwidth = 60 : i32}
+
+  AIE.packet_flow(0x2) {
+    AIE.packet_source<%t22, DMA : 1>
+    AIE.packet_dest<%t23, DMA : 1>
+  } {bandwidth = 60 : i32}
+ }
+}
@@ -0,0 +1,50 @@
+//===- test_create_packet_flows_circuit.mlir -------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-packet-flows %s | FileCheck %s
+// RUN: aie-opt --aie-create-packet-flows="congestion-aware=true" %s | FileCheck %s
+
+// packet flows do not use master ports driven by circuit-switched connections
+module @test_create_packet_flows_circuit {
+ AIE.device(xcvc1902) {
+// CHECK-LABEL: module @test_create_packet_flows_circuit {
+// CHECK:         %[[T22:.*]] = AIE.tile(2, 2)
+// CHECK:         AIE.switchbox(%[[T22]]) {
+// CHECK:           AIE.connect<West : 0, North : 0>
+// CHECK:           %[[A0:.*]] = AIE.amsel<0> (0)
+// CHECK:           AIE.masterset(North : 1, %[[A0]])
+// CHECK:           AIE.packetrules(DMA : 0) {
+// CHECK:             AIE.rule(31, 1, %[[A0]])
+// CHECK:           }
+// CHECK:         }
+// CHECK:         %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:         AIE.switchbox(%[[T23]]) {
+// CHECK:           AIE.connect<South : 0, Core : 0>
+// CHECK:           %[[A1:.*]] = AIE.amsel<0> (0)
+// CHECK:           AIE.masterset(DMA : 0, %[[A1]])
+// CHECK:           AIE.packetrules(South : 1) {
+// CHECK:             AIE.rule(31, 1, %[[A1]])
+// CHECK:           }
+// CHECK:         }
+  %t22 = AIE.tile(2, 2)
+  %s22 = AIE.switchbox(%t22) {
+    AIE.connect<West : 0, North : 0>
+  }
+  %t23 = AIE.tile(2, 3)
+  %s23 = AIE.switchbox(%t23) {
+    AIE.connect<South : 0, Core : 0>
+  }
+
+  AIE.packet_flow(0x1) {
+    AIE.packet_source<%t22, DMA : 0>
+    AIE.packet_dest<%t23, DMA : 0>
+  }
+ }
+}
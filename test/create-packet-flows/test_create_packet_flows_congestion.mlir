@@ -0,0 +1,50 @@
+//===- test_create_packet_flows_congestion.mlir ----------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-create-packet-flows="congestion-aware=true" %s | FileCheck %s
+
+// one-to-one, routed with the congestion-aware router
+module @test_create_packet_flows_congestion {
+ AIE.device(xcvc1902) {
+// CHECK-LABEL: module @test_create_packet_flows_congestion {
+// CHECK:         %[[T22:.*]] = AIE.tile(2, 2)
+// CHECK:         AIE.switchbox(%[[T22]]) {
+// CHECK:           %[[A0:.*]] = AIE.amsel<0> (0)
+// CHECK:           AIE.masterset(North : 0, %[[A0]])
+// CHECK:           AIE.packetrules(DMA : 0) {
+// CHECK:             AIE.rule(31, 1, %[[A0]])
+// CHECK:           }
+// CHECK:         }
+// CHECK:         %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:         AIE.switchbox(%[[T23]]) {
+// CHECK:           %[[A1:.*]] = AIE.amsel<0> (0)
+// CHECK:           AIE.masterset(North : 0, %[[A1]])
+// CHECK:           AIE.packetrules(South : 0) {
+// CHECK:             AIE.rule(31, 1, %[[A1]])
+// CHECK:           }
+// CHECK:         }
+// CHECK:         %[[T24:.*]] = AIE.tile(2, 4)
+// CHECK:         AIE.switchbox(%[[T24]]) {
+// CHECK:           %[[A2:.*]] = AIE.amsel<0> (0)
+// CHECK:           AIE.masterset(Core : 0, %[[A2]])
+// CHECK:           AIE.packetrules(South : 0) {
+// CHECK:             AIE.rule(31, 1, %[[A2]])
+// CHECK:           }
+// CHECK:         }
+  %t22 = AIE.tile(2, 2)
+  %t23 = AIE.tile(2, 3)
+  %t24 = AIE.tile(2, 4)
+
+  AIE.packet_flow(0x1) {
+    AIE.packet_source<%t22, DMA : 0>
+    AIE.packet_dest<%t24, Core : 0>
+  }
+ }
+}
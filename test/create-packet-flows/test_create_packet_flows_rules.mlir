@@ -0,0 +1,111 @@
+//===- test_create_packet_flows_rules.mlir ---------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --split-input-file --aie-create-packet-flows %s | FileCheck %s
+// RUN: aie-opt --split-input-file --aie-create-packet-flows="assign-ids=true" %s | FileCheck %s --check-prefix=ASSIGN
+
+// IDs 1, 2 and 3 go to the core and ID 0 to the DMA.  One rule matching IDs
+// 0 to 3 would also send ID 0 to the core, so IDs 1, 2 and 3 need two rules.
+
+// CHECK-LABEL: module @packet_rules_overlap {
+// CHECK:     AIE.packetrules(West : 0) {
+// CHECK-NEXT:  AIE.rule(29, 1, %[[CORE:.*]])
+// CHECK-NEXT:  AIE.rule(31, 2, %[[CORE]])
+// CHECK-NEXT:  AIE.rule(31, 0, %{{.*}})
+// CHECK-NEXT: }
+
+module @packet_rules_overlap {
+ AIE.device(xcvc1902) {
+  %t11 = AIE.tile(1, 1)
+
+  AIE.packet_flow(0x0) {
+    AIE.packet_source<%t11, West : 0>
+    AIE.packet_dest<%t11, DMA : 0>
+  }
+  AIE.packet_flow(0x1) {
+    AIE.packet_source<%t11, West : 0>
+    AIE.packet_dest<%t11, Core : 0>
+  }
+  AIE.packet_flow(0x2) {
+    AIE.packet_source<%t11, West : 0>
+    AIE.packet_dest<%t11, Core : 0>
+  }
+  AIE.packet_flow(0x3) {
+    AIE.packet_source<%t11, West : 0>
+    AIE.packet_dest<%t11, Core : 0>
+  }
+ }
+}
+
+// -----
+
+// With assign-ids, IDs 1, 2 and 3 become IDs 0, 1 and 2, which one rule
+// matches, and ID 0 becomes ID 4.  The packet headers of the BDs follow.
+
+// CHECK-LABEL: module @packet_rules_assign {
+// CHECK:     AIE.rule(29, 1, %{{.*}})
+
+// ASSIGN-LABEL: module @packet_rules_assign {
+// ASSIGN:       AIE.switchbox(%{{.*}}) {
+// ASSIGN:         AIE.packetrules(DMA : 0) {
+// ASSIGN-DAG:       AIE.rule(28, 0, %{{.*}})
+// ASSIGN-DAG:       AIE.rule(31, 4, %{{.*}})
+// ASSIGN:         }
+// ASSIGN:       AIE.dmaBdPacket(0, 0)
+// ASSIGN:       AIE.dmaBdPacket(0, 1)
+// ASSIGN:       AIE.dmaBdPacket(0, 2)
+// ASSIGN:       AIE.dmaBdPacket(0, 4)
+
+module @packet_rules_assign {
+ AIE.device(xcvc1902) {
+  %t11 = AIE.tile(1, 1)
+  %t12 = AIE.tile(1, 2)
+  %buf = AIE.buffer(%t11) : memref<16xi32>
+
+  %m11 = AIE.mem(%t11) {
+    %dma = AIE.dmaStart(MM2S, 0, ^bb1, ^bb5)
+  ^bb1:
+    AIE.dmaBdPacket(0, 1)
+    AIE.dmaBd(<%buf : memref<16xi32>, 0, 16>, 0)
+    AIE.nextBd ^bb2
+  ^bb2:
+    AIE.dmaBdPacket(0, 2)
+    AIE.dmaBd(<%buf : memref<16xi32>, 0, 16>, 0)
+    AIE.nextBd ^bb3
+  ^bb3:
+    AIE.dmaBdPacket(0, 3)
+    AIE.dmaBd(<%buf : memref<16xi32>, 0, 16>, 0)
+    AIE.nextBd ^bb4
+  ^bb4:
+    AIE.dmaBdPacket(0, 0)
+    AIE.dmaBd(<%buf : memref<16xi32>, 0, 16>, 0)
+    AIE.nextBd ^bb1
+  ^bb5:
+    AIE.end
+  }
+
+  AIE.packet_flow(0x0) {
+    AIE.packet_source<%t11, DMA : 0>
+    AIE.packet_dest<%t12, DMA : 1>
+  }
+  AIE.packet_flow(0x1) {
+    AIE.packet_source<%t11, DMA : 0>
+    AIE.packet_dest<%t12, DMA : 0>
+  }
+  AIE.packet_flow(0x2) {
+    AIE.packet_source<%t11, DMA : 0>
+    AIE.packet_dest<%t12, DMA : 0>
+  }
+  AIE.packet_flow(0x3) {
+    AIE.packet_source<%t11, DMA : 0>
+    AIE.packet_dest<%t12, DMA : 0>
+  }
+ }
+}
@@ -0,0 +1,123 @@
+//===- bad-dma-padding.mlir ------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+AIE.device(xcvc1902) {
+  %t = AIE.tile(3, 3)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.mem(%t) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op padding and compression are only supported by the core tile and memtile DMAs of AIE-ML devices.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0) { compression }
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t = AIE.tile(2, 3)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.mem(%t) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op padding is only supported by memtile DMAs.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0, [<16, 16>, <1, 16>] pad [<1, 1>, <1, 1>])
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t = AIE.tile(2, 1)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.memTileDMA(%t) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op padding needs one <before, after> tuple for each of the dimensions of the BD.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0, [<16, 16>, <1, 16>] pad [<1, 1>])
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t = AIE.tile(2, 1)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.memTileDMA(%t) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op cannot pad dimension 0 with more than 31 zeros on each side.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0, [<16, 16>, <1, 16>] pad [<32, 0>, <1, 1>])
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t = AIE.tile(2, 1)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.memTileDMA(%t) {
+    AIE.dmaStart(S2MM, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op padding is only supported on MM2S channels.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 324>, 0, [<16, 16>, <1, 16>] pad [<1, 1>, <1, 1>])
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t = AIE.tile(2, 1)
+  %buf = AIE.buffer(%t) : memref<256xi32>
+  AIE.memTileDMA(%t) {
+    AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+  ^bd0:
+    // expected-error@+1 {{'AIE.dmaBd' op pads the tensor to 324 elements, more than the 256 of the BD.}}
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0, [<16, 16>, <1, 16>] pad [<1, 1>, <1, 1>])
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t20 = AIE.tile(2, 0)
+  %t23 = AIE.tile(2, 3)
+  // expected-error@+1 {{'AIE.objectFifo' op compression is not supported by shim DMAs.}}
+  AIE.objectFifo @of (%t20, { %t23 }, 2 : i32) { compression } : !AIE.objectFifo<memref<256xi32>>
+}
+
+// -----
+
+AIE.device(xcve2302) {
+  %t22 = AIE.tile(2, 2)
+  %t23 = AIE.tile(2, 3)
+  // expected-error@+1 {{'AIE.objectFifo' op padding is only supported for memtile producers.}}
+  AIE.objectFifo @of (%t22 toStream [<16, 16>, <1, 16>] pad [<1, 1>, <1, 1>], { %t23 }, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+}
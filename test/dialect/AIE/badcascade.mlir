@@ -0,0 +1,57 @@
+//===- badcascade.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+// Row 3 of AIE1 cascades to the east.
+AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3)
+  %t13 = AIE.tile(1, 3)
+  // expected-error@+1 {{'AIE.cascadeFlow' op tile (2, 3) cannot cascade to tile (1, 3)}}
+  AIE.cascadeFlow(%t23, %t13)
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  %t30 = AIE.tile(3, 0)
+  // expected-error@+1 {{'AIE.cascadeFlow' op source and dest must be core tiles}}
+  AIE.cascadeFlow(%t20, %t30)
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  // expected-error@+1 {{'AIE.cascadeFlow' op cannot cascade a core to itself}}
+  AIE.cascadeFlow(%t13, %t13)
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t23 = AIE.tile(2, 3)
+  %t14 = AIE.tile(1, 4)
+  AIE.cascadeFlow(%t13, %t23)
+  // expected-error@+1 {{'AIE.cascadeFlow' op source tile already has a cascade output}}
+  AIE.cascadeFlow(%t13, %t14)
+}
+
+// -----
+
+// AIE2 cascades to the east or the south, not to the north.
+AIE.device(xcve2802) {
+  %t23 = AIE.tile(2, 3)
+  %t24 = AIE.tile(2, 4)
+  // expected-error@+1 {{'AIE.cascadeFlow' op tile (2, 3) cannot cascade to tile (2, 4)}}
+  AIE.cascadeFlow(%t23, %t24)
+}
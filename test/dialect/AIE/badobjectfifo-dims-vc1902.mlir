@@ -0,0 +1,20 @@
+//===- badobjectfifo-dims-vc1902.mlir --------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --verify-diagnostics %s
+
+module {
+  AIE.device(xcvc1902) {
+    %tile12 = AIE.tile(1, 2)
+    %tile33 = AIE.tile(3, 3)
+    // expected-error@+1 {{data layout transformations are only supported on AIE2 devices}}
+    AIE.objectFifo @of (%tile12 toStream [<1, 8>, <8, 8>], {%tile33}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+  }
+}
@@ -0,0 +1,20 @@
+//===- badobjectfifo-repeat.mlir -------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --verify-diagnostics %s
+
+module {
+  AIE.device(xcve2302) {
+    %tile02 = AIE.tile(0, 2)
+    %tile03 = AIE.tile(0, 3)
+    // expected-error@+1 {{repeatCount is only supported for memtile producers}}
+    AIE.objectFifo @of (%tile02, {%tile03}, 2 : i32) {repeatCount = 2 : i32} : !AIE.objectFifo<memref<64xi32>>
+  }
+}
@@ -0,0 +1,33 @@
+//===- badpartition-ve2802.mlir --------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+// expected-error@+1 {{'AIE.device' op partition (36, 4) must be within the columns of the device (38)}}
+AIE.device(xcve2802) partition(36, 4) {
+}
+
+// -----
+
+AIE.device(xcve2802) partition(4, 2) {
+  %t = AIE.tile(2, 3)
+  // expected-error@-1 {{'AIE.tile' op column index (2) must be less than the number of columns in the device (2)}}
+}
+
+// -----
+
+// Column 4 of the device has no NOC connection.
+AIE.device(xcve2802) partition(4, 2) {
+  %t = AIE.tile(0, 0)
+  %dma = AIE.shimDMA(%t) {
+  // expected-error@-1 {{'AIE.shimDMA' op must be in a ShimTile with a NOC connection}}
+    AIE.end
+  }
+}
@@ -0,0 +1,50 @@
+//===- badrtp.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+AIE.device(xcvc1902) {
+  %t20 = AIE.tile(2, 0)
+  // expected-error@+1 {{'AIE.rtp' op must be on a core tile}}
+  AIE.rtp @params (%t20) : memref<4xi32>
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  // expected-error@+1 {{'AIE.rtp' op block must be a whole number of 32-bit words}}
+  AIE.rtp @params (%t13) : memref<3xi8>
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  AIE.rtp @params (%t13) : memref<4xi32>
+  %core13 = AIE.core(%t13) {
+    // expected-error@+1 {{'AIE.rtp.get' op result type must be the type of the rtp block}}
+    %p = AIE.rtp.get @params : memref<4xf32>
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t33 = AIE.tile(3, 3)
+  AIE.rtp @params (%t13) : memref<4xi32>
+  %core33 = AIE.core(%t33) {
+    // expected-error@+1 {{'AIE.rtp.get' op core cannot access the memory of the rtp block}}
+    %p = AIE.rtp.get @params : memref<4xi32>
+    AIE.end
+  }
+}
@@ -0,0 +1,45 @@
+//===- badstreamfifo.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t20 = AIE.tile(2, 0)
+  // expected-error@+1 {{'AIE.streamFifo' op consumers must be core tiles}}
+  AIE.streamFifo @sf (%t13, {%t20}) : i32
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  AIE.streamFifo @sf (%t13, {%t14}) : i32
+  %core14 = AIE.core(%t14) {
+    %v = arith.constant 7 : i32
+    // expected-error@+1 {{'AIE.streamFifo.put' op must be called from the core of the producer tile}}
+    AIE.streamFifo.put @sf (%v : i32)
+    AIE.end
+  }
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  AIE.streamFifo @sf (%t13, {%t14}) : i32
+  %core14 = AIE.core(%t14) {
+    // expected-error@+1 {{'AIE.streamFifo.get' op value type must be the element type of the streamFifo}}
+    %v = AIE.streamFifo.get @sf : f32
+    AIE.end
+  }
+}
@@ -0,0 +1,41 @@
+//===- bytecode.mlir -------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --emit-bytecode %s | aie-opt | FileCheck %s
+
+// The attributes and the types of the AIE dialect are read back from their
+// bytecode encoding.
+
+// CHECK: AIE.objectFifo @of(%{{.*}} toStream [<1, 8>, <8, 8>], {%{{.*}}}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+// CHECK: AIE.objectFifo.acquire @of(Produce, 1) : !AIE.objectFifoSubview<memref<64xi32>>
+// CHECK: AIE.dmaBd({{.*}}[<16, 16>, <1, 16>] pad [<1, 2>, <0, 3>]
+
+module @bytecode {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile33 = AIE.tile(3, 3)
+    %tile21 = AIE.tile(2, 1)
+    AIE.objectFifo @of (%tile12 toStream [<1, 8>, <8, 8>], {%tile33}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+    %core12 = AIE.core(%tile12) {
+      %p = AIE.objectFifo.acquire @of (Produce, 1) : !AIE.objectFifoSubview<memref<64xi32>>
+      AIE.objectFifo.release @of (Produce, 1)
+      AIE.end
+    }
+    %buf = AIE.buffer(%tile21) : memref<256xi32>
+    AIE.memTileDMA(%tile21) {
+      AIE.dmaStart(MM2S, 0, ^bd0, ^end)
+    ^bd0:
+      AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0, [<16, 16>, <1, 16>] pad [<1, 2>, <0, 3>])
+      AIE.nextBd ^bd0
+    ^end:
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,44 @@
+//===- cascade_flow.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: module @cascade_aie1 {
+// CHECK: AIE.cascadeFlow(%{{.*}}, %{{.*}})
+// CHECK: AIE.cascadeFlow(%{{.*}}, %{{.*}})
+// CHECK: AIE.cascadeFlow(%{{.*}}, %{{.*}})
+module @cascade_aie1 {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t23 = AIE.tile(2, 3)
+  %t24 = AIE.tile(2, 4)
+  %t14 = AIE.tile(1, 4)
+  AIE.cascadeFlow(%t13, %t23)
+  AIE.cascadeFlow(%t24, %t14)
+  %t493 = AIE.tile(49, 3)
+  %t494 = AIE.tile(49, 4)
+  AIE.cascadeFlow(%t493, %t494)
+ }
+}
+
+// -----
+
+// CHECK-LABEL: module @cascade_aie2 {
+// CHECK: AIE.cascadeFlow(%{{.*}}, %{{.*}})
+// CHECK: AIE.cascadeFlow(%{{.*}}, %{{.*}})
+module @cascade_aie2 {
+ AIE.device(xcve2802) {
+  %t14 = AIE.tile(1, 4)
+  %t24 = AIE.tile(2, 4)
+  %t23 = AIE.tile(2, 3)
+  AIE.cascadeFlow(%t14, %t24)
+  AIE.cascadeFlow(%t24, %t23)
+ }
+}
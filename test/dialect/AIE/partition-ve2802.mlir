@@ -0,0 +1,27 @@
+//===- partition-ve2802.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s | FileCheck %s
+// CHECK: AIE.device(xcve2802) partition(6, 2) {
+// CHECK: %[[T00:.*]] = AIE.tile(0, 0)
+// CHECK: AIE.shimDMA(%[[T00]])
+
+// Columns 6 and 7 of the device have a NOC connection, they are columns 0 and
+// 1 of the partition.
+module {
+  AIE.device(xcve2802) partition(6, 2) {
+    %00 = AIE.tile(0, 0)
+    %13 = AIE.tile(1, 3)
+    %lock = AIE.lock(%00, 0)
+    %dma = AIE.shimDMA(%00) {
+      AIE.end
+    }
+  }
+}
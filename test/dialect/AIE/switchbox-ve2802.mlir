@@ -99,6 +99,7 @@ module {
       AIE.connect<East: 3, West: 3> // 4 westgoing connections
       AIE.connect<North: 3, South: 3> // 4 southgoing connections
       AIE.connect<West: 3, East: 3> // 4 eastgoing connections
+      AIE.connect<South: 1, Ctrl: 0> // Control packets
     }
   }
 }
@@ -102,3 +102,90 @@ func.func @merge_single_column_mac(%A : vector<16xi16>,
                                     : vector<32xi16>, vector<16xi16>, vector<16xi48>
     return %mac1 : vector<16xi48>
 }
+
+// -----
+
+// A chain of single-column macs is merged a pair at a time.
+
+// CHECK-LABEL: func.func @merge_single_column_mac_chain(
+// CHECK-SAME: %[[VA:[A-Za-z0-9]+]]: vector<16xi16>,
+// CHECK-SAME: %[[VB:[A-Za-z0-9]+]]: vector<16xi16>,
+// CHECK-SAME: %[[VC:[A-Za-z0-9]+]]: vector<16xi16>,
+// CHECK-SAME: %[[VD:[A-Za-z0-9]+]]: vector<16xi16>,
+// CHECK-SAME: %[[VE:[A-Za-z0-9]+]]: vector<16xi16>) -> vector<16xi48> {
+func.func @merge_single_column_mac_chain(%A : vector<16xi16>,
+                                         %B : vector<16xi16>,
+                                         %C : vector<16xi16>,
+                                         %D : vector<16xi16>,
+                                         %E : vector<16xi16>) -> vector<16xi48> {
+    // CHECK: %[[ACC:.*]] = arith.constant dense<0> : vector<16xi48>
+    // CHECK: %[[VAB:.*]] = aievec.concat %[[VA]], %[[VB]] : vector<16xi16>, vector<32xi16>
+    // CHECK-NEXT: %[[MAC0:.*]] = aievec.mac %[[VAB]], %[[VE]], %[[ACC]] {
+    // CHECK-SAME: zstart = "0", zstep = "1"}
+    // CHECK: %[[VCD:.*]] = aievec.concat %[[VC]], %[[VD]] : vector<16xi16>, vector<32xi16>
+    // CHECK-NEXT: %[[MAC1:.*]] = aievec.mac %[[VCD]], %[[VE]], %[[MAC0]] {
+    // CHECK-SAME: zstart = "2", zstep = "1"}
+    // CHECK-NEXT: return %[[MAC1]] : vector<16xi48>
+    %acc = arith.constant dense<0> : vector<16xi48>
+    %zvec = arith.constant dense<0> : vector<16xi16>
+    %la = aievec.concat %A, %zvec : vector<16xi16>, vector<32xi16>
+    %mac0 = aievec.mac %la, %E, %acc {xoffsets = "0x73727170",
+                                      xoffsets_hi = "0x77767574",
+                                      xsquare = "0x3120", xstart = "0",
+                                      zoffsets = "0", zoffsets_hi = "0",
+                                      zstart = "0", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %lb = aievec.concat %B, %zvec : vector<16xi16>, vector<32xi16>
+    %mac1 = aievec.mac %lb, %E, %mac0 {xoffsets = "0x73727170",
+                                       xoffsets_hi = "0x77767574",
+                                       xsquare = "0x3120", xstart = "0",
+                                       zoffsets = "0", zoffsets_hi = "0",
+                                       zstart = "1", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %lc = aievec.concat %C, %zvec : vector<16xi16>, vector<32xi16>
+    %mac2 = aievec.mac %lc, %E, %mac1 {xoffsets = "0x73727170",
+                                       xoffsets_hi = "0x77767574",
+                                       xsquare = "0x3120", xstart = "0",
+                                       zoffsets = "0", zoffsets_hi = "0",
+                                       zstart = "2", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %ld = aievec.concat %D, %zvec : vector<16xi16>, vector<32xi16>
+    %mac3 = aievec.mac %ld, %E, %mac2 {xoffsets = "0x73727170",
+                                       xoffsets_hi = "0x77767574",
+                                       xsquare = "0x3120", xstart = "0",
+                                       zoffsets = "0", zoffsets_hi = "0",
+                                       zstart = "3", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    return %mac3 : vector<16xi48>
+}
+
+// -----
+
+// The first mac is still needed for its other use, so merging saves nothing.
+
+// CHECK-LABEL: func.func @no_merge_used_mac(
+// CHECK: %[[MAC0:.*]] = aievec.mac
+// CHECK: %[[MAC1:.*]] = aievec.mac {{.*}}, %[[MAC0]] {
+// CHECK-SAME: zstart = "1", zstep = "1"}
+// CHECK: return %[[MAC0]], %[[MAC1]]
+func.func @no_merge_used_mac(%A : vector<16xi16>,
+                             %B : vector<16xi16>,
+                             %C : vector<16xi16>) -> (vector<16xi48>, vector<16xi48>) {
+    %acc = arith.constant dense<0> : vector<16xi48>
+    %zvec = arith.constant dense<0> : vector<16xi16>
+    %la = aievec.concat %A, %zvec : vector<16xi16>, vector<32xi16>
+    %mac0 = aievec.mac %la, %C, %acc {xoffsets = "0x73727170",
+                                      xoffsets_hi = "0x77767574",
+                                      xsquare = "0x3120", xstart = "0",
+                                      zoffsets = "0", zoffsets_hi = "0",
+                                      zstart = "0", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    %lb = aievec.concat %B, %zvec : vector<16xi16>, vector<32xi16>
+    %mac1 = aievec.mac %lb, %C, %mac0 {xoffsets = "0x73727170",
+                                       xoffsets_hi = "0x77767574",
+                                       xsquare = "0x3120", xstart = "0",
+                                       zoffsets = "0", zoffsets_hi = "0",
+                                       zstart = "1", zstep = "1"}
+                                    : vector<32xi16>, vector<16xi16>, vector<16xi48>
+    return %mac0, %mac1 : vector<16xi48>, vector<16xi48>
+}
@@ -43,8 +43,10 @@ func.func @unaligned_transfer_read(%m : memref<1024xi32>, %pos : index) -> vecto
     // CHECK-DAG: %[[C0:.*]] = arith.constant 0 : i32
     %c0_i32 = arith.constant 0 : i32
     %i = affine.apply affine_map<(d0) -> (d0 + 5)>(%pos)
-    // CHECK-DAG: %[[LV:.*]] = vector.transfer_read %[[MEM]][%[[POS]]], %[[C0]] : memref<1024xi32>, vector<16xi32>
-    // CHECK-DAG: %[[AV:.*]] = vector.extract_strided_slice %[[LV]] {offsets = [5], sizes = [8], strides = [1]} : vector<16xi32> to vector<8xi32>
+    // CHECK-DAG: %[[HPOS:.*]] = affine.apply #{{.*}}(%[[POS]])
+    // CHECK-DAG: %[[LV:.*]] = vector.transfer_read %[[MEM]][%[[POS]]], %[[C0]] : memref<1024xi32>, vector<8xi32>
+    // CHECK-DAG: %[[HV:.*]] = vector.transfer_read %[[MEM]][%[[HPOS]]], %[[C0]] : memref<1024xi32>, vector<8xi32>
+    // CHECK: %[[AV:.*]] = vector.shuffle %[[LV]], %[[HV]] [5, 6, 7, 8, 9, 10, 11, 12] : vector<8xi32>, vector<8xi32>
     %v = vector.transfer_read %m[%i], %c0_i32 : memref<1024xi32>, vector<8xi32>
     // CHECK: return %[[AV]] : vector<8xi32>
     return %v : vector<8xi32>
@@ -0,0 +1,50 @@
+//===- bad_runtime_sequence.mlir -------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt %s -split-input-file -verify-diagnostics
+
+AIE.device(xcvc1902) {
+  %t = AIE.tile(2, 2)
+  %buf = AIE.external_buffer { sym_name = "buf" } : memref<256xi32>
+  AIEX.runtime_sequence @seq {
+    // expected-error@+1 {{'AIEX.shim_dma_transfer' op expects a shim NOC tile}}
+    AIEX.shim_dma_transfer(%t, MM2S : 0, <%buf : memref<256xi32>, 0, 256>)
+  }
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t = AIE.tile(2, 0)
+  %buf = AIE.external_buffer { sym_name = "buf" } : memref<256xi32>
+  AIEX.runtime_sequence @seq {
+    // expected-error@+1 {{'AIEX.shim_dma_transfer' op accesses elements up to 320 of a buffer of 256}}
+    AIEX.shim_dma_transfer(%t, MM2S : 0, <%buf : memref<256xi32>, 0, 64>) { repeat = 4 : i32, stride = 64 : i32 }
+  }
+}
+
+// -----
+
+AIE.device(xcvc1902) {
+  %t = AIE.tile(2, 0)
+  %buf = AIE.external_buffer { sym_name = "buf" } : memref<256xi32>
+  AIE.shimDMA(%t) {
+    AIE.dmaStart(S2MM, 0, ^bd0, ^end)
+  ^bd0:
+    AIE.dmaBd(<%buf : memref<256xi32>, 0, 256>, 0)
+    AIE.nextBd ^bd0
+  ^end:
+    AIE.end
+  }
+  AIEX.runtime_sequence @seq {
+    // expected-error@+1 {{'AIEX.shim_dma_transfer' op uses a channel driven by an AIE.shimDMA}}
+    AIEX.shim_dma_transfer(%t, S2MM : 0, <%buf : memref<256xi32>, 0, 256>)
+  }
+}
@@ -0,0 +1,93 @@
+//===- eliminate_dead_resources.mlir ---------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-eliminate-dead-resources %s | FileCheck %s
+// RUN: aie-opt --aie-eliminate-dead-resources="keep-named=false" %s | FileCheck %s --check-prefix=UNNAMED
+
+// CHECK-LABEL: module @eliminate_dead_resources {
+// CHECK:         %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK:         %[[T14:.*]] = AIE.tile(1, 4)
+// CHECK:         %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:         %[[T24:.*]] = AIE.tile(2, 4)
+// CHECK-NOT:     AIE.buffer(%[[T13]]) : memref<16xi32>
+// CHECK:         AIE.buffer(%[[T13]]) {sym_name = "named"} : memref<16xi32>
+// CHECK:         %[[IN:.*]] = AIE.buffer(%[[T13]]) : memref<16xi32>
+// CHECK:         AIE.lock(%[[T13]], 0)
+// CHECK-NOT:     AIE.lock(%[[T13]], 1)
+// CHECK:         AIE.lock(%[[T13]], 2) {sym_name = "named_lock"}
+
+// The flow to the S2MM channel 0 of tile (1, 3) is used by its DMA, the ones
+// to its channel 1 and to the core of tile (2, 4), which has none, are not.
+// CHECK:         AIE.flow(%{{.*}}, DMA : 0, %[[T13]], DMA : 0)
+// CHECK-NOT:     AIE.flow
+
+// The connections to the core of tile (2, 3) lead there first through tile
+// (1, 3), the ones to the core of tile (2, 4) through tile (1, 4).
+// CHECK:         AIE.switchbox(%[[T13]]) {
+// CHECK-NEXT:      AIE.connect<West : 0, East : 0>
+// CHECK-NEXT:    }
+// CHECK-NOT:     AIE.switchbox(%[[T14]])
+// CHECK:         AIE.switchbox(%[[T23]]) {
+// CHECK-NEXT:      AIE.connect<West : 0, Core : 0>
+// CHECK-NEXT:    }
+// CHECK-NOT:     AIE.switchbox(%[[T24]])
+
+// UNNAMED-NOT:   sym_name = "named"
+// UNNAMED-NOT:   sym_name = "named_lock"
+
+module @eliminate_dead_resources {
+  AIE.device(xcvc1902) {
+    %t13 = AIE.tile(1, 3)
+    %t14 = AIE.tile(1, 4)
+    %t23 = AIE.tile(2, 3)
+    %t24 = AIE.tile(2, 4)
+    %t70 = AIE.tile(7, 0)
+
+    %unused = AIE.buffer(%t13) : memref<16xi32>
+    %named = AIE.buffer(%t13) { sym_name = "named" } : memref<16xi32>
+    %in = AIE.buffer(%t13) : memref<16xi32>
+    %lock = AIE.lock(%t13, 0)
+    %unused_lock = AIE.lock(%t13, 1)
+    %named_lock = AIE.lock(%t13, 2) { sym_name = "named_lock" }
+
+    AIE.flow(%t70, DMA : 0, %t13, DMA : 0)
+    AIE.flow(%t70, DMA : 1, %t13, DMA : 1)
+    AIE.flow(%t70, DMA : 0, %t24, Core : 0)
+
+    AIE.switchbox(%t13) {
+      AIE.connect<West : 0, East : 0>
+      AIE.connect<West : 1, North : 0>
+    }
+    AIE.switchbox(%t14) {
+      AIE.connect<South : 0, East : 0>
+    }
+    AIE.switchbox(%t23) {
+      AIE.connect<West : 0, Core : 0>
+    }
+    AIE.switchbox(%t24) {
+      AIE.connect<West : 0, Core : 0>
+    }
+
+    AIE.mem(%t13) {
+      %dma = AIE.dmaStart(S2MM, 0, ^bd0, ^end)
+    ^bd0:
+      AIE.useLock(%lock, Acquire, 0)
+      AIE.dmaBd(<%in : memref<16xi32>, 0, 16>, 0)
+      AIE.useLock(%lock, Release, 1)
+      AIE.nextBd ^bd0
+    ^end:
+      AIE.end
+    }
+
+    AIE.core(%t23) {
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,80 @@
+//===- overlays.mlir -------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-translate --tilecol=1 --tilerow=3 --aie-generate-ldscript %s | FileCheck --check-prefix=LD %s
+// RUN: aie-translate --aie-generate-xaie %s | FileCheck --check-prefix=XAIE %s
+
+// The 8KB window of the overlays takes the top of the 16KB of program
+// memory, and the rest of the code has to fit below it.
+
+// LD: MEMORY
+// LD-NEXT: {
+// LD-NEXT:    program (RX) : ORIGIN = 0, LENGTH = 0x2000
+// LD-NEXT:    overlay (RX) : ORIGIN = 0x2000, LENGTH = 0x2000
+// LD-NEXT:    data (!RX) : ORIGIN = {{.*}}
+// LD-NEXT: }
+// LD:      *(.text)
+// LD-NEXT:   } > program
+// LD-NEXT:   OVERLAY 0x2000 : AT (0x100000)
+// LD-NEXT:   {
+// LD-NEXT:     .overlay0 { *(.text.conv) *(.text.relu) }
+// LD-NEXT:     .overlay1 { *(.text.pool) }
+// LD-NEXT:   } > overlay
+// LD-NEXT:   .data : {
+
+// XAIE: static AieRC __mlir_aie_load_overlay(
+// XAIE: int mlir_aie_serve_overlay_1_3(aie_libxaie_ctx_t* ctx, int timeoutUs) {
+// XAIE-NEXT:   if (XAie_LockAcquire(&(ctx->DevInst), XAie_TileLoc(1,3), XAie_LockInit(4,1), timeoutUs) != XAIE_OK)
+// XAIE-NEXT:     return -1;
+// XAIE-NEXT:   u32 overlay;
+// XAIE-NEXT:   if (XAie_DataMemRdWord(&(ctx->DevInst), XAie_TileLoc(1,3), 1280, &overlay) != XAIE_OK)
+// XAIE-NEXT:     return -1;
+// XAIE-NEXT:   if (!(overlay == 0 || overlay == 1))
+// XAIE-NEXT:     return -1;
+// XAIE-NEXT:   char fileName[64];
+// XAIE-NEXT:   snprintf(fileName, sizeof(fileName), "core_1_3.overlay%u.bin", overlay);
+// XAIE-NEXT:   if (__mlir_aie_load_overlay(&(ctx->DevInst), XAie_TileLoc(1,3), fileName, 0x2000, 0x2000) != XAIE_OK)
+// XAIE-NEXT:     return -1;
+// XAIE-NEXT:   XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(1,3), XAie_LockInit(4,0), 0);
+// XAIE-NEXT:   XAie_LockRelease(&(ctx->DevInst), XAie_TileLoc(1,3), XAie_LockInit(5,1), 0);
+// XAIE-NEXT:   return overlay;
+// XAIE-NEXT: }
+
+module {
+  AIE.device(xcvc1902) {
+    func.func private @conv(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func private @relu(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func private @pool(memref<64xi32>) attributes {aie.overlay = 1 : i32}
+    %tile13 = AIE.tile(1, 3)
+    %act = AIE.buffer(%tile13) {address = 1024 : i32, sym_name = "act"} : memref<64xi32>
+    %overlay = AIE.buffer(%tile13) {address = 1280 : i32, sym_name = "core_1_3_overlay"} : memref<1xi32>
+    %request = AIE.lock(%tile13, 4) {sym_name = "core_1_3_overlay_request"}
+    %loaded = AIE.lock(%tile13, 5) {sym_name = "core_1_3_overlay_loaded"}
+    AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %none = arith.constant -1 : i32
+      memref.store %none, %overlay[%c0] : memref<1xi32>
+      %id0 = arith.constant 0 : i32
+      memref.store %id0, %overlay[%c0] : memref<1xi32>
+      AIE.useLock(%request, Release, 1)
+      AIE.useLock(%loaded, Acquire, 1)
+      AIE.useLock(%loaded, Release, 0)
+      func.call @conv(%act) : (memref<64xi32>) -> ()
+      func.call @relu(%act) : (memref<64xi32>) -> ()
+      %id1 = arith.constant 1 : i32
+      memref.store %id1, %overlay[%c0] : memref<1xi32>
+      AIE.useLock(%request, Release, 1)
+      AIE.useLock(%loaded, Acquire, 1)
+      AIE.useLock(%loaded, Release, 0)
+      func.call @pool(%act) : (memref<64xi32>) -> ()
+      AIE.end
+    } {overlay_size = 8192 : i32}
+  }
+}
@@ -0,0 +1,50 @@
+//===- test_generate_all.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: rm -rf %t && aie-translate --aie-generate-all --aie-output-dir=%t %s | FileCheck %s
+// RUN: FileCheck --check-prefix=CORES %s < %t/corelist
+// RUN: FileCheck --check-prefix=ARCH %s < %t/target_arch
+// RUN: aie-translate --aie-generate-symbol-table %s | diff - %t/symbols.json
+// RUN: aie-translate --tilecol=4 --tilerow=4 --aie-generate-bcf %s | diff - %t/core_4_4.bcf
+// RUN: aie-translate --tilecol=4 --tilerow=4 --aie-generate-ldscript %s | diff - %t/core_4_4.ld.script
+// RUN: aie-translate --tilecol=3 --tilerow=4 --aie-generate-ldscript %s | diff - %t/core_3_4.ld.script
+
+// CHECK: corelist
+// CHECK: target_arch
+// CHECK: shim_dma.json
+// CHECK: symbols.json
+// CHECK: core_3_4.ld.script
+// CHECK: core_3_4.bcf
+// CHECK: core_4_4.ld.script
+// CHECK: core_4_4.bcf
+// CHECK-NOT: core_5_4
+
+// CORES: [(3,4,None),(4,4,"core_44.elf"),]
+// ARCH: AIE
+
+module @test_generate_all {
+ AIE.device(xcvc1902) {
+  %t34 = AIE.tile(3, 4)
+  %t44 = AIE.tile(4, 4)
+  %t54 = AIE.tile(5, 4)
+
+  %buf34_0 = AIE.buffer(%t34) { sym_name = "x", address = 0x0 } : memref<8xi32>
+  %buf44_0 = AIE.buffer(%t44) { sym_name = "a", address = 0x0 } : memref<4xi32>
+  %buf44_1 = AIE.buffer(%t44) { sym_name = "b", address = 0x10  } : memref<16xi32>
+  %buf54_0 = AIE.buffer(%t54) { sym_name = "y", address = 0x0 } : memref<8xi32>
+
+  AIE.core(%t34) {
+    AIE.end
+  }
+  AIE.core(%t44) {
+    AIE.end
+  } { elf_file = "core_44.elf" }
+ }
+}
@@ -0,0 +1,54 @@
+//===- test_generate_all_devices.mlir --------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: rm -rf %t && aie-translate --aie-generate-all --aie-output-dir=%t %s | FileCheck %s
+// RUN: FileCheck --check-prefix=CORES0 %s < %t/device0/corelist
+// RUN: FileCheck --check-prefix=CORES1 %s < %t/device1/corelist
+// RUN: FileCheck --check-prefix=ARCH0 %s < %t/device0/target_arch
+// RUN: FileCheck --check-prefix=ARCH1 %s < %t/device1/target_arch
+// RUN: aie-translate --aie-device=1 --aie-generate-corelist %s | diff - %t/device1/corelist
+// RUN: aie-translate --aie-device=1 --tilecol=2 --tilerow=3 --aie-generate-ldscript %s | diff - %t/device1/core_2_3.ld.script
+// RUN: aie-translate --aie-device=0 --aie-generate-symbol-table %s | diff - %t/device0/symbols.json
+// RUN: rm -rf %t.one && aie-translate --aie-device=1 --aie-generate-all --aie-output-dir=%t.one %s | FileCheck --check-prefix=ONE %s
+// RUN: not aie-translate --aie-device=2 --aie-generate-corelist %s 2>&1 | FileCheck --check-prefix=RANGE %s
+
+// CHECK: device0{{/|\\}}corelist
+// CHECK: device0{{/|\\}}core_1_3.bcf
+// CHECK-NOT: core_2_3
+// CHECK: device1{{/|\\}}corelist
+// CHECK-NOT: core_1_3
+// CHECK: device1{{/|\\}}core_2_3.bcf
+
+// CORES0: [(1,3,None),]
+// CORES1: [(2,3,None),]
+// ARCH0: AIE
+// ARCH1: AIE2
+
+// ONE-NOT: device{{[0-9]}}
+// ONE: core_2_3.ld.script
+
+// RANGE: has no AIE.device of index 2, it has 2
+
+module @test_generate_all_devices {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %buf13 = AIE.buffer(%t13) { sym_name = "a", address = 0x0 } : memref<8xi32>
+  AIE.core(%t13) {
+    AIE.end
+  }
+ }
+ AIE.device(xcve2302) {
+  %t23 = AIE.tile(2, 3)
+  %buf23 = AIE.buffer(%t23) { sym_name = "b", address = 0x0 } : memref<8xi32>
+  AIE.core(%t23) {
+    AIE.end
+  }
+ }
+}
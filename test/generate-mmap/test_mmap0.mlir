@@ -12,8 +12,6 @@
 // RUN: aie-translate --tilecol=4 --tilerow=4 --aie-generate-bcf %s | FileCheck --check-prefix=BCF44 %s
 // RUN: aie-translate --tilecol=4 --tilerow=4 --aie-generate-ldscript %s | FileCheck --check-prefix=LD44 %s
 
-// CHECK-LABEL: Tile(5, 4)
-// CHECK: _symbol y 0x28000 32
 // CHECK-LABEL: Tile(4, 4)
 // CHECK: _symbol z 0x20000 32
 // CHECK: _symbol a 0x28000 16
@@ -21,44 +19,46 @@
 // CHECK: _symbol c 0x28050 1024
 // CHECK: _symbol t 0x30000 32
 // CHECK: _symbol y 0x38000 32
-// CHECK-LABEL: Tile(4, 5)
-// CHECK: _symbol a 0x20000 16
-// CHECK: _symbol b 0x20010 64
-// CHECK: _symbol c 0x20050 1024
-// CHECK: _symbol t 0x38000 32
-// CHECK-LABEL: Tile(4, 3)
-// CHECK: _symbol a 0x30000 16
-// CHECK: _symbol b 0x30010 64
-// CHECK: _symbol c 0x30050 1024
-// CHECK: _symbol z 0x38000 32
 // CHECK-LABEL: Tile(3, 4)
 // CHECK: _symbol x 0x28000 32
 // CHECK: _symbol a 0x38000 16
 // CHECK: _symbol b 0x38010 64
 // CHECK: _symbol c 0x38050 1024
+// CHECK-LABEL: Tile(5, 4)
+// CHECK: _symbol y 0x28000 32
+// CHECK-LABEL: Tile(4, 3)
+// CHECK: _symbol a 0x30000 16
+// CHECK: _symbol b 0x30010 64
+// CHECK: _symbol c 0x30050 1024
+// CHECK: _symbol z 0x38000 32
+// CHECK-LABEL: Tile(4, 5)
+// CHECK: _symbol a 0x20000 16
+// CHECK: _symbol b 0x20010 64
+// CHECK: _symbol c 0x20050 1024
+// CHECK: _symbol t 0x38000 32
 
 // BCF44:      _entry_point _main_init
 // BCF44-NEXT: _symbol core_4_4 _after _main_init
 // BCF44-NEXT: _symbol _main_init 0
 // BCF44-NEXT: _reserved DMb      0x00000 0x20000 //Don't put data in code memory
-// BCF44-NEXT: _symbol z 0x20000 0x20
+// BCF44-NEXT: _symbol z 0x20000 0x20 // DM_bankA
 // BCF44-NEXT: _extern z
 // BCF44-NEXT: _reserved DMb 0x20000 0x20
 // BCF44-NEXT: _reserved DMb 0x20000 0x8000
-// BCF44-NEXT: _symbol a 0x28000 0x10
+// BCF44-NEXT: _symbol a 0x28000 0x10 // DM_bankA
 // BCF44-NEXT: _extern a
 // BCF44-NEXT: _reserved DMb 0x28000 0x10
-// BCF44-NEXT: _symbol b 0x28010 0x40
+// BCF44-NEXT: _symbol b 0x28010 0x40 // DM_bankA
 // BCF44-NEXT: _extern b
 // BCF44-NEXT: _reserved DMb 0x28010 0x40
-// BCF44-NEXT: _symbol c 0x28050 0x400
+// BCF44-NEXT: _symbol c 0x28050 0x400 // DM_bankA
 // BCF44-NEXT: _extern c
 // BCF44-NEXT: _reserved DMb 0x28050 0x400
-// BCF44-NEXT: _symbol t 0x30000 0x20
+// BCF44-NEXT: _symbol t 0x30000 0x20 // DM_bankA
 // BCF44-NEXT: _extern t
 // BCF44-NEXT: _reserved DMb 0x30000 0x20
 // BCF44-NEXT: _reserved DMb 0x30000 0x8000
-// BCF44-NEXT: _symbol y 0x38000 0x20
+// BCF44-NEXT: _symbol y 0x38000 0x20 // DM_bankA
 // BCF44-NEXT: _extern y
 // BCF44-NEXT: _reserved DMb 0x38000 0x20
 // BCF44-NEXT: _reserved DMb 0x38000 0x8000
@@ -77,8 +77,9 @@
 // LD44-NEXT: {
 // LD44-NEXT:   . = 0x0;
 // LD44-NEXT:  .text : {
-// LD44-NEXT:     /* the _main_init symbol from me_basic.o has to come at address zero. */
-// LD44-NEXT:     *me_basic.o(.text)
+// LD44-NEXT:     /* the _main_init symbol of me_basic.o, or of me_basic_minimal.o, has to
+// LD44-NEXT:        come at address zero. */
+// LD44-NEXT:     *me_basic*.o(.text)
 // LD44-NEXT:     . = 0x200;
 // LD44-NEXT:     _ctors_start = .;
 // LD44-NEXT:     _init_array_start = .;
@@ -97,22 +98,22 @@
 // LD44-NEXT:   _sp_start_value_DM_stack = .;
 // LD44-NEXT:   . += 0x400;
 // LD44-NEXT: . = 0x20000
-// LD44-NEXT: z = .;
+// LD44-NEXT: z = .; /* DM_bankA */
 // LD44-NEXT: . += 0x20
 // LD44-NEXT: . = 0x28000
-// LD44-NEXT: a = .;
+// LD44-NEXT: a = .; /* DM_bankA */
 // LD44-NEXT: . += 0x10
 // LD44-NEXT: . = 0x28010
-// LD44-NEXT: b = .;
+// LD44-NEXT: b = .; /* DM_bankA */
 // LD44-NEXT: . += 0x40
 // LD44-NEXT: . = 0x28050
-// LD44-NEXT: c = .;
+// LD44-NEXT: c = .; /* DM_bankA */
 // LD44-NEXT: . += 0x400
 // LD44-NEXT: . = 0x30000
-// LD44-NEXT: t = .;
+// LD44-NEXT: t = .; /* DM_bankA */
 // LD44-NEXT: . += 0x20
 // LD44-NEXT: . = 0x38000
-// LD44-NEXT: y = .;
+// LD44-NEXT: y = .; /* DM_bankA */
 // LD44-NEXT: . += 0x20
 
 module @test_mmap0 {
@@ -10,16 +10,16 @@
 
 // RUN: aie-translate --aie-generate-mmap %s | FileCheck %s
 
-// CHECK-LABEL: Tile(4, 4)
-// CHECK-NOT: _symbol a
+// CHECK-LABEL: Tile(3, 4)
+// CHECK: _symbol a 0x28000 16
 // CHECK-LABEL: Tile(2, 4)
 // CHECK: _symbol a 0x38000 16
+// CHECK-LABEL: Tile(4, 4)
+// CHECK-NOT: _symbol a
 // CHECK-LABEL: Tile(3, 3)
 // CHECK: _symbol a 0x30000 16
 // CHECK-LABEL: Tile(3, 5)
 // CHECK: _symbol a 0x20000 16
-// CHECK-LABEL: Tile(3, 4)
-// CHECK: _symbol a 0x28000 16
 
 module @test_mmap1 {
  AIE.device(xcvc1902) {
@@ -10,14 +10,14 @@
 
 // RUN: aie-translate --aie-generate-mmap %s | FileCheck %s
 
-// CHECK-LABEL: Tile(3, 2)
-// CHECK: _symbol a 0x30000 16
 // CHECK-LABEL: Tile(3, 3)
 // CHECK: _symbol a 0x38000 16
 // CHECK-LABEL: Tile(2, 3)
 // CHECK-NOT: _symbol a
 // CHECK-LABEL: Tile(4, 3)
 // CHECK: _symbol a 0x28000 16
+// CHECK-LABEL: Tile(3, 2)
+// CHECK: _symbol a 0x30000 16
 // CHECK-LABEL: Tile(3, 4)
 // CHECK: _symbol a 0x20000 16
 
@@ -10,6 +10,7 @@
 
 // REQUIRES: stephenn
 // RUN: aie-opt --aie-herd-routing %s | FileCheck %s
+// RUN: aie-opt --aie-herd-routing="templates=true" %s | FileCheck %s
 
 // CHECK-LABEL: module @test_herd_routing1 {
 // CHECK:   %0 = AIE.herd[4] [1] {sym_name = "t"}
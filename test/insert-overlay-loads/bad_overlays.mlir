@@ -0,0 +1,55 @@
+//===- bad_overlays.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --split-input-file --aie-insert-overlay-loads --verify-diagnostics %s
+
+module {
+  AIE.device(xcvc1902) {
+    func.func private @conv(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func @layer(%act: memref<64xi32>) {
+      // expected-error@+1 {{'func.call' op calls a function of overlay 0 outside of the body of an AIE.core}}
+      func.call @conv(%act) : (memref<64xi32>) -> ()
+      return
+    }
+    %tile13 = AIE.tile(1, 3)
+    %act = AIE.buffer(%tile13) {sym_name = "act"} : memref<64xi32>
+    AIE.core(%tile13) {
+      func.call @layer(%act) : (memref<64xi32>) -> ()
+      AIE.end
+    }
+  }
+}
+
+// -----
+
+module {
+  AIE.device(xcvc1902) {
+    func.func private @conv(memref<64xi32>) attributes {aie.overlay = -1 : i32}
+    %tile13 = AIE.tile(1, 3)
+    %act = AIE.buffer(%tile13) {sym_name = "act"} : memref<64xi32>
+    AIE.core(%tile13) {
+      // expected-error@+1 {{'func.call' op calls a function of negative overlay -1}}
+      func.call @conv(%act) : (memref<64xi32>) -> ()
+      AIE.end
+    }
+  }
+}
+
+// -----
+
+module {
+  AIE.device(xcvc1902) {
+    %tile13 = AIE.tile(1, 3)
+    // expected-error@+1 {{'AIE.core' op overlay_size must be a positive multiple of 16 smaller than the 16384 bytes of program memory}}
+    AIE.core(%tile13) {
+      AIE.end
+    } {overlay_size = 100 : i32}
+  }
+}
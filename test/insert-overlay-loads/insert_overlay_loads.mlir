@@ -0,0 +1,124 @@
+//===- insert_overlay_loads.mlir -------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --split-input-file --aie-insert-overlay-loads %s | FileCheck %s
+
+// The first loop only calls overlay 0, so it is requested once before it,
+// if it is not in the window yet.  Overlay 1 then replaces it.  The last
+// loop calls both overlays, so each iteration requests overlay 0 when it is
+// missing and then overlay 1.
+
+// CHECK-LABEL: AIE.device(xcvc1902)
+// CHECK:   %[[TILE:.*]] = AIE.tile(1, 3)
+// CHECK:   %[[OVERLAY:.*]] = AIE.buffer(%[[TILE]]) {sym_name = "core_1_3_overlay"} : memref<1xi32>
+// CHECK:   %[[REQUEST:.*]] = AIE.lock(%[[TILE]]) {sym_name = "core_1_3_overlay_request"}
+// CHECK:   %[[LOADED:.*]] = AIE.lock(%[[TILE]]) {sym_name = "core_1_3_overlay_loaded"}
+// CHECK:   AIE.core(%[[TILE]]) {
+// CHECK:     %[[NONE:.*]] = arith.constant -1 : i32
+// CHECK:     memref.store %[[NONE]], %[[OVERLAY]]
+// CHECK:     %[[ID0:.*]] = arith.constant 0 : i32
+// CHECK:     %[[CURRENT:.*]] = memref.load %[[OVERLAY]]
+// CHECK:     %[[MISSING:.*]] = arith.cmpi ne, %[[CURRENT]], %[[ID0]] : i32
+// CHECK:     scf.if %[[MISSING]] {
+// CHECK:       memref.store %[[ID0]], %[[OVERLAY]]
+// CHECK:       AIE.useLock(%[[REQUEST]], Release, 1)
+// CHECK:       AIE.useLock(%[[LOADED]], Acquire, 1)
+// CHECK:       AIE.useLock(%[[LOADED]], Release, 0)
+// CHECK:     }
+// CHECK:     scf.for
+// CHECK-NOT:   AIE.useLock
+// CHECK:       func.call @conv
+// CHECK-NEXT:  func.call @relu
+// CHECK:     }
+// CHECK:     func.call @sum
+// CHECK:     %[[ID1:.*]] = arith.constant 1 : i32
+// CHECK-NOT: scf.if
+// CHECK:     memref.store %[[ID1]], %[[OVERLAY]]
+// CHECK:     AIE.useLock(%[[REQUEST]], Release, 1)
+// CHECK:     AIE.useLock(%[[LOADED]], Acquire, 1)
+// CHECK:     AIE.useLock(%[[LOADED]], Release, 0)
+// CHECK:     func.call @pool
+// CHECK:     scf.for
+// CHECK:       scf.if
+// CHECK:         AIE.useLock(%[[REQUEST]], Release, 1)
+// CHECK:       }
+// CHECK:       func.call @conv
+// CHECK-NOT:   scf.if
+// CHECK:       AIE.useLock(%[[REQUEST]], Release, 1)
+// CHECK:       AIE.useLock(%[[LOADED]], Acquire, 1)
+// CHECK:       AIE.useLock(%[[LOADED]], Release, 0)
+// CHECK:       func.call @pool
+// CHECK:     }
+// CHECK:     AIE.end
+
+module {
+  AIE.device(xcvc1902) {
+    func.func private @conv(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func private @relu(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func private @pool(memref<64xi32>) attributes {aie.overlay = 1 : i32}
+    func.func private @sum(memref<64xi32>)
+    %tile13 = AIE.tile(1, 3)
+    %act = AIE.buffer(%tile13) {sym_name = "act"} : memref<64xi32>
+    AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c8 = arith.constant 8 : index
+      scf.for %i = %c0 to %c8 step %c1 {
+        func.call @conv(%act) : (memref<64xi32>) -> ()
+        func.call @relu(%act) : (memref<64xi32>) -> ()
+      }
+      func.call @sum(%act) : (memref<64xi32>) -> ()
+      func.call @pool(%act) : (memref<64xi32>) -> ()
+      scf.for %i = %c0 to %c8 step %c1 {
+        func.call @conv(%act) : (memref<64xi32>) -> ()
+        func.call @pool(%act) : (memref<64xi32>) -> ()
+      }
+      AIE.end
+    } {overlay_size = 8192 : i32}
+  }
+}
+
+// -----
+
+// An AIE-ML core waits for the host to increment the loaded semaphore, and
+// cores without overlays are left as they are.
+
+// CHECK-LABEL: AIE.device(xcve2302)
+// CHECK:   AIE.buffer(%{{.*}}) {sym_name = "core_2_3_overlay"} : memref<1xi32>
+// CHECK:   %[[REQUEST:.*]] = AIE.lock(%{{.*}}) {sym_name = "core_2_3_overlay_request"}
+// CHECK:   %[[LOADED:.*]] = AIE.lock(%{{.*}}) {sym_name = "core_2_3_overlay_loaded"}
+// CHECK:   AIE.core
+// CHECK:     scf.if
+// CHECK:       AIE.useLock(%[[REQUEST]], Release, 1)
+// CHECK:       AIE.useLock(%[[LOADED]], AcquireGreaterEqual, 1)
+// CHECK:     }
+// CHECK:     func.call @conv
+// CHECK-NOT: core_2_4_overlay
+// CHECK:   AIE.core
+// CHECK-NOT: AIE.useLock
+// CHECK:     func.call @sum
+
+module {
+  AIE.device(xcve2302) {
+    func.func private @conv(memref<64xi32>) attributes {aie.overlay = 0 : i32}
+    func.func private @sum(memref<64xi32>)
+    %tile23 = AIE.tile(2, 3)
+    %tile24 = AIE.tile(2, 4)
+    %act = AIE.buffer(%tile23) {sym_name = "act"} : memref<64xi32>
+    AIE.core(%tile23) {
+      func.call @conv(%act) : (memref<64xi32>) -> ()
+      AIE.end
+    }
+    AIE.core(%tile24) {
+      func.call @sum(%act) : (memref<64xi32>) -> ()
+      AIE.end
+    }
+  }
+}
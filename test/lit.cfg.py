@@ -144,9 +144,14 @@ if(config.enable_chess_tests):
 
 tool_dirs = [config.aie_tools_dir, config.peano_tools_dir, config.llvm_tools_dir]
 tools = [
+    'aie-bench.py',
+    'aie-compile-bench.py',
     'aie-opt',
+    'aie-trace-decode.py',
     'aie-translate',
     'aiecc.py',
+    'aievec-batch-sim.py',
+    'aievec-tune.py',
     'ld.lld',
     'llc',
     'llvm-objdump',
@@ -0,0 +1,29 @@
+//===- bad_strided.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: not aie-opt --aie-lower-memcpy %s 2>&1 | FileCheck %s
+// CHECK: error: 'AIEX.memcpy' op step sizes and wraps are only supported on AIE-ML devices
+
+module @bad_strided {
+ AIE.device(xcvc1902) {
+  %t11 = AIE.tile(1, 1)
+  %t22 = AIE.tile(2, 2)
+  %buf0 = AIE.buffer(%t11) : memref<256xi32>
+  %buf1 = AIE.buffer(%t22) : memref<256xi32>
+  %m11 = AIE.mem(%t11) {
+    AIE.end
+  }
+  %m22 = AIE.mem(%t22) {
+    AIE.end
+  }
+  AIEX.token(0) { sym_name="token0" }
+  AIEX.memcpy @token0(1, 2) (%t11 : <%buf0, 0, 256, [<16, 16>, <1, 16>]>, %t22 : <%buf1, 0, 256>) : (memref<256xi32>, memref<256xi32>)
+ }
+}
@@ -0,0 +1,64 @@
+//===- chain_bds.mlir ------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-memcpy %s | FileCheck %s
+
+// A BD of a core tile DMA moves at most 8191 words, so the 8192 words of
+// the memcpy take a chain of two BDs on each side, which acquire the token
+// before the first one and release it after the last one.
+
+// CHECK-LABEL: module @chain_bds {
+// CHECK:         %[[T11:.*]] = AIE.tile(1, 1)
+// CHECK:         %[[T22:.*]] = AIE.tile(2, 2)
+// CHECK:         %[[BUF0:.*]] = AIE.buffer(%[[T11]]) : memref<8192xi32>
+// CHECK:         %[[BUF1:.*]] = AIE.buffer(%[[T22]]) : memref<8192xi32>
+// CHECK:         AIE.mem(%[[T11]]) {
+// CHECK-NEXT:      AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK-NEXT:    ^bb1:
+// CHECK-NEXT:      AIEX.useToken @token0(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%[[BUF0]] : memref<8192xi32>, 0, 8191>, 0)
+// CHECK-NEXT:      AIE.nextBd ^bb2
+// CHECK-NEXT:    ^bb2:
+// CHECK-NEXT:      AIE.dmaBd(<%[[BUF0]] : memref<8192xi32>, 8191, 1>, 0)
+// CHECK-NEXT:      AIEX.useToken @token0(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb3
+// CHECK-NEXT:    ^bb3:
+// CHECK-NEXT:      AIE.end
+// CHECK:         AIE.mem(%[[T22]]) {
+// CHECK-NEXT:      AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK-NEXT:    ^bb1:
+// CHECK-NEXT:      AIEX.useToken @token0(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%[[BUF1]] : memref<8192xi32>, 0, 8191>, 0)
+// CHECK-NEXT:      AIE.nextBd ^bb2
+// CHECK-NEXT:    ^bb2:
+// CHECK-NEXT:      AIE.dmaBd(<%[[BUF1]] : memref<8192xi32>, 8191, 1>, 0)
+// CHECK-NEXT:      AIEX.useToken @token0(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb3
+// CHECK-NEXT:    ^bb3:
+// CHECK-NEXT:      AIE.end
+// CHECK:         AIE.flow(%[[T11]], DMA : 0, %[[T22]], DMA : 0)
+// CHECK-NOT:     AIEX.memcpy
+
+module @chain_bds {
+ AIE.device(xcvc1902) {
+  %t11 = AIE.tile(1, 1)
+  %t22 = AIE.tile(2, 2)
+  %buf0 = AIE.buffer(%t11) : memref<8192xi32>
+  %buf1 = AIE.buffer(%t22) : memref<8192xi32>
+  %m11 = AIE.mem(%t11) {
+    AIE.end
+  }
+  %m22 = AIE.mem(%t22) {
+    AIE.end
+  }
+  AIEX.token(0) { sym_name="token0" }
+  AIEX.memcpy @token0(1, 2) (%t11 : <%buf0, 0, 8192>, %t22 : <%buf1, 0, 8192>) : (memref<8192xi32>, memref<8192xi32>)
+ }
+}
@@ -0,0 +1,95 @@
+//===- packet_merge.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-memcpy %s | FileCheck %s
+
+// The two memcpys from (1, 1) to (2, 2) share a DMA channel on each side and
+// a route, as packets of IDs 1 and 2 since 0 is taken, while the one to
+// (3, 3) gets the second MM2S channel of (1, 1), chained after the first.
+
+// CHECK-LABEL: module @packet_merge {
+// CHECK:         AIE.mem(%{{.*}}) {
+// CHECK-NEXT:      AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK-NEXT:    ^bb1:
+// CHECK-NEXT:      AIEX.useToken @token0(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBdPacket(0, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 128>, 0)
+// CHECK-NEXT:      AIEX.useToken @token0(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb2
+// CHECK-NEXT:    ^bb2:
+// CHECK-NEXT:      AIEX.useToken @token1(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBdPacket(0, 2)
+// CHECK-NEXT:      AIE.dmaBd(<%{{.*}} : memref<256xi32>, 128, 128>, 0)
+// CHECK-NEXT:      AIEX.useToken @token1(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb5
+// CHECK-NEXT:    ^bb3:
+// CHECK-NEXT:      AIE.dmaStart(MM2S, 1, ^bb4, ^bb5)
+// CHECK-NEXT:    ^bb4:
+// CHECK-NEXT:      AIEX.useToken @token2(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0)
+// CHECK-NEXT:      AIEX.useToken @token2(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb5
+// CHECK-NEXT:    ^bb5:
+// CHECK-NEXT:      AIE.end
+// CHECK:         AIE.mem(%{{.*}}) {
+// CHECK-NEXT:      AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK-NEXT:    ^bb1:
+// CHECK-NEXT:      AIEX.useToken @token0(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 128>, 0)
+// CHECK-NEXT:      AIEX.useToken @token0(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb2
+// CHECK-NEXT:    ^bb2:
+// CHECK-NEXT:      AIEX.useToken @token1(Acquire, 1)
+// CHECK-NEXT:      AIE.dmaBd(<%{{.*}} : memref<256xi32>, 128, 128>, 0)
+// CHECK-NEXT:      AIEX.useToken @token1(Release, 2)
+// CHECK-NEXT:      AIE.nextBd ^bb3
+// CHECK-NEXT:    ^bb3:
+// CHECK-NEXT:      AIE.end
+// CHECK:         AIE.packet_flow(1) {
+// CHECK-NEXT:      AIE.packet_source<%[[T11:.*]], DMA : 0>
+// CHECK-NEXT:      AIE.packet_dest<%[[T22:.*]], DMA : 0>
+// CHECK-NEXT:    }
+// CHECK-NEXT:    AIE.packet_flow(2) {
+// CHECK-NEXT:      AIE.packet_source<%[[T11]], DMA : 0>
+// CHECK-NEXT:      AIE.packet_dest<%[[T22]], DMA : 0>
+// CHECK-NEXT:    }
+// CHECK-NEXT:    AIE.flow(%[[T11]], DMA : 1, %{{.*}}, DMA : 0)
+// CHECK-NOT:     AIEX.memcpy
+
+module @packet_merge {
+ AIE.device(xcvc1902) {
+  %t11 = AIE.tile(1, 1)
+  %t22 = AIE.tile(2, 2)
+  %t33 = AIE.tile(3, 3)
+  %t44 = AIE.tile(4, 4)
+  %buf0 = AIE.buffer(%t11) : memref<256xi32>
+  %buf1 = AIE.buffer(%t22) : memref<256xi32>
+  %buf2 = AIE.buffer(%t33) : memref<256xi32>
+  %m11 = AIE.mem(%t11) {
+    AIE.end
+  }
+  %m22 = AIE.mem(%t22) {
+    AIE.end
+  }
+  %m33 = AIE.mem(%t33) {
+    AIE.end
+  }
+  AIE.packet_flow(0) {
+    AIE.packet_source<%t44, Core : 0>
+    AIE.packet_dest<%t33, Core : 0>
+  }
+  AIEX.token(0) { sym_name="token0" }
+  AIEX.token(0) { sym_name="token1" }
+  AIEX.token(0) { sym_name="token2" }
+  AIEX.memcpy @token0(1, 2) (%t11 : <%buf0, 0, 128>, %t22 : <%buf1, 0, 128>) : (memref<256xi32>, memref<256xi32>)
+  AIEX.memcpy @token1(1, 2) (%t11 : <%buf0, 128, 128>, %t22 : <%buf1, 128, 128>) : (memref<256xi32>, memref<256xi32>)
+  AIEX.memcpy @token2(1, 2) (%t11 : <%buf0, 0, 256>, %t33 : <%buf2, 0, 256>) : (memref<256xi32>, memref<256xi32>)
+ }
+}
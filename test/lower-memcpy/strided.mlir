@@ -0,0 +1,38 @@
+//===- strided.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-memcpy %s | FileCheck %s
+
+// The destination of the memcpy transposes the 16x16 block it receives,
+// with the step sizes and wraps of its BD.
+
+// CHECK-LABEL: module @strided {
+// CHECK:         AIE.dmaStart(MM2S, 0, ^bb1, ^bb2)
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0)
+// CHECK:         AIE.dmaStart(S2MM, 0, ^bb1, ^bb2)
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0, [<1, 16>, <16, 16>])
+// CHECK:         AIE.flow(%{{.*}}, DMA : 0, %{{.*}}, DMA : 0)
+
+module @strided {
+ AIE.device(xcve2802) {
+  %t23 = AIE.tile(2, 3)
+  %t24 = AIE.tile(2, 4)
+  %buf0 = AIE.buffer(%t23) : memref<256xi32>
+  %buf1 = AIE.buffer(%t24) : memref<256xi32>
+  %m23 = AIE.mem(%t23) {
+    AIE.end
+  }
+  %m24 = AIE.mem(%t24) {
+    AIE.end
+  }
+  AIEX.token(0) { sym_name="token0" }
+  AIEX.memcpy @token0(1, 2) (%t23 : <%buf0, 0, 256>, %t24 : <%buf1, 0, 256, [<1, 16>, <16, 16>]>) : (memref<256xi32>, memref<256xi32>)
+ }
+}
@@ -0,0 +1,55 @@
+//===- simple.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-rtps %s | FileCheck %s
+
+// The block of @params gets two copies and its version and acknowledge
+// words on its tile.  Each get in the loop of the core acknowledges the
+// latest version and reads the copy its lowest bit selects.
+
+// CHECK-LABEL: module @rtps {
+// CHECK:   %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK:   %[[COPY0:.*]] = AIE.buffer(%[[T13]]) {sym_name = "params_0"} : memref<4xi32>
+// CHECK:   %[[COPY1:.*]] = AIE.buffer(%[[T13]]) {sym_name = "params_1"} : memref<4xi32>
+// CHECK:   %[[VERSION:.*]] = AIE.buffer(%[[T13]]) {sym_name = "params_version"} : memref<1xi32>
+// CHECK:   %[[ACK:.*]] = AIE.buffer(%[[T13]]) {sym_name = "params_ack"} : memref<1xi32>
+// CHECK:   AIE.rtp @params(%[[T13]]) : memref<4xi32>
+// CHECK:   AIE.core(%[[T14:.*]]) {
+// CHECK:     scf.for
+// CHECK:       %[[C0:.*]] = arith.constant 0 : index
+// CHECK:       %[[V:.*]] = memref.load %[[VERSION]][%[[C0]]] : memref<1xi32>
+// CHECK:       memref.store %[[V]], %[[ACK]][%[[C0]]] : memref<1xi32>
+// CHECK:       %[[ODD:.*]] = arith.trunci %[[V]] : i32 to i1
+// CHECK:       %[[BLOCK:.*]] = arith.select %[[ODD]], %[[COPY1]], %[[COPY0]] : memref<4xi32>
+// CHECK:       memref.load %[[BLOCK]]
+// CHECK-NOT: AIE.rtp.get
+
+module @rtps {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  %out = AIE.buffer(%t13) {sym_name = "out"} : memref<16xi32>
+  AIE.rtp @params (%t13) : memref<4xi32>
+
+  %core14 = AIE.core(%t14) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c16 = arith.constant 16 : index
+    scf.for %i = %c0 to %c16 step %c1 {
+      %params = AIE.rtp.get @params : memref<4xi32>
+      %scale = memref.load %params[%c0] : memref<4xi32>
+      %v = arith.index_cast %i : index to i32
+      %r = arith.muli %v, %scale : i32
+      memref.store %r, %out[%i] : memref<16xi32>
+    }
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,26 @@
+//===- two_readers.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-rtps --verify-diagnostics %s
+
+AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  AIE.rtp @params (%t13) : memref<4xi32>
+  %core13 = AIE.core(%t13) {
+    %p = AIE.rtp.get @params : memref<4xi32>
+    AIE.end
+  }
+  %core14 = AIE.core(%t14) {
+    // expected-error@+1 {{'AIE.rtp.get' op gets rtp block params from a second core, it can only be read by one}}
+    %p = AIE.rtp.get @params : memref<4xi32>
+    AIE.end
+  }
+}
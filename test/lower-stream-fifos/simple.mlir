@@ -0,0 +1,68 @@
+//===- simple.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-lower-stream-fifos %s | FileCheck %s
+
+// Each streamFifo becomes a flow between free Core ports: port 0 of the
+// producer %t13 is taken by the existing flow, so @sf0 puts values on port 1.
+// The broadcast @sf1 gets its values on port 0 of both consumers, and the
+// puts and gets nested in loops use the same ports.
+
+// CHECK-LABEL: module @stream_fifos {
+// CHECK:   %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK:   %[[T14:.*]] = AIE.tile(1, 4)
+// CHECK:   %[[T15:.*]] = AIE.tile(1, 5)
+// CHECK:   AIE.flow(%[[T13]], Core : 0, %[[T15]], Core : 1)
+// CHECK-NOT: AIE.streamFifo
+// CHECK:   AIE.flow(%[[T13]], Core : 1, %[[T14]], Core : 0)
+// CHECK:   AIE.flow(%[[T14]], Core : 0, %[[T15]], Core : 0)
+// CHECK:   AIE.flow(%[[T14]], Core : 0, %[[T13]], Core : 0)
+// CHECK:   AIE.core(%[[T13]]) {
+// CHECK:     %[[C1:.*]] = arith.constant 1 : i32
+// CHECK:     AIE.putStream(%[[C1]] : i32, %{{.*}} : i32)
+// CHECK:     %[[C0:.*]] = arith.constant 0 : i32
+// CHECK:     %{{.*}} = AIE.getStream(%[[C0]] : i32) : f32
+// CHECK:   AIE.core(%[[T14]]) {
+// CHECK:     scf.for
+// CHECK:       %[[C0:.*]] = arith.constant 0 : i32
+// CHECK:       %[[V:.*]] = AIE.getStream(%[[C0]] : i32) : i32
+// CHECK:       %[[F:.*]] = arith.sitofp %[[V]] : i32 to f32
+// CHECK:       %[[C0:.*]] = arith.constant 0 : i32
+// CHECK:       AIE.putStream(%[[C0]] : i32, %[[F]] : f32)
+
+module @stream_fifos {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  %t15 = AIE.tile(1, 5)
+  AIE.flow(%t13, Core : 0, %t15, Core : 1)
+  AIE.streamFifo @sf0 (%t13, {%t14}) : i32
+  AIE.streamFifo @sf1 (%t14, {%t15, %t13}) : f32
+
+  %core13 = AIE.core(%t13) {
+    %v = arith.constant 7 : i32
+    AIE.streamFifo.put @sf0 (%v : i32)
+    %r = AIE.streamFifo.get @sf1 : f32
+    AIE.end
+  }
+
+  %core14 = AIE.core(%t14) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c8 = arith.constant 8 : index
+    scf.for %i = %c0 to %c8 step %c1 {
+      %v = AIE.streamFifo.get @sf0 : i32
+      %f = arith.sitofp %v : i32 to f32
+      AIE.streamFifo.put @sf1 (%f : f32)
+    }
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,56 @@
+//===- buffer_address.mlir -------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-standard-lowering %s | FileCheck %s
+// RUN: aie-opt --aie-standard-lowering="constant-addresses=false" %s | FileCheck %s --check-prefix=SYMBOL
+
+// The buffer a of tile (3, 3) is in the memory east of its core, at 0x38000,
+// and in the memory west of the core of tile (4, 3), at 0x28000.
+
+// CHECK-DAG:    memref.global "public" @a : memref<4xi32> {alignment = 4096 : i64}
+// CHECK-DAG:    memref.global "public" @b : memref<4xi32>
+// CHECK-LABEL:  func.func @core_4_3() {
+// CHECK:          %[[ADDR:.*]] = llvm.mlir.constant(167936 : i32) : i32
+// CHECK:          llvm.inttoptr %[[ADDR]] : i32 to
+// CHECK:          %[[A:.*]] = builtin.unrealized_conversion_cast %{{.*}} : !llvm.struct<{{.*}}> to memref<4xi32>
+// CHECK:          memref.assume_alignment %[[A]], 4096 : memref<4xi32>
+// CHECK:          memref.load %[[A]]
+// CHECK:          %[[B:.*]] = memref.get_global @b : memref<4xi32>
+// CHECK:          memref.assume_alignment %[[B]], 32 : memref<4xi32>
+// CHECK:          memref.store %{{.*}}, %[[B]]
+// CHECK-LABEL:  func.func @core_3_3() {
+// CHECK:          %[[ADDR:.*]] = llvm.mlir.constant(233472 : i32) : i32
+// CHECK:          llvm.inttoptr %[[ADDR]] : i32 to
+// CHECK:          memref.assume_alignment %{{.*}}, 4096 : memref<4xi32>
+
+// SYMBOL-NOT:   llvm.mlir.constant
+// SYMBOL:       memref.get_global @a : memref<4xi32>
+// SYMBOL:       memref.assume_alignment %{{.*}}, 4096 : memref<4xi32>
+
+module @buffer_address {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %t43 = AIE.tile(4, 3)
+  %a = AIE.buffer(%t33) { sym_name = "a", address = 4096 : i32 } : memref<4xi32>
+  %b = AIE.buffer(%t43) { sym_name = "b" } : memref<4xi32>
+  %core33 = AIE.core(%t33) {
+    %0 = arith.constant 0 : index
+    %377 = arith.constant 377 : i32
+    memref.store %377, %a[%0] : memref<4xi32>
+    AIE.end
+  }
+  %core43 = AIE.core(%t43) {
+    %0 = arith.constant 0 : index
+    %1 = memref.load %a[%0] : memref<4xi32>
+    memref.store %1, %b[%0] : memref<4xi32>
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,34 @@
+//===- lower_timestamp.mlir ------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-standard-lowering %s | FileCheck %s
+
+// CHECK-LABEL: func.func @core_3_3() {
+// CHECK:         %[[TRACE:.*]] = memref.get_global @trace : memref<16xi32>
+// CHECK:         scf.for %[[I:.*]] =
+// CHECK-NEXT:      %[[CYCLES:.*]] = func.call @llvm.aie.get.cycles() : () -> i64
+// CHECK-NEXT:      %[[TIME:.*]] = arith.trunci %[[CYCLES]] : i64 to i32
+// CHECK-NEXT:      memref.store %[[TIME]], %[[TRACE]][%[[I]]] : memref<16xi32>
+
+module @timestamp {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %trace = AIE.buffer(%t33) { sym_name = "trace" } : memref<16xi32>
+  %core33 = AIE.core(%t33) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c16 = arith.constant 16 : index
+    scf.for %i = %c0 to %c16 step %c1 {
+      AIE.timestamp(%trace[%i]) : memref<16xi32>
+    }
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,53 @@
+//===- output_dir.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: rm -rf %t
+// RUN: aie-opt --aie-standard-lowering="output-dir=%t core-pipeline=canonicalize" %s | FileCheck --check-prefix=INPUT %s
+// RUN: FileCheck --check-prefix=CORE33 %s < %t/core_3_3.mlir
+// RUN: FileCheck --check-prefix=CORE43 %s < %t/core_4_3.mlir
+// RUN: rm -rf %t && aie-opt --aie-standard-lowering="tilecol=4 tilerow=3 output-dir=%t" %s -o /dev/null
+// RUN: test -f %t/core_4_3.mlir && test ! -f %t/core_3_3.mlir
+// RUN: rm -rf %t && aie-opt --aie-standard-lowering="output-dir=%t emit-bytecode" %s -o /dev/null
+// RUN: not FileCheck --check-prefix=CORE33 %s < %t/core_3_3.mlir
+// RUN: aie-opt %t/core_3_3.mlir | FileCheck --check-prefix=CORE33 %s
+
+// INPUT: AIE.device
+// INPUT: AIE.core
+// INPUT: AIE.core
+
+// CORE33: memref.global "public" @a : memref<4xi32>
+// CORE33-LABEL: func.func @core_3_3() {
+// CORE33: memref.store
+// CORE33-NOT: func.func @core_4_3
+
+// The load of core (4, 3) is dead, and removed by the core pipeline.
+// CORE43-NOT: func.func @core_3_3
+// CORE43-LABEL: func.func @core_4_3() {
+// CORE43-NOT: memref.load
+// CORE43: return
+
+module @codegen1 {
+ AIE.device(xcvc1902) {
+  %t33 = AIE.tile(3, 3)
+  %a = AIE.buffer(%t33) { sym_name = "a" } : memref<4xi32>
+  %core33 = AIE.core(%t33) {
+    %0 = arith.constant 0 : index
+    %377 = arith.constant 377 : i32
+    memref.store %377, %a[%0] : memref<4xi32>
+    AIE.end
+  }
+  %t34 = AIE.tile(4, 3)
+  %core34 = AIE.core(%t34) {
+    %0 = arith.constant 0 : index
+    %1 = memref.load %a[%0] : memref<4xi32>
+    AIE.end
+  }
+ }
+}
@@ -0,0 +1,64 @@
+//===- share_cores.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-standard-lowering="share-cores" %s | FileCheck %s
+// RUN: aie-opt --aie-standard-lowering %s | FileCheck --check-prefix=NOSHARE %s
+
+// The cores (1, 3) and (1, 4) only differ by their buffers and share their
+// code, the core (1, 5) stores another value and keeps its own.
+
+// CHECK-LABEL: func.func @core_1_5() {
+// CHECK-NOT:     call @core_shared
+// CHECK:         memref.get_global @c : memref<256xi32>
+// CHECK:         return
+// CHECK-LABEL: func.func @core_1_4() {
+// CHECK-NEXT:    %[[B:.*]] = memref.get_global @b : memref<256xi32>
+// CHECK-NEXT:    call @core_shared_0(%[[B]]) : (memref<256xi32>) -> ()
+// CHECK-NEXT:    return
+// CHECK-LABEL: func.func @core_shared_0(%arg0: memref<256xi32>) {
+// CHECK-NOT:     memref.get_global
+// CHECK:         memref.assume_alignment %arg0, 32 : memref<256xi32>
+// CHECK:         memref.store %{{.*}}, %arg0[%{{.*}}] : memref<256xi32>
+// CHECK:         return
+// CHECK-LABEL: func.func @core_1_3() {
+// CHECK-NEXT:    %[[A:.*]] = memref.get_global @a : memref<256xi32>
+// CHECK-NEXT:    call @core_shared_0(%[[A]]) : (memref<256xi32>) -> ()
+// CHECK-NEXT:    return
+
+// NOSHARE-NOT: core_shared
+
+module @share_cores {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %t14 = AIE.tile(1, 4)
+  %t15 = AIE.tile(1, 5)
+  %a = AIE.buffer(%t13) { sym_name = "a" } : memref<256xi32>
+  %b = AIE.buffer(%t14) { sym_name = "b" } : memref<256xi32>
+  %c = AIE.buffer(%t15) { sym_name = "c" } : memref<256xi32>
+  AIE.core(%t13) {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %a[%1] : memref<256xi32>
+    AIE.end
+  }
+  AIE.core(%t14) {
+    %0 = arith.constant 0 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %b[%1] : memref<256xi32>
+    AIE.end
+  }
+  AIE.core(%t15) {
+    %0 = arith.constant 1 : i32
+    %1 = arith.constant 0 : index
+    memref.store %0, %c[%1] : memref<256xi32>
+    AIE.end
+  }
+ }
+}
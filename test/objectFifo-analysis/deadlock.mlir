@@ -0,0 +1,69 @@
+//===- deadlock.mlir -------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-analysis="report-throughput=false" --verify-diagnostics %s
+
+module @deadlock {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    %tile33 = AIE.tile(3, 3)
+
+    AIE.objectFifo @small (%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    // expected-warning @+1 {{deadlock: the first elements of these objectFifos wait on each other: @a -> @b -> @a}}
+    AIE.objectFifo @a (%tile12, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @b (%tile33, {%tile12}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @unbalanced (%tile13, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+
+    %core12 = AIE.core(%tile12) {
+      // expected-warning @+1 {{deadlock: acquires 3 elements of objectFifo @small, which only has 2}}
+      %small = AIE.objectFifo.acquire @small (Produce, 3) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @small (Produce, 3)
+
+      %b = AIE.objectFifo.acquire @b (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      %a = AIE.objectFifo.acquire @a (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @b (Consume, 1)
+      AIE.objectFifo.release @a (Produce, 1)
+      AIE.end
+    }
+
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c3 = arith.constant 3 : index
+      %c10 = arith.constant 10 : index
+      scf.for %i = %c0 to %c3 step %c1 {
+        %small = AIE.objectFifo.acquire @small (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        AIE.objectFifo.release @small (Consume, 1)
+      }
+      scf.for %i = %c0 to %c10 step %c1 {
+        %out = AIE.objectFifo.acquire @unbalanced (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        AIE.objectFifo.release @unbalanced (Produce, 1)
+      }
+      AIE.end
+    }
+
+    %core33 = AIE.core(%tile33) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c12 = arith.constant 12 : index
+      %a = AIE.objectFifo.acquire @a (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      %b = AIE.objectFifo.acquire @b (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @a (Consume, 1)
+      AIE.objectFifo.release @b (Produce, 1)
+      scf.for %i = %c0 to %c12 step %c1 {
+        // expected-warning @+1 {{deadlock: the consumer on tile (3, 3) releases 12 elements of objectFifo @unbalanced but the producer only releases 10}}
+        %in = AIE.objectFifo.acquire @unbalanced (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        AIE.objectFifo.release @unbalanced (Consume, 1)
+      }
+      AIE.end
+    }
+  }
+}
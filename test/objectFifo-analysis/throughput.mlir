@@ -0,0 +1,50 @@
+//===- throughput.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-analysis --verify-diagnostics %s
+
+module @throughput {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    %tile33 = AIE.tile(3, 3)
+
+    // expected-remark @+1 {{objectFifo @pingpong overlaps its producer and consumer, its throughput is bound by the slowest of them}}
+    AIE.objectFifo @pingpong (%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    // expected-remark @+1 {{objectFifo @single serializes its producer and consumer, its throughput is bound by their combined time per element; a depth of 2 would overlap them}}
+    AIE.objectFifo @single (%tile13, {%tile12}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+    // expected-remark @+1 {{objectFifo @split serializes the producer on tile (1, 2) and the consumer on tile (3, 3) with its DMA, its throughput is bound by their combined time per element; a depth of 2 would overlap them}}
+    AIE.objectFifo @split (%tile12, {%tile33}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+
+    %core12 = AIE.core(%tile12) {
+      %p = AIE.objectFifo.acquire @pingpong (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @pingpong (Produce, 1)
+      %s = AIE.objectFifo.acquire @single (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @single (Consume, 1)
+      %o = AIE.objectFifo.acquire @split (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @split (Produce, 1)
+      AIE.end
+    }
+
+    %core13 = AIE.core(%tile13) {
+      %p = AIE.objectFifo.acquire @pingpong (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @pingpong (Consume, 1)
+      %s = AIE.objectFifo.acquire @single (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @single (Produce, 1)
+      AIE.end
+    }
+
+    %core33 = AIE.core(%tile33) {
+      %i = AIE.objectFifo.acquire @split (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @split (Consume, 1)
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,69 @@
+//===- auto_depth.mlir -----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-auto-depth --verify-diagnostics %s | FileCheck %s
+
+// @pingpong is shared and both sides hold one element, so two elements let
+// them overlap.  Both sides of @triple hold two elements, which would need
+// four, and the depth stops at the default max-depth of 3.  @split uses DMAs,
+// which need a second element.  @large does not fit twice in its producer.
+
+// CHECK-LABEL: module @auto_depth {
+// CHECK:   AIE.objectFifo @pingpong(%{{.*}}, {%{{.*}}}, 2 : i32)
+// CHECK:   AIE.objectFifo @triple(%{{.*}}, {%{{.*}}}, 3 : i32)
+// CHECK:   AIE.objectFifo @split(%{{.*}}, {%{{.*}}}, 2 : i32)
+// CHECK:   AIE.objectFifo @large(%{{.*}}, {%{{.*}}}, 1 : i32)
+
+module @auto_depth {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    %tile32 = AIE.tile(3, 2)
+    %tile33 = AIE.tile(3, 3)
+
+    AIE.objectFifo @pingpong (%tile12, {%tile13}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @triple (%tile13, {%tile12}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @split (%tile12, {%tile33}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+    // expected-remark @+1 {{not enough memory left to deepen objectFifo @large from 1 to 2 elements}}
+    AIE.objectFifo @large (%tile32, {%tile33}, 1 : i32) : !AIE.objectFifo<memref<12000xi32>>
+
+    %core12 = AIE.core(%tile12) {
+      %p = AIE.objectFifo.acquire @pingpong (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @pingpong (Produce, 1)
+      %t = AIE.objectFifo.acquire @triple (Consume, 2) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @triple (Consume, 2)
+      %s = AIE.objectFifo.acquire @split (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @split (Produce, 1)
+      AIE.end
+    }
+
+    %core13 = AIE.core(%tile13) {
+      %p = AIE.objectFifo.acquire @pingpong (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @pingpong (Consume, 1)
+      %t = AIE.objectFifo.acquire @triple (Produce, 2) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @triple (Produce, 2)
+      AIE.end
+    }
+
+    %core32 = AIE.core(%tile32) {
+      %l = AIE.objectFifo.acquire @large (Produce, 1) : !AIE.objectFifoSubview<memref<12000xi32>>
+      AIE.objectFifo.release @large (Produce, 1)
+      AIE.end
+    }
+
+    %core33 = AIE.core(%tile33) {
+      %s = AIE.objectFifo.acquire @split (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+      AIE.objectFifo.release @split (Consume, 1)
+      %l = AIE.objectFifo.acquire @large (Consume, 1) : !AIE.objectFifoSubview<memref<12000xi32>>
+      AIE.objectFifo.release @large (Consume, 1)
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,122 @@
+//===- copy_elision.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-copy-elision -split-input-file %s | FileCheck %s
+// RUN: aie-opt --aie-objectFifo-copy-elision="assume-overwrite=true" -split-input-file %s | FileCheck %s --check-prefix=OVERWRITE
+
+// The kernel reads the acquired input element directly.  The output buffer
+// keeps what the kernel wrote across iterations, so its copy stays unless the
+// kernel is known to overwrite it.
+
+// CHECK-LABEL: module @buffers {
+// CHECK-NOT:     AIE.buffer(%{{.*}}) : memref<16xi32>
+// CHECK:         %[[OUT:.*]] = AIE.buffer(%{{.*}}) : memref<16xi32>
+// CHECK-NOT:     AIE.buffer
+// CHECK:         AIE.core(%{{.*}}) {
+// CHECK:           %[[SUBIN:.*]] = AIE.objectFifo.acquire @in(Consume, 1)
+// CHECK:           %[[IN:.*]] = AIE.objectFifo.subview.access %[[SUBIN]][0]
+// CHECK:           %[[SUBOUT:.*]] = AIE.objectFifo.acquire @out(Produce, 1)
+// CHECK:           %[[ELEM:.*]] = AIE.objectFifo.subview.access %[[SUBOUT]][0]
+// CHECK-NEXT:      func.call @kernel(%[[IN]], %[[OUT]])
+// CHECK-NEXT:      memref.copy %[[OUT]], %[[ELEM]]
+
+// OVERWRITE-LABEL: module @buffers {
+// OVERWRITE-NOT:     AIE.buffer
+// OVERWRITE:         %[[SUBIN:.*]] = AIE.objectFifo.acquire @in(Consume, 1)
+// OVERWRITE:         %[[IN:.*]] = AIE.objectFifo.subview.access %[[SUBIN]][0]
+// OVERWRITE:         %[[SUBOUT:.*]] = AIE.objectFifo.acquire @out(Produce, 1)
+// OVERWRITE:         %[[ELEM:.*]] = AIE.objectFifo.subview.access %[[SUBOUT]][0]
+// OVERWRITE-NEXT:    func.call @kernel(%[[IN]], %[[ELEM]])
+// OVERWRITE-NEXT:    AIE.objectFifo.release @in(Consume, 1)
+
+module @buffers {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    %tile33 = AIE.tile(3, 3)
+    AIE.objectFifo @in(%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @out(%tile13, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    %buf_in = AIE.buffer(%tile13) : memref<16xi32>
+    %buf_out = AIE.buffer(%tile13) : memref<16xi32>
+    func.func private @kernel(memref<16xi32>, memref<16xi32>)
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c8 = arith.constant 8 : index
+      scf.for %i = %c0 to %c8 step %c1 {
+        %sub_in = AIE.objectFifo.acquire @in(Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        %elem_in = AIE.objectFifo.subview.access %sub_in[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        %sub_out = AIE.objectFifo.acquire @out(Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        %elem_out = AIE.objectFifo.subview.access %sub_out[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        memref.copy %elem_in, %buf_in : memref<16xi32> to memref<16xi32>
+        func.call @kernel(%buf_in, %buf_out) : (memref<16xi32>, memref<16xi32>) -> ()
+        memref.copy %buf_out, %elem_out : memref<16xi32> to memref<16xi32>
+        AIE.objectFifo.release @in(Consume, 1)
+        AIE.objectFifo.release @out(Produce, 1)
+      }
+      AIE.end
+    }
+  }
+}
+
+// -----
+
+// The output buffer is allocated in the loop body, so its copy is removed.
+// The input element is shared by two consumers and the kernel may write to
+// its copy, and the named buffer can be read by the host: both copies stay.
+
+// CHECK-LABEL: module @allocs {
+// CHECK:         %[[IN:.*]] = AIE.buffer(%{{.*}}) {sym_name = "in_copy"} : memref<16xi32>
+// CHECK:         AIE.core(%{{.*}}) {
+// CHECK:           %[[SUBIN:.*]] = AIE.objectFifo.acquire @in2(Consume, 1)
+// CHECK:           %[[ELEMIN:.*]] = AIE.objectFifo.subview.access %[[SUBIN]][0]
+// CHECK:           %[[SUBOUT:.*]] = AIE.objectFifo.acquire @out2(Produce, 1)
+// CHECK:           %[[ELEM:.*]] = AIE.objectFifo.subview.access %[[SUBOUT]][0]
+// CHECK-NEXT:      %[[LOCAL:.*]] = memref.alloc() : memref<16xi32>
+// CHECK-NEXT:      memref.copy %[[ELEMIN]], %[[LOCAL]]
+// CHECK-NEXT:      memref.copy %[[ELEMIN]], %[[IN]]
+// CHECK-NEXT:      func.call @kernel2(%[[LOCAL]], %[[IN]], %[[ELEM]])
+// CHECK-NEXT:      memref.dealloc %[[LOCAL]]
+// CHECK-NEXT:      AIE.objectFifo.release @in2(Consume, 1)
+
+module @allocs {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    %tile23 = AIE.tile(2, 3)
+    %tile33 = AIE.tile(3, 3)
+    AIE.objectFifo @in2(%tile12, {%tile13, %tile23}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @out2(%tile13, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    %named = AIE.buffer(%tile13) {sym_name = "in_copy"} : memref<16xi32>
+    func.func private @kernel2(memref<16xi32>, memref<16xi32>, memref<16xi32>)
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c8 = arith.constant 8 : index
+      scf.for %i = %c0 to %c8 step %c1 {
+        %sub_in = AIE.objectFifo.acquire @in2(Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        %elem_in = AIE.objectFifo.subview.access %sub_in[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        %sub_out = AIE.objectFifo.acquire @out2(Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        %elem_out = AIE.objectFifo.subview.access %sub_out[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        %local_in = memref.alloc() : memref<16xi32>
+        memref.copy %elem_in, %local_in : memref<16xi32> to memref<16xi32>
+        memref.copy %elem_in, %named : memref<16xi32> to memref<16xi32>
+        %local_out = memref.alloc() : memref<16xi32>
+        func.call @kernel2(%local_in, %named, %local_out) : (memref<16xi32>, memref<16xi32>, memref<16xi32>) -> ()
+        memref.copy %local_out, %elem_out : memref<16xi32> to memref<16xi32>
+        memref.dealloc %local_in : memref<16xi32>
+        memref.dealloc %local_out : memref<16xi32>
+        AIE.objectFifo.release @in2(Consume, 1)
+        AIE.objectFifo.release @out2(Produce, 1)
+      }
+      AIE.end
+    }
+  }
+}
@@ -0,0 +1,127 @@
+//===- hoist_acquires.mlir -------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-hoist-acquires -split-input-file %s | FileCheck %s
+
+// The weights are only released after the loop nest, so their acquire is
+// hoisted out of both loops, while the inputs are acquired in each iteration.
+
+// CHECK-LABEL: module @weights {
+// CHECK:         AIE.core(%{{.*}}) {
+// CHECK:           %[[W:.*]] = AIE.objectFifo.acquire @weights(Consume, 1)
+// CHECK-NEXT:      scf.for
+// CHECK-NEXT:        scf.for
+// CHECK-NEXT:          %[[IN:.*]] = AIE.objectFifo.acquire @in(Consume, 1)
+// CHECK-NEXT:          AIE.objectFifo.subview.access %[[W]][0]
+// CHECK-NEXT:          AIE.objectFifo.subview.access %[[IN]][0]
+// CHECK-NEXT:          func.call @kernel
+// CHECK-NEXT:          AIE.objectFifo.release @in(Consume, 1)
+// CHECK:           AIE.objectFifo.release @weights(Consume, 1)
+
+module @weights {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    AIE.objectFifo @weights (%tile12, {%tile13}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @in (%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+    func.func @kernel(%w : memref<16xi32>, %in : memref<16xi32>) -> () {
+      return
+    }
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c4 = arith.constant 4 : index
+      scf.for %i = %c0 to %c4 step %c1 {
+        scf.for %j = %c0 to %c4 step %c1 {
+          %subW = AIE.objectFifo.acquire @weights (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+          %subIn = AIE.objectFifo.acquire @in (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+          %w = AIE.objectFifo.subview.access %subW[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+          %in = AIE.objectFifo.subview.access %subIn[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+          func.call @kernel(%w, %in) : (memref<16xi32>, memref<16xi32>) -> ()
+          AIE.objectFifo.release @in (Consume, 1)
+        }
+      }
+      AIE.objectFifo.release @weights (Consume, 1)
+      AIE.end
+    }
+  }
+}
+
+// -----
+
+// The sliding window keeps 2 of its 3 rows acquired across iterations, so the
+// first iteration is peeled as the prologue and the loop starts at 1.
+
+// CHECK-LABEL: module @sliding_window {
+// CHECK:         AIE.core(%{{.*}}) {
+// CHECK:           %[[C0:.*]] = arith.constant 0 : index
+// CHECK:           %[[SUB:.*]] = AIE.objectFifo.acquire @rows(Consume, 3)
+// CHECK:           func.call @kernel(%{{.*}}, %[[C0]])
+// CHECK-NEXT:      AIE.objectFifo.release @rows(Consume, 1)
+// CHECK-NEXT:      %[[C1:.*]] = arith.constant 1 : index
+// CHECK-NEXT:      scf.for %[[IV:.*]] = %[[C1]] to
+// CHECK-NEXT:        AIE.objectFifo.acquire @rows(Consume, 3)
+// CHECK:             func.call @kernel(%{{.*}}, %[[IV]])
+// CHECK-NEXT:        AIE.objectFifo.release @rows(Consume, 1)
+// CHECK-NEXT:      }
+// CHECK-NEXT:      AIE.objectFifo.release @rows(Consume, 2)
+
+module @sliding_window {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    AIE.objectFifo @rows (%tile12, {%tile13}, 4 : i32) : !AIE.objectFifo<memref<16xi32>>
+    func.func @kernel(%row : memref<16xi32>, %i : index) -> () {
+      return
+    }
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      %c8 = arith.constant 8 : index
+      scf.for %i = %c0 to %c8 step %c1 {
+        %sub = AIE.objectFifo.acquire @rows (Consume, 3) : !AIE.objectFifoSubview<memref<16xi32>>
+        %row = AIE.objectFifo.subview.access %sub[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        func.call @kernel(%row, %i) : (memref<16xi32>, index) -> ()
+        AIE.objectFifo.release @rows (Consume, 1)
+      }
+      AIE.objectFifo.release @rows (Consume, 2)
+      AIE.end
+    }
+  }
+}
+
+// -----
+
+// A loop which may not run keeps its acquires.
+
+// CHECK-LABEL: module @empty_loop {
+// CHECK:         scf.for
+// CHECK-NEXT:      AIE.objectFifo.acquire @weights(Consume, 1)
+
+module @empty_loop {
+  AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+    AIE.objectFifo @weights (%tile12, {%tile13}, 1 : i32) : !AIE.objectFifo<memref<16xi32>>
+    func.func @kernel(%w : memref<16xi32>) -> () {
+      return
+    }
+    %core13 = AIE.core(%tile13) {
+      %c0 = arith.constant 0 : index
+      %c1 = arith.constant 1 : index
+      scf.for %i = %c0 to %c0 step %c1 {
+        %subW = AIE.objectFifo.acquire @weights (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+        %w = AIE.objectFifo.subview.access %subW[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+        func.call @kernel(%w) : (memref<16xi32>) -> ()
+      }
+      AIE.end
+    }
+  }
+}
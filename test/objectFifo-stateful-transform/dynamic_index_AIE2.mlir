@@ -0,0 +1,79 @@
+//===- dynamic_index_AIE2.mlir ---------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform="dynamic-index-threshold=4" %s | FileCheck %s
+
+// The loop would be unrolled 12 times for objectFifos of sizes 3 and 4.
+// Instead, it is kept and the element of each objectFifo is selected from
+// the induction variable.
+
+// CHECK-LABEL: module @dynamicIndexAIE2 {
+// CHECK:         %[[OF0_0:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of0_buff_0"} : memref<16xi32>
+// CHECK:         %[[OF0_1:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of0_buff_1"} : memref<16xi32>
+// CHECK:         %[[OF0_2:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of0_buff_2"} : memref<16xi32>
+// CHECK:         %[[OF0_PROD:.*]] = AIE.lock(%{{.*}}, 0) {init = 3 : i32, sym_name = "of0_prod_lock"}
+// CHECK:         %[[OF0_CONS:.*]] = AIE.lock(%{{.*}}, 1) {init = 0 : i32, sym_name = "of0_cons_lock"}
+// CHECK:         %[[OF1_0:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of1_buff_0"} : memref<16xi32>
+// CHECK:         %[[OF1_1:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of1_buff_1"} : memref<16xi32>
+// CHECK:         %[[OF1_2:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of1_buff_2"} : memref<16xi32>
+// CHECK:         %[[OF1_3:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of1_buff_3"} : memref<16xi32>
+// CHECK:         AIE.core(%{{.*}}) {
+// CHECK:           scf.for %[[IV:.*]] = %[[LB:.*]] to %{{.*}} step %[[STEP:.*]] {
+// CHECK:             AIE.useLock(%[[OF0_PROD]], AcquireGreaterEqual, 1)
+// CHECK:             %[[SUB:.*]] = arith.subi %[[IV]], %[[LB]] : index
+// CHECK:             %[[ITER:.*]] = arith.divui %[[SUB]], %[[STEP]] : index
+// CHECK:             %[[MUL:.*]] = arith.muli %[[ITER]]
+// CHECK:             %[[ADD:.*]] = arith.addi %[[MUL]]
+// CHECK:             %[[IDX:.*]] = arith.remui %[[ADD]]
+// CHECK:             %[[IS1:.*]] = arith.cmpi eq, %[[IDX]]
+// CHECK:             %[[SEL1:.*]] = arith.select %[[IS1]], %[[OF0_1]], %[[OF0_0]] : memref<16xi32>
+// CHECK:             %[[IS2:.*]] = arith.cmpi eq, %[[IDX]]
+// CHECK:             %[[SEL2:.*]] = arith.select %[[IS2]], %[[OF0_2]], %[[SEL1]] : memref<16xi32>
+// CHECK:             memref.store %{{.*}}, %[[SEL2]][%{{.*}}] : memref<16xi32>
+// CHECK:             AIE.useLock(%[[OF0_CONS]], Release, 1)
+// CHECK:             arith.select %{{.*}}, %[[OF1_1]], %[[OF1_0]] : memref<16xi32>
+// CHECK:             arith.select %{{.*}}, %[[OF1_2]], %{{.*}} : memref<16xi32>
+// CHECK:             %[[SEL3:.*]] = arith.select %{{.*}}, %[[OF1_3]], %{{.*}} : memref<16xi32>
+// CHECK:             memref.store %{{.*}}, %[[SEL3]][%{{.*}}] : memref<16xi32>
+// CHECK:           }
+// CHECK-NOT:       arith.select
+// CHECK:           AIE.end
+// CHECK:         }
+
+module @dynamicIndexAIE2 {
+ AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+
+    AIE.objectFifo @of0 (%tile12, {%tile13}, 3 : i32) : !AIE.objectFifo<memref<16xi32>>
+    AIE.objectFifo @of1 (%tile12, {%tile13}, 4 : i32) : !AIE.objectFifo<memref<16xi32>>
+
+    %core12 = AIE.core(%tile12) {
+        %v11 = arith.constant 11 : i32
+        %c0 = arith.constant 0 : index
+        %c1 = arith.constant 1 : index
+        %height = arith.constant 12 : index
+
+        scf.for %arg0 = %c0 to %height step %c1 {
+            %subview0 = AIE.objectFifo.acquire @of0 (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+            %elem0 = AIE.objectFifo.subview.access %subview0[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+            memref.store %v11, %elem0[%c0] : memref<16xi32>
+            AIE.objectFifo.release @of0 (Produce, 1)
+
+            %subview1 = AIE.objectFifo.acquire @of1 (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+            %elem1 = AIE.objectFifo.subview.access %subview1[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+            memref.store %v11, %elem1[%c0] : memref<16xi32>
+            AIE.objectFifo.release @of1 (Produce, 1)
+        }
+
+        AIE.end
+    }
+ }
+}
@@ -24,131 +24,155 @@
 // CHECK:     %6 = AIE.lock(%0, 1) {init = 0 : i32, sym_name = "link1_cons_lock"}
 // CHECK:     %7 = AIE.buffer(%1) {sym_name = "link1_cons_buff_0"} : memref<48xi32>
 // CHECK:     %8 = AIE.buffer(%1) {sym_name = "link1_cons_buff_1"} : memref<48xi32>
-// CHECK:     %9 = AIE.lock(%1, 0) {init = 6 : i32, sym_name = "link1_cons_prod_lock"}
-// CHECK:     %10 = AIE.lock(%1, 1) {init = 0 : i32, sym_name = "link1_cons_cons_lock"}
+// CHECK:     %9 = AIE.lock(%1, 0) {init = 2 : i32, sym_name = "link1_cons_0_prod_lock"}
+// CHECK:     %10 = AIE.lock(%1, 1) {init = 0 : i32, sym_name = "link1_cons_0_cons_lock"}
+// CHECK:     %11 = AIE.lock(%1, 2) {init = 2 : i32, sym_name = "link1_cons_1_prod_lock"}
+// CHECK:     %12 = AIE.lock(%1, 3) {init = 0 : i32, sym_name = "link1_cons_1_cons_lock"}
+// CHECK:     %13 = AIE.lock(%1, 4) {init = 2 : i32, sym_name = "link1_cons_2_prod_lock"}
+// CHECK:     %14 = AIE.lock(%1, 5) {init = 0 : i32, sym_name = "link1_cons_2_cons_lock"}
 // CHECK:     AIE.flow(%1, DMA : 0, %2, DMA : 0)
-// CHECK:     %11 = AIE.buffer(%2) {sym_name = "link2_cons_buff_0"} : memref<4x4xi32>
-// CHECK:     %12 = AIE.buffer(%2) {sym_name = "link2_cons_buff_1"} : memref<4x4xi32>
-// CHECK:     %13 = AIE.lock(%2, 0) {init = 2 : i32, sym_name = "link2_cons_prod_lock"}
-// CHECK:     %14 = AIE.lock(%2, 1) {init = 0 : i32, sym_name = "link2_cons_cons_lock"}
+// CHECK:     %15 = AIE.buffer(%2) {sym_name = "link2_cons_buff_0"} : memref<4x4xi32>
+// CHECK:     %16 = AIE.buffer(%2) {sym_name = "link2_cons_buff_1"} : memref<4x4xi32>
+// CHECK:     %17 = AIE.lock(%2, 0) {init = 2 : i32, sym_name = "link2_cons_prod_lock"}
+// CHECK:     %18 = AIE.lock(%2, 1) {init = 0 : i32, sym_name = "link2_cons_cons_lock"}
 // CHECK:     AIE.flow(%1, DMA : 1, %3, DMA : 0)
-// CHECK:     %15 = AIE.buffer(%3) {sym_name = "link3_cons_buff_0"} : memref<20xi32>
-// CHECK:     %16 = AIE.buffer(%3) {sym_name = "link3_cons_buff_1"} : memref<20xi32>
-// CHECK:     %17 = AIE.lock(%3, 0) {init = 2 : i32, sym_name = "link3_cons_prod_lock"}
-// CHECK:     %18 = AIE.lock(%3, 1) {init = 0 : i32, sym_name = "link3_cons_cons_lock"}
+// CHECK:     %19 = AIE.buffer(%3) {sym_name = "link3_cons_buff_0"} : memref<20xi32>
+// CHECK:     %20 = AIE.buffer(%3) {sym_name = "link3_cons_buff_1"} : memref<20xi32>
+// CHECK:     %21 = AIE.lock(%3, 0) {init = 2 : i32, sym_name = "link3_cons_prod_lock"}
+// CHECK:     %22 = AIE.lock(%3, 1) {init = 0 : i32, sym_name = "link3_cons_cons_lock"}
 // CHECK:     AIE.flow(%1, DMA : 2, %4, DMA : 0)
-// CHECK:     %19 = AIE.buffer(%4) {sym_name = "link4_cons_buff_0"} : memref<12xi32>
-// CHECK:     %20 = AIE.buffer(%4) {sym_name = "link4_cons_buff_1"} : memref<12xi32>
-// CHECK:     %21 = AIE.lock(%4, 0) {init = 2 : i32, sym_name = "link4_cons_prod_lock"}
-// CHECK:     %22 = AIE.lock(%4, 1) {init = 0 : i32, sym_name = "link4_cons_cons_lock"}
-// CHECK:     %23 = AIE.external_buffer {sym_name = "ext_buffer_in"} : memref<48xi32>
+// CHECK:     %23 = AIE.buffer(%4) {sym_name = "link4_cons_buff_0"} : memref<12xi32>
+// CHECK:     %24 = AIE.buffer(%4) {sym_name = "link4_cons_buff_1"} : memref<12xi32>
+// CHECK:     %25 = AIE.lock(%4, 0) {init = 2 : i32, sym_name = "link4_cons_prod_lock"}
+// CHECK:     %26 = AIE.lock(%4, 1) {init = 0 : i32, sym_name = "link4_cons_cons_lock"}
+// CHECK:     %27 = AIE.external_buffer {sym_name = "ext_buffer_in"} : memref<48xi32>
 // CHECK:     AIE.shimDMAAllocation @link1(MM2S, 0, 2)
-// CHECK:     %24 = AIE.shimDMA(%0) {
-// CHECK:       %29 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb2)
+// CHECK:     %28 = AIE.shimDMA(%0) {
+// CHECK:       %33 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb2)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb1
 // CHECK:       AIE.useLock(%6, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%23 : memref<48xi32>, 0, 48>, 0)
+// CHECK:       AIE.dmaBd(<%27 : memref<48xi32>, 0, 48>, 0)
 // CHECK:       AIE.useLock(%5, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
 // CHECK:     ^bb2:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %25 = AIE.memTileDMA(%1) {
-// CHECK:       %29 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
-// CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
-// CHECK:       AIE.useLock(%9, AcquireGreaterEqual, 3)
-// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 0, 48>, 0)
-// CHECK:       AIE.useLock(%10, Release, 3)
+// CHECK:     %29 = AIE.memTileDMA(%1) {
+// CHECK:       %33 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb7)
+// CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb6
+// CHECK:       AIE.useLock(%9, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 0, 16>, 0)
+// CHECK:       AIE.useLock(%10, Release, 1)
 // CHECK:       AIE.nextBd ^bb2
 // CHECK:     ^bb2:  // pred: ^bb1
-// CHECK:       AIE.useLock(%9, AcquireGreaterEqual, 3)
-// CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 0, 48>, 0)
-// CHECK:       AIE.useLock(%10, Release, 3)
+// CHECK:       AIE.useLock(%11, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 64, 20>, 0)
+// CHECK:       AIE.useLock(%12, Release, 1)
+// CHECK:       AIE.nextBd ^bb3
+// CHECK:     ^bb3:  // pred: ^bb2
+// CHECK:       AIE.useLock(%13, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 144, 12>, 0)
+// CHECK:       AIE.useLock(%14, Release, 1)
+// CHECK:       AIE.nextBd ^bb4
+// CHECK:     ^bb4:  // pred: ^bb3
+// CHECK:       AIE.useLock(%9, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 0, 16>, 0)
+// CHECK:       AIE.useLock(%10, Release, 1)
+// CHECK:       AIE.nextBd ^bb5
+// CHECK:     ^bb5:  // pred: ^bb4
+// CHECK:       AIE.useLock(%11, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 64, 20>, 0)
+// CHECK:       AIE.useLock(%12, Release, 1)
+// CHECK:       AIE.nextBd ^bb6
+// CHECK:     ^bb6:  // pred: ^bb5
+// CHECK:       AIE.useLock(%13, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 144, 12>, 0)
+// CHECK:       AIE.useLock(%14, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
-// CHECK:     ^bb3:  // pred: ^bb0
-// CHECK:       %30 = AIE.dmaStart(MM2S, 0, ^bb4, ^bb6)
-// CHECK:     ^bb4:  // 2 preds: ^bb3, ^bb5
+// CHECK:     ^bb7:  // pred: ^bb0
+// CHECK:       %34 = AIE.dmaStart(MM2S, 0, ^bb8, ^bb10)
+// CHECK:     ^bb8:  // 2 preds: ^bb7, ^bb9
 // CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 0, 16>, 0)
 // CHECK:       AIE.useLock(%9, Release, 1)
-// CHECK:       AIE.nextBd ^bb5
-// CHECK:     ^bb5:  // pred: ^bb4
+// CHECK:       AIE.nextBd ^bb9
+// CHECK:     ^bb9:  // pred: ^bb8
 // CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 0, 16>, 0)
 // CHECK:       AIE.useLock(%9, Release, 1)
-// CHECK:       AIE.nextBd ^bb4
-// CHECK:     ^bb6:  // pred: ^bb3
-// CHECK:       %31 = AIE.dmaStart(MM2S, 1, ^bb7, ^bb9)
-// CHECK:     ^bb7:  // 2 preds: ^bb6, ^bb8
-// CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 64, 20>, 0)
-// CHECK:       AIE.useLock(%9, Release, 1)
 // CHECK:       AIE.nextBd ^bb8
-// CHECK:     ^bb8:  // pred: ^bb7
-// CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
+// CHECK:     ^bb10:  // pred: ^bb7
+// CHECK:       %35 = AIE.dmaStart(MM2S, 1, ^bb11, ^bb13)
+// CHECK:     ^bb11:  // 2 preds: ^bb10, ^bb12
+// CHECK:       AIE.useLock(%12, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 64, 20>, 0)
+// CHECK:       AIE.useLock(%11, Release, 1)
+// CHECK:       AIE.nextBd ^bb12
+// CHECK:     ^bb12:  // pred: ^bb11
+// CHECK:       AIE.useLock(%12, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 64, 20>, 0)
-// CHECK:       AIE.useLock(%9, Release, 1)
-// CHECK:       AIE.nextBd ^bb7
-// CHECK:     ^bb9:  // pred: ^bb6
-// CHECK:       %32 = AIE.dmaStart(MM2S, 2, ^bb10, ^bb12)
-// CHECK:     ^bb10:  // 2 preds: ^bb9, ^bb11
-// CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 144, 12>, 0)
-// CHECK:       AIE.useLock(%9, Release, 1)
+// CHECK:       AIE.useLock(%11, Release, 1)
 // CHECK:       AIE.nextBd ^bb11
-// CHECK:     ^bb11:  // pred: ^bb10
-// CHECK:       AIE.useLock(%10, AcquireGreaterEqual, 1)
+// CHECK:     ^bb13:  // pred: ^bb10
+// CHECK:       %36 = AIE.dmaStart(MM2S, 2, ^bb14, ^bb16)
+// CHECK:     ^bb14:  // 2 preds: ^bb13, ^bb15
+// CHECK:       AIE.useLock(%14, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%7 : memref<48xi32>, 144, 12>, 0)
+// CHECK:       AIE.useLock(%13, Release, 1)
+// CHECK:       AIE.nextBd ^bb15
+// CHECK:     ^bb15:  // pred: ^bb14
+// CHECK:       AIE.useLock(%14, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%8 : memref<48xi32>, 144, 12>, 0)
-// CHECK:       AIE.useLock(%9, Release, 1)
-// CHECK:       AIE.nextBd ^bb10
-// CHECK:     ^bb12:  // pred: ^bb9
-// CHECK:       AIE.end
-// CHECK:     }
-// CHECK:     %26 = AIE.mem(%2) {
-// CHECK:       %29 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
-// CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
-// CHECK:       AIE.useLock(%13, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%11 : memref<4x4xi32>, 0, 16>, 0)
-// CHECK:       AIE.useLock(%14, Release, 1)
-// CHECK:       AIE.nextBd ^bb2
-// CHECK:     ^bb2:  // pred: ^bb1
-// CHECK:       AIE.useLock(%13, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%12 : memref<4x4xi32>, 0, 16>, 0)
-// CHECK:       AIE.useLock(%14, Release, 1)
-// CHECK:       AIE.nextBd ^bb1
-// CHECK:     ^bb3:  // pred: ^bb0
+// CHECK:       AIE.useLock(%13, Release, 1)
+// CHECK:       AIE.nextBd ^bb14
+// CHECK:     ^bb16:  // pred: ^bb13
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %27 = AIE.mem(%3) {
-// CHECK:       %29 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK:     %30 = AIE.mem(%2) {
+// CHECK:       %33 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%17, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%15 : memref<20xi32>, 0, 20>, 0)
+// CHECK:       AIE.dmaBd(<%15 : memref<4x4xi32>, 0, 16>, 0)
 // CHECK:       AIE.useLock(%18, Release, 1)
 // CHECK:       AIE.nextBd ^bb2
 // CHECK:     ^bb2:  // pred: ^bb1
 // CHECK:       AIE.useLock(%17, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%16 : memref<20xi32>, 0, 20>, 0)
+// CHECK:       AIE.dmaBd(<%16 : memref<4x4xi32>, 0, 16>, 0)
 // CHECK:       AIE.useLock(%18, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
 // CHECK:     ^bb3:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %28 = AIE.mem(%4) {
-// CHECK:       %29 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK:     %31 = AIE.mem(%3) {
+// CHECK:       %33 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%21, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%19 : memref<12xi32>, 0, 12>, 0)
+// CHECK:       AIE.dmaBd(<%19 : memref<20xi32>, 0, 20>, 0)
 // CHECK:       AIE.useLock(%22, Release, 1)
 // CHECK:       AIE.nextBd ^bb2
 // CHECK:     ^bb2:  // pred: ^bb1
 // CHECK:       AIE.useLock(%21, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%20 : memref<12xi32>, 0, 12>, 0)
+// CHECK:       AIE.dmaBd(<%20 : memref<20xi32>, 0, 20>, 0)
 // CHECK:       AIE.useLock(%22, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
 // CHECK:     ^bb3:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
+// CHECK:     %32 = AIE.mem(%4) {
+// CHECK:       %33 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
+// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%23 : memref<12xi32>, 0, 12>, 0)
+// CHECK:       AIE.useLock(%26, Release, 1)
+// CHECK:       AIE.nextBd ^bb2
+// CHECK:     ^bb2:  // pred: ^bb1
+// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%24 : memref<12xi32>, 0, 12>, 0)
+// CHECK:       AIE.useLock(%26, Release, 1)
+// CHECK:       AIE.nextBd ^bb1
+// CHECK:     ^bb3:  // pred: ^bb0
+// CHECK:       AIE.end
+// CHECK:     }
 // CHECK:   }
 // CHECK: }
      
@@ -43,13 +43,19 @@
 // CHECK:     AIE.flow(%1, DMA : 0, %0, DMA : 0)
 // CHECK:     %22 = AIE.buffer(%1) {sym_name = "link5_buff_0"} : memref<512xi8>
 // CHECK:     %23 = AIE.buffer(%1) {sym_name = "link5_buff_1"} : memref<512xi8>
-// CHECK:     %24 = AIE.lock(%1, 0) {init = 8 : i32, sym_name = "link5_prod_lock"}
-// CHECK:     %25 = AIE.lock(%1, 1) {init = 0 : i32, sym_name = "link5_cons_lock"}
-// CHECK:     %26 = AIE.lock(%0, 0) {init = 1 : i32, sym_name = "link5_cons_prod_lock"}
-// CHECK:     %27 = AIE.lock(%0, 1) {init = 0 : i32, sym_name = "link5_cons_cons_lock"}
-// CHECK:     %28 = AIE.external_buffer {sym_name = "ext_buffer_in"} : memref<512xi8>
-// CHECK:     %29 = AIE.mem(%2) {
-// CHECK:       %35 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK:     %24 = AIE.lock(%1, 0) {init = 2 : i32, sym_name = "link5_0_prod_lock"}
+// CHECK:     %25 = AIE.lock(%1, 1) {init = 0 : i32, sym_name = "link5_0_cons_lock"}
+// CHECK:     %26 = AIE.lock(%1, 2) {init = 2 : i32, sym_name = "link5_1_prod_lock"}
+// CHECK:     %27 = AIE.lock(%1, 3) {init = 0 : i32, sym_name = "link5_1_cons_lock"}
+// CHECK:     %28 = AIE.lock(%1, 4) {init = 2 : i32, sym_name = "link5_2_prod_lock"}
+// CHECK:     %29 = AIE.lock(%1, 5) {init = 0 : i32, sym_name = "link5_2_cons_lock"}
+// CHECK:     %30 = AIE.lock(%1, 6) {init = 2 : i32, sym_name = "link5_3_prod_lock"}
+// CHECK:     %31 = AIE.lock(%1, 7) {init = 0 : i32, sym_name = "link5_3_cons_lock"}
+// CHECK:     %32 = AIE.lock(%0, 0) {init = 1 : i32, sym_name = "link5_cons_prod_lock"}
+// CHECK:     %33 = AIE.lock(%0, 1) {init = 0 : i32, sym_name = "link5_cons_cons_lock"}
+// CHECK:     %34 = AIE.external_buffer {sym_name = "ext_buffer_in"} : memref<512xi8>
+// CHECK:     %35 = AIE.mem(%2) {
+// CHECK:       %41 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%9, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%6 : memref<128xi8>, 0, 128>, 0)
@@ -63,8 +69,8 @@
 // CHECK:     ^bb3:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %30 = AIE.memTileDMA(%1) {
-// CHECK:       %35 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK:     %36 = AIE.memTileDMA(%1) {
+// CHECK:       %41 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 0, 128>, 0)
@@ -76,58 +82,88 @@
 // CHECK:       AIE.useLock(%25, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
 // CHECK:     ^bb3:  // pred: ^bb0
-// CHECK:       %36 = AIE.dmaStart(S2MM, 1, ^bb4, ^bb6)
+// CHECK:       %42 = AIE.dmaStart(S2MM, 1, ^bb4, ^bb6)
 // CHECK:     ^bb4:  // 2 preds: ^bb3, ^bb5
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%26, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 128, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%27, Release, 1)
 // CHECK:       AIE.nextBd ^bb5
 // CHECK:     ^bb5:  // pred: ^bb4
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%26, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 128, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%27, Release, 1)
 // CHECK:       AIE.nextBd ^bb4
 // CHECK:     ^bb6:  // pred: ^bb3
-// CHECK:       %37 = AIE.dmaStart(S2MM, 2, ^bb7, ^bb9)
+// CHECK:       %43 = AIE.dmaStart(S2MM, 2, ^bb7, ^bb9)
 // CHECK:     ^bb7:  // 2 preds: ^bb6, ^bb8
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%28, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 256, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%29, Release, 1)
 // CHECK:       AIE.nextBd ^bb8
 // CHECK:     ^bb8:  // pred: ^bb7
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%28, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 256, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%29, Release, 1)
 // CHECK:       AIE.nextBd ^bb7
 // CHECK:     ^bb9:  // pred: ^bb6
-// CHECK:       %38 = AIE.dmaStart(S2MM, 3, ^bb10, ^bb12)
+// CHECK:       %44 = AIE.dmaStart(S2MM, 3, ^bb10, ^bb12)
 // CHECK:     ^bb10:  // 2 preds: ^bb9, ^bb11
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%30, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 384, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%31, Release, 1)
 // CHECK:       AIE.nextBd ^bb11
 // CHECK:     ^bb11:  // pred: ^bb10
-// CHECK:       AIE.useLock(%24, AcquireGreaterEqual, 1)
+// CHECK:       AIE.useLock(%30, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 384, 128>, 0)
-// CHECK:       AIE.useLock(%25, Release, 1)
+// CHECK:       AIE.useLock(%31, Release, 1)
 // CHECK:       AIE.nextBd ^bb10
 // CHECK:     ^bb12:  // pred: ^bb9
-// CHECK:       %39 = AIE.dmaStart(MM2S, 0, ^bb13, ^bb15)
-// CHECK:     ^bb13:  // 2 preds: ^bb12, ^bb14
-// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 4)
-// CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 0, 512>, 0)
-// CHECK:       AIE.useLock(%24, Release, 4)
+// CHECK:       %45 = AIE.dmaStart(MM2S, 0, ^bb13, ^bb21)
+// CHECK:     ^bb13:  // 2 preds: ^bb12, ^bb20
+// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 0, 128>, 0)
+// CHECK:       AIE.useLock(%24, Release, 1)
 // CHECK:       AIE.nextBd ^bb14
 // CHECK:     ^bb14:  // pred: ^bb13
-// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 4)
-// CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 0, 512>, 0)
-// CHECK:       AIE.useLock(%24, Release, 4)
+// CHECK:       AIE.useLock(%27, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 128, 128>, 0)
+// CHECK:       AIE.useLock(%26, Release, 1)
+// CHECK:       AIE.nextBd ^bb15
+// CHECK:     ^bb15:  // pred: ^bb14
+// CHECK:       AIE.useLock(%29, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 256, 128>, 0)
+// CHECK:       AIE.useLock(%28, Release, 1)
+// CHECK:       AIE.nextBd ^bb16
+// CHECK:     ^bb16:  // pred: ^bb15
+// CHECK:       AIE.useLock(%31, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%22 : memref<512xi8>, 384, 128>, 0)
+// CHECK:       AIE.useLock(%30, Release, 1)
+// CHECK:       AIE.nextBd ^bb17
+// CHECK:     ^bb17:  // pred: ^bb16
+// CHECK:       AIE.useLock(%25, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 0, 128>, 0)
+// CHECK:       AIE.useLock(%24, Release, 1)
+// CHECK:       AIE.nextBd ^bb18
+// CHECK:     ^bb18:  // pred: ^bb17
+// CHECK:       AIE.useLock(%27, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 128, 128>, 0)
+// CHECK:       AIE.useLock(%26, Release, 1)
+// CHECK:       AIE.nextBd ^bb19
+// CHECK:     ^bb19:  // pred: ^bb18
+// CHECK:       AIE.useLock(%29, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 256, 128>, 0)
+// CHECK:       AIE.useLock(%28, Release, 1)
+// CHECK:       AIE.nextBd ^bb20
+// CHECK:     ^bb20:  // pred: ^bb19
+// CHECK:       AIE.useLock(%31, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%23 : memref<512xi8>, 384, 128>, 0)
+// CHECK:       AIE.useLock(%30, Release, 1)
 // CHECK:       AIE.nextBd ^bb13
-// CHECK:     ^bb15:  // pred: ^bb12
+// CHECK:     ^bb21:  // pred: ^bb12
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %31 = AIE.mem(%3) {
-// CHECK:       %35 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK:     %37 = AIE.mem(%3) {
+// CHECK:       %41 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%13, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%10 : memref<128xi8>, 0, 128>, 0)
@@ -141,8 +177,8 @@
 // CHECK:     ^bb3:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %32 = AIE.mem(%4) {
-// CHECK:       %35 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK:     %38 = AIE.mem(%4) {
+// CHECK:       %41 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%17, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%14 : memref<128xi8>, 0, 128>, 0)
@@ -156,8 +192,8 @@
 // CHECK:     ^bb3:  // pred: ^bb0
 // CHECK:       AIE.end
 // CHECK:     }
-// CHECK:     %33 = AIE.mem(%5) {
-// CHECK:       %35 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK:     %39 = AIE.mem(%5) {
+// CHECK:       %41 = AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb2
 // CHECK:       AIE.useLock(%21, AcquireGreaterEqual, 1)
 // CHECK:       AIE.dmaBd(<%18 : memref<128xi8>, 0, 128>, 0)
@@ -172,12 +208,12 @@
 // CHECK:       AIE.end
 // CHECK:     }
 // CHECK:     AIE.shimDMAAllocation @link5(S2MM, 0, 2)
-// CHECK:     %34 = AIE.shimDMA(%0) {
-// CHECK:       %35 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb2)
+// CHECK:     %40 = AIE.shimDMA(%0) {
+// CHECK:       %41 = AIE.dmaStart(S2MM, 0, ^bb1, ^bb2)
 // CHECK:     ^bb1:  // 2 preds: ^bb0, ^bb1
-// CHECK:       AIE.useLock(%26, AcquireGreaterEqual, 1)
-// CHECK:       AIE.dmaBd(<%28 : memref<512xi8>, 0, 512>, 0)
-// CHECK:       AIE.useLock(%27, Release, 1)
+// CHECK:       AIE.useLock(%32, AcquireGreaterEqual, 1)
+// CHECK:       AIE.dmaBd(<%34 : memref<512xi8>, 0, 512>, 0)
+// CHECK:       AIE.useLock(%33, Release, 1)
 // CHECK:       AIE.nextBd ^bb1
 // CHECK:     ^bb2:  // pred: ^bb0
 // CHECK:       AIE.end
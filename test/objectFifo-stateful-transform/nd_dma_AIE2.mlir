@@ -0,0 +1,46 @@
+//===- nd_dma_AIE2.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+
+// The producer DMA of @of sends each 8x8 element transposed, and the
+// consumer DMA of @of2 transposes each element it receives.
+
+// CHECK-LABEL: module @ndDMAObjFifoAIE2 {
+// CHECK:         %[[OF_0:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of_buff_0"} : memref<64xi32>
+// CHECK:         %[[OF_1:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of_buff_1"} : memref<64xi32>
+// CHECK:         %[[CONS_0:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of2_cons_buff_0"} : memref<64xi32>
+// CHECK:         %[[CONS_1:.*]] = AIE.buffer(%{{.*}}) {sym_name = "of2_cons_buff_1"} : memref<64xi32>
+// CHECK:         AIE.mem(%{{.*}}) {
+// CHECK:           AIE.dmaStart(MM2S, 0, ^{{.*}}, ^{{.*}})
+// CHECK:           AIE.dmaBd(<%[[OF_0]] : memref<64xi32>, 0, 64>, 0, [<1, 8>, <8, 8>])
+// CHECK:           AIE.dmaBd(<%[[OF_1]] : memref<64xi32>, 0, 64>, 0, [<1, 8>, <8, 8>])
+// CHECK:           AIE.dmaStart(MM2S, 1, ^{{.*}}, ^{{.*}})
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<64xi32>, 0, 64>, 0)
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<64xi32>, 0, 64>, 0)
+// CHECK:         }
+// CHECK:         AIE.mem(%{{.*}}) {
+// CHECK:           AIE.dmaStart(S2MM, 0, ^{{.*}}, ^{{.*}})
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<64xi32>, 0, 64>, 0)
+// CHECK:           AIE.dmaBd(<%{{.*}} : memref<64xi32>, 0, 64>, 0)
+// CHECK:           AIE.dmaStart(S2MM, 1, ^{{.*}}, ^{{.*}})
+// CHECK:           AIE.dmaBd(<%[[CONS_0]] : memref<64xi32>, 0, 64>, 0, [<1, 8>, <8, 8>])
+// CHECK:           AIE.dmaBd(<%[[CONS_1]] : memref<64xi32>, 0, 64>, 0, [<1, 8>, <8, 8>])
+// CHECK:         }
+
+module @ndDMAObjFifoAIE2 {
+ AIE.device(xcve2302) {
+    %tile12 = AIE.tile(1, 2)
+    %tile33 = AIE.tile(3, 3)
+
+    AIE.objectFifo @of (%tile12 toStream [<1, 8>, <8, 8>], {%tile33}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+    AIE.objectFifo @of2 (%tile12, {%tile33} fromStream [<1, 8>, <8, 8>], 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+ }
+}
@@ -0,0 +1,82 @@
+//===- packet_multiplexing_AIE2.mlir ---------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s --check-prefix=FLOWS
+
+// Tile (1, 2) sends three objectFifos with two MM2S channels: @of0 gets the
+// first channel, @of1 and @of2 share the second one as packet flows.
+
+// FLOWS:       %[[T12:.*]] = AIE.tile(1, 2)
+// FLOWS:       %[[T33:.*]] = AIE.tile(3, 3)
+// FLOWS:       %[[T34:.*]] = AIE.tile(3, 4)
+// FLOWS:       %[[T35:.*]] = AIE.tile(3, 5)
+// FLOWS:       AIE.flow(%[[T12]], DMA : 0, %[[T33]], DMA : 0)
+// FLOWS:       AIE.packet_flow(0) {
+// FLOWS-NEXT:    AIE.packet_source<%[[T12]], DMA : 1>
+// FLOWS-NEXT:    AIE.packet_dest<%[[T34]], DMA : 0>
+// FLOWS-NEXT:  }
+// FLOWS:       AIE.packet_flow(1) {
+// FLOWS-NEXT:    AIE.packet_source<%[[T12]], DMA : 1>
+// FLOWS-NEXT:    AIE.packet_dest<%[[T35]], DMA : 0>
+// FLOWS-NEXT:  }
+// FLOWS-NOT:   AIE.flow
+
+// CHECK:       %[[T12:.*]] = AIE.tile(1, 2)
+// CHECK-DAG:   %[[OF1_0:.*]] = AIE.buffer(%[[T12]]) {sym_name = "of1_buff_0"}
+// CHECK-DAG:   %[[OF1_1:.*]] = AIE.buffer(%[[T12]]) {sym_name = "of1_buff_1"}
+// CHECK-DAG:   %[[OF1_PROD:.*]] = AIE.lock(%[[T12]], {{.*}}) {init = 2 : i32, sym_name = "of1_prod_lock"}
+// CHECK-DAG:   %[[OF1_CONS:.*]] = AIE.lock(%[[T12]], {{.*}}) {init = 0 : i32, sym_name = "of1_cons_lock"}
+// CHECK-DAG:   %[[OF2_0:.*]] = AIE.buffer(%[[T12]]) {sym_name = "of2_buff_0"}
+// CHECK-DAG:   %[[OF2_1:.*]] = AIE.buffer(%[[T12]]) {sym_name = "of2_buff_1"}
+// CHECK-DAG:   %[[OF2_PROD:.*]] = AIE.lock(%[[T12]], {{.*}}) {init = 2 : i32, sym_name = "of2_prod_lock"}
+// CHECK-DAG:   %[[OF2_CONS:.*]] = AIE.lock(%[[T12]], {{.*}}) {init = 0 : i32, sym_name = "of2_cons_lock"}
+// CHECK:       AIE.mem(%[[T12]]) {
+// CHECK:         AIE.dmaStart(MM2S, 0, ^bb1, ^bb3)
+// CHECK:         AIE.dmaStart(MM2S, 1, ^bb4, ^bb8)
+// CHECK:       ^bb4:
+// CHECK-NEXT:    AIE.useLock(%[[OF1_CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBdPacket(0, 0)
+// CHECK-NEXT:    AIE.dmaBd(<%[[OF1_0]] : memref<16xi32>, 0, 16>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[OF1_PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb5
+// CHECK:       ^bb5:
+// CHECK-NEXT:    AIE.useLock(%[[OF2_CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBdPacket(0, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[OF2_0]] : memref<16xi32>, 0, 16>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[OF2_PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb6
+// CHECK:       ^bb6:
+// CHECK-NEXT:    AIE.useLock(%[[OF1_CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBdPacket(0, 0)
+// CHECK-NEXT:    AIE.dmaBd(<%[[OF1_1]] : memref<16xi32>, 0, 16>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[OF1_PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb7
+// CHECK:       ^bb7:
+// CHECK-NEXT:    AIE.useLock(%[[OF2_CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBdPacket(0, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[OF2_1]] : memref<16xi32>, 0, 16>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[OF2_PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb4
+// CHECK:       ^bb8:
+// CHECK-NEXT:    AIE.end
+
+module @packet_multiplexing_AIE2 {
+ AIE.device(xcve2302) {
+  %tile12 = AIE.tile(1, 2)
+  %tile33 = AIE.tile(3, 3)
+  %tile34 = AIE.tile(3, 4)
+  %tile35 = AIE.tile(3, 5)
+
+  AIE.objectFifo @of0 (%tile12, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+  AIE.objectFifo @of1 (%tile12, {%tile34}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+  AIE.objectFifo @of2 (%tile12, {%tile35}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+ }
+}
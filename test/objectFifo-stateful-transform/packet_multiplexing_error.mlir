@@ -0,0 +1,28 @@
+//===- packet_multiplexing_error.mlir --------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform --verify-diagnostics %s
+
+// The objectFifos sharing the second MM2S channel of tile (1, 2) are sent in
+// turn, one element each, so they must have the same depth.
+
+module @packet_multiplexing_error {
+ AIE.device(xcve2302) {
+  %tile12 = AIE.tile(1, 2)
+  %tile33 = AIE.tile(3, 3)
+  %tile34 = AIE.tile(3, 4)
+  %tile35 = AIE.tile(3, 5)
+
+  AIE.objectFifo @of0 (%tile12, {%tile33}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+  AIE.objectFifo @of1 (%tile12, {%tile34}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+  // expected-error@+1 {{'AIE.objectFifo' op shares a DMA channel of its producer tile with of1, but they have different depths}}
+  AIE.objectFifo @of2 (%tile12, {%tile35}, 3 : i32) : !AIE.objectFifo<memref<16xi32>>
+ }
+}
@@ -0,0 +1,41 @@
+//===- padding_compression_AIE2.mlir ---------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+
+// The memtile DMA of @tiles reads each 14x14 element of @in and sends it
+// with a border of zeros, as a 16x16 element, and the DMAs at both ends of
+// @weights compress its elements.
+
+// CHECK-LABEL: module @paddingCompressionAIE2 {
+// CHECK:         %[[IN_0:.*]] = AIE.buffer(%{{.*}}) {sym_name = "in_cons_buff_0"} : memref<196xi32>
+// CHECK:         %[[IN_1:.*]] = AIE.buffer(%{{.*}}) {sym_name = "in_cons_buff_1"} : memref<196xi32>
+// CHECK:         AIE.memTileDMA(%{{.*}}) {
+// CHECK-DAG:       AIE.dmaBd(<%[[IN_0]] : memref<196xi32>, 0, 256>, 0, [<14, 14>, <1, 14>] pad [<1, 1>, <1, 1>])
+// CHECK-DAG:       AIE.dmaBd(<%[[IN_1]] : memref<196xi32>, 0, 256>, 0, [<14, 14>, <1, 14>] pad [<1, 1>, <1, 1>])
+// CHECK-DAG:       AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0) {compression}
+// CHECK:         }
+// CHECK:         AIE.mem(%{{.*}}) {
+// CHECK-DAG:       AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0)
+// CHECK-DAG:       AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0) {compression}
+// CHECK:         }
+
+module @paddingCompressionAIE2 {
+ AIE.device(xcve2302) {
+    %tile21 = AIE.tile(2, 1)
+    %tile22 = AIE.tile(2, 2)
+    %tile23 = AIE.tile(2, 3)
+
+    AIE.objectFifo @in (%tile22, {%tile21}, 2 : i32) : !AIE.objectFifo<memref<196xi32>>
+    AIE.objectFifo @tiles (%tile21 toStream [<14, 14>, <1, 14>] pad [<1, 1>, <1, 1>], {%tile23}, 2 : i32) : !AIE.objectFifo<memref<256xi32>>
+    AIE.objectFifo.link [@in] -> [@tiles] ()
+    AIE.objectFifo @weights (%tile21, {%tile23}, 2 : i32) {compression} : !AIE.objectFifo<memref<256xi32>>
+ }
+}
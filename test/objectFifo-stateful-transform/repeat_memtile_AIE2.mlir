@@ -0,0 +1,60 @@
+//===- repeat_memtile_AIE2.mlir ---------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+
+// The memtile sends each element of @weights twice, acquiring it before the
+// first send and releasing it after the last one, while it receives each
+// element of @weights_in once.
+
+// CHECK-DAG:   %[[PROD:.*]] = AIE.lock(%{{.*}}, 0) {init = 2 : i32, sym_name = "weights_in_cons_prod_lock"}
+// CHECK-DAG:   %[[CONS:.*]] = AIE.lock(%{{.*}}, 1) {init = 0 : i32, sym_name = "weights_in_cons_cons_lock"}
+// CHECK:       AIE.memTileDMA
+// CHECK:         AIE.dmaStart(S2MM, 0, ^bb1, ^bb3)
+// CHECK:       ^bb1:
+// CHECK-NEXT:    AIE.useLock(%[[PROD]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF0:.*]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[CONS]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb2
+// CHECK:       ^bb2:
+// CHECK-NEXT:    AIE.useLock(%[[PROD]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF1:.*]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[CONS]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb1
+// CHECK:         AIE.dmaStart(MM2S, 0, ^bb4, ^bb8)
+// CHECK:       ^bb4:
+// CHECK-NEXT:    AIE.useLock(%[[CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF0]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.nextBd ^bb5
+// CHECK:       ^bb5:
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF0]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb6
+// CHECK:       ^bb6:
+// CHECK-NEXT:    AIE.useLock(%[[CONS]], AcquireGreaterEqual, 1)
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF1]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.nextBd ^bb7
+// CHECK:       ^bb7:
+// CHECK-NEXT:    AIE.dmaBd(<%[[BUFF1]] : memref<1024xi32>, 0, 1024>, 0)
+// CHECK-NEXT:    AIE.useLock(%[[PROD]], Release, 1)
+// CHECK-NEXT:    AIE.nextBd ^bb4
+
+module @repeat_memtile {
+  AIE.device(xcve2302) {
+    %tile00 = AIE.tile(0, 0)
+    %tile01 = AIE.tile(0, 1)
+    %tile02 = AIE.tile(0, 2)
+    %tile03 = AIE.tile(0, 3)
+
+    AIE.objectFifo @weights_in (%tile00, {%tile01}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @weights (%tile01, {%tile02, %tile03}, 2 : i32) {repeatCount = 2 : i32} : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo.link [@weights_in] -> [@weights] ()
+  }
+}
@@ -0,0 +1,89 @@
+//===- shared_broadcast_AIE2.mlir ------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+
+// The south, north and east neighbours of the producer all access its
+// memory: the elements stay there, each consumer has a lock of its own and
+// the producer acquires an element once all the consumers released it.
+// CHECK-LABEL: module @shared_broadcast
+// CHECK-DAG:   AIE.buffer(%[[T24:.*]]) {sym_name = "of_buff_0"} : memref<16xi32>
+// CHECK-DAG:   AIE.buffer(%[[T24]]) {sym_name = "of_buff_1"} : memref<16xi32>
+// CHECK-DAG:   %[[PROD:.*]] = AIE.lock(%[[T24]], 0) {init = 6 : i32, sym_name = "of_prod_lock"}
+// CHECK-DAG:   %[[CONS0:.*]] = AIE.lock(%[[T24]], 1) {init = 0 : i32, sym_name = "of_0_cons_lock"}
+// CHECK-DAG:   %[[CONS1:.*]] = AIE.lock(%[[T24]], 2) {init = 0 : i32, sym_name = "of_1_cons_lock"}
+// CHECK-DAG:   %[[CONS2:.*]] = AIE.lock(%[[T24]], 3) {init = 0 : i32, sym_name = "of_2_cons_lock"}
+// CHECK-NOT:   AIE.flow
+// CHECK-NOT:   AIE.mem(
+// CHECK:       AIE.core(%[[T24]])
+// CHECK:         AIE.useLock(%[[PROD]], AcquireGreaterEqual, 3)
+// CHECK:         memref.store
+// CHECK:         AIE.useLock(%[[CONS0]], Release, 1)
+// CHECK:         AIE.useLock(%[[CONS1]], Release, 1)
+// CHECK:         AIE.useLock(%[[CONS2]], Release, 1)
+// CHECK:       AIE.core
+// CHECK:         AIE.useLock(%[[CONS0]], AcquireGreaterEqual, 1)
+// CHECK:         memref.load
+// CHECK:         AIE.useLock(%[[PROD]], Release, 1)
+// CHECK:       AIE.core
+// CHECK:         AIE.useLock(%[[CONS1]], AcquireGreaterEqual, 1)
+// CHECK:         AIE.useLock(%[[PROD]], Release, 1)
+// CHECK:       AIE.core
+// CHECK:         AIE.useLock(%[[CONS2]], AcquireGreaterEqual, 1)
+// CHECK:         AIE.useLock(%[[PROD]], Release, 1)
+// CHECK-NOT:   AIE.flow
+
+module @shared_broadcast {
+ AIE.device(xcve2802) {
+  %tile23 = AIE.tile(2, 3)
+  %tile24 = AIE.tile(2, 4)
+  %tile25 = AIE.tile(2, 5)
+  %tile34 = AIE.tile(3, 4)
+
+  AIE.objectFifo @of (%tile24, {%tile23, %tile25, %tile34}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+
+  %core24 = AIE.core(%tile24) {
+    %c0 = arith.constant 0 : index
+    %v = arith.constant 7 : i32
+    %subview = AIE.objectFifo.acquire @of (Produce, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+    %elem = AIE.objectFifo.subview.access %subview[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+    memref.store %v, %elem[%c0] : memref<16xi32>
+    AIE.objectFifo.release @of (Produce, 1)
+    AIE.end
+  }
+
+  %core23 = AIE.core(%tile23) {
+    %c0 = arith.constant 0 : index
+    %subview = AIE.objectFifo.acquire @of (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+    %elem = AIE.objectFifo.subview.access %subview[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+    %v = memref.load %elem[%c0] : memref<16xi32>
+    AIE.objectFifo.release @of (Consume, 1)
+    AIE.end
+  }
+
+  %core25 = AIE.core(%tile25) {
+    %c0 = arith.constant 0 : index
+    %subview = AIE.objectFifo.acquire @of (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+    %elem = AIE.objectFifo.subview.access %subview[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+    %v = memref.load %elem[%c0] : memref<16xi32>
+    AIE.objectFifo.release @of (Consume, 1)
+    AIE.end
+  }
+
+  %core34 = AIE.core(%tile34) {
+    %c0 = arith.constant 0 : index
+    %subview = AIE.objectFifo.acquire @of (Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+    %elem = AIE.objectFifo.subview.access %subview[0] : !AIE.objectFifoSubview<memref<16xi32>> -> memref<16xi32>
+    %v = memref.load %elem[%c0] : memref<16xi32>
+    AIE.objectFifo.release @of (Consume, 1)
+    AIE.end
+  }
+ }
+}
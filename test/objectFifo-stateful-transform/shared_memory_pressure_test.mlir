@@ -0,0 +1,43 @@
+//===- shared_memory_pressure_test.mlir ------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-objectFifo-stateful-transform %s | FileCheck %s
+
+// Both cores can access the memory of the other tile.  The elements of @of0
+// do not fit next to the buffer of the producer tile, so they are placed in
+// the memory of the consumer tile instead of falling back to a DMA.  The
+// elements of @of1 still fit in the producer tile.
+
+// CHECK-LABEL: module @sharedMemoryPressure {
+// CHECK:         %[[T12:.*]] = AIE.tile(1, 2)
+// CHECK:         %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK-NOT:     AIE.flow
+// CHECK-DAG:     AIE.buffer(%[[T13]]) {sym_name = "of0_buff_0"} : memref<1024xi32>
+// CHECK-DAG:     AIE.buffer(%[[T13]]) {sym_name = "of0_buff_1"} : memref<1024xi32>
+// CHECK-DAG:     AIE.lock(%[[T13]], 0) {init = 0 : i32, sym_name = "of0_lock_0"}
+// CHECK-DAG:     AIE.lock(%[[T13]], 1) {init = 0 : i32, sym_name = "of0_lock_1"}
+// CHECK-DAG:     AIE.buffer(%[[T12]]) {sym_name = "of1_buff_0"} : memref<16xi32>
+// CHECK-DAG:     AIE.buffer(%[[T12]]) {sym_name = "of1_buff_1"} : memref<16xi32>
+
+module @sharedMemoryPressure {
+ AIE.device(xcvc1902) {
+    %tile12 = AIE.tile(1, 2)
+    %tile13 = AIE.tile(1, 3)
+
+    %big = AIE.buffer(%tile12) {sym_name = "big"} : memref<7500xi32>
+
+    AIE.objectFifo @of0 (%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<1024xi32>>
+    AIE.objectFifo @of1 (%tile12, {%tile13}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+
+    %core12 = AIE.core(%tile12) {
+        AIE.end
+    }
+ }
+}
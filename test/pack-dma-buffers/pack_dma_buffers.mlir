@@ -0,0 +1,105 @@
+//===- pack_dma_buffers.mlir -----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --split-input-file --aie-pack-dma-buffers %s | FileCheck %s
+
+// a and c are sent one after the other by channel 0, and move above b to be
+// sent by one BD.
+// CHECK-LABEL: AIE.device(xcve2302)
+// CHECK: AIE.buffer({{.*}}) {address = 32768 : i32, sym_name = "a"} : memref<4096xi32>
+// CHECK: AIE.buffer({{.*}}) {address = 16384 : i32, sym_name = "b"} : memref<4096xi32>
+// CHECK: AIE.buffer({{.*}}) {address = 49152 : i32, sym_name = "c"} : memref<4096xi32>
+// CHECK: AIE.dmaStart(MM2S, 0, ^[[BD0:.*]], ^{{.*}})
+// CHECK: ^[[BD0]]:
+// CHECK-NEXT: AIE.dmaBd(<%{{.*}} : memref<4096xi32>, 0, 8192>, 0)
+// CHECK-NEXT: AIE.nextBd ^[[BD0]]
+// CHECK: AIE.dmaBd(<%{{.*}} : memref<4096xi32>, 0, 4096>, 0)
+// CHECK-NOT: AIE.dmaBd
+
+module @memtile {
+ AIE.device(xcve2302) {
+  %t21 = AIE.tile(2, 1)
+  %a = AIE.buffer(%t21) { address = 0 : i32, sym_name = "a" } : memref<4096xi32>
+  %b = AIE.buffer(%t21) { address = 16384 : i32, sym_name = "b" } : memref<4096xi32>
+  %c = AIE.buffer(%t21) { address = 32768 : i32, sym_name = "c" } : memref<4096xi32>
+  AIE.memTileDMA(%t21) {
+    %s0 = AIE.dmaStart(MM2S, 0, ^bd0, ^next)
+  ^bd0:
+    AIE.dmaBd(<%a : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd1
+  ^bd1:
+    AIE.dmaBd(<%c : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd0
+  ^next:
+    %s1 = AIE.dmaStart(MM2S, 1, ^bd2, ^end)
+  ^bd2:
+    AIE.dmaBd(<%b : memref<4096xi32>, 0, 4096>, 0)
+    AIE.nextBd ^bd2
+  ^end:
+    AIE.end
+  }
+ }
+}
+
+// -----
+
+// x and y are sent under one lock and merged, w and z each have their locks
+// and are left as they are.
+// CHECK-LABEL: AIE.device(xcvc1902)
+// CHECK: AIE.buffer({{.*}}) {address = 0 : i32, sym_name = "x"} : memref<256xi32>
+// CHECK: AIE.buffer({{.*}}) {address = 1024 : i32, sym_name = "y"} : memref<256xi32>
+// CHECK: AIE.buffer({{.*}}) {address = 8192 : i32, sym_name = "w"} : memref<256xi32>
+// CHECK: AIE.buffer({{.*}}) {address = 12288 : i32, sym_name = "z"} : memref<256xi32>
+// CHECK: AIE.dmaStart(MM2S, 0, ^[[BD0:.*]], ^{{.*}})
+// CHECK: ^[[BD0]]:
+// CHECK-NEXT: AIE.useLock(%{{.*}}, Acquire, 1)
+// CHECK-NEXT: AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 512>, 0)
+// CHECK-NEXT: AIE.useLock(%{{.*}}, Release, 0)
+// CHECK-NEXT: AIE.nextBd ^[[BD0]]
+// CHECK: AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0)
+// CHECK: AIE.dmaBd(<%{{.*}} : memref<256xi32>, 0, 256>, 0)
+
+module @core_tile {
+ AIE.device(xcvc1902) {
+  %t72 = AIE.tile(7, 2)
+  %l0 = AIE.lock(%t72, 0)
+  %l1 = AIE.lock(%t72, 1)
+  %l2 = AIE.lock(%t72, 2)
+  %x = AIE.buffer(%t72) { address = 0 : i32, sym_name = "x" } : memref<256xi32>
+  %y = AIE.buffer(%t72) { address = 4096 : i32, sym_name = "y" } : memref<256xi32>
+  %w = AIE.buffer(%t72) { address = 8192 : i32, sym_name = "w" } : memref<256xi32>
+  %z = AIE.buffer(%t72) { address = 12288 : i32, sym_name = "z" } : memref<256xi32>
+  AIE.mem(%t72) {
+    %s0 = AIE.dmaStart(MM2S, 0, ^bd0, ^next)
+  ^bd0:
+    AIE.useLock(%l0, Acquire, 1)
+    AIE.dmaBd(<%x : memref<256xi32>, 0, 256>, 0)
+    AIE.nextBd ^bd1
+  ^bd1:
+    AIE.dmaBd(<%y : memref<256xi32>, 0, 256>, 0)
+    AIE.useLock(%l0, Release, 0)
+    AIE.nextBd ^bd0
+  ^next:
+    %s1 = AIE.dmaStart(S2MM, 0, ^bd2, ^end)
+  ^bd2:
+    AIE.useLock(%l1, Acquire, 0)
+    AIE.dmaBd(<%w : memref<256xi32>, 0, 256>, 0)
+    AIE.useLock(%l1, Release, 1)
+    AIE.nextBd ^bd3
+  ^bd3:
+    AIE.useLock(%l2, Acquire, 0)
+    AIE.dmaBd(<%z : memref<256xi32>, 0, 256>, 0)
+    AIE.useLock(%l2, Release, 1)
+    AIE.nextBd ^bd2
+  ^end:
+    AIE.end
+  }
+ }
+}
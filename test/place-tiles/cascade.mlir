@@ -0,0 +1,33 @@
+//===- cascade.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-place-tiles %s | FileCheck %s
+
+// The dest of each cascade flow is placed at the cascade neighbour of its
+// source, which is to the east on row 3 of AIE1.
+
+// CHECK-LABEL: module @place_cascade {
+// CHECK:   %[[T13:.*]] = AIE.tile(1, 3)
+// CHECK:   %[[A:.*]] = AIE.tile(2, 3)
+// CHECK-NOT: unplaced
+// CHECK:   %[[B:.*]] = AIE.tile(3, 3)
+// CHECK-NOT: unplaced
+// CHECK:   AIE.cascadeFlow(%[[T13]], %[[A]])
+// CHECK:   AIE.cascadeFlow(%[[A]], %[[B]])
+
+module @place_cascade {
+ AIE.device(xcvc1902) {
+  %t13 = AIE.tile(1, 3)
+  %a = AIE.tile(7, 7) {unplaced}
+  %b = AIE.tile(8, 8) {unplaced}
+  AIE.cascadeFlow(%t13, %a)
+  AIE.cascadeFlow(%a, %b)
+ }
+}
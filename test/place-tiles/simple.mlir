@@ -0,0 +1,33 @@
+//===- simple.mlir ---------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-place-tiles %s | FileCheck %s
+
+// The consumer of the objectFifo is placed where it can share memory with the
+// producer, and the destination of the flow is placed next to its source.
+
+// CHECK-LABEL: module @place_tiles {
+// CHECK:   %[[T23:.*]] = AIE.tile(2, 3)
+// CHECK:   %[[A:.*]] = AIE.tile(1, 3)
+// CHECK-NOT: unplaced
+// CHECK:   %[[B:.*]] = AIE.tile(0, 3)
+// CHECK-NOT: unplaced
+// CHECK:   AIE.objectFifo @of(%[[T23]], {%[[A]]}, 2 : i32)
+// CHECK:   AIE.flow(%[[A]], DMA : 0, %[[B]], DMA : 0)
+
+module @place_tiles {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3)
+  %a = AIE.tile(5, 5) {unplaced}
+  %b = AIE.tile(6, 6) {unplaced}
+  AIE.objectFifo @of (%t23, {%a}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+  AIE.flow(%a, DMA : 0, %b, DMA : 0)
+ }
+}
@@ -0,0 +1,53 @@
+//===- profile_loops.mlir --------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-profile-loops="loop=1" --verify-diagnostics %s | FileCheck %s
+// RUN: aie-opt --aie-profile-loops="loop=1" %s | aie-translate -aievec-to-cpp | FileCheck %s --check-prefix=CPP
+
+// The second vectorized loop of the kernel is marked.  The outer loop only
+// runs the vectorized loops and the scalar loop computes no vectors, so
+// neither counts.
+
+// CHECK-LABEL: func.func @kernel
+// CHECK:         scf.for
+// CHECK:           scf.for
+// CHECK-NOT:       AIE.event
+// CHECK:           AIE.event(0)
+// CHECK-NEXT:      scf.for
+// CHECK:           }
+// CHECK-NEXT:      AIE.event(1)
+
+// CPP-LABEL: void kernel(
+// CPP:         event0();
+// CPP-NEXT:    for (
+// CPP:         event1();
+func.func @kernel(%a: memref<256xi32>, %b: memref<256xi32>) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  %c16 = arith.constant 16 : index
+  %c256 = arith.constant 256 : index
+  %zero = arith.constant 0 : i32
+  scf.for %i = %c0 to %c4 step %c1 {
+    scf.for %k = %c0 to %c4 step %c1 {
+      memref.store %zero, %a[%k] : memref<256xi32>
+    }
+    scf.for %j = %c0 to %c256 step %c16 {
+      %v = aievec.upd %a[%j] {index = 0 : i8, offset = 0 : si32} : memref<256xi32>, vector<16xi32>
+      vector.transfer_write %v, %b[%j] : vector<16xi32>, memref<256xi32>
+    }
+    // expected-remark @below {{profiling vectorized loop 1 of 2 between AIE.event(0) and AIE.event(1)}}
+    scf.for %j = %c0 to %c256 step %c16 {
+      %v = aievec.upd %b[%j] {index = 0 : i8, offset = 0 : si32} : memref<256xi32>, vector<16xi32>
+      vector.transfer_write %v, %a[%j] : vector<16xi32>, memref<256xi32>
+    }
+  }
+  return
+}
@@ -0,0 +1,86 @@
+# Copyright (C) 2023, Advanced Micro Devices, Inc.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# RUN: python3 %s | FileCheck %s
+
+import aie
+from aie.design import Design
+from aie.mlir.ir import *
+
+def constructAndPrintDesign(f):
+    with Context() as ctx, Location.unknown():
+        aie.dialects.aie.register_dialect(ctx)
+        print("\nTEST:", f.__name__)
+        print(f().module)
+
+# CHECK-LABEL: pipeline
+# CHECK: AIE.device(xcvc1902) {
+# CHECK:   %[[SHIM:.*]] = AIE.tile(2, 0)
+# CHECK:   %[[T0:.*]] = AIE.tile(1, 2)
+# CHECK:   %[[T1:.*]] = AIE.tile(2, 2)
+# CHECK:   %[[T2:.*]] = AIE.tile(3, 2)
+# CHECK:   AIE.objectFifo @in(%[[SHIM]], {%[[T0]], %[[T1]], %[[T2]]}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   AIE.objectFifo @stage_0(%[[T0]], {%[[T1]]}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   AIE.objectFifo @stage_1(%[[T1]], {%[[T2]]}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   func.func private @step(memref<16xi32>, memref<16xi32>)
+# CHECK:   AIE.core(%[[T0]]) {
+# CHECK:     scf.for
+# CHECK:       %[[IN:.*]] = AIE.objectFifo.acquire @in(Consume, 1) : !AIE.objectFifoSubview<memref<16xi32>>
+# CHECK:       %[[A:.*]] = AIE.objectFifo.subview.access %[[IN]][0]
+# CHECK:       %[[OUT:.*]] = AIE.objectFifo.acquire @stage_0(Produce, 1)
+# CHECK:       %[[B:.*]] = AIE.objectFifo.subview.access %[[OUT]][0]
+# CHECK:       func.call @step(%[[A]], %[[B]])
+# CHECK:       AIE.objectFifo.release @in(Consume, 1)
+# CHECK:       AIE.objectFifo.release @stage_0(Produce, 1)
+# CHECK:     }
+# CHECK:     AIE.end
+# CHECK:   AIE.core(%[[T1]])
+# CHECK:   AIE.core(%[[T2]])
+# CHECK-NOT: AIE.core
+@constructAndPrintDesign
+def pipeline():
+    design = Design("xcvc1902")
+    shim = design.tile(2, 0)
+    cores = design.grid(cols=range(1, 4), rows=[2])
+    buf = MemRefType.get((16,), IntegerType.get_signless(32))
+    inputs = design.broadcast("in", shim, cores, 2, buf)
+    stages = design.pipeline("stage", cores, 2, buf)
+    step = design.external_func("step", [buf, buf])
+    for i, tile in enumerate(cores[:-1]):
+        with design.core(tile):
+            with design.for_range(0, 8):
+                a = inputs.acquire("Consume")
+                b = stages[i].acquire("Produce")
+                design.call(step, a + b)
+                inputs.release("Consume")
+                stages[i].release("Produce")
+    with design.core(cores[-1]):
+        with design.for_range(0, 8):
+            a = inputs.acquire("Consume")
+            b = stages[-1].acquire("Consume")
+            design.call(step, a + b)
+            inputs.release("Consume")
+            stages[-1].release("Consume")
+    return design
+
+# CHECK-LABEL: scatter
+# CHECK: AIE.device(xcve2302) {
+# CHECK:   %[[SHIM:.*]] = AIE.tile(0, 0)
+# CHECK:   %[[MEM:.*]] = AIE.tile(0, 1)
+# CHECK:   AIE.objectFifo @in(%[[SHIM]], {%[[MEM]]}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+# CHECK:   AIE.objectFifo @in_0(%[[MEM]], {%{{.*}}}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   AIE.objectFifo @in_3(%[[MEM]], {%{{.*}}}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   AIE.objectFifo.link [@in] -> [@in_0, @in_1, @in_2, @in_3]{{ ?}}()
+# CHECK:   AIE.objectFifo @out_0(%{{.*}}, {%[[MEM]]}, 2 : i32) : !AIE.objectFifo<memref<16xi32>>
+# CHECK:   AIE.objectFifo @out(%[[MEM]], {%[[SHIM]]}, 2 : i32) : !AIE.objectFifo<memref<64xi32>>
+# CHECK:   AIE.objectFifo.link [@out_0, @out_1, @out_2, @out_3] -> [@out]{{ ?}}()
+@constructAndPrintDesign
+def scatter():
+    design = Design("xcve2302")
+    shim = design.tile(0, 0)
+    memtile = design.tile(0, 1)
+    cores = design.grid(cols=range(4), rows=[2])
+    buf = MemRefType.get((16,), IntegerType.get_signless(32))
+    design.scatter("in", shim, memtile, cores, 2, buf)
+    design.gather("out", cores, memtile, shim, 2, buf)
+    return design
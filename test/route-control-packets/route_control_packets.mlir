@@ -0,0 +1,42 @@
+//===- route_control_packets.mlir ------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-route-control-packets %s | FileCheck %s
+// RUN: aie-opt --aie-route-control-packets --aie-create-packet-flows %s | FileCheck %s --check-prefix=ROUTED
+
+// The core tiles marked with ctrl get the control packets of the first shim
+// DMA, with the IDs following the one of the design.
+
+// CHECK:     %[[SHIM:.*]] = AIE.tile(2, 0)
+// CHECK:     %[[T23:.*]] = AIE.tile(2, 3) {ctrl_packet_id = 1 : i32}
+// CHECK:     %[[T24:.*]] = AIE.tile(2, 4) {ctrl_packet_id = 2 : i32}
+// CHECK:     AIE.packet_flow(0) {
+// CHECK:     AIE.packet_flow(1) {
+// CHECK-NEXT:  AIE.packet_source<%[[SHIM]], DMA : 1>
+// CHECK-NEXT:  AIE.packet_dest<%[[T23]], Ctrl : 0>
+// CHECK:     AIE.packet_flow(2) {
+// CHECK-NEXT:  AIE.packet_source<%[[SHIM]], DMA : 1>
+// CHECK-NEXT:  AIE.packet_dest<%[[T24]], Ctrl : 0>
+// CHECK-NOT: AIE.packet_flow
+
+// ROUTED-DAG: AIE.masterset(Ctrl : 0,
+
+module @route_control_packets {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3) {ctrl}
+  %t24 = AIE.tile(2, 4) {ctrl}
+  %t70 = AIE.tile(7, 0)
+  %t71 = AIE.tile(7, 1)
+  AIE.packet_flow(0) {
+    AIE.packet_source<%t70, DMA : 0>
+    AIE.packet_dest<%t71, Core : 0>
+  }
+ }
+}
@@ -0,0 +1,36 @@
+//===- route_control_packets_broadcast.mlir --------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-route-control-packets="broadcast-elfs=true" %s | FileCheck %s
+
+// The cores of (2, 3) and (2, 4) load the same ELF file, which is broadcast
+// to both with one more packet flow.  The core of (2, 5) loads its own.
+
+// CHECK:     %[[SHIM:.*]] = AIE.tile(2, 0)
+// CHECK:     %[[T23:.*]] = AIE.tile(2, 3) {ctrl_broadcast_id = 3 : i32, ctrl_packet_id = 0 : i32}
+// CHECK:     %[[T24:.*]] = AIE.tile(2, 4) {ctrl_broadcast_id = 3 : i32, ctrl_packet_id = 1 : i32}
+// CHECK:     %[[T25:.*]] = AIE.tile(2, 5) {ctrl_packet_id = 2 : i32}
+// CHECK:     AIE.packet_flow(3) {
+// CHECK-NEXT:  AIE.packet_source<%[[SHIM]], DMA : 1>
+// CHECK-NEXT:  AIE.packet_dest<%[[T23]], Ctrl : 0>
+// CHECK-NEXT:  AIE.packet_dest<%[[T24]], Ctrl : 0>
+// CHECK-NEXT: }
+// CHECK-NOT: AIE.packet_flow
+
+module @route_control_packets_broadcast {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3) {ctrl}
+  %t24 = AIE.tile(2, 4) {ctrl}
+  %t25 = AIE.tile(2, 5) {ctrl}
+  %c23 = AIE.core(%t23) { AIE.end } { elf_file = "kernel.elf" }
+  %c24 = AIE.core(%t24) { AIE.end } { elf_file = "kernel.elf" }
+  %c25 = AIE.core(%t25) { AIE.end }
+ }
+}
@@ -0,0 +1,45 @@
+//===- route_trace.mlir ----------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-route-trace %s | FileCheck %s
+// RUN: aie-opt --aie-route-trace --aie-create-packet-flows %s | FileCheck %s --check-prefix=ROUTED
+
+// The core and memory modules of the core tile and the shim tile are traced
+// to the first shim DMA, with the IDs following the one of the design.
+
+// CHECK:     %[[SHIM:.*]] = AIE.tile(2, 0)
+// CHECK:     %[[T23:.*]] = AIE.tile(2, 3) {trace_packet_ids = array<i32: 1, 2>}
+// CHECK:     %[[T70:.*]] = AIE.tile(7, 0) {trace_packet_ids = array<i32: 3>}
+// CHECK:     AIE.packet_flow(0) {
+// CHECK:     AIE.packet_flow(1) {
+// CHECK-NEXT:  AIE.packet_source<%[[T23]], Trace : 0>
+// CHECK-NEXT:  AIE.packet_dest<%[[SHIM]], DMA : 1>
+// CHECK:     AIE.packet_flow(2) {
+// CHECK-NEXT:  AIE.packet_source<%[[T23]], Trace : 1>
+// CHECK-NEXT:  AIE.packet_dest<%[[SHIM]], DMA : 1>
+// CHECK:     AIE.packet_flow(3) {
+// CHECK-NEXT:  AIE.packet_source<%[[T70]], Trace : 0>
+// CHECK-NEXT:  AIE.packet_dest<%[[SHIM]], DMA : 1>
+// CHECK-NOT: AIE.packet_flow
+
+// ROUTED-DAG: AIE.packetrules(Trace : 0) {
+// ROUTED-DAG: AIE.packetrules(Trace : 1) {
+
+module @route_trace {
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3) {trace}
+  %t70 = AIE.tile(7, 0) {trace}
+  %t71 = AIE.tile(7, 1)
+  AIE.packet_flow(0) {
+    AIE.packet_source<%t70, DMA : 0>
+    AIE.packet_dest<%t71, Core : 0>
+  }
+ }
+}
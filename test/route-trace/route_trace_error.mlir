@@ -0,0 +1,20 @@
+//===- route_trace_error.mlir ----------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-route-trace="shim-col=1" --verify-diagnostics %s
+
+// Column 1 of the device has a shim PL tile, without a DMA.
+
+module @route_trace_error {
+  // expected-error@+1 {{no shim NOC tile in column 1 to route the trace to}}
+ AIE.device(xcvc1902) {
+  %t23 = AIE.tile(2, 3) {trace}
+ }
+}
@@ -0,0 +1,82 @@
+//===- explore.mlir --------------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-tile-kernels="explore=true" --verify-diagnostics -split-input-file %s | FileCheck %s
+
+// The adds are bound by the DMAs, which move each element once whatever the
+// tiles: the fewest tiles fitting double buffered win, and among them the
+// contiguous tiles of two whole rows.
+
+// CHECK-LABEL: module @add2d {
+// CHECK:   AIE.external_buffer {sym_name = "add2d_arg0"} : memref<16x1024xi32>
+// CHECK:   AIE.objectFifo @add2d_arg0_in({{.*}}, 2 : i32) : !AIE.objectFifo<memref<2x1024xi32>>
+// CHECK:   AIE.objectFifo @add2d_arg1_in({{.*}}, 2 : i32) : !AIE.objectFifo<memref<2x1024xi32>>
+// CHECK:   AIE.objectFifo @add2d_arg2_out({{.*}}, 2 : i32) : !AIE.objectFifo<memref<2x1024xi32>>
+// CHECK:   func.func @add2d_tile(%{{.*}}: memref<2x1024xi32>, %{{.*}}: memref<2x1024xi32>, %{{.*}}: memref<2x1024xi32>) {
+// CHECK:   AIE.core(%{{.*}}) {
+// CHECK:     %[[C8:.*]] = arith.constant 8 : index
+// CHECK:     scf.for %{{.*}} = %{{.*}} to %[[C8]]
+
+module @add2d {
+  AIE.device(xcve2302) {
+    // expected-remark@+1 {{tiles 2x1024 of add2d with objectFifo depths 2, 2, 2: estimated 16384 cycles, 196608 bytes moved}}
+    func.func @add2d(%A: memref<16x1024xi32>, %B: memref<16x1024xi32>, %C: memref<16x1024xi32>) attributes {aie.tile_kernel} {
+      affine.for %i = 0 to 16 {
+        affine.for %j = 0 to 1024 {
+          %a = affine.load %A[%i, %j] : memref<16x1024xi32>
+          %b = affine.load %B[%i, %j] : memref<16x1024xi32>
+          %c = arith.addi %a, %b : i32
+          affine.store %c, %C[%i, %j] : memref<16x1024xi32>
+        }
+      }
+      return
+    }
+  }
+}
+
+// -----
+
+// The matmul is bound by the core with four tiles.  Tiling the rows only
+// moves each element once: B is sent a single time, in an objectFifo of
+// depth one.
+
+// CHECK-LABEL: module @matmul {
+// CHECK:   AIE.objectFifo @matmul_arg0_in({{.*}}, 2 : i32) : !AIE.objectFifo<memref<16x64xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg1_in({{.*}}, 1 : i32) : !AIE.objectFifo<memref<64x64xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg2_in({{.*}}, 2 : i32) : !AIE.objectFifo<memref<16x64xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg2_out({{.*}}, 2 : i32) : !AIE.objectFifo<memref<16x64xi32>>
+// CHECK:   AIE.core(%{{.*}}) {
+// CHECK:     AIE.objectFifo.acquire @matmul_arg1_in(Consume, 1)
+// CHECK:     scf.for
+// CHECK:       AIE.objectFifo.acquire @matmul_arg0_in(Consume, 1)
+// CHECK:       func.call @matmul_tile(
+// CHECK:     }
+// CHECK:     AIE.objectFifo.release @matmul_arg1_in(Consume, 1)
+
+module @matmul {
+  AIE.device(xcve2302) {
+    // expected-remark@+1 {{tiles 16x64x64 of matmul with objectFifo depths 2, 1, 2: estimated 16640 cycles, 65536 bytes moved}}
+    func.func @matmul(%A: memref<64x64xi32>, %B: memref<64x64xi32>, %C: memref<64x64xi32>) attributes {aie.tile_kernel} {
+      affine.for %i = 0 to 64 {
+        affine.for %j = 0 to 64 {
+          affine.for %k = 0 to 64 {
+            %a = affine.load %A[%i, %k] : memref<64x64xi32>
+            %b = affine.load %B[%k, %j] : memref<64x64xi32>
+            %c = affine.load %C[%i, %j] : memref<64x64xi32>
+            %p = arith.muli %a, %b : i32
+            %s = arith.addi %c, %p : i32
+            affine.store %s, %C[%i, %j] : memref<64x64xi32>
+          }
+        }
+      }
+      return
+    }
+  }
+}
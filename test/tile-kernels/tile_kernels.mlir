@@ -0,0 +1,135 @@
+//===- tile_kernels.mlir ---------------------------------------*- MLIR -*-===//
+//
+// This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// (c) Copyright 2023 Advanced Micro Devices, Inc.
+//
+//===----------------------------------------------------------------------===//
+
+// RUN: aie-opt --aie-tile-kernels --verify-diagnostics -split-input-file %s | FileCheck %s
+
+// The three 16x1024xi32 arrays need 384 KB double buffered: the columns are
+// tiled by 128.  The shim DMA walks the 8 tiles of 16 rows of 128 words.
+
+// CHECK-LABEL: module @add2d {
+// CHECK:   %[[SHIM:.*]] = AIE.tile(0, 0)
+// CHECK:   %[[CORE:.*]] = AIE.tile(0, 2)
+// CHECK:   %[[A:.*]] = AIE.external_buffer {sym_name = "add2d_arg0"} : memref<16384xi32>
+// CHECK:   AIE.objectFifo @add2d_arg0_in(%[[SHIM]] toStream [<128, 8>, <1024, 16>, <1, 128>], {%[[CORE]]}, 2 : i32) : !AIE.objectFifo<memref<16x128xi32>>
+// CHECK:   AIE.objectFifo.registerExternalBuffers @add2d_arg0_in(%[[SHIM]], {%[[A]]}) : (memref<16384xi32>)
+// CHECK:   AIE.objectFifo @add2d_arg1_in(%[[SHIM]] toStream [<128, 8>, <1024, 16>, <1, 128>], {%[[CORE]]}, 2 : i32)
+// CHECK:   %[[C:.*]] = AIE.external_buffer {sym_name = "add2d_arg2"} : memref<16384xi32>
+// CHECK:   AIE.objectFifo @add2d_arg2_out(%[[CORE]], {%[[SHIM]]} fromStream [<128, 8>, <1024, 16>, <1, 128>], 2 : i32) : !AIE.objectFifo<memref<16x128xi32>>
+// CHECK:   AIE.objectFifo.registerExternalBuffers @add2d_arg2_out(%[[SHIM]], {%[[C]]}) : (memref<16384xi32>)
+// CHECK:   func.func @add2d_tile(%[[TA:.*]]: memref<16x128xi32>, %[[TB:.*]]: memref<16x128xi32>, %[[TC:.*]]: memref<16x128xi32>) {
+// CHECK:     affine.for %[[I:.*]] = 0 to 16 {
+// CHECK:       affine.for %[[J:.*]] = 0 to 128 {
+// CHECK:         %[[X:.*]] = affine.load %[[TA]][%[[I]], %[[J]]] : memref<16x128xi32>
+// CHECK:         %[[Y:.*]] = affine.load %[[TB]][%[[I]], %[[J]]] : memref<16x128xi32>
+// CHECK:         %[[S:.*]] = arith.addi %[[X]], %[[Y]] : i32
+// CHECK:         affine.store %[[S]], %[[TC]][%[[I]], %[[J]]] : memref<16x128xi32>
+// CHECK:   AIE.core(%[[CORE]]) {
+// CHECK:     scf.for
+// CHECK:       AIE.objectFifo.acquire @add2d_arg0_in(Consume, 1)
+// CHECK:       AIE.objectFifo.acquire @add2d_arg1_in(Consume, 1)
+// CHECK:       AIE.objectFifo.acquire @add2d_arg2_out(Produce, 1)
+// CHECK:       func.call @add2d_tile(
+// CHECK:       AIE.objectFifo.release @add2d_arg0_in(Consume, 1)
+// CHECK:       AIE.objectFifo.release @add2d_arg1_in(Consume, 1)
+// CHECK:       AIE.objectFifo.release @add2d_arg2_out(Produce, 1)
+// CHECK:     }
+// CHECK:     AIE.end
+// CHECK-NOT: func.func @add2d(
+
+module @add2d {
+  AIE.device(xcve2302) {
+    func.func @add2d(%A: memref<16x1024xi32>, %B: memref<16x1024xi32>, %C: memref<16x1024xi32>) attributes {aie.tile_kernel} {
+      affine.for %i = 0 to 16 {
+        affine.for %j = 0 to 1024 {
+          %a = affine.load %A[%i, %j] : memref<16x1024xi32>
+          %b = affine.load %B[%i, %j] : memref<16x1024xi32>
+          %c = arith.addi %a, %b : i32
+          affine.store %c, %C[%i, %j] : memref<16x1024xi32>
+        }
+      }
+      return
+    }
+  }
+}
+
+// -----
+
+// The rows and the columns of the 64x64 result are tiled by 32, the
+// reduction loop stays whole.  The tiles of A are contiguous, the ones of B
+// are sent once per row of tiles and the ones of C need four dimensions.
+
+// CHECK-LABEL: module @matmul {
+// CHECK:   AIE.external_buffer {sym_name = "matmul_arg0"} : memref<64x64xi32>
+// CHECK:   AIE.objectFifo @matmul_arg0_in({{.*}}) : !AIE.objectFifo<memref<32x64xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg1_in({{.*}}) : !AIE.objectFifo<memref<64x32xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg2_in({{.*}}) : !AIE.objectFifo<memref<32x32xi32>>
+// CHECK:   AIE.objectFifo @matmul_arg2_out({{.*}}) : !AIE.objectFifo<memref<32x32xi32>>
+// CHECK:   func.func @matmul_tile(%{{.*}}: memref<32x64xi32>, %{{.*}}: memref<64x32xi32>, %{{.*}}: memref<32x32xi32>) {
+// CHECK:     affine.for %{{.*}} = 0 to 32 {
+// CHECK:       affine.for %{{.*}} = 0 to 32 {
+// CHECK:         affine.for %{{.*}} = 0 to 64 {
+// CHECK:   AIE.core(%{{.*}}) {
+// CHECK:     scf.for
+// CHECK:       %[[SA:.*]] = AIE.objectFifo.acquire @matmul_arg0_in(Consume, 1)
+// CHECK:       scf.for
+// CHECK:         AIE.objectFifo.acquire @matmul_arg1_in(Consume, 1)
+// CHECK:         %[[SC:.*]] = AIE.objectFifo.acquire @matmul_arg2_out(Produce, 1)
+// CHECK:         %[[OUT:.*]] = AIE.objectFifo.subview.access %[[SC]][0]
+// CHECK:         %[[SI:.*]] = AIE.objectFifo.acquire @matmul_arg2_in(Consume, 1)
+// CHECK:         %[[IN:.*]] = AIE.objectFifo.subview.access %[[SI]][0]
+// CHECK:         memref.copy %[[IN]], %[[OUT]]
+// CHECK:         AIE.objectFifo.release @matmul_arg2_in(Consume, 1)
+// CHECK:         func.call @matmul_tile(
+// CHECK:         AIE.objectFifo.release @matmul_arg1_in(Consume, 1)
+// CHECK:         AIE.objectFifo.release @matmul_arg2_out(Produce, 1)
+// CHECK:       }
+// CHECK:       AIE.objectFifo.release @matmul_arg0_in(Consume, 1)
+
+module @matmul {
+  AIE.device(xcve2302) {
+    func.func @matmul(%A: memref<64x64xi32>,
+                      // expected-remark@+1 {{the shim DMA cannot walk the tiles of argument 1 of matmul}}
+                      %B: memref<64x64xi32>,
+                      // expected-remark@+2 {{the shim DMA cannot walk the tiles of argument 2 of matmul}}
+                      // expected-remark@+1 {{the shim DMA cannot walk the tiles of argument 2 of matmul}}
+                      %C: memref<64x64xi32>) attributes {aie.tile_kernel} {
+      affine.for %i = 0 to 64 {
+        affine.for %j = 0 to 64 {
+          affine.for %k = 0 to 64 {
+            %a = affine.load %A[%i, %k] : memref<64x64xi32>
+            %b = affine.load %B[%k, %j] : memref<64x64xi32>
+            %c = affine.load %C[%i, %j] : memref<64x64xi32>
+            %p = arith.muli %a, %b : i32
+            %s = arith.addi %c, %p : i32
+            affine.store %s, %C[%i, %j] : memref<64x64xi32>
+          }
+        }
+      }
+      return
+    }
+  }
+}
+
+// -----
+
+module @too_large {
+  AIE.device(xcve2302) {
+    // expected-error@+1 {{tile kernel does not fit in 64512 bytes of local memory}}
+    func.func @too_large(%A: memref<16384xi32>, %B: memref<16384xi32>) attributes {aie.tile_kernel} {
+      affine.for %i = 0 to 4 {
+        affine.for %j = 0 to 4 {
+          %a = affine.load %A[%i * 4096 + %j * 1024] : memref<16384xi32>
+          affine.store %a, %B[%i] : memref<16384xi32>
+        }
+      }
+      return
+    }
+  }
+}
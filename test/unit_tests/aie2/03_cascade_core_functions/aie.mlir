@@ -18,6 +18,7 @@ module {
   AIE.device(xcve2802) {
     %tile13 = AIE.tile(1, 3)
     %tile23 = AIE.tile(2, 3)
+    AIE.cascadeFlow(%tile13, %tile23)
 
     %buf13_0 = AIE.buffer(%tile13) { sym_name = "a" } : memref<256xi32>
     %buf23_0 = AIE.buffer(%tile23) { sym_name = "c" } : memref<256xi32>
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2023, Advanced Micro Devices, Inc.
+
+// REQUIRES: valid_xchess_license
+// RUN: aie-opt %s -affine-super-vectorize="virtual-vector-size=8" --convert-vector-to-aievec -lower-affine | aie-translate --aievec-to-cpp -o dut.cc
+// RUN: xchesscc_wrapper aie -f -g +s +w work +o work -I%S -I%aie_runtime_lib%/AIE -I %aietools/include -I. %S/testbench.cc dut.cc
+// RUN: xca_udm_dbg -qf -T -P %aietools/data/versal_prod/lib -t "%S/../profiling.tcl ./work/a.out" >& xca_udm_dbg.stdout
+// RUN: FileCheck --input-file=./xca_udm_dbg.stdout %s
+// CHECK: TEST PASSED
+
+module {
+  func.func @dut(%arg0: memref<1024xf32>, %arg1: memref<1024xf32>) {
+    affine.for %arg3 = 0 to 1024 {
+      %0 = affine.load %arg0[%arg3] : memref<1024xf32>
+      %1 = math.erf %0 : f32
+      affine.store %1, %arg1[%arg3] : memref<1024xf32>
+    }
+    return
+  }
+}
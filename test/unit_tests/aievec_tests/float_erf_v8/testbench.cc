@@ -0,0 +1,44 @@
+// The common testbench.h is written for the types of AIE2, this one only
+// needs float.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+constexpr unsigned const IN0_SIZE = 1024;
+constexpr unsigned const OUT0_SIZE = 1024;
+
+void dut(float *restrict in0, float *restrict out0);
+
+alignas(32) float g_in0[IN0_SIZE];
+alignas(32) float g_out0[OUT0_SIZE];
+
+int main(int argc, char *argv[]) {
+  srand(10);
+  for (unsigned k = 0; k < IN0_SIZE; k += 1)
+    g_in0[k] = 8.0f * rand() / RAND_MAX - 4.0f;
+
+  chess_memory_fence();
+  auto cyclesBegin = chess_cycle_count();
+  dut(g_in0, g_out0);
+  auto cyclesEnd = chess_cycle_count();
+  chess_memory_fence();
+  printf("Cycle count: %d\n", (int)(cyclesEnd - cyclesBegin));
+
+  unsigned errors = 0;
+  for (unsigned k = 0; k < OUT0_SIZE; k += 1) {
+    float ref = erff(g_in0[k]);
+    if (fabsf(g_out0[k] - ref) <= 1e-5f)
+      continue;
+    if (errors < 10)
+      printf("Mismatch at item %u: expected %a but got %a\n", k, ref,
+             g_out0[k]);
+    errors++;
+  }
+
+  if (errors == 0)
+    printf("TEST PASSED\n");
+  else
+    printf("TEST FAILED\n");
+
+  return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+aie-bench - sweep the parameters of benchmarks and collect their statistics
+
+A benchmark is a directory holding a bench.json file, a test.cpp host
+program and the design, either as an aie.mlir.in template or as a gen.py
+script printing it.  bench.json gives the name of the benchmark and the
+values of its parameters to sweep, e.g.
+  {"name": "fill_rate", "params": {"size": [1024, 4096], "flows": [1]}}
+For each configuration of the sweep, the design is generated with the
+{param} fields of the template replaced, or with gen.py called with
+--param value for each parameter, and a bench_params.h header defines each
+parameter in upper case for test.cpp.  The design is compiled and run, on a
+board or in aiesimulator, by the compile and run commands, and the JSON
+lines printed by mlir_aie_write_stats_json are collected.
+
+The results are written as JSON records or as CSV.  With --baseline, they
+are compared with the results of an earlier run, and the statistics which
+got slower by more than the tolerance are reported as regressions.
+"""
+
+import argparse
+import csv
+import itertools
+import json
+import os
+import shlex
+import subprocess
+import sys
+
+STATS = ['n', 'outliers', 'min', 'max', 'mean', 'sdev', 'p50', 'p90', 'p99']
+
+
+def parse_args(args=None):
+    parser = argparse.ArgumentParser(
+        prog='aie-bench',
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('benchmarks', metavar='dir', nargs='+',
+                        help='benchmark directories')
+    parser.add_argument('--param', action='append', default=[],
+                        metavar='NAME=V1,V2,...',
+                        help='values to sweep for a parameter, instead of '
+                        'the ones of bench.json')
+    parser.add_argument('--compile',
+                        default='aiecc.py {mlir} -I{dir} {cpp} -o {elf}',
+                        help='shell command compiling {mlir} and {cpp} to '
+                        '{elf}, run in the directory {dir} of the '
+                        'configuration (default: %(default)s)')
+    parser.add_argument('--run', default='{elf}',
+                        help='shell command running {elf} and printing its '
+                        'statistics (default: %(default)s)')
+    parser.add_argument('--workdir', default='aie-bench',
+                        help='directory of the configurations '
+                        '(default: %(default)s)')
+    parser.add_argument('-o', dest='output', default=None,
+                        help='write the results here, as JSON')
+    parser.add_argument('--csv', default=None,
+                        help='write the results here, as CSV')
+    parser.add_argument('--baseline', default=None,
+                        help='JSON results of an earlier run to compare with')
+    parser.add_argument('--metric', default='p50', choices=STATS,
+                        help='statistic compared with the baseline '
+                        '(default: %(default)s)')
+    parser.add_argument('--tolerance', type=float, default=5.0,
+                        help='percentage by which the metric may grow over '
+                        'the baseline (default: %(default)s)')
+    parser.add_argument('-v', dest='verbose', action='store_true',
+                        help='print the commands run')
+    return parser.parse_args(args)
+
+
+def parse_values(text):
+    values = []
+    for v in text.split(','):
+        try:
+            values.append(int(v, 0))
+        except ValueError:
+            values.append(v)
+    return values
+
+
+def configurations(params):
+    names = sorted(params)
+    for values in itertools.product(*(params[n] for n in names)):
+        yield dict(zip(names, values))
+
+
+def describe(config):
+    return ' '.join('%s=%s' % (k, config[k]) for k in sorted(config))
+
+
+def substitute(text, fields):
+    for key, value in fields.items():
+        text = text.replace('{%s}' % key, str(value))
+    return text
+
+
+class Bench:
+    def __init__(self, opts):
+        self.opts = opts
+
+    def shell(self, command, cwd):
+        if self.opts.verbose:
+            print(command)
+        return subprocess.run(command, cwd=cwd, shell=True,
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              universal_newlines=True)
+
+    def generate(self, bench_dir, config, cwd):
+        """Writes the design and the parameter header of config in cwd.
+        Returns the design file, or None and an error message."""
+        mlir = os.path.join(cwd, 'aie.mlir')
+        template = os.path.join(bench_dir, 'aie.mlir.in')
+        generator = os.path.join(bench_dir, 'gen.py')
+        if os.path.exists(template):
+            with open(template) as f:
+                text = substitute(f.read(), config)
+        elif os.path.exists(generator):
+            command = [sys.executable, generator]
+            for k in sorted(config):
+                command += ['--' + k, str(config[k])]
+            result = subprocess.run(command, stdout=subprocess.PIPE,
+                                    stderr=subprocess.PIPE,
+                                    universal_newlines=True)
+            if result.returncode:
+                return None, result.stderr
+            text = result.stdout
+        else:
+            return None, 'no aie.mlir.in nor gen.py in ' + bench_dir
+        with open(mlir, 'w') as f:
+            f.write(text)
+        with open(os.path.join(cwd, 'bench_params.h'), 'w') as f:
+            for k in sorted(config):
+                f.write('#define %s %s\n' % (k.upper(), config[k]))
+        return mlir, None
+
+    def measure(self, bench_dir, config, cwd):
+        """Generates, compiles and runs config. Returns the statistics
+        printed, or None and an error message."""
+        os.makedirs(cwd, exist_ok=True)
+        mlir, error = self.generate(bench_dir, config, cwd)
+        if mlir is None:
+            return None, error
+        fields = dict(config, mlir=mlir, dir=cwd,
+                      cpp=os.path.join(os.path.abspath(bench_dir), 'test.cpp'),
+                      elf=os.path.join(cwd, 'test.elf'))
+        for step in ['compile', 'run']:
+            result = self.shell(substitute(getattr(self.opts, step), fields),
+                                cwd)
+            if result.returncode:
+                return None, '%s failed:\n%s' % (step, result.stdout)
+        stats = []
+        for line in result.stdout.splitlines():
+            line = line.strip()
+            if line.startswith('{') and '"name"' in line:
+                try:
+                    stats.append(json.loads(line))
+                except ValueError:
+                    pass
+        if not stats:
+            return None, 'no statistics in the output:\n' + result.stdout
+        return stats, None
+
+    def sweep(self, bench_dir, overrides):
+        with open(os.path.join(bench_dir, 'bench.json')) as f:
+            spec = json.load(f)
+        name = spec.get('name', os.path.basename(os.path.normpath(bench_dir)))
+        params = dict(spec.get('params', {}))
+        params.update(overrides)
+        records, failed = [], 0
+        for i, config in enumerate(configurations(params)):
+            cwd = os.path.abspath(os.path.join(self.opts.workdir,
+                                               '%s-%d' % (name, i)))
+            stats, error = self.measure(bench_dir, config, cwd)
+            if stats is None:
+                print('%s %s: error: %s' % (name, describe(config), error),
+                      file=sys.stderr)
+                failed += 1
+                continue
+            for s in stats:
+                record = {'benchmark': name, 'params': config}
+                record.update(s)
+                records.append(record)
+                print('%s %s %s: %s=%s' % (name, describe(config), s['name'],
+                                          self.opts.metric,
+                                          s.get(self.opts.metric)))
+        return records, failed
+
+
+def key(record):
+    return (record['benchmark'], describe(record['params']), record['name'])
+
+
+def compare(records, baseline, metric, tolerance):
+    """Prints the records slower than in the baseline, returns their number"""
+    before = {key(r): r for r in baseline}
+    regressions = 0
+    for r in records:
+        old = before.get(key(r))
+        if old is None or metric not in old or metric not in r:
+            continue
+        if r[metric] > old[metric] * (1 + tolerance / 100.0):
+            print('REGRESSION %s %s %s: %s %s -> %s' %
+                  (r['benchmark'], describe(r['params']), r['name'], metric,
+                   old[metric], r[metric]))
+            regressions += 1
+    return regressions
+
+
+def write_csv(path, records):
+    params = sorted({p for r in records for p in r['params']})
+    with open(path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['benchmark'] + params + ['name'] + STATS)
+        for r in records:
+            writer.writerow([r['benchmark']] +
+                            [r['params'].get(p, '') for p in params] +
+                            [r['name']] + [r.get(s, '') for s in STATS])
+
+
+def main(args=None):
+    opts = parse_args(args)
+    overrides = {}
+    for spec in opts.param:
+        name, _, values = spec.partition('=')
+        overrides[name] = parse_values(values)
+
+    bench = Bench(opts)
+    records, failed = [], 0
+    for bench_dir in opts.benchmarks:
+        r, f = bench.sweep(bench_dir, overrides)
+        records += r
+        failed += f
+
+    if opts.output:
+        with open(opts.output, 'w') as f:
+            json.dump(records, f, indent=1)
+    if opts.csv:
+        write_csv(opts.csv, records)
+    regressions = 0
+    if opts.baseline:
+        with open(opts.baseline) as f:
+            regressions = compare(records, json.load(f), opts.metric,
+                                  opts.tolerance)
+    return 1 if failed or regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+aie-compile-bench - time the compiler passes on synthetic designs
+
+For each size COLSxROWS, a synthetic xcvc1902 design is generated with one
+core per tile, circuit-switched flows between the DMAs of the tiles,
+objectFifos of varying depths between vertically adjacent cores, which
+acquire and release them in loops, packet flows between the Core ports and
+buffers in each tile.  Each pipeline is run on each design, and its wall
+time, peak memory and, for aie-opt, the time of each pass reported by
+-mlir-timing are collected.
+
+The results are written as JSON records, and can be compared with the ones
+of an earlier run: the pipelines which got slower or bigger by more than the
+tolerance are reported as regressions.  The growth of the time of each
+pipeline with the number of cores is printed as an exponent, so that the
+superlinear passes show up before their designs get too large.
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import shlex
+import subprocess
+import sys
+import time
+
+PIPELINES = {
+    'pathfinder': 'aie-opt --aie-create-pathfinder-flows {mlir} -o /dev/null',
+    'objectfifo':
+    'aie-opt --aie-objectFifo-stateful-transform {mlir} -o /dev/null',
+    'packet': 'aie-opt --aie-create-packet-flows {mlir} -o /dev/null',
+    'buffers': 'aie-opt --aie-assign-buffer-addresses {mlir} -o /dev/null',
+    'aiecc': 'aiecc.py --no-compile --no-compile-host --no-link '
+    '--tmpdir {dir}/aiecc {mlir}',
+}
+DEFAULT_PIPELINES = 'pathfinder,objectfifo,packet,buffers'
+
+# The locks of an AIE1 tile, shared by the elements of the objectFifos it
+# produces.
+TILE_LOCKS = 16
+# The packet IDs the generated packet flows use.
+PACKET_IDS = 32
+
+TIMING = re.compile(r'^\s*([0-9.]+) \(\s*[0-9.]+%\)\s+(\S.*)$')
+
+
+def parse_size(text):
+    cols, _, rows = text.partition('x')
+    return int(cols), int(rows)
+
+
+def parse_args(args=None):
+    parser = argparse.ArgumentParser(
+        prog='aie-compile-bench',
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--sizes', default='2x2,4x4,8x8,16x8,32x8',
+                        help='comma-separated COLSxROWS sizes of the designs '
+                        '(default: %(default)s)')
+    parser.add_argument('--flows', type=int, default=-1,
+                        help='number of flows, one per core by default')
+    parser.add_argument('--fifos', type=int, default=-1,
+                        help='number of objectFifos, one per pair of '
+                        'vertically adjacent cores by default')
+    parser.add_argument('--max-depth', type=int, default=4,
+                        help='the depths of the objectFifos go from 1 to this '
+                        '(default: %(default)s)')
+    parser.add_argument('--packet-flows', type=int, default=-1,
+                        help='number of packet flows, one per two cores up to '
+                        '%d by default' % PACKET_IDS)
+    parser.add_argument('--buffers', type=int, default=2,
+                        help='number of buffers per tile '
+                        '(default: %(default)s)')
+    parser.add_argument('--emit', metavar='COLSxROWS', default=None,
+                        help='print the design of this size and exit')
+    parser.add_argument('--pipelines', default=DEFAULT_PIPELINES,
+                        help='comma-separated pipelines to run, among %s '
+                        '(default: %%(default)s)' % ', '.join(PIPELINES))
+    parser.add_argument('--pipeline', action='append', default=[],
+                        metavar='NAME=COMMAND',
+                        help='define or redefine a pipeline, as a command '
+                        'running on {mlir} in the directory {dir}')
+    parser.add_argument('--workdir', default='aie-compile-bench',
+                        help='directory of the designs (default: %(default)s)')
+    parser.add_argument('-o', dest='output', default=None,
+                        help='write the results here, as JSON')
+    parser.add_argument('--baseline', default=None,
+                        help='JSON results of an earlier run to compare with')
+    parser.add_argument('--tolerance', type=float, default=10.0,
+                        help='percentage by which the time and the peak '
+                        'memory may grow over the baseline '
+                        '(default: %(default)s)')
+    parser.add_argument('-v', dest='verbose', action='store_true',
+                        help='print the commands run')
+    return parser.parse_args(args)
+
+
+class Design:
+    """The counts of the ops of a synthetic design of cols x rows cores."""
+
+    def __init__(self, cols, rows, opts):
+        self.cols, self.rows = cols, rows
+        self.tiles = [(c, r) for c in range(1, cols + 1)
+                      for r in range(1, rows + 1)]
+        n = len(self.tiles)
+        self.pairs = [(c, r) for c, r in self.tiles if r < rows]
+        # Each flow takes a DMA channel at both ends, and each tile has two.
+        self.flows = min(n if opts.flows < 0 else opts.flows, 2 * n)
+        depths = max(1, opts.max_depth)
+        maxFifos = len(self.pairs) * max(1, TILE_LOCKS // depths)
+        self.fifos = min(len(self.pairs) if opts.fifos < 0 else opts.fifos,
+                         maxFifos)
+        self.depths = depths
+        packets = min(PACKET_IDS, n // 2) if opts.packet_flows < 0 \
+            else opts.packet_flows
+        self.packet_flows = min(packets, PACKET_IDS) if n > 1 else 0
+        self.buffers = opts.buffers
+
+    def name(self):
+        return '%dx%d' % (self.cols, self.rows)
+
+    def params(self):
+        return {'cols': self.cols, 'rows': self.rows, 'flows': self.flows,
+                'fifos': self.fifos, 'packet_flows': self.packet_flows,
+                'buffers': self.buffers}
+
+    def emit(self):
+        tiles, n = self.tiles, len(self.tiles)
+        tile = lambda t: '%%t%d_%d' % t
+        out = ['// %s cores, %d flows, %d objectFifos, %d packet flows' %
+               (self.name(), self.flows, self.fifos, self.packet_flows),
+               'module @compile_bench_%s {' % self.name(),
+               '  AIE.device(xcvc1902) {']
+        for t in tiles:
+            out.append('    %s = AIE.tile(%d, %d)' % ((tile(t),) + t))
+        for t in tiles:
+            for b in range(self.buffers):
+                out.append('    %%buf%d_%d_%d = AIE.buffer(%s) : '
+                           'memref<64xi32>' % (t + (b, tile(t))))
+
+        # Flow k leaves channel k / n of tile k % n, for the same channel of
+        # the tile half the array away, so that no two flows share a port.
+        for k in range(self.flows):
+            src, channel = tiles[k % n], k // n
+            dst = tiles[(k % n + max(1, n // 2)) % n]
+            out.append('    AIE.flow(%s, DMA : %d, %s, DMA : %d)' %
+                       (tile(src), channel, tile(dst), channel))
+
+        for p in range(self.packet_flows):
+            src = tiles[p % n]
+            dst = tiles[(p % n + 1) % n]
+            out += ['    AIE.packet_flow(%d) {' % p,
+                    '      AIE.packet_source<%s, Core : 0>' % tile(src),
+                    '      AIE.packet_dest<%s, Core : 0>' % tile(dst),
+                    '    }']
+
+        # ObjectFifo i goes from the tile of pair i % pairs to the one above.
+        uses = {t: [] for t in tiles}
+        for i in range(self.fifos):
+            c, r = self.pairs[i % len(self.pairs)]
+            depth = 1 + i % self.depths
+            out.append('    AIE.objectFifo @of%d (%s, {%s}, %d : i32) : '
+                       '!AIE.objectFifo<memref<16xi32>>' %
+                       (i, tile((c, r)), tile((c, r + 1)), depth))
+            uses[(c, r)].append((i, 'Produce'))
+            uses[(c, r + 1)].append((i, 'Consume'))
+
+        for t in tiles:
+            out.append('    %%core%d_%d = AIE.core(%s) {' % (t + (tile(t),)))
+            if uses[t]:
+                out += ['      %c0 = arith.constant 0 : index',
+                        '      %c1 = arith.constant 1 : index',
+                        '      %c8 = arith.constant 8 : index',
+                        '      scf.for %iv = %c0 to %c8 step %c1 {']
+                for i, port in uses[t]:
+                    out += ['        %%sub%d = AIE.objectFifo.acquire @of%d '
+                            '(%s, 1) : !AIE.objectFifoSubview<memref<16xi32>>'
+                            % (i, i, port),
+                            '        AIE.objectFifo.release @of%d (%s, 1)' %
+                            (i, port)]
+                out.append('      }')
+            out += ['      AIE.end', '    }']
+        out += ['  }', '}']
+        return '\n'.join(out) + '\n'
+
+
+def run(command, cwd, verbose):
+    """Runs command, returns its status, wall time, peak memory in KB, the
+    times of the passes it reported and its output."""
+    if verbose:
+        print(command)
+    start = time.monotonic()
+    proc = subprocess.Popen(command, cwd=cwd, shell=True,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    output = proc.stdout.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    seconds = time.monotonic() - start
+    proc.returncode = os.waitstatus_to_exitcode(status) \
+        if hasattr(os, 'waitstatus_to_exitcode') else status
+    passes = {}
+    for line in output.splitlines():
+        m = TIMING.match(line)
+        if m and m.group(2) != 'Total':
+            name = m.group(2).strip()
+            passes[name] = passes.get(name, 0.0) + float(m.group(1))
+    return proc.returncode, seconds, usage.ru_maxrss, passes, output
+
+
+def command_of(template, mlir, cwd):
+    command = template.replace('{mlir}', shlex.quote(mlir)).replace(
+        '{dir}', shlex.quote(cwd))
+    if template.startswith('aie-opt '):
+        command += ' -mlir-timing -mlir-timing-display=list'
+    return command
+
+
+def key(record):
+    return (record['design'], record['pipeline'])
+
+
+def compare(records, baseline, tolerance):
+    """Prints the records slower or bigger than in the baseline, returns
+    their number"""
+    before = {key(r): r for r in baseline}
+    regressions = 0
+    for r in records:
+        old = before.get(key(r))
+        if old is None:
+            continue
+        for metric in ['seconds', 'peak_rss_kb']:
+            if r[metric] > old[metric] * (1 + tolerance / 100.0):
+                print('REGRESSION %s %s: %s %s -> %s' %
+                      (r['design'], r['pipeline'], metric, old[metric],
+                       r[metric]))
+                regressions += 1
+    return regressions
+
+
+def print_growth(records):
+    """Prints how the time of each pipeline grows with the number of cores,
+    as the exponent between the smallest and the largest design."""
+    by_pipeline = {}
+    for r in records:
+        cores = r['params']['cols'] * r['params']['rows']
+        by_pipeline.setdefault(r['pipeline'], []).append((cores, r['seconds']))
+    for pipeline, points in by_pipeline.items():
+        points.sort()
+        (n0, t0), (n1, t1) = points[0], points[-1]
+        if n1 > n0 and t0 > 0 and t1 > 0:
+            print('%s: time grows as cores^%.2f' %
+                  (pipeline, math.log(t1 / t0) / math.log(n1 / n0)))
+
+
+def main(args=None):
+    opts = parse_args(args)
+    if opts.emit:
+        sys.stdout.write(Design(*parse_size(opts.emit), opts).emit())
+        return 0
+
+    pipelines = dict(PIPELINES)
+    for spec in opts.pipeline:
+        name, _, command = spec.partition('=')
+        pipelines[name] = command
+    names = opts.pipelines.split(',')
+    for name in names:
+        if name not in pipelines:
+            print('error: unknown pipeline ' + name, file=sys.stderr)
+            return 1
+
+    records, failed = [], 0
+    for size in opts.sizes.split(','):
+        design = Design(*parse_size(size), opts)
+        cwd = os.path.abspath(os.path.join(opts.workdir, design.name()))
+        os.makedirs(cwd, exist_ok=True)
+        mlir = os.path.join(cwd, 'design.mlir')
+        with open(mlir, 'w') as f:
+            f.write(design.emit())
+        for name in names:
+            status, seconds, rss, passes, output = run(
+                command_of(pipelines[name], mlir, cwd), cwd, opts.verbose)
+            if status:
+                print('%s %s: error:\n%s' % (design.name(), name, output),
+                      file=sys.stderr)
+                failed += 1
+                continue
+            print('%s %s: %.3f s, %.1f MB' %
+                  (design.name(), name, seconds, rss / 1024.0))
+            records.append({'design': design.name(), 'pipeline': name,
+                            'params': design.params(), 'seconds': seconds,
+                            'peak_rss_kb': rss, 'passes': passes})
+
+    print_growth(records)
+    if opts.output:
+        with open(opts.output, 'w') as f:
+            json.dump(records, f, indent=1)
+    regressions = 0
+    if opts.baseline:
+        with open(opts.baseline) as f:
+            regressions = compare(records, json.load(f), opts.tolerance)
+    return 1 if failed or regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,306 +1,264 @@
 # to print unicode characters, run this:
 # export PYTHONIOENCODING=utf8
 
+# Draws the switchboxes of a design, their routing demand and its routes as
+# text, from the JSON written by aie-translate --aie-flows-to-json or by
+# aie-create-pathfinder-flows="report-file=...".
+#
+# The switchboxes are drawn once and each route is laid over a copy of them,
+# so that full-device designs with hundreds of routes are drawn in seconds.
+# summary.txt has one character per switchbox giving the load of its busiest
+# direction, to find the congested areas before looking at single routes.
+
 import math
 import json
 import os, sys
 import argparse
 
-from enum import Enum
-
-class Direction(Enum):
-    Horz = 0;
-    Vert = 1;
+# the bits of a cell covered by a line: where the line starts, goes through
+# or ends, for horizontal lines, and these times 8 for vertical lines
+START = 1
+THROUGH = 2
+END = 4
+VERT = 8
+
+chars = {
+    0 : ' ',
+    2 : u'─', # horz line
+    16 : u'│',# vert line
+    9 : u'┌', # box top left
+    33 : u'└',# box bot left
+    12 : u'┐',# box top right
+    36 : u'┘',# box bot right
+    1 : u'╶', # right half horz line
+    8 : u'╷', # lower half vert line
+    32 : u'╵',# upper half vert line
+    4 : u'╴', # left half horz line
+    18 : u'┼',# vert AND horz
+    25 : u'├',# vert and right
+    17 : u'├',
+    20 : u'┤',# vert and left
+    10 : u'┬',# horz and bot
+    34 : u'┴',# horz and top
+    21 : u'┼',# vert AND horz
+    42 : u'┼'
+}
 
 
 class canvas:
     def __init__(self, width, height):
         self.width = width
         self.height = height
-        self.vert_line_list = []
-        self.horz_line_list = []
-        self.characters = []
-        
-    def direction(self, line) :
-        Horz_Stationary = False;
-        Vert_Stationary = False;
-        
-        if (line[0][0] == line[1][0]):
-            # Line Stationary in Horz Axis
-            Horz_Stationary = True
-        if (line[0][1] == line[1][1]):
-            # Line Stationary in Vert Axis
-            Vert_Stationary = True
-
-        if (Horz_Stationary and Vert_Stationary):
-            # Crash
-            raise Exception("Line is Diagonal");
-        if (not Horz_Stationary and not Vert_Stationary):
-            # Crash
-            raise Exception("Line is a dot");
-        if ((not Horz_Stationary) and Vert_Stationary):
-            return Direction.Horz;
-        
-        if (Horz_Stationary and (not Vert_Stationary)):
-            return Direction.Vert;
-        
+        # the line bits and the characters drawn on each cell
+        self.lines = {}
+        self.characters = {}
+
     def draw_character(self, point, character):
-        self.characters.append([point, character]);
+        self.characters[point] = character
 
     def replace_character(self, point, character, replacement):
-        if (self.characters.count([point, character])):
-            self.characters.remove([point, character]);
-        self.characters.append([point, replacement]);
-        
+        if self.characters.get(point) == character:
+            self.characters[point] = replacement
+
+    def _mark(self, point, bits):
+        self.lines[point] = self.lines.get(point, 0) | bits
+
     def draw_line(self, start, finish):
-        if (self.direction([start,finish]) == Direction.Vert):
-            self.vert_line_list.append([start, finish])
+        if start[0] != finish[0] and start[1] != finish[1]:
+            raise Exception("Line is Diagonal")
+        if start == finish:
+            raise Exception("Line is a dot")
+        if start[1] == finish[1]:
+            x0, x1 = sorted((start[0], finish[0]))
+            self._mark((x0, start[1]), START)
+            for x in range(x0 + 1, x1):
+                self._mark((x, start[1]), THROUGH)
+            self._mark((x1, start[1]), END)
         else:
-            self.horz_line_list.append([start, finish])
-        
+            y0, y1 = sorted((start[1], finish[1]))
+            self._mark((start[0], y0), START * VERT)
+            for y in range(y0 + 1, y1):
+                self._mark((start[0], y), THROUGH * VERT)
+            self._mark((start[0], y1), END * VERT)
+
     def draw_square(self, center, size):
-        horz_origin = math.floor((center[0] + 0.5) - (size/2));
-        horz_extent = math.ceil((center[0] + 0.5) + (size/2) + 3);
-
-        vert_origin = math.floor( (center[1] + 0.5)- (size/2));
-        vert_extent =  math.ceil( (center[1] + 0.5) + (size/2));
-        
-        top_left = (horz_origin, vert_origin );
-        top_right = (horz_extent, vert_origin);
-        bottom_left = (horz_origin, vert_extent);
-        bottom_right = (horz_extent, vert_extent);
-        
+        horz_origin = math.floor((center[0] + 0.5) - (size/2))
+        horz_extent = math.ceil((center[0] + 0.5) + (size/2) + 3)
+
+        vert_origin = math.floor((center[1] + 0.5) - (size/2))
+        vert_extent = math.ceil((center[1] + 0.5) + (size/2))
+
+        top_left = (horz_origin, vert_origin)
+        top_right = (horz_extent, vert_origin)
+        bottom_left = (horz_origin, vert_extent)
+        bottom_right = (horz_extent, vert_extent)
+
         self.draw_line(top_left, top_right)
         self.draw_line(top_right, bottom_right)
         self.draw_line(bottom_left, bottom_right)
         self.draw_line(top_left, bottom_left)
 
-    def vertical_index(self,point):
-        return point[1];
-    def horizontal_index(self,point):
-        return point[0];
-        
-    def within_line(self, point, line):
-        Horz_Stationary = False;
-        Vert_Stationary = False;
-        
-        if (line[0][0] == line[1][0]):
-            # Line Stationary in Horz Axis
-            Horz_Stationary = True
-        if (line[0][1] == line[1][1]):
-            # Line Stationary in Vert Axis
-            Vert_Stationary = True
-
-       # print("HS: {}, VS: {}, {}".format(Horz_Stationary, Vert_Stationary, line));
-            
-        if (Horz_Stationary and Vert_Stationary):
-            # Crash
-            raise Exception("Line is Diagonal");
-        if (not Horz_Stationary and not Vert_Stationary):
-            # Crash
-            raise Exception("Line is a dot");
-        
-        if (Horz_Stationary and (not Vert_Stationary)):
-            # it's a vertical line
-            # Sort the tuples by Horz
-            line.sort(key=self.vertical_index);
-            start_line = ( (point[1] == line[0][1]) and (point[1] <= line[1][1]) and (point[0] == line[0][0]) )
-            in_line = ( (point[1] > line[0][1]) and (point[1] < line[1][1]) and (point[0] == line[0][0]) )
-            end_line = ( (point[1] > line[0][1]) and (point[1] == line[1][1]) and (point[0] == line[0][0]) )
-            
-            #print("Vert {}, point {}, {}".format(line, point, in_line));
-            
-        if ((not Horz_Stationary) and Vert_Stationary):
-            # it's a horizonal line
-            line.sort(key=self.horizontal_index)
-            start_line = ( (point[0] == line[0][0]) and (point[0] <= line[1][0]) and ( point[1] == line[0][1]))
-            in_line = ( (point[0] > line[0][0]) and (point[0] < line[1][0]) and ( point[1] == line[0][1]))
-            end_line = ( (point[0] > line[0][0]) and (point[0] == line[1][0]) and ( point[1] == line[0][1]))
-            #print("Horz {}, point {}, {}".format(line, point, in_line));
-
-        return (start_line, in_line, end_line)
-    
-    def find_horz_index(self,line_points):
-        index =0;
-
-        if (line_points[1]):
-            index+=2
-        else:
-            if (line_points[0]):
-                index += 1;
-            if (line_points[2]):
-                index +=4
-        return index;
-
-    def transform(self, index):
-
-        # if horz through, clear bits for horz end
-        # if vert through, clear bits for vert end
-        
-        
-        chars = {
-            0 : ' ',
-            2 : u'\u2500', # horz line
-            16 : u'\u2502',# vert line
-            9 : u'\u250c', # box top left
-            33 : u'\u2514',# box bot left
-            12 : u'\u2510',# box top right
-            36 : u'\u2518',# box bot right
-            1 : u'\u2576', # right half horz line 
-            8 : u'\u2577', # lower half vert line
-            32 : u'\u2575',# upper half vert line
-            4 : u'\u2574', # left half horz line
-            18 : u'\u253c',# vert AND horz
-            25 : u'\u251c',# vert and right
-            17 : u'\u251c',
-            20 : u'\u2524',# vert and left
-            10 : u'\u252c',# horz and bot
-            34 : u'\u2534',# horz and top
-            21 : u'\u253c',# vert AND horz
-            42 : u'\u253c'
-            
-        }
-        try:
-         char = chars[index];
-        except KeyError:
-         char = "x"
-         
-        return char
-
-    def combine(self, a, b):
-        return [ a[0] or b[0], a[1] or b[1], a[2] or b[2]];
-    
+    @staticmethod
+    def transform(bits):
+        # a line going through a cell hides the ends of the other lines
+        # in the same direction
+        horz = bits % VERT
+        vert = bits // VERT
+        if horz & THROUGH:
+            horz = THROUGH
+        if vert & THROUGH:
+            vert = THROUGH
+        return chars.get(horz + VERT * vert, "x")
+
     def rasterize(self):
-       for x in range(self.height):
-           for y in range(self.width):
-               char = "({},{})".format(y,x);
-               index = 0;
-               horz_line_points = [False, False, False];
-               vert_line_points = [False, False, False];
-
-               for charloc in self.characters:
-                   if (charloc[0][0] == y and charloc[0][1] == x):
-                       print(charloc[1], end='', sep='');
-                       index = -1;
-                       break
-               if index == 0: # not a character, either vert or horz line 
-                   for line in self.horz_line_list:
-                       horz_line_points = self.combine(horz_line_points, self.within_line((y,x),line));
-                   index += self.find_horz_index(horz_line_points)
-
-                   for line in self.vert_line_list:
-                       vert_line_points = self.combine(vert_line_points, self.within_line((y,x),line));
-                   index += 8*self.find_horz_index(vert_line_points)
-
-                   print("{}".format(self.transform(index)), end='', sep='')
-                   #print(" {} ".format(index), end='', sep='')
-   
-           print("")
+        """Return the rows of the canvas, as lists of characters."""
+        rows = [[' '] * self.width for y in range(self.height)]
+        for (x, y), bits in self.lines.items():
+            if 0 <= x < self.width and 0 <= y < self.height:
+                rows[y][x] = self.transform(bits)
+        for (x, y), character in self.characters.items():
+            if 0 <= x < self.width and 0 <= y < self.height:
+                rows[y][x] = character
+        return rows
+
+
+def overlay(base_rows, layer):
+    """Return the rows of base_rows with the characters of layer drawn over
+    them, copying only the rows layer changes."""
+    rows = list(base_rows)
+    copied = set()
+    for (x, y), character in layer.characters.items():
+        if not (0 <= y < len(rows) and 0 <= x < len(rows[y])):
+            continue
+        if y not in copied:
+            rows[y] = list(rows[y])
+            copied.add(y)
+        rows[y][x] = character
+    return "\n".join("".join(row) for row in rows)
+
 
-superscripts = {
-   # 0 : u'\u2070', 
-    0 : ' ', 
-    1 : u'\u00b9', 
-    2 : u'\u00b2', 
-    3 : u'\u00b3', 
-    4 : u'\u2074', 
-    5 : u'\u2075', 
-    6 : u'\u2076', 
-    7 : u'\u2077', 
-    8 : u'\u2078', 
-    9 : u'\u2079', 
-}
 subscripts = {
-   # 0 : u'\u2080', 
-    0 : ' ', 
-    1 : u'\u2081', 
-    2 : u'\u2082', 
-    3 : u'\u2083', 
-    4 : u'\u2084', 
-    5 : u'\u2085', 
-    6 : u'\u2086', 
-    7 : u'\u2087', 
-    8 : u'\u2088', 
-    9 : u'\u2089', 
+    0 : ' ',
+    1 : u'₁',
+    2 : u'₂',
+    3 : u'₃',
+    4 : u'₄',
+    5 : u'₅',
+    6 : u'₆',
+    7 : u'₇',
+    8 : u'₈',
+    9 : u'₉',
+}
+superscripts = {
+    0 : ' ',
+    1 : u'¹',
+    2 : u'²',
+    3 : u'³',
+    4 : u'⁴',
+    5 : u'⁵',
+    6 : u'⁶',
+    7 : u'⁷',
+    8 : u'⁸',
+    9 : u'⁹',
 }
 
-def draw_switchbox(canvas, xoffset, yoffset, source_count, destination_count,
-         northbound, southbound, eastbound, westbound, draw_demand=True, name=""):
+DIRECTIONS = ["North", "East", "South", "West"]
+# the channels in each direction when the JSON does not give them
+DEFAULT_CAPACITY = {"North": 6, "East": 4, "South": 4, "West": 4}
+
+
+def capacities(switchbox):
+    """Return the number of channels leaving switchbox in each direction."""
+    capacity = dict(DEFAULT_CAPACITY)
+    for channel in switchbox.get("channels", []):
+        capacity[channel["bundle"]] = channel["max"]
+    return capacity
+
+
+def loads(switchbox):
+    """Return the share of the channels in use in each direction."""
+    return {d: switchbox[d.lower() + "bound"] / switchbox["capacity"][d]
+            if switchbox["capacity"][d] else 0.0 for d in DIRECTIONS}
+
+
+def congestion(switchbox):
+    return max(loads(switchbox).values())
+
+
+def demand_mark(count, marks):
+    return marks[count] if count in marks else '+'
+
+
+SB_WIDTH = 10; SB_HEIGHT = 5 # distances between switchboxes
+def draw_switchbox(c, xoffset, yoffset, switchbox, name=""):
     c.draw_square((xoffset+5,yoffset+4),2)
 
     # label it
-    if len(name) > 0:
-        c.draw_character((xoffset+6,yoffset+4), name[0])
-    if len(name) > 1:
-        c.draw_character((xoffset+7,yoffset+4), name[1])
-    if len(name) > 2:
-        c.draw_character((xoffset+8,yoffset+4), name[2])
-    if len(name) > 3:
-        c.draw_character((xoffset+9,yoffset+4), name[3])
+    for i, character in enumerate(name[:4]):
+        c.draw_character((xoffset+6+i,yoffset+4), character)
 
     # draw source and destination count
-    if(source_count > 0 or destination_count > 0):
+    if switchbox['source_count'] > 0 or switchbox['destination_count'] > 0:
         c.draw_character((xoffset+7,yoffset+5), '*')
 
+    capacity = switchbox['capacity']
     # left of the switchbox (south)
-    if northbound > 0: 
+    northbound = switchbox['northbound']
+    if northbound > 0:
         c.draw_line((xoffset+10,yoffset+4), (xoffset+14,yoffset+4))
-        if(draw_demand):
-            c.draw_character((xoffset+12,yoffset+3), subscripts[northbound])
-            if(northbound > 6): # if overcapacity, mark with an 'x'            
-                c.draw_character((xoffset+10,yoffset+4), 'x')
-                #c.draw_character((xoffset+11,yoffset+4), 'x')
-                c.draw_character((xoffset+12,yoffset+4), 'x')
-    if southbound > 0: 
+        c.draw_character((xoffset+12,yoffset+3),
+                         demand_mark(northbound, subscripts))
+        if northbound > capacity['North']: # if overcapacity, mark with an 'x'
+            c.draw_character((xoffset+10,yoffset+4), 'x')
+            c.draw_character((xoffset+12,yoffset+4), 'x')
+    southbound = switchbox['southbound']
+    if southbound > 0:
         c.draw_line((xoffset+0,yoffset+5), (xoffset+4,yoffset+5))
-        if(draw_demand):
-            c.draw_character((xoffset+2,yoffset+6), superscripts[southbound])
-            if(southbound > 4): # if overcapacity, mark with an 'x'
-                c.draw_character((xoffset+1, yoffset+5), 'x')
-                #c.draw_character((xoffset+2, yoffset+5), 'x')
-                c.draw_character((xoffset+3, yoffset+5), 'x')
+        c.draw_character((xoffset+2,yoffset+6),
+                         demand_mark(southbound, superscripts))
+        if southbound > capacity['South']:
+            c.draw_character((xoffset+1, yoffset+5), 'x')
+            c.draw_character((xoffset+3, yoffset+5), 'x')
 
     # below the switchbox (east)
-    if eastbound > 0: 
+    eastbound = switchbox['eastbound']
+    if eastbound > 0:
         c.draw_line((xoffset+6,yoffset+6), (xoffset+6,yoffset+8))
-        if(draw_demand):
-            c.draw_character((xoffset+5,yoffset+7), superscripts[eastbound])
-            if(eastbound > 4): # if overcapacity, mark with an 'x'
-                c.draw_character((xoffset+6, yoffset+6), 'x')
-                #c.draw_character((xoffset+6, yoffset+7), 'x')
-                c.draw_character((xoffset+6, yoffset+8), 'x')
-    if westbound > 0: 
+        c.draw_character((xoffset+5,yoffset+7),
+                         demand_mark(eastbound, superscripts))
+        if eastbound > capacity['East']:
+            c.draw_character((xoffset+6, yoffset+6), 'x')
+            c.draw_character((xoffset+6, yoffset+8), 'x')
+    westbound = switchbox['westbound']
+    if westbound > 0:
         c.draw_line((xoffset+8,yoffset+1), (xoffset+8,yoffset+3))
-        if(draw_demand):
-            c.draw_character((xoffset+9,yoffset+2), superscripts[westbound])
-            if(westbound > 4): # if overcapacity, mark with an 'x'
-                c.draw_character((xoffset+8, yoffset+1), 'x')
-                #c.draw_character((xoffset+7, yoffset+2), 'x')
-                c.draw_character((xoffset+8, yoffset+3), 'x')
+        c.draw_character((xoffset+9,yoffset+2),
+                         demand_mark(westbound, superscripts))
+        if westbound > capacity['West']:
+            c.draw_character((xoffset+8, yoffset+1), 'x')
+            c.draw_character((xoffset+8, yoffset+3), 'x')
 
 
-SB_WIDTH = 10; SB_HEIGHT = 5 # distances between switchboxes
-def draw_switchboxes(c, switchboxes):
+def draw_switchboxes(c, switchboxes, min_col):
     for item in switchboxes:
-        draw_switchbox(c, SB_WIDTH*item['row'], SB_HEIGHT*item['col'], 
-            item['source_count'], item['destination_count'],
-            item['northbound'], item['southbound'],
-            item['eastbound'], item['westbound'], draw_demand=True,
-            name="{},{}".format(item['col'], item['row'] ))
-    
+        draw_switchbox(c, SB_WIDTH*item['row'],
+                       SB_HEIGHT*(item['col'] - min_col), item,
+                       name="{},{}".format(item['col'], item['row']))
+
 # given a route, draw arrow characters to indicate the route
 # route is a list of switchboxes, represented as int tuple coordinates
-left_arrow = u'\u2190'
-up_arrow   = u'\u2191'
-right_arrow= u'\u2192'
-down_arrow = u'\u2193'
-def draw_route(c, route):
+left_arrow = u'←'
+up_arrow   = u'↑'
+right_arrow= u'→'
+down_arrow = u'↓'
+def draw_route(c, route, in_range, min_col):
     for i in range(len(route)-1):
+        if len(route[i]) < 2: continue
         col = route[i][0][0]
         row = route[i][0][1]
+        if not in_range(col): continue
         xoffset = SB_WIDTH*row
-        yoffset = SB_HEIGHT*col
-        if len(route[i]) == 1: continue
+        yoffset = SB_HEIGHT*(col - min_col)
         dirs = route[i][1]
 
         # draw source and destination
@@ -309,48 +267,98 @@ def draw_route(c, route):
         if(i == (len(route)-2)):
             c.draw_character((xoffset+9,yoffset+5), 'D')
 
-        if(i == 0): 
+        if(i == 0):
             if(row == 0): # for routes starting in the shim, draw arrows coming from PL
                 c.draw_character((xoffset+1, yoffset+4), right_arrow)
                 c.draw_character((xoffset+2, yoffset+4), right_arrow)
                 c.draw_character((xoffset+3, yoffset+4), right_arrow)
 
-        for j in range(len(dirs)):
-            # draw indications for cores the route passes through
-            c.replace_character((xoffset+7,yoffset+5), '*', '#')
-            # 0 = North, 1 = East, 2 = South, 3 = West
-            if(dirs[j] == "North"):
+        # draw indications for cores the route passes through
+        c.draw_character((xoffset+7,yoffset+5), '#')
+        for direction in dirs:
+            if direction == "North":
                 c.draw_character((xoffset+11, yoffset+4), right_arrow)
                 c.draw_character((xoffset+12, yoffset+4), right_arrow)
                 c.draw_character((xoffset+13, yoffset+4), right_arrow)
-                row = row+1
-            elif(dirs[j] == "East"):
+            elif direction == "East":
                 c.draw_character((xoffset+6, yoffset+7), down_arrow)
-                col = col+1
-            elif(dirs[j] == "South"):
+            elif direction == "South":
                 c.draw_character((xoffset+1, yoffset+5), left_arrow)
                 c.draw_character((xoffset+2, yoffset+5), left_arrow)
                 c.draw_character((xoffset+3, yoffset+5), left_arrow)
-                row = row-1
-            elif(dirs[j] == "West"):
+            elif direction == "West":
                 c.draw_character((xoffset+8, yoffset+2), up_arrow)
-                col = col-1
-            elif(dirs[j] == "DMA"):
+            elif direction in ("DMA", "Core"):
                 # draw destination
                 c.draw_character((xoffset+9,yoffset+5), 'D')
 
 
+def route_congestion(route, by_coords):
+    """Return the largest load of the channels the route takes."""
+    worst = 0.0
+    for step in route:
+        if len(step) < 2 or tuple(step[0]) not in by_coords:
+            continue
+        load = loads(by_coords[tuple(step[0])])
+        for direction in step[1]:
+            worst = max(worst, load.get(direction, 0.0))
+    return worst
+
+
+def write_summary(f, switchboxes, by_coords, max_row, cols, routes_through,
+                  count=10):
+    """Write one character per switchbox giving the load of its busiest
+    direction in tenths, '.' when unused and '!' when over capacity, then
+    the most congested switchboxes with the routes through them."""
+    print("Load of the busiest direction of each switchbox, in tenths",
+          file=f)
+    print("col  " + "".join(str(row % 10) for row in range(max_row + 1)) +
+          "  (row)", file=f)
+    for col in cols:
+        line = ""
+        for row in range(max_row + 1):
+            switchbox = by_coords.get((col, row))
+            if switchbox is None:
+                line += " "
+                continue
+            load = congestion(switchbox)
+            if load > 1:
+                line += "!"
+            elif load == 0:
+                line += "."
+            else:
+                line += str(min(int(load * 10), 9))
+        print("{:>3}  {}".format(col, line), file=f)
+    hottest = sorted((s for s in switchboxes if congestion(s) > 0),
+                     key=congestion, reverse=True)[:count]
+    if hottest:
+        print("\nMost congested switchboxes:", file=f)
+    for switchbox in hottest:
+        key = (switchbox['col'], switchbox['row'])
+        print("({}, {}) {:.0%} used, routes {}".format(
+            key[0], key[1], congestion(switchbox),
+            ", ".join(str(r) for r in routes_through.get(key, [])) or "-"),
+            file=f)
+
+
+def parse_range(text):
+    """Parse "a:b" or "a" into an inclusive range of columns."""
+    first, _, last = text.partition(":")
+    return int(first), int(last if last else first)
 
 
-    
 if __name__ == '__main__':
-    # setup python unicode encoding
-    os.system("export PYTHONIOENCODING=utf8")
-
     parser = argparse.ArgumentParser(description='Draw switchboxes, demands and routes')
     parser.add_argument('-j', '--json', help='Filepath for JSON file to read')
     parser.add_argument('-r', '--route_list', help='List of routes to print')
     parser.add_argument('-o', '--output', help='Path to output directory. Text files of the routes will be stored here.')
+    parser.add_argument('-c', '--cols', help='Only draw the columns a:b, inclusive')
+    parser.add_argument('--congestion', type=float, default=0.0,
+                        help='Only print the routes taking a channel loaded '
+                        'at least this much, from 0 to 1')
+    parser.add_argument('-a', '--aggregate', action='store_true',
+                        help='Draw the selected routes together in routes.txt '
+                        'instead of one file per route')
     args = parser.parse_args()
 
     if args.json: json_file_path = args.json
@@ -358,45 +366,103 @@ if __name__ == '__main__':
 
     with open(json_file_path) as f:
         json_data = json.load(f)
-    
-    switchboxes = []
-    routes = []
 
+    switchboxes = []
+    routes = {}
     for key, item in json_data.items():
-        if "switchbox" in key:
+        if key.startswith("switchbox"):
             switchboxes.append(item)
-        if "route" in key:
-            routes.append(item)
-    
-    max_col = 0
-    max_row = 0
+        elif key.startswith("route") and key[5:].isdigit():
+            routes[int(key[5:])] = item
+
+    # the channel counts of the device: aie-flows-to-json gives them with the
+    # switchboxes, routing reports in a list of their own
+    report_capacity = {}
+    for channel in json_data.get("channels", []):
+        report_capacity[(channel['col'], channel['row'],
+                         channel['bundle'])] = channel['max']
     for switchbox in switchboxes:
-        if switchbox['col'] > max_col:
-            max_col = switchbox['col']
-        if switchbox['row'] > max_row:
-            max_row = switchbox['row']
+        switchbox['capacity'] = capacities(switchbox)
+        for direction in DIRECTIONS:
+            key = (switchbox['col'], switchbox['row'], direction)
+            if key in report_capacity:
+                switchbox['capacity'][direction] = report_capacity[key]
+    by_coords = {(s['col'], s['row']): s for s in switchboxes}
+
+    max_col = max([s['col'] for s in switchboxes] + [0])
+    max_row = max([s['row'] for s in switchboxes] + [0])
+    min_col, last_col = parse_range(args.cols) if args.cols else (0, max_col)
+    in_range = lambda col: min_col <= col <= last_col
+    shown = [s for s in switchboxes if in_range(s['col'])]
+
+    routes_through = {}
+    for i, route in sorted(routes.items()):
+        for step in route:
+            if len(step) == 2:
+                routes_through.setdefault(tuple(step[0]), []).append(i)
 
     routes_to_print = []
-    if args.route_list: 
+    if args.route_list:
         for route in args.route_list.split(","):
             routes_to_print.append(int(route.strip()))
-    else: routes_to_print = range(len(routes))
-
-    output_directory = json_file_path.split('.')[0] + '/'
+    else: routes_to_print = sorted(routes)
+    routes_to_print = [
+        i for i in routes_to_print
+        if any(len(step) == 2 and in_range(step[0][0]) for step in routes[i])
+        and route_congestion(routes[i], by_coords) >= args.congestion
+    ]
+
+    output_directory = os.path.splitext(json_file_path)[0] + '/'
     if args.output:
         output_directory = args.output
 
     if not os.path.isdir(output_directory):
         os.mkdir(output_directory)
 
-    for i in routes_to_print:
-        c = canvas(12*(max_row+1), 5+5*(max_col+1));
-        draw_switchboxes(c, switchboxes)
-        filename = os.path.join(output_directory, "route{}.txt".format(i))
-        sys.stdout = sys.__stdout__
-        print("Printing route {} of {}: {}".format(i, len(routes_to_print)-1, filename))
-        with open(filename, 'w') as f:
-            sys.stdout = f
-            print("Route {}: {}".format(i, routes[i]))
-            draw_route(c, routes[i])
-            c.rasterize()
+    # the switchboxes are the same in every drawing
+    width = 12*(max_row+1)
+    height = 5+5*(last_col-min_col+1)
+    base = canvas(width, height)
+    draw_switchboxes(base, shown, min_col)
+    base_rows = base.rasterize()
+
+    filename = os.path.join(output_directory, "summary.txt")
+    print("Printing switchbox demand: {}".format(filename))
+    with open(filename, 'w', encoding='utf8') as f:
+        write_summary(f, shown, by_coords, max_row,
+                      range(min_col, last_col + 1), routes_through)
+        if "hottest_channels" in json_data:
+            print("\nHottest channels:", file=f)
+            for channel in json_data["hottest_channels"]:
+                print("({}, {}) {}: {} of {} used".format(channel['col'],
+                    channel['row'], channel['bundle'], channel['used'],
+                    channel['max']), file=f)
+
+    if args.aggregate and routes_to_print:
+        layer = canvas(width, height)
+        for i in routes_to_print:
+            draw_route(layer, routes[i], in_range, min_col)
+        filename = os.path.join(output_directory, "routes.txt")
+        print("Printing {} routes: {}".format(len(routes_to_print), filename))
+        with open(filename, 'w', encoding='utf8') as f:
+            print("Routes {}".format(
+                ", ".join(str(i) for i in routes_to_print)), file=f)
+            print(overlay(base_rows, layer), file=f)
+    else:
+        for n, i in enumerate(routes_to_print):
+            layer = canvas(width, height)
+            draw_route(layer, routes[i], in_range, min_col)
+            filename = os.path.join(output_directory, "route{}.txt".format(i))
+            print("Printing route {} ({} of {}): {}".format(
+                i, n + 1, len(routes_to_print), filename))
+            with open(filename, 'w', encoding='utf8') as f:
+                print("Route {}: {}".format(i, routes[i]), file=f)
+                print(overlay(base_rows, layer), file=f)
+
+    # routing reports written by aie-create-pathfinder-flows="report-file=..."
+    # have no routes, so draw the demand on every switchbox as a single map
+    if not routes:
+        filename = os.path.join(output_directory, "heatmap.txt")
+        print("Printing switchbox demand: {}".format(filename))
+        with open(filename, 'w', encoding='utf8') as f:
+            print(overlay(base_rows, canvas(width, height)), file=f)
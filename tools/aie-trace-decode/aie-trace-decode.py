@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+aie-trace-decode - turn the trace of AIE tiles into a timeline
+
+The input is the buffer the trace units wrote through a shim DMA, set up with
+mlir_aie_trace_tile and mlir_aie_trace_shim_dma of the test library, as
+32-bit words: one hexadecimal word per line, or raw little-endian words with
+--binary.  The buffer holds packets of a header and 7 words of trace frames,
+each frame telling the events of a trace unit which are up since the
+previous one.  The output is a Chrome trace, which chrome://tracing and
+Perfetto show as one track per event of each trace unit.
+
+The frames are read from the most significant byte of each word:
+  Single0   0eeecccc                    event e after c cycles
+  Single1   10eeeccc +1 byte            11 bits of cycles
+  Single2   110eeecc +2 bytes           18 bits of cycles
+  Multiple0 1110mmmm +1 byte            8-bit event mask m, 4 bits of cycles
+  Multiple1 111101mm +2 bytes           8-bit mask, 10 bits of cycles
+  Multiple2 111110mm +3 bytes           8-bit mask, 18 bits of cycles
+  Start     11110000 +7 bytes           56 bits of timer
+  Repeat0   11111100 +1 byte            previous frame n more times
+  Repeat1   11111101 +2 bytes           previous frame n more times
+  Sync      11111110
+  Filler    11111111
+"""
+
+import argparse
+import json
+import sys
+
+
+def parse_args(args=None):
+    parser = argparse.ArgumentParser(
+        prog='aie-trace-decode',
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('filename', metavar='file', help='trace buffer')
+    parser.add_argument('--binary', action='store_true',
+                        help='read raw little-endian words instead of text')
+    parser.add_argument('--events', action='append', default=[],
+                        metavar='ID=NAME,...',
+                        help='names of the 8 traced events of packet ID, in '
+                        'the order of mlir_aie_trace_tile')
+    parser.add_argument('--clock-mhz', type=float, default=1000.0,
+                        help='clock of the array, to convert the cycles to '
+                        'microseconds (default: 1000)')
+    parser.add_argument('-o', dest='output', default=None,
+                        help='write the timeline here instead of stdout')
+    return parser.parse_args(args)
+
+
+def read_words(opts):
+    with open(opts.filename, 'rb' if opts.binary else 'r') as f:
+        if opts.binary:
+            data = f.read()
+            return [int.from_bytes(data[i:i + 4], 'little')
+                    for i in range(0, len(data) - 3, 4)]
+        return [int(tok, 16) for line in f for tok in line.split()]
+
+
+def is_header(word):
+    """Packet headers have odd parity, so that empty words are not."""
+    return bin(word).count('1') % 2 == 1
+
+
+def split_streams(words):
+    """Returns the frame bytes of each packet ID and the tile of each ID."""
+    streams, tiles = {}, {}
+    i = 0
+    while i < len(words):
+        header = words[i]
+        if not is_header(header):
+            i += 1
+            continue
+        ident = header & 0x1f
+        tiles[ident] = ((header >> 21) & 0x7f, (header >> 16) & 0x1f,
+                        (header >> 12) & 0x7)
+        stream = streams.setdefault(ident, bytearray())
+        for word in words[i + 1:i + 8]:
+            stream += word.to_bytes(4, 'big')
+        i += 8
+    return streams, tiles
+
+
+def frames(data):
+    """Yields the frames of the bytes of a stream as (kind, value, cycles):
+    the events up and the cycles since the previous frame, the timer of a
+    start frame or the count of a repeat frame."""
+    i = 0
+    while i < len(data):
+        b = data[i]
+
+        def field(n):
+            return int.from_bytes(data[i:i + n], 'big')
+        if b >> 7 == 0:
+            yield 'events', {(b >> 4) & 0x7}, b & 0xf
+            i += 1
+        elif b >> 6 == 0b10:
+            v = field(2)
+            yield 'events', {(v >> 11) & 0x7}, v & 0x7ff
+            i += 2
+        elif b >> 5 == 0b110:
+            v = field(3)
+            yield 'events', {(v >> 18) & 0x7}, v & 0x3ffff
+            i += 3
+        elif b >> 4 == 0b1110:
+            v = field(2)
+            yield 'events', mask(v >> 4), v & 0xf
+            i += 2
+        elif b >> 2 == 0b111101:
+            v = field(3)
+            yield 'events', mask(v >> 10), v & 0x3ff
+            i += 3
+        elif b >> 2 == 0b111110:
+            v = field(4)
+            yield 'events', mask(v >> 18), v & 0x3ffff
+            i += 4
+        elif b == 0xf0:
+            yield 'start', field(8) & ((1 << 56) - 1), 0
+            i += 8
+        elif b == 0xfc:
+            yield 'repeat', field(2) & 0xff, 0
+            i += 2
+        elif b == 0xfd:
+            yield 'repeat', field(3) & 0xffff, 0
+            i += 3
+        else:
+            # Sync, filler and unknown bytes carry no event.
+            i += 1
+
+
+def mask(bits):
+    return {e for e in range(8) if bits & (1 << e)}
+
+
+def decode(ident, data, names, clock_mhz):
+    """Returns the begin and end events of the events of a stream."""
+    def name(e):
+        return names[e] if e < len(names) else 'event%d' % e
+
+    out = []
+    time, up = 0, set()
+
+    def advance(events_up, cycles):
+        nonlocal time, up
+        time += cycles
+        ts = time / clock_mhz
+        for e in sorted(up - events_up):
+            out.append({'name': name(e), 'ph': 'E', 'ts': ts, 'pid': ident,
+                        'tid': e})
+        for e in sorted(events_up - up):
+            out.append({'name': name(e), 'ph': 'B', 'ts': ts, 'pid': ident,
+                        'tid': e})
+        up = set(events_up)
+
+    last = None
+    for kind, value, cycles in frames(data):
+        if kind == 'start':
+            time = value
+        elif kind == 'events':
+            advance(value, cycles)
+            last = (value, cycles)
+        elif kind == 'repeat' and last:
+            for _ in range(value):
+                advance(*last)
+    advance(set(), 0)
+    return out
+
+
+def main(args=None):
+    opts = parse_args(args)
+    names = {}
+    for spec in opts.events:
+        ident, _, events = spec.partition('=')
+        names[int(ident, 0)] = events.split(',')
+    streams, tiles = split_streams(read_words(opts))
+
+    modules = ['core', 'memory', 'shim']
+    trace = []
+    for ident in sorted(streams):
+        col, row, kind = tiles[ident]
+        module = modules[kind] if kind < len(modules) else 'type%d' % kind
+        trace.append({'name': 'process_name', 'ph': 'M', 'pid': ident,
+                      'args': {'name': 'tile(%d, %d) %s' % (col, row,
+                                                            module)}})
+        events = decode(ident, streams[ident], names.get(ident, []),
+                        opts.clock_mhz)
+        for tid in sorted({e['tid'] for e in events}):
+            name = next(e['name'] for e in events if e['tid'] == tid)
+            trace.append({'name': 'thread_name', 'ph': 'M', 'pid': ident,
+                          'tid': tid, 'args': {'name': name}})
+        trace += events
+
+    text = '{"traceEvents": [\n' + ',\n'.join(json.dumps(e) for e in trace)
+    text += '\n]}\n'
+    if opts.output:
+        with open(opts.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,424 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+aievec-batch-sim - run many aievec kernel tests in one simulation
+
+Each test of test/unit_tests/aievec_tests and test/Integration/Dialect/TOSA
+generates its kernel with the RUN lines before its xchesscc_wrapper one, then
+compiles it with its testbench and starts the ISS on its own, which takes
+most of its time.  This harness generates the kernels of all the tests it is
+given, links them with their testbenches into one program per target, runs
+the program in a single ISS session and reports, for each kernel, whether it
+matched its reference data and its cycle count.
+
+The testbench of each kernel is compiled in its own namespace, with its main
+function renamed, and writes its data to its own directory.  The batches
+which do not fit in the memory of the core, or which do not build, are split
+in halves until they do.  With --baseline, the cycle counts are compared to
+the ones of a previous run, so that the harness can gate the changes on the
+kernel performance.
+"""
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+
+DEFAULT_COMPILER = 'xchesscc_wrapper {arch} -f -g +s +w work +o work {source}'
+DEFAULT_SIMULATOR = 'xca_udm_dbg {flags} -t "{tcl} ./work/a.out"'
+
+
+def parse_args(args=None):
+    parser = argparse.ArgumentParser(
+        prog='aievec-batch-sim',
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('paths', metavar='path', nargs='+',
+                        help='test files, or directories searched for them')
+    parser.add_argument('--work-dir', default='aievec-batch-sim.work',
+                        help='directory the kernels are built and run in')
+    parser.add_argument('--aietools',
+                        default=os.environ.get('AIETOOLS', ''),
+                        help='Vitis aietools directory (default: $AIETOOLS)')
+    parser.add_argument('--max-batch', type=int, default=32,
+                        help='most kernels linked in one program')
+    parser.add_argument('--compiler', default=DEFAULT_COMPILER,
+                        help='shell command compiling {source} for {arch} '
+                        'into work/a.out (default: %(default)s)')
+    parser.add_argument('--simulator', default=DEFAULT_SIMULATOR,
+                        help='shell command running work/a.out with the ISS '
+                        '{flags} of the tests and their {tcl} script '
+                        '(default: %(default)s)')
+    parser.add_argument('--baseline', default=None,
+                        help='JSON file holding the cycle count of each '
+                        'kernel of a previous run')
+    parser.add_argument('--tolerance', type=float, default=2.0,
+                        help='percentage of cycles a kernel may gain over '
+                        'its baseline (default: 2)')
+    parser.add_argument('--update-baseline', action='store_true',
+                        help='write the cycle counts of this run to the '
+                        'baseline file')
+    parser.add_argument('-j', dest='jobs', type=int, default=1,
+                        help='number of kernels generated, and of batches '
+                        'run, at once')
+    parser.add_argument('-v', dest='verbose', action='store_true',
+                        help='print the commands run')
+    return parser.parse_args(args)
+
+
+def read_run_lines(path):
+    """Returns the RUN lines of the test at path, with their continuations
+    joined."""
+    lines, current = [], ''
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'\s*//\s*RUN:(.*)', line)
+            if not m:
+                continue
+            current += m.group(1).strip()
+            if current.endswith('\\'):
+                current = current[:-1] + ' '
+                continue
+            lines.append(current)
+            current = ''
+    return lines
+
+
+class LitConfig:
+    """Stands in for the lit configuration of the lit.local.cfg files, to
+    collect their substitutions.  The other settings read are unset."""
+
+    def __init__(self):
+        self.substitutions = []
+        self.unsupported = []
+
+    def __getattr__(self, name):
+        return None
+
+
+def local_substitutions(path):
+    """Returns the substitutions of the lit.local.cfg files of the
+    directories of path, the innermost ones first."""
+    substitutions = []
+    directory = os.path.dirname(os.path.abspath(path))
+    while True:
+        cfg = os.path.join(directory, 'lit.local.cfg')
+        if os.path.exists(cfg):
+            config = LitConfig()
+            try:
+                with open(cfg) as f:
+                    exec(compile(f.read(), cfg, 'exec'), {'config': config})
+            except Exception:
+                pass
+            substitutions += config.substitutions
+        if os.path.exists(os.path.join(directory, 'lit.cfg.py')):
+            return substitutions
+        parent = os.path.dirname(directory)
+        if parent == directory:
+            return substitutions
+        directory = parent
+
+
+class Kernel:
+    def __init__(self, path, name):
+        self.path = os.path.abspath(path)
+        self.name = name
+        self.ident = re.sub(r'\W', '_', name)
+        self.generate, self.arch, self.testbench = [], None, None
+        self.flags, self.tcl = None, None
+
+
+def parse_kernel(path, name, opts):
+    """Returns the Kernel of the test at path, or None if it does not build
+    a testbench with xchesscc_wrapper and run it with xca_udm_dbg."""
+    kernel = Kernel(path, name)
+    src_dir = os.path.dirname(kernel.path)
+    substitutions = local_substitutions(path) + [
+        ('%aietools', opts.aietools), ('%s', kernel.path), ('%S', src_dir)]
+
+    def substitute(line, tmp):
+        for key, value in substitutions + [('%t', tmp)]:
+            line = line.replace(key, value)
+        return line
+
+    kernel.substitute = substitute
+    for line in read_run_lines(path):
+        command = line.split(None, 1)
+        if command and command[0] == 'xchesscc_wrapper':
+            words = shlex.split(command[1])
+            kernel.arch = words[0]
+            sources = [w for w in words if w.endswith('testbench.cc')]
+            if sources:
+                kernel.testbench = sources[0]
+        elif command and command[0] == 'xca_udm_dbg':
+            command = command[1].split('>', 1)[0]
+            m = re.search(r'-t\s+"(\S+)', command)
+            if m:
+                kernel.tcl = m.group(1)
+            kernel.flags = re.sub(r'-t\s+"[^"]*"', '', command).strip()
+        elif kernel.arch is None:
+            kernel.generate.append(line)
+    if not kernel.arch or not kernel.testbench or kernel.flags is None:
+        return None
+    return kernel
+
+
+def find_tests(paths):
+    """Returns the test files of paths, and their names relative to the
+    directories given."""
+    tests = []
+    for path in paths:
+        if os.path.isfile(path):
+            tests.append((path, os.path.splitext(os.path.basename(path))[0]))
+            continue
+        for root, dirs, files in os.walk(path):
+            dirs.sort()
+            for f in sorted(files):
+                if f.endswith('.mlir'):
+                    full = os.path.join(root, f)
+                    rel = os.path.relpath(os.path.dirname(full), path)
+                    name = os.path.splitext(f)[0]
+                    tests.append((full, name if rel == '.' else
+                                  os.path.join(rel, name)))
+    return tests
+
+
+def hoist_includes(path, kernel_dir):
+    """Returns the includes of the file at path which must be outside of the
+    namespace of its kernel, and its text with the other includes made
+    absolute.  Only the headers of kernel_dir, which are the kernel's own,
+    are kept in its namespace: the other ones are shared by the kernels."""
+    hoisted, lines = [], []
+    directory = os.path.dirname(os.path.abspath(path))
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'\s*#\s*include\s*([<"])([^>"]+)[>"]', line)
+            if not m:
+                lines.append(line)
+                continue
+            if m.group(1) == '<':
+                hoisted.append(line.strip())
+                continue
+            header = os.path.normpath(os.path.join(directory, m.group(2)))
+            include = '#include "%s"' % header
+            if os.path.dirname(header) == kernel_dir:
+                lines.append(include + '\n')
+            else:
+                hoisted.append(include)
+    return hoisted, ''.join(lines)
+
+
+class Harness:
+    def __init__(self, opts):
+        self.opts = opts
+        self.work_dir = os.path.abspath(opts.work_dir)
+
+    def run(self, command, cwd):
+        if self.opts.verbose:
+            print(command)
+        return subprocess.run(command, cwd=cwd, shell=True,
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              universal_newlines=True)
+
+    def generate(self, kernel):
+        """Generates the dut.cc of kernel with the RUN lines of its test.
+        Returns None, or an error message."""
+        tmp = os.path.join(self.work_dir, 'kernels', kernel.ident)
+        shutil.rmtree(tmp, ignore_errors=True)
+        os.makedirs(tmp)
+        kernel.dir = tmp
+        for line in kernel.generate:
+            result = self.run(kernel.substitute(line, tmp), tmp)
+            if result.returncode != 0:
+                return 'generating the kernel failed:\n' + result.stdout
+        kernel.dut = os.path.join(tmp, 'dut.cc')
+        if not os.path.exists(kernel.dut):
+            return 'no dut.cc generated'
+        kernel.testbench = kernel.substitute(kernel.testbench, tmp)
+        if kernel.tcl:
+            kernel.tcl = os.path.normpath(kernel.substitute(kernel.tcl, tmp))
+        kernel.flags = kernel.substitute(kernel.flags, tmp)
+        return None
+
+    def write_batch(self, kernels, directory):
+        """Writes the program running kernels one after the other in
+        directory.  Returns its source file."""
+        prelude, bodies, calls = [], [], []
+        for i, kernel in enumerate(kernels):
+            data_dir = 'data_%d' % i
+            shutil.rmtree(os.path.join(directory, data_dir),
+                          ignore_errors=True)
+            src_data = os.path.join(os.path.dirname(kernel.path), 'data')
+            if os.path.isdir(src_data):
+                shutil.copytree(src_data, os.path.join(directory, data_dir))
+            else:
+                os.makedirs(os.path.join(directory, data_dir))
+
+            # The headers of the system and of the compiler are included
+            # once, outside of the namespaces of the kernels.
+            kernel_dir = os.path.dirname(kernel.path)
+            dut_includes, dut = hoist_includes(kernel.dut, kernel_dir)
+            tb_includes, testbench = hoist_includes(kernel.testbench,
+                                                    kernel_dir)
+            prelude += [i for i in dut_includes + tb_includes
+                        if i not in prelude]
+            namespace = 'aievec_batch_%d_%s' % (i, kernel.ident)
+            bodies.append('#undef DATA_DIR\n#define DATA_DIR %s\n'
+                          'namespace %s {\n%s\n%s\n} // namespace %s\n' %
+                          (data_dir, namespace, dut, testbench, namespace))
+            takes_args = not re.search(r'\bint\s+main\s*\(\s*(void)?\s*\)',
+                                       testbench)
+            calls.append('  printf("KERNEL %s\\n");\n'
+                         '  failed += %s::run(%s) != 0;\n' %
+                         (kernel.name, namespace,
+                          'argc, argv' if takes_args else ''))
+
+        source = os.path.join(directory, 'batch.cc')
+        with open(source, 'w') as f:
+            f.write('// Generated by aievec-batch-sim.py\n')
+            for include in prelude:
+                f.write(include + '\n')
+            f.write('#include <cstdio>\n#define main run\n')
+            for body in bodies:
+                f.write(body)
+            f.write('#undef main\n\nint main(int argc, char *argv[]) {\n'
+                    '  int failed = 0;\n%s  return failed;\n}\n' %
+                    ''.join(calls))
+        return source
+
+    def run_batch(self, kernels, index):
+        """Builds and runs kernels in one program.  Returns the result of
+        each kernel: its cycle count or None, and its status."""
+        directory = os.path.join(self.work_dir, 'batches', str(index))
+        os.makedirs(directory, exist_ok=True)
+        source = self.write_batch(kernels, directory)
+        build = self.run(self.opts.compiler.format(arch=kernels[0].arch,
+                                                   source=source), directory)
+        if build.returncode != 0:
+            if len(kernels) == 1:
+                return {kernels[0].name: (None, 'BUILD FAILED')}
+            # Most likely, the buffers of the kernels do not fit together.
+            half = len(kernels) // 2
+            results = self.run_batch(kernels[:half], '%s.0' % index)
+            results.update(self.run_batch(kernels[half:], '%s.1' % index))
+            return results
+
+        sim = self.run(self.opts.simulator.format(flags=kernels[0].flags,
+                                                  tcl=kernels[0].tcl or ''),
+                       directory)
+        with open(os.path.join(directory, 'sim.stdout'), 'w') as f:
+            f.write(sim.stdout)
+        results, current, cycles = {}, None, None
+        for line in sim.stdout.splitlines():
+            m = re.match(r'KERNEL (\S+)', line)
+            if m:
+                current, cycles = m.group(1), None
+                continue
+            m = re.search(r'Cycle count: (\d+)', line)
+            if m and current:
+                cycles = int(m.group(1))
+            elif current and 'TEST PASSED' in line:
+                results[current] = (cycles, 'PASSED')
+                current = None
+            elif current and 'TEST FAILED' in line:
+                results[current] = (cycles, 'FAILED')
+                current = None
+
+        # A kernel which stopped the simulation has no result: the kernels
+        # after it run again in another batch.
+        missing = [k for k in kernels if k.name not in results]
+        if missing:
+            results[missing[0].name] = (None, 'NO RESULT')
+            if len(missing) > 1:
+                results.update(self.run_batch(missing[1:], '%s.r' % index))
+        return results
+
+
+def load_baseline(path):
+    if not path or not os.path.exists(path):
+        return {}
+    with open(path) as f:
+        return json.load(f)
+
+
+def save_baseline(path, baseline):
+    with open(path, 'w') as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.write('\n')
+
+
+def main(args=None):
+    opts = parse_args(args)
+    harness = Harness(opts)
+    kernels = []
+    for path, name in find_tests(opts.paths):
+        kernel = parse_kernel(path, name, opts)
+        if kernel:
+            kernels.append(kernel)
+    if not kernels:
+        print('error: no kernel test found', file=sys.stderr)
+        return 1
+
+    results = {}
+    with concurrent.futures.ThreadPoolExecutor(opts.jobs) as pool:
+        generated = []
+        for kernel, error in zip(kernels, pool.map(harness.generate,
+                                                   kernels)):
+            if error:
+                print('%s: skipped, %s' % (kernel.name, error),
+                      file=sys.stderr)
+                results[kernel.name] = (None, 'NOT GENERATED')
+            else:
+                generated.append(kernel)
+
+        # The kernels of a batch share the target and the ISS setup.
+        groups = {}
+        for kernel in generated:
+            groups.setdefault((kernel.arch, kernel.flags, kernel.tcl),
+                              []).append(kernel)
+        batches = []
+        for group in groups.values():
+            for i in range(0, len(group), opts.max_batch):
+                batches.append(group[i:i + opts.max_batch])
+        for batch_results in pool.map(harness.run_batch, batches,
+                                      range(len(batches))):
+            results.update(batch_results)
+
+    baseline = load_baseline(opts.baseline)
+    failed = False
+    for kernel in kernels:
+        cycles, status = results.get(kernel.name, (None, 'NO RESULT'))
+        line = '%s: %s' % (kernel.name, status)
+        if cycles is not None:
+            line += ', %d cycles' % cycles
+            before = baseline.get(kernel.name)
+            if before:
+                change = 100.0 * (cycles - before) / before
+                line += ' (baseline %d, %+.1f%%)' % (before, change)
+                if change > opts.tolerance and not opts.update_baseline:
+                    line += ' REGRESSION'
+                    failed = True
+        failed |= status != 'PASSED'
+        print(line)
+
+    if opts.baseline and opts.update_baseline:
+        for name, (cycles, status) in results.items():
+            if cycles is not None and status == 'PASSED':
+                baseline[name] = cycles
+        save_baseline(opts.baseline, baseline)
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
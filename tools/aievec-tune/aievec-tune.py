@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# This file is licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# (c) Copyright 2023 Advanced Micro Devices, Inc.
+
+"""
+aievec-tune - search the aie-vectorize parameters of a kernel
+
+Each configuration of the sweep vectorizes the kernel with aie-opt
+--aievec-raise-to-affine -affine-super-vectorize --aie-vectorize, which also
+vectorizes the scf loops of the frontends, translates it to C++ with
+aie-translate --aievec-to-cpp and runs the measure command on the result.
+The measure command compiles and runs the kernel, for instance with
+xchesscc_wrapper and the ISS, in aiesimulator or on a board reading the
+EventMonitor counters, and prints its cycle count.  The fastest configuration
+is cached per kernel signature, so that later runs reuse it.
+"""
+
+import argparse
+import concurrent.futures
+import hashlib
+import itertools
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+PARAMS = ['vector_size', 'shift', 'zero_offset', 'dup_factor']
+
+
+def int_list(s):
+    return [int(v) for v in s.split(',') if v]
+
+
+def parse_args(args=None):
+    parser = argparse.ArgumentParser(
+        prog='aievec-tune',
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('filename', metavar='file', help='affine kernel to tune')
+    parser.add_argument('--measure', required=True,
+                        help='shell command printing the cycle count of the '
+                        'kernel. {cpp} is replaced by the generated C++ file, '
+                        '{dir} by its directory and {vector_size}, {shift}, '
+                        '{zero_offset} and {dup_factor} by the configuration')
+    parser.add_argument('--cycles-regex', default=r'(?i)cycles?\D*(\d+)',
+                        help='regular expression whose first group is the '
+                        'cycle count in the output of the measure command; '
+                        'the last match counts')
+    parser.add_argument('--vector-size', type=int_list, default=[16],
+                        help='virtual vector sizes of the affine '
+                        'super-vectorizer to try (default: 16)')
+    parser.add_argument('--shift', type=int_list, default=[0],
+                        help='shift parameters to try (default: 0)')
+    parser.add_argument('--zero-offset', type=int_list, default=[0],
+                        help='zero offsets to try (default: 0)')
+    parser.add_argument('--dup-factor', type=int_list, default=[2],
+                        help='duplication factors to try (default: 2)')
+    parser.add_argument('--aieml', action='store_true',
+                        help='vectorize for AIE2')
+    parser.add_argument('--cache', default=None,
+                        help='JSON file holding the best configuration of '
+                        'each kernel signature')
+    parser.add_argument('--retune', action='store_true',
+                        help='search again even if the kernel is cached')
+    parser.add_argument('-o', dest='output', default=None,
+                        help='write the C++ of the best configuration here')
+    parser.add_argument('-j', dest='jobs', type=int, default=1,
+                        help='number of configurations measured at once')
+    parser.add_argument('-v', dest='verbose', action='store_true',
+                        help='print the commands run')
+    return parser.parse_args(args)
+
+
+def vectorize_options(config):
+    return '--aie-vectorize="shift=%d zero-offset=%d dup-factor=%d"' % (
+        config['shift'], config['zero_offset'], config['dup_factor'])
+
+
+def describe(config):
+    return ' '.join('%s=%d' % (p, config[p]) for p in PARAMS)
+
+
+def signature(opts, kernel):
+    """The kernel signature: the kernel text and the target it is tuned for,
+    independent of where the file is."""
+    h = hashlib.sha256()
+    h.update(kernel.encode())
+    h.update(b'aieml' if opts.aieml else b'aie')
+    return h.hexdigest()
+
+
+def search_space(opts):
+    return {'vector_size': opts.vector_size, 'shift': opts.shift,
+            'zero_offset': opts.zero_offset, 'dup_factor': opts.dup_factor}
+
+
+class Tuner:
+    def __init__(self, opts, workdir):
+        self.opts = opts
+        self.workdir = workdir
+
+    def run(self, command, cwd):
+        if self.opts.verbose:
+            print(command if isinstance(command, str) else
+                  ' '.join(shlex.quote(c) for c in command))
+        return subprocess.run(command, cwd=cwd, shell=isinstance(command, str),
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              universal_newlines=True)
+
+    def generate(self, config, cwd):
+        """Vectorizes the kernel with config and translates it to C++ in cwd.
+        Returns the C++ file, or None and an error message."""
+        aievec = os.path.join(cwd, 'aievec.mlir')
+        cpp = os.path.join(cwd, 'kernel.cc')
+        target = ['-aieml=true'] if self.opts.aieml else []
+
+        opt = self.run(['aie-opt', os.path.abspath(self.opts.filename),
+                        '--aievec-raise-to-affine',
+                        '-affine-super-vectorize=virtual-vector-size=%d' %
+                        config['vector_size'],
+                        '--aie-vectorize=shift=%d zero-offset=%d dup-factor=%d'
+                        % (config['shift'], config['zero_offset'],
+                           config['dup_factor'])] + target +
+                       ['-canonicalize', '-o', aievec], cwd)
+        if opt.returncode != 0:
+            return None, 'aie-opt failed:\n' + opt.stdout
+        translate = self.run(['aie-translate', aievec] + target +
+                             ['--aievec-to-cpp', '-o', cpp], cwd)
+        if translate.returncode != 0:
+            return None, 'aie-translate failed:\n' + translate.stdout
+        return cpp, None
+
+    def measure(self, config):
+        """Returns the cycle count of config and its C++ file, or None and an
+        error message."""
+        cwd = os.path.join(self.workdir, '_'.join(str(config[p])
+                                                  for p in PARAMS))
+        os.makedirs(cwd, exist_ok=True)
+        cpp, error = self.generate(config, cwd)
+        if cpp is None:
+            return None, error
+
+        measure = self.run(self.opts.measure.format(cpp=cpp, dir=cwd, **config),
+                           cwd)
+        if measure.returncode != 0:
+            return None, 'measure command failed:\n' + measure.stdout
+        cycles = re.findall(self.opts.cycles_regex, measure.stdout)
+        if not cycles:
+            return None, 'no cycle count in:\n' + measure.stdout
+        return int(cycles[-1]), cpp
+
+    def tune(self):
+        space = search_space(self.opts)
+        configs = [dict(zip(PARAMS, values))
+                   for values in itertools.product(*(space[p] for p in PARAMS))]
+        results = []
+        with concurrent.futures.ThreadPoolExecutor(self.opts.jobs) as pool:
+            for config, (cycles, info) in zip(configs,
+                                              pool.map(self.measure, configs)):
+                if cycles is None:
+                    print('%s: skipped, %s' % (describe(config), info),
+                          file=sys.stderr)
+                    continue
+                print('%s: %d cycles' % (describe(config), cycles))
+                results.append((cycles, config, info))
+        if not results:
+            return None
+        # ties go to the first configuration of the sweep
+        return min(results, key=lambda r: r[0])
+
+
+def load_cache(path):
+    if not path or not os.path.exists(path):
+        return {}
+    with open(path) as f:
+        return json.load(f)
+
+
+def save_cache(path, cache):
+    with open(path, 'w') as f:
+        json.dump(cache, f, indent=2, sort_keys=True)
+        f.write('\n')
+
+
+def main(args=None):
+    opts = parse_args(args)
+    with open(opts.filename) as f:
+        kernel = f.read()
+    key = signature(opts, kernel)
+
+    cache = load_cache(opts.cache)
+    entry = cache.get(key)
+    with tempfile.TemporaryDirectory(prefix='aievec-tune-') as workdir:
+        tuner = Tuner(opts, workdir)
+        if entry and not opts.retune and entry['space'] == search_space(opts):
+            config, cycles = entry['config'], entry['cycles']
+            print('cached')
+            cpp = None
+            if opts.output:
+                cpp, error = tuner.generate(config, workdir)
+                if cpp is None:
+                    print('error: ' + error, file=sys.stderr)
+                    return 1
+        else:
+            best = tuner.tune()
+            if best is None:
+                print('error: no configuration could be measured',
+                      file=sys.stderr)
+                return 1
+            cycles, config, cpp = best
+            if opts.cache:
+                cache[key] = {'file': os.path.basename(opts.filename),
+                              'config': config, 'cycles': cycles,
+                              'space': search_space(opts)}
+                save_cache(opts.cache, cache)
+
+        print('best: %s, %d cycles' % (describe(config), cycles))
+        print('aie-opt --aievec-raise-to-affine '
+              '-affine-super-vectorize="virtual-vector-size=%d" %s' %
+              (config['vector_size'], vectorize_options(config)))
+        if opts.output:
+            with open(cpp) as src, open(opts.output, 'w') as dst:
+                dst.write(src.read())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())